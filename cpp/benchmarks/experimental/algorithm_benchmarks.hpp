@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <utilities/bench_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <limits>
+
+namespace cugraph {
+namespace bench {
+
+// benchmarks the experimental algorithms: the pull (store_transposed = true) model algorithms on
+// an unweighted graph and the push model algorithms on a weighted graph (both generated from the
+// same RMAT parameters)
+template <bool multi_gpu>
+struct algorithm_benchmarks_t {
+  template <typename vertex_t, typename edge_t>
+  static void run(raft::handle_t const& handle, bench_context_t& context)
+  {
+    using weight_t = float;
+    using result_t = float;
+
+    {
+      auto graph =
+        generate_rmat_graph<vertex_t, edge_t, weight_t, true, multi_gpu>(handle, context, false);
+      auto graph_view      = graph.view();
+      context.num_vertices = static_cast<size_t>(graph_view.get_number_of_vertices());
+      context.num_edges    = static_cast<size_t>(graph_view.get_number_of_edges());
+
+      run_pull_benchmarks<result_t>(handle, context, graph_view);
+    }
+
+    {
+      auto graph =
+        generate_rmat_graph<vertex_t, edge_t, weight_t, false, multi_gpu>(handle, context, true);
+      auto graph_view = graph.view();
+
+      run_push_benchmarks(handle, context, graph_view);
+    }
+  }
+
+  template <typename result_t, typename GraphViewType>
+  static void run_pull_benchmarks(raft::handle_t const& handle,
+                                  bench_context_t const& context,
+                                  GraphViewType const& graph_view)
+  {
+    using vertex_t = typename GraphViewType::vertex_type;
+
+    rmm::device_uvector<result_t> scores(graph_view.get_number_of_local_vertices(),
+                                         handle.get_stream());
+    rmm::device_uvector<result_t> authorities(graph_view.get_number_of_local_vertices(),
+                                              handle.get_stream());
+
+    run_benchmark(handle, context, "pagerank", [&]() {
+      experimental::pagerank(handle,
+                             graph_view,
+                             static_cast<typename GraphViewType::weight_type const*>(nullptr),
+                             static_cast<vertex_t const*>(nullptr),
+                             static_cast<result_t const*>(nullptr),
+                             vertex_t{0},
+                             scores.data(),
+                             result_t{0.85},
+                             result_t{1e-6},
+                             size_t{500},
+                             false,
+                             false);
+    });
+
+    auto const alpha =
+      result_t{1.0} / static_cast<result_t>(graph_view.compute_max_in_degree(handle) + 1);
+    run_benchmark(handle, context, "katz_centrality", [&]() {
+      experimental::katz_centrality(handle,
+                                    graph_view,
+                                    static_cast<result_t const*>(nullptr),
+                                    scores.data(),
+                                    alpha,
+                                    result_t{1.0},
+                                    result_t{1e-6},
+                                    size_t{500},
+                                    false,
+                                    true,
+                                    false);
+    });
+
+    run_benchmark(handle, context, "hits", [&]() {
+      experimental::hits(handle,
+                         graph_view,
+                         scores.data(),
+                         authorities.data(),
+                         result_t{1e-6},
+                         size_t{500},
+                         false,
+                         true,
+                         false);
+    });
+  }
+
+  template <typename GraphViewType>
+  static void run_push_benchmarks(raft::handle_t const& handle,
+                                  bench_context_t const& context,
+                                  GraphViewType const& graph_view)
+  {
+    using vertex_t = typename GraphViewType::vertex_type;
+    using weight_t = typename GraphViewType::weight_type;
+
+    rmm::device_uvector<vertex_t> d_distances(graph_view.get_number_of_local_vertices(),
+                                              handle.get_stream());
+    rmm::device_uvector<weight_t> d_weighted_distances(graph_view.get_number_of_local_vertices(),
+                                                       handle.get_stream());
+    rmm::device_uvector<vertex_t> d_predecessors(graph_view.get_number_of_local_vertices(),
+                                                 handle.get_stream());
+
+    // vertex 0 is a high degree vertex in an (unscrambled) RMAT graph (if not renumbered)
+    run_benchmark(handle, context, "bfs", [&]() {
+      experimental::bfs(handle,
+                        graph_view,
+                        d_distances.data(),
+                        d_predecessors.data(),
+                        vertex_t{0},
+                        false,
+                        std::numeric_limits<vertex_t>::max(),
+                        false);
+    });
+
+    run_benchmark(handle, context, "bfs_direction_optimizing", [&]() {
+      experimental::bfs(handle,
+                        graph_view,
+                        d_distances.data(),
+                        d_predecessors.data(),
+                        vertex_t{0},
+                        true,
+                        std::numeric_limits<vertex_t>::max(),
+                        false);
+    });
+
+    run_benchmark(handle, context, "sssp", [&]() {
+      experimental::sssp(handle,
+                         graph_view,
+                         d_weighted_distances.data(),
+                         d_predecessors.data(),
+                         vertex_t{0},
+                         std::numeric_limits<weight_t>::max(),
+                         false,
+                         false);
+    });
+
+    run_benchmark(handle, context, "sssp_adaptive_delta", [&]() {
+      experimental::sssp(handle,
+                         graph_view,
+                         d_weighted_distances.data(),
+                         d_predecessors.data(),
+                         vertex_t{0},
+                         std::numeric_limits<weight_t>::max(),
+                         false,
+                         true);
+    });
+  }
+};
+
+}  // namespace bench
+}  // namespace cugraph
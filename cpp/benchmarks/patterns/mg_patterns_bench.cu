@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pattern_benchmarks.cuh"
+
+#include <partition_manager.hpp>
+
+#include <raft/comms/mpi_comms.hpp>
+
+// weak scaling: mpirun -np <# GPUs> MG_PATTERNS_BENCH --scales <per GPU scales> --weak_scaling
+// strong scaling: mpirun -np <# GPUs> MG_PATTERNS_BENCH --scales <aggregate scales>
+CUGRAPH_MG_BENCH_PROGRAM_MAIN(cugraph::bench::pattern_benchmarks_t<true>)
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <utilities/bench_utilities.hpp>
+
+#include <experimental/detail/graph_utils.cuh>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+#include <patterns/any_of_adj_matrix_row.cuh>
+#include <patterns/copy_to_adj_matrix_row_col.cuh>
+#include <patterns/copy_v_transform_reduce_in_out_nbr.cuh>
+#include <patterns/copy_v_transform_reduce_key_aggregated_out_nbr.cuh>
+#include <patterns/count_if_e.cuh>
+#include <patterns/count_if_v.cuh>
+#include <patterns/reduce_op.cuh>
+#include <patterns/reduce_v.cuh>
+#include <patterns/transform_reduce_by_adj_matrix_row_col_key_e.cuh>
+#include <patterns/transform_reduce_e.cuh>
+#include <patterns/transform_reduce_v.cuh>
+#include <patterns/update_frontier_v_push_if_out_nbr.cuh>
+#include <patterns/vertex_frontier.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <vector>
+
+namespace cugraph {
+namespace bench {
+
+// number of distinct keys used by the key-based patterns (mimics Louvain's cluster ids)
+size_t constexpr num_pattern_bench_keys{1024};
+
+// benchmarks every primitive in patterns/, the edge primitives on both the push
+// (store_transposed = false) and, for copy_v_transform_reduce_in|out_nbr, the pull
+// (store_transposed = true) graphs
+template <bool multi_gpu>
+struct pattern_benchmarks_t {
+  template <typename vertex_t, typename edge_t>
+  static void run(raft::handle_t const& handle, bench_context_t& context)
+  {
+    using weight_t = float;
+
+    {
+      auto graph =
+        generate_rmat_graph<vertex_t, edge_t, weight_t, false, multi_gpu>(handle, context, true);
+      auto graph_view      = graph.view();
+      context.num_vertices = static_cast<size_t>(graph_view.get_number_of_vertices());
+      context.num_edges    = static_cast<size_t>(graph_view.get_number_of_edges());
+
+      run_push_benchmarks(handle, context, graph_view);
+    }
+
+    {
+      auto graph =
+        generate_rmat_graph<vertex_t, edge_t, weight_t, true, multi_gpu>(handle, context, true);
+      auto graph_view = graph.view();
+
+      run_pull_benchmarks(handle, context, graph_view);
+    }
+  }
+
+  template <typename GraphViewType>
+  static void run_push_benchmarks(raft::handle_t const& handle,
+                                  bench_context_t const& context,
+                                  GraphViewType const& graph_view)
+  {
+    using vertex_t = typename GraphViewType::vertex_type;
+    using value_t  = float;
+
+    auto policy = rmm::exec_policy(handle.get_stream())->on(handle.get_stream());
+
+    rmm::device_uvector<value_t> vertex_values(graph_view.get_number_of_local_vertices(),
+                                               handle.get_stream());
+    rmm::device_uvector<value_t> vertex_outputs(graph_view.get_number_of_local_vertices(),
+                                                handle.get_stream());
+    rmm::device_uvector<value_t> row_values(
+      graph_view.get_number_of_local_adj_matrix_partition_rows(), handle.get_stream());
+    rmm::device_uvector<value_t> col_values(
+      graph_view.get_number_of_local_adj_matrix_partition_cols(), handle.get_stream());
+    thrust::fill(policy, vertex_values.begin(), vertex_values.end(), value_t{1.0});
+    thrust::fill(policy, row_values.begin(), row_values.end(), value_t{1.0});
+    thrust::fill(policy, col_values.begin(), col_values.end(), value_t{1.0});
+
+    // 1. vertex primitives
+
+    run_benchmark(handle, context, "copy_to_adj_matrix_row", [&]() {
+      experimental::copy_to_adj_matrix_row(
+        handle, graph_view, vertex_values.begin(), row_values.begin());
+    });
+
+    run_benchmark(handle, context, "copy_to_adj_matrix_col", [&]() {
+      experimental::copy_to_adj_matrix_col(
+        handle, graph_view, vertex_values.begin(), col_values.begin());
+    });
+
+    run_benchmark(handle, context, "any_of_adj_matrix_row", [&]() {
+      experimental::any_of_adj_matrix_row(
+        handle, graph_view, row_values.begin(), [] __device__(auto val) { return val < 0.0; });
+    });
+
+    run_benchmark(handle, context, "count_if_v", [&]() {
+      experimental::count_if_v(
+        handle, graph_view, vertex_values.begin(), [] __device__(auto val) { return val > 0.5; });
+    });
+
+    run_benchmark(handle, context, "reduce_v", [&]() {
+      experimental::reduce_v(handle, graph_view, vertex_values.begin(), value_t{0.0});
+    });
+
+    run_benchmark(handle, context, "transform_reduce_v", [&]() {
+      experimental::transform_reduce_v(
+        handle,
+        graph_view,
+        vertex_values.begin(),
+        [] __device__(auto val) { return val * val; },
+        value_t{0.0});
+    });
+
+    // 2. edge primitives
+
+    run_benchmark(handle, context, "count_if_e", [&]() {
+      experimental::count_if_e(
+        handle,
+        graph_view,
+        row_values.begin(),
+        col_values.begin(),
+        [] __device__(vertex_t src, vertex_t dst, auto src_val, auto dst_val) {
+          return src < dst;
+        });
+    });
+
+    run_benchmark(handle, context, "transform_reduce_e", [&]() {
+      experimental::transform_reduce_e(
+        handle,
+        graph_view,
+        row_values.begin(),
+        col_values.begin(),
+        [] __device__(vertex_t src, vertex_t dst, auto src_val, auto dst_val) {
+          return src_val + dst_val;
+        },
+        value_t{0.0});
+    });
+
+    run_benchmark(handle, context, "copy_v_transform_reduce_out_nbr", [&]() {
+      experimental::copy_v_transform_reduce_out_nbr(
+        handle,
+        graph_view,
+        row_values.begin(),
+        col_values.begin(),
+        [] __device__(vertex_t src, vertex_t dst, auto src_val, auto dst_val) { return dst_val; },
+        value_t{0.0},
+        vertex_outputs.begin());
+    });
+
+    run_benchmark(handle, context, "copy_v_transform_reduce_in_nbr", [&]() {
+      experimental::copy_v_transform_reduce_in_nbr(
+        handle,
+        graph_view,
+        row_values.begin(),
+        col_values.begin(),
+        [] __device__(vertex_t src, vertex_t dst, auto src_val, auto dst_val) { return src_val; },
+        value_t{0.0},
+        vertex_outputs.begin());
+    });
+
+    // 3. key-based edge primitives (keys are vertex IDs modulo num_pattern_bench_keys)
+
+    rmm::device_uvector<vertex_t> row_keys(
+      graph_view.get_number_of_local_adj_matrix_partition_rows(), handle.get_stream());
+    thrust::transform(policy,
+                      thrust::make_counting_iterator(vertex_t{0}),
+                      thrust::make_counting_iterator(static_cast<vertex_t>(row_keys.size())),
+                      row_keys.begin(),
+                      [] __device__(auto i) {
+                        return static_cast<vertex_t>(i % num_pattern_bench_keys);
+                      });
+
+    run_benchmark(handle, context, "transform_reduce_by_adj_matrix_row_key_e", [&]() {
+      experimental::transform_reduce_by_adj_matrix_row_key_e(
+        handle,
+        graph_view,
+        row_values.begin(),
+        col_values.begin(),
+        row_keys.begin(),
+        [] __device__(vertex_t src, vertex_t dst, auto src_val, auto dst_val) {
+          return src_val * dst_val;
+        },
+        value_t{0.0});
+    });
+
+    // the (key, value) pairs are partitioned with compute_gpu_id_from_vertex_t in multi-GPU
+    rmm::device_uvector<vertex_t> map_keys(graph_view.get_number_of_vertices(),
+                                           handle.get_stream());
+    if (multi_gpu) {
+      auto& comm           = handle.get_comms();
+      auto const comm_size = comm.get_size();
+      auto const comm_rank = comm.get_rank();
+      map_keys.resize(
+        thrust::distance(
+          map_keys.begin(),
+          thrust::copy_if(policy,
+                          thrust::make_counting_iterator(vertex_t{0}),
+                          thrust::make_counting_iterator(graph_view.get_number_of_vertices()),
+                          map_keys.begin(),
+                          [comm_size, comm_rank] __device__(auto v) {
+                            return experimental::detail::compute_gpu_id_from_vertex_t<vertex_t>{
+                                     comm_size}(v) == comm_rank;
+                          })),
+        handle.get_stream());
+    } else {
+      thrust::copy(policy,
+                   thrust::make_counting_iterator(vertex_t{0}),
+                   thrust::make_counting_iterator(graph_view.get_number_of_vertices()),
+                   map_keys.begin());
+    }
+    rmm::device_uvector<value_t> map_values(map_keys.size(), handle.get_stream());
+    thrust::fill(policy, map_values.begin(), map_values.end(), value_t{1.0});
+
+    run_benchmark(handle, context, "copy_v_transform_reduce_key_aggregated_out_nbr", [&]() {
+      experimental::copy_v_transform_reduce_key_aggregated_out_nbr(
+        handle,
+        graph_view,
+        row_values.begin(),
+        thrust::make_counting_iterator(graph_view.get_local_adj_matrix_partition_col_first(0)),
+        map_keys.begin(),
+        map_keys.end(),
+        map_values.begin(),
+        [] __device__(auto src, auto key, auto aggregated_weight, auto src_val, auto key_val) {
+          return src_val * aggregated_weight * key_val;
+        },
+        experimental::reduce_op::plus<value_t>(),
+        value_t{0.0},
+        vertex_outputs.begin());
+    });
+
+    // 4. frontier primitive (every local vertex in the frontier, no frontier update)
+
+    experimental::VertexFrontier<vertex_t, multi_gpu> vertex_frontier(
+      handle, std::vector<size_t>{static_cast<size_t>(graph_view.get_number_of_local_vertices())});
+
+    run_benchmark_with_setup(
+      handle,
+      context,
+      "update_frontier_v_push_if_out_nbr",
+      [&]() {
+        auto& bucket = vertex_frontier.get_bucket(0);
+        bucket.clear();
+        bucket.insert(thrust::make_counting_iterator(graph_view.get_local_vertex_first()),
+                      thrust::make_counting_iterator(graph_view.get_local_vertex_last()));
+      },
+      [&]() {
+        experimental::update_frontier_v_push_if_out_nbr(
+          handle,
+          graph_view,
+          vertex_frontier.get_bucket(0).begin(),
+          vertex_frontier.get_bucket(0).end(),
+          row_values.begin(),
+          col_values.begin(),
+          [] __device__(vertex_t src, vertex_t dst, auto src_val, auto dst_val) {
+            return thrust::make_tuple(src < dst, src_val);
+          },
+          experimental::reduce_op::plus<value_t>(),
+          vertex_values.begin(),
+          vertex_outputs.begin(),
+          vertex_frontier,
+          [] __device__(auto v_val, auto pushed_val) {
+            return thrust::make_tuple(
+              experimental::VertexFrontier<vertex_t, multi_gpu>::kInvalidBucketIdx,
+              v_val + pushed_val);
+          });
+      });
+  }
+
+  template <typename GraphViewType>
+  static void run_pull_benchmarks(raft::handle_t const& handle,
+                                  bench_context_t const& context,
+                                  GraphViewType const& graph_view)
+  {
+    using vertex_t = typename GraphViewType::vertex_type;
+    using value_t  = float;
+
+    auto policy = rmm::exec_policy(handle.get_stream())->on(handle.get_stream());
+
+    rmm::device_uvector<value_t> vertex_outputs(graph_view.get_number_of_local_vertices(),
+                                                handle.get_stream());
+    rmm::device_uvector<value_t> row_values(
+      graph_view.get_number_of_local_adj_matrix_partition_rows(), handle.get_stream());
+    rmm::device_uvector<value_t> col_values(
+      graph_view.get_number_of_local_adj_matrix_partition_cols(), handle.get_stream());
+    thrust::fill(policy, row_values.begin(), row_values.end(), value_t{1.0});
+    thrust::fill(policy, col_values.begin(), col_values.end(), value_t{1.0});
+
+    run_benchmark(handle, context, "copy_v_transform_reduce_in_nbr_transposed", [&]() {
+      experimental::copy_v_transform_reduce_in_nbr(
+        handle,
+        graph_view,
+        row_values.begin(),
+        col_values.begin(),
+        [] __device__(vertex_t src, vertex_t dst, auto src_val, auto dst_val) { return src_val; },
+        value_t{0.0},
+        vertex_outputs.begin());
+    });
+
+    run_benchmark(handle, context, "copy_v_transform_reduce_out_nbr_transposed", [&]() {
+      experimental::copy_v_transform_reduce_out_nbr(
+        handle,
+        graph_view,
+        row_values.begin(),
+        col_values.begin(),
+        [] __device__(vertex_t src, vertex_t dst, auto src_val, auto dst_val) { return dst_val; },
+        value_t{0.0},
+        vertex_outputs.begin());
+    });
+  }
+};
+
+}  // namespace bench
+}  // namespace cugraph
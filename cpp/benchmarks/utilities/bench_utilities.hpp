@@ -0,0 +1,397 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <experimental/graph.hpp>
+#include <utilities/error.hpp>
+#include <utilities/profiling.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/handle.hpp>
+#include <rmm/device_scalar.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// Benchmark harness shared by the SG and MG benchmark programs (cuGraph benchmarks do not depend on
+// Google Benchmark; MG runs need every rank to time the same collective-synchronized region, which
+// does not fit Google Benchmark's per-process iteration loop).
+//
+// A benchmark program sweeps the RMAT scales and the (vertex_t, edge_t) pairs given on the command
+// line, generates one RMAT graph per (scale, type pair) with the test utilities, and runs every
+// benchmark whose name contains the --filter string on it. Each benchmark is timed between two
+// device synchronization points (and barriers in MG) so the reported time covers the entire
+// asynchronous GPU work. One additional profiled run counts the edges traversed (see
+// utilities/profiling.hpp) to report GTEPS. Results are printed (by rank 0) as CSV rows.
+
+namespace cugraph {
+namespace bench {
+
+struct bench_config_t {
+  std::vector<size_t> scales{};  // vertex scales (per GPU if weak_scaling is true)
+  size_t edge_factor{16};
+  std::vector<std::string> types{};  // "int32_int32", "int32_int64", or "int64_int64"
+  std::string filter{};
+  size_t warmups{1};
+  size_t repetitions{5};
+  bool weak_scaling{false};  // relevant only in MG
+  uint64_t seed{0};
+};
+
+inline std::vector<std::string> split_option(std::string const& str)
+{
+  std::vector<std::string> ret{};
+  std::stringstream ss(str);
+  std::string item{};
+  while (std::getline(ss, item, ',')) {
+    if (!item.empty()) { ret.push_back(item); }
+  }
+  return ret;
+}
+
+/**
+ * @brief Parses the cuGraph benchmark command line options.
+ *
+ * @return std::tuple<bench_config_t, std::string> Parsed benchmark configuration and the rmm
+ * allocation mode.
+ */
+inline std::tuple<bench_config_t, std::string> parse_bench_options(int argc, char** argv)
+{
+  try {
+    cxxopts::Options options(argv[0], " - cuGraph benchmarks command line options");
+    options.add_options()(
+      "rmm_mode", "RMM allocation mode", cxxopts::value<std::string>()->default_value("pool"))(
+      "scales",
+      "Comma separated RMAT scales",
+      cxxopts::value<std::string>()->default_value("16,20"))(
+      "edge_factor", "RMAT edge factor", cxxopts::value<size_t>()->default_value("16"))(
+      "types",
+      "Comma separated (vertex_t, edge_t) pairs (int32_int32, int32_int64, int64_int64)",
+      cxxopts::value<std::string>()->default_value("int32_int32"))(
+      "filter",
+      "Run only the benchmarks whose name contains this string",
+      cxxopts::value<std::string>()->default_value(""))(
+      "warmups", "Number of untimed runs", cxxopts::value<size_t>()->default_value("1"))(
+      "repetitions", "Number of timed runs", cxxopts::value<size_t>()->default_value("5"))(
+      "weak_scaling",
+      "Interpret the scales as per GPU scales (MG only)",
+      cxxopts::value<bool>()->default_value("false"))(
+      "seed", "RMAT seed", cxxopts::value<uint64_t>()->default_value("0"));
+
+    auto result = options.parse(argc, argv);
+
+    bench_config_t config{};
+    for (auto const& scale : split_option(result["scales"].as<std::string>())) {
+      config.scales.push_back(static_cast<size_t>(std::stoul(scale)));
+    }
+    config.edge_factor  = result["edge_factor"].as<size_t>();
+    config.types        = split_option(result["types"].as<std::string>());
+    config.filter       = result["filter"].as<std::string>();
+    config.warmups      = result["warmups"].as<size_t>();
+    config.repetitions  = result["repetitions"].as<size_t>();
+    config.weak_scaling = result["weak_scaling"].as<bool>();
+    config.seed         = result["seed"].as<uint64_t>();
+    CUGRAPH_EXPECTS(config.repetitions > 0, "Invalid input argument: repetitions should be > 0.");
+
+    return std::make_tuple(config, result["rmm_mode"].as<std::string>());
+  } catch (const cxxopts::OptionException& e) {
+    CUGRAPH_FAIL("Error parsing command line options");
+  }
+}
+
+// the context a benchmark runs in: the configuration and the current graph's parameters
+struct bench_context_t {
+  bench_config_t config{};
+  std::string type_name{};
+  int num_gpus{1};
+  size_t scale{};  // aggregate (over the entire set of GPUs) vertex scale
+  size_t num_vertices{};
+  size_t num_edges{};
+};
+
+inline void synchronize(raft::handle_t const& handle)
+{
+  CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+  if (handle.comms_initialized()) { handle.get_comms().barrier(); }
+}
+
+inline bool is_root(raft::handle_t const& handle)
+{
+  return !handle.comms_initialized() || (handle.get_comms().get_rank() == 0);
+}
+
+inline void print_header(raft::handle_t const& handle)
+{
+  if (is_root(handle)) {
+    std::printf(
+      "benchmark,types,num_gpus,scale,num_vertices,num_edges,median_ms,min_ms,max_ms,"
+      "edges_traversed,gteps\n");
+    std::fflush(stdout);
+  }
+}
+
+// sum of the edges_traversed counters recorded since the last clear_profiling_report() call
+// (aggregated over the entire set of GPUs in MG)
+inline int64_t get_edges_traversed(raft::handle_t const& handle)
+{
+  auto report = experimental::get_profiling_report();
+  std::string const suffix("edges_traversed");
+  int64_t ret{0};
+  for (auto const& counter : report.counters) {
+    if ((counter.path.size() >= suffix.size()) &&
+        (counter.path.compare(counter.path.size() - suffix.size(), suffix.size(), suffix) == 0)) {
+      ret += counter.sum;
+    }
+  }
+  if (handle.comms_initialized()) {
+    rmm::device_scalar<int64_t> d_ret(ret, handle.get_stream());
+    handle.get_comms().allreduce(
+      d_ret.data(), d_ret.data(), 1, raft::comms::op_t::SUM, handle.get_stream());
+    ret = d_ret.value(handle.get_stream());
+  }
+  return ret;
+}
+
+/**
+ * @brief Time a benchmark and print its result row.
+ *
+ * @p setup is invoked (untimed) before every run of @p run. @p run is timed config.repetitions
+ * times after config.warmups untimed runs, and then invoked once more with profiling enabled to
+ * count the edges traversed (the edges_traversed counters of the patterns, this is 0 for the
+ * vertex-only primitives, so they report 0 GTEPS).
+ */
+template <typename SetupOp, typename RunOp>
+void run_benchmark_with_setup(raft::handle_t const& handle,
+                              bench_context_t const& context,
+                              std::string const& name,
+                              SetupOp setup,
+                              RunOp run)
+{
+  if (name.find(context.config.filter) == std::string::npos) { return; }
+
+  auto profiling_enabled = experimental::is_profiling_enabled();
+  experimental::set_profiling(false);
+
+  for (size_t i = 0; i < context.config.warmups; ++i) {
+    setup();
+    run();
+  }
+
+  std::vector<double> times_ms(context.config.repetitions);
+  for (size_t i = 0; i < context.config.repetitions; ++i) {
+    setup();
+    synchronize(handle);
+    auto start = std::chrono::steady_clock::now();
+    run();
+    synchronize(handle);
+    times_ms[i] =
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  setup();
+  experimental::clear_profiling_report();
+  experimental::set_profiling(true);
+  run();
+  synchronize(handle);
+  experimental::set_profiling(profiling_enabled);
+  auto edges_traversed = get_edges_traversed(handle);
+  experimental::clear_profiling_report();
+
+  std::sort(times_ms.begin(), times_ms.end());
+  auto median_ms = times_ms[times_ms.size() / 2];
+  auto gteps     = median_ms > 0.0
+                 ? static_cast<double>(edges_traversed) / (median_ms * 1e-3) / 1e9
+                 : 0.0;
+
+  if (is_root(handle)) {
+    std::printf("%s,%s,%d,%zu,%zu,%zu,%.3f,%.3f,%.3f,%lld,%.6f\n",
+                name.c_str(),
+                context.type_name.c_str(),
+                context.num_gpus,
+                context.scale,
+                context.num_vertices,
+                context.num_edges,
+                median_ms,
+                times_ms.front(),
+                times_ms.back(),
+                static_cast<long long>(edges_traversed),
+                gteps);
+    std::fflush(stdout);
+  }
+}
+
+template <typename RunOp>
+void run_benchmark(raft::handle_t const& handle,
+                   bench_context_t const& context,
+                   std::string const& name,
+                   RunOp run)
+{
+  run_benchmark_with_setup(handle, context, name, []() {}, run);
+}
+
+/**
+ * @brief Generate the RMAT graph for the given aggregate scale (Graph 500 parameters, undirected).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+experimental::graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> generate_rmat_graph(
+  raft::handle_t const& handle, bench_context_t const& context, bool weighted)
+{
+  auto comm_size = handle.comms_initialized() ? handle.get_comms().get_size() : int{1};
+  auto comm_rank = handle.comms_initialized() ? handle.get_comms().get_rank() : int{0};
+
+  std::vector<size_t> partition_ids(multi_gpu ? size_t{1} : static_cast<size_t>(comm_size));
+  std::iota(partition_ids.begin(),
+            partition_ids.end(),
+            multi_gpu ? static_cast<size_t>(comm_rank) : size_t{0});
+
+  experimental::graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> graph(handle);
+  std::tie(graph, std::ignore) =
+    cugraph::test::generate_graph_from_rmat_params<vertex_t,
+                                                   edge_t,
+                                                   weight_t,
+                                                   store_transposed,
+                                                   multi_gpu>(handle,
+                                                              context.scale,
+                                                              context.config.edge_factor,
+                                                              0.57,
+                                                              0.19,
+                                                              0.19,
+                                                              context.config.seed,
+                                                              true,
+                                                              false,
+                                                              weighted,
+                                                              multi_gpu,
+                                                              partition_ids,
+                                                              static_cast<size_t>(comm_size));
+  return graph;
+}
+
+inline size_t log2_floor(size_t n)
+{
+  size_t ret{0};
+  while ((n >> (ret + 1)) > 0) { ++ret; }
+  return ret;
+}
+
+/**
+ * @brief Sweep the configured (vertex_t, edge_t) pairs and scales and invoke
+ * run_benchmarks<vertex_t, edge_t>(handle, context) for each of them.
+ *
+ * BenchmarkSuite should provide a template <typename vertex_t, typename edge_t> static void
+ * run(raft::handle_t const&, bench_context_t&) member function (which is responsible for
+ * generating the graph and setting the context's number of vertices and edges).
+ */
+template <typename BenchmarkSuite>
+void run_benchmark_suite(raft::handle_t const& handle, bench_config_t const& config)
+{
+  print_header(handle);
+
+  auto comm_size = handle.comms_initialized() ? handle.get_comms().get_size() : int{1};
+
+  for (auto const& type_name : config.types) {
+    for (auto scale : config.scales) {
+      bench_context_t context{};
+      context.config    = config;
+      context.type_name = type_name;
+      context.num_gpus  = comm_size;
+      context.scale =
+        config.weak_scaling ? scale + log2_floor(static_cast<size_t>(comm_size)) : scale;
+
+      if (type_name == "int32_int32") {
+        BenchmarkSuite::template run<int32_t, int32_t>(handle, context);
+      } else if (type_name == "int32_int64") {
+        BenchmarkSuite::template run<int32_t, int64_t>(handle, context);
+      } else if (type_name == "int64_int64") {
+        BenchmarkSuite::template run<int64_t, int64_t>(handle, context);
+      } else {
+        CUGRAPH_FAIL("Invalid input argument: unsupported (vertex_t, edge_t) pair.");
+      }
+    }
+  }
+}
+
+}  // namespace bench
+}  // namespace cugraph
+
+/**
+ * @brief Macro that defines main function for SG benchmark programs.
+ */
+#define CUGRAPH_BENCH_PROGRAM_MAIN(BenchmarkSuite)                                  \
+  int main(int argc, char** argv)                                                   \
+  {                                                                                 \
+    cugraph::bench::bench_config_t config{};                                        \
+    std::string rmm_mode{};                                                         \
+    std::tie(config, rmm_mode) = cugraph::bench::parse_bench_options(argc, argv);   \
+    auto resource              = cugraph::test::create_memory_resource(rmm_mode);   \
+    rmm::mr::set_current_device_resource(resource.get());                           \
+    {                                                                               \
+      raft::handle_t handle{};                                                      \
+      cugraph::bench::run_benchmark_suite<BenchmarkSuite>(handle, config);          \
+    }                                                                               \
+    return 0;                                                                       \
+  }
+
+/**
+ * @brief Macro that defines main function for MG benchmark programs (one MPI rank per GPU).
+ *
+ * The GPUs are arranged in a (close to square) 2D grid for the 2D graph partitioning.
+ */
+#define CUGRAPH_MG_BENCH_PROGRAM_MAIN(BenchmarkSuite)                                     \
+  int main(int argc, char** argv)                                                         \
+  {                                                                                       \
+    MPI_TRY(MPI_Init(&argc, &argv));                                                      \
+    int comm_rank{};                                                                      \
+    int comm_size{};                                                                      \
+    MPI_TRY(MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank));                                   \
+    MPI_TRY(MPI_Comm_size(MPI_COMM_WORLD, &comm_size));                                   \
+    int num_gpus{};                                                                       \
+    CUDA_TRY(cudaGetDeviceCount(&num_gpus));                                              \
+    CUGRAPH_EXPECTS(                                                                      \
+      comm_size <= num_gpus, "# MPI ranks (%d) > # GPUs (%d).", comm_size, num_gpus);     \
+    CUDA_TRY(cudaSetDevice(comm_rank));                                                   \
+    cugraph::bench::bench_config_t config{};                                              \
+    std::string rmm_mode{};                                                               \
+    std::tie(config, rmm_mode) = cugraph::bench::parse_bench_options(argc, argv);         \
+    auto resource              = cugraph::test::create_memory_resource(rmm_mode);         \
+    rmm::mr::set_current_device_resource(resource.get());                                 \
+    {                                                                                     \
+      raft::handle_t handle{};                                                            \
+      raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);                         \
+      auto row_comm_size = static_cast<int>(std::sqrt(static_cast<double>(comm_size)));   \
+      while (comm_size % row_comm_size != 0) { --row_comm_size; }                         \
+      cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, int>  \
+        subcomm_factory(handle, row_comm_size);                                           \
+      cugraph::bench::run_benchmark_suite<BenchmarkSuite>(handle, config);                \
+    }                                                                                     \
+    MPI_TRY(MPI_Finalize());                                                              \
+    return 0;                                                                             \
+  }
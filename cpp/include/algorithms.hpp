@@ -17,6 +17,7 @@
 
 #include <dendrogram.hpp>
 #include <experimental/graph.hpp>
+#include <experimental/graph_batch.hpp>
 #include <experimental/graph_view.hpp>
 
 #include <graph.hpp>
@@ -126,6 +127,70 @@ void overlap_list(GraphCSRView<VT, ET, WT> const &graph,
                   VT const *second,
                   WT *result);
 
+/**
+ * @brief     Compute the top-K jaccard similarity candidates of every vertex
+ *
+ * For every vertex u, finds the (at most) k vertices x (x != u) with the highest Jaccard
+ * similarity coefficient among the vertices reachable from u by a two hop path (u, w, x). This
+ * is equivalent to get_two_hop_neighbors() followed by jaccard_list() and a per-vertex top-K
+ * selection, but the two hop pairs are never materialized all at once: the two hop paths are
+ * expanded in batches of (at most) max_pairs_per_batch paths (the paths of a hub vertex can span
+ * multiple batches) and only the best k candidates of each vertex are kept (in a bounded per
+ * vertex heap) across the batches. Peak memory is O(max_pairs_per_batch + k * V + E).
+ *
+ * @throws                       cugraph::logic_error when an error occurs.
+ *
+ * @tparam VT                    Type of vertex identifiers. Supported value : int (signed, 32-bit
+ * or 64-bit)
+ * @tparam ET                    Type of edge identifiers. Supported value : int (signed, 32-bit
+ * or 64-bit)
+ * @tparam WT                    Type of edge weights. Supported value : float or double.
+ *
+ * @param[in] graph              The input graph object (undirected, column indices should be
+ * sorted within each row)
+ * @param[in] weights            device pointer to input vertex weights for weighted Jaccard, may
+ * be NULL for unweighted Jaccard.
+ * @param[in] k                  The maximum number of candidates to keep per vertex.
+ * @param[in] max_pairs_per_batch    The maximum number of two hop paths to expand at once.
+ *
+ * @return                       Graph in COO format, (src, dst, edge data) = (u, x, similarity),
+ * ordered by u and similarity (descending).
+ */
+template <typename VT, typename ET, typename WT>
+std::unique_ptr<GraphCOO<VT, ET, WT>> jaccard_top_k(GraphCSRView<VT, ET, WT> const &graph,
+                                                    WT const *weights,
+                                                    VT k,
+                                                    size_t max_pairs_per_batch = size_t{1} << 26);
+
+/**
+ * @brief     Compute the top-K overlap coefficient candidates of every vertex
+ *
+ * Same as jaccard_top_k() with the overlap coefficient.
+ *
+ * @throws                       cugraph::logic_error when an error occurs.
+ *
+ * @tparam VT                    Type of vertex identifiers. Supported value : int (signed, 32-bit
+ * or 64-bit)
+ * @tparam ET                    Type of edge identifiers. Supported value : int (signed, 32-bit
+ * or 64-bit)
+ * @tparam WT                    Type of edge weights. Supported value : float or double.
+ *
+ * @param[in] graph              The input graph object (undirected, column indices should be
+ * sorted within each row)
+ * @param[in] weights            device pointer to input vertex weights for weighted overlap, may
+ * be NULL for unweighted overlap.
+ * @param[in] k                  The maximum number of candidates to keep per vertex.
+ * @param[in] max_pairs_per_batch    The maximum number of two hop paths to expand at once.
+ *
+ * @return                       Graph in COO format, (src, dst, edge data) = (u, x, similarity),
+ * ordered by u and similarity (descending).
+ */
+template <typename VT, typename ET, typename WT>
+std::unique_ptr<GraphCOO<VT, ET, WT>> overlap_top_k(GraphCSRView<VT, ET, WT> const &graph,
+                                                    WT const *weights,
+                                                    VT k,
+                                                    size_t max_pairs_per_batch = size_t{1} << 26);
+
 /**
  *
  * @brief                                       ForceAtlas2 is a continuous graph layout algorithm
@@ -196,6 +261,157 @@ void force_atlas2(GraphCOOView<vertex_t, edge_t, weight_t> &graph,
                   bool verbose                                  = false,
                   internals::GraphBasedDimRedCallback *callback = nullptr);
 
+/**
+ * @brief                                       ForceAtlas2 (Barnes Hut approximation) on a
+ * (single-GPU or multi-GPU) experimental::graph_view_t.
+ *
+ * Attraction is computed over the local edges of the (2D partitioned) graph. In multi-GPU, every
+ * GPU owns a spatial slab (a range of x coordinates balancing the number of vertices per slab) and
+ * builds a quadtree on the vertices in its slab, the vertices in the other slabs are represented by
+ * pseudo-particles (center of mass of the vertices in every grid cell of a slab) exchanged between
+ * the GPUs.
+ *
+ * @throws                                      cugraph::logic_error when an error occurs.
+ *
+ * @tparam graph_view_t                         Type of graph
+ *
+ * @param[in] handle                            Library handle (RAFT). If a communicator is set in
+ * the handle, the multi GPU version will be selected.
+ * @param[in] graph_view                        Graph view object, considered undirected.
+ * @param[out] pos                              Device array (2, number of local vertices)
+ * containing x-axis and y-axis positions of the local vertices.
+ * @param[in] max_iter                          The maximum number of iterations Force Atlas 2
+ * should run for.
+ * @param[in] x_start                           Device array containing starting x-axis positions
+ * of the local vertices (or nullptr to start from random positions).
+ * @param[in] y_start                           Device array containing starting y-axis positions
+ * of the local vertices (or nullptr to start from random positions).
+ * @param[in] outbound_attraction_distribution  Distributes attraction along outbound edges. Hubs
+ * attract less and thus are pushed to the borders.
+ * @param[in] lin_log_mode                      Switch ForceAtlas’ model from lin-lin to lin-log
+ * (tribute to Andreas Noack). Makes clusters more tight.
+ * @param[in] prevent_overlapping               Prevent nodes from overlapping.
+ * @param[in] edge_weight_influence             How much influence you give to the edges weight. 0
+ * is “no influence” and 1 is “normal”.
+ * @param[in] jitter_tolerance                  How much swinging you allow. Above 1 discouraged.
+ * Lower gives less speed and more precision.
+ * @param[in] barnes_hut_theta:                 Float between 0 and 1. Tradeoff for speed (1) vs
+ * accuracy (0).
+ * @params[in] scaling_ratio                    Float strictly positive. How much repulsion you
+ * want. More makes a more sparse graph. Switching from regular mode to LinLog mode needs a
+ * readjustment of the scaling parameter.
+ * @params[in] strong_gravity_mode              Sets a force
+ * that attracts the nodes that are distant from the center more. It is so strong that it can
+ * sometimes dominate other forces.
+ * @params[in] gravity                          Attracts nodes to the center. Prevents islands from
+ * drifting away.
+ * @params[in] verbose                          Output convergence info at each interation.
+ *
+ */
+template <typename graph_view_t>
+void force_atlas2(raft::handle_t const &handle,
+                  graph_view_t const &graph_view,
+                  float *pos,
+                  const int max_iter                    = 500,
+                  float const *x_start                  = nullptr,
+                  float const *y_start                  = nullptr,
+                  bool outbound_attraction_distribution = true,
+                  bool lin_log_mode                     = false,
+                  bool prevent_overlapping              = false,
+                  const float edge_weight_influence     = 1.0,
+                  const float jitter_tolerance          = 1.0,
+                  const float barnes_hut_theta          = 0.5,
+                  const float scaling_ratio             = 2.0,
+                  bool strong_gravity_mode              = false,
+                  const float gravity                   = 1.0,
+                  bool verbose                          = false);
+
+namespace detail {
+template <typename graph_view_t>
+class mg_barnes_hut_t;
+}  // namespace detail
+
+/**
+ * @brief Iterative ForceAtlas2 (Barnes Hut approximation) layout on a (single-GPU or multi-GPU)
+ * experimental::graph_view_t.
+ *
+ * Same algorithm as force_atlas2(handle, graph_view, ...), but the layout state (positions,
+ * previous forces, global speed, and the Barnes Hut buffers) is kept across run() calls. run(N)
+ * resumes from the state left by the previous call, so a layout can be refined in chunks of
+ * iterations (e.g. for interactive visualization) without re-allocating and re-initializing the
+ * layout. The positions are returned in device memory.
+ *
+ * A force_atlas2_layout_t object holds a reference to the handle and a copy of the graph view;
+ * the handle and the graph (and the edge weights) should outlive the object.
+ *
+ * @tparam graph_view_t                         Type of graph
+ */
+template <typename graph_view_t>
+class force_atlas2_layout_t {
+ public:
+  /**
+   * @param[in] handle                            Library handle (RAFT). If a communicator is set
+   * in the handle, the multi GPU version will be selected.
+   * @param[in] graph_view                        Graph view object, considered undirected.
+   * @param[in] x_start                           Device array containing starting x-axis
+   * positions of the local vertices (or nullptr to start from random positions).
+   * @param[in] y_start                           Device array containing starting y-axis
+   * positions of the local vertices (or nullptr to start from random positions).
+   *
+   * See force_atlas2(handle, graph_view, ...) for the remaining parameters.
+   */
+  force_atlas2_layout_t(raft::handle_t const &handle,
+                        graph_view_t const &graph_view,
+                        float const *x_start                  = nullptr,
+                        float const *y_start                  = nullptr,
+                        bool outbound_attraction_distribution = true,
+                        bool lin_log_mode                     = false,
+                        bool prevent_overlapping              = false,
+                        const float edge_weight_influence     = 1.0,
+                        const float jitter_tolerance          = 1.0,
+                        const float barnes_hut_theta          = 0.5,
+                        const float scaling_ratio             = 2.0,
+                        bool strong_gravity_mode              = false,
+                        const float gravity                   = 1.0,
+                        bool verbose                          = false);
+
+  ~force_atlas2_layout_t();
+
+  /**
+   * @brief Run more iterations, resuming from the current state.
+   *
+   * @param[in] num_iterations                    Number of iterations to run.
+   * @param[in] callback                          If not nullptr, callback->on_epoch_end() is
+   * called with positions() after every iteration.
+   */
+  void run(int num_iterations, internals::GraphBasedDimRedCallback *callback = nullptr);
+
+  /**
+   * @brief Restart the layout from the given positions (warm start).
+   *
+   * @param[in] x_start                           Device array containing x-axis positions of the
+   * local vertices (or nullptr to restart from random positions).
+   * @param[in] y_start                           Device array containing y-axis positions of the
+   * local vertices (or nullptr to restart from random positions).
+   */
+  void set_positions(float const *x_start, float const *y_start);
+
+  /**
+   * @brief Device array (2, number of local vertices) containing the current x-axis and y-axis
+   * positions of the local vertices (owned by this object, updated by run() and
+   * set_positions()).
+   */
+  float const *positions() const;
+
+  /**
+   * @brief Total number of iterations run so far.
+   */
+  int get_number_of_iterations() const;
+
+ private:
+  std::unique_ptr<detail::mg_barnes_hut_t<graph_view_t>> impl_;
+};
+
 /**
  * @brief Finds an approximate solution to the traveling salesperson problem (TSP).
  *        cuGraph computes an approximation of the TSP problem using hill climbing
@@ -203,6 +419,10 @@ void force_atlas2(GraphCOOView<vertex_t, edge_t, weight_t> &graph,
  *
  *        The current implementation does not support a weighted graph.
  *
+ *        In multi-GPU (if a communicator is set in the handle), the restarts are split across
+ *        the GPUs and every GPU returns the best route found by any GPU (every GPU should pass
+ *        identical inputs).
+ *
  * @throws                                    cugraph::logic_error when an error occurs.
  * @param[in] handle                          Library handle (RAFT). If a communicator is set in the
  * handle, the multi GPU version will be selected.
@@ -220,6 +440,10 @@ void force_atlas2(GraphCOOView<vertex_t, edge_t, weight_t> &graph,
  * @param[in] nstart                          Start from a specific position.
  * @param[in] verbose                         Logs configuration and iterative improvement.
  * @param[out] route                          Device array containing the returned route.
+ * @param[in] neighbor_list_search            Restrict 2-opt moves to the moves connecting a city
+ * to one of its k nearest neighbors. This bounds the work per hill climbing iteration to
+ * O(nodes * k) (instead of O(nodes^2)) and is recommended for instances above several thousand
+ * cities.
  *
  */
 float traveling_salesperson(raft::handle_t const &handle,
@@ -232,7 +456,8 @@ float traveling_salesperson(raft::handle_t const &handle,
                             int k,
                             int nstart,
                             bool verbose,
-                            int *route);
+                            int *route,
+                            bool neighbor_list_search = false);
 
 /**
  * @brief     Compute betweenness centrality for a graph
@@ -627,6 +852,18 @@ weight_t hungarian(raft::handle_t const &handle,
  *                                   of the communities.  Higher resolutions lead to more smaller
  *                                   communities, lower resolutions lead to fewer larger
  *                                   communities. (default 1)
+ * @param[in]  use_vertex_coloring   (optional) If true, compute a distance-1 vertex coloring
+ *                                   of each level's graph and move the vertices one color class
+ *                                   at a time (instead of moving every vertex simultaneously and
+ *                                   alternating the move direction). Supported only for
+ *                                   experimental::graph_view_t (default false)
+ * @param[in]  memory_bounded        (optional) If true, compose each level's clustering into the
+ *                                   final clustering as soon as the level completes and free the
+ *                                   level (instead of keeping every level of the dendrogram and
+ *                                   flattening it at the end), and free the per-level work buffers
+ *                                   before coarsening the graph, lowering the peak memory usage of
+ *                                   the coarsening steps. The result is identical. Supported only
+ *                                   for experimental::graph_view_t (default false)
  *
  * @return                           a pair containing:
  *                                     1) number of levels of the returned clustering
@@ -639,7 +876,9 @@ std::pair<size_t, typename graph_view_t::weight_type> louvain(
   graph_view_t const &graph_view,
   typename graph_view_t::vertex_type *clustering,
   size_t max_level                              = 100,
-  typename graph_view_t::weight_type resolution = typename graph_view_t::weight_type{1});
+  typename graph_view_t::weight_type resolution = typename graph_view_t::weight_type{1},
+  bool use_vertex_coloring                      = false,
+  bool memory_bounded                           = false);
 
 /**
  * @brief      Louvain implementation, returning dendrogram
@@ -664,6 +903,11 @@ std::pair<size_t, typename graph_view_t::weight_type> louvain(
  *                                   of the communities.  Higher resolutions lead to more smaller
  *                                   communities, lower resolutions lead to fewer larger
  *                                   communities. (default 1)
+ * @param[in]  use_vertex_coloring   (optional) If true, compute a distance-1 vertex coloring
+ *                                   of each level's graph and move the vertices one color class
+ *                                   at a time (instead of moving every vertex simultaneously and
+ *                                   alternating the move direction). Supported only for
+ *                                   experimental::graph_view_t (default false)
  *
  * @return                           a pair containing:
  *                                     1) unique pointer to dendrogram
@@ -676,7 +920,8 @@ std::pair<std::unique_ptr<Dendrogram<typename graph_view_t::vertex_type>>,
 louvain(raft::handle_t const &handle,
         graph_view_t const &graph_view,
         size_t max_level                              = 100,
-        typename graph_view_t::weight_type resolution = typename graph_view_t::weight_type{1});
+        typename graph_view_t::weight_type resolution = typename graph_view_t::weight_type{1},
+        bool use_vertex_coloring                      = false);
 
 /**
  * @brief      Flatten a Dendrogram at a particular level
@@ -743,6 +988,46 @@ std::pair<size_t, weight_t> leiden(raft::handle_t const &handle,
                                    size_t max_iter     = 100,
                                    weight_t resolution = weight_t{1});
 
+/**
+ * @brief      Leiden implementation
+ *
+ * Compute a clustering of the graph by maximizing modularity using the Leiden improvements
+ * to the Louvain method. Each level runs the Louvain local moving phase and then a refinement
+ * phase that restarts from singleton clusters and merges vertices only within the communities
+ * found by the local moving phase; the graph is coarsened by the refined clusters.
+ *
+ * Computed using the Leiden method described in:
+ *
+ *    Traag, V. A., Waltman, L., & van Eck, N. J. (2019). From Louvain to Leiden:
+ *    guaranteeing well-connected communities. Scientific reports, 9(1), 5233.
+ *    doi: 10.1038/s41598-019-41695-z
+ *
+ * @throws     cugraph::logic_error when an error occurs.
+ *
+ * @tparam     graph_view_t          Type of graph
+ *
+ * @param[in]  handle                Library handle (RAFT). If a communicator is set in the handle,
+ * @param[in]  graph_view            Input graph view object (CSR)
+ * @param[out] clustering            Pointer to device array where the clustering should be stored
+ * @param[in]  max_level             (optional) maximum number of levels to run (default 100)
+ * @param[in]  resolution            (optional) The value of the resolution parameter to use.
+ *                                   Called gamma in the modularity formula, this changes the size
+ *                                   of the communities.  Higher resolutions lead to more smaller
+ *                                   communities, lower resolutions lead to fewer larger
+ *                                   communities. (default 1)
+ *
+ * @return                           a pair containing:
+ *                                     1) number of levels of the returned clustering
+ *                                     2) modularity of the returned clustering
+ */
+template <typename graph_view_t>
+std::pair<size_t, typename graph_view_t::weight_type> leiden(
+  raft::handle_t const &handle,
+  graph_view_t const &graph_view,
+  typename graph_view_t::vertex_type *clustering,
+  size_t max_level                              = 100,
+  typename graph_view_t::weight_type resolution = typename graph_view_t::weight_type{1});
+
 /**
  * @brief Computes the ecg clustering of the given graph.
  *
@@ -775,6 +1060,36 @@ void ecg(raft::handle_t const &handle,
          vertex_t ensemble_size,
          vertex_t *clustering);
 
+/**
+ * @brief Computes the ecg clustering of the given graph.
+ *
+ * ECG runs truncated (level 1) Louvain on an ensemble of permutations of the input graph,
+ * then uses the ensemble partitions to determine weights for the input graph.
+ * The final result is found by running full Louvain on the input graph using
+ * the determined weights. See https://arxiv.org/abs/1809.05578 for further
+ * information. The co-membership counts for the entire ensemble are computed in a single pass over
+ * the edges, and the computed weights are used directly as the final Louvain input.
+ *
+ * @throws     cugraph::logic_error when an error occurs.
+ *
+ * @tparam graph_view_t Type of graph view. Must be an experimental::graph_view_t with
+ * is_adj_matrix_transposed = false (single-GPU and multi-GPU are supported).
+ *
+ * @param[in]  handle                Library handle (RAFT). If a communicator is set in the handle,
+ * the multi-GPU version will be selected.
+ * @param[in]  graph_view            Input graph view object (weighted, symmetric)
+ * @param[in]  min_weight            The minimum weight parameter
+ * @param[in]  ensemble_size         The ensemble size parameter
+ * @param[out] clustering            A device pointer to array where the partitioning should be
+ * written (size = graph_view.get_number_of_local_vertices())
+ */
+template <typename graph_view_t>
+void ecg(raft::handle_t const &handle,
+         graph_view_t const &graph_view,
+         typename graph_view_t::weight_type min_weight,
+         typename graph_view_t::vertex_type ensemble_size,
+         typename graph_view_t::vertex_type *clustering);
+
 /**
  * @brief Generate edges in a minimum spanning forest of an undirected weighted graph.
  *
@@ -984,7 +1299,8 @@ namespace gunrock {
 /**
  * @brief     Compute the HITS vertex values for a graph
  *
- * cuGraph uses the gunrock implementation of HITS
+ * This legacy API wraps experimental::hits() (it no longer calls gunrock). The CSR arrays are
+ * used without any format conversion.
  *
  * @throws                           cugraph::logic_error on an error
  *
@@ -998,10 +1314,12 @@ namespace gunrock {
  * @param[in] graph                  input graph object (CSR). Edge weights are not used
  *                                   for this algorithm.
  * @param[in] max_iter               Maximum number of iterations to run
- * @param[in] tolerance              Currently ignored.  gunrock implementation runs
- *                                   the specified number of iterations and stops
- * @param[in] starting value         Currently ignored.  gunrock does not support.
- * @param[in] normalized             Currently ignored, gunrock computes this as true
+ * @param[in] tolerance              Iterations stop early if the sum of the differences in
+ *                                   (max-normalized) authority values between two consecutive
+ *                                   iterations is less than tolerance
+ * @param[in] starting value         Currently ignored.
+ * @param[in] normalized             If true, hub and authority values are normalized to sum
+ *                                   to 1.0 before returning
  * @param[out] *hubs                 Device memory pointing to the node value based
  *                                   on outgoing links
  * @param[out] *authorities          Device memory pointing to the node value based
@@ -1049,8 +1367,89 @@ weight_t hungarian(raft::handle_t const &handle,
                    vertex_t num_columns,
                    vertex_t *assignment);
 
+/**
+ * @brief      Compute Hungarian algorithm on a batch of dense cost matrices
+ *
+ * Solves num_problems independent (square) linear assignment problems in one call.  This is
+ * intended for many small problems, where solving one problem per call is dominated by launch
+ * and allocation overhead: the problems are solved together (in as few solver invocations as the
+ * workspace bound allows) and the solver workspace is shared by all the problems.
+ *
+ * @throws     cugraph::logic_error when an error occurs.
+ *
+ * @tparam vertex_t                  Type of vertex identifiers. Supported value : int (signed,
+ * 32-bit)
+ * @tparam weight_t                  Type of edge weights. Supported values : int (signed, 32-bit),
+ * float or double.
+ *
+ * @param[in]  handle                Library handle (RAFT). If a communicator is set in the handle,
+ * @param[in]  costs                 device pointer to the cost tensor, problem i's cost matrix
+ *                                   (size x size, row major order) starts at costs + i * stride
+ * @param[in]  num_problems          number of assignment problems
+ * @param[in]  size                  number of rows (and cols) of every cost matrix
+ * @param[in]  stride                distance (in elements) between two consecutive cost matrices,
+ *                                   should be at least size * size
+ * @param[out] assignments           device pointer to an array to which the assignments will be
+ *                                   written. The array should be num_problems * size long, entry
+ *                                   (i * size + r) identifies the column assigned to row r in
+ *                                   problem i
+ * @param[out] min_costs             device pointer to an array (num_problems long) to which the
+ *                                   minimum cost of every problem will be written
+ */
+template <typename vertex_t, typename weight_t>
+void batched_hungarian(raft::handle_t const &handle,
+                       weight_t const *costs,
+                       vertex_t num_problems,
+                       vertex_t size,
+                       size_t stride,
+                       vertex_t *assignments,
+                       weight_t *min_costs);
+
 }  // namespace dense
 
+namespace sparse {
+/**
+ * @brief      Compute a minimum cost assignment on a sparse weighted bipartite graph
+ *
+ * Solves the same problem as cugraph::hungarian, but works directly on the edges of the
+ * bipartite graph instead of densifying the cost matrix (which requires O(V^2) memory for the
+ * dense variant).  This uses a parallel forward auction algorithm with epsilon scaling
+ * (D. P. Bertsekas, "The auction algorithm: A distributed relaxation method for the assignment
+ * problem", Annals of Operations Research 14 (1988)), and is intended for large, sparse problems.
+ * The number of tasks (vertices not in the worker set) can exceed the number of workers; every
+ * worker is assigned a distinct task that is connected to the worker by an edge.
+ *
+ * @throws     cugraph::logic_error when an error occurs (including when no feasible assignment
+ *             exists).
+ *
+ * @tparam vertex_t                  Type of vertex identifiers. Supported value : int (signed,
+ * 32-bit)
+ * @tparam edge_t                    Type of edge identifiers.  Supported value : int (signed,
+ * 32-bit)
+ * @tparam weight_t                  Type of edge weights. Supported values : int (signed, 32-bit),
+ * float or double.
+ *
+ * @param[in]  handle                Library handle (RAFT). If a communicator is set in the handle,
+ * @param[in]  graph                 cuGRAPH COO graph
+ * @param[in]  num_workers           number of vertices in the worker set
+ * @param[in]  workers               device pointer to an array of worker vertex ids
+ * @param[out] assignment            device pointer to an array to which the assignment will be
+ * written. The array should be num_workers long, and will identify which vertex id (job) is
+ * assigned to that worker
+ * @param[in]  epsilon               (optional) final bid increment, the returned cost is within
+ * num_workers * epsilon of the minimum cost.  If 0, 1 / (num_workers + 1) is used, which yields a
+ * minimum cost assignment for integer costs (default 0)
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+weight_t hungarian(raft::handle_t const &handle,
+                   GraphCOOView<vertex_t, edge_t, weight_t> const &graph,
+                   vertex_t num_workers,
+                   vertex_t const *workers,
+                   vertex_t *assignment,
+                   double epsilon = 0.0);
+
+}  // namespace sparse
+
 namespace experimental {
 
 /**
@@ -1074,9 +1473,10 @@ namespace experimental {
  * @param source_vertex Source vertex to start breadth-first search (root vertex of the breath-first
  * search tree).
  * @param direction_optimizing If set to true, this algorithm switches between the push based
- * breadth-first search and pull based breadth-first search depending on the size of the
- * breadth-first search frontier (currently unsupported). This option is valid only for symmetric
- * input graphs.
+ * (top-down) breadth-first search and pull based (bottom-up) breadth-first search depending on the
+ * size of the breadth-first search frontier and the number of edges from the frontier and the
+ * unvisited vertices (see S. Beamer et. al., "Direction-optimizing breadth-first search", 2012).
+ * This option is valid only for symmetric input graphs.
  * @param depth_limit Sets the maximum number of breadth-first search iterations. Any vertices
  * farther than @p depth_limit hops from @p source_vertex will be marked as unreachable.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
@@ -1091,6 +1491,48 @@ void bfs(raft::handle_t const &handle,
          vertex_t depth_limit      = std::numeric_limits<vertex_t>::max(),
          bool do_expensive_check   = false);
 
+/**
+ * @brief Run breadth-first search from multiple source vertices at once and return the vertices
+ * reached from each source (and their distances).
+ *
+ * This function traverses all the source vertices concurrently: every vertex holds a bitset (one
+ * bit per source) for the visited set and the frontier, so each edge is expanded once per
+ * breadth-first search iteration for all the sources (instead of once per each source). Sources are
+ * processed in batches if their number exceeds the internal maximum bitset width.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param sources Pointer to the source vertex array (in device memory). In multi-GPU, every GPU
+ * should provide the same source vertex array.
+ * @param num_sources Number of source vertices.
+ * @param depth_limit Sets the maximum number of breadth-first search iterations. Any vertices
+ * farther than @p depth_limit hops from a source vertex are not reached from that source.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<rmm::device_uvector<size_t>, rmm::device_uvector<vertex_t>,
+ * rmm::device_uvector<vertex_t>> Tuple of offsets (size @p num_sources + 1), reached vertices, and
+ * distances. The reached vertices (and their distances) of the i'th source are stored in
+ * [offsets[i], offsets[i + 1]) in ascending vertex ID order. In multi-GPU, only the vertices
+ * local to this GPU are returned.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>>
+multi_source_bfs(raft::handle_t const &handle,
+                 graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+                 vertex_t const *sources,
+                 size_t num_sources,
+                 vertex_t depth_limit    = std::numeric_limits<vertex_t>::max(),
+                 bool do_expensive_check = false);
+
 /**
  * @brief Run single-source shortest-path to compute the minimum distances (and predecessors) from
  * the source vertex.
@@ -1113,15 +1555,22 @@ void bfs(raft::handle_t const &handle,
  * @param cutoff Single-source shortest-path terminates if no more vertices are reachable within the
  * distance of @p cutoff. Any vertex farther than @p cutoff will be marked as unreachable.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param adaptive_delta If set to true, the delta-stepping bucket width (initially set based on the
+ * average vertex degree and the average edge weight) is re-tuned every time the near queue becomes
+ * empty based on the average near queue size since the previous re-tuning (the goal is to keep the
+ * near queue size close to the number of concurrently executable threads). This reduces the
+ * number of near-empty iterations on graphs with skewed edge weights (e.g. road networks).
+ * @return size_t Number of single-source shortest-path iterations (near queue expansions).
  */
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
-void sssp(raft::handle_t const &handle,
-          graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
-          weight_t *distances,
-          vertex_t *predecessors,
-          vertex_t source_vertex,
-          weight_t cutoff         = std::numeric_limits<weight_t>::max(),
-          bool do_expensive_check = false);
+size_t sssp(raft::handle_t const &handle,
+            graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+            weight_t *distances,
+            vertex_t *predecessors,
+            vertex_t source_vertex,
+            weight_t cutoff         = std::numeric_limits<weight_t>::max(),
+            bool do_expensive_check = false,
+            bool adaptive_delta     = false);
 
 /**
  * @brief Compute PageRank scores.
@@ -1161,6 +1610,16 @@ void sssp(raft::handle_t const &handle,
  * pageranks) is used as initial PageRank values. If false, initial PageRank values are set to 1.0
  * divided by the number of vertices in the graph.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param convergence_check_interval Number of iterations between convergence checks. Iterations
+ * run without host synchronization between checks (convergence measures are reduced in device
+ * memory), so a value larger than 1 cuts synchronization overhead (which dominates on small
+ * graphs) at the cost of up to @p convergence_check_interval - 1 additional iterations after
+ * convergence.
+ * @param reduced_precision If set to `true`, the PageRank values of the graph adjacency matrix rows
+ * are stored (and communicated in multi-GPU) in bfloat16 (accumulation stays in @p result_t) till
+ * the convergence measure gets within a constant factor of @p epsilon or stops decreasing, and
+ * the remaining iterations run in full precision. This halves (for single precision) the memory
+ * traffic to read and the communication volume to fill the row values in most iterations.
  */
 template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
 void pagerank(raft::handle_t const &handle,
@@ -1172,9 +1631,124 @@ void pagerank(raft::handle_t const &handle,
               result_t *pageranks,
               result_t alpha,
               result_t epsilon,
-              size_t max_iterations   = 500,
-              bool has_initial_guess  = false,
-              bool do_expensive_check = false);
+              size_t max_iterations             = 500,
+              bool has_initial_guess            = false,
+              bool do_expensive_check           = false,
+              size_t convergence_check_interval = 1,
+              bool reduced_precision            = false);
+
+/**
+ * @brief Compute multiple personalized PageRank scores at once.
+ *
+ * This function computes personalized PageRank scores for @p num_personalization_vectors
+ * personalization vectors in a single pass over the graph per iteration (a sparse matrix dense
+ * matrix multiplication instead of @p num_personalization_vectors sparse matrix vector
+ * multiplications). Iterations continue till every PageRank vector converges.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments or if fails to converge before @p
+ * max_iterations.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of PageRank scores.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param precomputed_vertex_out_weight_sums Pointer to an array storing sums of out-going edge
+ * weights for the vertices (for re-use) or `nullptr`. If `nullptr`, these values are freshly
+ * computed.
+ * @param num_personalization_vectors Number of personalization vectors (K).
+ * @param personalization_offsets Pointer to an array of size K + 1 storing the offsets of each
+ * personalization vector in @p personalization_vertices and @p personalization_values (the i'th
+ * personalization set is [offsets[i], offsets[i + 1])). In multi-GPU, each GPU provides the
+ * offsets for the personalization vertices it owns.
+ * @param personalization_vertices Pointer to an array storing personalization vertex identifiers.
+ * In multi-GPU, these should be local vertices.
+ * @param personalization_values Pointer to an array storing personalization values for the
+ * vertices in @p personalization_vertices.
+ * @param pageranks Pointer to the output PageRank score array of size V * K (V is the number of
+ * local vertices) in the row-major order (the PageRank score of the i'th local vertex for the j'th
+ * personalization vector is stored at pageranks[i * K + j]).
+ * @param alpha PageRank damping factor.
+ * @param epsilon Error tolerance to check convergence. Convergence is assumed if the sum of the
+ * differences in PageRank values between two consecutive iterations is less than @p epsilon for
+ * every personalization vector.
+ * @param max_iterations Maximum number of PageRank iterations.
+ * @param has_initial_guess If set to `true`, values in the PageRank output array (pointed by @p
+ * pageranks) is used as initial PageRank values. If false, initial PageRank values are set to 1.0
+ * divided by the number of vertices in the graph.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void batched_personalized_pagerank(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const &graph_view,
+  weight_t const *precomputed_vertex_out_weight_sums,
+  size_t num_personalization_vectors,
+  edge_t const *personalization_offsets,
+  vertex_t const *personalization_vertices,
+  result_t const *personalization_values,
+  result_t *pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations   = 500,
+  bool has_initial_guess  = false,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Update PageRank scores after updating the graph.
+ *
+ * This function updates general PageRank scores computed on a graph (e.g. by pagerank()) to the
+ * PageRank scores of the graph after inserting and deleting a set of edges (the set of vertices
+ * should not change). Instead of running power iterations over every vertex, this function
+ * computes the residuals of the previous scores on the updated graph (non-zero only near the
+ * updated edges) and pushes residuals only from the vertices with a residual larger than @p epsilon
+ * divided by twice the number of vertices in the graph. This is much faster than re-computing
+ * PageRank scores from scratch if the update is small.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments or if fails to converge before @p
+ * max_iterations.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of PageRank scores.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the updated graph.
+ * @param delta_srcs Pointer to an array storing the source vertex identifiers of the inserted and
+ * deleted edges.
+ * @param delta_dsts Pointer to an array storing the destination vertex identifiers of the inserted
+ * and deleted edges.
+ * @param delta_weights Pointer to an array storing the weights of the inserted edges (positive
+ * values) and the negated weights of the deleted edges (negative values). Use 1.0 and -1.0 for an
+ * unweighted graph.
+ * @param num_delta_edges Number of the inserted and deleted edges. In multi-GPU, this is the local
+ * number (delta edges can be placed in any GPU).
+ * @param pageranks Pointer to the PageRank score array. This should store the PageRank scores of
+ * the graph before the update (computed with the same @p alpha) on input and stores the updated
+ * PageRank scores on output.
+ * @param alpha PageRank damping factor.
+ * @param epsilon Error tolerance to check convergence. Convergence is assumed if the sum of the
+ * residuals (the differences between the PageRank values and the PageRank values after one
+ * more power iteration) is less than @p epsilon.
+ * @param max_iterations Maximum number of residual push iterations.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void incremental_pagerank(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t const *delta_srcs,
+  vertex_t const *delta_dsts,
+  weight_t const *delta_weights,
+  edge_t num_delta_edges,
+  result_t *pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations   = 500,
+  bool do_expensive_check = false);
 
 /**
  * @brief Compute Katz Centrality scores.
@@ -1209,6 +1783,10 @@ void pagerank(raft::handle_t const &handle,
  * @param normalize If set to `true`, final Katz Centrality scores are normalized (the L2-norm of
  * the returned Katz Centrality score array is 1.0) before returning.
  * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param convergence_check_interval Number of iterations between convergence checks. Iterations
+ * run without host synchronization between checks (see pagerank()).
+ * @param reduced_precision If set to `true`, store (and communicate in multi-GPU) the graph
+ * adjacency matrix row values in bfloat16 till close to convergence (see pagerank()).
  */
 template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
 void katz_centrality(raft::handle_t const &handle,
@@ -1218,10 +1796,67 @@ void katz_centrality(raft::handle_t const &handle,
                      result_t alpha,
                      result_t beta,
                      result_t epsilon,
-                     size_t max_iterations   = 500,
-                     bool has_initial_guess  = false,
-                     bool normalize          = false,
-                     bool do_expensive_check = false);
+                     size_t max_iterations             = 500,
+                     bool has_initial_guess            = false,
+                     bool normalize                    = false,
+                     bool do_expensive_check           = false,
+                     size_t convergence_check_interval = 1,
+                     bool reduced_precision            = false);
+
+/**
+ * @brief Compute Katz Centrality scores for multiple (alpha, beta) configurations at once.
+ *
+ * This function computes Katz Centrality scores for @p num_variants (alpha, beta) pairs in a single
+ * pass over the graph per iteration (a sparse matrix dense matrix multiplication instead of @p
+ * num_variants sparse matrix vector multiplications), so the adjacency matrix row value
+ * communication and the edge scans are shared by every variant. Iterations continue till every
+ * variant converges.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments or if fails to converge before @p
+ * max_iterations.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of Katz Centrality scores.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param num_variants Number of (alpha, beta) configurations.
+ * @param alphas Pointer to a device array of @p num_variants Katz Centrality attenuation factors.
+ * Each should be smaller than the inverse of the maximum eigenvalue of the adjacency matrix of @p
+ * graph.
+ * @param betas Pointer to a device array of @p num_variants constant values to be added to each
+ * vertex's new Katz Centrality score in every iteration (one per variant).
+ * @param katz_centralities Pointer to the output Katz Centrality score array. Scores are stored as
+ * a row-major dense block (the score of the i'th local vertex for the j'th variant is stored at
+ * @p katz_centralities[i * @p num_variants + j]), the array size should be (the number of local
+ * vertices) * @p num_variants.
+ * @param epsilon Error tolerance to check convergence. Convergence is assumed if the sum of the
+ * differences in Katz Centrality values between two consecutive iterations is less than @p
+ * epsilon for every variant.
+ * @param max_iterations Maximum number of Katz Centrality iterations.
+ * @param has_initial_guess If set to `true`, values in the Katz Centrality output array (pointed by
+ * @p katz_centralities) is used as initial Katz Centrality values. If false, zeros are used as
+ * initial Katz Centrality values.
+ * @param normalize If set to `true`, final Katz Centrality scores are normalized per variant (the
+ * L2-norm of every column of the returned Katz Centrality score block is 1.0) before returning.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void batched_katz_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const &graph_view,
+  size_t num_variants,
+  result_t const *alphas,
+  result_t const *betas,
+  result_t *katz_centralities,
+  result_t epsilon,
+  size_t max_iterations   = 500,
+  bool has_initial_guess  = false,
+  bool normalize          = false,
+  bool do_expensive_check = false);
+
 /**
  * @brief returns induced EgoNet subgraph(s) of neighbors centered at nodes in source_vertex within
  * a given radius.
@@ -1253,10 +1888,31 @@ extract_ego(raft::handle_t const &handle,
             vertex_t n_subgraphs,
             vertex_t radius);
 
+enum class random_walk_sampling_t {
+  UNIFORM = 0,  ///> next vertex picked uniformly among the out-neighbors
+  BIASED,       ///> next vertex picked with probability proportional to the out-edge weight
+  NODE2VEC      ///> second order (node2vec) sampling, biased by the return and in-out parameters
+};
+
+struct random_walk_sampling_params_t {
+  random_walk_sampling_t sampling_type{random_walk_sampling_t::UNIFORM};
+  double p{1.0};  // node2vec return parameter (1/p bias for moving back to the previous vertex)
+  double q{1.0};  // node2vec in-out parameter (1/q bias for moving away from the previous vertex)
+};
+
 /**
  * @brief returns random walks (RW) from starting sources, where each path is of given maximum
  * length. Uniform distribution is assumed for the random engine.
  *
+ * The next vertex of each path is picked uniformly (default), proportionally to the out-edge
+ * weights (random_walk_sampling_t::BIASED, requires a weighted graph), or by node2vec second order
+ * sampling (random_walk_sampling_t::NODE2VEC); node2vec moves from v to a neighbor x of v with
+ * probability proportional to w(v, x) (1 for unweighted graphs) times 1/p if x is the previous
+ * vertex in the path, times 1 if x is a neighbor of the previous vertex, and times 1/q otherwise.
+ *
+ * In multi-GPU, each GPU passes the starting vertices of its own paths (any valid vertex, not
+ * necessarily a local one) and gets back those paths; only uniform sampling is supported, yet.
+ *
  * @tparam graph_t Type of graph/view (typically, graph_view_t).
  * @tparam index_t Type used to store indexing and sizes.
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
@@ -1265,6 +1921,14 @@ extract_ego(raft::handle_t const &handle,
  * @param ptr_d_start Device pointer to set of starting vertex indices for the RW.
  * @param num_paths = number(paths).
  * @param max_depth maximum length of RWs.
+ * @param use_padding If true, paths are returned padded instead of coalesced: the walks are
+ * written directly in a num_paths x max_depth (row major) vertex array, padded with
+ * invalid_vertex_id<vertex_t>::value, and a num_paths x (max_depth - 1) weight array, padded with
+ * 0 (path sizes are still returned). This skips the compaction pass and allows consuming walks
+ * as a dense tensor; walks can be streamed by calling this function on consecutive slices of the
+ * starting vertices.
+ * @param sampling_params Sampling strategy used to pick the next vertex of each path (and the
+ * node2vec p, q parameters, should be positive).
  * @return std::tuple<device_vec_t<vertex_t>, device_vec_t<weight_t>,
  * device_vec_t<index_t>> Triplet of coalesced RW paths, with corresponding edge weights for
  * each, and corresponding path sizes. This is meant to minimize the number of DF's to be passed to
@@ -1279,6 +1943,917 @@ random_walks(raft::handle_t const &handle,
              graph_t const &graph,
              typename graph_t::vertex_type const *ptr_d_start,
              index_t num_paths,
-             index_t max_depth);
+             index_t max_depth,
+             bool use_padding                                     = false,
+             random_walk_sampling_params_t const &sampling_params = {});
+
+/**
+ * @brief Sample k-hop neighborhoods of seed vertices with a per hop fan-out (GraphSAGE style
+ * mini-batch sampling).
+ *
+ * At hop h, (at most) fan_out[h] out-edges of every frontier vertex are sampled without
+ * replacement, uniformly or proportionally to the edge weights (@p weighted); all the out-edges of
+ * a vertex are kept if its out-degree does not exceed fan_out[h] (or if fan_out[h] is negative).
+ * The first frontier is the set of (unique) seeds, and the frontier of hop h + 1 is the union of
+ * the frontier and the sampled neighbors of hop h. Samples are reproducible for a given
+ * @p rng_seed (and number of GPUs).
+ *
+ * In multi-GPU, each GPU passes the seeds of its own mini-batch (any valid vertex, not
+ * necessarily a local one) and gets back the sampled edges of its mini-batch; only the frontier
+ * neighbor lists are exchanged (not the k-hop neighborhoods).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph to sample, neighbors are out-neighbors
+ * (pass the graph with reversed edges to sample in-neighbors).
+ * @param seeds Pointer to the seed vertices.
+ * @param num_seeds Number of seed vertices.
+ * @param fan_out Number of sampled out-edges per frontier vertex of every hop (the number of hops
+ * is fan_out.size()).
+ * @param weighted Flag to sample proportionally to the edge weights (requires a weighted graph).
+ * @param rng_seed Seed of the random number generator.
+ * @return std::vector<std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>,
+ * rmm::device_uvector<weight_t>>> The sampled edges of every hop in COO (sources, destinations,
+ * and weights, 1.0 for unweighted graphs), sorted by source (so the hop blocks can be converted to
+ * CSR without sorting).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::vector<std::tuple<rmm::device_uvector<vertex_t>,
+                       rmm::device_uvector<vertex_t>,
+                       rmm::device_uvector<weight_t>>>
+neighbor_sample(raft::handle_t const &handle,
+                graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+                vertex_t const *seeds,
+                size_t num_seeds,
+                std::vector<int> const &fan_out,
+                bool weighted     = false,
+                uint64_t rng_seed = 0);
+
+/**
+ * @brief Compute the Jaccard similarity coefficients of the vertex pairs.
+ *
+ * The Jaccard coefficient of (u, v) is |N(u) & N(v)| / |N(u) | N(v)|.
+ *
+ * Neighborhoods are treated as (unweighted) sets of out-neighbors; edge weights are ignored. The
+ * coefficient is 0 if the denominator is 0. In multi-GPU, each GPU provides its own subset of the
+ * pairs (the pair vertices can be owned by any GPU) and receives the coefficients of its pairs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights and coefficients. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph.
+ * @param first Pointer to the first vertices of the pairs (size = @p num_pairs).
+ * @param second Pointer to the second vertices of the pairs (size = @p num_pairs).
+ * @param num_pairs Number of (local) vertex pairs.
+ * @param coefficients Pointer to the output coefficients (size = @p num_pairs).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void jaccard_coefficients(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t const *first,
+  vertex_t const *second,
+  size_t num_pairs,
+  weight_t *coefficients);
+
+/**
+ * @brief Compute the Jaccard similarity coefficients of the (local) edge endpoints.
+ *
+ * Equivalent to jaccard_coefficients on the local edges of @p graph_view; the output is in
+ * the order of the local adjacency matrix partitions (concatenated) and their edges.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph.
+ * @param coefficients Pointer to the output coefficients (size = the number of local edges).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void jaccard_coefficients(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  weight_t *coefficients);
+
+/**
+ * @brief Compute the Overlap similarity coefficients of the vertex pairs.
+ *
+ * The Overlap coefficient of (u, v) is |N(u) & N(v)| / min(|N(u)|, |N(v)|).
+ *
+ * Neighborhoods are treated as (unweighted) sets of out-neighbors; edge weights are ignored. The
+ * coefficient is 0 if the denominator is 0. In multi-GPU, each GPU provides its own subset of the
+ * pairs (the pair vertices can be owned by any GPU) and receives the coefficients of its pairs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights and coefficients. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph.
+ * @param first Pointer to the first vertices of the pairs (size = @p num_pairs).
+ * @param second Pointer to the second vertices of the pairs (size = @p num_pairs).
+ * @param num_pairs Number of (local) vertex pairs.
+ * @param coefficients Pointer to the output coefficients (size = @p num_pairs).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void overlap_coefficients(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t const *first,
+  vertex_t const *second,
+  size_t num_pairs,
+  weight_t *coefficients);
+
+/**
+ * @brief Compute the Overlap similarity coefficients of the (local) edge endpoints.
+ *
+ * Equivalent to overlap_coefficients on the local edges of @p graph_view; the output is in
+ * the order of the local adjacency matrix partitions (concatenated) and their edges.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph.
+ * @param coefficients Pointer to the output coefficients (size = the number of local edges).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void overlap_coefficients(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  weight_t *coefficients);
+
+/**
+ * @brief Compute the Sorensen similarity coefficients of the vertex pairs.
+ *
+ * The Sorensen coefficient of (u, v) is 2 |N(u) & N(v)| / (|N(u)| + |N(v)|).
+ *
+ * Neighborhoods are treated as (unweighted) sets of out-neighbors; edge weights are ignored. The
+ * coefficient is 0 if the denominator is 0. In multi-GPU, each GPU provides its own subset of the
+ * pairs (the pair vertices can be owned by any GPU) and receives the coefficients of its pairs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights and coefficients. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph.
+ * @param first Pointer to the first vertices of the pairs (size = @p num_pairs).
+ * @param second Pointer to the second vertices of the pairs (size = @p num_pairs).
+ * @param num_pairs Number of (local) vertex pairs.
+ * @param coefficients Pointer to the output coefficients (size = @p num_pairs).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void sorensen_coefficients(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t const *first,
+  vertex_t const *second,
+  size_t num_pairs,
+  weight_t *coefficients);
+
+/**
+ * @brief Compute the Sorensen similarity coefficients of the (local) edge endpoints.
+ *
+ * Equivalent to sorensen_coefficients on the local edges of @p graph_view; the output is in
+ * the order of the local adjacency matrix partitions (concatenated) and their edges.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph.
+ * @param coefficients Pointer to the output coefficients (size = the number of local edges).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void sorensen_coefficients(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  weight_t *coefficients);
+
+/**
+ * @brief Count the triangles in an undirected graph.
+ *
+ * Edges are oriented by degree (from the vertex with the lower (degree, vertex ID) to the vertex
+ * with the higher (degree, vertex ID)) and every triangle is counted once by intersecting the
+ * oriented neighbor lists of the endpoints of every oriented edge. Self-loops are ignored and
+ * multi-edges are counted once.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph. Should be symmetric.
+ * @param vertex_triangle_counts Pointer to the output per-vertex triangle counts (the number of
+ * triangles each vertex belongs to, size = @p graph_view.get_number_of_local_vertices()).
+ * Per-vertex counts are not computed if @p vertex_triangle_counts is `nullptr`.
+ * @return uint64_t Total number of triangles in the graph.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+uint64_t triangle_count(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  edge_t *vertex_triangle_counts = nullptr);
+
+/**
+ * @brief Compute the (exact or sampled) betweenness centrality of the vertices.
+ *
+ * Betweenness centrality is computed with Brandes's algorithm over unweighted shortest paths (edge
+ * weights are ignored) or, if @p weighted is true, weighted shortest paths. Sources are processed
+ * in batches; each batch shares a single forward sweep (to count the shortest paths) and a single
+ * backward sweep (to accumulate the dependencies) over the edges for every source in the batch.
+ * For weighted shortest paths, the distances are computed by sssp (one source at a time) and the
+ * forward sweep visits the shortest path DAG in topological order. The result is rescaled in the
+ * same way as the single-GPU betweenness_centrality (including the rescaling by the number of
+ * vertices over the number of sources if the sources are sampled).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of centrality scores. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param sources Pointer to the source vertex array (in device memory). In multi-GPU, every GPU
+ * provides its own subset of the sources (the sources of every GPU are traversed together). Every
+ * vertex is used as a source if the (total) number of sources is 0.
+ * @param num_sources Number of source vertices (in this GPU for multi-GPU).
+ * @param centralities Pointer to the output centrality scores (size = @p
+ * graph_view.get_number_of_local_vertices()).
+ * @param normalized If true, normalize the scores by the number of vertex pairs.
+ * @param endpoints If true, include the path endpoints in the shortest path counts.
+ * @param weighted If true, use weighted shortest paths (@p graph_view should be weighted with
+ * positive edge weights).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void betweenness_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t const *sources,
+  size_t num_sources,
+  result_t *centralities,
+  bool normalized         = true,
+  bool endpoints          = false,
+  bool weighted           = false,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute the (exact or sampled) betweenness centrality of the (local) edges.
+ *
+ * Edge counterpart of betweenness_centrality (sharing the same batched sweeps) following the
+ * single-GPU edge_betweenness_centrality; the output is in the order of the local adjacency matrix
+ * partitions (concatenated) and their edges.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of centrality scores. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param sources Pointer to the source vertex array (in device memory). In multi-GPU, every GPU
+ * provides its own subset of the sources (the sources of every GPU are traversed together). Every
+ * vertex is used as a source if the (total) number of sources is 0.
+ * @param num_sources Number of source vertices (in this GPU for multi-GPU).
+ * @param centralities Pointer to the output centrality scores (size = the number of local edges).
+ * @param normalized If true, normalize the scores by the number of vertex pairs.
+ * @param weighted If true, use weighted shortest paths (@p graph_view should be weighted with
+ * positive edge weights).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void edge_betweenness_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t const *sources,
+  size_t num_sources,
+  result_t *centralities,
+  bool normalized         = true,
+  bool weighted           = false,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Approximate the betweenness centrality of the vertices by adaptive source sampling.
+ *
+ * Sources are sampled uniformly at random (with replacement) and traversed in batches by the same
+ * batched sweeps as betweenness_centrality; the samples are added in rounds (each round doubling
+ * the number of samples) till the empirical Bernstein bound on the estimation error of every vertex
+ * falls below @p epsilon (or the number of samples reaches the worst-case bound from Hoeffding's
+ * inequality, O(log(n / @p delta) / @p epsilon^2)). With probability at least 1 - @p delta, every
+ * normalized score is within @p epsilon of the exact normalized score (the unnormalized scores are
+ * within @p epsilon times the normalization factor). The exact scores are computed if the
+ * worst-case number of samples exceeds the number of vertices.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of centrality scores. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param centralities Pointer to the output centrality scores (size = @p
+ * graph_view.get_number_of_local_vertices()).
+ * @param epsilon Additive error bound on the normalized scores.
+ * @param delta Probability that the error bound is violated (should be in (0, 1)).
+ * @param seed Seed for the source sampling (every GPU should use the same seed in multi-GPU).
+ * @param normalized If true, normalize the scores by the number of vertex pairs.
+ * @param endpoints If true, include the path endpoints in the shortest path counts.
+ * @param weighted If true, use weighted shortest paths (@p graph_view should be weighted with
+ * positive edge weights).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return size_t Number of sources traversed.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+size_t approximate_betweenness_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  result_t *centralities,
+  double epsilon,
+  double delta,
+  uint64_t seed,
+  bool normalized         = true,
+  bool endpoints          = false,
+  bool weighted           = false,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute the (exact or sampled) closeness centrality of the vertices.
+ *
+ * The closeness of a vertex is the number of the other vertices reaching the vertex over the sum of
+ * their (unweighted) shortest path distances to the vertex (so the distances are measured toward
+ * the vertex in directed graphs). The distances are found by the batched forward sweeps of
+ * betweenness_centrality. If the sources are sampled, the sums over the sources estimate the sums
+ * over every vertex (Eppstein & Wang).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of centrality scores. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param sources Pointer to the source vertex array (in device memory). In multi-GPU, every GPU
+ * provides its own subset of the sources. Every vertex is used as a source if the (total) number of
+ * sources is 0.
+ * @param num_sources Number of source vertices (in this GPU for multi-GPU).
+ * @param centralities Pointer to the output centrality scores (size = @p
+ * graph_view.get_number_of_local_vertices()).
+ * @param wf_improved If true, scale the scores by the fraction of the other vertices reaching the
+ * vertex (Wasserman & Faust, for graphs that are not strongly connected).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void closeness_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t const *sources,
+  size_t num_sources,
+  result_t *centralities,
+  bool wf_improved = true);
+
+/**
+ * @brief Approximate the closeness centrality of the vertices by source sampling.
+ *
+ * Samples O(log(n / @p delta) / @p epsilon^2) sources uniformly at random (with replacement) so
+ * that, with probability at least 1 - @p delta, the estimated average distance to every vertex is
+ * within @p epsilon times the diameter of the exact average distance (Eppstein & Wang). The exact
+ * scores are computed if the number of samples exceeds the number of vertices.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of centrality scores. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param centralities Pointer to the output centrality scores (size = @p
+ * graph_view.get_number_of_local_vertices()).
+ * @param epsilon Additive error bound on the average distances (relative to the diameter).
+ * @param delta Probability that the error bound is violated (should be in (0, 1)).
+ * @param seed Seed for the source sampling (every GPU should use the same seed in multi-GPU).
+ * @param wf_improved If true, scale the scores by the (estimated) fraction of the other vertices
+ * reaching the vertex (Wasserman & Faust).
+ * @return size_t Number of sources traversed.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+size_t approximate_closeness_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  result_t *centralities,
+  double epsilon,
+  double delta,
+  uint64_t seed,
+  bool wf_improved = true);
+
+/**
+ * @brief Compute the weakly connected components of a symmetric graph.
+ *
+ * Components are found by hooking (linking the roots of the trees of the two endpoints of an edge,
+ * the larger root points to the smaller one) and compression (pointer jumping). Following
+ * Afforest, a few neighbor sampling rounds first link every vertex with a small number of its
+ * neighbors, and the final rounds over every edge skip the vertices in the largest intermediate
+ * component (estimated by sampling vertex labels). Every vertex is labeled with the smallest
+ * vertex ID in its component.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object (should be symmetric).
+ * @param components Pointer to the output component labels (size = @p
+ * graph_view.get_number_of_local_vertices()).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void weakly_connected_components(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t *components,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute the strongly connected components of a directed graph.
+ *
+ * Trivial components are removed by trimming (trim-1 removes the vertices without an incoming or
+ * outgoing edge, trim-2 removes the pairs of vertices whose only incoming (or outgoing) neighbors
+ * are each other), and the remaining vertices are split by forward-backward sweeps: the vertices
+ * reached from and reaching the pivot of a color class form the component of the pivot, and the
+ * rest of the class is split into three classes (reached only forward, reached only backward, and
+ * not reached). Every color class is swept at once, and the first sweep uses bfs. Every vertex is
+ * labeled with the smallest vertex ID in its component.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object.
+ * @param components Pointer to the output component labels (size = @p
+ * graph_view.get_number_of_local_vertices()).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void strongly_connected_components(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t *components,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute a minimum spanning forest of an undirected weighted graph.
+ *
+ * The forest is built with Boruvka's algorithm: in every round, every supervertex (a tree of the
+ * forest built so far) picks its smallest outgoing edge, and the supervertices connected by the
+ * picked edges are contracted. Edges are ordered by (weight, smaller end point, larger end point),
+ * so equal weights are handled without creating cycles. Supervertices are contracted by relabeling
+ * (every vertex carries the ID of the root of its supervertex, edges within a supervertex are
+ * skipped), so the multi-GPU graph is never rebuilt. If the graph is connected, this returns a
+ * minimum spanning tree.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object (should be symmetric and weighted).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>,
+ * rmm::device_uvector<weight_t>> Triplet of the forest edge sources, destinations, and weights.
+ * Every forest edge appears once (with source < destination); in multi-GPU, the edges are
+ * distributed over the processes.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+minimum_spanning_forest(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Objective of spectral clustering.
+ *
+ * balanced_cut uses the smallest eigenvectors of the graph Laplacian, and modularity uses the
+ * largest eigenvectors of the modularity matrix.
+ */
+enum class spectral_objective_t { modularity, balanced_cut };
+
+/**
+ * @brief Compute the spectral embedding of an undirected graph.
+ *
+ * The eigenvectors are computed by block subspace iteration with Rayleigh-Ritz projection on a
+ * shifted operator (a single pass over the edges multiplies the entire block). The embedding can
+ * be computed once and then passed to cluster_spectral_embedding for several numbers of clusters,
+ * and the eigenvectors of a previous call can be passed back in as the initial guess (e.g. after
+ * small graph updates or to refine with a tighter tolerance).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object (should be symmetric).
+ * @param objective Spectral clustering objective (selects the operator).
+ * @param n_eig_vects Number of eigenvectors to compute.
+ * @param eig_vals Pointer to the output eigenvalues (size = @p n_eig_vects, the smallest Laplacian
+ * eigenvalues in the ascending order for balanced_cut and the largest modularity matrix
+ * eigenvalues in the descending order for modularity).
+ * @param eig_vects Pointer to the output eigenvectors (column-major, size = @p
+ * graph_view.get_number_of_local_vertices() * @p n_eig_vects, each process stores the rows of its
+ * local vertices). This is also the input initial guess if @p has_initial_guess is `true`.
+ * @param evs_tolerance Eigenvector residual tolerance (relative to the operator norm bound).
+ * @param evs_max_iter Maximum number of subspace iterations.
+ * @param has_initial_guess If set to `true`, @p eig_vects is used as the initial guess.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void compute_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  spectral_objective_t objective,
+  size_t n_eig_vects,
+  weight_t *eig_vals,
+  weight_t *eig_vects,
+  weight_t evs_tolerance  = 1e-3,
+  size_t evs_max_iter     = 500,
+  bool has_initial_guess  = false,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Cluster the vertices of a graph using its spectral embedding.
+ *
+ * The leading min(@p n_clusters, @p n_eig_vects) eigenvectors (from compute_spectral_embedding)
+ * are whitened, and the resulting points are clustered by k-means (k-means++ initialization and
+ * Lloyd iterations).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object (the graph used to compute @p eig_vects).
+ * @param eig_vects Pointer to the eigenvectors (column-major, size = @p
+ * graph_view.get_number_of_local_vertices() * @p n_eig_vects).
+ * @param n_eig_vects Number of eigenvectors in @p eig_vects.
+ * @param n_clusters Number of clusters.
+ * @param clustering Pointer to the output cluster IDs (size = @p
+ * graph_view.get_number_of_local_vertices()).
+ * @param kmean_tolerance k-means relative inertia change tolerance.
+ * @param kmean_max_iter Maximum number of k-means iterations.
+ * @param seed Random number generator seed for the k-means initialization.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void cluster_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  weight_t const *eig_vects,
+  size_t n_eig_vects,
+  vertex_t n_clusters,
+  vertex_t *clustering,
+  weight_t kmean_tolerance = 1e-4,
+  size_t kmean_max_iter    = 100,
+  uint64_t seed            = 0);
+
+/**
+ * @brief Compute the core number of every vertex in an undirected graph.
+ *
+ * The k-core of a graph is the maximal subgraph in which every vertex has degree at least k, and
+ * the core number of a vertex is the largest k for which the vertex belongs to the k-core. Core
+ * numbers are computed by peeling: the vertices with remaining degree at most k are removed
+ * level by level (in bulk, one vertex frontier per peeling step), and removing a vertex decrements
+ * the remaining degrees of its neighbors. Levels without any vertex to peel are skipped.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object, the graph should be symmetric and should not have
+ * self-loops (edge weights are ignored, multi-edges are counted as many times as they appear).
+ * @param core_numbers Pointer to the output core numbers (size = @p
+ * graph_view.get_number_of_local_vertices()).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void core_number(raft::handle_t const &handle,
+                 graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+                 edge_t *core_numbers,
+                 bool do_expensive_check = false);
+
+/**
+ * @brief Extract the k-core of an undirected graph.
+ *
+ * The k-core edges are the local edges of @p graph_view with both end points having a core
+ * number of at least @p k. The returned edge list keeps the partitioning of @p graph_view (in
+ * multi-GPU, every edge stays in the process holding the edge in @p graph_view), so it can be
+ * passed to the graph_t constructor without shuffling.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object, we extract the k-core from @p graph_view.
+ * @param k Order of the core. This value should be non-negative.
+ * @param core_numbers Pointer to the core numbers (size = @p
+ * graph_view.get_number_of_local_vertices()), as computed by core_number().
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>,
+ * rmm::device_uvector<weight_t>> Triplet of the k-core edge sources, destinations, and weights
+ * (size 0 if @p graph_view is unweighted).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+k_core(raft::handle_t const &handle,
+       graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+       edge_t k,
+       edge_t const *core_numbers,
+       bool do_expensive_check = false);
+
+/**
+ * @brief Compute the truss number of every edge in an undirected graph.
+ *
+ * The k-truss of a graph is the maximal subgraph in which every edge is included in at least
+ * k - 2 triangles, and the truss number of an edge is the largest k for which the edge belongs to
+ * the k-truss. Edge supports (the number of triangles including each edge) are computed once by
+ * intersecting (sorted) neighbor lists, and the edges are peeled level by level; peeling an edge
+ * decrements only the supports of the edges sharing a triangle with the peeled edge. Truss numbers
+ * for every k are computed in a single run. Self-loops and multi-edges are ignored. Edge
+ * weights are ignored. Merge-based intersections need sorted neighbor lists: single-GPU graphs
+ * constructed with graph_properties_t::has_sorted_neighbor_lists (and not multigraphs) are used
+ * as is, and other graphs are sorted to a copy.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object, the graph should be symmetric.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>,
+ * rmm::device_uvector<edge_t>> Triplet of edge sources, destinations, and truss numbers. Every
+ * undirected edge appears once (with source < destination) in the process owning the source (in
+ * multi-GPU).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<edge_t>>
+truss_decomposition(raft::handle_t const &handle,
+                    graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+                    bool do_expensive_check = false);
+
+/**
+ * @brief Extract the k-truss of an undirected graph.
+ *
+ * This peels the edges as truss_decomposition() does but stops before level @p k (the edges left
+ * form the k-truss).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object, the graph should be symmetric.
+ * @param k Order of the truss. This value should be at least 2.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> Pair of the
+ * k-truss edge sources and destinations (both directions of every undirected edge, in multi-GPU,
+ * the edges are in the process owning the smaller end point and should be shuffled before
+ * constructing a graph).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> k_truss(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  edge_t k,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute HITS hub and authority scores.
+ *
+ * This function computes HITS (Hyperlink-Induced Topic Search) hub and authority scores. Every
+ * iteration computes authority values from hub values with one pass over the incoming edges,
+ * computes hub values from the authority values with one pass over the outgoing edges, and
+ * normalizes both by their maximum values. Iterations stop if the sum of the differences in hub
+ * values between two consecutive iterations is less than @p epsilon or after @p max_iterations
+ * iterations (this function does not throw if HITS fails to converge, check the returned values).
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of hub and authority scores.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object. Edge weights are not used.
+ * @param hubs Pointer to the output hub score array (size = the number of local vertices).
+ * @param authorities Pointer to the output authority score array (size = the number of local
+ * vertices).
+ * @param epsilon Error tolerance to check convergence.
+ * @param max_iterations Maximum number of HITS iterations.
+ * @param has_initial_hubs_guess If set to `true`, values in the hub score array (pointed by @p
+ * hubs) is used as initial hub values. If false, 1.0 / the number of vertices is used as initial
+ * hub values.
+ * @param normalize If set to `true`, final hub and authority scores are normalized (the L1-norms of
+ * the returned hub and authority score arrays are 1.0) before returning.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @param convergence_check_interval Number of iterations between convergence checks. Iterations
+ * run without host synchronization between checks (see pagerank()).
+ * @param reduced_precision If set to `true`, store (and communicate in multi-GPU) the graph
+ * adjacency matrix row hub values and column authority values in bfloat16 till close to
+ * convergence (see pagerank()).
+ * @return std::tuple<result_t, size_t> Tuple of the sum of the hub value differences in the last
+ * checked iteration and the number of iterations.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::tuple<result_t, size_t> hits(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const &graph_view,
+  result_t *hubs,
+  result_t *authorities,
+  result_t epsilon,
+  size_t max_iterations             = 500,
+  bool has_initial_hubs_guess       = false,
+  bool normalize                    = false,
+  bool do_expensive_check           = false,
+  size_t convergence_check_interval = 1,
+  bool reduced_precision            = false);
+
+/**
+ * @brief Compute the weakly connected components of every graph in a graph batch.
+ *
+ * Components of every graph are computed at once by running weakly_connected_components() on the
+ * block-diagonal graph of the batch. Every vertex is labeled with the smallest (graph local)
+ * vertex ID in its component.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_batch Graph batch object (every graph should be symmetric).
+ * @param components Pointer to the output component labels (size = the number of vertices of the
+ * block-diagonal graph, the i'th graph's labels are [graph_batch.vertex_offsets()[i],
+ * graph_batch.vertex_offsets()[i + 1])).
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+void batched_weakly_connected_components(
+  raft::handle_t const &handle,
+  graph_batch_t<vertex_t, edge_t, weight_t, false> const &graph_batch,
+  vertex_t *components,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Compute the PageRank scores of every graph in a graph batch.
+ *
+ * Every iteration runs over the block-diagonal graph of the batch at once, but the dangling sums,
+ * the teleport probabilities, and the convergence measures are computed per graph (the scores of
+ * each graph sum to 1.0 and coincide with the scores pagerank() returns on the graph). Iterations
+ * continue till every graph converges.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments or if fails to converge before @p
+ * max_iterations.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam result_t Type of PageRank scores.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_batch Graph batch object.
+ * @param pageranks Pointer to the output PageRank score array (size = the number of vertices of
+ * the block-diagonal graph).
+ * @param alpha PageRank damping factor.
+ * @param epsilon Error tolerance to check convergence. A graph converges if the sum of the
+ * differences in its PageRank values between two consecutive iterations is less than @p epsilon.
+ * @param max_iterations Maximum number of PageRank iterations.
+ * @param has_initial_guess If set to `true`, values in the PageRank output array (pointed by @p
+ * pageranks) is used as initial PageRank values (after normalizing the values of every graph to
+ * sum to 1.0). If false, initial PageRank values are set to 1.0 divided by the number of vertices
+ * in each graph.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+void batched_pagerank(raft::handle_t const &handle,
+                      graph_batch_t<vertex_t, edge_t, weight_t, true> const &graph_batch,
+                      result_t *pageranks,
+                      result_t alpha,
+                      result_t epsilon,
+                      size_t max_iterations   = 500,
+                      bool has_initial_guess  = false,
+                      bool do_expensive_check = false);
+
+/**
+ * @brief Compute a Louvain clustering of every graph in a graph batch.
+ *
+ * Louvain runs once on a copy of the block-diagonal graph of the batch with the edge weights of
+ * every graph divided by the graph's total edge weight (and the resolution multiplied by the
+ * number of graphs with edges). The delta modularity of every move is then proportional to the
+ * delta modularity of the move in its own graph, so vertices move as in per-graph Louvain
+ * runs, and the modularity maximized is the mean of the per-graph modularities. Clusters never
+ * span graphs. Every vertex is labeled with the smallest (graph local) vertex ID in its cluster.
+ *
+ * @throws cugraph::logic_error on erroneous input arguments.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_batch Graph batch object (every graph should be symmetric, edge weights are 1.0 if
+ * the graphs are unweighted).
+ * @param clustering Pointer to the output cluster labels (size = the number of vertices of the
+ * block-diagonal graph).
+ * @param modularities Pointer to the output per-graph modularities (size = the number of graphs,
+ * 0.0 for graphs without edges).
+ * @param max_level Maximum number of Louvain levels.
+ * @param resolution Resolution parameter (gamma in the modularity formula) of every graph.
+ * @return size_t Number of levels of the returned clustering.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+size_t batched_louvain(raft::handle_t const &handle,
+                       graph_batch_t<vertex_t, edge_t, weight_t, false> const &graph_batch,
+                       vertex_t *clustering,
+                       weight_t *modularities,
+                       size_t max_level    = 100,
+                       weight_t resolution = weight_t{1});
+
 }  // namespace experimental
 }  // namespace cugraph
@@ -34,6 +34,13 @@ class Dendrogram {
     level_first_index_.push_back(first_index);
   }
 
+  // remove (and free) the current level
+  void pop_level()
+  {
+    level_ptr_.pop_back();
+    level_first_index_.pop_back();
+  }
+
   size_t current_level() const { return level_ptr_.size() - 1; }
 
   size_t num_levels() const { return level_ptr_.size(); }
@@ -15,21 +15,33 @@
  */
 #pragma once
 
+#include <experimental/graph.hpp>
 #include <experimental/graph_view.hpp>
 #include <partition_manager.hpp>
 #include <utilities/dataframe_buffer.cuh>
 #include <utilities/device_comm.cuh>
+#include <utilities/shuffle_comm.cuh>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <raft/handle.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/sort.h>
 #include <thrust/tabulate.h>
 #include <thrust/transform.h>
+#include <thrust/tuple.h>
 #include <cuco/detail/hash_functions.cuh>
 
 #include <algorithm>
+#include <tuple>
 #include <numeric>
 #include <vector>
 
@@ -39,10 +51,15 @@ namespace detail {
 
 // compute the numbers of nonzeros in rows (of the graph adjacency matrix, if store_transposed =
 // false) or columns (of the graph adjacency matrix, if store_transposed = true)
+// (size 0 adj_matrix_partition_dcs_nzd_vertices, adj_matrix_partition_dcs_nzd_vertex_counts, and
+// adj_matrix_partition_major_hypersparse_firsts if DCSR (or DCSC) is not used)
 template <typename vertex_t, typename edge_t>
 rmm::device_uvector<edge_t> compute_major_degrees(
   raft::handle_t const &handle,
   std::vector<edge_t const *> const &adj_matrix_partition_offsets,
+  std::vector<vertex_t const *> const &adj_matrix_partition_dcs_nzd_vertices,
+  std::vector<vertex_t> const &adj_matrix_partition_dcs_nzd_vertex_counts,
+  std::vector<vertex_t> const &adj_matrix_partition_major_hypersparse_firsts,
   partition_t<vertex_t> const &partition)
 {
   auto &row_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
@@ -69,11 +86,32 @@ rmm::device_uvector<edge_t> compute_major_degrees(
     vertex_t major_last{};
     std::tie(major_first, major_last) = partition.get_vertex_partition_range(vertex_partition_idx);
     auto p_offsets                    = adj_matrix_partition_offsets[i];
+    auto major_hypersparse_first      = adj_matrix_partition_major_hypersparse_firsts.size() > 0
+                                     ? adj_matrix_partition_major_hypersparse_firsts[i]
+                                     : major_last;
     thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
                       thrust::make_counting_iterator(vertex_t{0}),
-                      thrust::make_counting_iterator(major_last - major_first),
+                      thrust::make_counting_iterator(major_hypersparse_first - major_first),
                       local_degrees.data(),
                       [p_offsets] __device__(auto i) { return p_offsets[i + 1] - p_offsets[i]; });
+    if (major_hypersparse_first < major_last) {
+      thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   local_degrees.data() + (major_hypersparse_first - major_first),
+                   local_degrees.data() + (major_last - major_first),
+                   edge_t{0});
+      auto p_dcs_nzd_vertices = adj_matrix_partition_dcs_nzd_vertices[i];
+      auto p_local_degrees    = local_degrees.data();
+      auto dcs_offset         = major_hypersparse_first - major_first;
+      thrust::for_each(
+        rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+        thrust::make_counting_iterator(vertex_t{0}),
+        thrust::make_counting_iterator(adj_matrix_partition_dcs_nzd_vertex_counts[i]),
+        [p_offsets, p_dcs_nzd_vertices, p_local_degrees, major_first, dcs_offset] __device__(
+          auto i) {
+          p_local_degrees[p_dcs_nzd_vertices[i] - major_first] =
+            p_offsets[dcs_offset + i + 1] - p_offsets[dcs_offset + i];
+        });
+    }
     col_comm.reduce(local_degrees.data(),
                     i == col_comm_rank ? degrees.data() : static_cast<edge_t *>(nullptr),
                     static_cast<size_t>(major_last - major_first),
@@ -99,7 +137,12 @@ rmm::device_uvector<edge_t> compute_major_degrees(
                  adj_matrix_partition_offsets.end(),
                  tmp_offsets.begin(),
                  [](auto const &offsets) { return offsets.data(); });
-  return compute_major_degrees(handle, tmp_offsets, partition);
+  return compute_major_degrees(handle,
+                               tmp_offsets,
+                               std::vector<vertex_t const *>{},
+                               std::vector<vertex_t>{},
+                               std::vector<vertex_t>{},
+                               partition);
 }
 
 // compute the numbers of nonzeros in rows (of the graph adjacency matrix, if store_transposed =
@@ -117,6 +160,46 @@ rmm::device_uvector<edge_t> compute_major_degrees(raft::handle_t const &handle,
   return degrees;
 }
 
+// major offset of each edge in a compressed sparse (CSR or CSC) matrix
+template <typename vertex_t, typename edge_t>
+rmm::device_uvector<vertex_t> compute_edge_major_offsets(rmm::device_uvector<edge_t> const &offsets,
+                                                         edge_t number_of_edges,
+                                                         cudaStream_t stream)
+{
+  rmm::device_uvector<vertex_t> major_offsets(number_of_edges, stream);
+  thrust::upper_bound(rmm::exec_policy(stream)->on(stream),
+                      offsets.begin() + 1,
+                      offsets.end(),
+                      thrust::make_counting_iterator(edge_t{0}),
+                      thrust::make_counting_iterator(number_of_edges),
+                      major_offsets.begin());
+  return major_offsets;
+}
+
+// sort each neighbor list (in ascending order of minors, edge weights are permuted accordingly)
+template <typename vertex_t, typename edge_t, typename weight_t>
+void sort_neighbor_lists(rmm::device_uvector<edge_t> const &offsets,
+                         rmm::device_uvector<vertex_t> &indices,
+                         rmm::device_uvector<weight_t> &weights,
+                         bool is_weighted,
+                         cudaStream_t stream)
+{
+  // FIXME: a segmented sort can avoid materializing the major offsets (this requires an extra
+  // sizeof(vertex_t) bytes per edge)
+  auto major_offsets =
+    compute_edge_major_offsets<vertex_t>(offsets, static_cast<edge_t>(indices.size()), stream);
+  auto edge_first =
+    thrust::make_zip_iterator(thrust::make_tuple(major_offsets.begin(), indices.begin()));
+  if (is_weighted) {
+    thrust::sort_by_key(rmm::exec_policy(stream)->on(stream),
+                        edge_first,
+                        edge_first + indices.size(),
+                        weights.begin());
+  } else {
+    thrust::sort(rmm::exec_policy(stream)->on(stream), edge_first, edge_first + indices.size());
+  }
+}
+
 template <typename vertex_t, typename edge_t>
 struct degree_from_offsets_t {
   edge_t const *offsets{nullptr};
@@ -124,12 +207,95 @@ struct degree_from_offsets_t {
   __device__ edge_t operator()(vertex_t v) { return offsets[v + 1] - offsets[v]; }
 };
 
+// construct a graph_t object from per (local) matrix partition compressed sparse (CSR or CSC)
+// arrays (the vectors should have a single element in single-GPU)
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::enable_if_t<multi_gpu, graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>>
+graph_from_compressed_sparse(raft::handle_t const &handle,
+                             std::vector<rmm::device_uvector<edge_t>> &&offsets,
+                             std::vector<rmm::device_uvector<vertex_t>> &&indices,
+                             std::vector<rmm::device_uvector<weight_t>> &&weights,
+                             partition_t<vertex_t> const &partition,
+                             vertex_t number_of_vertices,
+                             edge_t number_of_edges,
+                             graph_properties_t properties,
+                             bool sorted_by_degree,
+                             bool do_expensive_check)
+{
+  return graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(handle,
+                                                                          std::move(offsets),
+                                                                          std::move(indices),
+                                                                          std::move(weights),
+                                                                          partition,
+                                                                          number_of_vertices,
+                                                                          number_of_edges,
+                                                                          properties,
+                                                                          sorted_by_degree,
+                                                                          do_expensive_check);
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::enable_if_t<!multi_gpu, graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>>
+graph_from_compressed_sparse(raft::handle_t const &handle,
+                             std::vector<rmm::device_uvector<edge_t>> &&offsets,
+                             std::vector<rmm::device_uvector<vertex_t>> &&indices,
+                             std::vector<rmm::device_uvector<weight_t>> &&weights,
+                             partition_t<vertex_t> const &partition,
+                             vertex_t number_of_vertices,
+                             edge_t number_of_edges,
+                             graph_properties_t properties,
+                             bool sorted_by_degree,
+                             bool do_expensive_check)
+{
+  return graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+    handle,
+    std::move(offsets[0]),
+    std::move(indices[0]),
+    weights.size() > 0 ? std::move(weights[0])
+                       : rmm::device_uvector<weight_t>(0, handle.get_stream()),
+    number_of_vertices,
+    properties,
+    sorted_by_degree,
+    do_expensive_check);
+}
+
+// GPU ID assigned to a hub vertex (see compute_edge_balanced_hub_gpu_ids) or -1 if v is not in the
+// (sorted) hub vertex list
+template <typename vertex_t>
+__device__ int find_hub_gpu_id(vertex_t const *hub_vertices,
+                               int const *hub_gpu_ids,
+                               vertex_t num_hubs,
+                               vertex_t v)
+{
+  auto it = thrust::lower_bound(thrust::seq, hub_vertices, hub_vertices + num_hubs, v);
+  return ((it != hub_vertices + num_hubs) && (*it == v))
+           ? hub_gpu_ids[thrust::distance(hub_vertices, it)]
+           : -1;
+}
+
+// maps (external) vertex IDs to the owning GPUs, vertices are hashed to GPUs except for the
+// optional hub vertices (which are assigned to GPUs to balance the edge counts)
 template <typename vertex_t>
 struct compute_gpu_id_from_vertex_t {
   int comm_size{0};
+  vertex_t const *hub_vertices{nullptr};
+  int const *hub_gpu_ids{nullptr};
+  vertex_t num_hubs{0};
 
   __device__ int operator()(vertex_t v) const
   {
+    if (num_hubs > 0) {
+      auto gpu_id = find_hub_gpu_id(hub_vertices, hub_gpu_ids, num_hubs, v);
+      if (gpu_id >= 0) { return gpu_id; }
+    }
     cuco::detail::MurmurHash3_32<vertex_t> hash_func{};
     return hash_func(v) % comm_size;
   }
@@ -140,12 +306,16 @@ struct compute_gpu_id_from_edge_t {
   int comm_size{0};
   int row_comm_size{0};
   int col_comm_size{0};
+  vertex_t const *hub_vertices{nullptr};
+  int const *hub_gpu_ids{nullptr};
+  vertex_t num_hubs{0};
 
   __device__ int operator()(vertex_t major, vertex_t minor) const
   {
-    cuco::detail::MurmurHash3_32<vertex_t> hash_func{};
-    auto major_comm_rank = static_cast<int>(hash_func(major) % comm_size);
-    auto minor_comm_rank = static_cast<int>(hash_func(minor) % comm_size);
+    compute_gpu_id_from_vertex_t<vertex_t> vertex_func{
+      comm_size, hub_vertices, hub_gpu_ids, num_hubs};
+    auto major_comm_rank = vertex_func(major);
+    auto minor_comm_rank = vertex_func(minor);
     return (minor_comm_rank / row_comm_size) * row_comm_size + (major_comm_rank % row_comm_size);
   }
 };
@@ -155,16 +325,142 @@ struct compute_partition_id_from_edge_t {
   int comm_size{0};
   int row_comm_size{0};
   int col_comm_size{0};
+  vertex_t const *hub_vertices{nullptr};
+  int const *hub_gpu_ids{nullptr};
+  vertex_t num_hubs{0};
 
   __device__ int operator()(vertex_t major, vertex_t minor) const
   {
-    cuco::detail::MurmurHash3_32<vertex_t> hash_func{};
-    auto major_comm_rank = static_cast<int>(hash_func(major) % comm_size);
-    auto minor_comm_rank = static_cast<int>(hash_func(minor) % comm_size);
+    compute_gpu_id_from_vertex_t<vertex_t> vertex_func{
+      comm_size, hub_vertices, hub_gpu_ids, num_hubs};
+    auto major_comm_rank = vertex_func(major);
+    auto minor_comm_rank = vertex_func(minor);
     return major_comm_rank * col_comm_size + minor_comm_rank / row_comm_size;
   }
 };
 
+// index of the (local) matrix partition (or the vertex partition) a vertex belongs to
+template <typename vertex_t>
+__device__ size_t find_partition_idx(vertex_t const *lasts, size_t num_partitions, vertex_t v)
+{
+  return static_cast<size_t>(
+    thrust::distance(lasts, thrust::upper_bound(thrust::seq, lasts, lasts + num_partitions, v)));
+}
+
+// maps (renumbered) vertex IDs to the GPUs owning the vertices
+template <typename vertex_t>
+struct vertex_to_gpu_id_t {
+  vertex_t const *vertex_partition_lasts{nullptr};
+  int comm_size{0};
+
+  __device__ int operator()(vertex_t v) const
+  {
+    return static_cast<int>(
+      find_partition_idx(vertex_partition_lasts, static_cast<size_t>(comm_size), v));
+  }
+};
+
+// GPU owning an edge (major, minor) of renumbered vertex IDs under 2D partitioning (the major
+// belongs to a matrix partition of the GPU's row_comm_rank and the minor belongs to the minor range
+// of the GPU's col_comm_rank)
+template <typename vertex_t>
+struct compute_gpu_id_from_renumbered_edge_t {
+  vertex_t const *vertex_partition_lasts{nullptr};
+  int comm_size{0};
+  int row_comm_size{0};
+
+  __device__ int operator()(vertex_t major, vertex_t minor) const
+  {
+    auto major_partition_id = static_cast<int>(
+      find_partition_idx(vertex_partition_lasts, static_cast<size_t>(comm_size), major));
+    auto minor_partition_id = static_cast<int>(
+      find_partition_idx(vertex_partition_lasts, static_cast<size_t>(comm_size), minor));
+    return (minor_partition_id / row_comm_size) * row_comm_size +
+           (major_partition_id % row_comm_size);
+  }
+};
+
+template <typename vertex_t>
+struct is_invalid_edge_t {
+  vertex_t number_of_vertices{0};
+
+  __device__ bool operator()(thrust::tuple<vertex_t, vertex_t> e) const
+  {
+    return !is_valid_vertex(number_of_vertices, thrust::get<0>(e)) ||
+           !is_valid_vertex(number_of_vertices, thrust::get<1>(e));
+  }
+};
+
+// copy a chunk (in (major, minor) order) and shuffle the copy to the GPUs owning the edges (edge
+// weights are shuffled only if weights is not nullptr)
+template <typename vertex_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+shuffle_chunk_to_edge_owners(raft::handle_t const &handle,
+                             vertex_t const *majors,
+                             vertex_t const *minors,
+                             weight_t const *weights /* nullptr if unweighted */,
+                             size_t number_of_edges,
+                             vertex_t const *vertex_partition_lasts)
+{
+  auto &comm               = handle.get_comms();
+  auto const comm_size     = comm.get_size();
+  auto &row_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+  auto const row_comm_size = row_comm.get_size();
+
+  rmm::device_uvector<vertex_t> tx_majors(number_of_edges, handle.get_stream());
+  rmm::device_uvector<vertex_t> tx_minors(number_of_edges, handle.get_stream());
+  rmm::device_uvector<weight_t> tx_weights(weights != nullptr ? number_of_edges : size_t{0},
+                                           handle.get_stream());
+  thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               majors,
+               majors + number_of_edges,
+               tx_majors.begin());
+  thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               minors,
+               minors + number_of_edges,
+               tx_minors.begin());
+
+  auto key_func = compute_gpu_id_from_renumbered_edge_t<vertex_t>{
+    vertex_partition_lasts, comm_size, row_comm_size};
+
+  rmm::device_uvector<vertex_t> rx_majors(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> rx_minors(0, handle.get_stream());
+  rmm::device_uvector<weight_t> rx_weights(0, handle.get_stream());
+  if (weights != nullptr) {
+    thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 weights,
+                 weights + number_of_edges,
+                 tx_weights.begin());
+    auto edge_first = thrust::make_zip_iterator(
+      thrust::make_tuple(tx_majors.begin(), tx_minors.begin(), tx_weights.begin()));
+    std::forward_as_tuple(std::tie(rx_majors, rx_minors, rx_weights), std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        edge_first,
+        edge_first + number_of_edges,
+        [key_func] __device__(auto val) {
+          return key_func(thrust::get<0>(val), thrust::get<1>(val));
+        },
+        handle.get_stream());
+  } else {
+    auto edge_first =
+      thrust::make_zip_iterator(thrust::make_tuple(tx_majors.begin(), tx_minors.begin()));
+    std::forward_as_tuple(std::tie(rx_majors, rx_minors), std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        edge_first,
+        edge_first + number_of_edges,
+        [key_func] __device__(auto val) {
+          return key_func(thrust::get<0>(val), thrust::get<1>(val));
+        },
+        handle.get_stream());
+  }
+
+  return std::make_tuple(std::move(rx_majors), std::move(rx_minors), std::move(rx_weights));
+}
+
 }  // namespace detail
 }  // namespace experimental
 }  // namespace cugraph
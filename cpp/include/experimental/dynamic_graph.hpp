@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+
+/**
+ * @brief Owning graph class supporting batched edge insertions and deletions.
+ *
+ * graph_t is immutable once constructed. dynamic_graph_t wraps a graph_t object (the compact
+ * storage) and a delta holding the updates since the last compaction. Deleted edges of the compact
+ * storage are marked in a per-edge bitmask (and are masked out in view(), see
+ * graph_view_t::with_edge_mask()), inserted edges are buffered (and become visible after the next
+ * compaction). snapshot() establishes a consistent compressed sparse view at a snapshot point
+ * (compacting if there are pending insertions or if the fraction of the deleted edges exceeds
+ * the compaction threshold) so existing algorithms run unmodified on the updated graph.
+ *
+ * The set of vertices does not change (vertex IDs should be already renumbered, and edges to be
+ * inserted should not introduce new vertices). The graph properties (e.g. is_symmetric) of the
+ * wrapped graph are kept, so the updates should preserve them (e.g. insert and delete edges in
+ * both directions for a symmetric graph). Compaction does not keep vertex IDs sorted by degree, so
+ * the compact storage after the first compaction is not partitioned into degree-based segments.
+ *
+ * In multi-GPU, insert_edges(), delete_edges(), compact(), and snapshot() are collective
+ * operations (every GPU should call them the same number of times, batch sizes can differ across
+ * GPUs and can be 0), and the edges of every batch are shuffled to the GPUs owning the edges.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to store the transposed adjacency matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+class dynamic_graph_t {
+ public:
+  using vertex_type                              = vertex_t;
+  using edge_type                                = edge_t;
+  using weight_type                              = weight_t;
+  static constexpr bool is_adj_matrix_transposed = store_transposed;
+  static constexpr bool is_multi_gpu             = multi_gpu;
+
+  /**
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms. This object should outlive the
+   * dynamic graph.
+   * @param graph Graph object to start from (moved to the dynamic graph).
+   * @param compaction_threshold snapshot() compacts if the fraction of the deleted edges (out of
+   * the edges in the compact storage) exceeds this value.
+   */
+  dynamic_graph_t(raft::handle_t const &handle,
+                  graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> &&graph,
+                  double compaction_threshold = 0.1);
+
+  /**
+   * @brief Insert a batch of edges (visible after the next compaction).
+   *
+   * @param edgelist Edges to insert (edge weights should be provided if the graph is weighted).
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  void insert_edges(edgelist_t<vertex_t, edge_t, weight_t> const &edgelist,
+                    bool do_expensive_check = false);
+
+  /**
+   * @brief Delete a batch of edges.
+   *
+   * Edges in the compact storage are masked out (one of the parallel edges for a multigraph) and
+   * matching edges pending insertion are dropped. Edges that do not exist are ignored.
+   *
+   * @param edgelist Edges to delete (edge weights are ignored).
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  void delete_edges(edgelist_t<vertex_t, edge_t, weight_t> const &edgelist,
+                    bool do_expensive_check = false);
+
+  /**
+   * @brief Merge the pending insertions and deletions to the compact storage.
+   *
+   * This rebuilds the compressed sparse arrays (peak memory usage is close to the size of the
+   * compact storage plus the size of the updated graph), so the updates should be batched.
+   *
+   * @param do_expensive_check A flag to run expensive checks (if set to `true`).
+   */
+  void compact(bool do_expensive_check = false);
+
+  /**
+   * @brief Get a graph view of the graph with every update applied.
+   *
+   * @param do_expensive_check A flag to run expensive checks (if set to `true`).
+   * @return Graph view of the updated graph (valid until the next update).
+   */
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> snapshot(
+    bool do_expensive_check = false);
+
+  // returns a view of the compact storage with the deleted edges masked out (edges pending
+  // insertion are not included)
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> view() const;
+
+  // number of the edges pending insertion (assigned to this process in multi-GPU)
+  edge_t get_number_of_local_pending_insertions() const
+  {
+    return static_cast<edge_t>(pending_majors_.size());
+  }
+
+  // number of the deleted (and masked out) edges of the compact storage (assigned to this process
+  // in multi-GPU)
+  edge_t get_number_of_local_deleted_edges() const { return number_of_local_deleted_edges_; }
+
+ private:
+  raft::handle_t const *handle_ptr_{nullptr};
+  graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> graph_;
+  double compaction_threshold_{0.1};
+
+  // device copy of the vertex partition lasts (relevant only if multi_gpu is true)
+  rmm::device_uvector<vertex_t> d_vertex_partition_lasts_;
+
+  // deletion masks of the compact storage (one bit per edge of every local adjacency matrix
+  // partition, 0 for deleted edges), size 0 if no edge of the compact storage is deleted
+  std::vector<rmm::device_uvector<uint32_t>> deletion_masks_{};
+  edge_t number_of_local_deleted_edges_{0};
+
+  // edges pending insertion (in (major, minor) order, stored in the GPUs owning the edges)
+  rmm::device_uvector<vertex_t> pending_majors_;
+  rmm::device_uvector<vertex_t> pending_minors_;
+  rmm::device_uvector<weight_t> pending_weights_;  // size 0 if unweighted
+};
+
+}  // namespace experimental
+}  // namespace cugraph
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <experimental/edge_property.cuh>
+#include <experimental/graph_view.hpp>
+#include <matrix_partition_device.cuh>
+#include <utilities/error.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform_reduce.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+
+namespace detail {
+
+template <typename edge_t>
+edge_t get_edge_mask_size(edge_t number_of_edges)
+{
+  return (number_of_edges + edge_t{31}) / edge_t{32};
+}
+
+// ANDs the mask word with the bits of the edges (in the word) satisfying pred(values[i])
+template <typename edge_t, typename T, typename EdgePredicate>
+struct mask_edges_by_edge_property_t {
+  T const* values{nullptr};
+  edge_t number_of_edges{0};
+  EdgePredicate pred;
+  uint32_t* edge_mask{nullptr};
+
+  __device__ void operator()(edge_t word_idx) const
+  {
+    auto first = word_idx * edge_t{32};
+    auto last  = thrust::minimum<edge_t>{}(first + edge_t{32}, number_of_edges);
+    uint32_t bits{0};
+    for (auto i = first; i < last; ++i) {
+      if (pred(values[i])) { bits |= uint32_t{1} << (i - first); }
+    }
+    edge_mask[word_idx] &= bits;
+  }
+};
+
+// clears the bits of the edges of a major whose major or minor is masked out
+template <typename GraphViewType,
+          typename AdjMatrixRowMaskInputIterator,
+          typename AdjMatrixColMaskInputIterator>
+struct mask_edges_by_adj_matrix_row_col_mask_t {
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  matrix_partition_device_t<GraphViewType> matrix_partition;
+  AdjMatrixRowMaskInputIterator adj_matrix_row_mask_input_first;
+  AdjMatrixColMaskInputIterator adj_matrix_col_mask_input_first;
+  uint32_t* edge_mask{nullptr};
+
+  __device__ void operator()(vertex_t major_offset) const
+  {
+    minor_index_iterator_t<vertex_t, edge_t> indices{};
+    weight_t const* weights{nullptr};
+    edge_t local_degree{};
+    thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(major_offset);
+    auto edge_offset_first                      = *(indices.base());
+    bool major_mask = GraphViewType::is_adj_matrix_transposed
+                        ? *(adj_matrix_col_mask_input_first + major_offset)
+                        : *(adj_matrix_row_mask_input_first + major_offset);
+    for (edge_t i = 0; i < local_degree; ++i) {
+      auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(indices[i]);
+      bool minor_mask   = GraphViewType::is_adj_matrix_transposed
+                          ? *(adj_matrix_row_mask_input_first + minor_offset)
+                          : *(adj_matrix_col_mask_input_first + minor_offset);
+      if (!major_mask || !minor_mask) {
+        auto edge_offset = edge_offset_first + i;
+        // neighbor lists of different majors may share a mask word
+        atomicAnd(edge_mask + edge_offset / 32, ~(uint32_t{1} << (edge_offset % 32)));
+      }
+    }
+  }
+};
+
+template <typename edge_t>
+struct count_active_edges_t {
+  uint32_t const* edge_mask{nullptr};
+  edge_t number_of_edges{0};
+
+  __device__ edge_t operator()(edge_t word_idx) const
+  {
+    auto word  = edge_mask[word_idx];
+    auto first = word_idx * edge_t{32};
+    if (number_of_edges - first < edge_t{32}) {
+      word &= (uint32_t{1} << (number_of_edges - first)) - uint32_t{1};
+    }
+    return static_cast<edge_t>(__popc(word));
+  }
+};
+
+}  // namespace detail
+
+// Owning storage of a per-edge bitmask (one bit per edge, in the compressed sparse order of every
+// local adjacency matrix partition) of a graph. An edge_mask_t object is created with every edge
+// active and is refined with the mask_edges_by_*() functions below; the masked graph view is
+// obtained with graph_view.with_edge_mask(edge_mask.get_masks()), so algorithms built on the
+// pattern accelerators can run on an edge (or vertex) subset without constructing a new graph.
+template <typename GraphViewType>
+class edge_mask_t {
+ public:
+  using edge_type = typename GraphViewType::edge_type;
+
+  edge_mask_t(raft::handle_t const& handle, GraphViewType const& graph_view)
+  {
+    buffers_.reserve(graph_view.get_number_of_local_adj_matrix_partitions());
+    for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      buffers_.emplace_back(
+        detail::get_edge_mask_size(graph_view.get_number_of_local_adj_matrix_partition_edges(i)),
+        handle.get_stream());
+      thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   buffers_.back().begin(),
+                   buffers_.back().end(),
+                   ~uint32_t{0});
+    }
+  }
+
+  size_t get_number_of_local_adj_matrix_partitions() const { return buffers_.size(); }
+
+  uint32_t* mutable_mask(size_t adj_matrix_partition_idx)
+  {
+    return buffers_[adj_matrix_partition_idx].data();
+  }
+
+  uint32_t const* mask(size_t adj_matrix_partition_idx) const
+  {
+    return buffers_[adj_matrix_partition_idx].data();
+  }
+
+  // to be passed to graph_view_t::with_edge_mask()
+  std::vector<uint32_t const*> get_masks() const
+  {
+    std::vector<uint32_t const*> masks(buffers_.size());
+    for (size_t i = 0; i < buffers_.size(); ++i) { masks[i] = buffers_[i].data(); }
+    return masks;
+  }
+
+  // set every edge active
+  void clear(raft::handle_t const& handle)
+  {
+    for (auto& buffer : buffers_) {
+      thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   buffer.begin(),
+                   buffer.end(),
+                   ~uint32_t{0});
+    }
+  }
+
+ private:
+  std::vector<rmm::device_uvector<uint32_t>> buffers_{};
+};
+
+/**
+ * @brief Mask out the edges whose property values do not satisfy the given predicate.
+ *
+ * Edges already masked out stay masked out, so successive calls intersect the conditions (e.g.
+ * a time window is two calls on a timestamp property).
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam T Type of the edge property values.
+ * @tparam EdgePredicate Type of the unary predicate on edge property values.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object (without an edge mask).
+ * @param edge_value_input Non-owning view of the edge property (created for @p graph_view).
+ * @param pred Unary device predicate taking an edge property value and returning true if the edge
+ * should stay active.
+ * @param edge_mask Edge mask object (created for @p graph_view) to update.
+ */
+template <typename GraphViewType, typename T, typename EdgePredicate>
+void mask_edges_by_edge_property(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  edge_property_view_t<typename GraphViewType::edge_type, T> const& edge_value_input,
+  EdgePredicate pred,
+  edge_mask_t<GraphViewType>& edge_mask)
+{
+  using edge_t = typename GraphViewType::edge_type;
+
+  CUGRAPH_EXPECTS((edge_value_input.get_number_of_local_adj_matrix_partitions() ==
+                   graph_view.get_number_of_local_adj_matrix_partitions()) &&
+                    (edge_mask.get_number_of_local_adj_matrix_partitions() ==
+                     graph_view.get_number_of_local_adj_matrix_partitions()),
+                  "Invalid input argument: edge_value_input and edge_mask should be created for "
+                  "graph_view.");
+
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    auto number_of_edges = graph_view.get_number_of_local_adj_matrix_partition_edges(i);
+    thrust::for_each(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(edge_t{0}),
+      thrust::make_counting_iterator(detail::get_edge_mask_size(number_of_edges)),
+      detail::mask_edges_by_edge_property_t<edge_t, T, EdgePredicate>{
+        edge_value_input.value_first(i), number_of_edges, pred, edge_mask.mutable_mask(i)});
+  }
+}
+
+/**
+ * @brief Mask out the edges incident to masked out vertices.
+ *
+ * Vertex masks are passed as adjacency matrix row & column values (e.g. copy a per-vertex bool
+ * mask with copy_to_adj_matrix_row() and copy_to_adj_matrix_col()), an edge stays active only if
+ * both its source and destination are active.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam AdjMatrixRowMaskInputIterator Type of the iterator for graph adjacency matrix row
+ * masks (convertible to bool).
+ * @tparam AdjMatrixColMaskInputIterator Type of the iterator for graph adjacency matrix column
+ * masks (convertible to bool).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object (without an edge mask).
+ * @param adj_matrix_row_mask_input_first Iterator pointing to the adjacency matrix row masks for
+ * the first (inclusive) row (assigned to this process in multi-GPU).
+ * @param adj_matrix_col_mask_input_first Iterator pointing to the adjacency matrix column masks
+ * for the first (inclusive) column (assigned to this process in multi-GPU).
+ * @param edge_mask Edge mask object (created for @p graph_view) to update.
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowMaskInputIterator,
+          typename AdjMatrixColMaskInputIterator>
+void mask_edges_by_adj_matrix_row_col_mask(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  AdjMatrixRowMaskInputIterator adj_matrix_row_mask_input_first,
+  AdjMatrixColMaskInputIterator adj_matrix_col_mask_input_first,
+  edge_mask_t<GraphViewType>& edge_mask)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  CUGRAPH_EXPECTS(edge_mask.get_number_of_local_adj_matrix_partitions() ==
+                    graph_view.get_number_of_local_adj_matrix_partitions(),
+                  "Invalid input argument: edge_mask should be created for graph_view.");
+
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    matrix_partition_device_t<GraphViewType> matrix_partition(graph_view, i);
+
+    auto row_mask_input_offset = GraphViewType::is_adj_matrix_transposed
+                                   ? vertex_t{0}
+                                   : matrix_partition.get_major_value_start_offset();
+    auto col_mask_input_offset = GraphViewType::is_adj_matrix_transposed
+                                   ? matrix_partition.get_major_value_start_offset()
+                                   : vertex_t{0};
+    thrust::for_each(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(vertex_t{0}),
+      thrust::make_counting_iterator(matrix_partition.get_major_size()),
+      detail::mask_edges_by_adj_matrix_row_col_mask_t<GraphViewType,
+                                                      AdjMatrixRowMaskInputIterator,
+                                                      AdjMatrixColMaskInputIterator>{
+        matrix_partition,
+        adj_matrix_row_mask_input_first + row_mask_input_offset,
+        adj_matrix_col_mask_input_first + col_mask_input_offset,
+        edge_mask.mutable_mask(i)});
+  }
+}
+
+/**
+ * @brief Count the active (not masked out) local edges.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param edge_mask Edge mask object (created for @p graph_view).
+ * @return GraphViewType::edge_type Number of the active edges (assigned to this process in
+ * multi-GPU).
+ */
+template <typename GraphViewType>
+typename GraphViewType::edge_type count_local_active_edges(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  edge_mask_t<GraphViewType> const& edge_mask)
+{
+  using edge_t = typename GraphViewType::edge_type;
+
+  edge_t count{0};
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    auto number_of_edges = graph_view.get_number_of_local_adj_matrix_partition_edges(i);
+    count += thrust::transform_reduce(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(edge_t{0}),
+      thrust::make_counting_iterator(detail::get_edge_mask_size(number_of_edges)),
+      detail::count_active_edges_t<edge_t>{edge_mask.mask(i), number_of_edges},
+      edge_t{0},
+      thrust::plus<edge_t>());
+  }
+  return count;
+}
+
+}  // namespace experimental
+}  // namespace cugraph
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <experimental/graph_view.hpp>
+#include <matrix_partition_device.cuh>
+#include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+
+// Non-owning view of a typed per-edge property. Values are stored per local adjacency matrix
+// partition in the same order as the partition's indices (and weights), so the value of the edge
+// at edge offset j of partition i is value_first(i)[j].
+template <typename edge_t, typename T>
+class edge_property_view_t {
+ public:
+  using edge_type  = edge_t;
+  using value_type = T;
+
+  edge_property_view_t() = default;
+
+  edge_property_view_t(std::vector<T const*> const& adj_matrix_partition_value_firsts,
+                       std::vector<edge_t> const& adj_matrix_partition_edge_counts)
+    : adj_matrix_partition_value_firsts_(adj_matrix_partition_value_firsts),
+      adj_matrix_partition_edge_counts_(adj_matrix_partition_edge_counts)
+  {
+    CUGRAPH_EXPECTS(
+      adj_matrix_partition_value_firsts.size() == adj_matrix_partition_edge_counts.size(),
+      "Invalid input argument: the value and edge count vector sizes should coincide.");
+  }
+
+  size_t get_number_of_local_adj_matrix_partitions() const
+  {
+    return adj_matrix_partition_value_firsts_.size();
+  }
+
+  edge_t get_number_of_local_adj_matrix_partition_edges(size_t adj_matrix_partition_idx) const
+  {
+    return adj_matrix_partition_edge_counts_[adj_matrix_partition_idx];
+  }
+
+  T const* value_first(size_t adj_matrix_partition_idx) const
+  {
+    return adj_matrix_partition_value_firsts_[adj_matrix_partition_idx];
+  }
+
+ private:
+  std::vector<T const*> adj_matrix_partition_value_firsts_{};
+  std::vector<edge_t> adj_matrix_partition_edge_counts_{};
+};
+
+// Owning storage of a typed per-edge property (e.g. timestamps or edge types) aligned with the
+// compressed sparse storage of a graph. An edge_property_t object is valid for the graph (view)
+// it is created for and any graph view sharing the graph's edges (e.g. with_weights() views).
+template <typename GraphViewType, typename T>
+class edge_property_t {
+ public:
+  static_assert(std::is_arithmetic<T>::value, "edge property values should be arithmetic.");
+
+  using edge_type  = typename GraphViewType::edge_type;
+  using value_type = T;
+
+  edge_property_t(raft::handle_t const& handle, GraphViewType const& graph_view)
+  {
+    buffers_.reserve(graph_view.get_number_of_local_adj_matrix_partitions());
+    for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      buffers_.emplace_back(graph_view.get_number_of_local_adj_matrix_partition_edges(i),
+                            handle.get_stream());
+    }
+  }
+
+  edge_property_t(raft::handle_t const& handle, GraphViewType const& graph_view, T init)
+    : edge_property_t(handle, graph_view)
+  {
+    for (auto& buffer : buffers_) {
+      thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   buffer.begin(),
+                   buffer.end(),
+                   init);
+    }
+  }
+
+  size_t get_number_of_local_adj_matrix_partitions() const { return buffers_.size(); }
+
+  T* mutable_value_first(size_t adj_matrix_partition_idx)
+  {
+    return buffers_[adj_matrix_partition_idx].data();
+  }
+
+  T const* value_first(size_t adj_matrix_partition_idx) const
+  {
+    return buffers_[adj_matrix_partition_idx].data();
+  }
+
+  edge_property_view_t<edge_type, T> view() const
+  {
+    std::vector<T const*> value_firsts(buffers_.size());
+    std::vector<edge_type> edge_counts(buffers_.size());
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+      value_firsts[i] = buffers_[i].data();
+      edge_counts[i]  = static_cast<edge_type>(buffers_[i].size());
+    }
+    return edge_property_view_t<edge_type, T>(value_firsts, edge_counts);
+  }
+
+ private:
+  std::vector<rmm::device_uvector<T>> buffers_{};
+};
+
+namespace detail {
+
+// returns the edge value input iterator for the given local adjacency matrix partition
+template <typename edge_t, typename T>
+struct edge_property_value_input_first_t {
+  edge_property_view_t<edge_t, T> view{};
+
+  T const* operator()(size_t adj_matrix_partition_idx) const
+  {
+    return view.value_first(adj_matrix_partition_idx);
+  }
+};
+
+// returns the edge offset (within the matrix partition) of the (row, col) edge or
+// std::numeric_limits<edge_t>::max() if the edge does not belong to the matrix partition
+template <typename GraphViewType>
+struct find_edge_offset_t {
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  matrix_partition_device_t<GraphViewType> matrix_partition;
+  vertex_t const* rows{nullptr};
+  vertex_t const* cols{nullptr};
+  bool sorted_neighbor_lists{false};
+
+  __device__ edge_t operator()(edge_t i) const
+  {
+    auto invalid = std::numeric_limits<edge_t>::max();
+    auto major   = GraphViewType::is_adj_matrix_transposed ? cols[i] : rows[i];
+    auto minor   = GraphViewType::is_adj_matrix_transposed ? rows[i] : cols[i];
+    if ((major < matrix_partition.get_major_first()) ||
+        (major >= matrix_partition.get_major_last()) ||
+        (minor < matrix_partition.get_minor_first()) ||
+        (minor >= matrix_partition.get_minor_last())) {
+      return invalid;
+    }
+
+    minor_index_iterator_t<vertex_t, edge_t> indices{};
+    typename GraphViewType::weight_type const* weights{nullptr};
+    edge_t local_degree{};
+    thrust::tie(indices, weights, local_degree) =
+      matrix_partition.get_local_edges(matrix_partition.get_major_offset_from_major_nocheck(major));
+    edge_t pos{local_degree};
+    if (sorted_neighbor_lists) {
+      pos = static_cast<edge_t>(thrust::distance(
+        indices, thrust::lower_bound(thrust::seq, indices, indices + local_degree, minor)));
+      if ((pos < local_degree) && (indices[pos] != minor)) { pos = local_degree; }
+    } else {
+      for (edge_t j = 0; j < local_degree; ++j) {
+        if (indices[j] == minor) {
+          pos = j;
+          break;
+        }
+      }
+    }
+    return pos < local_degree ? *(indices.base()) + pos : invalid;
+  }
+};
+
+template <typename GraphViewType, typename T>
+struct scatter_edge_property_value_t {
+  using edge_t = typename GraphViewType::edge_type;
+
+  find_edge_offset_t<GraphViewType> find_edge_offset;
+  T const* values{nullptr};
+  T* output{nullptr};
+
+  __device__ void operator()(edge_t i) const
+  {
+    auto edge_offset = find_edge_offset(i);
+    if (edge_offset != std::numeric_limits<edge_t>::max()) { output[edge_offset] = values[i]; }
+  }
+};
+
+template <typename GraphViewType>
+struct is_local_edge_t {
+  using edge_t = typename GraphViewType::edge_type;
+
+  find_edge_offset_t<GraphViewType> find_edge_offset;
+
+  __device__ bool operator()(edge_t i) const
+  {
+    return find_edge_offset(i) != std::numeric_limits<edge_t>::max();
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Set edge property values from a (row, column, value) edge list.
+ *
+ * This function is useful to align per-edge arrays of the edge list a graph was constructed from
+ * with the graph's compressed sparse storage. Edges not appearing in the edge list keep their
+ * previous values. If the graph has multi-edges, one of the parallel edges (unspecified) gets the
+ * value (and the others keep their previous values).
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam T Type of the edge property values.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param edgelist_rows Pointer to the edge list rows (the edges assigned to this process in
+ * multi-GPU, as for graph construction).
+ * @param edgelist_cols Pointer to the edge list columns.
+ * @param edgelist_values Pointer to the edge list property values.
+ * @param num_edgelist_edges Number of edges in the edge list.
+ * @param edge_property Edge property object (created for @p graph_view) to update.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`,
+ * this function throws if an edge list edge does not exist in @p graph_view).
+ */
+template <typename GraphViewType, typename T>
+void fill_edge_property_from_edgelist(raft::handle_t const& handle,
+                                      GraphViewType const& graph_view,
+                                      typename GraphViewType::vertex_type const* edgelist_rows,
+                                      typename GraphViewType::vertex_type const* edgelist_cols,
+                                      T const* edgelist_values,
+                                      typename GraphViewType::edge_type num_edgelist_edges,
+                                      edge_property_t<GraphViewType, T>& edge_property,
+                                      bool do_expensive_check = false)
+{
+  using edge_t = typename GraphViewType::edge_type;
+
+  CUGRAPH_EXPECTS(edge_property.get_number_of_local_adj_matrix_partitions() ==
+                    graph_view.get_number_of_local_adj_matrix_partitions(),
+                  "Invalid input argument: edge_property is not created for graph_view.");
+
+  edge_t num_local_edges{0};
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    detail::find_edge_offset_t<GraphViewType> find_edge_offset{
+      matrix_partition_device_t<GraphViewType>(graph_view, i),
+      edgelist_rows,
+      edgelist_cols,
+      graph_view.has_sorted_neighbor_lists()};
+
+    thrust::for_each(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(edge_t{0}),
+      thrust::make_counting_iterator(num_edgelist_edges),
+      detail::scatter_edge_property_value_t<GraphViewType, T>{
+        find_edge_offset, edgelist_values, edge_property.mutable_value_first(i)});
+
+    if (do_expensive_check) {
+      num_local_edges += static_cast<edge_t>(
+        thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                         thrust::make_counting_iterator(edge_t{0}),
+                         thrust::make_counting_iterator(num_edgelist_edges),
+                         detail::is_local_edge_t<GraphViewType>{find_edge_offset}));
+    }
+  }
+
+  if (do_expensive_check) {
+    // every edge of a valid edge list belongs to exactly one local matrix partition
+    auto num_invalid_edges = num_edgelist_edges - num_local_edges;
+    if (GraphViewType::is_multi_gpu) {
+      num_invalid_edges =
+        host_scalar_allreduce(handle.get_comms(), num_invalid_edges, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_edges == 0,
+                    "Invalid input argument: edge list has edges that do not exist in graph_view.");
+  }
+}
+
+}  // namespace experimental
+}  // namespace cugraph
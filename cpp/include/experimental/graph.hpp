@@ -22,6 +22,8 @@
 #include <rmm/device_uvector.hpp>
 
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -72,22 +74,55 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
           bool sorted_by_global_degree_within_vertex_partition,
           bool do_expensive_check = false);
 
+  // construct from per matrix partition compressed sparse (CSR or CSC) arrays (e.g. built by
+  // graph_builder_t), neighbor lists should already be sorted if
+  // properties.has_sorted_neighbor_lists is true
+  graph_t(raft::handle_t const &handle,
+          std::vector<rmm::device_uvector<edge_t>> &&adj_matrix_partition_offsets,
+          std::vector<rmm::device_uvector<vertex_t>> &&adj_matrix_partition_indices,
+          std::vector<rmm::device_uvector<weight_t>> &&adj_matrix_partition_weights,
+          partition_t<vertex_t> const &partition,
+          vertex_t number_of_vertices,
+          edge_t number_of_edges,
+          graph_properties_t properties,
+          bool sorted_by_global_degree_within_vertex_partition,
+          bool do_expensive_check = false);
+
   graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> view() const
   {
     std::vector<edge_t const *> offsets(adj_matrix_partition_offsets_.size(), nullptr);
     std::vector<vertex_t const *> indices(adj_matrix_partition_indices_.size(), nullptr);
     std::vector<weight_t const *> weights(adj_matrix_partition_weights_.size(), nullptr);
+    std::vector<uint32_t const *> local_indices(adj_matrix_partition_local_indices_.size(),
+                                                nullptr);
     for (size_t i = 0; i < offsets.size(); ++i) {
       offsets[i] = adj_matrix_partition_offsets_[i].data();
-      indices[i] = adj_matrix_partition_indices_[i].data();
+      if (local_indices.size() > 0) {
+        local_indices[i] = adj_matrix_partition_local_indices_[i].data();
+      } else {
+        indices[i] = adj_matrix_partition_indices_[i].data();
+      }
       if (weights.size() > 0) { weights[i] = adj_matrix_partition_weights_[i].data(); }
     }
 
-    return graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+    std::vector<vertex_t const *> dcs_nzd_vertices(adj_matrix_partition_dcs_nzd_vertices_.size(),
+                                                   nullptr);
+    std::vector<vertex_t> dcs_nzd_vertex_counts(dcs_nzd_vertices.size(), vertex_t{0});
+    for (size_t i = 0; i < dcs_nzd_vertices.size(); ++i) {
+      dcs_nzd_vertices[i]      = adj_matrix_partition_dcs_nzd_vertices_[i].data();
+      dcs_nzd_vertex_counts[i] =
+        static_cast<vertex_t>(adj_matrix_partition_dcs_nzd_vertices_[i].size());
+    }
+
+    graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> ret(
       *(this->get_handle_ptr()),
       offsets,
       indices,
+      local_indices,
       weights,
+      dcs_nzd_vertices,
+      dcs_nzd_vertex_counts,
+      adj_matrix_partition_major_hypersparse_firsts_,
       vertex_partition_segment_offsets_,
       partition_,
       this->get_number_of_vertices(),
@@ -95,19 +130,36 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
       this->get_graph_properties(),
       vertex_partition_segment_offsets_.size() > 0,
       false);
+    ret.property_cache_ = property_cache_;
+    return ret;
   }
 
  private:
+  // compute degree-based segment offsets and store the low-degree segments in DCSR (or DCSC) format
+  void update_segment_offsets_and_hypersparse(bool do_expensive_check);
+
   std::vector<rmm::device_uvector<edge_t>> adj_matrix_partition_offsets_{};
   std::vector<rmm::device_uvector<vertex_t>> adj_matrix_partition_indices_{};
+  // minors stored as 32 bit offsets from minor_first (size 0 if adj_matrix_partition_indices_ is
+  // used instead)
+  std::vector<rmm::device_uvector<uint32_t>> adj_matrix_partition_local_indices_{};
   std::vector<rmm::device_uvector<weight_t>> adj_matrix_partition_weights_{};
 
+  // nzd: non-zero (local) degree, relevant only if sorted_by_global_degree_within_vertex_partition
+  // is true (majors in [major_hypersparse_first, major_last) are stored in DCSR or DCSC format)
+  std::vector<rmm::device_uvector<vertex_t>> adj_matrix_partition_dcs_nzd_vertices_{};
+  std::vector<vertex_t> adj_matrix_partition_major_hypersparse_firsts_{};
+
   partition_t<vertex_t> partition_{};
 
   std::vector<vertex_t>
     vertex_partition_segment_offsets_{};  // segment offsets within the vertex partition based on
                                           // vertex degree, relevant only if
                                           // sorted_by_global_degree_within_vertex_partition is true
+
+  // derived properties (shared with the views of this graph)
+  std::shared_ptr<detail::graph_property_cache_t<vertex_t, edge_t, weight_t>> property_cache_{
+    std::make_shared<detail::graph_property_cache_t<vertex_t, edge_t, weight_t>>()};
 };
 
 // single-GPU version
@@ -138,11 +190,22 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
           bool sorted_by_degree,
           bool do_expensive_check = false);
 
+  // construct from compressed sparse (CSR or CSC) arrays (e.g. built by graph_builder_t), neighbor
+  // lists should already be sorted if properties.has_sorted_neighbor_lists is true
+  graph_t(raft::handle_t const &handle,
+          rmm::device_uvector<edge_t> &&offsets,
+          rmm::device_uvector<vertex_t> &&indices,
+          rmm::device_uvector<weight_t> &&weights,
+          vertex_t number_of_vertices,
+          graph_properties_t properties,
+          bool sorted_by_degree,
+          bool do_expensive_check = false);
+
   vertex_t get_number_of_local_vertices() const { return this->get_number_of_vertices(); }
 
   graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> view() const
   {
-    return graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+    graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> ret(
       *(this->get_handle_ptr()),
       offsets_.data(),
       indices_.data(),
@@ -153,14 +216,23 @@ class graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enab
       this->get_graph_properties(),
       segment_offsets_.size() > 0,
       false);
+    ret.property_cache_ = property_cache_;
+    return ret;
   }
 
  private:
+  // compute degree-based segment offsets
+  void update_segment_offsets(bool do_expensive_check);
+
   rmm::device_uvector<edge_t> offsets_;
   rmm::device_uvector<vertex_t> indices_;
   rmm::device_uvector<weight_t> weights_;
   std::vector<vertex_t> segment_offsets_{};  // segment offsets based on vertex degree, relevant
                                              // only if sorted_by_global_degree is true
+
+  // derived properties (shared with the views of this graph)
+  std::shared_ptr<detail::graph_property_cache_t<vertex_t, edge_t, weight_t>> property_cache_{
+    std::make_shared<detail::graph_property_cache_t<vertex_t, edge_t, weight_t>>()};
 };
 
 template <typename T, typename Enable = void>
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <cstddef>
+
+namespace cugraph {
+namespace experimental {
+
+/**
+ * @brief A batch of independent (small) graphs stored as a single block-diagonal graph.
+ *
+ * The i'th graph's vertices are the block-diagonal graph's vertices in [vertex_offsets()[i],
+ * vertex_offsets()[i + 1]) and there are no edges between the graphs. The batched algorithms
+ * (e.g. batched_pagerank()) run over every graph at once (a single set of kernel launches,
+ * allocations, and host synchronizations per iteration instead of one set per graph) and return
+ * per-graph results; running a batch of many small graphs amortizes the fixed per-call setup
+ * costs that dominate running an algorithm on a single small graph.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to store the transposed adjacency matrix.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+class graph_batch_t {
+ public:
+  using vertex_type                              = vertex_t;
+  using edge_type                                = edge_t;
+  using weight_type                              = weight_t;
+  static constexpr bool is_adj_matrix_transposed = store_transposed;
+
+  /**
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param edgelist Concatenated edge lists of the graphs, the i'th graph's edges are [@p
+   * graph_edge_offsets[i], @p graph_edge_offsets[i + 1]) and their vertex IDs are local to the
+   * graph (in [0, @p graph_vertex_offsets[i + 1] - @p graph_vertex_offsets[i])).
+   * @param graph_edge_offsets Pointer (in device memory) to the edge offsets of the graphs (size =
+   * @p number_of_graphs + 1).
+   * @param graph_vertex_offsets Pointer (in device memory) to the vertex offsets of the graphs
+   * (size = @p number_of_graphs + 1).
+   * @param number_of_graphs Number of graphs in the batch.
+   * @param properties Properties of the graphs (every graph should have the same properties).
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  graph_batch_t(raft::handle_t const &handle,
+                edgelist_t<vertex_t, edge_t, weight_t> const &edgelist,
+                edge_t const *graph_edge_offsets,
+                vertex_t const *graph_vertex_offsets,
+                size_t number_of_graphs,
+                graph_properties_t properties,
+                bool do_expensive_check = false);
+
+  size_t get_number_of_graphs() const { return number_of_graphs_; }
+
+  // the block-diagonal graph of the batch
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, false> view() const
+  {
+    return graph_.view();
+  }
+
+  // vertex offsets of the graphs in the block-diagonal graph (size = the number of graphs + 1)
+  vertex_t const *vertex_offsets() const { return vertex_offsets_.data(); }
+
+  // graph IDs of the block-diagonal graph's vertices (size = the number of vertices)
+  vertex_t const *vertex_graph_ids() const { return vertex_graph_ids_.data(); }
+
+ private:
+  graph_t<vertex_t, edge_t, weight_t, store_transposed, false> graph_;
+  size_t number_of_graphs_{0};
+  rmm::device_uvector<vertex_t> vertex_offsets_;
+  rmm::device_uvector<vertex_t> vertex_graph_ids_;
+};
+
+}  // namespace experimental
+}  // namespace cugraph
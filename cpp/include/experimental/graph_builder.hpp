@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+#include <utilities/graph_storage.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+
+/**
+ * @brief Builder to construct a graph_t object from an edge list streamed in chunks.
+ *
+ * graph_t's edge list constructor requires the entire edge list to reside in device memory. This
+ * builder instead takes an edge list (e.g. an edge list too large to fit in device memory) as a
+ * sequence of chunks in two passes. In the first pass, every chunk is passed to count_edges() to
+ * accumulate (local) degrees. In the second pass, the same set of edges (possibly in different
+ * chunks) is passed to insert_edges() which scatters the edges to the compressed sparse (CSR or
+ * CSC) arrays allocated (once) at the first insert_edges() call. build() sorts the neighbor lists
+ * (if @p properties.has_sorted_neighbor_lists is true) and moves the arrays to a graph_t object.
+ * Peak memory usage is close to the final graph size (plus (local) degrees and buffers for a
+ * single chunk).
+ *
+ * In multi-GPU, every chunk is shuffled to the GPUs owning the edges. count_edges() and
+ * insert_edges() are collective operations (every GPU should call them the same number of times,
+ * chunk sizes can differ across GPUs and can be 0). Vertex IDs should be already renumbered (e.g.
+ * using renumber_map_t) and @p vertex_partition_offsets should be the vertex partition offsets of
+ * the renumbered vertex IDs.
+ *
+ * The edge arrays (indices and weights) are allocated in the memory selected by @p storage; with
+ * graph_storage_t::managed, the graph can exceed the device memory size (offsets still reside in
+ * device memory).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to store the transposed adjacency matrix.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+class graph_builder_t {
+ public:
+  /**
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms. This object should outlive the
+   * builder.
+   * @param number_of_vertices Number of vertices in the graph.
+   * @param properties Properties of the graph to build.
+   * @param vertex_partition_offsets Vertex partition offsets (size = comm_size + 1, relevant only
+   * if @p multi_gpu is true).
+   * @param storage Memory to hold the edge arrays (indices and weights) of the graph.
+   */
+  graph_builder_t(raft::handle_t const &handle,
+                  vertex_t number_of_vertices,
+                  graph_properties_t properties,
+                  std::vector<vertex_t> const &vertex_partition_offsets = {},
+                  graph_storage_t storage = graph_storage_t::device);
+
+  /**
+   * @brief Accumulate the (local) degrees of the edges in a chunk (first pass).
+   *
+   * @param chunk Edge list chunk (edge weights are ignored).
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  void count_edges(edgelist_t<vertex_t, edge_t, weight_t> const &chunk,
+                   bool do_expensive_check = false);
+
+  /**
+   * @brief Insert the edges in a chunk to the compressed sparse arrays (second pass).
+   *
+   * Edges passed to insert_edges() (over all the calls) should coincide with the edges passed to
+   * count_edges() (over all the calls).
+   *
+   * @param chunk Edge list chunk (edge weights should be provided if @p properties.is_weighted is
+   * true).
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  void insert_edges(edgelist_t<vertex_t, edge_t, weight_t> const &chunk,
+                    bool do_expensive_check = false);
+
+  /**
+   * @brief Build a graph_t object (the builder should not be used after this call).
+   *
+   * @param sorted_by_degree Flag indicating whether vertex IDs are sorted by (global) degree in
+   * non-ascending order (within each vertex partition in multi-GPU).
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   * @return Graph object holding the inserted edges.
+   */
+  graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> build(
+    bool sorted_by_degree = false, bool do_expensive_check = false);
+
+ private:
+  void allocate();
+
+  raft::handle_t const *handle_ptr_{nullptr};
+  vertex_t number_of_vertices_{0};
+  graph_properties_t properties_{};
+  partition_t<vertex_t> partition_{};  // relevant only if multi_gpu is true
+  graph_storage_t storage_{graph_storage_t::device};
+
+  // per (local) matrix partition arrays, offsets_ hold degrees (and 0 at the end) while counting
+  // and are converted to offsets (by an exclusive scan) at the first insert_edges() call
+  std::vector<rmm::device_uvector<edge_t>> offsets_{};
+  std::vector<rmm::device_uvector<edge_t>> insert_counts_{};
+  std::vector<rmm::device_uvector<vertex_t>> indices_{};
+  std::vector<rmm::device_uvector<weight_t>> weights_{};
+
+  // device copies of the per matrix partition major ranges and array pointers
+  rmm::device_uvector<vertex_t> d_vertex_partition_lasts_;
+  rmm::device_uvector<vertex_t> d_major_firsts_;
+  rmm::device_uvector<vertex_t> d_major_lasts_;
+  rmm::device_uvector<edge_t *> d_offsets_;
+  rmm::device_uvector<edge_t *> d_insert_counts_;
+  rmm::device_uvector<vertex_t *> d_indices_;
+  rmm::device_uvector<weight_t *> d_weights_;
+
+  bool inserting_{false};
+  bool built_{false};
+};
+
+}  // namespace experimental
+}  // namespace cugraph
@@ -22,6 +22,7 @@
 #include <rmm/device_uvector.hpp>
 
 #include <memory>
+#include <string>
 #include <tuple>
 #include <vector>
 
@@ -154,6 +155,64 @@ renumber_edgelist(raft::handle_t const& handle,
                   std::vector<edge_t> const& edgelist_edge_counts,
                   bool do_expensive_check = false);
 
+/**
+ * @brief Compute an edge-balanced vertex to GPU mapping for multi-GPU graph construction.
+ *
+ * By default, vertices are hashed to GPUs (compute_gpu_id_from_vertex_t), and a GPU ends up with
+ * many more edges than the others if a few high-degree vertices are hashed to the same GPU. This
+ * function finds the hub vertices (vertices with degrees no smaller than 1/1024 of the average
+ * per-GPU degree sum) and assigns them to GPUs (in non-ascending degree order, each hub goes to
+ * the GPU with the smallest degree sum so far) to balance the sum of the vertex degrees
+ * (in-degrees + out-degrees) in each GPU. The remaining vertices stay in the GPUs they are hashed
+ * to. This should be called before shuffling the edges (and the vertices); the returned hub
+ * vertices and GPU IDs should be passed to compute_gpu_id_from_vertex_t,
+ * compute_gpu_id_from_edge_t, and compute_partition_id_from_edge_t in shuffling and to
+ * renumber_edgelist and renumber_ext_vertices afterwards.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param edgelist_rows Edge source vertex IDs of the edges in this process (edges can be
+ * distributed to processes in any way).
+ * @param edgelist_cols Edge destination vertex IDs of the edges in this process.
+ * @param num_edgelist_edges Number of edges in this process.
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<int>> Pair of the hub
+ * vertices (sorted) and the GPU IDs assigned to them (identical in every process).
+ */
+template <typename vertex_t, typename edge_t>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<int>>
+compute_edge_balanced_hub_gpu_ids(raft::handle_t const& handle,
+                                  vertex_t const* edgelist_rows,
+                                  vertex_t const* edgelist_cols,
+                                  edge_t num_edgelist_edges);
+
+/**
+ * @brief renumber edgelist (multi-GPU)
+ *
+ * Same as the above but vertices and edges are pre-shuffled using the vertex to GPU mapping with
+ * the hub vertices assigned by compute_edge_balanced_hub_gpu_ids (i.e. @p hub_vertices, @p
+ * hub_gpu_ids, and @p num_hubs are passed to the compute_gpu_id_from_vertex_t,
+ * compute_gpu_id_from_edge_t, and compute_partition_id_from_edge_t functors in shuffling).
+ *
+ * @param hub_vertices Sorted hub vertices (returned by compute_edge_balanced_hub_gpu_ids).
+ * @param hub_gpu_ids GPU IDs assigned to the hub vertices.
+ * @param num_hubs Number of hub vertices.
+ */
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::enable_if_t<multi_gpu,
+                 std::tuple<rmm::device_uvector<vertex_t>, partition_t<vertex_t>, vertex_t, edge_t>>
+renumber_edgelist(raft::handle_t const& handle,
+                  vertex_t const* local_vertices,
+                  vertex_t num_local_vertices,
+                  std::vector<vertex_t*> const& edgelist_major_vertices /* [INOUT] */,
+                  std::vector<vertex_t*> const& edgelist_minor_vertices /* [INOUT] */,
+                  std::vector<edge_t> const& edgelist_edge_counts,
+                  vertex_t const* hub_vertices,
+                  int const* hub_gpu_ids,
+                  vertex_t num_hubs,
+                  bool do_expensive_check = false);
+
 /**
  * @brief renumber edgelist (single-GPU)
  *
@@ -220,6 +279,30 @@ void renumber_ext_vertices(raft::handle_t const& handle,
                            vertex_t local_int_vertex_last,
                            bool do_expensive_check = false);
 
+/**
+ * @brief Renumber external vertices to internal vertices based on the provoided @p
+ * renumber_map_labels (multi-GPU, the graph is renumbered with the hub vertices assigned by
+ * compute_edge_balanced_hub_gpu_ids).
+ *
+ * Same as the above but external vertices are looked up in the GPUs they are mapped to with the
+ * hub vertices (the version above assumes that all the vertices are hashed to GPUs).
+ *
+ * @param hub_vertices Sorted hub vertices (returned by compute_edge_balanced_hub_gpu_ids).
+ * @param hub_gpu_ids GPU IDs assigned to the hub vertices.
+ * @param num_hubs Number of hub vertices.
+ */
+template <typename vertex_t, bool multi_gpu>
+void renumber_ext_vertices(raft::handle_t const& handle,
+                           vertex_t* vertices /* [INOUT] */,
+                           size_t num_vertices,
+                           vertex_t const* renumber_map_labels,
+                           vertex_t local_int_vertex_first,
+                           vertex_t local_int_vertex_last,
+                           vertex_t const* hub_vertices,
+                           int const* hub_gpu_ids,
+                           vertex_t num_hubs,
+                           bool do_expensive_check = false);
+
 /**
  * @brief Unrenumber local internal vertices to external vertices based on the providied @p
  * renumber_map_labels.
@@ -285,6 +368,102 @@ void unrenumber_int_vertices(raft::handle_t const& handle,
                              std::vector<vertex_t>& vertex_partition_lasts,
                              bool do_expensive_check = false);
 
+namespace detail {
+
+// hash map from the external vertex IDs of the local internal vertices to the internal vertex IDs
+// (defined in renumber_utils.cu)
+template <typename vertex_t>
+struct ext_to_int_vertex_map_t;
+
+}  // namespace detail
+
+/**
+ * @brief Persistent renumber map.
+ *
+ * Owns the renumber map labels (the external vertices corresponding to the local internal
+ * vertices, as returned by renumber_edgelist) and a hash map from the external vertices to the
+ * internal vertices, built once on construction. Renumbering queries and unrenumbering results
+ * with this object reuse the hash map instead of rebuilding it from the labels on every call (as
+ * renumber_ext_vertices does). In multi-GPU, this assumes that all the vertices are hashed to GPUs
+ * (no hub vertices from compute_edge_balanced_hub_gpu_ids).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ */
+template <typename vertex_t, bool multi_gpu>
+class renumber_map_t {
+ public:
+  /**
+   * @brief Construct a renumber map object from renumber map labels.
+   *
+   * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+   * handles to various CUDA libraries) to run graph algorithms.
+   * @param renumber_map_labels The external vertices corresponding to the internal vertices in the
+   * range [@p local_int_vertex_first, @p local_int_vertex_last) (moved to this object).
+   * @param local_int_vertex_first The first local internal vertex (inclusive, assigned to this
+   * process in multi-GPU).
+   * @param local_int_vertex_last The last local internal vertex (exclusive, assigned to this
+   * process in multi-GPU).
+   * @param vertex_partition_lasts Last local internal vertices (exclusive, assigned to each
+   * process in multi-GPU, relevant only in multi-GPU).
+   * @param do_expensive_check A flag to run expensive checks for input arguments (if set to
+   * `true`).
+   */
+  renumber_map_t(raft::handle_t const& handle,
+                 rmm::device_uvector<vertex_t>&& renumber_map_labels,
+                 vertex_t local_int_vertex_first,
+                 vertex_t local_int_vertex_last,
+                 std::vector<vertex_t> const& vertex_partition_lasts = std::vector<vertex_t>{},
+                 bool do_expensive_check                             = false);
+
+  renumber_map_t(renumber_map_t&&) noexcept;
+  renumber_map_t& operator=(renumber_map_t&&) noexcept;
+  ~renumber_map_t();
+
+  vertex_t const* labels() const { return labels_.data(); }
+  vertex_t get_local_int_vertex_first() const { return local_int_vertex_first_; }
+  vertex_t get_local_int_vertex_last() const { return local_int_vertex_last_; }
+
+  /**
+   * @brief Renumber external vertices to internal vertices (in-place).
+   *
+   * Same as the renumber_ext_vertices free function (the input vertices can be any vertices in
+   * multi-GPU), invalid_vertex_id<vertex_t>::value remains unchanged.
+   */
+  void renumber_ext_vertices(raft::handle_t const& handle,
+                             vertex_t* vertices /* [INOUT] */,
+                             size_t num_vertices,
+                             bool do_expensive_check = false) const;
+
+  /**
+   * @brief Unrenumber local internal vertices to external vertices (in-place).
+   *
+   * Same as the unrenumber_local_int_vertices free function.
+   */
+  void unrenumber_local_int_vertices(raft::handle_t const& handle,
+                                     vertex_t* vertices /* [INOUT] */,
+                                     size_t num_vertices,
+                                     bool do_expensive_check = false) const;
+
+  /**
+   * @brief Unrenumber (possibly non-local) internal vertices to external vertices (in-place).
+   *
+   * Same as the unrenumber_int_vertices free function.
+   */
+  void unrenumber_int_vertices(raft::handle_t const& handle,
+                               vertex_t* vertices /* [INOUT] */,
+                               size_t num_vertices,
+                               bool do_expensive_check = false) const;
+
+ private:
+  rmm::device_uvector<vertex_t> labels_;
+  vertex_t local_int_vertex_first_{0};
+  vertex_t local_int_vertex_last_{0};
+  std::vector<vertex_t> vertex_partition_lasts_{};
+  std::unique_ptr<detail::ext_to_int_vertex_map_t<vertex_t>> ext_to_int_map_ptr_{};
+};
+
 /**
  * @brief Compute the coarsened graph.
  *
@@ -347,9 +526,72 @@ void relabel(raft::handle_t const& handle,
              vertex_t num_labels,
              bool do_expensive_check = false);
 
+/**
+ * @brief Vertex orders for reorder_graph().
+ *
+ * degree: non-ascending (major) degree order (the order renumber_edgelist uses).
+ * reverse_cuthill_mckee: reverse Cuthill-McKee order of a breadth-first traversal started from the
+ * highest degree vertex (typically in the largest connected component), vertices not reached by the
+ * traversal follow in non-ascending degree order.
+ * cluster: vertices with the same cluster ID (e.g. a Louvain or Leiden clustering) are placed
+ * consecutively (in ascending cluster ID order and then in non-ascending degree order).
+ */
+enum class vertex_order_t { degree = 0, reverse_cuthill_mckee, cluster };
+
+/**
+ * @brief Reorder the vertices of a graph to improve the locality of the neighbor accesses.
+ *
+ * The pattern kernels gather adjacency matrix row/column values with the neighbor IDs, so numbering
+ * adjacent vertices closely improves cache reuse. Only the degree order keeps the degree sorted
+ * vertex numbering (and the associated load balancing) renumber_edgelist provides.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to store the graph adjacency matrix as is or as
+ * transposed.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true). Currently, only single-GPU is supported.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the input graph to be reordered.
+ * @param order Vertex order to apply.
+ * @param clusters Cluster IDs of the vertices (size = graph_view.get_number_of_vertices(), relevant
+ * only if @p order is vertex_order_t::cluster).
+ * @param renumber_map_labels Renumber map of @p graph_view (size =
+ * graph_view.get_number_of_vertices()); the returned map is composed with this map if non-null.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<std::unique_ptr<graph_t<vertex_t, edge_t, weight_t, store_transposed,
+ * multi_gpu>>, rmm::device_uvector<vertex_t>> Tuple of the reordered graph and, for every vertex of
+ * the reordered graph, the corresponding @p graph_view vertex (or its @p renumber_map_labels label
+ * if @p renumber_map_labels is non-null).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::enable_if_t<
+  !multi_gpu,
+  std::tuple<std::unique_ptr<graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>>,
+             rmm::device_uvector<vertex_t>>>
+reorder_graph(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> const& graph_view,
+  vertex_order_t order,
+  vertex_t const* clusters            = nullptr,
+  vertex_t const* renumber_map_labels = nullptr,
+  bool do_expensive_check             = false);
+
 /**
  * @brief extract induced subgraph(s).
  *
+ * Vertices with local degrees much larger than the number of vertices in their subgraphs (e.g. hubs
+ * in egonets) are processed edge-parallel with hash table based membership tests; the other
+ * vertices are processed with a binary search per neighbor. In multi-GPU, each GPU specifies its
+ * own subgraphs (subgraph vertices need not be local vertices), and each GPU receives the edges of
+ * its own subgraphs (sorted by edge major and then minor within each subgraph).
+ *
  * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
  * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
  * @tparam weight_t Type of edge weights.
@@ -391,5 +633,143 @@ extract_induced_subgraphs(
   size_t num_subgraphs,
   bool do_expensive_check = false);
 
+/**
+ * @brief Write a graph to a binary snapshot file.
+ *
+ * The snapshot stores the compressed sparse (CSR or CSC) arrays of every local adjacency matrix
+ * partition, the vertex partition offsets, the graph properties, and (optionally) the renumber map
+ * labels of the local vertices. A graph can be reconstructed from the snapshot with
+ * read_graph_snapshot() (skipping shuffling, renumbering, and compression of the edge list). In
+ * multi-GPU, every GPU writes its own snapshot file (each GPU should use a distinct file path).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights.
+ * @tparam store_transposed Flag indicating whether to store the graph adjacency matrix as is or as
+ * transposed.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Graph view object of the graph to write.
+ * @param renumber_map_labels Pointer to the renumber map labels of the local vertices (size ==
+ * @p graph_view.get_number_of_local_vertices()), can be nullptr if the graph is not renumbered.
+ * @param file_path Path of the snapshot file to write (overwritten if exists).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void write_graph_snapshot(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> const& graph_view,
+  vertex_t const* renumber_map_labels,
+  std::string const& file_path);
+
+/**
+ * @brief Read a graph from a binary snapshot file written by write_graph_snapshot().
+ *
+ * The file is memory-mapped and copied to device memory through pinned staging buffers. In
+ * multi-GPU, every GPU reads the snapshot file it wrote (the snapshot should be read with the same
+ * number of GPUs and the same 2D partitioning).
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights.
+ * @tparam store_transposed Flag indicating whether to store the graph adjacency matrix as is or as
+ * transposed.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param file_path Path of the snapshot file to read.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>,
+ * rmm::device_uvector<vertex_t>> Pair of the graph and the renumber map labels of the local
+ * vertices (size 0 if the snapshot does not store renumber map labels).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>,
+           rmm::device_uvector<vertex_t>>
+read_graph_snapshot(raft::handle_t const& handle,
+                    std::string const& file_path,
+                    bool do_expensive_check = false);
+
+
+/**
+ * @brief Read an edge list from a Matrix Market file (in coordinate format).
+ *
+ * The file is read in large chunks and every chunk is tokenized and parsed on device. Only the
+ * entries (lines) starting in the byte range [@p byte_range_offset, @p byte_range_offset + @p
+ * byte_range_size) are read (the banner and the size line are always read), so the file can be read
+ * in disjoint byte ranges (e.g. a byte range per GPU in multi-GPU) and every entry is read exactly
+ * once. If the file is symmetric, the symmetric complements of the non-diagonal entries are added.
+ * Vertex IDs are converted to 0-based.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param file_path Path of the Matrix Market file (real, integer, or pattern field and general or
+ * symmetric symmetry).
+ * @param read_weights Flag indicating whether to read edge weights (edge weights are set to 1 if
+ * the file is in pattern field).
+ * @param byte_range_offset Offset (in bytes) of the byte range to read.
+ * @param byte_range_size Size (in bytes) of the byte range to read (0 to read till the end of the
+ * file).
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>,
+ * rmm::device_uvector<weight_t>, vertex_t, bool> Tuple of edge list rows, columns, weights (size 0
+ * if @p read_weights is false), the number of vertices, and a flag indicating whether the file is
+ * symmetric.
+ */
+template <typename vertex_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>,
+           vertex_t,
+           bool>
+read_edgelist_from_matrix_market_file(raft::handle_t const& handle,
+                                      std::string const& file_path,
+                                      bool read_weights,
+                                      size_t byte_range_offset = 0,
+                                      size_t byte_range_size   = 0);
+
+/**
+ * @brief Read an edge list from a text file with a "source destination [weight]" line per edge.
+ *
+ * Fields can be separated by spaces, tabs, or commas; blank lines and lines starting with '#' or
+ * '%' are skipped. Chunked reading, device parsing, and byte ranges work as in
+ * read_edgelist_from_matrix_market_file().
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param file_path Path of the edge list file.
+ * @param read_weights Flag indicating whether every line has an edge weight field.
+ * @param index_base Smallest vertex ID in the file (subtracted from the vertex IDs).
+ * @param byte_range_offset Offset (in bytes) of the byte range to read.
+ * @param byte_range_size Size (in bytes) of the byte range to read (0 to read till the end of the
+ * file).
+ * @return std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>,
+ * rmm::device_uvector<weight_t>> Tuple of edge list sources, destinations, and weights (size 0 if
+ * @p read_weights is false).
+ */
+template <typename vertex_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+read_edgelist_from_text_file(raft::handle_t const& handle,
+                             std::string const& file_path,
+                             bool read_weights,
+                             vertex_t index_base      = vertex_t{0},
+                             size_t byte_range_offset = 0,
+                             size_t byte_range_size   = 0);
+
 }  // namespace experimental
 }  // namespace cugraph
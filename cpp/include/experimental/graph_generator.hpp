@@ -15,11 +15,14 @@
  */
 #pragma once
 
+#include <experimental/graph.hpp>
+
 #include <raft/handle.hpp>
 #include <rmm/device_uvector.hpp>
 
 #include <cstdint>
 #include <tuple>
+#include <vector>
 
 namespace cugraph {
 namespace experimental {
@@ -133,5 +136,73 @@ generate_rmat_edgelists(
   bool clip_and_flip                         = false,
   bool scramble_vertex_ids                   = false);
 
+/**
+ * @brief generate a graph using the R-mat graph generator, every GPU generates only the edges of
+ * its local adjacency matrix partitions.
+ *
+ * This function creates a graph object directly (without shuffling the generated edges) as every
+ * GPU samples the edges falling in its 2D partition blocks of the graph adjacency matrix. The
+ * number of edges in each block is drawn (identically in every GPU) from the multinomial
+ * distribution the R-mat recursion defines over the blocks, so the resulting graph follows the same
+ * distribution as a graph generated by generate_rmat_edgelist. This requires the number of GPUs to
+ * be a power of two (so that the vertex partition boundaries coincide with the R-mat recursion
+ * levels). This function allows multi-edges and self-loops similar to the Graph 500 reference
+ * implementation.
+ *
+ * Vertices are (internally) numbered in the R-mat vertex ID space. If @p scramble_vertex_ids is set
+ * to `true`, the returned renumber map labels store the scrambled (following the Graph 500
+ * reference implementation version 3.0.0) vertex IDs of the local vertices; the scrambled vertex
+ * IDs serve as external vertex IDs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @tparam store_transposed Flag indicating whether to store the graph adjacency matrix as is or as
+ * transposed.
+ * @tparam multi_gpu Flag indicating whether template instantiation should target single-GPU (false)
+ * or multi-GPU (true).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param scale Scale factor to set the number of verties in the graph. Vertex IDs have values in
+ * [0, V), where V = 1 << @p scale.
+ * @param edge_factor Average number of edges per vertex to generate; the graph has
+ * (size_t{1} << @p scale) * @p edge_factor edges.
+ * @param a a, b, c, d (= 1.0 - (a + b + c)) in the R-mat graph generator (vist https://graph500.org
+ * for additional details). a, b, c, d should be non-negative and a + b + c should be no larger
+ * than 1.0.
+ * @param b a, b, c, d (= 1.0 - (a + b + c)) in the R-mat graph generator (vist https://graph500.org
+ * for additional details). a, b, c, d should be non-negative and a + b + c should be no larger
+ * than 1.0.
+ * @param c a, b, c, d (= 1.0 - (a + b + c)) in the R-mat graph generator (vist https://graph500.org
+ * for additional details). a, b, c, d should be non-negative and a + b + c should be no larger
+ * than 1.0.
+ * @param seed Seed value for the random number generator (should be identical in every GPU).
+ * @param scramble_vertex_ids Flag controlling whether to return the scrambled vertex IDs of the
+ * local vertices (if set to `true`) or not (if set to `false`).
+ * @param generate_weights Flag controlling whether to generate edge weights (uniformly distributed
+ * in [0.0, 1.0)) or not.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>,
+ * rmm::device_uvector<vertex_t>> Tuple of the generated graph and the scrambled vertex IDs of the
+ * local vertices (size 0 if @p scramble_vertex_ids is `false`).
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>,
+           rmm::device_uvector<vertex_t>>
+generate_rmat_graph(raft::handle_t const& handle,
+                    size_t scale,
+                    size_t edge_factor       = 16,
+                    double a                 = 0.57,
+                    double b                 = 0.19,
+                    double c                 = 0.19,
+                    uint64_t seed            = 0,
+                    bool scramble_vertex_ids = false,
+                    bool generate_weights    = false,
+                    bool do_expensive_check  = false);
+
 }  // namespace experimental
 }  // namespace cugraph
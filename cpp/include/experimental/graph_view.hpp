@@ -23,6 +23,9 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -210,6 +213,9 @@ struct graph_properties_t {
   bool is_symmetric{false};
   bool is_multigraph{false};
   bool is_weighted{false};
+  // if set to true, graph_t construction sorts the neighbor list of every major (in ascending minor
+  // order) and graph (view) objects guarantee sorted neighbor lists
+  bool has_sorted_neighbor_lists{false};
 };
 
 namespace detail {
@@ -252,6 +258,7 @@ class graph_base_t {
   bool is_symmetric() const { return properties_.is_symmetric; }
   bool is_multigraph() const { return properties_.is_multigraph; }
   bool is_weighted() const { return properties_.is_weighted; }
+  bool has_sorted_neighbor_lists() const { return properties_.has_sorted_neighbor_lists; }
 
  protected:
   raft::handle_t const* get_handle_ptr() const { return handle_ptr_; };
@@ -266,8 +273,56 @@ class graph_base_t {
   graph_properties_t properties_{};
 };
 
+// Derived graph properties computed on first use and reused by the following uses. A graph_t
+// object owns one cache and every view created from the graph_t object shares the cache (so the
+// cached properties outlive neither the graph data nor the last view).
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct graph_property_cache_t {
+  std::mutex mutex{};
+
+  std::unique_ptr<rmm::device_uvector<edge_t>> in_degrees{};
+  std::unique_ptr<rmm::device_uvector<edge_t>> out_degrees{};
+  std::unique_ptr<rmm::device_uvector<weight_t>> in_weight_sums{};
+  std::unique_ptr<rmm::device_uvector<weight_t>> out_weight_sums{};
+
+  std::unique_ptr<edge_t> max_in_degree{};
+  std::unique_ptr<edge_t> max_out_degree{};
+  std::unique_ptr<weight_t> max_in_weight_sum{};
+  std::unique_ptr<weight_t> max_out_weight_sum{};
+
+  // graph_t object storing the same graph with the opposite store_transposed value (type-erased as
+  // graph_t is an incomplete type here)
+  std::shared_ptr<void> transposed_storage_graph{};
+};
+
+// the computed property is published only after the handle's stream is synchronized, as the
+// property can be used (read-only) on any other stream once published (e.g. by another algorithm
+// call running concurrently on the same graph)
+template <typename T, typename ComputeOp>
+T const& get_or_compute_graph_property(raft::handle_t const& handle,
+                                       std::mutex& mutex,
+                                       std::unique_ptr<T>& property,
+                                       ComputeOp compute_op)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!property) {
+    auto tmp = std::make_unique<T>(compute_op());
+    handle.get_stream_view().synchronize();
+    property = std::move(tmp);
+  }
+  return *property;
+}
+
 }  // namespace detail
 
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu,
+          typename Enable>
+class graph_t;
+
 // graph_view_t is a non-owning graph class (note that graph_t is an owning graph class)
 template <typename vertex_t,
           typename edge_t,
@@ -300,7 +355,11 @@ class graph_view_t<vertex_t,
   graph_view_t(raft::handle_t const& handle,
                std::vector<edge_t const*> const& adj_matrix_partition_offsets,
                std::vector<vertex_t const*> const& adj_matrix_partition_indices,
+               std::vector<uint32_t const*> const& adj_matrix_partition_local_indices,
                std::vector<weight_t const*> const& adj_matrix_partition_weights,
+               std::vector<vertex_t const*> const& adj_matrix_partition_dcs_nzd_vertices,
+               std::vector<vertex_t> const& adj_matrix_partition_dcs_nzd_vertex_counts,
+               std::vector<vertex_t> const& adj_matrix_partition_major_hypersparse_firsts,
                std::vector<vertex_t> const& vertex_partition_segment_offsets,
                partition_t<vertex_t> const& partition,
                vertex_t number_of_vertices,
@@ -478,6 +537,105 @@ class graph_view_t<vertex_t,
              : static_cast<weight_t const*>(nullptr);
   }
 
+  // FIXME: this function is not part of the public stable API. This function is mainly for pattern
+  // accelerator implementation. If the local minor range fits in 32 bits and vertex_t is wider than
+  // 32 bits, minors are stored as 32 bit offsets from the local adjacency matrix partition's minor
+  // first (and indices() returns nullptr); returns nullptr otherwise.
+  uint32_t const* local_indices(size_t adj_matrix_partition_idx) const
+  {
+    return adj_matrix_partition_local_indices_.size() > 0
+             ? adj_matrix_partition_local_indices_[adj_matrix_partition_idx]
+             : static_cast<uint32_t const*>(nullptr);
+  }
+
+  // FIXME: this function is not part of the public stable API. This function is mainly for pattern
+  // accelerator implementation. Majors in [major_hypersparse_first, major_last) are stored in DCSR
+  // (or DCSC) format; offsets() covers the majors in [major_first, major_hypersparse_first)
+  // followed by the (non-zero local degree) majors in dcs_nzd_vertices() (returns nullptr if the
+  // adjacency matrix partition does not have a hypersparse segment).
+  vertex_t const* dcs_nzd_vertices(size_t adj_matrix_partition_idx) const
+  {
+    return adj_matrix_partition_dcs_nzd_vertices_.size() > 0
+             ? adj_matrix_partition_dcs_nzd_vertices_[adj_matrix_partition_idx]
+             : static_cast<vertex_t const*>(nullptr);
+  }
+
+  vertex_t get_local_adj_matrix_partition_dcs_nzd_vertex_count(
+    size_t adj_matrix_partition_idx) const
+  {
+    return adj_matrix_partition_dcs_nzd_vertex_counts_.size() > 0
+             ? adj_matrix_partition_dcs_nzd_vertex_counts_[adj_matrix_partition_idx]
+             : vertex_t{0};
+  }
+
+  vertex_t get_local_adj_matrix_partition_major_hypersparse_first(
+    size_t adj_matrix_partition_idx) const
+  {
+    return adj_matrix_partition_major_hypersparse_firsts_.size() > 0
+             ? adj_matrix_partition_major_hypersparse_firsts_[adj_matrix_partition_idx]
+             : partition_.get_matrix_partition_major_last(adj_matrix_partition_idx);
+  }
+
+  // returns the degree-based segment offsets (relative to the major first) of the adjacency matrix
+  // partition, returns an empty vector if sorted_by_global_degree_within_vertex_partition is false
+  std::vector<vertex_t> get_local_adj_matrix_partition_segment_offsets(
+    size_t adj_matrix_partition_idx) const
+  {
+    auto size_per_partition = detail::num_segments_per_vertex_partition + 1;
+    return vertex_partition_segment_offsets_.size() > 0
+             ? std::vector<vertex_t>(
+                 vertex_partition_segment_offsets_.begin() +
+                   size_per_partition * adj_matrix_partition_idx,
+                 vertex_partition_segment_offsets_.begin() +
+                   size_per_partition * (adj_matrix_partition_idx + 1))
+             : std::vector<vertex_t>{};
+  }
+
+  // returns a view of the same (weighted) graph with different edge weights;
+  // adj_matrix_partition_weights[i] should point to
+  // get_number_of_local_adj_matrix_partition_edges(i) weights in the same order as weights(i)
+  graph_view_t with_weights(std::vector<weight_t const*> const& adj_matrix_partition_weights) const
+  {
+    CUGRAPH_EXPECTS(this->is_weighted(), "Invalid input argument: the graph should be weighted.");
+    CUGRAPH_EXPECTS(adj_matrix_partition_weights.size() == adj_matrix_partition_offsets_.size(),
+                    "Invalid input argument: adj_matrix_partition_weights.size() should coincide "
+                    "with the number of local adjacency matrix partitions.");
+    auto ret                          = *this;
+    ret.adj_matrix_partition_weights_ = adj_matrix_partition_weights;
+    ret.property_cache_               = nullptr;
+    return ret;
+  }
+
+  // returns a view of the same graph with only the edges whose bits are set in the edge masks
+  // visible to the pattern accelerators (and the algorithms built on them); bit j % 32 of
+  // adj_matrix_partition_edge_masks[i][j / 32] is the bit for the edge at offset j (in the same
+  // order as indices(i)) of the i'th local adjacency matrix partition. Passing an empty vector
+  // returns a view without edge masks. The masks (see edge_mask.cuh) should outlive the view.
+  graph_view_t with_edge_mask(
+    std::vector<uint32_t const*> const& adj_matrix_partition_edge_masks) const
+  {
+    CUGRAPH_EXPECTS(
+      (adj_matrix_partition_edge_masks.size() == 0) ||
+        (adj_matrix_partition_edge_masks.size() == adj_matrix_partition_offsets_.size()),
+      "Invalid input argument: adj_matrix_partition_edge_masks.size() should be 0 or coincide with "
+      "the number of local adjacency matrix partitions.");
+    auto ret                             = *this;
+    ret.adj_matrix_partition_edge_masks_ = adj_matrix_partition_edge_masks;
+    ret.property_cache_                  = nullptr;
+    return ret;
+  }
+
+  bool has_edge_mask() const { return adj_matrix_partition_edge_masks_.size() > 0; }
+
+  // FIXME: this function is not part of the public stable API. This function is mainly for pattern
+  // accelerator implementation. Returns nullptr if the view does not have edge masks.
+  uint32_t const* edge_mask(size_t adj_matrix_partition_idx) const
+  {
+    return adj_matrix_partition_edge_masks_.size() > 0
+             ? adj_matrix_partition_edge_masks_[adj_matrix_partition_idx]
+             : static_cast<uint32_t const*>(nullptr);
+  }
+
   rmm::device_uvector<edge_t> compute_in_degrees(raft::handle_t const& handle) const;
   rmm::device_uvector<edge_t> compute_out_degrees(raft::handle_t const& handle) const;
 
@@ -490,11 +648,109 @@ class graph_view_t<vertex_t,
   weight_t compute_max_in_weight_sum(raft::handle_t const& handle) const;
   weight_t compute_max_out_weight_sum(raft::handle_t const& handle) const;
 
+  // ratio of the maximum to the mean number of edges stored in a GPU (1.0 if the graph has no
+  // edge), the edge (and work) imbalance of the 2D partitioning, this imbalance is determined by
+  // the vertex to GPU mapping used in shuffling the input edges (hashing, or hashing with the hub
+  // vertices assigned by compute_edge_balanced_hub_gpu_ids) and the degree distribution
+  double compute_edge_partition_imbalance(raft::handle_t const& handle) const;
+
+  // cached versions of the compute_*() functions above: the properties are computed on the first
+  // call and cached (in the cache shared by the graph_t object this view is created from and all
+  // its views, views not created from a graph_t object cache in their own cache), the returned
+  // vectors are valid while this view (or any other view sharing the cache) is alive. In
+  // multi-GPU, the first call for each property is a collective operation.
+  edge_t const* get_in_degrees(raft::handle_t const& handle) const
+  {
+    auto& cache = get_property_cache();
+    return detail::get_or_compute_graph_property(
+             handle, cache.mutex, cache.in_degrees, [this, &handle]() {
+               return compute_in_degrees(handle);
+             })
+      .data();
+  }
+  edge_t const* get_out_degrees(raft::handle_t const& handle) const
+  {
+    auto& cache = get_property_cache();
+    return detail::get_or_compute_graph_property(
+             handle, cache.mutex, cache.out_degrees, [this, &handle]() {
+               return compute_out_degrees(handle);
+             })
+      .data();
+  }
+
+  weight_t const* get_in_weight_sums(raft::handle_t const& handle) const
+  {
+    auto& cache = get_property_cache();
+    return detail::get_or_compute_graph_property(
+             handle, cache.mutex, cache.in_weight_sums, [this, &handle]() {
+               return compute_in_weight_sums(handle);
+             })
+      .data();
+  }
+  weight_t const* get_out_weight_sums(raft::handle_t const& handle) const
+  {
+    auto& cache = get_property_cache();
+    return detail::get_or_compute_graph_property(
+             handle, cache.mutex, cache.out_weight_sums, [this, &handle]() {
+               return compute_out_weight_sums(handle);
+             })
+      .data();
+  }
+
+  edge_t get_max_in_degree(raft::handle_t const& handle) const
+  {
+    auto& cache = get_property_cache();
+    return detail::get_or_compute_graph_property(
+      handle, cache.mutex, cache.max_in_degree, [this, &handle]() {
+        return compute_max_in_degree(handle);
+      });
+  }
+  edge_t get_max_out_degree(raft::handle_t const& handle) const
+  {
+    auto& cache = get_property_cache();
+    return detail::get_or_compute_graph_property(
+      handle, cache.mutex, cache.max_out_degree, [this, &handle]() {
+        return compute_max_out_degree(handle);
+      });
+  }
+
+  weight_t get_max_in_weight_sum(raft::handle_t const& handle) const
+  {
+    auto& cache = get_property_cache();
+    return detail::get_or_compute_graph_property(
+      handle, cache.mutex, cache.max_in_weight_sum, [this, &handle]() {
+        return compute_max_in_weight_sum(handle);
+      });
+  }
+  weight_t get_max_out_weight_sum(raft::handle_t const& handle) const
+  {
+    auto& cache = get_property_cache();
+    return detail::get_or_compute_graph_property(
+      handle, cache.mutex, cache.max_out_weight_sum, [this, &handle]() {
+        return compute_max_out_weight_sum(handle);
+      });
+  }
+
+  // returns a view of a copy of this graph storing the adjacency matrix in the other (transposed if
+  // store_transposed is false and non-transposed otherwise) form, the copy is constructed on the
+  // first call (a collective operation in multi-GPU) and cached as above, this function throws if
+  // this graph view has an edge mask
+  graph_view_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu>
+  get_transposed_storage_view(raft::handle_t const& handle) const;
+
  private:
   std::vector<edge_t const*> adj_matrix_partition_offsets_{};
   std::vector<vertex_t const*> adj_matrix_partition_indices_{};
+  std::vector<uint32_t const*> adj_matrix_partition_local_indices_{};  // size 0 if not compressed
   std::vector<weight_t const*> adj_matrix_partition_weights_{};
   std::vector<edge_t> adj_matrix_partition_number_of_edges_{};
+  std::vector<uint32_t const*> adj_matrix_partition_edge_masks_{};  // size 0 if not masked
+
+  // relevant only if we use the DCSR (or DCSC) format for the hypersparse (low local degree)
+  // segments, size 0 otherwise
+  std::vector<vertex_t const*> adj_matrix_partition_dcs_nzd_vertices_{};
+  std::vector<vertex_t> adj_matrix_partition_dcs_nzd_vertex_counts_{};
+  std::vector<vertex_t> adj_matrix_partition_major_hypersparse_firsts_{};
 
   partition_t<vertex_t> partition_{};
 
@@ -502,6 +758,29 @@ class graph_view_t<vertex_t,
     vertex_partition_segment_offsets_{};  // segment offsets within the vertex partition based on
                                           // vertex degree, relevant only if
                                           // sorted_by_global_degree_within_vertex_partition is true
+
+  // the cache of a view not created from a graph_t object is created on first use (atomically, as
+  // algorithm calls running concurrently on the same view can race here)
+  detail::graph_property_cache_t<vertex_t, edge_t, weight_t>& get_property_cache() const
+  {
+    auto cache = std::atomic_load(&property_cache_);
+    if (!cache) {
+      auto new_cache =
+        std::make_shared<detail::graph_property_cache_t<vertex_t, edge_t, weight_t>>();
+      if (std::atomic_compare_exchange_strong(&property_cache_, &cache, new_cache)) {
+        cache = new_cache;
+      }
+    }
+    return *cache;
+  }
+
+  // set by graph_t::view(), reset by with_weights() and with_edge_mask() (as the degrees and
+  // weight sums differ)
+  mutable std::shared_ptr<detail::graph_property_cache_t<vertex_t, edge_t, weight_t>>
+    property_cache_{};
+
+  template <typename, typename, typename, bool, bool, typename>
+  friend class graph_t;
 };
 
 // single-GPU version
@@ -630,6 +909,56 @@ class graph_view_t<vertex_t,
   // private.
   weight_t const* weights() const { return weights_; }
 
+  // returns the degree-based segment offsets, returns an empty vector if sorted_by_degree is false
+  std::vector<vertex_t> get_local_adj_matrix_partition_segment_offsets(
+    size_t adj_matrix_partition_idx) const
+  {
+    assert(adj_matrix_partition_idx == 0);
+    return segment_offsets_;
+  }
+
+  // returns a view of the same (weighted) graph with different edge weights;
+  // adj_matrix_partition_weights[0] should point to get_number_of_edges() weights in the same
+  // order as weights()
+  graph_view_t with_weights(std::vector<weight_t const*> const& adj_matrix_partition_weights) const
+  {
+    CUGRAPH_EXPECTS(this->is_weighted(), "Invalid input argument: the graph should be weighted.");
+    CUGRAPH_EXPECTS(adj_matrix_partition_weights.size() == size_t{1},
+                    "Invalid input argument: adj_matrix_partition_weights.size() should be 1.");
+    auto ret            = *this;
+    ret.weights_        = adj_matrix_partition_weights[0];
+    ret.property_cache_ = nullptr;
+    return ret;
+  }
+
+  // returns a view of the same graph with only the edges whose bits are set in the edge mask
+  // visible to the pattern accelerators (and the algorithms built on them); bit j % 32 of
+  // adj_matrix_partition_edge_masks[0][j / 32] is the bit for the edge at offset j (in the same
+  // order as indices()). Passing an empty vector returns a view without an edge mask. The mask
+  // (see edge_mask.cuh) should outlive the view.
+  graph_view_t with_edge_mask(
+    std::vector<uint32_t const*> const& adj_matrix_partition_edge_masks) const
+  {
+    CUGRAPH_EXPECTS(adj_matrix_partition_edge_masks.size() <= size_t{1},
+                    "Invalid input argument: adj_matrix_partition_edge_masks.size() should be 0 "
+                    "or 1.");
+    auto ret       = *this;
+    ret.edge_mask_ = adj_matrix_partition_edge_masks.size() > 0
+                       ? adj_matrix_partition_edge_masks[0]
+                       : static_cast<uint32_t const*>(nullptr);
+    ret.property_cache_ = nullptr;
+    return ret;
+  }
+
+  bool has_edge_mask() const { return edge_mask_ != nullptr; }
+
+  // private.
+  uint32_t const* edge_mask(size_t adj_matrix_partition_idx) const
+  {
+    assert(adj_matrix_partition_idx == 0);
+    return edge_mask_;
+  }
+
   rmm::device_uvector<edge_t> compute_in_degrees(raft::handle_t const& handle) const;
   rmm::device_uvector<edge_t> compute_out_degrees(raft::handle_t const& handle) const;
 
@@ -642,13 +971,124 @@ class graph_view_t<vertex_t,
   weight_t compute_max_in_weight_sum(raft::handle_t const& handle) const;
   weight_t compute_max_out_weight_sum(raft::handle_t const& handle) const;
 
+  // always 1.0 (every edge is stored in the single GPU)
+  double compute_edge_partition_imbalance(raft::handle_t const& handle) const { return 1.0; }
+
+  // cached versions of the compute_*() functions above: the properties are computed on the first
+  // call and cached (in the cache shared by the graph_t object this view is created from and all
+  // its views, views not created from a graph_t object cache in their own cache), the returned
+  // vectors are valid while this view (or any other view sharing the cache) is alive. In
+  // multi-GPU, the first call for each property is a collective operation.
+  edge_t const* get_in_degrees(raft::handle_t const& handle) const
+  {
+    auto& cache = get_property_cache();
+    return detail::get_or_compute_graph_property(
+             handle, cache.mutex, cache.in_degrees, [this, &handle]() {
+               return compute_in_degrees(handle);
+             })
+      .data();
+  }
+  edge_t const* get_out_degrees(raft::handle_t const& handle) const
+  {
+    auto& cache = get_property_cache();
+    return detail::get_or_compute_graph_property(
+             handle, cache.mutex, cache.out_degrees, [this, &handle]() {
+               return compute_out_degrees(handle);
+             })
+      .data();
+  }
+
+  weight_t const* get_in_weight_sums(raft::handle_t const& handle) const
+  {
+    auto& cache = get_property_cache();
+    return detail::get_or_compute_graph_property(
+             handle, cache.mutex, cache.in_weight_sums, [this, &handle]() {
+               return compute_in_weight_sums(handle);
+             })
+      .data();
+  }
+  weight_t const* get_out_weight_sums(raft::handle_t const& handle) const
+  {
+    auto& cache = get_property_cache();
+    return detail::get_or_compute_graph_property(
+             handle, cache.mutex, cache.out_weight_sums, [this, &handle]() {
+               return compute_out_weight_sums(handle);
+             })
+      .data();
+  }
+
+  edge_t get_max_in_degree(raft::handle_t const& handle) const
+  {
+    auto& cache = get_property_cache();
+    return detail::get_or_compute_graph_property(
+      handle, cache.mutex, cache.max_in_degree, [this, &handle]() {
+        return compute_max_in_degree(handle);
+      });
+  }
+  edge_t get_max_out_degree(raft::handle_t const& handle) const
+  {
+    auto& cache = get_property_cache();
+    return detail::get_or_compute_graph_property(
+      handle, cache.mutex, cache.max_out_degree, [this, &handle]() {
+        return compute_max_out_degree(handle);
+      });
+  }
+
+  weight_t get_max_in_weight_sum(raft::handle_t const& handle) const
+  {
+    auto& cache = get_property_cache();
+    return detail::get_or_compute_graph_property(
+      handle, cache.mutex, cache.max_in_weight_sum, [this, &handle]() {
+        return compute_max_in_weight_sum(handle);
+      });
+  }
+  weight_t get_max_out_weight_sum(raft::handle_t const& handle) const
+  {
+    auto& cache = get_property_cache();
+    return detail::get_or_compute_graph_property(
+      handle, cache.mutex, cache.max_out_weight_sum, [this, &handle]() {
+        return compute_max_out_weight_sum(handle);
+      });
+  }
+
+  // returns a view of a copy of this graph storing the adjacency matrix in the other (transposed if
+  // store_transposed is false and non-transposed otherwise) form, the copy is constructed on the
+  // first call (a collective operation in multi-GPU) and cached as above, this function throws if
+  // this graph view has an edge mask
+  graph_view_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu>
+  get_transposed_storage_view(raft::handle_t const& handle) const;
+
  private:
   edge_t const* offsets_{nullptr};
   vertex_t const* indices_{nullptr};
   weight_t const* weights_{nullptr};
+  uint32_t const* edge_mask_{nullptr};
 
   std::vector<vertex_t> segment_offsets_{};  // segment offsets based on vertex degree, relevant
                                              // only if sorted_by_global_degree is true
+
+  // the cache of a view not created from a graph_t object is created on first use (atomically, as
+  // algorithm calls running concurrently on the same view can race here)
+  detail::graph_property_cache_t<vertex_t, edge_t, weight_t>& get_property_cache() const
+  {
+    auto cache = std::atomic_load(&property_cache_);
+    if (!cache) {
+      auto new_cache =
+        std::make_shared<detail::graph_property_cache_t<vertex_t, edge_t, weight_t>>();
+      if (std::atomic_compare_exchange_strong(&property_cache_, &cache, new_cache)) {
+        cache = new_cache;
+      }
+    }
+    return *cache;
+  }
+
+  // set by graph_t::view(), reset by with_weights() and with_edge_mask() (as the degrees and
+  // weight sums differ)
+  mutable std::shared_ptr<detail::graph_property_cache_t<vertex_t, edge_t, weight_t>>
+    property_cache_{};
+
+  template <typename, typename, typename, bool, bool, typename>
+  friend class graph_t;
 };
 
 }  // namespace experimental
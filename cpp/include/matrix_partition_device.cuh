@@ -18,52 +18,192 @@
 #include <experimental/graph_view.hpp>
 #include <utilities/error.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/tuple.h>
 
+#include <cstdint>
+#include <limits>
 #include <type_traits>
 
 namespace cugraph {
 namespace experimental {
 
+namespace detail {
+
+// decodes the (edge offset) -> minor mapping; minors are stored either as global vertex IDs
+// (indices) or as 32 bit offsets from minor_first (local_indices, if not nullptr)
+template <typename vertex_t, typename edge_t>
+struct minor_index_decoder_t {
+  vertex_t const* indices{nullptr};
+  uint32_t const* local_indices{nullptr};
+  vertex_t minor_first{0};
+
+  __device__ vertex_t operator()(edge_t i) const
+  {
+    return local_indices != nullptr ? minor_first + static_cast<vertex_t>(local_indices[i])
+                                    : indices[i];
+  }
+};
+
+}  // namespace detail
+
+// random access iterator over the minors of a neighbor list (returned by get_local_edges())
+template <typename vertex_t, typename edge_t>
+using minor_index_iterator_t =
+  thrust::transform_iterator<detail::minor_index_decoder_t<vertex_t, edge_t>,
+                             thrust::counting_iterator<edge_t>>;
+
 template <typename vertex_t, typename edge_t, typename weight_t>
 class matrix_partition_device_base_t {
  public:
   matrix_partition_device_base_t(edge_t const* offsets,
                                  vertex_t const* indices,
                                  weight_t const* weights,
-                                 edge_t number_of_edges)
-    : offsets_(offsets), indices_(indices), weights_(weights), number_of_edges_(number_of_edges)
+                                 edge_t number_of_edges,
+                                 uint32_t const* edge_mask = nullptr)
+    : offsets_(offsets),
+      minor_index_decoder_{indices, nullptr, vertex_t{0}},
+      weights_(weights),
+      number_of_edges_(number_of_edges),
+      edge_mask_(edge_mask)
+  {
+  }
+
+  // majors in [major_hypersparse_first, major_last) are stored in DCSR (or DCSC) format; only the
+  // majors with non-zero local degrees (dcs_nzd_vertices) appear in offsets. If local_indices is
+  // not nullptr, minors are stored as 32 bit offsets from minor_first (and indices is ignored). If
+  // edge_mask is not nullptr, only the edges with the mask bits set are active.
+  matrix_partition_device_base_t(edge_t const* offsets,
+                                 vertex_t const* indices,
+                                 uint32_t const* local_indices,
+                                 weight_t const* weights,
+                                 edge_t number_of_edges,
+                                 vertex_t const* dcs_nzd_vertices,
+                                 vertex_t dcs_nzd_vertex_count,
+                                 vertex_t major_first,
+                                 vertex_t major_hypersparse_first,
+                                 vertex_t minor_first,
+                                 uint32_t const* edge_mask = nullptr)
+    : offsets_(offsets),
+      minor_index_decoder_{indices, local_indices, minor_first},
+      weights_(weights),
+      number_of_edges_(number_of_edges),
+      edge_mask_(edge_mask),
+      dcs_nzd_vertices_(dcs_nzd_vertices),
+      dcs_nzd_vertex_count_(dcs_nzd_vertex_count),
+      dcs_major_first_(major_first),
+      major_hypersparse_first_offset_(major_hypersparse_first - major_first)
   {
   }
 
   __host__ __device__ edge_t get_number_of_edges() const { return number_of_edges_; }
 
-  __device__ thrust::tuple<vertex_t const*, weight_t const*, edge_t> get_local_edges(
-    vertex_t major_offset) const noexcept
+  // offsets of the majors in [major_first, major_hypersparse_first) followed by the offsets of the
+  // majors in dcs_nzd_vertices (size = the number of the compressed majors + 1)
+  __host__ __device__ edge_t const* get_offsets() const noexcept { return offsets_; }
+
+  // minors are stored either in indices or (as 32 bit offsets from minor_first) in local_indices,
+  // the other is nullptr
+  __host__ __device__ vertex_t const* get_indices() const noexcept
+  {
+    return minor_index_decoder_.local_indices == nullptr ? minor_index_decoder_.indices : nullptr;
+  }
+
+  __host__ __device__ uint32_t const* get_local_indices() const noexcept
+  {
+    return minor_index_decoder_.local_indices;
+  }
+
+  __host__ __device__ weight_t const* get_weights() const noexcept { return weights_; }
+
+  __host__ __device__ uint32_t const* get_edge_mask() const noexcept { return edge_mask_; }
+
+  // false if the edge at edge_offset is masked out (see graph_view_t::with_edge_mask()); the
+  // pattern accelerators skip inactive edges
+  __device__ bool is_edge_active(edge_t edge_offset) const noexcept
+  {
+    return (edge_mask_ == nullptr) ||
+           ((edge_mask_[edge_offset / 32] & (uint32_t{1} << (edge_offset % 32))) != 0);
+  }
+
+  // minor of the edge at edge_offset (edge offsets follow the compressed sparse order)
+  __device__ vertex_t get_minor_nocheck(edge_t edge_offset) const noexcept
   {
-    auto edge_offset  = *(offsets_ + major_offset);
-    auto local_degree = *(offsets_ + (major_offset + 1)) - edge_offset;
-    auto indices      = indices_ + edge_offset;
+    return minor_index_decoder_(edge_offset);
+  }
+
+  __device__ thrust::tuple<minor_index_iterator_t<vertex_t, edge_t>, weight_t const*, edge_t>
+  get_local_edges(vertex_t major_offset) const noexcept
+  {
+    bool nonzero{true};
+    auto idx          = get_compressed_major_idx(major_offset, nonzero);
+    auto edge_offset  = *(offsets_ + idx);
+    auto local_degree = nonzero ? *(offsets_ + (idx + 1)) - edge_offset : edge_t{0};
+    auto indices      = minor_index_iterator_t<vertex_t, edge_t>(
+      thrust::make_counting_iterator(edge_offset), minor_index_decoder_);
     auto weights      = weights_ != nullptr ? weights_ + edge_offset : nullptr;
     return thrust::make_tuple(indices, weights, local_degree);
   }
 
   __device__ edge_t get_local_degree(vertex_t major_offset) const noexcept
   {
-    return *(offsets_ + (major_offset + 1)) - *(offsets_ + major_offset);
+    bool nonzero{true};
+    auto idx = get_compressed_major_idx(major_offset, nonzero);
+    return nonzero ? *(offsets_ + (idx + 1)) - *(offsets_ + idx) : edge_t{0};
   }
 
   __device__ edge_t get_local_offset(vertex_t major_offset) const noexcept
   {
-    return *(offsets_ + major_offset);
+    bool nonzero{true};
+    return *(offsets_ + get_compressed_major_idx(major_offset, nonzero));
+  }
+
+  __host__ __device__ vertex_t const* get_dcs_nzd_vertices() const noexcept
+  {
+    return dcs_nzd_vertices_;
+  }
+
+  __host__ __device__ vertex_t get_dcs_nzd_vertex_count() const noexcept
+  {
+    return dcs_nzd_vertex_count_;
+  }
+
+  __host__ __device__ vertex_t get_major_hypersparse_first_offset() const noexcept
+  {
+    return major_hypersparse_first_offset_;
   }
 
  private:
+  // FIXME: binary search per query; kernels iterating over the entire hypersparse segment may
+  // better directly iterate over dcs_nzd_vertices_ to skip zero local degree majors.
+  __device__ vertex_t get_compressed_major_idx(vertex_t major_offset, bool& nonzero) const noexcept
+  {
+    if (major_offset < major_hypersparse_first_offset_) {
+      nonzero = true;
+      return major_offset;
+    } else {
+      auto major = dcs_major_first_ + major_offset;
+      auto it    = thrust::lower_bound(
+        thrust::seq, dcs_nzd_vertices_, dcs_nzd_vertices_ + dcs_nzd_vertex_count_, major);
+      nonzero = (it != dcs_nzd_vertices_ + dcs_nzd_vertex_count_) && (*it == major);
+      return major_hypersparse_first_offset_ + static_cast<vertex_t>(it - dcs_nzd_vertices_);
+    }
+  }
+
   // should be trivially copyable to device
   edge_t const* offsets_{nullptr};
-  vertex_t const* indices_{nullptr};
+  detail::minor_index_decoder_t<vertex_t, edge_t> minor_index_decoder_{};
   weight_t const* weights_{nullptr};
   edge_t number_of_edges_{0};
+  uint32_t const* edge_mask_{nullptr};
+
+  vertex_t const* dcs_nzd_vertices_{nullptr};
+  vertex_t dcs_nzd_vertex_count_{0};
+  vertex_t dcs_major_first_{0};
+  vertex_t major_hypersparse_first_offset_{std::numeric_limits<vertex_t>::max()};
 };
 
 template <typename GraphViewType, typename Enable = void>
@@ -82,8 +222,19 @@ class matrix_partition_device_t<GraphViewType, std::enable_if_t<GraphViewType::i
                                      typename GraphViewType::weight_type>(
         graph_view.offsets(partition_idx),
         graph_view.indices(partition_idx),
+        graph_view.local_indices(partition_idx),
         graph_view.weights(partition_idx),
-        graph_view.get_number_of_local_adj_matrix_partition_edges(partition_idx)),
+        graph_view.get_number_of_local_adj_matrix_partition_edges(partition_idx),
+        graph_view.dcs_nzd_vertices(partition_idx),
+        graph_view.get_local_adj_matrix_partition_dcs_nzd_vertex_count(partition_idx),
+        GraphViewType::is_adj_matrix_transposed
+          ? graph_view.get_local_adj_matrix_partition_col_first(partition_idx)
+          : graph_view.get_local_adj_matrix_partition_row_first(partition_idx),
+        graph_view.get_local_adj_matrix_partition_major_hypersparse_first(partition_idx),
+        GraphViewType::is_adj_matrix_transposed
+          ? graph_view.get_local_adj_matrix_partition_row_first(partition_idx)
+          : graph_view.get_local_adj_matrix_partition_col_first(partition_idx),
+        graph_view.edge_mask(partition_idx)),
       major_first_(GraphViewType::is_adj_matrix_transposed
                      ? graph_view.get_local_adj_matrix_partition_col_first(partition_idx)
                      : graph_view.get_local_adj_matrix_partition_row_first(partition_idx)),
@@ -186,7 +337,8 @@ class matrix_partition_device_t<GraphViewType, std::enable_if_t<!GraphViewType::
         graph_view.offsets(),
         graph_view.indices(),
         graph_view.weights(),
-        graph_view.get_number_of_edges()),
+        graph_view.get_number_of_edges(),
+        graph_view.edge_mask(partition_idx)),
       number_of_vertices_(graph_view.get_number_of_vertices())
   {
     assert(partition_idx == 0);
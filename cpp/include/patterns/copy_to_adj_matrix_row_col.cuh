@@ -22,16 +22,21 @@
 #include <utilities/device_comm.cuh>
 #include <utilities/error.hpp>
 #include <utilities/host_scalar_comm.cuh>
+#include <utilities/profiling.hpp>
 #include <utilities/thrust_tuple_utils.cuh>
 #include <vertex_partition_device.cuh>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <raft/handle.hpp>
 
+#include <thrust/binary_search.h>
 #include <thrust/copy.h>
 #include <thrust/execution_policy.h>
 #include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scatter.h>
 
 #include <numeric>
 #include <type_traits>
@@ -48,8 +53,13 @@ template <typename GraphViewType,
 void copy_to_matrix_major(raft::handle_t const& handle,
                           GraphViewType const& graph_view,
                           VertexValueInputIterator vertex_value_input_first,
-                          MatrixMajorValueOutputIterator matrix_major_value_output_first)
+                          MatrixMajorValueOutputIterator matrix_major_value_output_first,
+                          size_t num_columns = 1)
 {
+  profile_range_t profile_range(handle,
+                                GraphViewType::is_adj_matrix_transposed ? "copy_to_adj_matrix_col"
+                                                                        : "copy_to_adj_matrix_row");
+
   if (GraphViewType::is_multi_gpu) {
     auto& comm               = handle.get_comms();
     auto const comm_rank     = comm.get_rank();
@@ -63,7 +73,9 @@ void copy_to_matrix_major(raft::handle_t const& handle,
     std::vector<size_t> rx_counts(col_comm_size, size_t{0});
     std::vector<size_t> displacements(col_comm_size, size_t{0});
     for (int i = 0; i < col_comm_size; ++i) {
-      rx_counts[i]     = graph_view.get_vertex_partition_size(i * row_comm_size + row_comm_rank);
+      rx_counts[i] = static_cast<size_t>(
+                       graph_view.get_vertex_partition_size(i * row_comm_size + row_comm_rank)) *
+                     num_columns;
       displacements[i] = (i == 0) ? 0 : displacements[i - 1] + rx_counts[i - 1];
     }
     device_allgatherv(col_comm,
@@ -78,7 +90,8 @@ void copy_to_matrix_major(raft::handle_t const& handle,
              : graph_view.get_number_of_local_adj_matrix_partition_rows());
     thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
                  vertex_value_input_first,
-                 vertex_value_input_first + graph_view.get_number_of_local_vertices(),
+                 vertex_value_input_first +
+                   static_cast<size_t>(graph_view.get_number_of_local_vertices()) * num_columns,
                  matrix_major_value_output_first);
   }
 }
@@ -94,6 +107,10 @@ void copy_to_matrix_major(raft::handle_t const& handle,
                           VertexValueInputIterator vertex_value_input_first,
                           MatrixMajorValueOutputIterator matrix_major_value_output_first)
 {
+  profile_range_t profile_range(handle,
+                                GraphViewType::is_adj_matrix_transposed ? "copy_to_adj_matrix_col"
+                                                                        : "copy_to_adj_matrix_row");
+
   using vertex_t = typename GraphViewType::vertex_type;
 
   if (GraphViewType::is_multi_gpu) {
@@ -110,67 +127,82 @@ void copy_to_matrix_major(raft::handle_t const& handle,
       host_scalar_allgather(col_comm,
                             static_cast<size_t>(thrust::distance(vertex_first, vertex_last)),
                             handle.get_stream());
+    std::vector<size_t> displacements(col_comm_size, size_t{0});
+    std::partial_sum(rx_counts.begin(), rx_counts.end() - 1, displacements.begin() + 1);
+    auto rx_size = displacements.back() + rx_counts.back();
 
+    std::vector<vertex_t> h_major_firsts(col_comm_size);
+    std::vector<vertex_t> h_major_value_start_offsets(col_comm_size);
     for (int i = 0; i < col_comm_size; ++i) {
       matrix_partition_device_t<GraphViewType> matrix_partition(graph_view, i);
-
-      rmm::device_uvector<vertex_t> rx_vertices(col_comm_rank == i ? size_t{0} : rx_counts[i],
-                                                handle.get_stream());
-      auto rx_tmp_buffer = allocate_dataframe_buffer<
-        typename std::iterator_traits<VertexValueInputIterator>::value_type>(rx_counts[i],
-                                                                             handle.get_stream());
-      auto rx_value_first = get_dataframe_buffer_begin<
-        typename std::iterator_traits<VertexValueInputIterator>::value_type>(rx_tmp_buffer);
-
-      if (col_comm_rank == i) {
-        vertex_partition_device_t<GraphViewType> vertex_partition(graph_view);
-        auto map_first =
-          thrust::make_transform_iterator(vertex_first, [vertex_partition] __device__(auto v) {
-            return vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v);
-          });
-        // FIXME: this gather (and temporary buffer) is unnecessary if NCCL directly takes a
-        // permutation iterator (and directly gathers to the internal buffer)
-        thrust::gather(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-                       map_first,
-                       map_first + thrust::distance(vertex_first, vertex_last),
-                       vertex_value_input_first,
-                       rx_value_first);
-      }
-
-      // FIXME: these broadcast operations can be placed between ncclGroupStart() and
-      // ncclGroupEnd()
-      device_bcast(
-        col_comm, vertex_first, rx_vertices.begin(), rx_counts[i], i, handle.get_stream());
-      device_bcast(col_comm, rx_value_first, rx_value_first, rx_counts[i], i, handle.get_stream());
-
-      if (col_comm_rank == i) {
-        auto map_first =
-          thrust::make_transform_iterator(vertex_first, [matrix_partition] __device__(auto v) {
-            return matrix_partition.get_major_offset_from_major_nocheck(v);
-          });
-        // FIXME: this scatter is unnecessary if NCCL directly takes a permutation iterator (and
-        // directly scatters from the internal buffer)
-        thrust::scatter(
-          rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-          rx_value_first,
-          rx_value_first + rx_counts[i],
-          map_first,
-          matrix_major_value_output_first + matrix_partition.get_major_value_start_offset());
-      } else {
-        auto map_first = thrust::make_transform_iterator(
-          rx_vertices.begin(), [matrix_partition] __device__(auto v) {
-            return matrix_partition.get_major_offset_from_major_nocheck(v);
-          });
-        // FIXME: this scatter is unnecessary if NCCL directly takes a permutation iterator (and
-        // directly scatters from the internal buffer)
-        thrust::scatter(
-          rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-          rx_value_first,
-          rx_value_first + rx_counts[i],
-          map_first,
-          matrix_major_value_output_first + matrix_partition.get_major_value_start_offset());
-      }
+      h_major_firsts[i]              = matrix_partition.get_major_first();
+      h_major_value_start_offsets[i] = matrix_partition.get_major_value_start_offset();
     }
+    rmm::device_uvector<size_t> d_displacements(col_comm_size, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_major_firsts(col_comm_size, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_major_value_start_offsets(col_comm_size, handle.get_stream());
+    raft::update_device(
+      d_displacements.data(), displacements.data(), col_comm_size, handle.get_stream());
+    raft::update_device(
+      d_major_firsts.data(), h_major_firsts.data(), col_comm_size, handle.get_stream());
+    raft::update_device(d_major_value_start_offsets.data(),
+                        h_major_value_start_offsets.data(),
+                        col_comm_size,
+                        handle.get_stream());
+
+    rmm::device_uvector<vertex_t> rx_vertices(rx_size, handle.get_stream());
+    auto rx_tmp_buffer = allocate_dataframe_buffer<
+      typename std::iterator_traits<VertexValueInputIterator>::value_type>(rx_size,
+                                                                           handle.get_stream());
+    auto rx_value_first = get_dataframe_buffer_begin<
+      typename std::iterator_traits<VertexValueInputIterator>::value_type>(rx_tmp_buffer);
+
+    // pack the local values directly to this GPU's segment of the receive buffer (the allgatherv
+    // below is in-place for this GPU's segment, so no separate send buffer is necessary)
+    vertex_partition_device_t<GraphViewType> vertex_partition(graph_view);
+    auto map_first =
+      thrust::make_transform_iterator(vertex_first, [vertex_partition] __device__(auto v) {
+        return vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v);
+      });
+    thrust::gather(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   map_first,
+                   map_first + thrust::distance(vertex_first, vertex_last),
+                   vertex_value_input_first,
+                   rx_value_first + displacements[col_comm_rank]);
+
+    // allgatherv batches the col_comm_size broadcasts (one per root) in a single call
+    device_allgatherv(col_comm,
+                      vertex_first,
+                      rx_vertices.begin(),
+                      rx_counts,
+                      displacements,
+                      handle.get_stream());
+    device_allgatherv(col_comm,
+                      rx_value_first + displacements[col_comm_rank],
+                      rx_value_first,
+                      rx_counts,
+                      displacements,
+                      handle.get_stream());
+
+    // unpack the values received from every GPU in a single pass
+    auto unpack_map_first = thrust::make_transform_iterator(
+      thrust::make_counting_iterator(size_t{0}),
+      [rx_vertices               = rx_vertices.data(),
+       displacements             = d_displacements.data(),
+       major_firsts              = d_major_firsts.data(),
+       major_value_start_offsets = d_major_value_start_offsets.data(),
+       num_partitions            = col_comm_size] __device__(auto idx) {
+        auto partition_idx = thrust::distance(
+          displacements + 1,
+          thrust::upper_bound(thrust::seq, displacements + 1, displacements + num_partitions, idx));
+        return major_value_start_offsets[partition_idx] +
+               (rx_vertices[idx] - major_firsts[partition_idx]);
+      });
+    thrust::scatter(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    rx_value_first,
+                    rx_value_first + rx_size,
+                    unpack_map_first,
+                    matrix_major_value_output_first);
   } else {
     assert(graph_view.get_number_of_local_vertices() == GraphViewType::is_adj_matrix_transposed
              ? graph_view.get_number_of_local_adj_matrix_partition_cols()
@@ -190,8 +222,13 @@ template <typename GraphViewType,
 void copy_to_matrix_minor(raft::handle_t const& handle,
                           GraphViewType const& graph_view,
                           VertexValueInputIterator vertex_value_input_first,
-                          MatrixMinorValueOutputIterator matrix_minor_value_output_first)
+                          MatrixMinorValueOutputIterator matrix_minor_value_output_first,
+                          size_t num_columns = 1)
 {
+  profile_range_t profile_range(handle,
+                                GraphViewType::is_adj_matrix_transposed ? "copy_to_adj_matrix_row"
+                                                                        : "copy_to_adj_matrix_col");
+
   if (GraphViewType::is_multi_gpu) {
     auto& comm               = handle.get_comms();
     auto const comm_rank     = comm.get_rank();
@@ -205,7 +242,9 @@ void copy_to_matrix_minor(raft::handle_t const& handle,
     std::vector<size_t> rx_counts(row_comm_size, size_t{0});
     std::vector<size_t> displacements(row_comm_size, size_t{0});
     for (int i = 0; i < row_comm_size; ++i) {
-      rx_counts[i]     = graph_view.get_vertex_partition_size(col_comm_rank * row_comm_size + i);
+      rx_counts[i] = static_cast<size_t>(
+                       graph_view.get_vertex_partition_size(col_comm_rank * row_comm_size + i)) *
+                     num_columns;
       displacements[i] = (i == 0) ? 0 : displacements[i - 1] + rx_counts[i - 1];
     }
     device_allgatherv(row_comm,
@@ -220,7 +259,8 @@ void copy_to_matrix_minor(raft::handle_t const& handle,
              : graph_view.get_number_of_local_adj_matrix_partition_cols());
     thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
                  vertex_value_input_first,
-                 vertex_value_input_first + graph_view.get_number_of_local_vertices(),
+                 vertex_value_input_first +
+                   static_cast<size_t>(graph_view.get_number_of_local_vertices()) * num_columns,
                  matrix_minor_value_output_first);
   }
 }
@@ -236,6 +276,10 @@ void copy_to_matrix_minor(raft::handle_t const& handle,
                           VertexValueInputIterator vertex_value_input_first,
                           MatrixMinorValueOutputIterator matrix_minor_value_output_first)
 {
+  profile_range_t profile_range(handle,
+                                GraphViewType::is_adj_matrix_transposed ? "copy_to_adj_matrix_row"
+                                                                        : "copy_to_adj_matrix_col");
+
   using vertex_t = typename GraphViewType::vertex_type;
 
   if (GraphViewType::is_multi_gpu) {
@@ -252,64 +296,56 @@ void copy_to_matrix_minor(raft::handle_t const& handle,
       host_scalar_allgather(row_comm,
                             static_cast<size_t>(thrust::distance(vertex_first, vertex_last)),
                             handle.get_stream());
+    std::vector<size_t> displacements(row_comm_size, size_t{0});
+    std::partial_sum(rx_counts.begin(), rx_counts.end() - 1, displacements.begin() + 1);
+    auto rx_size = displacements.back() + rx_counts.back();
+
+    rmm::device_uvector<vertex_t> rx_vertices(rx_size, handle.get_stream());
+    auto rx_tmp_buffer = allocate_dataframe_buffer<
+      typename std::iterator_traits<VertexValueInputIterator>::value_type>(rx_size,
+                                                                           handle.get_stream());
+    auto rx_value_first = get_dataframe_buffer_begin<
+      typename std::iterator_traits<VertexValueInputIterator>::value_type>(rx_tmp_buffer);
+
+    // pack the local values directly to this GPU's segment of the receive buffer (the allgatherv
+    // below is in-place for this GPU's segment, so no separate send buffer is necessary)
+    vertex_partition_device_t<GraphViewType> vertex_partition(graph_view);
+    auto map_first =
+      thrust::make_transform_iterator(vertex_first, [vertex_partition] __device__(auto v) {
+        return vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v);
+      });
+    thrust::gather(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   map_first,
+                   map_first + thrust::distance(vertex_first, vertex_last),
+                   vertex_value_input_first,
+                   rx_value_first + displacements[row_comm_rank]);
 
+    // allgatherv batches the row_comm_size broadcasts (one per root) in a single call
+    device_allgatherv(row_comm,
+                      vertex_first,
+                      rx_vertices.begin(),
+                      rx_counts,
+                      displacements,
+                      handle.get_stream());
+    device_allgatherv(row_comm,
+                      rx_value_first + displacements[row_comm_rank],
+                      rx_value_first,
+                      rx_counts,
+                      displacements,
+                      handle.get_stream());
+
+    // unpack the values received from every GPU in a single pass (all the matrix partitions share
+    // the same minor range)
     matrix_partition_device_t<GraphViewType> matrix_partition(graph_view, 0);
-    for (int i = 0; i < row_comm_size; ++i) {
-      rmm::device_uvector<vertex_t> rx_vertices(row_comm_rank == i ? size_t{0} : rx_counts[i],
-                                                handle.get_stream());
-      auto rx_tmp_buffer = allocate_dataframe_buffer<
-        typename std::iterator_traits<VertexValueInputIterator>::value_type>(rx_counts[i],
-                                                                             handle.get_stream());
-      auto rx_value_first = get_dataframe_buffer_begin<
-        typename std::iterator_traits<VertexValueInputIterator>::value_type>(rx_tmp_buffer);
-
-      if (row_comm_rank == i) {
-        vertex_partition_device_t<GraphViewType> vertex_partition(graph_view);
-        auto map_first =
-          thrust::make_transform_iterator(vertex_first, [vertex_partition] __device__(auto v) {
-            return vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v);
-          });
-        // FIXME: this gather (and temporary buffer) is unnecessary if NCCL directly takes a
-        // permutation iterator (and directly gathers to the internal buffer)
-        thrust::gather(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-                       map_first,
-                       map_first + thrust::distance(vertex_first, vertex_last),
-                       vertex_value_input_first,
-                       rx_value_first);
-      }
-
-      // FIXME: these broadcast operations can be placed between ncclGroupStart() and
-      // ncclGroupEnd()
-      device_bcast(
-        row_comm, vertex_first, rx_vertices.begin(), rx_counts[i], i, handle.get_stream());
-      device_bcast(row_comm, rx_value_first, rx_value_first, rx_counts[i], i, handle.get_stream());
-
-      if (row_comm_rank == i) {
-        auto map_first =
-          thrust::make_transform_iterator(vertex_first, [matrix_partition] __device__(auto v) {
-            return matrix_partition.get_minor_offset_from_minor_nocheck(v);
-          });
-        // FIXME: this scatter is unnecessary if NCCL directly takes a permutation iterator (and
-        // directly scatters from the internal buffer)
-        thrust::scatter(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-                        rx_value_first,
-                        rx_value_first + rx_counts[i],
-                        map_first,
-                        matrix_minor_value_output_first);
-      } else {
-        auto map_first = thrust::make_transform_iterator(
-          rx_vertices.begin(), [matrix_partition] __device__(auto v) {
-            return matrix_partition.get_minor_offset_from_minor_nocheck(v);
-          });
-        // FIXME: this scatter is unnecessary if NCCL directly takes a permutation iterator (and
-        // directly scatters from the internal buffer)
-        thrust::scatter(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-                        rx_value_first,
-                        rx_value_first + rx_counts[i],
-                        map_first,
-                        matrix_minor_value_output_first);
-      }
-    }
+    auto unpack_map_first = thrust::make_transform_iterator(
+      rx_vertices.begin(), [matrix_partition] __device__(auto v) {
+        return matrix_partition.get_minor_offset_from_minor_nocheck(v);
+      });
+    thrust::scatter(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    rx_value_first,
+                    rx_value_first + rx_size,
+                    unpack_map_first,
+                    matrix_minor_value_output_first);
   } else {
     assert(graph_view.get_number_of_local_vertices() ==
            graph_view.get_number_of_local_adj_matrix_partition_rows());
@@ -363,6 +399,50 @@ void copy_to_adj_matrix_row(raft::handle_t const& handle,
   }
 }
 
+/**
+ * @brief Copy multi-column vertex property values to the corresponding graph adjacency matrix row
+ * property variables.
+ *
+ * This version fills the entire set of graph adjacency matrix row property values for @p
+ * num_columns property columns. Vertex and adjacency matrix row property values are stored in
+ * row-major dense blocks (the j'th column value of the i'th vertex or row is stored at offset i *
+ * @p num_columns + j). This function is inspired by thrust::copy().
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexValueInputIterator Type of the iterator for vertex properties.
+ * @tparam AdjMatrixRowValueOutputIterator Type of the iterator for graph adjacency matrix row
+ * output property variables.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param num_columns Number of property values per vertex.
+ * @param vertex_value_input_first Iterator pointing to the vertex properties for the first
+ * (inclusive) vertex (assigned to this process in multi-GPU). `vertex_value_input_last` (exclusive)
+ * is deduced as @p vertex_value_input_first + @p graph_view.get_number_of_local_vertices() * @p
+ * num_columns.
+ * @param adj_matrix_row_value_output_first Iterator pointing to the adjacency matrix row output
+ * property variables for the first (inclusive) row (assigned to this process in multi-GPU).
+ * `adj_matrix_row_value_output_last` (exclusive) is deduced as @p adj_matrix_row_value_output_first
+ * + @p graph_view.get_number_of_local_adj_matrix_partition_rows() * @p num_columns.
+ */
+template <typename GraphViewType,
+          typename VertexValueInputIterator,
+          typename AdjMatrixRowValueOutputIterator>
+void copy_to_adj_matrix_row(raft::handle_t const& handle,
+                            GraphViewType const& graph_view,
+                            size_t num_columns,
+                            VertexValueInputIterator vertex_value_input_first,
+                            AdjMatrixRowValueOutputIterator adj_matrix_row_value_output_first)
+{
+  if (GraphViewType::is_adj_matrix_transposed) {
+    copy_to_matrix_minor(
+      handle, graph_view, vertex_value_input_first, adj_matrix_row_value_output_first, num_columns);
+  } else {
+    copy_to_matrix_major(
+      handle, graph_view, vertex_value_input_first, adj_matrix_row_value_output_first, num_columns);
+  }
+}
+
 /**
  * @brief Copy vertex property values to the corresponding graph adjacency matrix row property
  * variables.
@@ -458,6 +538,50 @@ void copy_to_adj_matrix_col(raft::handle_t const& handle,
   }
 }
 
+/**
+ * @brief Copy multi-column vertex property values to the corresponding graph adjacency matrix
+ * column property variables.
+ *
+ * This version fills the entire set of graph adjacency matrix column property values for @p
+ * num_columns property columns. Vertex and adjacency matrix column property values are stored in
+ * row-major dense blocks (the j'th column value of the i'th vertex or column is stored at offset i
+ * * @p num_columns + j). This function is inspired by thrust::copy().
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexValueInputIterator Type of the iterator for vertex properties.
+ * @tparam AdjMatrixColValueOutputIterator Type of the iterator for graph adjacency matrix column
+ * output property variables.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param num_columns Number of property values per vertex.
+ * @param vertex_value_input_first Iterator pointing to the vertex properties for the first
+ * (inclusive) vertex (assigned to this process in multi-GPU). `vertex_value_input_last` (exclusive)
+ * is deduced as @p vertex_value_input_first + @p graph_view.get_number_of_local_vertices() * @p
+ * num_columns.
+ * @param adj_matrix_col_value_output_first Iterator pointing to the adjacency matrix column output
+ * property variables for the first (inclusive) column (assigned to this process in multi-GPU).
+ * `adj_matrix_col_value_output_last` (exclusive) is deduced as @p adj_matrix_col_value_output_first
+ * + @p graph_view.get_number_of_local_adj_matrix_partition_cols() * @p num_columns.
+ */
+template <typename GraphViewType,
+          typename VertexValueInputIterator,
+          typename AdjMatrixColValueOutputIterator>
+void copy_to_adj_matrix_col(raft::handle_t const& handle,
+                            GraphViewType const& graph_view,
+                            size_t num_columns,
+                            VertexValueInputIterator vertex_value_input_first,
+                            AdjMatrixColValueOutputIterator adj_matrix_col_value_output_first)
+{
+  if (GraphViewType::is_adj_matrix_transposed) {
+    copy_to_matrix_major(
+      handle, graph_view, vertex_value_input_first, adj_matrix_col_value_output_first, num_columns);
+  } else {
+    copy_to_matrix_minor(
+      handle, graph_view, vertex_value_input_first, adj_matrix_col_value_output_first, num_columns);
+  }
+}
+
 /**
  * @brief Copy vertex property values to the corresponding graph adjacency matrix column property
  * variables.
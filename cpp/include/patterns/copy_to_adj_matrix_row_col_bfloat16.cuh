@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <patterns/copy_to_adj_matrix_row_col.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/transform.h>
+
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace cugraph {
+namespace experimental {
+
+// bfloat16 values (the upper 16 bits of IEEE 754 single precision values: the same exponent range
+// with an 8 bit significand) stored as raw bits, halves the size of single precision adjacency
+// matrix row & column property values (and the communication volume to fill them in multi-GPU)
+using bfloat16_t = uint16_t;
+
+namespace detail {
+
+// round to nearest even (NaNs stay NaNs)
+struct to_bfloat16_t {
+  template <typename T>
+  __device__ bfloat16_t operator()(T val) const
+  {
+    auto bits = __float_as_uint(static_cast<float>(val));
+    if ((bits & 0x7fffffff) > 0x7f800000) { return static_cast<bfloat16_t>((bits >> 16) | 0x40); }
+    bits += 0x7fff + ((bits >> 16) & 1);
+    return static_cast<bfloat16_t>(bits >> 16);
+  }
+};
+
+template <typename T>
+struct from_bfloat16_t {
+  __device__ T operator()(bfloat16_t val) const
+  {
+    return static_cast<T>(__uint_as_float(static_cast<uint32_t>(val) << 16));
+  }
+};
+
+// an iterative solver reading bfloat16 adjacency matrix row or column values falls back to full
+// precision once its convergence measure falls below this multiple of the tolerance or stops
+// decreasing (the rounding errors bound the convergence measure reachable in reduced precision)
+// FIXME: this value requires tuning
+double constexpr bfloat16_fallback_tolerance_ratio = 1e3;
+
+template <typename T>
+bool fall_back_from_bfloat16(T convergence_measure, T last_convergence_measure, T epsilon)
+{
+  return (convergence_measure < epsilon * static_cast<T>(bfloat16_fallback_tolerance_ratio)) ||
+         (convergence_measure >= last_convergence_measure);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Iterator over the (converted back to @p T) values of a bfloat16 adjacency matrix row or
+ * column property array (e.g. filled by copy_to_adj_matrix_row_bfloat16), can be passed as the
+ * adjacency matrix row or column value input iterator of the patterns (e.g.
+ * copy_v_transform_reduce_in_nbr) to read the half-size values.
+ */
+template <typename T>
+auto make_bfloat16_input_iterator(bfloat16_t const* first)
+{
+  return thrust::make_transform_iterator(first, detail::from_bfloat16_t<T>{});
+}
+
+/**
+ * @brief Copy vertex property values (rounded to bfloat16) to the corresponding graph adjacency
+ * matrix row property variables.
+ *
+ * Reduced precision version of copy_to_adj_matrix_row (filling the entire set of graph adjacency
+ * matrix row property values). The rounded values are communicated as pairs of bytes (the
+ * communicator has no 16 bit data type).
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexValueInputIterator Type of the iterator for (floating point) vertex properties.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param vertex_value_input_first Iterator pointing to the vertex properties for the first
+ * (inclusive) vertex (assigned to this process in multi-GPU). `vertex_value_input_last` (exclusive)
+ * is deduced as @p vertex_value_input_first + @p graph_view.get_number_of_local_vertices().
+ * @param adj_matrix_row_value_output_first Pointer to the adjacency matrix row output property
+ * variables for the first (inclusive) row (assigned to this process in multi-GPU).
+ * `adj_matrix_row_value_output_last` (exclusive) is deduced as @p adj_matrix_row_value_output_first
+ * + @p graph_view.get_number_of_local_adj_matrix_partition_rows().
+ */
+template <typename GraphViewType, typename VertexValueInputIterator>
+void copy_to_adj_matrix_row_bfloat16(raft::handle_t const& handle,
+                                     GraphViewType const& graph_view,
+                                     VertexValueInputIterator vertex_value_input_first,
+                                     bfloat16_t* adj_matrix_row_value_output_first)
+{
+  static_assert(
+    std::is_floating_point<
+      typename std::iterator_traits<VertexValueInputIterator>::value_type>::value,
+    "VertexValueInputIterator should point to floating point values.");
+
+  auto const num_local_vertices = graph_view.get_number_of_local_vertices();
+  if (GraphViewType::is_multi_gpu) {
+    rmm::device_uvector<bfloat16_t> vertex_values(num_local_vertices, handle.get_stream());
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      vertex_value_input_first,
+                      vertex_value_input_first + num_local_vertices,
+                      vertex_values.begin(),
+                      detail::to_bfloat16_t{});
+    copy_to_adj_matrix_row(handle,
+                           graph_view,
+                           sizeof(bfloat16_t),
+                           reinterpret_cast<uint8_t const*>(vertex_values.data()),
+                           reinterpret_cast<uint8_t*>(adj_matrix_row_value_output_first));
+  } else {
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      vertex_value_input_first,
+                      vertex_value_input_first + num_local_vertices,
+                      adj_matrix_row_value_output_first,
+                      detail::to_bfloat16_t{});
+  }
+}
+
+/**
+ * @brief Copy vertex property values (rounded to bfloat16) to the corresponding graph adjacency
+ * matrix column property variables.
+ *
+ * Reduced precision version of copy_to_adj_matrix_col (filling the entire set of graph adjacency
+ * matrix column property values), see copy_to_adj_matrix_row_bfloat16.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexValueInputIterator Type of the iterator for (floating point) vertex properties.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param vertex_value_input_first Iterator pointing to the vertex properties for the first
+ * (inclusive) vertex (assigned to this process in multi-GPU). `vertex_value_input_last` (exclusive)
+ * is deduced as @p vertex_value_input_first + @p graph_view.get_number_of_local_vertices().
+ * @param adj_matrix_col_value_output_first Pointer to the adjacency matrix column output property
+ * variables for the first (inclusive) column (assigned to this process in multi-GPU).
+ * `adj_matrix_col_value_output_last` (exclusive) is deduced as @p adj_matrix_col_value_output_first
+ * + @p graph_view.get_number_of_local_adj_matrix_partition_cols().
+ */
+template <typename GraphViewType, typename VertexValueInputIterator>
+void copy_to_adj_matrix_col_bfloat16(raft::handle_t const& handle,
+                                     GraphViewType const& graph_view,
+                                     VertexValueInputIterator vertex_value_input_first,
+                                     bfloat16_t* adj_matrix_col_value_output_first)
+{
+  static_assert(
+    std::is_floating_point<
+      typename std::iterator_traits<VertexValueInputIterator>::value_type>::value,
+    "VertexValueInputIterator should point to floating point values.");
+
+  auto const num_local_vertices = graph_view.get_number_of_local_vertices();
+  if (GraphViewType::is_multi_gpu) {
+    rmm::device_uvector<bfloat16_t> vertex_values(num_local_vertices, handle.get_stream());
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      vertex_value_input_first,
+                      vertex_value_input_first + num_local_vertices,
+                      vertex_values.begin(),
+                      detail::to_bfloat16_t{});
+    copy_to_adj_matrix_col(handle,
+                           graph_view,
+                           sizeof(bfloat16_t),
+                           reinterpret_cast<uint8_t const*>(vertex_values.data()),
+                           reinterpret_cast<uint8_t*>(adj_matrix_col_value_output_first));
+  } else {
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      vertex_value_input_first,
+                      vertex_value_input_first + num_local_vertices,
+                      adj_matrix_col_value_output_first,
+                      detail::to_bfloat16_t{});
+  }
+}
+
+}  // namespace experimental
+}  // namespace cugraph
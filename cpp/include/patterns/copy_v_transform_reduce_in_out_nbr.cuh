@@ -15,13 +15,17 @@
  */
 #pragma once
 
+#include <experimental/edge_property.cuh>
 #include <experimental/graph_view.hpp>
 #include <matrix_partition_device.cuh>
 #include <patterns/edge_op_utils.cuh>
+#include <patterns/graph_storage_tiles.cuh>
+#include <patterns/kernel_dispatch.cuh>
 #include <patterns/reduce_op.cuh>
 #include <utilities/dataframe_buffer.cuh>
 #include <utilities/device_comm.cuh>
 #include <utilities/error.hpp>
+#include <utilities/profiling.hpp>
 
 #include <raft/cudart_utils.h>
 #include <rmm/thrust_rmm_allocator.h>
@@ -34,15 +38,64 @@
 #include <thrust/type_traits/integer_sequence.h>
 #include <cub/cub.cuh>
 
+#include <algorithm>
+#include <array>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
 namespace cugraph {
 namespace experimental {
 
+/**
+ * @brief CUDA stream and events for overlapping the per matrix partition major value computation
+ * with the reduction of the computed values in multi-GPU copy_v_transform_reduce_in_nbr() and
+ * copy_v_transform_reduce_out_nbr().
+ *
+ * Creating and destroying a CUDA stream and events is not free; iterative algorithms should create
+ * an instance once per run and pass it to every copy_v_transform_reduce_(in|out)_nbr() call in
+ * the iteration loop (the calls create a temporary instance otherwise). An instance should not be
+ * shared by concurrently running calls.
+ */
+class major_reduce_pipeline_streams_t {
+ public:
+  static size_t constexpr num_buffers{2};
+
+  major_reduce_pipeline_streams_t()
+  {
+    CUDA_TRY(cudaStreamCreateWithFlags(&comm_stream_, cudaStreamNonBlocking));
+    for (size_t i = 0; i < num_buffers; ++i) {
+      CUDA_TRY(cudaEventCreateWithFlags(&compute_events_[i], cudaEventDisableTiming));
+      CUDA_TRY(cudaEventCreateWithFlags(&reduce_events_[i], cudaEventDisableTiming));
+    }
+  }
+
+  major_reduce_pipeline_streams_t(major_reduce_pipeline_streams_t const&) = delete;
+  major_reduce_pipeline_streams_t& operator=(major_reduce_pipeline_streams_t const&) = delete;
+
+  ~major_reduce_pipeline_streams_t()
+  {
+    for (size_t i = 0; i < num_buffers; ++i) {
+      cudaEventDestroy(compute_events_[i]);
+      cudaEventDestroy(reduce_events_[i]);
+    }
+    cudaStreamDestroy(comm_stream_);
+  }
+
+  cudaStream_t comm_stream() const { return comm_stream_; }
+  cudaEvent_t compute_event(size_t i) const { return compute_events_[i]; }
+  cudaEvent_t reduce_event(size_t i) const { return reduce_events_[i]; }
+
+ private:
+  cudaStream_t comm_stream_{nullptr};
+  std::array<cudaEvent_t, num_buffers> compute_events_{};
+  std::array<cudaEvent_t, num_buffers> reduce_events_{};
+};
+
 namespace detail {
 
-// FIXME: block size requires tuning
+// the grid size and the thread/warp/block-per-major mapping are selected per degree segment by
+// the kernel dispatch layer (patterns/kernel_dispatch.cuh)
 int32_t constexpr copy_v_transform_reduce_nbr_for_all_block_size = 128;
 
 #if 0
@@ -64,6 +117,7 @@ template <bool update_major,
           typename GraphViewType,
           typename AdjMatrixRowValueInputIterator,
           typename AdjMatrixColValueInputIterator,
+          typename EdgeValueInputIterator,
           typename ResultValueOutputIterator,
           typename EdgeOp,
           typename T>
@@ -73,6 +127,7 @@ __global__ void for_all_major_for_all_nbr_low_degree(
   typename GraphViewType::vertex_type major_last,
   AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
   AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+  EdgeValueInputIterator edge_value_input_first,
   ResultValueOutputIterator result_value_output_first,
   EdgeOp e_op,
   T init /* relevent only if update_major == true */)
@@ -87,7 +142,7 @@ __global__ void for_all_major_for_all_nbr_low_degree(
   auto idx                = static_cast<size_t>(tid);
 
   while (idx < static_cast<size_t>(major_last - major_first)) {
-    vertex_t const* indices{nullptr};
+    minor_index_iterator_t<vertex_t, edge_t> indices{};
     weight_t const* weights{nullptr};
     edge_t local_degree{};
     auto major_offset = major_start_offset + idx;
@@ -97,10 +152,13 @@ __global__ void for_all_major_for_all_nbr_low_degree(
     auto transform_op = [&matrix_partition,
                          &adj_matrix_row_value_input_first,
                          &adj_matrix_col_value_input_first,
+                         &edge_value_input_first,
                          &e_op,
                          major_offset,
                          indices,
                          weights] __device__(auto i) {
+      auto edge_offset = *(indices.base()) + i;
+      if (!matrix_partition.is_edge_active(edge_offset)) { return e_op_result_t{}; }
       auto minor        = indices[i];
       auto weight       = weights != nullptr ? weights[i] : weight_t{1.0};
       auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
@@ -116,16 +174,18 @@ __global__ void for_all_major_for_all_nbr_low_degree(
       auto col_offset = GraphViewType::is_adj_matrix_transposed
                           ? static_cast<vertex_t>(major_offset)
                           : minor_offset;
-      return evaluate_edge_op<GraphViewType,
-                              AdjMatrixRowValueInputIterator,
-                              AdjMatrixColValueInputIterator,
-                              EdgeOp>()
-        .compute(row,
-                 col,
-                 weight,
-                 *(adj_matrix_row_value_input_first + row_offset),
-                 *(adj_matrix_col_value_input_first + col_offset),
-                 e_op);
+      return static_cast<e_op_result_t>(
+        evaluate_edge_op<GraphViewType,
+                         AdjMatrixRowValueInputIterator,
+                         AdjMatrixColValueInputIterator,
+                         EdgeOp>()
+          .compute(row,
+                   col,
+                   weight,
+                   *(adj_matrix_row_value_input_first + row_offset),
+                   *(adj_matrix_col_value_input_first + col_offset),
+                   *(edge_value_input_first + edge_offset),
+                   e_op));
     };
 
     if (update_major) {
@@ -142,6 +202,7 @@ __global__ void for_all_major_for_all_nbr_low_degree(
         thrust::make_counting_iterator(edge_t{0}),
         thrust::make_counting_iterator(local_degree),
         [&matrix_partition, indices, &result_value_output_first, &transform_op] __device__(auto i) {
+          if (!matrix_partition.is_edge_active(*(indices.base()) + i)) { return; }
           auto e_op_result  = transform_op(i);
           auto minor        = indices[i];
           auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
@@ -152,6 +213,8 @@ __global__ void for_all_major_for_all_nbr_low_degree(
     // FIXME: delete this once we verify that the code above is not slower than this.
     e_op_result_t e_op_result_sum{init};  // relevent only if update_major == true
     for (edge_t i = 0; i < local_degree; ++i) {
+      auto edge_offset = *(indices.base()) + i;
+      if (!matrix_partition.is_edge_active(edge_offset)) { continue; }
       auto minor        = indices[i];
       auto weight       = weights != nullptr ? weights[i] : weight_t{1.0};
       auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
@@ -176,6 +239,7 @@ __global__ void for_all_major_for_all_nbr_low_degree(
                                     weight,
                                     *(adj_matrix_row_value_input_first + row_offset),
                                     *(adj_matrix_col_value_input_first + col_offset),
+                                    *(edge_value_input_first + edge_offset),
                                     e_op);
       if (update_major) {
         accumulate_edge_op_result<update_major>(e_op_result_sum, e_op_result);
@@ -194,6 +258,7 @@ template <bool update_major,
           typename GraphViewType,
           typename AdjMatrixRowValueInputIterator,
           typename AdjMatrixColValueInputIterator,
+          typename EdgeValueInputIterator,
           typename ResultValueOutputIterator,
           typename EdgeOp,
           typename T>
@@ -203,6 +268,7 @@ __global__ void for_all_major_for_all_nbr_mid_degree(
   typename GraphViewType::vertex_type major_last,
   AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
   AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+  EdgeValueInputIterator edge_value_input_first,
   ResultValueOutputIterator result_value_output_first,
   EdgeOp e_op,
   T init /* relevent only if update_major == true */)
@@ -219,7 +285,7 @@ __global__ void for_all_major_for_all_nbr_mid_degree(
   auto idx                = static_cast<size_t>(tid / raft::warp_size());
 
   while (idx < static_cast<size_t>(major_last - major_first)) {
-    vertex_t const* indices{nullptr};
+    minor_index_iterator_t<vertex_t, edge_t> indices{};
     weight_t const* weights{nullptr};
     edge_t local_degree{};
     auto major_offset                           = major_start_offset + idx;
@@ -227,6 +293,8 @@ __global__ void for_all_major_for_all_nbr_mid_degree(
     auto e_op_result_sum =
       lane_id == 0 ? init : e_op_result_t{};  // relevent only if update_major == true
     for (edge_t i = lane_id; i < local_degree; i += raft::warp_size) {
+      auto edge_offset = *(indices.base()) + i;
+      if (!matrix_partition.is_edge_active(edge_offset)) { continue; }
       auto minor        = indices[i];
       auto weight       = weights != nullptr ? weights[i] : weight_t{1.0};
       auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
@@ -251,6 +319,7 @@ __global__ void for_all_major_for_all_nbr_mid_degree(
                                     weight,
                                     *(adj_matrix_row_value_input_first + row_offset),
                                     *(adj_matrix_col_value_input_first + col_offset),
+                                    *(edge_value_input_first + edge_offset),
                                     e_op);
       if (update_major) {
         e_op_result_sum = plus_edge_op_result(e_op_result_sum, e_op_result);
@@ -271,6 +340,7 @@ template <bool update_major,
           typename GraphViewType,
           typename AdjMatrixRowValueInputIterator,
           typename AdjMatrixColValueInputIterator,
+          typename EdgeValueInputIterator,
           typename ResultValueOutputIterator,
           typename EdgeOp,
           typename T>
@@ -280,6 +350,7 @@ __global__ void for_all_major_for_all_nbr_high_degree(
   typename GraphViewType::vertex_type major_last,
   AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
   AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+  EdgeValueInputIterator edge_value_input_first,
   ResultValueOutputIterator result_value_output_first,
   EdgeOp e_op,
   T init /* relevent only if update_major == true */)
@@ -293,7 +364,7 @@ __global__ void for_all_major_for_all_nbr_high_degree(
   auto idx                = static_cast<size_t>(blockIdx.x);
 
   while (idx < static_cast<size_t>(major_last - major_first)) {
-    vertex_t const* indices{nullptr};
+    minor_index_iterator_t<vertex_t, edge_t> indices{};
     weight_t const* weights{nullptr};
     edge_t local_degree{};
     auto major_offset                           = major_start_offset + idx;
@@ -301,6 +372,8 @@ __global__ void for_all_major_for_all_nbr_high_degree(
     auto e_op_result_sum =
       threadIdx.x == 0 ? init : e_op_result_t{};  // relevent only if update_major == true
     for (edge_t i = threadIdx.x; i < local_degree; i += blockDim.x) {
+      auto edge_offset = *(indices.base()) + i;
+      if (!matrix_partition.is_edge_active(edge_offset)) { continue; }
       auto minor        = indices[i];
       auto weight       = weights != nullptr ? weights[i] : weight_t{1.0};
       auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
@@ -325,6 +398,7 @@ __global__ void for_all_major_for_all_nbr_high_degree(
                                     weight,
                                     *(adj_matrix_row_value_input_first + row_offset),
                                     *(adj_matrix_col_value_input_first + col_offset),
+                                    *(edge_value_input_first + edge_offset),
                                     e_op);
       if (update_major) {
         e_op_result_sum = plus_edge_op_result(e_op_result_sum, e_op_result);
@@ -343,10 +417,273 @@ __global__ void for_all_major_for_all_nbr_high_degree(
   }
 }
 
+// launch the thread-, warp-, or block-per-major kernel over the major range of the launch
+template <bool update_major,
+          typename GraphViewType,
+          typename AdjMatrixRowValueInputIterator,
+          typename AdjMatrixColValueInputIterator,
+          typename EdgeValueInputIterator,
+          typename ResultValueOutputIterator,
+          typename EdgeOp,
+          typename T>
+void for_all_major_for_all_nbr(raft::handle_t const& handle,
+                               pattern_kernel_launch_t const& launch,
+                               matrix_partition_device_t<GraphViewType> const& matrix_partition,
+                               typename GraphViewType::vertex_type major_first,
+                               AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
+                               AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+                               EdgeValueInputIterator edge_value_input_first,
+                               ResultValueOutputIterator result_value_output_first,
+                               EdgeOp e_op,
+                               T init /* relevent only if update_major == true */)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  pattern_kernel_timer_t timer(handle, launch);
+  // edges in managed memory are processed tile by tile, and every tile is prefetched to the device
+  // before launching the kernel over its majors
+  // FIXME: prefetching the next tile while processing the current tile requires a second stream
+  auto major_offset_first = (major_first - matrix_partition.get_major_first()) +
+                            static_cast<vertex_t>(launch.major_range_first);
+  auto tiles = get_graph_storage_tiles(
+    handle,
+    matrix_partition,
+    major_offset_first,
+    major_offset_first +
+      static_cast<vertex_t>(launch.major_range_last - launch.major_range_first));
+  for (auto const& tile : tiles) {
+    prefetch_graph_storage_tile(handle, matrix_partition, tile);
+
+    auto tile_major_first = matrix_partition.get_major_first() + tile.major_offset_first;
+    auto tile_major_last  = matrix_partition.get_major_first() + tile.major_offset_last;
+    // the kernels index major results relative to the first major of the tile
+    auto tile_result_value_output_first =
+      update_major ? result_value_output_first + launch.major_range_first +
+                       (tile.major_offset_first - major_offset_first)
+                   : result_value_output_first;
+
+    if (launch.mapping == major_mapping_t::thread_per_major) {
+      for_all_major_for_all_nbr_low_degree<update_major>
+        <<<launch.num_blocks, launch.block_size, 0, handle.get_stream()>>>(
+          matrix_partition,
+          tile_major_first,
+          tile_major_last,
+          adj_matrix_row_value_input_first,
+          adj_matrix_col_value_input_first,
+          edge_value_input_first,
+          tile_result_value_output_first,
+          e_op,
+          init);
+    } else if (launch.mapping == major_mapping_t::warp_per_major) {
+      for_all_major_for_all_nbr_mid_degree<update_major>
+        <<<launch.num_blocks, launch.block_size, 0, handle.get_stream()>>>(
+          matrix_partition,
+          tile_major_first,
+          tile_major_last,
+          adj_matrix_row_value_input_first,
+          adj_matrix_col_value_input_first,
+          edge_value_input_first,
+          tile_result_value_output_first,
+          e_op,
+          init);
+    } else {
+      for_all_major_for_all_nbr_high_degree<update_major>
+        <<<launch.num_blocks, launch.block_size, 0, handle.get_stream()>>>(
+          matrix_partition,
+          tile_major_first,
+          tile_major_last,
+          adj_matrix_row_value_input_first,
+          adj_matrix_col_value_input_first,
+          edge_value_input_first,
+          tile_result_value_output_first,
+          e_op,
+          init);
+    }
+  }
+  timer.stop();
+}
+
+// one warp per major, lanes iterate over the property columns (consecutive lanes access
+// consecutive columns of a row-major dense block, and a neighbor list is read once for every
+// warp_size columns)
+// FIXME: lanes are under-utilized if num_columns is smaller than raft::warp_size()
+template <bool update_major,
+          typename GraphViewType,
+          typename AdjMatrixRowValueInputIterator,
+          typename AdjMatrixColValueInputIterator,
+          typename ResultValueOutputIterator,
+          typename EdgeOp,
+          typename T>
+__global__ void for_all_major_for_all_nbr_multi_column(
+  matrix_partition_device_t<GraphViewType> matrix_partition,
+  typename GraphViewType::vertex_type major_first,
+  typename GraphViewType::vertex_type major_last,
+  size_t num_columns,
+  AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
+  AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+  ResultValueOutputIterator result_value_output_first,
+  EdgeOp e_op,
+  T init /* relevent only if update_major == true */)
+{
+  using vertex_t      = typename GraphViewType::vertex_type;
+  using edge_t        = typename GraphViewType::edge_type;
+  using weight_t      = typename GraphViewType::weight_type;
+  using e_op_result_t = T;
+
+  auto const tid = threadIdx.x + blockIdx.x * blockDim.x;
+  static_assert(copy_v_transform_reduce_nbr_for_all_block_size % raft::warp_size() == 0);
+  auto const lane_id      = tid % raft::warp_size();
+  auto major_start_offset = static_cast<size_t>(major_first - matrix_partition.get_major_first());
+  auto idx                = static_cast<size_t>(tid / raft::warp_size());
+
+  while (idx < static_cast<size_t>(major_last - major_first)) {
+    minor_index_iterator_t<vertex_t, edge_t> indices{};
+    weight_t const* weights{nullptr};
+    edge_t local_degree{};
+    auto major_offset                           = major_start_offset + idx;
+    thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(major_offset);
+    for (size_t j = lane_id; j < num_columns; j += raft::warp_size()) {
+      e_op_result_t e_op_result_sum{init};  // relevent only if update_major == true
+      for (edge_t i = 0; i < local_degree; ++i) {
+        if (!matrix_partition.is_edge_active(*(indices.base()) + i)) { continue; }
+        auto minor        = indices[i];
+        auto weight       = weights != nullptr ? weights[i] : weight_t{1.0};
+        auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
+        auto row          = GraphViewType::is_adj_matrix_transposed
+                     ? minor
+                     : matrix_partition.get_major_from_major_offset_nocheck(major_offset);
+        auto col = GraphViewType::is_adj_matrix_transposed
+                     ? matrix_partition.get_major_from_major_offset_nocheck(major_offset)
+                     : minor;
+        auto row_offset = GraphViewType::is_adj_matrix_transposed
+                            ? minor_offset
+                            : static_cast<vertex_t>(major_offset);
+        auto col_offset = GraphViewType::is_adj_matrix_transposed
+                            ? static_cast<vertex_t>(major_offset)
+                            : minor_offset;
+        auto e_op_result =
+          evaluate_edge_op<GraphViewType,
+                           AdjMatrixRowValueInputIterator,
+                           AdjMatrixColValueInputIterator,
+                           EdgeOp>()
+            .compute(row,
+                     col,
+                     weight,
+                     *(adj_matrix_row_value_input_first +
+                       static_cast<size_t>(row_offset) * num_columns + j),
+                     *(adj_matrix_col_value_input_first +
+                       static_cast<size_t>(col_offset) * num_columns + j),
+                     e_op);
+        if (update_major) {
+          e_op_result_sum = plus_edge_op_result(e_op_result_sum, e_op_result);
+        } else {
+          atomic_accumulate_edge_op_result(
+            result_value_output_first + static_cast<size_t>(minor_offset) * num_columns + j,
+            e_op_result);
+        }
+      }
+      if (update_major) { *(result_value_output_first + idx * num_columns + j) = e_op_result_sum; }
+    }
+
+    idx += gridDim.x * (blockDim.x / raft::warp_size());
+  }
+}
+
+// Pipelines the per matrix partition major value computation (on the handle's stream) and the
+// reduction of the computed values to the owning GPUs (on a separate communication stream). Two
+// major value buffers are used in turns, so the computation for matrix partition i + 1 overlaps
+// with the reduction for matrix partition i (the computation for partition i + 2 waits for the
+// reduction for partition i to release the buffer).
+template <typename T>
+class major_reduce_pipeline_t {
+ public:
+  // every reduction issued with streams should be joined before streams is reused
+  major_reduce_pipeline_t(raft::handle_t const& handle,
+                          major_reduce_pipeline_streams_t const& streams,
+                          size_t max_buffer_size)
+    : handle_ptr_(&handle),
+      streams_ptr_(&streams),
+      buffers_{allocate_dataframe_buffer<T>(max_buffer_size, handle.get_stream()),
+               allocate_dataframe_buffer<T>(max_buffer_size, handle.get_stream())}
+  {
+  }
+
+  major_reduce_pipeline_t(major_reduce_pipeline_t const&) = delete;
+  major_reduce_pipeline_t& operator=(major_reduce_pipeline_t const&) = delete;
+
+  // returns the buffer to compute the major values of matrix partition i (valid in the handle's
+  // stream until reduce(i) is called)
+  auto buffer_begin(size_t i)
+  {
+    auto buffer_idx = i % num_buffers;
+    if (i >= num_buffers) {
+      CUDA_TRY(cudaStreamWaitEvent(
+        handle_ptr_->get_stream(), streams_ptr_->reduce_event(buffer_idx), 0));
+    }
+    return get_dataframe_buffer_begin<T>(buffers_[buffer_idx]);
+  }
+
+  // reduces the first count values of the buffer for matrix partition i to output_first of the
+  // root rank once the values are computed in the handle's stream
+  template <typename OutputIterator>
+  void reduce(raft::comms::comms_t const& comm,
+              size_t i,
+              OutputIterator output_first,
+              size_t count,
+              int root)
+  {
+    auto buffer_idx = i % num_buffers;
+    CUDA_TRY(cudaEventRecord(streams_ptr_->compute_event(buffer_idx), handle_ptr_->get_stream()));
+    CUDA_TRY(
+      cudaStreamWaitEvent(streams_ptr_->comm_stream(), streams_ptr_->compute_event(buffer_idx), 0));
+    device_reduce(comm,
+                  get_dataframe_buffer_begin<T>(buffers_[buffer_idx]),
+                  output_first,
+                  count,
+                  raft::comms::op_t::SUM,
+                  root,
+                  streams_ptr_->comm_stream());
+    CUDA_TRY(cudaEventRecord(streams_ptr_->reduce_event(buffer_idx), streams_ptr_->comm_stream()));
+    num_issued_ = std::max(num_issued_, buffer_idx + 1);
+  }
+
+  // makes the handle's stream wait for every issued reduction (call this before the outputs and
+  // the buffers go out of scope)
+  void join()
+  {
+    for (size_t i = 0; i < num_issued_; ++i) {
+      CUDA_TRY(cudaStreamWaitEvent(handle_ptr_->get_stream(), streams_ptr_->reduce_event(i), 0));
+    }
+  }
+
+ private:
+  static size_t constexpr num_buffers{major_reduce_pipeline_streams_t::num_buffers};
+
+  raft::handle_t const* handle_ptr_{nullptr};
+  major_reduce_pipeline_streams_t const* streams_ptr_{nullptr};
+  std::array<decltype(allocate_dataframe_buffer<T>(0, cudaStream_t{nullptr})), num_buffers>
+    buffers_;
+  size_t num_issued_{0};
+};
+
+// returns the largest major range size of the local matrix partitions (the buffer size for
+// major_reduce_pipeline_t)
+template <typename GraphViewType>
+size_t get_max_local_adj_matrix_partition_major_size(GraphViewType const& graph_view)
+{
+  size_t ret{0};
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    matrix_partition_device_t<GraphViewType> matrix_partition(graph_view, i);
+    ret = std::max(ret, static_cast<size_t>(matrix_partition.get_major_size()));
+  }
+  return ret;
+}
+
 template <bool in,  // iterate over incoming edges (in == true) or outgoing edges (in == false)
           typename GraphViewType,
           typename AdjMatrixRowValueInputIterator,
           typename AdjMatrixColValueInputIterator,
+          typename EdgeValueInputFirstOp,
           typename EdgeOp,
           typename T,
           typename VertexValueOutputIterator>
@@ -354,10 +691,15 @@ void copy_v_transform_reduce_nbr(raft::handle_t const& handle,
                                  GraphViewType const& graph_view,
                                  AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
                                  AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+                                 EdgeValueInputFirstOp edge_value_input_first_op,
                                  EdgeOp e_op,
                                  T init,
-                                 VertexValueOutputIterator vertex_value_output_first)
+                                 VertexValueOutputIterator vertex_value_output_first,
+                                 major_reduce_pipeline_streams_t const* pipeline_streams)
 {
+  profile_range_t profile_range(
+    handle, in ? "copy_v_transform_reduce_in_nbr" : "copy_v_transform_reduce_out_nbr");
+
   using vertex_t = typename GraphViewType::vertex_type;
 
   static_assert(is_arithmetic_or_thrust_tuple_of_arithmetic<T>::value);
@@ -394,16 +736,27 @@ void copy_v_transform_reduce_nbr(raft::handle_t const& handle,
     assert(minor_tmp_buffer_size == 0);
   }
 
+  // in multi-GPU, the major values of matrix partition i are reduced while computing the major
+  // values of matrix partition i + 1
+  std::unique_ptr<major_reduce_pipeline_streams_t> tmp_pipeline_streams{nullptr};
+  std::unique_ptr<major_reduce_pipeline_t<T>> major_reduce_pipeline{nullptr};
+  if (GraphViewType::is_multi_gpu && (in == GraphViewType::is_adj_matrix_transposed)) {
+    if (pipeline_streams == nullptr) {
+      tmp_pipeline_streams = std::make_unique<major_reduce_pipeline_streams_t>();
+      pipeline_streams     = tmp_pipeline_streams.get();
+    }
+    major_reduce_pipeline = std::make_unique<major_reduce_pipeline_t<T>>(
+      handle, *pipeline_streams, get_max_local_adj_matrix_partition_major_size(graph_view));
+  }
+
   for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
     matrix_partition_device_t<GraphViewType> matrix_partition(graph_view, i);
+    add_profile_counter("edges_traversed", matrix_partition.get_number_of_edges());
 
-    auto major_tmp_buffer_size =
-      GraphViewType::is_multi_gpu && (in == GraphViewType::is_adj_matrix_transposed)
-        ? matrix_partition.get_major_size()
-        : vertex_t{0};
-    auto major_tmp_buffer =
-      allocate_dataframe_buffer<T>(major_tmp_buffer_size, handle.get_stream());
-    auto major_buffer_first = get_dataframe_buffer_begin<T>(major_tmp_buffer);
+    decltype(minor_buffer_first) major_buffer_first{};
+    if (major_reduce_pipeline != nullptr) {
+      major_buffer_first = major_reduce_pipeline->buffer_begin(i);
+    }
 
     auto major_init = T{};
     if (in == GraphViewType::is_adj_matrix_transposed) {
@@ -427,9 +780,14 @@ void copy_v_transform_reduce_nbr(raft::handle_t const& handle,
     }
 
     if (graph_view.get_vertex_partition_size(comm_root_rank) > 0) {
-      raft::grid_1d_thread_t update_grid(graph_view.get_vertex_partition_size(comm_root_rank),
-                                         detail::copy_v_transform_reduce_nbr_for_all_block_size,
-                                         handle.get_device_properties().maxGridSize[0]);
+      auto launches = detail::get_pattern_kernel_launches(
+        handle,
+        pattern_kernel_t::copy_v_transform_reduce_nbr,
+        detail::copy_v_transform_reduce_nbr_for_all_block_size,
+        graph_view.get_vertex_partition_size(comm_root_rank),
+        static_cast<size_t>(matrix_partition.get_number_of_edges()),
+        graph_view.get_local_adj_matrix_partition_segment_offsets(i),
+        true);
 
       if (GraphViewType::is_multi_gpu) {
         auto& row_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
@@ -444,28 +802,34 @@ void copy_v_transform_reduce_nbr(raft::handle_t const& handle,
                                         ? matrix_partition.get_major_value_start_offset()
                                         : vertex_t{0};
 
-        detail::for_all_major_for_all_nbr_low_degree<in == GraphViewType::is_adj_matrix_transposed>
-          <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+        for (auto const& launch : launches) {
+          detail::for_all_major_for_all_nbr<in == GraphViewType::is_adj_matrix_transposed>(
+            handle,
+            launch,
             matrix_partition,
             graph_view.get_vertex_partition_first(comm_root_rank),
-            graph_view.get_vertex_partition_last(comm_root_rank),
             adj_matrix_row_value_input_first + row_value_input_offset,
             adj_matrix_col_value_input_first + col_value_input_offset,
+            edge_value_input_first_op(i),
             (in == GraphViewType::is_adj_matrix_transposed) ? major_buffer_first
                                                             : minor_buffer_first,
             e_op,
             major_init);
+        }
       } else {
-        detail::for_all_major_for_all_nbr_low_degree<in == GraphViewType::is_adj_matrix_transposed>
-          <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+        for (auto const& launch : launches) {
+          detail::for_all_major_for_all_nbr<in == GraphViewType::is_adj_matrix_transposed>(
+            handle,
+            launch,
             matrix_partition,
             graph_view.get_vertex_partition_first(comm_root_rank),
-            graph_view.get_vertex_partition_last(comm_root_rank),
             adj_matrix_row_value_input_first,
             adj_matrix_col_value_input_first,
+            edge_value_input_first_op(i),
             vertex_value_output_first,
             e_op,
             major_init);
+        }
       }
     }
 
@@ -477,15 +841,14 @@ void copy_v_transform_reduce_nbr(raft::handle_t const& handle,
       auto const col_comm_rank = col_comm.get_rank();
       auto const col_comm_size = col_comm.get_size();
 
-      device_reduce(col_comm,
-                    major_buffer_first,
-                    vertex_value_output_first,
-                    matrix_partition.get_major_size(),
-                    raft::comms::op_t::SUM,
-                    i,
-                    handle.get_stream());
+      major_reduce_pipeline->reduce(col_comm,
+                                    i,
+                                    vertex_value_output_first,
+                                    static_cast<size_t>(matrix_partition.get_major_size()),
+                                    static_cast<int>(i));
     }
   }
+  if (major_reduce_pipeline != nullptr) { major_reduce_pipeline->join(); }
 
   if (GraphViewType::is_multi_gpu && (in != GraphViewType::is_adj_matrix_transposed)) {
     auto& comm               = handle.get_comms();
@@ -512,6 +875,188 @@ void copy_v_transform_reduce_nbr(raft::handle_t const& handle,
   }
 }
 
+template <bool in,  // iterate over incoming edges (in == true) or outgoing edges (in == false)
+          typename GraphViewType,
+          typename AdjMatrixRowValueInputIterator,
+          typename AdjMatrixColValueInputIterator,
+          typename EdgeOp,
+          typename T,
+          typename VertexValueOutputIterator>
+void copy_v_transform_reduce_nbr(raft::handle_t const& handle,
+                                 GraphViewType const& graph_view,
+                                 size_t num_columns,
+                                 AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
+                                 AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+                                 EdgeOp e_op,
+                                 T init,
+                                 VertexValueOutputIterator vertex_value_output_first,
+                                 major_reduce_pipeline_streams_t const* pipeline_streams)
+{
+  profile_range_t profile_range(
+    handle, in ? "copy_v_transform_reduce_in_nbr" : "copy_v_transform_reduce_out_nbr");
+
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_arithmetic<T>::value);
+
+  auto minor_tmp_buffer_size =
+    (GraphViewType::is_multi_gpu && (in != GraphViewType::is_adj_matrix_transposed))
+      ? static_cast<size_t>(GraphViewType::is_adj_matrix_transposed
+                              ? graph_view.get_number_of_local_adj_matrix_partition_rows()
+                              : graph_view.get_number_of_local_adj_matrix_partition_cols()) *
+          num_columns
+      : size_t{0};
+  rmm::device_uvector<T> minor_tmp_buffer(minor_tmp_buffer_size, handle.get_stream());
+
+  if (in != GraphViewType::is_adj_matrix_transposed) {
+    auto minor_init = init;
+    if (GraphViewType::is_multi_gpu) {
+      auto& row_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+      auto const row_comm_rank = row_comm.get_rank();
+      minor_init               = (row_comm_rank == 0) ? init : T{};
+    }
+
+    if (GraphViewType::is_multi_gpu) {
+      thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   minor_tmp_buffer.begin(),
+                   minor_tmp_buffer.end(),
+                   minor_init);
+    } else {
+      thrust::fill(
+        rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+        vertex_value_output_first,
+        vertex_value_output_first +
+          static_cast<size_t>(graph_view.get_number_of_local_vertices()) * num_columns,
+        minor_init);
+    }
+  } else {
+    assert(minor_tmp_buffer_size == 0);
+  }
+
+  // in multi-GPU, the major values of matrix partition i are reduced while computing the major
+  // values of matrix partition i + 1
+  std::unique_ptr<major_reduce_pipeline_streams_t> tmp_pipeline_streams{nullptr};
+  std::unique_ptr<major_reduce_pipeline_t<T>> major_reduce_pipeline{nullptr};
+  if (GraphViewType::is_multi_gpu && (in == GraphViewType::is_adj_matrix_transposed)) {
+    if (pipeline_streams == nullptr) {
+      tmp_pipeline_streams = std::make_unique<major_reduce_pipeline_streams_t>();
+      pipeline_streams     = tmp_pipeline_streams.get();
+    }
+    major_reduce_pipeline = std::make_unique<major_reduce_pipeline_t<T>>(
+      handle,
+      *pipeline_streams,
+      get_max_local_adj_matrix_partition_major_size(graph_view) * num_columns);
+  }
+
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    matrix_partition_device_t<GraphViewType> matrix_partition(graph_view, i);
+    add_profile_counter("edges_traversed", matrix_partition.get_number_of_edges());
+
+    T* major_buffer_first{nullptr};
+    if (major_reduce_pipeline != nullptr) {
+      major_buffer_first = major_reduce_pipeline->buffer_begin(i);
+    }
+
+    auto major_init = T{};
+    if (in == GraphViewType::is_adj_matrix_transposed) {
+      if (GraphViewType::is_multi_gpu) {
+        auto& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+        auto const col_comm_rank = col_comm.get_rank();
+        major_init               = (col_comm_rank == 0) ? init : T{};
+      } else {
+        major_init = init;
+      }
+    }
+
+    int comm_root_rank = 0;
+    if (GraphViewType::is_multi_gpu) {
+      auto& row_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+      auto const row_comm_rank = row_comm.get_rank();
+      auto const row_comm_size = row_comm.get_size();
+      comm_root_rank           = i * row_comm_size + row_comm_rank;
+    }
+
+    if ((graph_view.get_vertex_partition_size(comm_root_rank) > 0) && (num_columns > 0)) {
+      raft::grid_1d_thread_t update_grid(
+        static_cast<size_t>(graph_view.get_vertex_partition_size(comm_root_rank)) *
+          raft::warp_size(),
+        detail::copy_v_transform_reduce_nbr_for_all_block_size,
+        handle.get_device_properties().maxGridSize[0]);
+
+      auto row_value_input_offset =
+        GraphViewType::is_adj_matrix_transposed
+          ? size_t{0}
+          : static_cast<size_t>(matrix_partition.get_major_value_start_offset()) * num_columns;
+      auto col_value_input_offset =
+        GraphViewType::is_adj_matrix_transposed
+          ? static_cast<size_t>(matrix_partition.get_major_value_start_offset()) * num_columns
+          : size_t{0};
+
+      if (GraphViewType::is_multi_gpu) {
+        detail::for_all_major_for_all_nbr_multi_column<in ==
+                                                       GraphViewType::is_adj_matrix_transposed>
+          <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+            matrix_partition,
+            graph_view.get_vertex_partition_first(comm_root_rank),
+            graph_view.get_vertex_partition_last(comm_root_rank),
+            num_columns,
+            adj_matrix_row_value_input_first + row_value_input_offset,
+            adj_matrix_col_value_input_first + col_value_input_offset,
+            (in == GraphViewType::is_adj_matrix_transposed) ? major_buffer_first
+                                                            : minor_tmp_buffer.data(),
+            e_op,
+            major_init);
+      } else {
+        detail::for_all_major_for_all_nbr_multi_column<in ==
+                                                       GraphViewType::is_adj_matrix_transposed>
+          <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+            matrix_partition,
+            graph_view.get_vertex_partition_first(comm_root_rank),
+            graph_view.get_vertex_partition_last(comm_root_rank),
+            num_columns,
+            adj_matrix_row_value_input_first,
+            adj_matrix_col_value_input_first,
+            vertex_value_output_first,
+            e_op,
+            major_init);
+      }
+    }
+
+    if (GraphViewType::is_multi_gpu && (in == GraphViewType::is_adj_matrix_transposed)) {
+      auto& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+
+      major_reduce_pipeline->reduce(
+        col_comm,
+        i,
+        vertex_value_output_first,
+        static_cast<size_t>(matrix_partition.get_major_size()) * num_columns,
+        static_cast<int>(i));
+    }
+  }
+  if (major_reduce_pipeline != nullptr) { major_reduce_pipeline->join(); }
+
+  if (GraphViewType::is_multi_gpu && (in != GraphViewType::is_adj_matrix_transposed)) {
+    auto& row_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+    auto const row_comm_size = row_comm.get_size();
+    auto& col_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+    auto const col_comm_rank = col_comm.get_rank();
+
+    for (int i = 0; i < row_comm_size; ++i) {
+      auto offset = (graph_view.get_vertex_partition_first(col_comm_rank * row_comm_size + i) -
+                     graph_view.get_vertex_partition_first(col_comm_rank * row_comm_size));
+      device_reduce(row_comm,
+                    minor_tmp_buffer.begin() + static_cast<size_t>(offset) * num_columns,
+                    vertex_value_output_first,
+                    static_cast<size_t>(
+                      graph_view.get_vertex_partition_size(col_comm_rank * row_comm_size + i)) *
+                      num_columns,
+                    raft::comms::op_t::SUM,
+                    i,
+                    handle.get_stream());
+    }
+  }
+}
+
 }  // namespace detail
 
 /**
@@ -548,6 +1093,9 @@ void copy_v_transform_reduce_nbr(raft::handle_t const& handle,
  * (inclusive) vertex (assigned to tihs process in multi-GPU). `vertex_value_output_last`
  * (exclusive) is deduced as @p vertex_value_output_first + @p
  * graph_view.get_number_of_local_vertices().
+ * @param pipeline_streams Optional CUDA stream and events for overlapping the computation with
+ * the communication in multi-GPU (see major_reduce_pipeline_streams_t, a temporary instance is
+ * created if this is nullptr).
  */
 template <typename GraphViewType,
           typename AdjMatrixRowValueInputIterator,
@@ -555,21 +1103,166 @@ template <typename GraphViewType,
           typename EdgeOp,
           typename T,
           typename VertexValueOutputIterator>
-void copy_v_transform_reduce_in_nbr(raft::handle_t const& handle,
-                                    GraphViewType const& graph_view,
-                                    AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
-                                    AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
-                                    EdgeOp e_op,
-                                    T init,
-                                    VertexValueOutputIterator vertex_value_output_first)
+void copy_v_transform_reduce_in_nbr(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
+  AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+  EdgeOp e_op,
+  T init,
+  VertexValueOutputIterator vertex_value_output_first,
+  major_reduce_pipeline_streams_t const* pipeline_streams = nullptr)
 {
   detail::copy_v_transform_reduce_nbr<true>(handle,
                                             graph_view,
                                             adj_matrix_row_value_input_first,
                                             adj_matrix_col_value_input_first,
+                                            detail::no_edge_value_input_first_t{},
                                             e_op,
                                             init,
-                                            vertex_value_output_first);
+                                            vertex_value_output_first,
+                                            pipeline_streams);
+}
+
+/**
+ * @brief Iterate over the incoming edges to update vertex properties (@p e_op also takes the edge
+ * property value).
+ *
+ * This function is an overload of copy_v_transform_reduce_in_nbr() with a typed per-edge property
+ * (see edge_property.cuh).
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam AdjMatrixRowValueInputIterator Type of the iterator for graph adjacency matrix row
+ * input properties.
+ * @tparam AdjMatrixColValueInputIterator Type of the iterator for graph adjacency matrix column
+ * input properties.
+ * @tparam EdgeValue Type of the edge property values.
+ * @tparam EdgeOp Type of the quinary (or senary) edge operator.
+ * @tparam T Type of the initial value for reduction over the incoming edges.
+ * @tparam VertexValueOutputIterator Type of the iterator for vertex output property variables.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param adj_matrix_row_value_input_first Iterator pointing to the adjacency matrix row input
+ * properties for the first (inclusive) row (assigned to this process in multi-GPU).
+ * @param adj_matrix_col_value_input_first Iterator pointing to the adjacency matrix column input
+ * properties for the first (inclusive) column (assigned to this process in multi-GPU).
+ * @param edge_value_input Non-owning view of the edge property (created for @p graph_view).
+ * @param e_op Quinary (or senary) operator takes edge source, edge destination, (optional edge
+ * weight), *(@p adj_matrix_row_value_input_first + i), *(@p adj_matrix_col_value_input_first +
+ * j), and the edge property value and returns a value to be reduced.
+ * @param init Initial value to be added to the reduced @p e_op return values for each vertex.
+ * @param vertex_value_output_first Iterator pointing to the vertex property variables for the first
+ * (inclusive) vertex (assigned to tihs process in multi-GPU).
+ * @param pipeline_streams Optional CUDA stream and events for overlapping the computation with
+ * the communication in multi-GPU (see major_reduce_pipeline_streams_t, a temporary instance is
+ * created if this is nullptr).
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputIterator,
+          typename AdjMatrixColValueInputIterator,
+          typename EdgeValue,
+          typename EdgeOp,
+          typename T,
+          typename VertexValueOutputIterator>
+void copy_v_transform_reduce_in_nbr(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
+  AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+  edge_property_view_t<typename GraphViewType::edge_type, EdgeValue> const& edge_value_input,
+  EdgeOp e_op,
+  T init,
+  VertexValueOutputIterator vertex_value_output_first,
+  major_reduce_pipeline_streams_t const* pipeline_streams = nullptr)
+{
+  CUGRAPH_EXPECTS(edge_value_input.get_number_of_local_adj_matrix_partitions() ==
+                    graph_view.get_number_of_local_adj_matrix_partitions(),
+                  "Invalid input argument: edge_value_input is not created for graph_view.");
+
+  detail::copy_v_transform_reduce_nbr<true>(
+    handle,
+    graph_view,
+    adj_matrix_row_value_input_first,
+    adj_matrix_col_value_input_first,
+    detail::edge_property_value_input_first_t<typename GraphViewType::edge_type, EdgeValue>{
+      edge_value_input},
+    e_op,
+    init,
+    vertex_value_output_first,
+    pipeline_streams);
+}
+
+/**
+ * @brief Iterate over the incoming edges to update multi-column vertex properties.
+ *
+ * This version updates @p num_columns property columns in a single pass over the edges (instead of
+ * @p num_columns passes), this is similar to sparse matrix dense matrix multiplication. Vertex and
+ * adjacency matrix row & column property values are stored in row-major dense blocks (the j'th
+ * column value of the i'th vertex, row, or column is stored at offset i * @p num_columns + j).
+ * This function is inspired by thrust::transfrom_reduce() (iteration over the incoming edges part)
+ * and thrust::copy() (update vertex properties part, take transform_reduce output as copy input).
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam AdjMatrixRowValueInputIterator Type of the iterator for graph adjacency matrix row
+ * input properties.
+ * @tparam AdjMatrixColValueInputIterator Type of the iterator for graph adjacency matrix column
+ * input properties.
+ * @tparam EdgeOp Type of the quaternary (or quinary) edge operator.
+ * @tparam T Type of the initial value for reduction over the incoming edges (should be an
+ * arithmetic type).
+ * @tparam VertexValueOutputIterator Type of the iterator for vertex output property variables.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param num_columns Number of property values per vertex (and per adjacency matrix row & column).
+ * @param adj_matrix_row_value_input_first Iterator pointing to the adjacency matrix row input
+ * properties for the first (inclusive) row (assigned to this process in multi-GPU).
+ * `adj_matrix_row_value_input_last` (exclusive) is deduced as @p adj_matrix_row_value_input_first +
+ * @p graph_view.get_number_of_local_adj_matrix_partition_rows() * @p num_columns.
+ * @param adj_matrix_col_value_input_first Iterator pointing to the adjacency matrix column input
+ * properties for the first (inclusive) column (assigned to this process in multi-GPU).
+ * `adj_matrix_col_value_output_last` (exclusive) is deduced as @p adj_matrix_col_value_output_first
+ * + @p graph_view.get_number_of_local_adj_matrix_partition_cols() * @p num_columns.
+ * @param e_op Quaternary (or quinary) operator takes edge source, edge destination, (optional edge
+ * weight), the row property value, and the column property value (of the same property column)
+ * and returns a value to be reduced.
+ * @param init Initial value to be added to the reduced @p e_op return values for each vertex and
+ * property column.
+ * @param vertex_value_output_first Iterator pointing to the vertex property variables for the first
+ * (inclusive) vertex (assigned to tihs process in multi-GPU). `vertex_value_output_last`
+ * (exclusive) is deduced as @p vertex_value_output_first + @p
+ * graph_view.get_number_of_local_vertices() * @p num_columns.
+ * @param pipeline_streams Optional CUDA stream and events for overlapping the computation with
+ * the communication in multi-GPU (see major_reduce_pipeline_streams_t, a temporary instance is
+ * created if this is nullptr).
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputIterator,
+          typename AdjMatrixColValueInputIterator,
+          typename EdgeOp,
+          typename T,
+          typename VertexValueOutputIterator>
+void copy_v_transform_reduce_in_nbr(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  size_t num_columns,
+  AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
+  AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+  EdgeOp e_op,
+  T init,
+  VertexValueOutputIterator vertex_value_output_first,
+  major_reduce_pipeline_streams_t const* pipeline_streams = nullptr)
+{
+  detail::copy_v_transform_reduce_nbr<true>(handle,
+                                            graph_view,
+                                            num_columns,
+                                            adj_matrix_row_value_input_first,
+                                            adj_matrix_col_value_input_first,
+                                            e_op,
+                                            init,
+                                            vertex_value_output_first,
+                                            pipeline_streams);
 }
 
 /**
@@ -610,6 +1303,9 @@ void copy_v_transform_reduce_in_nbr(raft::handle_t const& handle,
  * first (inclusive) vertex (assigned to tihs process in multi-GPU). `vertex_value_output_last`
  * (exclusive) is deduced as @p vertex_value_output_first + @p
  * graph_view.get_number_of_local_vertices().
+ * @param pipeline_streams Optional CUDA stream and events for overlapping the computation with
+ * the communication in multi-GPU (see major_reduce_pipeline_streams_t, a temporary instance is
+ * created if this is nullptr).
  */
 template <typename GraphViewType,
           typename AdjMatrixRowValueInputIterator,
@@ -624,15 +1320,87 @@ void copy_v_transform_reduce_out_nbr(
   AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
   EdgeOp e_op,
   T init,
-  VertexValueOutputIterator vertex_value_output_first)
+  VertexValueOutputIterator vertex_value_output_first,
+  major_reduce_pipeline_streams_t const* pipeline_streams = nullptr)
 {
   detail::copy_v_transform_reduce_nbr<false>(handle,
                                              graph_view,
                                              adj_matrix_row_value_input_first,
                                              adj_matrix_col_value_input_first,
+                                             detail::no_edge_value_input_first_t{},
                                              e_op,
                                              init,
-                                             vertex_value_output_first);
+                                             vertex_value_output_first,
+                                             pipeline_streams);
+}
+
+/**
+ * @brief Iterate over the outgoing edges to update vertex properties (@p e_op also takes the edge
+ * property value).
+ *
+ * This function is an overload of copy_v_transform_reduce_out_nbr() with a typed per-edge property
+ * (see edge_property.cuh).
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam AdjMatrixRowValueInputIterator Type of the iterator for graph adjacency matrix row
+ * input properties.
+ * @tparam AdjMatrixColValueInputIterator Type of the iterator for graph adjacency matrix column
+ * input properties.
+ * @tparam EdgeValue Type of the edge property values.
+ * @tparam EdgeOp Type of the quinary (or senary) edge operator.
+ * @tparam T Type of the initial value for reduction over the outgoing edges.
+ * @tparam VertexValueOutputIterator Type of the iterator for vertex output property variables.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param adj_matrix_row_value_input_first Iterator pointing to the adjacency matrix row input
+ * properties for the first (inclusive) row (assigned to this process in multi-GPU).
+ * @param adj_matrix_col_value_input_first Iterator pointing to the adjacency matrix column input
+ * properties for the first (inclusive) column (assigned to this process in multi-GPU).
+ * @param edge_value_input Non-owning view of the edge property (created for @p graph_view).
+ * @param e_op Quinary (or senary) operator takes edge source, edge destination, (optional edge
+ * weight), *(@p adj_matrix_row_value_input_first + i), *(@p adj_matrix_col_value_input_first +
+ * j), and the edge property value and returns a value to be reduced.
+ * @param init Initial value to be added to the reduced @p e_op return values for each vertex.
+ * @param vertex_value_output_first Iterator pointing to the vertex property variables for the first
+ * (inclusive) vertex (assigned to tihs process in multi-GPU).
+ * @param pipeline_streams Optional CUDA stream and events for overlapping the computation with
+ * the communication in multi-GPU (see major_reduce_pipeline_streams_t, a temporary instance is
+ * created if this is nullptr).
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputIterator,
+          typename AdjMatrixColValueInputIterator,
+          typename EdgeValue,
+          typename EdgeOp,
+          typename T,
+          typename VertexValueOutputIterator>
+void copy_v_transform_reduce_out_nbr(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
+  AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+  edge_property_view_t<typename GraphViewType::edge_type, EdgeValue> const& edge_value_input,
+  EdgeOp e_op,
+  T init,
+  VertexValueOutputIterator vertex_value_output_first,
+  major_reduce_pipeline_streams_t const* pipeline_streams = nullptr)
+{
+  CUGRAPH_EXPECTS(edge_value_input.get_number_of_local_adj_matrix_partitions() ==
+                    graph_view.get_number_of_local_adj_matrix_partitions(),
+                  "Invalid input argument: edge_value_input is not created for graph_view.");
+
+  detail::copy_v_transform_reduce_nbr<false>(
+    handle,
+    graph_view,
+    adj_matrix_row_value_input_first,
+    adj_matrix_col_value_input_first,
+    detail::edge_property_value_input_first_t<typename GraphViewType::edge_type, EdgeValue>{
+      edge_value_input},
+    e_op,
+    init,
+    vertex_value_output_first,
+    pipeline_streams);
 }
 
 }  // namespace experimental
@@ -19,17 +19,24 @@
 #include <experimental/graph.hpp>
 #include <experimental/graph_view.hpp>
 #include <matrix_partition_device.cuh>
+#include <patterns/kernel_dispatch.cuh>
+#include <patterns/reduce_op.cuh>
 #include <utilities/collect_comm.cuh>
 #include <utilities/dataframe_buffer.cuh>
 #include <utilities/error.hpp>
 #include <utilities/host_scalar_comm.cuh>
+#include <utilities/profiling.hpp>
 #include <utilities/shuffle_comm.cuh>
 #include <vertex_partition_device.cuh>
 
 #include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
 
 #include <experimental/include_cuco_static_map.cuh>
 
+#include <thrust/binary_search.h>
+#include <thrust/scan.h>
+
 #include <type_traits>
 
 namespace cugraph {
@@ -37,9 +44,16 @@ namespace experimental {
 
 namespace detail {
 
-// FIXME: block size requires tuning
+// the grid size is selected by the kernel dispatch layer (patterns/kernel_dispatch.cuh)
 int32_t constexpr copy_v_transform_reduce_key_aggregated_out_nbr_for_all_block_size = 128;
 
+// FIXME: threshold value requires tuning
+// majors with a local degree no smaller than this value are key-aggregated by the edge-partitioned
+// path (append_key_aggregated_high_degree_edges) instead of a single thread
+size_t constexpr key_aggregation_high_degree_threshold{mid_degree_threshold};
+
+// every thread key-aggregates the edges of one major with a sequential sort & reduction; majors
+// with local degree >= high_degree_threshold are skipped (and their slots are invalidated)
 template <typename GraphViewType, typename VertexIterator>
 __global__ void for_all_major_for_all_nbr_low_degree(
   matrix_partition_device_t<GraphViewType> matrix_partition,
@@ -49,7 +63,8 @@ __global__ void for_all_major_for_all_nbr_low_degree(
   typename GraphViewType::vertex_type* major_vertices,
   typename GraphViewType::vertex_type* minor_keys,
   typename GraphViewType::weight_type* key_aggregated_edge_weights,
-  typename GraphViewType::vertex_type invalid_vertex)
+  typename GraphViewType::vertex_type invalid_vertex,
+  typename GraphViewType::edge_type high_degree_threshold)
 {
   using vertex_t = typename GraphViewType::vertex_type;
   using edge_t   = typename GraphViewType::edge_type;
@@ -60,18 +75,29 @@ __global__ void for_all_major_for_all_nbr_low_degree(
   auto idx                = static_cast<size_t>(tid);
 
   while (idx < static_cast<size_t>(major_last - major_first)) {
-    vertex_t const* indices{nullptr};
+    minor_index_iterator_t<vertex_t, edge_t> indices{};
     weight_t const* weights{nullptr};
     edge_t local_degree{};
     auto major_offset = major_start_offset + idx;
     thrust::tie(indices, weights, local_degree) =
       matrix_partition.get_local_edges(static_cast<vertex_t>(major_offset));
-    if (local_degree > 0) {
+    if (local_degree >= high_degree_threshold) {
+      auto local_offset = matrix_partition.get_local_offset(major_offset);
+      thrust::fill(thrust::seq,
+                   major_vertices + local_offset,
+                   major_vertices + local_offset + local_degree,
+                   invalid_vertex);
+    } else if (local_degree > 0) {
       auto local_offset    = matrix_partition.get_local_offset(major_offset);
+      // masked out edges get invalid keys (sorted to the end of the neighbor list)
       auto minor_key_first = thrust::make_transform_iterator(
-        indices, [matrix_partition, adj_matrix_minor_key_first] __device__(auto minor) {
-          return *(adj_matrix_minor_key_first +
-                   matrix_partition.get_minor_offset_from_minor_nocheck(minor));
+        thrust::make_counting_iterator(edge_t{0}),
+        [matrix_partition, adj_matrix_minor_key_first, indices, invalid_vertex] __device__(
+          auto i) {
+          return matrix_partition.is_edge_active(*(indices.base()) + i)
+                   ? *(adj_matrix_minor_key_first +
+                       matrix_partition.get_minor_offset_from_minor_nocheck(indices[i]))
+                   : invalid_vertex;
         });
       thrust::copy(
         thrust::seq, minor_key_first, minor_key_first + local_degree, minor_keys + local_offset);
@@ -86,28 +112,41 @@ __global__ void for_all_major_for_all_nbr_low_degree(
                             minor_keys + local_offset + local_degree,
                             key_aggregated_edge_weights + local_offset);
       }
+      auto num_active_edges = local_degree;
+      if (matrix_partition.get_edge_mask() != nullptr) {
+        num_active_edges = static_cast<edge_t>(thrust::distance(
+          minor_keys + local_offset,
+          thrust::lower_bound(thrust::seq,
+                              minor_keys + local_offset,
+                              minor_keys + local_offset + local_degree,
+                              invalid_vertex)));
+      }
       // in-place reduce_by_key
-      vertex_t key_idx{0};
-      key_aggregated_edge_weights[local_offset + key_idx] =
-        weights != nullptr ? key_aggregated_edge_weights[local_offset] : weight_t{1.0};
-
-      for (edge_t i = 1; i < local_degree; ++i) {
-        if (minor_keys[local_offset + i] == minor_keys[local_offset + key_idx]) {
-          key_aggregated_edge_weights[local_offset + key_idx] +=
-            weights != nullptr ? key_aggregated_edge_weights[local_offset + i] : weight_t{1.0};
-        } else {
-          ++key_idx;
-          minor_keys[local_offset + key_idx] = minor_keys[local_offset + i];
-          key_aggregated_edge_weights[local_offset + key_idx] =
-            weights != nullptr ? key_aggregated_edge_weights[local_offset + i] : weight_t{1.0};
+      edge_t num_keys{0};
+      if (num_active_edges > 0) {
+        vertex_t key_idx{0};
+        key_aggregated_edge_weights[local_offset + key_idx] =
+          weights != nullptr ? key_aggregated_edge_weights[local_offset] : weight_t{1.0};
+
+        for (edge_t i = 1; i < num_active_edges; ++i) {
+          if (minor_keys[local_offset + i] == minor_keys[local_offset + key_idx]) {
+            key_aggregated_edge_weights[local_offset + key_idx] +=
+              weights != nullptr ? key_aggregated_edge_weights[local_offset + i] : weight_t{1.0};
+          } else {
+            ++key_idx;
+            minor_keys[local_offset + key_idx] = minor_keys[local_offset + i];
+            key_aggregated_edge_weights[local_offset + key_idx] =
+              weights != nullptr ? key_aggregated_edge_weights[local_offset + i] : weight_t{1.0};
+          }
         }
+        num_keys = static_cast<edge_t>(key_idx + 1);
       }
       thrust::fill(thrust::seq,
                    major_vertices + local_offset,
-                   major_vertices + local_offset + key_idx + 1,
+                   major_vertices + local_offset + num_keys,
                    matrix_partition.get_major_from_major_offset_nocheck(major_offset));
       thrust::fill(thrust::seq,
-                   major_vertices + local_offset + key_idx + 1,
+                   major_vertices + local_offset + num_keys,
                    major_vertices + local_offset + local_degree,
                    invalid_vertex);
     }
@@ -116,6 +155,132 @@ __global__ void for_all_major_for_all_nbr_low_degree(
   }
 }
 
+// key-aggregate the outgoing edges of the majors with local degree >= high_degree_threshold and
+// append the (major, key, aggregated edge weight) triplets to the output vectors; edges (not
+// majors) are evenly partitioned over the threads (each thread locates its major with a binary
+// search over the edge offsets of the high-degree majors), so a single mega-hub is spread over
+// the entire GPU, and a device-wide sort & reduce by (major, key) replaces the per-thread
+// sequential sort
+template <typename GraphViewType, typename VertexIterator>
+void append_key_aggregated_high_degree_edges(
+  raft::handle_t const& handle,
+  matrix_partition_device_t<GraphViewType> const& matrix_partition,
+  VertexIterator adj_matrix_minor_key_first,
+  typename GraphViewType::edge_type high_degree_threshold,
+  rmm::device_uvector<typename GraphViewType::vertex_type>& major_vertices,
+  rmm::device_uvector<typename GraphViewType::vertex_type>& minor_keys,
+  rmm::device_uvector<typename GraphViewType::weight_type>& key_aggregated_edge_weights)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  // 1. find the high-degree majors and their edge offsets
+
+  rmm::device_uvector<vertex_t> high_degree_major_offsets(matrix_partition.get_major_size(),
+                                                          handle.get_stream());
+  auto last = thrust::copy_if(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    thrust::make_counting_iterator(vertex_t{0}),
+    thrust::make_counting_iterator(matrix_partition.get_major_size()),
+    high_degree_major_offsets.begin(),
+    [matrix_partition, high_degree_threshold] __device__(auto major_offset) {
+      return matrix_partition.get_local_degree(major_offset) >= high_degree_threshold;
+    });
+  high_degree_major_offsets.resize(thrust::distance(high_degree_major_offsets.begin(), last),
+                                   handle.get_stream());
+  if (high_degree_major_offsets.size() == 0) { return; }
+
+  rmm::device_uvector<edge_t> edge_offsets(high_degree_major_offsets.size() + 1,
+                                           handle.get_stream());
+  edge_offsets.set_element_to_zero_async(0, handle.get_stream());
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    high_degree_major_offsets.begin(),
+    high_degree_major_offsets.end(),
+    edge_offsets.begin() + 1,
+    [matrix_partition] __device__(auto major_offset) {
+      return matrix_partition.get_local_degree(major_offset);
+    },
+    thrust::plus<edge_t>());
+  auto num_edges = edge_offsets.back_element(handle.get_stream());
+
+  // 2. expand the edges of the high-degree majors to (major, key, weight) triplets
+
+  rmm::device_uvector<vertex_t> tmp_major_vertices(num_edges, handle.get_stream());
+  rmm::device_uvector<vertex_t> tmp_minor_keys(num_edges, handle.get_stream());
+  rmm::device_uvector<weight_t> tmp_edge_weights(num_edges, handle.get_stream());
+  thrust::for_each(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    thrust::make_counting_iterator(edge_t{0}),
+    thrust::make_counting_iterator(num_edges),
+    [matrix_partition,
+     adj_matrix_minor_key_first,
+     high_degree_major_offsets = high_degree_major_offsets.data(),
+     edge_offsets              = edge_offsets.data(),
+     num_high_degree_majors    = high_degree_major_offsets.size(),
+     tmp_major_vertices        = tmp_major_vertices.data(),
+     tmp_minor_keys            = tmp_minor_keys.data(),
+     tmp_edge_weights          = tmp_edge_weights.data()] __device__(auto i) {
+      auto idx = thrust::distance(
+        edge_offsets + 1,
+        thrust::upper_bound(
+          thrust::seq, edge_offsets + 1, edge_offsets + 1 + num_high_degree_majors, i));
+      auto major_offset = high_degree_major_offsets[idx];
+      auto edge_offset  = matrix_partition.get_local_offset(major_offset) + (i - edge_offsets[idx]);
+      auto minor        = matrix_partition.get_minor_nocheck(edge_offset);
+      // masked out edges get invalid majors (sorted to the end below)
+      tmp_major_vertices[i] = matrix_partition.is_edge_active(edge_offset)
+                                ? matrix_partition.get_major_from_major_offset_nocheck(major_offset)
+                                : invalid_vertex_id<vertex_t>::value;
+      tmp_minor_keys[i] =
+        *(adj_matrix_minor_key_first + matrix_partition.get_minor_offset_from_minor_nocheck(minor));
+      tmp_edge_weights[i] = matrix_partition.get_weights() != nullptr
+                              ? matrix_partition.get_weights()[edge_offset]
+                              : weight_t{1.0};
+    });
+  high_degree_major_offsets.resize(0, handle.get_stream());
+  high_degree_major_offsets.shrink_to_fit(handle.get_stream());
+  edge_offsets.resize(0, handle.get_stream());
+  edge_offsets.shrink_to_fit(handle.get_stream());
+
+  // 3. segmented (by major) reduction over the keys, appended to the output vectors
+
+  auto pair_first = thrust::make_zip_iterator(
+    thrust::make_tuple(tmp_major_vertices.begin(), tmp_minor_keys.begin()));
+  thrust::sort_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      pair_first,
+                      pair_first + tmp_major_vertices.size(),
+                      tmp_edge_weights.begin());
+  auto num_active_edges = tmp_major_vertices.size();
+  if (matrix_partition.get_edge_mask() != nullptr) {
+    num_active_edges = static_cast<size_t>(thrust::distance(
+      tmp_major_vertices.begin(),
+      thrust::lower_bound(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                          tmp_major_vertices.begin(),
+                          tmp_major_vertices.end(),
+                          invalid_vertex_id<vertex_t>::value)));
+  }
+
+  auto old_size = major_vertices.size();
+  major_vertices.resize(old_size + num_active_edges, handle.get_stream());
+  minor_keys.resize(major_vertices.size(), handle.get_stream());
+  key_aggregated_edge_weights.resize(major_vertices.size(), handle.get_stream());
+  auto it = thrust::reduce_by_key(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    pair_first,
+    pair_first + num_active_edges,
+    tmp_edge_weights.begin(),
+    thrust::make_zip_iterator(
+      thrust::make_tuple(major_vertices.begin() + old_size, minor_keys.begin() + old_size)),
+    key_aggregated_edge_weights.begin() + old_size);
+  auto new_size = old_size + static_cast<size_t>(thrust::distance(
+                               key_aggregated_edge_weights.begin() + old_size, thrust::get<1>(it)));
+  major_vertices.resize(new_size, handle.get_stream());
+  minor_keys.resize(new_size, handle.get_stream());
+  key_aggregated_edge_weights.resize(new_size, handle.get_stream());
+}
+
 }  // namespace detail
 
 /**
@@ -204,6 +369,8 @@ void copy_v_transform_reduce_key_aggregated_out_nbr(
   using weight_t = typename GraphViewType::weight_type;
   using value_t  = typename std::iterator_traits<ValueIterator>::value_type;
 
+  detail::profile_range_t profile_range(handle, "copy_v_transform_reduce_key_aggregated_out_nbr");
+
   double constexpr load_factor = 0.7;
 
   // 1. build a cuco::static_map object for the k, v pairs.
@@ -306,6 +473,7 @@ void copy_v_transform_reduce_key_aggregated_out_nbr(
   auto e_op_result_buffer = allocate_dataframe_buffer<T>(0, handle.get_stream());
   for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
     matrix_partition_device_t<GraphViewType> matrix_partition(graph_view, i);
+    detail::add_profile_counter("edges_traversed", matrix_partition.get_number_of_edges());
 
     rmm::device_uvector<vertex_t> tmp_major_vertices(matrix_partition.get_number_of_edges(),
                                                      handle.get_stream());
@@ -314,18 +482,21 @@ void copy_v_transform_reduce_key_aggregated_out_nbr(
                                                                   handle.get_stream());
 
     if (matrix_partition.get_major_size() > 0) {
-      raft::grid_1d_thread_t update_grid(
-        matrix_partition.get_major_size(),
+      auto launch = detail::get_pattern_kernel_launches(
+        handle,
+        pattern_kernel_t::copy_v_transform_reduce_key_aggregated_out_nbr,
         detail::copy_v_transform_reduce_key_aggregated_out_nbr_for_all_block_size,
-        handle.get_device_properties().maxGridSize[0]);
+        matrix_partition.get_major_size(),
+        static_cast<size_t>(matrix_partition.get_number_of_edges()),
+        std::vector<vertex_t>{},
+        false)[0];
 
       auto constexpr invalid_vertex = invalid_vertex_id<vertex_t>::value;
 
-      // FIXME: This is highly inefficient for graphs with high-degree vertices. If we renumber
-      // vertices to insure that rows within a partition are sorted by their out-degree in
-      // decreasing order, we will apply this kernel only to low out-degree vertices.
-      detail::for_all_major_for_all_nbr_low_degree<<<update_grid.num_blocks,
-                                                     update_grid.block_size,
+      // high-degree majors are skipped here and handled by the edge-partitioned path below
+      detail::pattern_kernel_timer_t timer(handle, launch);
+      detail::for_all_major_for_all_nbr_low_degree<<<launch.num_blocks,
+                                                     launch.block_size,
                                                      0,
                                                      handle.get_stream()>>>(
         matrix_partition,
@@ -335,7 +506,9 @@ void copy_v_transform_reduce_key_aggregated_out_nbr(
         tmp_major_vertices.data(),
         tmp_minor_keys.data(),
         tmp_key_aggregated_edge_weights.data(),
-        invalid_vertex);
+        invalid_vertex,
+        static_cast<edge_t>(detail::key_aggregation_high_degree_threshold));
+      timer.stop();
     }
 
     auto triplet_first = thrust::make_zip_iterator(thrust::make_tuple(
@@ -351,6 +524,17 @@ void copy_v_transform_reduce_key_aggregated_out_nbr(
     tmp_minor_keys.resize(tmp_major_vertices.size(), handle.get_stream());
     tmp_key_aggregated_edge_weights.resize(tmp_major_vertices.size(), handle.get_stream());
 
+    if (matrix_partition.get_major_size() > 0) {
+      detail::append_key_aggregated_high_degree_edges(
+        handle,
+        matrix_partition,
+        adj_matrix_col_key_first,
+        static_cast<edge_t>(detail::key_aggregation_high_degree_threshold),
+        tmp_major_vertices,
+        tmp_minor_keys,
+        tmp_key_aggregated_edge_weights);
+    }
+
     if (GraphViewType::is_multi_gpu) {
       auto& comm           = handle.get_comms();
       auto const comm_size = comm.get_size();
@@ -443,8 +627,37 @@ void copy_v_transform_reduce_key_aggregated_out_nbr(
       auto const col_comm_rank = col_comm.get_rank();
       auto const col_comm_size = col_comm.get_size();
 
-      // FIXME: additional optimization is possible if reduce_op is a pure function (and reduce_op
-      // can be mapped to ncclRedOp_t).
+      // if reduce_op can be called in any process, reduce the results locally first; then every
+      // process sends at most one value per major to the owner
+      // FIXME: further optimization is possible if reduce_op can be mapped to ncclRedOp_t (reduce
+      // dense major-size buffers with device_reduce instead of gathering)
+      if (detail::is_pure_reduce_op<ReduceOp>::value) {
+        thrust::sort_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                            tmp_major_vertices.begin(),
+                            tmp_major_vertices.end(),
+                            tmp_e_op_result_buffer_first);
+        rmm::device_uvector<vertex_t> reduced_major_vertices(tmp_major_vertices.size(),
+                                                             handle.get_stream());
+        auto reduced_e_op_result_buffer =
+          allocate_dataframe_buffer<T>(reduced_major_vertices.size(), handle.get_stream());
+        auto it = thrust::reduce_by_key(
+          rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+          tmp_major_vertices.begin(),
+          tmp_major_vertices.end(),
+          tmp_e_op_result_buffer_first,
+          reduced_major_vertices.begin(),
+          get_dataframe_buffer_begin<T>(reduced_e_op_result_buffer),
+          thrust::equal_to<vertex_t>{},
+          reduce_op);
+        auto num_reduced = static_cast<size_t>(
+          thrust::distance(reduced_major_vertices.begin(), thrust::get<0>(it)));
+        reduced_major_vertices.resize(num_reduced, handle.get_stream());
+        reduced_major_vertices.shrink_to_fit(handle.get_stream());
+        resize_dataframe_buffer<T>(reduced_e_op_result_buffer, num_reduced, handle.get_stream());
+        tmp_major_vertices           = std::move(reduced_major_vertices);
+        tmp_e_op_result_buffer       = std::move(reduced_e_op_result_buffer);
+        tmp_e_op_result_buffer_first = get_dataframe_buffer_begin<T>(tmp_e_op_result_buffer);
+      }
 
       auto rx_sizes =
         host_scalar_gather(col_comm, tmp_major_vertices.size(), i, handle.get_stream());
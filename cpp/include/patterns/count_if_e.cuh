@@ -15,11 +15,14 @@
  */
 #pragma once
 
+#include <experimental/edge_property.cuh>
 #include <experimental/graph_view.hpp>
 #include <matrix_partition_device.cuh>
 #include <patterns/edge_op_utils.cuh>
+#include <patterns/kernel_dispatch.cuh>
 #include <utilities/error.hpp>
 #include <utilities/host_scalar_comm.cuh>
+#include <utilities/profiling.hpp>
 
 #include <raft/cudart_utils.h>
 #include <rmm/thrust_rmm_allocator.h>
@@ -36,18 +39,20 @@ namespace experimental {
 
 namespace detail {
 
-// FIXME: block size requires tuning
+// the grid size is selected by the kernel dispatch layer (patterns/kernel_dispatch.cuh)
 int32_t constexpr count_if_e_for_all_block_size = 128;
 
 // FIXME: function names conflict if included with transform_reduce_e.cuh
 template <typename GraphViewType,
           typename AdjMatrixRowValueInputIterator,
           typename AdjMatrixColValueInputIterator,
+          typename EdgeValueInputIterator,
           typename EdgeOp>
 __global__ void for_all_major_for_all_nbr_low_degree(
   matrix_partition_device_t<GraphViewType> matrix_partition,
   AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
   AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+  EdgeValueInputIterator edge_value_input_first,
   typename GraphViewType::edge_type* block_counts,
   EdgeOp e_op)
 {
@@ -60,7 +65,7 @@ __global__ void for_all_major_for_all_nbr_low_degree(
 
   edge_t count{0};
   while (idx < static_cast<size_t>(matrix_partition.get_major_size())) {
-    vertex_t const* indices{nullptr};
+    minor_index_iterator_t<vertex_t, edge_t> indices{};
     weight_t const* weights{nullptr};
     edge_t local_degree{};
     thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(idx);
@@ -72,10 +77,13 @@ __global__ void for_all_major_for_all_nbr_low_degree(
       [&matrix_partition,
        &adj_matrix_row_value_input_first,
        &adj_matrix_col_value_input_first,
+       &edge_value_input_first,
        &e_op,
        idx,
        indices,
        weights] __device__(auto i) {
+        auto edge_offset = *(indices.base()) + i;
+        if (!matrix_partition.is_edge_active(edge_offset)) { return false; }
         auto minor        = indices[i];
         auto weight       = weights != nullptr ? weights[i] : 1.0;
         auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
@@ -98,13 +106,16 @@ __global__ void for_all_major_for_all_nbr_low_degree(
                                       weight,
                                       *(adj_matrix_row_value_input_first + row_offset),
                                       *(adj_matrix_col_value_input_first + col_offset),
+                                      *(edge_value_input_first + edge_offset),
                                       e_op);
 
-        return e_op_result;
+        return static_cast<bool>(e_op_result);
       });
 #else
     // FIXME: delete this once we verify that the code above is not slower than this.
     for (vertex_t i = 0; i < local_degree; ++i) {
+      auto edge_offset = *(indices.base()) + i;
+      if (!matrix_partition.is_edge_active(edge_offset)) { continue; }
       auto minor        = indices[i];
       auto weight       = weights != nullptr ? weights[i] : 1.0;
       auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
@@ -127,6 +138,7 @@ __global__ void for_all_major_for_all_nbr_low_degree(
                                     weight,
                                     *(adj_matrix_row_value_input_first + row_offset),
                                     *(adj_matrix_col_value_input_first + col_offset),
+                                    *(edge_value_input_first + edge_offset),
                                     e_op);
       if (e_op_result) { count++; }
     }
@@ -140,54 +152,28 @@ __global__ void for_all_major_for_all_nbr_low_degree(
   if (threadIdx.x == 0) { *(block_counts + blockIdx.x) = count; }
 }
 
-}  // namespace detail
-
-/**
- * @brief Count the number of edges that satisfies the given predicate.
- *
- * This function is inspired by thrust::count_if().
- *
- * @tparam GraphViewType Type of the passed non-owning graph object.
- * @tparam AdjMatrixRowValueInputIterator Type of the iterator for graph adjacency matrix row
- * input properties.
- * @tparam AdjMatrixColValueInputIterator Type of the iterator for graph adjacency matrix column
- * input properties.
- * @tparam EdgeOp Type of the quaternary (or quinary) edge operator.
- * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
- * handles to various CUDA libraries) to run graph algorithms.
- * @param graph_view Non-owning graph object.
- * @param adj_matrix_row_value_input_first Iterator pointing to the adjacency matrix row input
- * properties for the first (inclusive) row (assigned to this process in multi-GPU).
- * `adj_matrix_row_value_input_last` (exclusive) is deduced as @p adj_matrix_row_value_input_first +
- * @p graph_view.get_number_of_local_adj_matrix_partition_rows().
- * @param adj_matrix_col_value_input_first Iterator pointing to the adjacency matrix column input
- * properties for the first (inclusive) column (assigned to this process in multi-GPU).
- * `adj_matrix_col_value_output_last` (exclusive) is deduced as @p adj_matrix_col_value_output_first
- * + @p graph_view.get_number_of_local_adj_matrix_partition_cols().
- * @param e_op Quaternary (or quinary) operator takes edge source, edge destination, (optional edge
- * weight), *(@p adj_matrix_row_value_input_first + i), and *(@p adj_matrix_col_value_input_first +
- * j) (where i is in [0, graph_view.get_number_of_local_adj_matrix_partition_rows()) and j is in [0,
- * get_number_of_local_adj_matrix_partition_cols())) and returns true if this edge should be
- * included in the returned count.
- * @return GraphViewType::edge_type Number of times @p e_op returned true.
- */
 template <typename GraphViewType,
           typename AdjMatrixRowValueInputIterator,
           typename AdjMatrixColValueInputIterator,
+          typename EdgeValueInputFirstOp,
           typename EdgeOp>
 typename GraphViewType::edge_type count_if_e(
   raft::handle_t const& handle,
   GraphViewType const& graph_view,
   AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
   AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+  EdgeValueInputFirstOp edge_value_input_first_op,
   EdgeOp e_op)
 {
+  profile_range_t profile_range(handle, "count_if_e");
+
   using vertex_t = typename GraphViewType::vertex_type;
   using edge_t   = typename GraphViewType::edge_type;
 
   edge_t count{0};
   for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
     matrix_partition_device_t<GraphViewType> matrix_partition(graph_view, i);
+    add_profile_counter("edges_traversed", matrix_partition.get_number_of_edges());
 
     if (matrix_partition.get_major_size() > 0) {
       auto row_value_input_offset = GraphViewType::is_adj_matrix_transposed
@@ -197,21 +183,29 @@ typename GraphViewType::edge_type count_if_e(
                                       ? matrix_partition.get_major_value_start_offset()
                                       : vertex_t{0};
 
-      raft::grid_1d_thread_t update_grid(matrix_partition.get_major_size(),
-                                         detail::count_if_e_for_all_block_size,
-                                         handle.get_device_properties().maxGridSize[0]);
+      auto launch =
+        get_pattern_kernel_launches(handle,
+                                    pattern_kernel_t::count_if_e,
+                                    count_if_e_for_all_block_size,
+                                    matrix_partition.get_major_size(),
+                                    static_cast<size_t>(matrix_partition.get_number_of_edges()),
+                                    std::vector<vertex_t>{},
+                                    false)[0];
 
-      rmm::device_uvector<edge_t> block_counts(update_grid.num_blocks, handle.get_stream());
+      rmm::device_uvector<edge_t> block_counts(launch.num_blocks, handle.get_stream());
 
-      detail::for_all_major_for_all_nbr_low_degree<<<update_grid.num_blocks,
-                                                     update_grid.block_size,
-                                                     0,
-                                                     handle.get_stream()>>>(
+      pattern_kernel_timer_t timer(handle, launch);
+      for_all_major_for_all_nbr_low_degree<<<launch.num_blocks,
+                                             launch.block_size,
+                                             0,
+                                             handle.get_stream()>>>(
         matrix_partition,
         adj_matrix_row_value_input_first + row_value_input_offset,
         adj_matrix_col_value_input_first + col_value_input_offset,
+        edge_value_input_first_op(i),
         block_counts.data(),
         e_op);
+      timer.stop();
 
       // FIXME: we have several options to implement this. With cooperative group support
       // (https://devblogs.nvidia.com/cooperative-groups/), we can run this synchronization within
@@ -233,5 +227,111 @@ typename GraphViewType::edge_type count_if_e(
   return count;
 }
 
+}  // namespace detail
+
+/**
+ * @brief Count the number of edges that satisfies the given predicate.
+ *
+ * This function is inspired by thrust::count_if().
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam AdjMatrixRowValueInputIterator Type of the iterator for graph adjacency matrix row
+ * input properties.
+ * @tparam AdjMatrixColValueInputIterator Type of the iterator for graph adjacency matrix column
+ * input properties.
+ * @tparam EdgeOp Type of the quaternary (or quinary) edge operator.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param adj_matrix_row_value_input_first Iterator pointing to the adjacency matrix row input
+ * properties for the first (inclusive) row (assigned to this process in multi-GPU).
+ * `adj_matrix_row_value_input_last` (exclusive) is deduced as @p adj_matrix_row_value_input_first +
+ * @p graph_view.get_number_of_local_adj_matrix_partition_rows().
+ * @param adj_matrix_col_value_input_first Iterator pointing to the adjacency matrix column input
+ * properties for the first (inclusive) column (assigned to this process in multi-GPU).
+ * `adj_matrix_col_value_output_last` (exclusive) is deduced as @p adj_matrix_col_value_output_first
+ * + @p graph_view.get_number_of_local_adj_matrix_partition_cols().
+ * @param e_op Quaternary (or quinary) operator takes edge source, edge destination, (optional edge
+ * weight), *(@p adj_matrix_row_value_input_first + i), and *(@p adj_matrix_col_value_input_first +
+ * j) (where i is in [0, graph_view.get_number_of_local_adj_matrix_partition_rows()) and j is in [0,
+ * get_number_of_local_adj_matrix_partition_cols())) and returns true if this edge should be
+ * included in the returned count.
+ * @return GraphViewType::edge_type Number of times @p e_op returned true.
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputIterator,
+          typename AdjMatrixColValueInputIterator,
+          typename EdgeOp>
+typename GraphViewType::edge_type count_if_e(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
+  AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+  EdgeOp e_op)
+{
+  return detail::count_if_e(handle,
+                            graph_view,
+                            adj_matrix_row_value_input_first,
+                            adj_matrix_col_value_input_first,
+                            detail::no_edge_value_input_first_t{},
+                            e_op);
+}
+
+/**
+ * @brief Count the number of edges that satisfies the given predicate (which also takes the edge
+ * property value).
+ *
+ * This function is an overload of count_if_e() with a typed per-edge property (see
+ * edge_property.cuh), so edges can be filtered by property inside the kernel without constructing
+ * an intermediate graph.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam AdjMatrixRowValueInputIterator Type of the iterator for graph adjacency matrix row
+ * input properties.
+ * @tparam AdjMatrixColValueInputIterator Type of the iterator for graph adjacency matrix column
+ * input properties.
+ * @tparam T Type of the edge property values.
+ * @tparam EdgeOp Type of the quinary (or senary) edge operator.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param adj_matrix_row_value_input_first Iterator pointing to the adjacency matrix row input
+ * properties for the first (inclusive) row (assigned to this process in multi-GPU).
+ * @param adj_matrix_col_value_input_first Iterator pointing to the adjacency matrix column input
+ * properties for the first (inclusive) column (assigned to this process in multi-GPU).
+ * @param edge_value_input Non-owning view of the edge property (created for @p graph_view).
+ * @param e_op Quinary (or senary) operator takes edge source, edge destination, (optional edge
+ * weight), *(@p adj_matrix_row_value_input_first + i), *(@p adj_matrix_col_value_input_first +
+ * j), and the edge property value and returns true if this edge should be included in the
+ * returned count.
+ * @return GraphViewType::edge_type Number of times @p e_op returned true.
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputIterator,
+          typename AdjMatrixColValueInputIterator,
+          typename T,
+          typename EdgeOp>
+typename GraphViewType::edge_type count_if_e(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
+  AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+  edge_property_view_t<typename GraphViewType::edge_type, T> const& edge_value_input,
+  EdgeOp e_op)
+{
+  CUGRAPH_EXPECTS(edge_value_input.get_number_of_local_adj_matrix_partitions() ==
+                    graph_view.get_number_of_local_adj_matrix_partitions(),
+                  "Invalid input argument: edge_value_input is not created for graph_view.");
+
+  return detail::count_if_e(
+    handle,
+    graph_view,
+    adj_matrix_row_value_input_first,
+    adj_matrix_col_value_input_first,
+    detail::edge_property_value_input_first_t<typename GraphViewType::edge_type, T>{
+      edge_value_input},
+    e_op);
+}
+
 }  // namespace experimental
 }  // namespace cugraph
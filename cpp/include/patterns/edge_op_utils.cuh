@@ -20,6 +20,7 @@
 #include <raft/device_atomics.cuh>
 
 #include <thrust/detail/type_traits/iterator/is_discard_iterator.h>
+#include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/tuple.h>
 #include <cub/cub.cuh>
@@ -42,6 +43,23 @@ struct is_valid_edge_op<
   static constexpr bool valid = true;
 };
 
+// edge value type for the patterns invoked without an edge property (see edge_property.cuh); edge
+// operators are never passed a no_edge_value_t argument
+struct no_edge_value_t {
+};
+
+namespace detail {
+
+// returns the edge value input iterator for the given local adjacency matrix partition
+struct no_edge_value_input_first_t {
+  auto operator()(size_t adj_matrix_partition_idx) const
+  {
+    return thrust::make_constant_iterator(no_edge_value_t{});
+  }
+};
+
+}  // namespace detail
+
 template <typename GraphViewType,
           typename AdjMatrixRowValueInputIterator,
           typename AdjMatrixColValueInputIterator,
@@ -75,6 +93,50 @@ struct evaluate_edge_op {
   {
     return e(r, c, rv, cv);
   }
+
+  // edge operators taking the edge property value (ev) as the last argument
+
+  template <typename EV,
+            typename V = vertex_type,
+            typename W = weight_type,
+            typename R = row_value_type,
+            typename C = col_value_type,
+            typename E = EdgeOp>
+  __device__ std::enable_if_t<
+    !std::is_same<EV, no_edge_value_t>::value &&
+      is_valid_edge_op<typename std::result_of<E(V, V, W, R, C, EV)>>::valid,
+    typename std::result_of<E(V, V, W, R, C, EV)>::type>
+  compute(V r, V c, W w, R rv, C cv, EV ev, E e)
+  {
+    return e(r, c, w, rv, cv, ev);
+  }
+
+  template <typename EV,
+            typename V = vertex_type,
+            typename W = weight_type,
+            typename R = row_value_type,
+            typename C = col_value_type,
+            typename E = EdgeOp>
+  __device__ std::enable_if_t<!std::is_same<EV, no_edge_value_t>::value &&
+                                is_valid_edge_op<typename std::result_of<E(V, V, R, C, EV)>>::valid,
+                              typename std::result_of<E(V, V, R, C, EV)>::type>
+  compute(V r, V c, W w, R rv, C cv, EV ev, E e)
+  {
+    return e(r, c, rv, cv, ev);
+  }
+
+  // patterns invoked without an edge property
+  template <typename EV,
+            typename V = vertex_type,
+            typename W = weight_type,
+            typename R = row_value_type,
+            typename C = col_value_type,
+            typename E = EdgeOp,
+            std::enable_if_t<std::is_same<EV, no_edge_value_t>::value>* = nullptr>
+  __device__ auto compute(V r, V c, W w, R rv, C cv, EV ev, E e)
+  {
+    return compute(r, c, w, rv, cv, e);
+  }
 };
 
 template <typename T>
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <matrix_partition_device.cuh>
+#include <utilities/error.hpp>
+#include <utilities/graph_storage.hpp>
+
+#include <raft/cudart_utils.h>
+#include <rmm/thrust_rmm_allocator.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+namespace detail {
+
+template <typename vertex_t, typename edge_t>
+struct graph_storage_tile_t {
+  vertex_t major_offset_first{0};
+  vertex_t major_offset_last{0};
+  edge_t edge_first{0};  // relevant only if prefetch is true
+  edge_t edge_last{0};   // relevant only if prefetch is true
+  bool prefetch{false};
+};
+
+// split the majors in [major_offset_first, major_offset_last) of the matrix partition to tiles of
+// about managed_storage_tile_size edges if the edges are in managed memory (a single tile
+// otherwise); the tile boundaries are aligned to majors, so a tile starting with a high degree
+// major can have more edges than the tile size
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::vector<graph_storage_tile_t<vertex_t, edge_t>> get_graph_storage_tiles(
+  raft::handle_t const& handle,
+  matrix_partition_device_base_t<vertex_t, edge_t, weight_t> const& matrix_partition,
+  vertex_t major_offset_first,
+  vertex_t major_offset_last)
+{
+  std::vector<graph_storage_tile_t<vertex_t, edge_t>> tiles{
+    graph_storage_tile_t<vertex_t, edge_t>{major_offset_first, major_offset_last}};
+  auto edge_ptr = matrix_partition.get_local_indices() != nullptr
+                    ? static_cast<void const*>(matrix_partition.get_local_indices())
+                    : static_cast<void const*>(matrix_partition.get_indices());
+  if ((major_offset_last <= major_offset_first) ||
+      (major_offset_last > matrix_partition.get_major_hypersparse_first_offset()) ||
+      !is_managed_memory(edge_ptr)) {
+    return tiles;
+  }
+
+  auto offsets = matrix_partition.get_offsets();
+  edge_t edge_first{};
+  edge_t edge_last{};
+  raft::update_host(&edge_first, offsets + major_offset_first, 1, handle.get_stream());
+  raft::update_host(&edge_last, offsets + major_offset_last, 1, handle.get_stream());
+  CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+  auto num_tiles = std::max(
+    (static_cast<size_t>(edge_last - edge_first) + managed_storage_tile_size - 1) /
+      managed_storage_tile_size,
+    size_t{1});
+
+  // the major containing the first edge of every tile but the first, and its first edge
+  rmm::device_uvector<vertex_t> d_majors(num_tiles - 1, handle.get_stream());
+  rmm::device_uvector<edge_t> d_edges(d_majors.size(), handle.get_stream());
+  thrust::transform(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    thrust::make_counting_iterator(size_t{1}),
+    thrust::make_counting_iterator(num_tiles),
+    thrust::make_zip_iterator(thrust::make_tuple(d_majors.begin(), d_edges.begin())),
+    [offsets, major_offset_first, major_offset_last, edge_first] __device__(auto i) {
+      auto target = edge_first + static_cast<edge_t>(i * managed_storage_tile_size);
+      auto major_offset =
+        static_cast<vertex_t>(thrust::distance(
+          offsets,
+          thrust::upper_bound(
+            thrust::seq, offsets + major_offset_first, offsets + major_offset_last, target))) -
+        1;
+      return thrust::make_tuple(major_offset, offsets[major_offset]);
+    });
+  std::vector<vertex_t> h_majors(d_majors.size());
+  std::vector<edge_t> h_edges(h_majors.size());
+  raft::update_host(h_majors.data(), d_majors.data(), d_majors.size(), handle.get_stream());
+  raft::update_host(h_edges.data(), d_edges.data(), d_edges.size(), handle.get_stream());
+  CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+  tiles.clear();
+  auto tile_major_offset_first = major_offset_first;
+  auto tile_edge_first         = edge_first;
+  for (size_t i = 0; i <= h_majors.size(); ++i) {
+    auto tile_major_offset_last = i < h_majors.size() ? h_majors[i] : major_offset_last;
+    auto tile_edge_last         = i < h_edges.size() ? h_edges[i] : edge_last;
+    if (tile_major_offset_last > tile_major_offset_first) {
+      tiles.push_back(graph_storage_tile_t<vertex_t, edge_t>{
+        tile_major_offset_first, tile_major_offset_last, tile_edge_first, tile_edge_last, true});
+      tile_major_offset_first = tile_major_offset_last;
+      tile_edge_first         = tile_edge_last;
+    }
+  }
+
+  return tiles;
+}
+
+// prefetch the edges (minors and weights) of the tile to the device
+template <typename vertex_t, typename edge_t, typename weight_t>
+void prefetch_graph_storage_tile(
+  raft::handle_t const& handle,
+  matrix_partition_device_base_t<vertex_t, edge_t, weight_t> const& matrix_partition,
+  graph_storage_tile_t<vertex_t, edge_t> const& tile)
+{
+  if (!tile.prefetch) { return; }
+
+  auto num_edges = static_cast<size_t>(tile.edge_last - tile.edge_first);
+  if (matrix_partition.get_local_indices() != nullptr) {
+    prefetch_to_device(matrix_partition.get_local_indices() + tile.edge_first,
+                       num_edges * sizeof(uint32_t),
+                       handle.get_stream());
+  } else {
+    prefetch_to_device(matrix_partition.get_indices() + tile.edge_first,
+                       num_edges * sizeof(vertex_t),
+                       handle.get_stream());
+  }
+  if (matrix_partition.get_weights() != nullptr) {
+    prefetch_to_device(matrix_partition.get_weights() + tile.edge_first,
+                       num_edges * sizeof(weight_t),
+                       handle.get_stream());
+  }
+}
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cugraph
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <experimental/graph_view.hpp>
+#include <utilities/error.hpp>
+
+#include <raft/handle.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+
+// Kernel dispatch layer shared by the edge-iterating patterns. For every kernel launch, a pattern
+// asks for the launch configurations covering its major range. The range is split along the
+// degree-based segment offsets (if the graph was constructed with sorted_by_degree = true) and
+// every segment is mapped to a thread-, warp-, or block-per-major kernel with a grid size
+// selected for the current GPU architecture.
+//
+// The selections come from a process-wide tuning table keyed by (pattern, GPU architecture,
+// degree segment, log2 number of majors, log2 average degree). Entries missing from the table
+// fall back to a degree-based heuristic. In autotune mode, successive calls with the same key
+// cycle through the candidate configurations, time every launch, and record the fastest one
+// once all candidates are measured. The recorded table can be saved and loaded later (e.g. after
+// an offline autotune run over representative graphs), so production runs use the recorded
+// choices without the timing overhead.
+
+enum class pattern_kernel_t : int32_t {
+  copy_v_transform_reduce_nbr = 0,
+  copy_v_transform_reduce_key_aggregated_out_nbr,
+  count_if_e,
+  transform_reduce_e,
+  transform_reduce_by_adj_matrix_row_col_key_e,
+  num_pattern_kernels
+};
+
+enum class major_mapping_t : int32_t { thread_per_major = 0, warp_per_major, block_per_major };
+
+/**
+ * @brief Enable or disable the pattern kernel autotune mode.
+ *
+ * Autotune mode synchronizes the stream after every pattern kernel launch to time it; this is
+ * intended for offline tuning runs. Autotune mode is also enabled if the CUGRAPH_PATTERN_AUTOTUNE
+ * environment variable is set to a non-zero value.
+ *
+ * @param enable Flag to enable (true) or disable (false) autotune mode.
+ */
+void set_pattern_kernel_autotune(bool enable);
+
+/**
+ * @brief Query whether the pattern kernel autotune mode is enabled.
+ *
+ * @return bool true if autotune mode is enabled, false otherwise.
+ */
+bool is_pattern_kernel_autotune_enabled();
+
+/**
+ * @brief Load recorded pattern kernel choices from a file (written by
+ * save_pattern_kernel_tuning_table) and merge them into the in-memory tuning table.
+ *
+ * The file named by the CUGRAPH_PATTERN_TUNING_FILE environment variable (if set) is loaded on
+ * the first pattern kernel launch.
+ *
+ * @param path Tuning table file path.
+ */
+void load_pattern_kernel_tuning_table(std::string const& path);
+
+/**
+ * @brief Save the pattern kernel choices recorded so far (only the keys for which all candidate
+ * configurations have been timed) to a file.
+ *
+ * @param path Tuning table file path.
+ */
+void save_pattern_kernel_tuning_table(std::string const& path);
+
+/**
+ * @brief Remove every recorded choice and in-progress autotune measurement.
+ */
+void clear_pattern_kernel_tuning_table();
+
+namespace detail {
+
+// degree segment of a launch; unsegmented if the graph is not sorted by degree
+int32_t constexpr unsegmented_major_range{-1};
+
+struct pattern_kernel_launch_t {
+  size_t major_range_first{0};  // relative to the first major of the range passed to dispatch
+  size_t major_range_last{0};
+  major_mapping_t mapping{major_mapping_t::thread_per_major};
+  int32_t block_size{0};
+  int32_t num_blocks{0};
+
+  // to report the measured time back to the tuning table in autotune mode
+  pattern_kernel_t pattern{pattern_kernel_t::copy_v_transform_reduce_nbr};
+  int32_t arch{0};
+  int32_t segment{unsegmented_major_range};
+  int32_t size_bucket{0};
+  int32_t degree_bucket{0};
+  int32_t candidate_idx{-1};  // -1 if not timed
+};
+
+// returns the launches (with non-empty major ranges) covering [0, major_range_size); segment
+// offsets are relative to the first major of the range (and ignored if empty); the
+// warp/block-per-major mappings are considered only if the pattern provides such kernels;
+// block_size is the compile-time block size of the pattern's kernels
+std::vector<pattern_kernel_launch_t> get_pattern_kernel_launches(
+  raft::handle_t const& handle,
+  pattern_kernel_t pattern,
+  int32_t block_size,
+  size_t major_range_size,
+  size_t num_edges,
+  std::vector<size_t> const& segment_offsets,
+  bool multiple_mappings_supported);
+
+template <typename vertex_t>
+std::vector<pattern_kernel_launch_t> get_pattern_kernel_launches(
+  raft::handle_t const& handle,
+  pattern_kernel_t pattern,
+  int32_t block_size,
+  vertex_t major_range_size,
+  size_t num_edges,
+  std::vector<vertex_t> const& segment_offsets,
+  bool multiple_mappings_supported)
+{
+  return get_pattern_kernel_launches(
+    handle,
+    pattern,
+    block_size,
+    static_cast<size_t>(major_range_size),
+    num_edges,
+    std::vector<size_t>(segment_offsets.begin(), segment_offsets.end()),
+    multiple_mappings_supported);
+}
+
+// a no-op unless the launch is being timed in autotune mode
+class pattern_kernel_timer_t {
+ public:
+  pattern_kernel_timer_t(raft::handle_t const& handle, pattern_kernel_launch_t const& launch);
+  ~pattern_kernel_timer_t();
+
+  pattern_kernel_timer_t(pattern_kernel_timer_t const&) = delete;
+  pattern_kernel_timer_t& operator=(pattern_kernel_timer_t const&) = delete;
+
+  // record the elapsed time of the work enqueued since construction
+  void stop();
+
+ private:
+  cudaStream_t stream_{};
+  pattern_kernel_launch_t launch_{};
+  cudaEvent_t start_{};
+  cudaEvent_t stop_{};
+  bool timing_{false};
+};
+
+}  // namespace detail
+
+}  // namespace experimental
+}  // namespace cugraph
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <type_traits>
+
 namespace cugraph {
 namespace experimental {
 namespace reduce_op {
@@ -43,6 +45,32 @@ struct min {
   }
 };
 
+// FIXME: thrust::plus can replace this.
+// reducing N elements (operator + should be defined between any two elements), the sum of the
+// elements should be computed.
+template <typename T>
+struct plus {
+  using type                          = T;
+  static constexpr bool pure_function = true;  // this can be called in any process
+
+  __host__ __device__ T operator()(T const& lhs, T const& rhs) const { return lhs + rhs; }
+};
+
 }  // namespace reduce_op
+
+namespace detail {
+
+// true if ReduceOp declares pure_function = true (reduce_op can be called in any process, so
+// patterns may pre-reduce partial results before sending them to the owning process)
+template <typename ReduceOp, typename = void>
+struct is_pure_reduce_op : std::false_type {
+};
+
+template <typename ReduceOp>
+struct is_pure_reduce_op<ReduceOp, std::enable_if_t<ReduceOp::pure_function>> : std::true_type {
+};
+
+}  // namespace detail
+
 }  // namespace experimental
 }  // namespace cugraph
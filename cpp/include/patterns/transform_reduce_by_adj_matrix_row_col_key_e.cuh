@@ -16,11 +16,14 @@
 #pragma once
 
 #include <experimental/detail/graph_utils.cuh>
+#include <experimental/graph.hpp>
 #include <experimental/graph_view.hpp>
 #include <matrix_partition_device.cuh>
 #include <patterns/edge_op_utils.cuh>
+#include <patterns/kernel_dispatch.cuh>
 #include <utilities/dataframe_buffer.cuh>
 #include <utilities/error.hpp>
+#include <utilities/profiling.hpp>
 #include <utilities/shuffle_comm.cuh>
 
 #include <raft/handle.hpp>
@@ -32,7 +35,7 @@ namespace experimental {
 
 namespace detail {
 
-// FIXME: block size requires tuning
+// the grid size is selected by the kernel dispatch layer (patterns/kernel_dispatch.cuh)
 int32_t constexpr transform_reduce_by_key_e_for_all_block_size = 128;
 
 template <bool adj_matrix_row_key,
@@ -62,7 +65,7 @@ __global__ void for_all_major_for_all_nbr_low_degree(
   auto idx                = static_cast<size_t>(tid);
 
   while (idx < static_cast<size_t>(major_last - major_first)) {
-    vertex_t const* indices{nullptr};
+    minor_index_iterator_t<vertex_t, edge_t> indices{};
     weight_t const* weights{nullptr};
     edge_t local_degree{};
     auto major_offset = major_start_offset + idx;
@@ -77,6 +80,10 @@ __global__ void for_all_major_for_all_nbr_low_degree(
                            major_offset,
                            indices,
                            weights] __device__(auto i) {
+        // masked out edges are marked with invalid keys (and removed before the reduction)
+        if (!matrix_partition.is_edge_active(*(indices.base()) + i)) {
+          return thrust::make_tuple(invalid_vertex_id<vertex_t>::value, T{});
+        }
         auto minor        = indices[i];
         auto weight       = weights != nullptr ? weights[i] : weight_t{1.0};
         auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
@@ -108,7 +115,7 @@ __global__ void for_all_major_for_all_nbr_low_degree(
                                       *(adj_matrix_col_value_input_first + col_offset),
                                       e_op);
 
-        return thrust::make_tuple(key, e_op_result);
+        return thrust::make_tuple(key, static_cast<T>(e_op_result));
       };
 
       auto local_offset = matrix_partition.get_local_offset(major_offset);
@@ -171,6 +178,10 @@ transform_reduce_by_adj_matrix_row_col_key_e(
   EdgeOp e_op,
   T init)
 {
+  profile_range_t profile_range(handle,
+                                adj_matrix_row_key ? "transform_reduce_by_adj_matrix_row_key_e"
+                                                   : "transform_reduce_by_adj_matrix_col_key_e");
+
   static_assert(is_arithmetic_or_thrust_tuple_of_arithmetic<T>::value);
   static_assert(std::is_same<typename std::iterator_traits<VertexIterator>::value_type,
                              typename GraphViewType::vertex_type>::value);
@@ -183,6 +194,7 @@ transform_reduce_by_adj_matrix_row_col_key_e(
   auto value_buffer = allocate_dataframe_buffer<T>(0, handle.get_stream());
   for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
     matrix_partition_device_t<GraphViewType> matrix_partition(graph_view, i);
+    add_profile_counter("edges_traversed", matrix_partition.get_number_of_edges());
 
     int comm_root_rank = 0;
     if (GraphViewType::is_multi_gpu) {
@@ -209,9 +221,14 @@ transform_reduce_by_adj_matrix_row_col_key_e(
     auto tmp_value_buffer = allocate_dataframe_buffer<T>(tmp_keys.size(), handle.get_stream());
 
     if (graph_view.get_vertex_partition_size(comm_root_rank) > 0) {
-      raft::grid_1d_thread_t update_grid(graph_view.get_vertex_partition_size(comm_root_rank),
-                                         detail::transform_reduce_by_key_e_for_all_block_size,
-                                         handle.get_device_properties().maxGridSize[0]);
+      auto launch = detail::get_pattern_kernel_launches(
+        handle,
+        pattern_kernel_t::transform_reduce_by_adj_matrix_row_col_key_e,
+        detail::transform_reduce_by_key_e_for_all_block_size,
+        graph_view.get_vertex_partition_size(comm_root_rank),
+        static_cast<size_t>(num_edges),
+        std::vector<vertex_t>{},
+        false)[0];
 
       auto row_value_input_offset = GraphViewType::is_adj_matrix_transposed
                                       ? vertex_t{0}
@@ -223,8 +240,9 @@ transform_reduce_by_adj_matrix_row_col_key_e(
       // FIXME: This is highly inefficient for graphs with high-degree vertices. If we renumber
       // vertices to insure that rows within a partition are sorted by their out-degree in
       // decreasing order, we will apply this kernel only to low out-degree vertices.
+      detail::pattern_kernel_timer_t timer(handle, launch);
       detail::for_all_major_for_all_nbr_low_degree<adj_matrix_row_key>
-        <<<update_grid.num_blocks, update_grid.block_size, 0, handle.get_stream()>>>(
+        <<<launch.num_blocks, launch.block_size, 0, handle.get_stream()>>>(
           matrix_partition,
           graph_view.get_vertex_partition_first(comm_root_rank),
           graph_view.get_vertex_partition_last(comm_root_rank),
@@ -235,6 +253,22 @@ transform_reduce_by_adj_matrix_row_col_key_e(
           e_op,
           tmp_keys.data(),
           get_dataframe_buffer_begin<T>(tmp_value_buffer));
+      timer.stop();
+
+      if (graph_view.has_edge_mask()) {
+        auto pair_first = thrust::make_zip_iterator(
+          thrust::make_tuple(tmp_keys.begin(), get_dataframe_buffer_begin<T>(tmp_value_buffer)));
+        auto num_active_edges = static_cast<size_t>(thrust::distance(
+          pair_first,
+          thrust::remove_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                            pair_first,
+                            pair_first + tmp_keys.size(),
+                            [] __device__(auto pair) {
+                              return thrust::get<0>(pair) == invalid_vertex_id<vertex_t>::value;
+                            })));
+        tmp_keys.resize(num_active_edges, handle.get_stream());
+        resize_dataframe_buffer<T>(tmp_value_buffer, num_active_edges, handle.get_stream());
+      }
     }
     std::tie(tmp_keys, tmp_value_buffer) = reduce_to_unique_kv_pairs<vertex_t, T>(
       std::move(tmp_keys), std::move(tmp_value_buffer), handle.get_stream());
@@ -15,11 +15,14 @@
  */
 #pragma once
 
+#include <experimental/edge_property.cuh>
 #include <experimental/graph_view.hpp>
 #include <matrix_partition_device.cuh>
 #include <patterns/edge_op_utils.cuh>
+#include <patterns/kernel_dispatch.cuh>
 #include <utilities/error.hpp>
 #include <utilities/host_scalar_comm.cuh>
+#include <utilities/profiling.hpp>
 
 #include <raft/cudart_utils.h>
 #include <rmm/thrust_rmm_allocator.h>
@@ -35,18 +38,20 @@ namespace experimental {
 
 namespace detail {
 
-// FIXME: block size requires tuning
+// the grid size is selected by the kernel dispatch layer (patterns/kernel_dispatch.cuh)
 int32_t constexpr transform_reduce_e_for_all_block_size = 128;
 
 template <typename GraphViewType,
           typename AdjMatrixRowValueInputIterator,
           typename AdjMatrixColValueInputIterator,
+          typename EdgeValueInputIterator,
           typename BlockResultIterator,
           typename EdgeOp>
 __global__ void for_all_major_for_all_nbr_low_degree(
   matrix_partition_device_t<GraphViewType> matrix_partition,
   AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
   AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+  EdgeValueInputIterator edge_value_input_first,
   BlockResultIterator block_result_first,
   EdgeOp e_op)
 {
@@ -60,7 +65,7 @@ __global__ void for_all_major_for_all_nbr_low_degree(
 
   e_op_result_t e_op_result_sum{};
   while (idx < static_cast<size_t>(matrix_partition.get_major_size())) {
-    vertex_t const* indices{nullptr};
+    minor_index_iterator_t<vertex_t, edge_t> indices{};
     weight_t const* weights{nullptr};
     edge_t local_degree{};
     thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(idx);
@@ -72,10 +77,13 @@ __global__ void for_all_major_for_all_nbr_low_degree(
       [&matrix_partition,
        &adj_matrix_row_value_input_first,
        &adj_matrix_col_value_input_first,
+       &edge_value_input_first,
        &e_op,
        idx,
        indices,
        weights] __device__(auto i) {
+        auto edge_offset = *(indices.base()) + i;
+        if (!matrix_partition.is_edge_active(edge_offset)) { return e_op_result_t{}; }
         auto minor        = indices[i];
         auto weight       = weights != nullptr ? weights[i] : weight_t{1.0};
         auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
@@ -89,16 +97,18 @@ __global__ void for_all_major_for_all_nbr_low_degree(
           GraphViewType::is_adj_matrix_transposed ? minor_offset : static_cast<vertex_t>(idx);
         auto col_offset =
           GraphViewType::is_adj_matrix_transposed ? static_cast<vertex_t>(idx) : minor_offset;
-        return evaluate_edge_op<GraphViewType,
-                                AdjMatrixRowValueInputIterator,
-                                AdjMatrixColValueInputIterator,
-                                EdgeOp>()
-          .compute(row,
-                   col,
-                   weight,
-                   *(adj_matrix_row_value_input_first + row_offset),
-                   *(adj_matrix_col_value_input_first + col_offset),
-                   e_op);
+        return static_cast<e_op_result_t>(
+          evaluate_edge_op<GraphViewType,
+                           AdjMatrixRowValueInputIterator,
+                           AdjMatrixColValueInputIterator,
+                           EdgeOp>()
+            .compute(row,
+                     col,
+                     weight,
+                     *(adj_matrix_row_value_input_first + row_offset),
+                     *(adj_matrix_col_value_input_first + col_offset),
+                     *(edge_value_input_first + edge_offset),
+                     e_op));
       },
       e_op_result_t{},
       [] __device__(auto lhs, auto rhs) { return plus_edge_op_result(lhs, rhs); });
@@ -107,6 +117,8 @@ __global__ void for_all_major_for_all_nbr_low_degree(
 #else
     // FIXME: delete this once we verify that the code above is not slower than this.
     for (vertex_t i = 0; i < local_degree; ++i) {
+      auto edge_offset = *(indices.base()) + i;
+      if (!matrix_partition.is_edge_active(edge_offset)) { continue; }
       auto minor        = indices[i];
       auto weight       = weights != nullptr ? weights[i] : weight_t{1.0};
       auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
@@ -129,6 +141,7 @@ __global__ void for_all_major_for_all_nbr_low_degree(
                                     weight,
                                     *(adj_matrix_row_value_input_first + row_offset),
                                     *(adj_matrix_col_value_input_first + col_offset),
+                                    *(edge_value_input_first + edge_offset),
                                     e_op);
       e_op_result_sum = plus_edge_op_result(e_op_result_sum, e_op_result);
     }
@@ -142,50 +155,22 @@ __global__ void for_all_major_for_all_nbr_low_degree(
   if (threadIdx.x == 0) { *(block_result_first + blockIdx.x) = e_op_result_sum; }
 }
 
-}  // namespace detail
-
-/**
- * @brief Iterate over the entire set of edges and reduce @p edge_op outputs.
- *
- * This function is inspired by thrust::transform_reduce().
- *
- * @tparam GraphViewType Type of the passed non-owning graph object.
- * @tparam AdjMatrixRowValueInputIterator Type of the iterator for graph adjacency matrix row
- * input properties.
- * @tparam AdjMatrixColValueInputIterator Type of the iterator for graph adjacency matrix column
- * input properties.
- * @tparam EdgeOp Type of the quaternary (or quinary) edge operator.
- * @tparam T Type of the initial value.
- * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
- * handles to various CUDA libraries) to run graph algorithms.
- * @param graph_view Non-owning graph object.
- * @param adj_matrix_row_value_input_first Iterator pointing to the adjacency matrix row input
- * properties for the first (inclusive) row (assigned to this process in multi-GPU).
- * `adj_matrix_row_value_input_last` (exclusive) is deduced as @p adj_matrix_row_value_input_first +
- * @p graph_view.get_number_of_local_adj_matrix_partition_rows().
- * @param adj_matrix_col_value_input_first Iterator pointing to the adjacency matrix column input
- * properties for the first (inclusive) column (assigned to this process in multi-GPU).
- * `adj_matrix_col_value_output_last` (exclusive) is deduced as @p adj_matrix_col_value_output_first
- * + @p graph_view.get_number_of_local_adj_matrix_partition_cols().
- * @param e_op Quaternary (or quinary) operator takes edge source, edge destination, (optional edge
- * weight), *(@p adj_matrix_row_value_input_first + i), and *(@p adj_matrix_col_value_input_first +
- * j) (where i is in [0, graph_view.get_number_of_local_adj_matrix_partition_rows()) and j is in [0,
- * get_number_of_local_adj_matrix_partition_cols())) and returns a transformed value to be reduced.
- * @param init Initial value to be added to the transform-reduced input vertex properties.
- * @return T Reduction of the @p edge_op outputs.
- */
 template <typename GraphViewType,
           typename AdjMatrixRowValueInputIterator,
           typename AdjMatrixColValueInputIterator,
+          typename EdgeValueInputFirstOp,
           typename EdgeOp,
           typename T>
 T transform_reduce_e(raft::handle_t const& handle,
                      GraphViewType const& graph_view,
                      AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
                      AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+                     EdgeValueInputFirstOp edge_value_input_first_op,
                      EdgeOp e_op,
                      T init)
 {
+  profile_range_t profile_range(handle, "transform_reduce_e");
+
   static_assert(is_arithmetic_or_thrust_tuple_of_arithmetic<T>::value);
 
   using vertex_t = typename GraphViewType::vertex_type;
@@ -193,6 +178,7 @@ T transform_reduce_e(raft::handle_t const& handle,
   T result{};
   for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
     matrix_partition_device_t<GraphViewType> matrix_partition(graph_view, i);
+    add_profile_counter("edges_traversed", matrix_partition.get_number_of_edges());
 
     if (matrix_partition.get_major_size() > 0) {
       auto row_value_input_offset = GraphViewType::is_adj_matrix_transposed
@@ -202,22 +188,30 @@ T transform_reduce_e(raft::handle_t const& handle,
                                       ? matrix_partition.get_major_value_start_offset()
                                       : vertex_t{0};
 
-      raft::grid_1d_thread_t update_grid(matrix_partition.get_major_size(),
-                                         detail::transform_reduce_e_for_all_block_size,
-                                         handle.get_device_properties().maxGridSize[0]);
+      auto launch =
+        get_pattern_kernel_launches(handle,
+                                    pattern_kernel_t::transform_reduce_e,
+                                    transform_reduce_e_for_all_block_size,
+                                    matrix_partition.get_major_size(),
+                                    static_cast<size_t>(matrix_partition.get_number_of_edges()),
+                                    std::vector<vertex_t>{},
+                                    false)[0];
 
       auto block_result_buffer =
-        allocate_dataframe_buffer<T>(update_grid.num_blocks, handle.get_stream());
+        allocate_dataframe_buffer<T>(launch.num_blocks, handle.get_stream());
 
-      detail::for_all_major_for_all_nbr_low_degree<<<update_grid.num_blocks,
-                                                     update_grid.block_size,
-                                                     0,
-                                                     handle.get_stream()>>>(
+      pattern_kernel_timer_t timer(handle, launch);
+      for_all_major_for_all_nbr_low_degree<<<launch.num_blocks,
+                                             launch.block_size,
+                                             0,
+                                             handle.get_stream()>>>(
         matrix_partition,
         adj_matrix_row_value_input_first + row_value_input_offset,
         adj_matrix_col_value_input_first + col_value_input_offset,
+        edge_value_input_first_op(i),
         get_dataframe_buffer_begin<T>(block_result_buffer),
         e_op);
+      timer.stop();
 
       // FIXME: we have several options to implement this. With cooperative group support
       // (https://devblogs.nvidia.com/cooperative-groups/), we can run this synchronization within
@@ -227,7 +221,7 @@ T transform_reduce_e(raft::handle_t const& handle,
       auto partial_result =
         thrust::reduce(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
                        get_dataframe_buffer_begin<T>(block_result_buffer),
-                       get_dataframe_buffer_begin<T>(block_result_buffer) + update_grid.num_blocks,
+                       get_dataframe_buffer_begin<T>(block_result_buffer) + launch.num_blocks,
                        T(),
                        [] __device__(T lhs, T rhs) { return plus_edge_op_result(lhs, rhs); });
 
@@ -242,5 +236,117 @@ T transform_reduce_e(raft::handle_t const& handle,
   return plus_edge_op_result(init, result);
 }
 
+}  // namespace detail
+
+/**
+ * @brief Iterate over the entire set of edges and reduce @p edge_op outputs.
+ *
+ * This function is inspired by thrust::transform_reduce().
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam AdjMatrixRowValueInputIterator Type of the iterator for graph adjacency matrix row
+ * input properties.
+ * @tparam AdjMatrixColValueInputIterator Type of the iterator for graph adjacency matrix column
+ * input properties.
+ * @tparam EdgeOp Type of the quaternary (or quinary) edge operator.
+ * @tparam T Type of the initial value.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param adj_matrix_row_value_input_first Iterator pointing to the adjacency matrix row input
+ * properties for the first (inclusive) row (assigned to this process in multi-GPU).
+ * `adj_matrix_row_value_input_last` (exclusive) is deduced as @p adj_matrix_row_value_input_first +
+ * @p graph_view.get_number_of_local_adj_matrix_partition_rows().
+ * @param adj_matrix_col_value_input_first Iterator pointing to the adjacency matrix column input
+ * properties for the first (inclusive) column (assigned to this process in multi-GPU).
+ * `adj_matrix_col_value_output_last` (exclusive) is deduced as @p adj_matrix_col_value_output_first
+ * + @p graph_view.get_number_of_local_adj_matrix_partition_cols().
+ * @param e_op Quaternary (or quinary) operator takes edge source, edge destination, (optional edge
+ * weight), *(@p adj_matrix_row_value_input_first + i), and *(@p adj_matrix_col_value_input_first +
+ * j) (where i is in [0, graph_view.get_number_of_local_adj_matrix_partition_rows()) and j is in [0,
+ * get_number_of_local_adj_matrix_partition_cols())) and returns a transformed value to be reduced.
+ * @param init Initial value to be added to the transform-reduced input vertex properties.
+ * @return T Reduction of the @p edge_op outputs.
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputIterator,
+          typename AdjMatrixColValueInputIterator,
+          typename EdgeOp,
+          typename T>
+T transform_reduce_e(raft::handle_t const& handle,
+                     GraphViewType const& graph_view,
+                     AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
+                     AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+                     EdgeOp e_op,
+                     T init)
+{
+  return detail::transform_reduce_e(handle,
+                                    graph_view,
+                                    adj_matrix_row_value_input_first,
+                                    adj_matrix_col_value_input_first,
+                                    detail::no_edge_value_input_first_t{},
+                                    e_op,
+                                    init);
+}
+
+/**
+ * @brief Iterate over the entire set of edges and reduce @p edge_op outputs (@p edge_op also
+ * takes the edge property value).
+ *
+ * This function is an overload of transform_reduce_e() with a typed per-edge property (see
+ * edge_property.cuh).
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam AdjMatrixRowValueInputIterator Type of the iterator for graph adjacency matrix row
+ * input properties.
+ * @tparam AdjMatrixColValueInputIterator Type of the iterator for graph adjacency matrix column
+ * input properties.
+ * @tparam EdgeValue Type of the edge property values.
+ * @tparam EdgeOp Type of the quinary (or senary) edge operator.
+ * @tparam T Type of the initial value.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param adj_matrix_row_value_input_first Iterator pointing to the adjacency matrix row input
+ * properties for the first (inclusive) row (assigned to this process in multi-GPU).
+ * @param adj_matrix_col_value_input_first Iterator pointing to the adjacency matrix column input
+ * properties for the first (inclusive) column (assigned to this process in multi-GPU).
+ * @param edge_value_input Non-owning view of the edge property (created for @p graph_view).
+ * @param e_op Quinary (or senary) operator takes edge source, edge destination, (optional edge
+ * weight), *(@p adj_matrix_row_value_input_first + i), *(@p adj_matrix_col_value_input_first +
+ * j), and the edge property value and returns a transformed value to be reduced.
+ * @param init Initial value to be added to the transform-reduced input vertex properties.
+ * @return T Reduction of the @p edge_op outputs.
+ */
+template <typename GraphViewType,
+          typename AdjMatrixRowValueInputIterator,
+          typename AdjMatrixColValueInputIterator,
+          typename EdgeValue,
+          typename EdgeOp,
+          typename T>
+T transform_reduce_e(
+  raft::handle_t const& handle,
+  GraphViewType const& graph_view,
+  AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
+  AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+  edge_property_view_t<typename GraphViewType::edge_type, EdgeValue> const& edge_value_input,
+  EdgeOp e_op,
+  T init)
+{
+  CUGRAPH_EXPECTS(edge_value_input.get_number_of_local_adj_matrix_partitions() ==
+                    graph_view.get_number_of_local_adj_matrix_partitions(),
+                  "Invalid input argument: edge_value_input is not created for graph_view.");
+
+  return detail::transform_reduce_e(
+    handle,
+    graph_view,
+    adj_matrix_row_value_input_first,
+    adj_matrix_col_value_input_first,
+    detail::edge_property_value_input_first_t<typename GraphViewType::edge_type, EdgeValue>{
+      edge_value_input},
+    e_op,
+    init);
+}
+
 }  // namespace experimental
 }  // namespace cugraph
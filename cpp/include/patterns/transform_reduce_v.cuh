@@ -16,12 +16,17 @@
 #pragma once
 
 #include <experimental/graph_view.hpp>
+#include <utilities/device_comm.cuh>
 #include <utilities/error.hpp>
 #include <utilities/host_scalar_comm.cuh>
 
 #include <raft/handle.hpp>
+#include <rmm/device_buffer.hpp>
 
+#include <cub/cub.cuh>
 #include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/transform_reduce.h>
 
 namespace cugraph {
@@ -111,5 +116,69 @@ T transform_reduce_v(raft::handle_t const& handle,
   return ret;
 }
 
+/**
+ * @brief Apply an operator to the vertex properties and reduce (to device memory, without
+ * synchronizing the stream).
+ *
+ * This version iterates over the entire set of graph vertices and works as transform_reduce_v()
+ * but writes the reduction to @p result (in device memory) instead of returning it to the host.
+ * This function neither synchronizes the stream nor communicates through the host (in multi-GPU,
+ * the local reductions are all-reduced with a device collective), so iterative algorithms can keep
+ * issuing work and read the result only when it is needed (e.g. convergence checks every N
+ * iterations).
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexValueInputIterator Type of the iterator for vertex properties.
+ * @tparam VertexOp Type of the unary vertex operator.
+ * @tparam T Type of the initial value.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @param vertex_value_input_first Iterator pointing to the vertex properties for the first
+ * (inclusive) vertex (assigned to this process in multi-GPU). `vertex_value_input_last` (exclusive)
+ * is deduced as @p vertex_value_input_first + @p graph_view.get_number_of_local_vertices().
+ * @param v_op Unary operator takes *(@p vertex_value_input_first + i) (where i is [0, @p
+ * graph_view.get_number_of_local_vertices())) and returns a transformed value to be reduced.
+ * @param init Initial value to be added to the transform-reduced input vertex properties.
+ * @param result Pointer to the device memory to store the reduction of the @p v_op outputs.
+ */
+template <typename GraphViewType, typename VertexValueInputIterator, typename VertexOp, typename T>
+void transform_reduce_v_async(raft::handle_t const& handle,
+                              GraphViewType const& graph_view,
+                              VertexValueInputIterator vertex_value_input_first,
+                              VertexOp v_op,
+                              T init,
+                              T* result)
+{
+  // the reference type is explicitly set as the return type of a device lambda can't be queried
+  // in host code
+  thrust::transform_iterator<VertexOp, VertexValueInputIterator, T> transform_first(
+    vertex_value_input_first, v_op);
+
+  size_t tmp_storage_bytes{0};
+  cub::DeviceReduce::Reduce(static_cast<void*>(nullptr),
+                            tmp_storage_bytes,
+                            transform_first,
+                            result,
+                            graph_view.get_number_of_local_vertices(),
+                            thrust::plus<T>(),
+                            init,
+                            handle.get_stream());
+  rmm::device_buffer tmp_storage(tmp_storage_bytes, handle.get_stream());
+  cub::DeviceReduce::Reduce(tmp_storage.data(),
+                            tmp_storage_bytes,
+                            transform_first,
+                            result,
+                            graph_view.get_number_of_local_vertices(),
+                            thrust::plus<T>(),
+                            init,
+                            handle.get_stream());
+
+  if (GraphViewType::is_multi_gpu) {
+    device_allreduce(
+      handle.get_comms(), result, result, size_t{1}, raft::comms::op_t::SUM, handle.get_stream());
+  }
+}
+
 }  // namespace experimental
 }  // namespace cugraph
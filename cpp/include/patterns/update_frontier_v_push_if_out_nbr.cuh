@@ -21,12 +21,16 @@
 #include <partition_manager.hpp>
 #include <patterns/edge_op_utils.cuh>
 #include <patterns/reduce_op.cuh>
+#include <patterns/vertex_binning.cuh>
+#include <patterns/vertex_frontier.cuh>
 #include <utilities/dataframe_buffer.cuh>
 #include <utilities/device_comm.cuh>
 #include <utilities/error.hpp>
 #include <utilities/host_scalar_comm.cuh>
+#include <utilities/profiling.hpp>
 #include <utilities/shuffle_comm.cuh>
 #include <utilities/thrust_tuple_utils.cuh>
+#include <utilities/workspace.hpp>
 #include <vertex_partition_device.cuh>
 
 #include <raft/cudart_utils.h>
@@ -91,11 +95,12 @@ __global__ void for_all_frontier_row_for_all_nbr_low_degree(
   while (idx < num_rows) {
     vertex_t row    = *(row_first + idx);
     auto row_offset = matrix_partition.get_major_offset_from_major_nocheck(row);
-    vertex_t const* indices{nullptr};
+    minor_index_iterator_t<vertex_t, edge_t> indices{};
     weight_t const* weights{nullptr};
     edge_t local_out_degree{};
     thrust::tie(indices, weights, local_out_degree) = matrix_partition.get_local_edges(row_offset);
     for (vertex_t i = 0; i < local_out_degree; ++i) {
+      if (!matrix_partition.is_edge_active(*(indices.base()) + i)) { continue; }
       auto col         = indices[i];
       auto weight      = weights != nullptr ? weights[i] : 1.0;
       auto col_offset  = matrix_partition.get_minor_offset_from_minor_nocheck(col);
@@ -125,6 +130,281 @@ __global__ void for_all_frontier_row_for_all_nbr_low_degree(
   }
 }
 
+// a warp per row, the pushes of a warp are appended to the buffer with a single atomicAdd per
+// round of warp_size edges
+template <typename GraphViewType,
+          typename RowIterator,
+          typename AdjMatrixRowValueInputIterator,
+          typename AdjMatrixColValueInputIterator,
+          typename BufferKeyOutputIterator,
+          typename BufferPayloadOutputIterator,
+          typename EdgeOp>
+__global__ void for_all_frontier_row_for_all_nbr_mid_degree(
+  matrix_partition_device_t<GraphViewType> matrix_partition,
+  RowIterator row_first,
+  RowIterator row_last,
+  AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
+  AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+  BufferKeyOutputIterator buffer_key_output_first,
+  BufferPayloadOutputIterator buffer_payload_output_first,
+  size_t* buffer_idx_ptr,
+  EdgeOp e_op)
+{
+  using vertex_t  = typename GraphViewType::vertex_type;
+  using edge_t    = typename GraphViewType::edge_type;
+  using weight_t  = typename GraphViewType::weight_type;
+  using payload_t = typename std::iterator_traits<BufferPayloadOutputIterator>::value_type;
+
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto num_rows = static_cast<size_t>(thrust::distance(row_first, row_last));
+  static_assert(update_frontier_v_push_if_out_nbr_for_all_block_size % raft::warp_size() == 0);
+  auto const tid     = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const lane_id = tid % raft::warp_size();
+  auto idx           = static_cast<size_t>(tid / raft::warp_size());
+
+  while (idx < num_rows) {
+    vertex_t row    = *(row_first + idx);
+    auto row_offset = matrix_partition.get_major_offset_from_major_nocheck(row);
+    minor_index_iterator_t<vertex_t, edge_t> indices{};
+    weight_t const* weights{nullptr};
+    edge_t local_out_degree{};
+    thrust::tie(indices, weights, local_out_degree) = matrix_partition.get_local_edges(row_offset);
+    // every lane runs the same number of rounds (the warp shares the row)
+    for (edge_t round_first = 0; round_first < local_out_degree;
+         round_first += raft::warp_size()) {
+      auto i = round_first + static_cast<edge_t>(lane_id);
+      bool push{false};
+      vertex_t col{};
+      payload_t payload{};
+      if ((i < local_out_degree) && matrix_partition.is_edge_active(*(indices.base()) + i)) {
+        col              = indices[i];
+        auto weight      = weights != nullptr ? weights[i] : 1.0;
+        auto col_offset  = matrix_partition.get_minor_offset_from_minor_nocheck(col);
+        auto e_op_result = evaluate_edge_op<GraphViewType,
+                                            AdjMatrixRowValueInputIterator,
+                                            AdjMatrixColValueInputIterator,
+                                            EdgeOp>()
+                             .compute(row,
+                                      col,
+                                      weight,
+                                      *(adj_matrix_row_value_input_first + row_offset),
+                                      *(adj_matrix_col_value_input_first + col_offset),
+                                      e_op);
+        push    = thrust::get<0>(e_op_result);
+        payload = thrust::get<1>(e_op_result);
+      }
+      auto ballot = __ballot_sync(raft::warp_full_mask(), push);
+      if (ballot != 0) {
+        static_assert(sizeof(unsigned long long int) == sizeof(size_t));
+        unsigned long long int warp_buffer_idx{0};
+        if (lane_id == 0) {
+          warp_buffer_idx = atomicAdd(reinterpret_cast<unsigned long long int*>(buffer_idx_ptr),
+                                      static_cast<unsigned long long int>(__popc(ballot)));
+        }
+        warp_buffer_idx = __shfl_sync(raft::warp_full_mask(), warp_buffer_idx, 0);
+        if (push) {
+          auto buffer_idx = static_cast<size_t>(warp_buffer_idx) +
+                            static_cast<size_t>(__popc(ballot & ((uint32_t{1} << lane_id) - 1)));
+          *(buffer_key_output_first + buffer_idx)     = col;
+          *(buffer_payload_output_first + buffer_idx) = payload;
+        }
+      }
+    }
+    idx += gridDim.x * (blockDim.x / raft::warp_size());
+  }
+}
+
+// a block per row, the pushes of a block are appended to the buffer with a single atomicAdd per
+// round of blockDim.x edges
+template <typename GraphViewType,
+          typename RowIterator,
+          typename AdjMatrixRowValueInputIterator,
+          typename AdjMatrixColValueInputIterator,
+          typename BufferKeyOutputIterator,
+          typename BufferPayloadOutputIterator,
+          typename EdgeOp>
+__global__ void for_all_frontier_row_for_all_nbr_high_degree(
+  matrix_partition_device_t<GraphViewType> matrix_partition,
+  RowIterator row_first,
+  RowIterator row_last,
+  AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
+  AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+  BufferKeyOutputIterator buffer_key_output_first,
+  BufferPayloadOutputIterator buffer_payload_output_first,
+  size_t* buffer_idx_ptr,
+  EdgeOp e_op)
+{
+  using vertex_t  = typename GraphViewType::vertex_type;
+  using edge_t    = typename GraphViewType::edge_type;
+  using weight_t  = typename GraphViewType::weight_type;
+  using payload_t = typename std::iterator_traits<BufferPayloadOutputIterator>::value_type;
+
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  using BlockScan = cub::BlockScan<size_t, update_frontier_v_push_if_out_nbr_for_all_block_size>;
+  __shared__ typename BlockScan::TempStorage temp_storage;
+  __shared__ size_t block_buffer_idx;
+
+  auto num_rows = static_cast<size_t>(thrust::distance(row_first, row_last));
+  auto idx      = static_cast<size_t>(blockIdx.x);
+
+  while (idx < num_rows) {
+    vertex_t row    = *(row_first + idx);
+    auto row_offset = matrix_partition.get_major_offset_from_major_nocheck(row);
+    minor_index_iterator_t<vertex_t, edge_t> indices{};
+    weight_t const* weights{nullptr};
+    edge_t local_out_degree{};
+    thrust::tie(indices, weights, local_out_degree) = matrix_partition.get_local_edges(row_offset);
+    // every thread runs the same number of rounds (the block shares the row)
+    for (edge_t round_first = 0; round_first < local_out_degree; round_first += blockDim.x) {
+      auto i = round_first + static_cast<edge_t>(threadIdx.x);
+      bool push{false};
+      vertex_t col{};
+      payload_t payload{};
+      if ((i < local_out_degree) && matrix_partition.is_edge_active(*(indices.base()) + i)) {
+        col              = indices[i];
+        auto weight      = weights != nullptr ? weights[i] : 1.0;
+        auto col_offset  = matrix_partition.get_minor_offset_from_minor_nocheck(col);
+        auto e_op_result = evaluate_edge_op<GraphViewType,
+                                            AdjMatrixRowValueInputIterator,
+                                            AdjMatrixColValueInputIterator,
+                                            EdgeOp>()
+                             .compute(row,
+                                      col,
+                                      weight,
+                                      *(adj_matrix_row_value_input_first + row_offset),
+                                      *(adj_matrix_col_value_input_first + col_offset),
+                                      e_op);
+        push    = thrust::get<0>(e_op_result);
+        payload = thrust::get<1>(e_op_result);
+      }
+      size_t block_offset{0};
+      size_t block_aggregate{0};
+      BlockScan(temp_storage)
+        .ExclusiveSum(push ? size_t{1} : size_t{0}, block_offset, block_aggregate);
+      if ((threadIdx.x == 0) && (block_aggregate > 0)) {
+        static_assert(sizeof(unsigned long long int) == sizeof(size_t));
+        block_buffer_idx = static_cast<size_t>(
+          atomicAdd(reinterpret_cast<unsigned long long int*>(buffer_idx_ptr),
+                    static_cast<unsigned long long int>(block_aggregate)));
+      }
+      __syncthreads();
+      if (push) {
+        *(buffer_key_output_first + block_buffer_idx + block_offset)     = col;
+        *(buffer_payload_output_first + block_buffer_idx + block_offset) = payload;
+      }
+      __syncthreads();  // temp_storage and block_buffer_idx are reused in the next round
+    }
+    idx += gridDim.x;
+  }
+}
+
+// bin the frontier rows by their local out-degree (at run time, the degree segments of the graph
+// do not reflect the frontier's degree mix) and push the outgoing edges of every bin with the
+// thread-, warp-, or block-per-row kernel
+template <typename GraphViewType,
+          typename RowIterator,
+          typename AdjMatrixRowValueInputIterator,
+          typename AdjMatrixColValueInputIterator,
+          typename BufferKeyOutputIterator,
+          typename BufferPayloadOutputIterator,
+          typename EdgeOp>
+void for_all_frontier_row_for_all_nbr(
+  raft::handle_t const& handle,
+  matrix_partition_device_t<GraphViewType> const& matrix_partition,
+  RowIterator row_first,
+  RowIterator row_last,
+  AdjMatrixRowValueInputIterator adj_matrix_row_value_input_first,
+  AdjMatrixColValueInputIterator adj_matrix_col_value_input_first,
+  BufferKeyOutputIterator buffer_key_output_first,
+  BufferPayloadOutputIterator buffer_payload_output_first,
+  size_t* buffer_idx_ptr,
+  EdgeOp e_op,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto bins = bin_vertices_by_local_degree(handle, matrix_partition, row_first, row_last, mr);
+  detail::add_profile_counter("frontier_mid_degree_rows", static_cast<int64_t>(bins.bin_size(1)));
+  detail::add_profile_counter("frontier_high_degree_rows", static_cast<int64_t>(bins.bin_size(2)));
+
+  auto const max_grid_size = handle.get_device_properties().maxGridSize[0];
+
+  if (bins.vertices.size() == 0) {  // every row is in the low-degree bin
+    raft::grid_1d_thread_t for_all_low_degree_grid(
+      bins.bin_size(0), update_frontier_v_push_if_out_nbr_for_all_block_size, max_grid_size);
+    for_all_frontier_row_for_all_nbr_low_degree<<<for_all_low_degree_grid.num_blocks,
+                                                  for_all_low_degree_grid.block_size,
+                                                  0,
+                                                  handle.get_stream()>>>(
+      matrix_partition,
+      row_first,
+      row_last,
+      adj_matrix_row_value_input_first,
+      adj_matrix_col_value_input_first,
+      buffer_key_output_first,
+      buffer_payload_output_first,
+      buffer_idx_ptr,
+      e_op);
+    return;
+  }
+
+  auto binned_row_first = bins.vertices.data();
+  if (bins.bin_size(0) > 0) {
+    raft::grid_1d_thread_t for_all_low_degree_grid(
+      bins.bin_size(0), update_frontier_v_push_if_out_nbr_for_all_block_size, max_grid_size);
+    for_all_frontier_row_for_all_nbr_low_degree<<<for_all_low_degree_grid.num_blocks,
+                                                  for_all_low_degree_grid.block_size,
+                                                  0,
+                                                  handle.get_stream()>>>(
+      matrix_partition,
+      binned_row_first + bins.offsets[0],
+      binned_row_first + bins.offsets[1],
+      adj_matrix_row_value_input_first,
+      adj_matrix_col_value_input_first,
+      buffer_key_output_first,
+      buffer_payload_output_first,
+      buffer_idx_ptr,
+      e_op);
+  }
+  if (bins.bin_size(1) > 0) {
+    raft::grid_1d_warp_t for_all_mid_degree_grid(
+      bins.bin_size(1), update_frontier_v_push_if_out_nbr_for_all_block_size, max_grid_size);
+    for_all_frontier_row_for_all_nbr_mid_degree<<<for_all_mid_degree_grid.num_blocks,
+                                                  for_all_mid_degree_grid.block_size,
+                                                  0,
+                                                  handle.get_stream()>>>(
+      matrix_partition,
+      binned_row_first + bins.offsets[1],
+      binned_row_first + bins.offsets[2],
+      adj_matrix_row_value_input_first,
+      adj_matrix_col_value_input_first,
+      buffer_key_output_first,
+      buffer_payload_output_first,
+      buffer_idx_ptr,
+      e_op);
+  }
+  if (bins.bin_size(2) > 0) {
+    raft::grid_1d_block_t for_all_high_degree_grid(
+      bins.bin_size(2), update_frontier_v_push_if_out_nbr_for_all_block_size, max_grid_size);
+    for_all_frontier_row_for_all_nbr_high_degree<<<for_all_high_degree_grid.num_blocks,
+                                                   for_all_high_degree_grid.block_size,
+                                                   0,
+                                                   handle.get_stream()>>>(
+      matrix_partition,
+      binned_row_first + bins.offsets[2],
+      binned_row_first + bins.offsets[3],
+      adj_matrix_row_value_input_first,
+      adj_matrix_col_value_input_first,
+      buffer_key_output_first,
+      buffer_payload_output_first,
+      buffer_idx_ptr,
+      e_op);
+  }
+  // bins.vertices is freed (on the stream) after the kernels using it
+}
+
 template <typename BufferKeyOutputIterator, typename BufferPayloadOutputIterator, typename ReduceOp>
 size_t reduce_buffer_elements(raft::handle_t const& handle,
                               BufferKeyOutputIterator buffer_key_output_first,
@@ -199,6 +479,8 @@ __global__ void update_frontier_and_vertex_output_values(
   VertexValueOutputIterator vertex_value_output_first,
   vertex_t** bucket_ptrs,
   size_t* bucket_sizes_ptr,
+  uint32_t** bucket_bitmap_ptrs,
+  vertex_t bitmap_vertex_first,
   size_t invalid_bucket_idx,
   vertex_t invalid_vertex,
   VertexOp v_op)
@@ -225,6 +507,7 @@ __global__ void update_frontier_and_vertex_output_values(
 
     size_t selected_bucket_idx{invalid_bucket_idx};
     vertex_t key{invalid_vertex};
+    bool append{false};
 
     if (idx < num_buffer_elements) {
       key                 = *(buffer_key_input_first + idx);
@@ -234,8 +517,14 @@ __global__ void update_frontier_and_vertex_output_values(
       auto v_op_result    = v_op(v_val, payload);
       selected_bucket_idx = thrust::get<0>(v_op_result);
       if (selected_bucket_idx != invalid_bucket_idx) {
-        *(vertex_value_output_first + key_offset)       = thrust::get<1>(v_op_result);
-        bucket_block_local_offsets[selected_bucket_idx] = 1;
+        *(vertex_value_output_first + key_offset) = thrust::get<1>(v_op_result);
+        auto bitmap                               = bucket_bitmap_ptrs[selected_bucket_idx];
+        if (bitmap != nullptr) {  // dense bucket
+          set_bucket_bitmap_bit_t<vertex_t>{bitmap, bitmap_vertex_first}(key);
+        } else {
+          bucket_block_local_offsets[selected_bucket_idx] = 1;
+          append                                          = true;
+        }
       }
     }
 
@@ -258,7 +547,7 @@ __global__ void update_frontier_and_vertex_output_values(
     __syncthreads();
 
     // FIXME: better use shared memory buffer to aggreaget global memory writes
-    if (selected_bucket_idx != invalid_bucket_idx) {
+    if (append) {
       bucket_ptrs[selected_bucket_idx][bucket_block_start_offsets[selected_bucket_idx] +
                                        bucket_block_local_offsets[selected_bucket_idx]] = key;
     }
@@ -315,7 +604,9 @@ __global__ void update_frontier_and_vertex_output_values(
  * (exclusive) is deduced as @p vertex_value_output_first + @p
  * graph_view.get_number_of_local_vertices().
  * @param vertex_frontier vertex frontier class object for vertex frontier managements. This object
- * includes multiple bucket objects.
+ * includes multiple bucket objects. Buckets may grow (and be re-allocated) in this function, so
+ * iterators into the buckets (including @p vertex_first and @p vertex_last if they point to a
+ * bucket) are invalidated after this function returns.
  * @param v_op Binary operator takes *(@p vertex_value_input_first + i) (where i is [0, @p
  * graph_view.get_number_of_local_vertices())) and reduced value of the @p e_op outputs for
  * this vertex and returns the target bucket index (for frontier update) and new verrtex property
@@ -353,16 +644,26 @@ void update_frontier_v_push_if_out_nbr(
   using weight_t  = typename GraphViewType::weight_type;
   using payload_t = typename ReduceOp::type;
 
+  detail::profile_range_t profile_range(handle, "update_frontier_v_push_if_out_nbr");
+
+  // the push buffers are temporaries of this call (the updated vertices are copied to the frontier
+  // buckets)
+  detail::workspace_phase_t workspace_phase(handle);
+  auto workspace_mr = detail::get_workspace_resource(handle);
+
   // 1. fill the buffer
 
-  rmm::device_uvector<vertex_t> keys(size_t{0}, handle.get_stream());
-  auto payload_buffer = allocate_dataframe_buffer<payload_t>(size_t{0}, handle.get_stream());
+  rmm::device_uvector<vertex_t> keys(size_t{0}, handle.get_stream(), workspace_mr);
+  auto payload_buffer =
+    allocate_dataframe_buffer<payload_t>(size_t{0}, handle.get_stream(), workspace_mr);
   rmm::device_scalar<size_t> buffer_idx(size_t{0}, handle.get_stream());
   for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
     matrix_partition_device_t<GraphViewType> matrix_partition(graph_view, i);
 
     rmm::device_uvector<vertex_t> frontier_rows(
-      0, handle.get_stream());  // relevant only if GraphViewType::is_multi_gpu is true
+      0,
+      handle.get_stream(),
+      workspace_mr);  // relevant only if GraphViewType::is_multi_gpu is true
 
     size_t frontier_size{};
     if (GraphViewType::is_multi_gpu) {
@@ -412,6 +713,8 @@ void update_frontier_v_push_if_out_nbr(
                 edge_t{0},
                 thrust::plus<edge_t>())
         : edge_t{0};
+    detail::add_profile_counter("frontier_vertices", static_cast<int64_t>(frontier_size));
+    detail::add_profile_counter("edges_traversed", max_pushes);
 
     // FIXME: This is highly pessimistic for single GPU (and multi-GPU as well if we maintain
     // additional per column data for filtering in e_op). If we can pause & resume execution if
@@ -434,20 +737,10 @@ void update_frontier_v_push_if_out_nbr(
                                     ? vertex_t{0}
                                     : matrix_partition.get_major_value_start_offset();
 
-    // FIXME: This is highly inefficeint for graphs with high-degree vertices. If we renumber
-    // vertices to insure that rows within a partition are sorted by their out-degree in decreasing
-    // order, we will apply this kernel only to low out-degree vertices.
     if (frontier_size > 0) {
-      raft::grid_1d_thread_t for_all_low_degree_grid(
-        frontier_size,
-        detail::update_frontier_v_push_if_out_nbr_for_all_block_size,
-        handle.get_device_properties().maxGridSize[0]);
-
       if (frontier_rows.size() > 0) {
-        detail::for_all_frontier_row_for_all_nbr_low_degree<<<for_all_low_degree_grid.num_blocks,
-                                                              for_all_low_degree_grid.block_size,
-                                                              0,
-                                                              handle.get_stream()>>>(
+        detail::for_all_frontier_row_for_all_nbr(
+          handle,
           matrix_partition,
           frontier_rows.begin(),
           frontier_rows.end(),
@@ -456,12 +749,11 @@ void update_frontier_v_push_if_out_nbr(
           keys.begin(),
           get_dataframe_buffer_begin<payload_t>(payload_buffer),
           buffer_idx.data(),
-          e_op);
+          e_op,
+          workspace_mr);
       } else {
-        detail::for_all_frontier_row_for_all_nbr_low_degree<<<for_all_low_degree_grid.num_blocks,
-                                                              for_all_low_degree_grid.block_size,
-                                                              0,
-                                                              handle.get_stream()>>>(
+        detail::for_all_frontier_row_for_all_nbr(
+          handle,
           matrix_partition,
           vertex_first,
           vertex_last,
@@ -470,7 +762,8 @@ void update_frontier_v_push_if_out_nbr(
           keys.begin(),
           get_dataframe_buffer_begin<payload_t>(payload_buffer),
           buffer_idx.data(),
-          e_op);
+          e_op,
+          workspace_mr);
       }
     }
   }
@@ -551,6 +844,7 @@ void update_frontier_v_push_if_out_nbr(
 
     vertex_partition_device_t<GraphViewType> vertex_partition(graph_view);
 
+    vertex_frontier.reserve_buckets(num_buffer_elements);
     auto bucket_and_bucket_size_device_ptrs =
       vertex_frontier.get_bucket_and_bucket_size_device_pointers();
     detail::update_frontier_and_vertex_output_values<VertexFrontierType::kNumBuckets>
@@ -563,6 +857,8 @@ void update_frontier_v_push_if_out_nbr(
         vertex_value_output_first,
         std::get<0>(bucket_and_bucket_size_device_ptrs),
         std::get<1>(bucket_and_bucket_size_device_ptrs),
+        std::get<2>(bucket_and_bucket_size_device_ptrs),
+        std::get<3>(bucket_and_bucket_size_device_ptrs),
         VertexFrontierType::kInvalidBucketIdx,
         invalid_vertex,
         v_op);
@@ -574,9 +870,7 @@ void update_frontier_v_push_if_out_nbr(
                       VertexFrontierType::kNumBuckets,
                       handle.get_stream());
     CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
-    for (size_t i = 0; i < VertexFrontierType::kNumBuckets; ++i) {
-      vertex_frontier.get_bucket(i).set_size(bucket_sizes[i]);
-    }
+    vertex_frontier.update_bucket_sizes(bucket_sizes);
   }
 }
 
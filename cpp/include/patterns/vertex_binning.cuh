@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <experimental/graph_view.hpp>
+#include <matrix_partition_device.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+
+#include <array>
+#include <cstddef>
+#include <limits>
+
+namespace cugraph {
+namespace experimental {
+
+// Run-time degree binning of a vertex list (e.g. a frontier). The degree segments of a graph
+// sorted by degree describe the entire vertex range; the degree mix of a (sparse) vertex list
+// is known only at run time. The vertices are binned by their local degree in a matrix partition
+// (the same thresholds as the degree segments) so a pattern can expand every bin with the matching
+// thread-, warp-, or block-per-vertex kernel (e.g. a sparse frontier of hub vertices is expanded a
+// block per vertex instead of a thread per vertex).
+
+// [0, low_degree_threshold), [low_degree_threshold, mid_degree_threshold),
+// [mid_degree_threshold, infinity)
+size_t constexpr num_vertex_degree_bins = 3;
+
+template <typename vertex_t>
+struct vertex_degree_bins_t {
+  // the vertices ordered by bin (in the input order within a bin), empty if every vertex falls in
+  // the first (low-degree) bin; the bin is then the input vertex list as is (no copy is made)
+  rmm::device_uvector<vertex_t> vertices;
+  // bin i is [offsets[i], offsets[i + 1])
+  std::array<size_t, num_vertex_degree_bins + 1> offsets{};
+
+  size_t bin_size(size_t i) const { return offsets[i + 1] - offsets[i]; }
+};
+
+namespace detail {
+
+template <typename GraphViewType>
+struct local_degree_in_range_t {
+  matrix_partition_device_t<GraphViewType> matrix_partition;
+  typename GraphViewType::edge_type degree_first;
+  typename GraphViewType::edge_type degree_last;
+
+  __device__ bool operator()(typename GraphViewType::vertex_type major) const
+  {
+    auto local_degree = matrix_partition.get_local_degree(
+      matrix_partition.get_major_offset_from_major_nocheck(major));
+    return (local_degree >= degree_first) && (local_degree < degree_last);
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Bin vertices by their local degree in a matrix partition.
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object.
+ * @tparam VertexIterator Type of the iterator for vertex identifiers.
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param matrix_partition Matrix partition the local degrees are computed in.
+ * @param vertex_first Iterator pointing to the first (inclusive) vertex to bin, vertices should be
+ * majors of @p matrix_partition.
+ * @param vertex_last Iterator pointing to the last (exclusive) vertex to bin.
+ * @param mr Device memory resource to allocate the binned vertex list from.
+ * @return vertex_degree_bins_t<vertex_t> Binned vertex list and the bin offsets.
+ */
+template <typename GraphViewType, typename VertexIterator>
+vertex_degree_bins_t<typename GraphViewType::vertex_type> bin_vertices_by_local_degree(
+  raft::handle_t const& handle,
+  matrix_partition_device_t<GraphViewType> const& matrix_partition,
+  VertexIterator vertex_first,
+  VertexIterator vertex_last,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  std::array<edge_t, num_vertex_degree_bins + 1> const degree_thresholds{
+    edge_t{0},
+    static_cast<edge_t>(detail::low_degree_threshold),
+    static_cast<edge_t>(detail::mid_degree_threshold),
+    std::numeric_limits<edge_t>::max()};
+
+  auto num_vertices = static_cast<size_t>(thrust::distance(vertex_first, vertex_last));
+
+  vertex_degree_bins_t<vertex_t> ret{rmm::device_uvector<vertex_t>(0, handle.get_stream(), mr)};
+  ret.offsets.fill(num_vertices);
+  ret.offsets[0] = 0;
+
+  // the common case (e.g. most BFS frontiers) needs a single pass and no copy
+  auto num_low_degree_vertices = static_cast<size_t>(
+    thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     vertex_first,
+                     vertex_last,
+                     detail::local_degree_in_range_t<GraphViewType>{
+                       matrix_partition, degree_thresholds[0], degree_thresholds[1]}));
+  if (num_low_degree_vertices == num_vertices) { return ret; }
+
+  ret.vertices.resize(num_vertices, handle.get_stream());
+  auto it = ret.vertices.begin();
+  for (size_t i = 0; i < num_vertex_degree_bins; ++i) {
+    it = thrust::copy_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                         vertex_first,
+                         vertex_last,
+                         it,
+                         detail::local_degree_in_range_t<GraphViewType>{
+                           matrix_partition, degree_thresholds[i], degree_thresholds[i + 1]});
+    ret.offsets[i + 1] = static_cast<size_t>(thrust::distance(ret.vertices.begin(), it));
+  }
+
+  return ret;
+}
+
+}  // namespace experimental
+}  // namespace cugraph
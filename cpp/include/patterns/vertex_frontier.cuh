@@ -24,12 +24,20 @@
 #include <raft/handle.hpp>
 #include <rmm/device_scalar.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
 #include <thrust/host_vector.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
 #include <cinttypes>
+#include <iterator>
 #include <tuple>
 #include <type_traits>
 #include <vector>
@@ -42,6 +50,28 @@ namespace detail {
 // FIXME: block size requires tuning
 int32_t constexpr move_and_invalidate_if_block_size = 128;
 
+// FIXME: this ratio requires tuning
+// a bucket with the dense representation enabled switches to the bitmap once its vertex list needs
+// more memory than the bitmap (1 bit per vertex in the bitmap range) and switches back once the
+// list needs less than 1 / bucket_dense_to_sparse_ratio of the bitmap memory (to avoid switching
+// back and forth around a single threshold)
+size_t constexpr bucket_dense_to_sparse_ratio = 2;
+
+size_t constexpr bucket_bitmap_word_bits = sizeof(uint32_t) * 8;
+
+template <typename vertex_t>
+struct set_bucket_bitmap_bit_t {
+  uint32_t* bitmap{nullptr};
+  vertex_t bitmap_vertex_first{0};
+
+  __device__ void operator()(vertex_t v) const
+  {
+    auto offset = static_cast<size_t>(v - bitmap_vertex_first);
+    atomicOr(bitmap + offset / bucket_bitmap_word_bits,
+             uint32_t{1} << (offset % bucket_bitmap_word_bits));
+  }
+};
+
 // FIXME: better move to another file for reusability
 inline size_t round_up(size_t number_to_round, size_t modulus)
 {
@@ -53,6 +83,8 @@ __global__ void move_and_invalidate_if(RowIterator row_first,
                                        RowIterator row_last,
                                        vertex_t** bucket_ptrs,
                                        size_t* bucket_sizes_ptr,
+                                       uint32_t** bucket_bitmap_ptrs,
+                                       vertex_t bitmap_vertex_first,
                                        size_t this_bucket_idx,
                                        size_t invalid_bucket_idx,
                                        vertex_t invalid_vertex,
@@ -80,6 +112,7 @@ __global__ void move_and_invalidate_if(RowIterator row_first,
 
     size_t selected_bucket_idx{invalid_bucket_idx};
     vertex_t key{invalid_vertex};
+    bool append{false};
 
     if (idx < num_elements) {
       key                 = *(row_first + idx);
@@ -87,7 +120,13 @@ __global__ void move_and_invalidate_if(RowIterator row_first,
       if (selected_bucket_idx != this_bucket_idx) {
         *(row_first + idx) = invalid_vertex;
         if (selected_bucket_idx != invalid_bucket_idx) {
-          bucket_block_local_offsets[selected_bucket_idx] = 1;
+          auto bitmap = bucket_bitmap_ptrs[selected_bucket_idx];
+          if (bitmap != nullptr) {  // dense bucket
+            set_bucket_bitmap_bit_t<vertex_t>{bitmap, bitmap_vertex_first}(key);
+          } else {
+            bucket_block_local_offsets[selected_bucket_idx] = 1;
+            append                                          = true;
+          }
         }
       }
     }
@@ -111,7 +150,7 @@ __global__ void move_and_invalidate_if(RowIterator row_first,
     __syncthreads();
 
     // FIXME: better use shared memory buffer to aggreaget global memory writes
-    if ((selected_bucket_idx != this_bucket_idx) && (selected_bucket_idx != invalid_bucket_idx)) {
+    if (append) {
       bucket_ptrs[selected_bucket_idx][bucket_block_start_offsets[selected_bucket_idx] +
                                        bucket_block_local_offsets[selected_bucket_idx]] = key;
     }
@@ -123,27 +162,158 @@ __global__ void move_and_invalidate_if(RowIterator row_first,
 
 }  // namespace detail
 
+// Buckets grow on demand (geometrically, to amortize re-allocation costs), so the initial capacity
+// needs not to be an upper bound of the bucket size. Bucket memory is allocated from the current
+// RMM device memory resource (use a pool memory resource to avoid cudaMalloc/cudaFree calls on
+// growth). Growth invalidates iterators and pointers to the bucket elements.
+//
+// A bucket constructed with a vertex range also has a dense representation: a bitmap with one bit
+// per vertex in the range. update_representation() (called after every insertion) switches to the
+// bitmap once the vertex list needs more memory than the bitmap and back to the (sorted) vertex
+// list once the bucket shrinks, see detail::bucket_dense_to_sparse_ratio. The dense representation
+// drops duplicate vertices and bounds the bucket memory by the bitmap size. data(), begin(), and
+// end() convert a dense bucket back to the vertex list (invalidating the bitmap pointer), so a
+// bucket whose elements are accessed by offsets across insertions should not enable the dense
+// representation.
 template <typename vertex_t, bool is_multi_gpu = false>
 class Bucket {
  public:
   Bucket(raft::handle_t const& handle, size_t capacity)
-    : handle_ptr_(&handle), elements_(capacity, handle.get_stream())
+    : handle_ptr_(&handle),
+      elements_(capacity, handle.get_stream()),
+      bitmap_(size_t{0}, handle.get_stream())
   {
-    thrust::fill(rmm::exec_policy(handle_ptr_->get_stream())->on(handle_ptr_->get_stream()),
-                 elements_.begin(),
-                 elements_.end(),
-                 invalid_vertex_id<vertex_t>::value);
+  }
+
+  Bucket(raft::handle_t const& handle, size_t capacity, vertex_t vertex_first, vertex_t vertex_last)
+    : handle_ptr_(&handle),
+      elements_(capacity, handle.get_stream()),
+      bitmap_(size_t{0}, handle.get_stream()),
+      vertex_first_(vertex_first),
+      vertex_last_(vertex_last),
+      dense_enabled_(true)
+  {
+    CUGRAPH_EXPECTS(vertex_first <= vertex_last,
+                    "Invalid input argument: vertex_first should not be larger than vertex_last.");
   }
 
   void insert(vertex_t v)
   {
-    raft::update_device(elements_.data() + size_, &v, 1, handle_ptr_->get_stream());
-    ++size_;
+    if (dense_) {
+      set_bits(thrust::make_constant_iterator(v), thrust::make_constant_iterator(v) + 1);
+    } else {
+      reserve(size_ + 1);
+      raft::update_device(elements_.data() + size_, &v, 1, handle_ptr_->get_stream());
+      ++size_;
+    }
+    update_representation();
   }
 
+  // insert the vertices in [vertex_first, vertex_last) (device accessible), this avoids a
+  // host-to-device copy per vertex
+  template <typename VertexIterator>
+  void insert(VertexIterator vertex_first, VertexIterator vertex_last)
+  {
+    static_assert(
+      std::is_same<typename std::iterator_traits<VertexIterator>::value_type, vertex_t>::value);
+    if (dense_) {
+      set_bits(vertex_first, vertex_last);
+    } else {
+      auto num_inserts = static_cast<size_t>(thrust::distance(vertex_first, vertex_last));
+      reserve(size_ + num_inserts);
+      thrust::copy(rmm::exec_policy(handle_ptr_->get_stream())->on(handle_ptr_->get_stream()),
+                   vertex_first,
+                   vertex_last,
+                   elements_.begin() + size_);
+      size_ += num_inserts;
+    }
+    update_representation();
+  }
+
+  void reserve(size_t new_capacity)
+  {
+    if (new_capacity > elements_.size()) {
+      elements_.resize(std::max(new_capacity, elements_.size() * 2), handle_ptr_->get_stream());
+    }
+  }
+
+  // switch the representation based on the bucket size (no-op if the dense representation is not
+  // enabled)
+  void update_representation()
+  {
+    if (!dense_enabled_) { return; }
+    auto list_bytes   = size_ * sizeof(vertex_t);
+    auto bitmap_bytes = num_bitmap_words() * sizeof(uint32_t);
+    if (!dense_ && (list_bytes > bitmap_bytes)) {
+      to_dense();
+    } else if (dense_ && (list_bytes * detail::bucket_dense_to_sparse_ratio < bitmap_bytes)) {
+      to_sparse();
+    }
+  }
+
+  void to_dense()
+  {
+    CUGRAPH_EXPECTS(dense_enabled_, "The dense representation is not enabled for this bucket.");
+    if (dense_) { return; }
+    bitmap_.resize(num_bitmap_words(), handle_ptr_->get_stream());
+    thrust::fill(rmm::exec_policy(handle_ptr_->get_stream())->on(handle_ptr_->get_stream()),
+                 bitmap_.begin(),
+                 bitmap_.end(),
+                 uint32_t{0});
+    dense_ = true;
+    set_bits(elements_.begin(), elements_.begin() + size_);
+  }
+
+  // the vertex list is sorted after the conversion
+  void to_sparse()
+  {
+    if (!dense_) { return; }
+    reserve(size_);
+    thrust::copy_if(rmm::exec_policy(handle_ptr_->get_stream())->on(handle_ptr_->get_stream()),
+                    thrust::make_counting_iterator(vertex_first_),
+                    thrust::make_counting_iterator(vertex_last_),
+                    elements_.begin(),
+                    [bitmap = bitmap_.data(), vertex_first = vertex_first_] __device__(auto v) {
+                      auto offset = static_cast<size_t>(v - vertex_first);
+                      return (bitmap[offset / detail::bucket_bitmap_word_bits] &
+                              (uint32_t{1} << (offset % detail::bucket_bitmap_word_bits))) != 0;
+                    });
+    dense_ = false;
+  }
+
+  bool is_dense() const { return dense_; }
+
+  // returns nullptr if the bucket is not dense
+  uint32_t* bitmap_data() { return dense_ ? bitmap_.data() : static_cast<uint32_t*>(nullptr); }
+
+  uint32_t const* bitmap_data() const
+  {
+    return dense_ ? bitmap_.data() : static_cast<uint32_t const*>(nullptr);
+  }
+
+  vertex_t get_bitmap_vertex_first() const { return vertex_first_; }
+
   size_t size() const { return size_; }
 
-  void set_size(size_t size) { size_ = size; }
+  void set_size(size_t size)
+  {
+    CUGRAPH_EXPECTS(!dense_, "set_size() is valid only for the sparse representation.");
+    size_ = size;
+  }
+
+  // recompute the size of a dense bucket after setting bits in device code (using bitmap_data())
+  void update_size_from_bitmap()
+  {
+    CUGRAPH_EXPECTS(dense_,
+                    "update_size_from_bitmap() is valid only for the dense representation.");
+    size_ = thrust::transform_reduce(
+      rmm::exec_policy(handle_ptr_->get_stream())->on(handle_ptr_->get_stream()),
+      bitmap_.begin(),
+      bitmap_.end(),
+      [] __device__(auto word) { return static_cast<size_t>(__popc(word)); },
+      size_t{0},
+      thrust::plus<size_t>());
+  }
 
   template <bool do_aggregate = is_multi_gpu>
   std::enable_if_t<do_aggregate, size_t> aggregate_size() const
@@ -157,26 +327,75 @@ class Bucket {
     return size_;
   }
 
-  void clear() { size_ = 0; }
+  void clear()
+  {
+    size_  = 0;
+    dense_ = false;  // the bitmap is re-initialized (without re-allocation) in to_dense()
+  }
 
   size_t capacity() const { return elements_.size(); }
 
-  auto const data() const { return elements_.data(); }
+  auto const data() const
+  {
+    CUGRAPH_EXPECTS(!dense_, "data() const is valid only for the sparse representation.");
+    return elements_.data();
+  }
 
-  auto data() { return elements_.data(); }
+  auto data()
+  {
+    to_sparse();
+    return elements_.data();
+  }
 
-  auto const begin() const { return elements_.begin(); }
+  auto const begin() const
+  {
+    CUGRAPH_EXPECTS(!dense_, "begin() const is valid only for the sparse representation.");
+    return elements_.begin();
+  }
 
-  auto begin() { return elements_.begin(); }
+  auto begin()
+  {
+    to_sparse();
+    return elements_.begin();
+  }
 
-  auto const end() const { return elements_.begin() + size_; }
+  auto const end() const
+  {
+    CUGRAPH_EXPECTS(!dense_, "end() const is valid only for the sparse representation.");
+    return elements_.begin() + size_;
+  }
 
-  auto end() { return elements_.begin() + size_; }
+  auto end()
+  {
+    to_sparse();
+    return elements_.begin() + size_;
+  }
 
  private:
+  size_t num_bitmap_words() const
+  {
+    auto num_bits = static_cast<size_t>(vertex_last_ - vertex_first_);
+    return (num_bits + (detail::bucket_bitmap_word_bits - 1)) / detail::bucket_bitmap_word_bits;
+  }
+
+  template <typename VertexIterator>
+  void set_bits(VertexIterator vertex_first, VertexIterator vertex_last)
+  {
+    thrust::for_each(rmm::exec_policy(handle_ptr_->get_stream())->on(handle_ptr_->get_stream()),
+                     vertex_first,
+                     vertex_last,
+                     detail::set_bucket_bitmap_bit_t<vertex_t>{bitmap_.data(), vertex_first_});
+    update_size_from_bitmap();
+  }
+
   raft::handle_t const* handle_ptr_{nullptr};
   rmm::device_uvector<vertex_t> elements_;
+  rmm::device_uvector<uint32_t> bitmap_;
   size_t size_{0};
+  vertex_t vertex_first_{0};
+  vertex_t vertex_last_{0};
+  bool dense_enabled_{false};
+  bool dense_{false};
 };
 
 template <typename vertex_t, bool is_multi_gpu = false, size_t num_buckets = 1>
@@ -188,23 +407,37 @@ class VertexFrontier {
   VertexFrontier(raft::handle_t const& handle, std::vector<size_t> bucket_capacities)
     : handle_ptr_(&handle),
       tmp_bucket_ptrs_(num_buckets, handle.get_stream()),
-      tmp_bucket_sizes_(num_buckets, handle.get_stream())
+      tmp_bucket_sizes_(num_buckets, handle.get_stream()),
+      tmp_bucket_bitmap_ptrs_(num_buckets, handle.get_stream())
   {
     CUGRAPH_EXPECTS(bucket_capacities.size() == num_buckets,
                     "invalid input argument bucket_capacities (size mismatch)");
-    thrust::fill(rmm::exec_policy(handle_ptr_->get_stream())->on(handle_ptr_->get_stream()),
-                 tmp_bucket_ptrs_.begin(),
-                 tmp_bucket_ptrs_.end(),
-                 static_cast<vertex_t*>(nullptr));
-    thrust::fill(rmm::exec_policy(handle_ptr_->get_stream())->on(handle_ptr_->get_stream()),
-                 tmp_bucket_sizes_.begin(),
-                 tmp_bucket_sizes_.end(),
-                 size_t{0});
+    initialize_tmp_buffers();
     for (size_t i = 0; i < num_buckets; ++i) {
       buckets_.emplace_back(handle, bucket_capacities[i]);
     }
   }
 
+  // every bucket also has the dense representation (a bitmap over [vertex_first, vertex_last),
+  // this should cover every vertex inserted to the buckets, typically the local vertex range)
+  VertexFrontier(raft::handle_t const& handle,
+                 std::vector<size_t> bucket_capacities,
+                 vertex_t vertex_first,
+                 vertex_t vertex_last)
+    : handle_ptr_(&handle),
+      tmp_bucket_ptrs_(num_buckets, handle.get_stream()),
+      tmp_bucket_sizes_(num_buckets, handle.get_stream()),
+      tmp_bucket_bitmap_ptrs_(num_buckets, handle.get_stream()),
+      bitmap_vertex_first_(vertex_first)
+  {
+    CUGRAPH_EXPECTS(bucket_capacities.size() == num_buckets,
+                    "invalid input argument bucket_capacities (size mismatch)");
+    initialize_tmp_buffers();
+    for (size_t i = 0; i < num_buckets; ++i) {
+      buckets_.emplace_back(handle, bucket_capacities[i], vertex_first, vertex_last);
+    }
+  }
+
   Bucket<vertex_t, is_multi_gpu>& get_bucket(size_t bucket_idx) { return buckets_[bucket_idx]; }
 
   Bucket<vertex_t, is_multi_gpu> const& get_bucket(size_t bucket_idx) const
@@ -212,16 +445,65 @@ class VertexFrontier {
     return buckets_[bucket_idx];
   }
 
+  // returns the aggregate sizes of the buckets in @p bucket_indices (with a single collective in
+  // multi-GPU, use this instead of multiple Bucket::aggregate_size() calls)
+  std::vector<size_t> aggregate_bucket_sizes(std::vector<size_t> const& bucket_indices) const
+  {
+    std::vector<size_t> sizes(bucket_indices.size());
+    for (size_t i = 0; i < bucket_indices.size(); ++i) {
+      sizes[i] = get_bucket(bucket_indices[i]).size();
+    }
+    if (is_multi_gpu) {
+      sizes = host_scalar_allreduce(handle_ptr_->get_comms(), sizes, handle_ptr_->get_stream());
+    }
+    return sizes;
+  }
+
   void swap_buckets(size_t bucket_idx0, size_t bucket_idx1)
   {
     std::swap(buckets_[bucket_idx0], buckets_[bucket_idx1]);
   }
 
+  // ensure every (sparse) bucket can accommodate @p num_new_elements more elements (to be appended
+  // in device code using the pointers returned by get_bucket_and_bucket_size_device_pointers()),
+  // dense buckets do not need to grow
+  void reserve_buckets(size_t num_new_elements)
+  {
+    for (size_t i = 0; i < num_buckets; ++i) {
+      if (!get_bucket(i).is_dense()) {
+        get_bucket(i).reserve(get_bucket(i).size() + num_new_elements);
+      }
+    }
+  }
+
+  // update the bucket sizes after appending elements in device code; @p bucket_sizes holds the list
+  // sizes read back from the device pointer returned by
+  // get_bucket_and_bucket_size_device_pointers() (ignored for dense buckets, these are recounted),
+  // the bucket @p skip_bucket_idx is not updated; then switch the bucket representations based on
+  // the new sizes
+  void update_bucket_sizes(std::vector<size_t> const& bucket_sizes,
+                           size_t skip_bucket_idx = kInvalidBucketIdx)
+  {
+    for (size_t i = 0; i < num_buckets; ++i) {
+      if (i == skip_bucket_idx) { continue; }
+      if (get_bucket(i).is_dense()) {
+        get_bucket(i).update_size_from_bitmap();
+      } else {
+        get_bucket(i).set_size(bucket_sizes[i]);
+      }
+    }
+    for (size_t i = 0; i < num_buckets; ++i) { get_bucket(i).update_representation(); }
+  }
+
   template <typename SplitOp>
   void split_bucket(size_t bucket_idx, SplitOp split_op)
   {
     auto constexpr invalid_vertex = invalid_vertex_id<vertex_t>::value;
 
+    // the split bucket is scanned as a vertex list
+    get_bucket(bucket_idx).to_sparse();
+    reserve_buckets(get_bucket(bucket_idx).size());
+
     auto bucket_and_bucket_size_device_ptrs = get_bucket_and_bucket_size_device_pointers();
 
     auto& this_bucket = get_bucket(bucket_idx);
@@ -239,6 +521,8 @@ class VertexFrontier {
                                         this_bucket.end(),
                                         std::get<0>(bucket_and_bucket_size_device_ptrs),
                                         std::get<1>(bucket_and_bucket_size_device_ptrs),
+                                        std::get<2>(bucket_and_bucket_size_device_ptrs),
+                                        std::get<3>(bucket_and_bucket_size_device_ptrs),
                                         bucket_idx,
                                         kInvalidBucketIdx,
                                         invalid_vertex,
@@ -259,37 +543,70 @@ class VertexFrontier {
     raft::update_host(
       bucket_sizes.data(), bucket_sizes_device_ptr, kNumBuckets, handle_ptr_->get_stream());
     CUDA_TRY(cudaStreamSynchronize(handle_ptr_->get_stream()));
-    for (size_t i = 0; i < kNumBuckets; ++i) {
-      if (i != bucket_idx) { get_bucket(i).set_size(bucket_sizes[i]); }
-    }
 
     auto size = thrust::distance(get_bucket(bucket_idx).begin(), it);
     get_bucket(bucket_idx).set_size(size);
+    update_bucket_sizes(bucket_sizes, bucket_idx);
 
     return;
   }
 
+  // returns the device pointers to the bucket element pointers, the bucket sizes, the bucket
+  // bitmap pointers (nullptr for sparse buckets, set the bit for (v - bitmap vertex first) to
+  // insert v to a dense bucket), and the bitmap vertex first (in this order), call
+  // update_bucket_sizes() after appending elements
   auto get_bucket_and_bucket_size_device_pointers()
   {
     std::vector<vertex_t*> tmp_ptrs(buckets_.size(), nullptr);
     std::vector<size_t> tmp_sizes(buckets_.size(), 0);
+    std::vector<uint32_t*> tmp_bitmap_ptrs(buckets_.size(), nullptr);
     for (size_t i = 0; i < buckets_.size(); ++i) {
-      tmp_ptrs[i]  = get_bucket(i).data();
-      tmp_sizes[i] = get_bucket(i).size();
+      auto& bucket = get_bucket(i);
+      if (bucket.is_dense()) {
+        tmp_bitmap_ptrs[i] = bucket.bitmap_data();
+      } else {
+        tmp_ptrs[i] = bucket.data();
+      }
+      tmp_sizes[i] = bucket.size();
     }
     raft::update_device(
       tmp_bucket_ptrs_.data(), tmp_ptrs.data(), tmp_ptrs.size(), handle_ptr_->get_stream());
     raft::update_device(
       tmp_bucket_sizes_.data(), tmp_sizes.data(), tmp_sizes.size(), handle_ptr_->get_stream());
+    raft::update_device(tmp_bucket_bitmap_ptrs_.data(),
+                        tmp_bitmap_ptrs.data(),
+                        tmp_bitmap_ptrs.size(),
+                        handle_ptr_->get_stream());
     CUDA_TRY(cudaStreamSynchronize(handle_ptr_->get_stream()));
-    return std::make_tuple(tmp_bucket_ptrs_.data(), tmp_bucket_sizes_.data());
+    return std::make_tuple(tmp_bucket_ptrs_.data(),
+                           tmp_bucket_sizes_.data(),
+                           tmp_bucket_bitmap_ptrs_.data(),
+                           bitmap_vertex_first_);
   }
 
  private:
+  void initialize_tmp_buffers()
+  {
+    thrust::fill(rmm::exec_policy(handle_ptr_->get_stream())->on(handle_ptr_->get_stream()),
+                 tmp_bucket_ptrs_.begin(),
+                 tmp_bucket_ptrs_.end(),
+                 static_cast<vertex_t*>(nullptr));
+    thrust::fill(rmm::exec_policy(handle_ptr_->get_stream())->on(handle_ptr_->get_stream()),
+                 tmp_bucket_sizes_.begin(),
+                 tmp_bucket_sizes_.end(),
+                 size_t{0});
+    thrust::fill(rmm::exec_policy(handle_ptr_->get_stream())->on(handle_ptr_->get_stream()),
+                 tmp_bucket_bitmap_ptrs_.begin(),
+                 tmp_bucket_bitmap_ptrs_.end(),
+                 static_cast<uint32_t*>(nullptr));
+  }
+
   raft::handle_t const* handle_ptr_{nullptr};
   std::vector<Bucket<vertex_t, is_multi_gpu>> buckets_{};
   rmm::device_uvector<vertex_t*> tmp_bucket_ptrs_;
   rmm::device_uvector<size_t> tmp_bucket_sizes_;
+  rmm::device_uvector<uint32_t*> tmp_bucket_bitmap_ptrs_;
+  vertex_t bitmap_vertex_first_{0};
 };
 
 }  // namespace experimental
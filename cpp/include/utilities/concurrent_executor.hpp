@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <utilities/workspace.hpp>
+
+#include <raft/handle.hpp>
+
+#include <cuda_runtime.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+
+namespace detail {
+
+// per-call resources of a call submitted to concurrent_executor_t: a handle using one of the
+// executor's streams and a workspace arena bound to the handle, the destructor synchronizes the
+// stream (so the call's temporaries and outputs are complete before the call's future is ready)
+class concurrent_call_t {
+ public:
+  concurrent_call_t(int device, cudaStream_t stream, size_t workspace_chunk_size);
+  ~concurrent_call_t();
+
+  concurrent_call_t(concurrent_call_t const&) = delete;
+  concurrent_call_t& operator=(concurrent_call_t const&) = delete;
+
+  raft::handle_t const& get_handle() const { return *handle_ptr_; }
+
+ private:
+  std::unique_ptr<raft::handle_t> handle_ptr_{};
+  std::unique_ptr<workspace_arena_t> arena_ptr_{};
+  std::unique_ptr<workspace_scope_t> scope_ptr_{};
+};
+
+}  // namespace detail
+
+/**
+ * @brief Run algorithm calls concurrently on a pool of CUDA streams.
+ *
+ * Every algorithm in algorithms.hpp runs on the stream of the handle passed to it, so the calls
+ * sharing a handle are serialized even if each call leaves most of the GPU idle (e.g. the
+ * traversals on small frontiers). submit() runs a call on a host thread with its own handle bound
+ * to one of this executor's streams and its own workspace arena, and returns a future for the
+ * call's result; calls on different streams overlap on the GPU.
+ *
+ * The submitted calls can read the same graph (graph_t or graph_view_t objects are accessed
+ * read-only by the algorithms and the cached graph properties, see graph_view_t::get_in_degrees(),
+ * are computed once and published only after the computing stream is synchronized). Each call
+ * should write to its own output buffers. The calls are ordered after the work submitted to the
+ * parent handle's stream before submit() (so the graph and the input buffers can be prepared on
+ * the parent stream) and the future becomes ready once the call's work on its stream is complete.
+ *
+ * Single-GPU only: the communicators of a multi-GPU handle are not safe to use from multiple
+ * threads (and the collective operations of concurrent calls can interleave differently on
+ * different GPUs).
+ *
+ * Device memory is allocated on the call's stream; buffers allocated in a call and returned in its
+ * result should be freed before this executor (and its streams) is destroyed.
+ */
+class concurrent_executor_t {
+ public:
+  static size_t constexpr default_num_streams = 4;
+
+  /**
+   * @param handle RAFT handle object (single-GPU) the submitted calls are ordered after.
+   * @param num_streams Number of streams in the pool (calls are assigned to the streams in a
+   * round-robin manner, the calls assigned to the same stream are serialized on the GPU).
+   * @param workspace_chunk_size Chunk size of the per-call workspace arenas (see
+   * workspace_arena_t).
+   */
+  explicit concurrent_executor_t(
+    raft::handle_t const& handle,
+    size_t num_streams          = default_num_streams,
+    size_t workspace_chunk_size = workspace_arena_t::default_chunk_size);
+  ~concurrent_executor_t();
+
+  concurrent_executor_t(concurrent_executor_t const&) = delete;
+  concurrent_executor_t& operator=(concurrent_executor_t const&) = delete;
+
+  size_t get_num_streams() const { return streams_.size(); }
+
+  /**
+   * @brief Run @p f(call_handle) asynchronously.
+   *
+   * @tparam F Type of the callable, invoked with a `raft::handle_t const&` (the handle of the
+   * call, to be passed to the algorithms called in @p f).
+   * @param f Callable to run; everything captured by reference should outlive the call.
+   * @return std::future holding @p f's return value (or the exception thrown by @p f).
+   */
+  template <typename F>
+  std::future<std::result_of_t<std::decay_t<F>(raft::handle_t const&)>> submit(F&& f)
+  {
+    using result_t = std::result_of_t<std::decay_t<F>(raft::handle_t const&)>;
+
+    auto stream = acquire_stream();
+    try {
+      return std::async(std::launch::async,
+                        [this, stream, f = std::forward<F>(f)]() mutable -> result_t {
+                          pending_call_guard_t guard(*this);
+                          detail::concurrent_call_t call(device_, stream, workspace_chunk_size_);
+                          return f(call.get_handle());
+                        });
+    } catch (...) {  // failed to launch the call
+      release_call();
+      throw;
+    }
+  }
+
+  // block until every submitted call completes
+  void wait() const;
+
+ private:
+  // decrements the number of pending calls on destruction (including when the call throws)
+  struct pending_call_guard_t {
+    explicit pending_call_guard_t(concurrent_executor_t const& executor) : executor_(executor) {}
+    ~pending_call_guard_t() { executor_.release_call(); }
+
+    concurrent_executor_t const& executor_;
+  };
+
+  // picks the next stream (in a round-robin manner), orders it after the parent stream, and
+  // increments the number of pending calls
+  cudaStream_t acquire_stream();
+  void release_call() const;
+
+  raft::handle_t const& handle_;
+  int device_{0};
+  size_t workspace_chunk_size_{0};
+
+  std::vector<cudaStream_t> streams_{};
+  cudaEvent_t event_{};
+
+  mutable std::mutex mutex_{};
+  mutable std::condition_variable cv_{};
+  size_t next_stream_idx_{0};
+  mutable size_t num_pending_calls_{0};
+};
+
+}  // namespace experimental
+}  // namespace cugraph
@@ -21,6 +21,9 @@
 #include <rmm/device_uvector.hpp>
 #include <utilities/graph_traits.hpp>
 
+#include <memory>
+#include <typeindex>
+
 namespace cugraph {
 namespace cython {
 
@@ -72,21 +75,48 @@ struct graph_container_t {
     std::unique_ptr<GraphCOOView<int32_t, int32_t, double>> GraphCOOViewDoublePtr;
   };
 
+  // graph_t instance built from the primitive data below by the first
+  // call_<algo> wrapper that needs it, and reused by the following calls.
+  // graph_t is type-erased as its template parameters are run-time values in
+  // the container; graph_type_id records the actual graph_t type and
+  // handle_ptr the handle the graph_t instance was created with (a mismatch
+  // on either rebuilds the graph_t instance).
+  struct cached_graph_t {
+    std::shared_ptr<void> graph_ptr{};
+    std::type_index graph_type_id{typeid(void)};
+    raft::handle_t const* handle_ptr{nullptr};
+  };
+
   graph_container_t() : graph_ptr_union{nullptr}, graph_type{graphTypeEnum::null} {}
   ~graph_container_t() {}
 
-  // The expected usage of a graph_container_t is for it to be created as part
-  // of a cython wrapper simply for passing a templated instantiation of a
-  // particular graph class from one call to another, and not to exist outside
-  // of the individual wrapper function (deleted when the instance goes out of
-  // scope once the wrapper function returns). Therefore, copys and assignments
-  // to an instance are not supported and these methods are deleted.
+  // A graph_container_t can be created as part of a cython wrapper simply for
+  // passing a templated instantiation of a particular graph class from one
+  // call to another (deleted when the instance goes out of scope once the
+  // wrapper function returns), or be created by create_graph_container() and
+  // held by the caller across multiple wrapper calls; in the latter case, the
+  // graph_t instance (including the CSR compression and the expensive checks)
+  // is built once and shared by every call. Copys and assignments to an
+  // instance are not supported and these methods are deleted.
   graph_container_t(const graph_container_t&) = delete;
   graph_container_t& operator=(const graph_container_t&) = delete;
 
+  // Releases the cached graph_t instances (graph_t instances still in use by a
+  // running wrapper call are deleted once the call returns).
+  void release_cached_graphs()
+  {
+    cached_graphs[0] = cached_graph_t{};
+    cached_graphs[1] = cached_graph_t{};
+  }
+
   graphPtrUnion graph_ptr_union;
   graphTypeEnum graph_type;
 
+  // cached graph_t instances, indexed by transposed (algorithms may need
+  // either the transposed or non-transposed form of the same graph). This is
+  // mutable as wrappers take the container as a const reference.
+  mutable cached_graph_t cached_graphs[2];
+
   // primitive data used for constructing graph_t instances.
   void* src_vertices;
   void* dst_vertices;
@@ -388,6 +418,14 @@ void populate_graph_container(graph_container_t& graph_container,
                               bool transposed,
                               bool multi_gpu);
 
+// Creates an empty graph container to be populated by populate_graph_container()
+// and held by the caller (e.g. a Python graph object) across wrapper calls, so
+// the graph_t instance built by the first wrapper call is reused by the
+// following calls. The arrays passed to populate_graph_container() should stay
+// valid until the first wrapper call returns (graph_t copies the edges), and
+// the handle should stay valid while the container is alive.
+std::shared_ptr<graph_container_t> create_graph_container();
+
 // FIXME: comment this function
 // FIXME: Should local_* values be void* as well?
 void populate_graph_container_legacy(graph_container_t& graph_container,
@@ -19,6 +19,7 @@
 
 #include <raft/handle.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/tuple.h>
@@ -31,19 +32,22 @@ namespace experimental {
 namespace detail {
 
 template <typename TupleType, size_t I>
-auto allocate_dataframe_buffer_tuple_element_impl(size_t buffer_size, cudaStream_t stream)
+auto allocate_dataframe_buffer_tuple_element_impl(size_t buffer_size,
+                                                  cudaStream_t stream,
+                                                  rmm::mr::device_memory_resource* mr)
 {
   using element_t = typename thrust::tuple_element<I, TupleType>::type;
-  return rmm::device_uvector<element_t>(buffer_size, stream);
+  return rmm::device_uvector<element_t>(buffer_size, stream, mr);
 }
 
 template <typename TupleType, size_t... Is>
 auto allocate_dataframe_buffer_tuple_impl(std::index_sequence<Is...>,
                                           size_t buffer_size,
-                                          cudaStream_t stream)
+                                          cudaStream_t stream,
+                                          rmm::mr::device_memory_resource* mr)
 {
   return std::make_tuple(
-    allocate_dataframe_buffer_tuple_element_impl<TupleType, Is>(buffer_size, stream)...);
+    allocate_dataframe_buffer_tuple_element_impl<TupleType, Is>(buffer_size, stream, mr)...);
 }
 
 template <typename TupleType, typename BufferType, size_t I, size_t N>
@@ -79,17 +83,23 @@ auto get_dataframe_buffer_begin_tuple_impl(std::index_sequence<Is...>, BufferTyp
 }  // namespace detail
 
 template <typename T, typename std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
-auto allocate_dataframe_buffer(size_t buffer_size, cudaStream_t stream)
+auto allocate_dataframe_buffer(
+  size_t buffer_size,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
-  return rmm::device_uvector<T>(buffer_size, stream);
+  return rmm::device_uvector<T>(buffer_size, stream, mr);
 }
 
 template <typename T, typename std::enable_if_t<is_thrust_tuple_of_arithmetic<T>::value>* = nullptr>
-auto allocate_dataframe_buffer(size_t buffer_size, cudaStream_t stream)
+auto allocate_dataframe_buffer(
+  size_t buffer_size,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
   size_t constexpr tuple_size = thrust::tuple_size<T>::value;
   return detail::allocate_dataframe_buffer_tuple_impl<T>(
-    std::make_index_sequence<tuple_size>(), buffer_size, stream);
+    std::make_index_sequence<tuple_size>(), buffer_size, stream, mr);
 }
 
 template <typename T,
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <utilities/profiling.hpp>
 #include <utilities/thrust_tuple_utils.cuh>
 
 #include <raft/handle.hpp>
@@ -24,6 +25,7 @@
 #include <thrust/device_ptr.h>
 #include <thrust/iterator/detail/normal_iterator.h>
 
+#include <numeric>
 #include <type_traits>
 
 namespace cugraph {
@@ -31,6 +33,14 @@ namespace experimental {
 
 namespace detail {
 
+// accumulates the bytes sent by this rank to the "bytes_communicated" counter of the innermost
+// profile range (a no-op unless profiling is enabled)
+template <typename value_type>
+void add_bytes_communicated(size_t count)
+{
+  add_profile_counter("bytes_communicated", static_cast<int64_t>(count * sizeof(value_type)));
+}
+
 template <typename T>
 T* iter_to_raw_ptr(T* ptr)
 {
@@ -72,6 +82,7 @@ std::enable_if_t<std::is_arithmetic<OutputValueType>::value, void> device_isend_
 {
   static_assert(
     std::is_same<typename std::iterator_traits<InputIterator>::value_type, OutputValueType>::value);
+  add_bytes_communicated<OutputValueType>(count);
   comm.isend(iter_to_raw_ptr(input_first), count, dst, tag, request);
 }
 
@@ -196,6 +207,7 @@ device_sendrecv_impl(raft::comms::comms_t const& comm,
   using value_type = typename std::iterator_traits<InputIterator>::value_type;
   static_assert(
     std::is_same<typename std::iterator_traits<OutputIterator>::value_type, value_type>::value);
+  add_bytes_communicated<value_type>(tx_count);
   comm.device_sendrecv(iter_to_raw_ptr(input_first),
                        tx_count,
                        dst,
@@ -282,6 +294,8 @@ device_multicast_sendrecv_impl(raft::comms::comms_t const& comm,
   using value_type = typename std::iterator_traits<InputIterator>::value_type;
   static_assert(
     std::is_same<typename std::iterator_traits<OutputIterator>::value_type, value_type>::value);
+  add_bytes_communicated<value_type>(
+    std::accumulate(tx_counts.begin(), tx_counts.end(), size_t{0}));
   comm.device_multicast_sendrecv(iter_to_raw_ptr(input_first),
                                  tx_counts,
                                  tx_offsets,
@@ -377,6 +391,7 @@ device_bcast_impl(raft::comms::comms_t const& comm,
   static_assert(std::is_same<typename std::iterator_traits<InputIterator>::value_type,
                              typename std::iterator_traits<OutputIterator>::value_type>::value);
   if (comm.get_rank() == root) {
+    add_bytes_communicated<typename std::iterator_traits<InputIterator>::value_type>(count);
     comm.bcast(iter_to_raw_ptr(input_first), count, root, stream);
   } else {
     comm.bcast(iter_to_raw_ptr(output_first), count, root, stream);
@@ -440,6 +455,7 @@ device_allreduce_impl(raft::comms::comms_t const& comm,
 {
   static_assert(std::is_same<typename std::iterator_traits<InputIterator>::value_type,
                              typename std::iterator_traits<OutputIterator>::value_type>::value);
+  add_bytes_communicated<typename std::iterator_traits<InputIterator>::value_type>(count);
   comm.allreduce(iter_to_raw_ptr(input_first), iter_to_raw_ptr(output_first), count, op, stream);
 }
 
@@ -502,6 +518,7 @@ device_reduce_impl(raft::comms::comms_t const& comm,
 {
   static_assert(std::is_same<typename std::iterator_traits<InputIterator>::value_type,
                              typename std::iterator_traits<OutputIterator>::value_type>::value);
+  add_bytes_communicated<typename std::iterator_traits<InputIterator>::value_type>(count);
   comm.reduce(iter_to_raw_ptr(input_first), iter_to_raw_ptr(output_first), count, op, root, stream);
 }
 
@@ -565,6 +582,8 @@ device_allgatherv_impl(raft::comms::comms_t const& comm,
 {
   static_assert(std::is_same<typename std::iterator_traits<InputIterator>::value_type,
                              typename std::iterator_traits<OutputIterator>::value_type>::value);
+  add_bytes_communicated<typename std::iterator_traits<InputIterator>::value_type>(
+    recvcounts[comm.get_rank()]);
   comm.allgatherv(iter_to_raw_ptr(input_first),
                   iter_to_raw_ptr(output_first),
                   recvcounts.data(),
@@ -633,6 +652,7 @@ device_gatherv_impl(raft::comms::comms_t const& comm,
 {
   static_assert(std::is_same<typename std::iterator_traits<InputIterator>::value_type,
                              typename std::iterator_traits<OutputIterator>::value_type>::value);
+  add_bytes_communicated<typename std::iterator_traits<InputIterator>::value_type>(sendcount);
   comm.gatherv(iter_to_raw_ptr(input_first),
                iter_to_raw_ptr(output_first),
                sendcount,
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+
+namespace cugraph {
+namespace experimental {
+
+/**
+ * @brief Memory holding the edge arrays (indices and weights) of a graph.
+ *
+ * device: device memory (allocated from the current device memory resource).
+ * managed: CUDA managed memory, the graph can exceed the device memory; the pattern kernels process
+ * the edges in tiles and prefetch every tile to the device before processing it (pages are marked
+ * read mostly after construction, so evicting a tile does not write it back).
+ * pinned_host: mapped pinned host memory, the kernels read the edges over the interconnect
+ * (zero-copy, no device memory is used for the edges).
+ */
+enum class graph_storage_t { device = 0, managed, pinned_host };
+
+namespace detail {
+
+// the pattern kernels process the graph edges in managed memory in tiles of (at most, except for
+// the tiles with a single major) this number of edges
+size_t constexpr managed_storage_tile_size = size_t{1} << 26;
+
+// memory resource to allocate the edge arrays of a graph with the storage
+rmm::mr::device_memory_resource* get_graph_storage_resource(graph_storage_t storage);
+
+// true if ptr points to CUDA managed memory
+bool is_managed_memory(void const* ptr);
+
+// mark the managed memory range read mostly and accessed by the current device (a no-op if ptr
+// does not point to managed memory)
+void advise_read_mostly(void const* ptr, size_t bytes);
+
+// prefetch the managed memory range to the current device (a no-op if ptr does not point to managed
+// memory)
+void prefetch_to_device(void const* ptr, size_t bytes, cudaStream_t stream);
+
+}  // namespace detail
+
+}  // namespace experimental
+}  // namespace cugraph
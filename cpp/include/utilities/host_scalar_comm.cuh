@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <utilities/profiling.hpp>
 #include <utilities/thrust_tuple_utils.cuh>
 
 #include <raft/handle.hpp>
@@ -22,6 +23,7 @@
 
 #include <numeric>
 #include <type_traits>
+#include <vector>
 
 namespace cugraph {
 namespace experimental {
@@ -118,18 +120,55 @@ struct host_reduce_tuple_scalar_element_impl<TupleType, I, I> {
 
 template <typename T>
 std::enable_if_t<std::is_arithmetic<T>::value, T> host_scalar_allreduce(
-  raft::comms::comms_t const& comm, T input, cudaStream_t stream)
+  raft::comms::comms_t const& comm, T input, raft::comms::op_t op, cudaStream_t stream)
 {
   rmm::device_uvector<T> d_input(1, stream);
   raft::update_device(d_input.data(), &input, 1, stream);
-  comm.allreduce(d_input.data(), d_input.data(), 1, raft::comms::op_t::SUM, stream);
+  comm.allreduce(d_input.data(), d_input.data(), 1, op, stream);
   T h_input{};
   raft::update_host(&h_input, d_input.data(), 1, stream);
+  detail::add_profile_counter("host_scalar_collectives", 1);
   auto status = comm.sync_stream(stream);
   CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
   return h_input;
 }
 
+template <typename T>
+std::enable_if_t<std::is_arithmetic<T>::value, T> host_scalar_allreduce(
+  raft::comms::comms_t const& comm, T input, cudaStream_t stream)
+{
+  return host_scalar_allreduce(comm, input, raft::comms::op_t::SUM, stream);
+}
+
+// Batched version (all-reduces every element of @p inputs with a single collective and a single
+// stream synchronization), combine the per-iteration scalars (e.g. frontier sizes, residuals, and
+// counts) reduced with the same operator to reduce latency in large scale runs.
+template <typename T>
+std::enable_if_t<std::is_arithmetic<T>::value, std::vector<T>> host_scalar_allreduce(
+  raft::comms::comms_t const& comm,
+  std::vector<T> const& inputs,
+  raft::comms::op_t op,
+  cudaStream_t stream)
+{
+  std::vector<T> h_outputs(inputs.size());
+  if (inputs.size() == 0) { return h_outputs; }
+  rmm::device_uvector<T> d_inputs(inputs.size(), stream);
+  raft::update_device(d_inputs.data(), inputs.data(), inputs.size(), stream);
+  comm.allreduce(d_inputs.data(), d_inputs.data(), d_inputs.size(), op, stream);
+  raft::update_host(h_outputs.data(), d_inputs.data(), d_inputs.size(), stream);
+  detail::add_profile_counter("host_scalar_collectives", 1);
+  auto status = comm.sync_stream(stream);
+  CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
+  return h_outputs;
+}
+
+template <typename T>
+std::enable_if_t<std::is_arithmetic<T>::value, std::vector<T>> host_scalar_allreduce(
+  raft::comms::comms_t const& comm, std::vector<T> const& inputs, cudaStream_t stream)
+{
+  return host_scalar_allreduce(comm, inputs, raft::comms::op_t::SUM, stream);
+}
+
 template <typename T>
 std::enable_if_t<cugraph::experimental::is_thrust_tuple_of_arithmetic<T>::value, T>
 host_scalar_allreduce(raft::comms::comms_t const& comm, T input, cudaStream_t stream)
@@ -147,6 +186,7 @@ host_scalar_allreduce(raft::comms::comms_t const& comm, T input, cudaStream_t st
     comm, d_tuple_scalar_elements, stream);
   raft::update_host(
     h_tuple_scalar_elements.data(), d_tuple_scalar_elements.data(), tuple_size, stream);
+  detail::add_profile_counter("host_scalar_collectives", 1);
   auto status = comm.sync_stream(stream);
   CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
   detail::update_tuple_from_vector_of_tuple_scalar_elements_impl<T, size_t{0}, tuple_size>().update(
@@ -165,6 +205,7 @@ std::enable_if_t<std::is_arithmetic<T>::value, T> host_scalar_reduce(
   comm.reduce(d_input.data(), d_input.data(), 1, raft::comms::op_t::SUM, stream);
   T h_input{};
   if (comm.get_rank() == root) { raft::update_host(&h_input, d_input.data(), 1, stream); }
+  detail::add_profile_counter("host_scalar_collectives", 1);
   auto status = comm.sync_stream(stream);
   CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
   return h_input;
@@ -190,6 +231,7 @@ host_scalar_reduce(raft::comms::comms_t const& comm, T input, int root, cudaStre
     raft::update_host(
       h_tuple_scalar_elements.data(), d_tuple_scalar_elements.data(), tuple_size, stream);
   }
+  detail::add_profile_counter("host_scalar_collectives", 1);
   auto status = comm.sync_stream(stream);
   CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
   if (comm.get_rank() == root) {
@@ -209,6 +251,7 @@ std::enable_if_t<std::is_arithmetic<T>::value, T> host_scalar_bcast(
   comm.bcast(d_input.data(), 1, root, stream);
   auto h_input = input;
   if (comm.get_rank() != root) { raft::update_host(&h_input, d_input.data(), 1, stream); }
+  detail::add_profile_counter("host_scalar_collectives", 1);
   auto status = comm.sync_stream(stream);
   CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
   return h_input;
@@ -234,6 +277,7 @@ host_scalar_bcast(raft::comms::comms_t const& comm, T input, int root, cudaStrea
     raft::update_host(
       h_tuple_scalar_elements.data(), d_tuple_scalar_elements.data(), tuple_size, stream);
   }
+  detail::add_profile_counter("host_scalar_collectives", 1);
   auto status = comm.sync_stream(stream);
   CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
   if (comm.get_rank() != root) {
@@ -261,6 +305,7 @@ std::enable_if_t<std::is_arithmetic<T>::value, std::vector<T>> host_scalar_allga
                   stream);
   std::vector<T> h_outputs(rx_counts.size());
   raft::update_host(h_outputs.data(), d_outputs.data(), rx_counts.size(), stream);
+  detail::add_profile_counter("host_scalar_collectives", 1);
   auto status = comm.sync_stream(stream);
   CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
   return h_outputs;
@@ -295,6 +340,7 @@ host_scalar_allgather(raft::comms::comms_t const& comm, T input, cudaStream_t st
                     d_allgathered_tuple_scalar_elements.data(),
                     comm.get_size() * tuple_size,
                     stream);
+  detail::add_profile_counter("host_scalar_collectives", 1);
   auto status = comm.sync_stream(stream);
   CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
 
@@ -330,6 +376,7 @@ std::enable_if_t<std::is_arithmetic<T>::value, std::vector<T>> host_scalar_gathe
   if (comm.get_rank() == root) {
     raft::update_host(h_outputs.data(), d_outputs.data(), comm.get_size(), stream);
   }
+  detail::add_profile_counter("host_scalar_collectives", 1);
   auto status = comm.sync_stream(stream);
   CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
   return h_outputs;
@@ -368,6 +415,7 @@ host_scalar_gather(raft::comms::comms_t const& comm, T input, int root, cudaStre
                       comm.get_size() * tuple_size,
                       stream);
   }
+  detail::add_profile_counter("host_scalar_collectives", 1);
   auto status = comm.sync_stream(stream);
   CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
 
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <raft/handle.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+
+// Instrumentation layer shared by the algorithms and the patterns. Algorithm phases and pattern
+// calls open named profile ranges; ranges nest, and a range is identified by the '/' separated
+// path of the enclosing range names (e.g. "pagerank/copy_v_transform_reduce_in_nbr").
+//
+// Every range is an NVTX range (if the library is built with USE_NVTX) to attribute the GPU work in
+// Nsight. If profiling is enabled, every range also records CUDA events on the handle's stream
+// (so the measured time is the GPU time of the work enqueued inside the range, not the host time)
+// and counters (e.g. iterations, frontier sizes, edges traversed, bytes communicated) are
+// accumulated per range path. Events are read back only when a report is requested, so
+// profiling adds no stream synchronization to the instrumented code.
+
+/**
+ * @brief Enable or disable profiling (GPU timers and counters).
+ *
+ * Profiling is also enabled if the CUGRAPH_PROFILING environment variable is set to a non-zero
+ * value. NVTX ranges do not depend on this flag.
+ *
+ * @param enable Flag to enable (true) or disable (false) profiling.
+ */
+void set_profiling(bool enable);
+
+/**
+ * @brief Query whether profiling is enabled.
+ *
+ * @return bool true if profiling is enabled, false otherwise.
+ */
+bool is_profiling_enabled();
+
+struct profile_range_record_t {
+  std::string path{};
+  size_t num_calls{0};
+  double gpu_time_ms{0.0};  // total over the calls
+};
+
+struct profile_counter_record_t {
+  std::string path{};  // path of the enclosing range + '/' + counter name
+  size_t num_updates{0};
+  int64_t sum{0};
+  int64_t max{0};
+};
+
+struct profiling_report_t {
+  std::vector<profile_range_record_t> ranges{};      // sorted by path
+  std::vector<profile_counter_record_t> counters{};  // sorted by path
+
+  // {"ranges": [{"path": ..., "num_calls": ..., "gpu_time_ms": ...}, ...], "counters": [...]}
+  std::string to_json() const;
+};
+
+/**
+ * @brief Get the profiling report accumulated since the last clear_profiling_report() call.
+ *
+ * This function waits for the events recorded by the closed ranges (so the GPU work of the
+ * profiled calls should be enqueued before calling this function).
+ *
+ * @return profiling_report_t Per range path GPU times and counters.
+ */
+profiling_report_t get_profiling_report();
+
+/**
+ * @brief Remove every accumulated range record and counter.
+ */
+void clear_profiling_report();
+
+namespace detail {
+
+// RAII profile range, open at construction and closed at destruction (ranges should be closed in
+// the reverse order of opening in a host thread)
+class profile_range_t {
+ public:
+  profile_range_t(raft::handle_t const& handle, char const* name);
+  ~profile_range_t();
+
+  profile_range_t(profile_range_t const&) = delete;
+  profile_range_t& operator=(profile_range_t const&) = delete;
+
+ private:
+  cudaStream_t stream_{};
+  cudaEvent_t start_{};
+  bool timing_{false};
+};
+
+// accumulate value to the counter name of the innermost open range (a no-op if profiling is
+// disabled)
+void add_profile_counter(char const* name, int64_t value);
+
+}  // namespace detail
+
+}  // namespace experimental
+}  // namespace cugraph
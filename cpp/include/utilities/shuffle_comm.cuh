@@ -17,6 +17,8 @@
 
 #include <utilities/dataframe_buffer.cuh>
 #include <utilities/device_comm.cuh>
+#include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <raft/handle.hpp>
@@ -26,9 +28,12 @@
 #include <thrust/fill.h>
 #include <thrust/reduce.h>
 #include <thrust/scatter.h>
+#include <thrust/sort.h>
 #include <thrust/tuple.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <numeric>
 #include <vector>
 
@@ -108,6 +113,64 @@ compute_tx_rx_counts_offsets_ranks(raft::comms::comms_t const &comm,
   return std::make_tuple(tx_counts, tx_offsets, tx_dst_ranks, rx_counts, rx_offsets, rx_src_ranks);
 }
 
+int32_t constexpr count_values_per_group_block_size = 512;  // FIXME: block size requires tuning
+int32_t constexpr count_values_per_group_max_num_blocks = 1024;  // FIXME: requires tuning
+size_t constexpr count_values_per_group_max_num_shared_groups =
+  (size_t{48} * 1024) / sizeof(uint32_t);
+
+// counts[i] += the number of values mapped to group i, block local counts are accumulated in shared
+// memory if use_shared_counters is true.
+template <typename ValueIterator, typename ValueToGroupIdOp>
+__global__ void count_values_per_group(ValueIterator value_first,
+                                       size_t num_values,
+                                       ValueToGroupIdOp value_to_group_id_op,
+                                       int num_groups,
+                                       bool use_shared_counters,
+                                       unsigned long long int *counts)
+{
+  extern __shared__ uint32_t block_counts[];
+
+  if (use_shared_counters) {
+    for (int i = threadIdx.x; i < num_groups; i += blockDim.x) { block_counts[i] = uint32_t{0}; }
+    __syncthreads();
+  }
+
+  auto const tid = threadIdx.x + blockIdx.x * blockDim.x;
+  auto idx       = static_cast<size_t>(tid);
+  while (idx < num_values) {
+    auto group_id = value_to_group_id_op(*(value_first + idx));
+    if (use_shared_counters) {
+      atomicAdd(block_counts + group_id, uint32_t{1});
+    } else {
+      atomicAdd(counts + group_id, static_cast<unsigned long long int>(1));
+    }
+    idx += gridDim.x * blockDim.x;
+  }
+
+  if (use_shared_counters) {
+    __syncthreads();
+    for (int i = threadIdx.x; i < num_groups; i += blockDim.x) {
+      if (block_counts[i] > 0) {
+        atomicAdd(counts + i, static_cast<unsigned long long int>(block_counts[i]));
+      }
+    }
+  }
+}
+
+template <typename ValueIterator, typename ValueToGroupIdOp>
+void sort_by_group_id(ValueIterator value_first /* [INOUT */,
+                      ValueIterator value_last /* [INOUT */,
+                      ValueToGroupIdOp value_to_group_id_op,
+                      cudaStream_t stream)
+{
+  thrust::sort(rmm::exec_policy(stream)->on(stream),
+               value_first,
+               value_last,
+               [value_to_group_id_op] __device__(auto lhs, auto rhs) {
+                 return value_to_group_id_op(lhs) < value_to_group_id_op(rhs);
+               });
+}
+
 }  // namespace detail
 
 template <typename ValueIterator, typename ValueToGPUIdOp>
@@ -294,6 +357,201 @@ auto groupby_gpuid_and_shuffle_values(raft::comms::comms_t const &comm,
   return std::make_tuple(std::move(rx_value_buffer), rx_counts);
 }
 
+// Chunked & pipelined variant of groupby_gpuid_and_shuffle_values. The input is grouped (sorted)
+// chunk by chunk (this bounds the temporary memory requirement of sorting to max_chunk_size
+// elements), and grouping chunk i + 1 overlaps with transferring chunk i. The output has the same
+// layout as groupby_gpuid_and_shuffle_values (values received from the same GPU are contiguous
+// and ordered by source rank). max_chunk_size should be smaller than 2^32.
+template <typename ValueIterator, typename ValueToGPUIdOp>
+auto chunked_groupby_gpuid_and_shuffle_values(raft::comms::comms_t const &comm,
+                                              ValueIterator tx_value_first /* [INOUT */,
+                                              ValueIterator tx_value_last /* [INOUT */,
+                                              ValueToGPUIdOp value_to_gpu_id_op,
+                                              size_t max_chunk_size,
+                                              cudaStream_t stream)
+{
+  static_assert(sizeof(size_t) == sizeof(unsigned long long int));
+
+  auto const comm_size = comm.get_size();
+
+  CUGRAPH_EXPECTS((max_chunk_size > 0) &&
+                    (max_chunk_size <= static_cast<size_t>(std::numeric_limits<uint32_t>::max())),
+                  "Invalid input argument: max_chunk_size should be in [1, 2^32).");
+
+  auto num_values = static_cast<size_t>(thrust::distance(tx_value_first, tx_value_last));
+  auto num_local_chunks = (num_values + (max_chunk_size - 1)) / max_chunk_size;
+  auto num_chunks =
+    host_scalar_allreduce(comm, num_local_chunks, raft::comms::op_t::MAX, stream);
+
+  // 1. count the number of values to send to each GPU in each chunk (this does not require
+  // sorting)
+
+  rmm::device_uvector<size_t> d_chunk_tx_counts(num_chunks * comm_size, stream);
+  thrust::fill(rmm::exec_policy(stream)->on(stream),
+               d_chunk_tx_counts.begin(),
+               d_chunk_tx_counts.end(),
+               size_t{0});
+  auto use_shared_counters =
+    static_cast<size_t>(comm_size) <= detail::count_values_per_group_max_num_shared_groups;
+  for (size_t i = 0; i < num_local_chunks; ++i) {
+    auto chunk_size = std::min(max_chunk_size, num_values - i * max_chunk_size);
+    auto num_blocks = std::min(
+      static_cast<int32_t>((chunk_size + (detail::count_values_per_group_block_size - 1)) /
+                           detail::count_values_per_group_block_size),
+      detail::count_values_per_group_max_num_blocks);
+    detail::count_values_per_group<<<num_blocks,
+                                     detail::count_values_per_group_block_size,
+                                     use_shared_counters ? comm_size * sizeof(uint32_t) : 0,
+                                     stream>>>(
+      tx_value_first + i * max_chunk_size,
+      chunk_size,
+      value_to_gpu_id_op,
+      comm_size,
+      use_shared_counters,
+      reinterpret_cast<unsigned long long int *>(d_chunk_tx_counts.data() + i * comm_size));
+  }
+
+  std::vector<size_t> h_chunk_tx_counts(d_chunk_tx_counts.size());
+  raft::update_host(
+    h_chunk_tx_counts.data(), d_chunk_tx_counts.data(), d_chunk_tx_counts.size(), stream);
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  // 2. exchange the per-chunk counts (send num_chunks counts to every GPU)
+
+  std::vector<size_t> h_dst_major_chunk_tx_counts(h_chunk_tx_counts.size());
+  for (int i = 0; i < comm_size; ++i) {
+    for (size_t j = 0; j < num_chunks; ++j) {
+      h_dst_major_chunk_tx_counts[i * num_chunks + j] = h_chunk_tx_counts[j * comm_size + i];
+    }
+  }
+  raft::update_device(d_chunk_tx_counts.data(),
+                      h_dst_major_chunk_tx_counts.data(),
+                      h_dst_major_chunk_tx_counts.size(),
+                      stream);
+  rmm::device_uvector<size_t> d_src_major_chunk_rx_counts(num_chunks * comm_size, stream);
+  {
+    std::vector<size_t> counts(comm_size, num_chunks);
+    std::vector<size_t> offsets(comm_size);
+    for (int i = 0; i < comm_size; ++i) { offsets[i] = num_chunks * i; }
+    std::vector<int> ranks(comm_size);
+    std::iota(ranks.begin(), ranks.end(), int{0});
+    device_multicast_sendrecv(comm,
+                              d_chunk_tx_counts.data(),
+                              counts,
+                              offsets,
+                              ranks,
+                              d_src_major_chunk_rx_counts.data(),
+                              counts,
+                              offsets,
+                              ranks,
+                              stream);
+  }
+  std::vector<size_t> h_src_major_chunk_rx_counts(d_src_major_chunk_rx_counts.size());
+  raft::update_host(h_src_major_chunk_rx_counts.data(),
+                    d_src_major_chunk_rx_counts.data(),
+                    d_src_major_chunk_rx_counts.size(),
+                    stream);
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  // 3. compute the receive offsets (values from the same GPU are stored contiguously) and allocate
+  // the receive buffer
+
+  std::vector<size_t> rx_counts(comm_size, size_t{0});
+  std::vector<size_t> h_src_major_chunk_rx_offsets(h_src_major_chunk_rx_counts.size());
+  if (h_src_major_chunk_rx_offsets.size() > 0) {
+    h_src_major_chunk_rx_offsets[0] = size_t{0};
+    std::partial_sum(h_src_major_chunk_rx_counts.begin(),
+                     h_src_major_chunk_rx_counts.end() - 1,
+                     h_src_major_chunk_rx_offsets.begin() + 1);
+  }
+  for (int i = 0; i < comm_size; ++i) {
+    rx_counts[i] = std::accumulate(h_src_major_chunk_rx_counts.begin() + num_chunks * i,
+                                   h_src_major_chunk_rx_counts.begin() + num_chunks * (i + 1),
+                                   size_t{0});
+  }
+
+  auto rx_value_buffer =
+    allocate_dataframe_buffer<typename std::iterator_traits<ValueIterator>::value_type>(
+      std::accumulate(rx_counts.begin(), rx_counts.end(), size_t{0}), stream);
+
+  // 4. group-by chunk i + 1 (on stream) while transferring chunk i (on comm_stream)
+
+  cudaStream_t comm_stream{};
+  cudaEvent_t event{};
+  CUDA_TRY(cudaStreamCreateWithFlags(&comm_stream, cudaStreamNonBlocking));
+  CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+
+  auto groupby_chunk = [tx_value_first,
+                        value_to_gpu_id_op,
+                        num_values,
+                        num_local_chunks,
+                        max_chunk_size,
+                        stream,
+                        event](size_t i) {
+    if (i < num_local_chunks) {
+      auto chunk_first = tx_value_first + i * max_chunk_size;
+      detail::sort_by_group_id(
+        chunk_first,
+        chunk_first + std::min(max_chunk_size, num_values - i * max_chunk_size),
+        value_to_gpu_id_op,
+        stream);
+    }
+    CUDA_TRY(cudaEventRecord(event, stream));
+  };
+
+  groupby_chunk(0);
+  for (size_t i = 0; i < num_chunks; ++i) {
+    CUDA_TRY(cudaStreamWaitEvent(comm_stream, event, 0));
+
+    std::vector<size_t> tx_counts{};
+    std::vector<size_t> tx_offsets{};
+    std::vector<int> tx_dst_ranks{};
+    std::vector<size_t> chunk_rx_counts{};
+    std::vector<size_t> chunk_rx_offsets{};
+    std::vector<int> rx_src_ranks{};
+    size_t tx_offset{0};
+    for (int j = 0; j < comm_size; ++j) {
+      auto tx_count = h_chunk_tx_counts[i * comm_size + j];
+      if (tx_count > 0) {
+        tx_counts.push_back(tx_count);
+        tx_offsets.push_back(tx_offset);
+        tx_dst_ranks.push_back(j);
+      }
+      tx_offset += tx_count;
+      auto rx_count = h_src_major_chunk_rx_counts[j * num_chunks + i];
+      if (rx_count > 0) {
+        chunk_rx_counts.push_back(rx_count);
+        chunk_rx_offsets.push_back(h_src_major_chunk_rx_offsets[j * num_chunks + i]);
+        rx_src_ranks.push_back(j);
+      }
+    }
+
+    // FIXME: this needs to be replaced with AlltoAll once NCCL 2.8 is released
+    // (if num_tx_dst_ranks == num_rx_src_ranks == comm_size).
+    device_multicast_sendrecv(
+      comm,
+      tx_value_first + std::min(i * max_chunk_size, num_values),
+      tx_counts,
+      tx_offsets,
+      tx_dst_ranks,
+      get_dataframe_buffer_begin<typename std::iterator_traits<ValueIterator>::value_type>(
+        rx_value_buffer),
+      chunk_rx_counts,
+      chunk_rx_offsets,
+      rx_src_ranks,
+      comm_stream);
+
+    if (i + 1 < num_chunks) { groupby_chunk(i + 1); }
+  }
+
+  CUDA_TRY(cudaEventRecord(event, comm_stream));
+  CUDA_TRY(cudaStreamWaitEvent(stream, event, 0));
+  CUDA_TRY(cudaEventDestroy(event));
+  CUDA_TRY(cudaStreamDestroy(comm_stream));
+
+  return std::make_tuple(std::move(rx_value_buffer), rx_counts);
+}
+
 template <typename VertexIterator, typename ValueIterator, typename KeyToGPUIdOp>
 auto groupby_gpuid_and_shuffle_kv_pairs(raft::comms::comms_t const &comm,
                                         VertexIterator tx_key_first /* [INOUT */,
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <raft/handle.hpp>
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+
+// Workspace for algorithm temporaries. The algorithms and the patterns allocate many short-lived
+// buffers per iteration; if a workspace_arena_t is bound to the handle (with workspace_scope_t),
+// these buffers are bump allocated from the arena and released as a whole at the end of the
+// iteration (or the call) instead of going through the device memory resource one by one. Without
+// a bound arena, the temporaries are allocated from the current device memory resource as before.
+
+/**
+ * @brief Bump allocating device memory resource.
+ *
+ * Memory is obtained from the upstream resource in chunks (retained until release() or
+ * destruction) and handed out by bumping a pointer. Deallocation only reclaims the most recent
+ * allocation; everything else is reclaimed when the enclosing workspace scope ends. The arena is
+ * meant for temporaries used on the stream of the handle it is bound to; temporaries used on other
+ * streams should be synchronized before their scope ends.
+ */
+class workspace_arena_t : public rmm::mr::device_memory_resource {
+ public:
+  static size_t constexpr default_chunk_size = size_t{64} << 20;
+  static size_t constexpr alignment          = 256;
+
+  // position of the bump pointer
+  struct mark_t {
+    size_t chunk_idx{0};
+    size_t offset{0};
+  };
+
+  explicit workspace_arena_t(
+    size_t chunk_size                        = default_chunk_size,
+    rmm::mr::device_memory_resource* upstream = rmm::mr::get_current_device_resource());
+  ~workspace_arena_t() override;
+
+  workspace_arena_t(workspace_arena_t const&) = delete;
+  workspace_arena_t& operator=(workspace_arena_t const&) = delete;
+
+  // bytes up to the bump pointer (including alignment padding and the unused chunk tails)
+  size_t get_used_bytes() const;
+  // maximum of get_used_bytes() since construction or the last reset_peak_bytes() call
+  size_t get_peak_bytes() const;
+  // bytes held from the upstream resource
+  size_t get_capacity_bytes() const;
+  void reset_peak_bytes();
+
+  mark_t get_mark() const;
+  // reclaim every allocation made after the mark (those allocations should not be used anymore)
+  void rewind(mark_t mark);
+
+  // return the chunks to the upstream resource (nothing should be allocated from the arena)
+  void release();
+
+  bool supports_streams() const noexcept override { return false; }
+  bool supports_get_mem_info() const noexcept override { return false; }
+
+ private:
+  struct chunk_t {
+    void* ptr{nullptr};
+    size_t size{0};
+    rmm::cuda_stream_view stream{};
+  };
+
+  void* do_allocate(size_t bytes, rmm::cuda_stream_view stream) override;
+  void do_deallocate(void* p, size_t bytes, rmm::cuda_stream_view stream) override;
+  std::pair<size_t, size_t> do_get_mem_info(rmm::cuda_stream_view stream) const override
+  {
+    return std::make_pair(size_t{0}, size_t{0});
+  }
+
+  // should be called with mutex_ locked
+  size_t used_bytes() const;
+
+  size_t chunk_size_{0};
+  rmm::mr::device_memory_resource* upstream_{nullptr};
+
+  mutable std::mutex mutex_{};
+  std::vector<chunk_t> chunks_{};
+  size_t chunk_idx_{0};
+  size_t offset_{0};
+  size_t peak_bytes_{0};
+};
+
+/**
+ * @brief Bind a workspace arena to a handle for the lifetime of this object.
+ *
+ * Algorithms called with @p handle inside the scope draw their temporaries from @p arena. Scopes
+ * nest (the innermost binding of a handle is used), and every allocation made from @p arena inside
+ * the scope is reclaimed when the scope ends. The peak workspace size is recorded as the
+ * "workspace_peak_bytes" profile counter if profiling is enabled.
+ */
+class workspace_scope_t {
+ public:
+  workspace_scope_t(raft::handle_t const& handle, workspace_arena_t& arena);
+  ~workspace_scope_t();
+
+  workspace_scope_t(workspace_scope_t const&) = delete;
+  workspace_scope_t& operator=(workspace_scope_t const&) = delete;
+
+ private:
+  raft::handle_t const* handle_ptr_{nullptr};
+  workspace_arena_t* arena_ptr_{nullptr};
+  workspace_arena_t::mark_t mark_{};
+};
+
+namespace detail {
+
+// the innermost workspace arena bound to the handle, or the current device memory resource if no
+// arena is bound
+rmm::mr::device_memory_resource* get_workspace_resource(raft::handle_t const& handle);
+
+// RAII workspace phase, the temporaries allocated from get_workspace_resource(handle) after the
+// construction of this object are reclaimed at its destruction (so they should be destroyed first),
+// a no-op if no arena is bound to the handle
+class workspace_phase_t {
+ public:
+  explicit workspace_phase_t(raft::handle_t const& handle);
+  ~workspace_phase_t();
+
+  workspace_phase_t(workspace_phase_t const&) = delete;
+  workspace_phase_t& operator=(workspace_phase_t const&) = delete;
+
+ private:
+  workspace_arena_t* arena_ptr_{nullptr};
+  workspace_arena_t::mark_t mark_{};
+};
+
+}  // namespace detail
+
+}  // namespace experimental
+}  // namespace cugraph
@@ -17,11 +17,23 @@
 #include <algorithms.hpp>
 #include <community/louvain.cuh>
 #include <converters/permute_graph.cuh>
+#include <experimental/graph_view.hpp>
+#include <experimental/louvain.cuh>
+#include <matrix_partition_device.cuh>
+#include <patterns/copy_to_adj_matrix_row_col.cuh>
 #include <utilities/error.hpp>
 #include <utilities/graph_utils.cuh>
 
+#include <rmm/device_uvector.hpp>
 #include <rmm/thrust_rmm_allocator.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/random.h>
+#include <thrust/scatter.h>
+
+#include <algorithm>
+#include <vector>
 
 #include <ctime>
 
@@ -127,6 +139,105 @@ class EcgLouvain : public cugraph::Louvain<graph_type> {
   vertex_t seed_;
 };
 
+template <typename graph_view_type>
+class EcgExperimentalLouvain : public cugraph::experimental::Louvain<graph_view_type> {
+ public:
+  using graph_view_t = graph_view_type;
+  using vertex_t     = typename graph_view_type::vertex_type;
+  using edge_t       = typename graph_view_type::edge_type;
+  using weight_t     = typename graph_view_type::weight_type;
+
+  EcgExperimentalLouvain(raft::handle_t const &handle,
+                         graph_view_t const &graph_view,
+                         vertex_t seed)
+    : cugraph::experimental::Louvain<graph_view_t>(handle, graph_view), seed_(seed)
+  {
+  }
+
+  void initialize_dendrogram_level(vertex_t num_vertices) override
+  {
+    auto local_vertex_first = this->current_graph_view_.get_local_vertex_first();
+
+    this->dendrogram_->add_level(local_vertex_first, num_vertices, this->handle_.get_stream());
+
+    get_permutation_vector(num_vertices,
+                           static_cast<vertex_t>(seed_ + local_vertex_first),
+                           this->dendrogram_->current_level_begin(),
+                           this->handle_.get_stream());
+    thrust::transform(rmm::exec_policy(this->handle_.get_stream())->on(this->handle_.get_stream()),
+                      this->dendrogram_->current_level_begin(),
+                      this->dendrogram_->current_level_end(),
+                      this->dendrogram_->current_level_begin(),
+                      [local_vertex_first] __device__(auto v) { return local_vertex_first + v; });
+  }
+
+ private:
+  vertex_t seed_;
+};
+
+// (vertex, ensemble member) -> offset in a vertex-major (vertex x ensemble size) array
+template <typename vertex_t>
+struct ensemble_offset_t {
+  size_t ensemble_size{0};
+  size_t member{0};
+
+  __device__ size_t operator()(vertex_t v) const
+  {
+    return static_cast<size_t>(v) * ensemble_size + member;
+  }
+};
+
+// expands the compressed sparse offsets to the major offset of every edge
+template <typename GraphViewType>
+struct expand_major_offsets_t {
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  cugraph::experimental::matrix_partition_device_t<GraphViewType> matrix_partition;
+  vertex_t dense_size{0};  // number of majors in [major_first, major_hypersparse_first)
+  vertex_t *major_offsets{nullptr};
+
+  __device__ void operator()(vertex_t idx) const
+  {
+    auto offsets      = matrix_partition.get_offsets();
+    auto major_offset = idx < dense_size
+                          ? idx
+                          : matrix_partition.get_major_offset_from_major_nocheck(
+                              *(matrix_partition.get_dcs_nzd_vertices() + (idx - dense_size)));
+    thrust::fill(
+      thrust::seq, major_offsets + offsets[idx], major_offsets + offsets[idx + 1], major_offset);
+  }
+};
+
+// computes the ECG weight of an edge from the co-membership count over the entire ensemble; the
+// count starts from the input edge weight (same as the legacy ecg implementation)
+template <typename GraphViewType>
+struct ecg_weight_t {
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  cugraph::experimental::matrix_partition_device_t<GraphViewType> matrix_partition;
+  vertex_t const *major_offsets{nullptr};
+  vertex_t const *adj_matrix_row_clusters{nullptr};  // (row x ensemble size), vertex-major
+  vertex_t const *adj_matrix_col_clusters{nullptr};  // (col x ensemble size), vertex-major
+  size_t ensemble_size{0};
+  weight_t min_weight{0.0};
+
+  __device__ weight_t operator()(edge_t e) const
+  {
+    auto row_offset = matrix_partition.get_major_value_start_offset() + major_offsets[e];
+    auto col_offset =
+      matrix_partition.get_minor_offset_from_minor_nocheck(matrix_partition.get_minor_nocheck(e));
+    auto row_clusters = adj_matrix_row_clusters + static_cast<size_t>(row_offset) * ensemble_size;
+    auto col_clusters = adj_matrix_col_clusters + static_cast<size_t>(col_offset) * ensemble_size;
+    weight_t sum      = *(matrix_partition.get_weights() + e);
+    for (size_t i = 0; i < ensemble_size; ++i) {
+      if (row_clusters[i] == col_clusters[i]) { sum += weight_t{1.0}; }
+    }
+    return min_weight + (weight_t{1.0} - min_weight) * (sum / static_cast<weight_t>(ensemble_size));
+  }
+};
+
 }  // anonymous namespace
 
 namespace cugraph {
@@ -200,6 +311,149 @@ void ecg(raft::handle_t const &handle,
   cugraph::louvain(handle, louvain_graph, clustering, size_t{100});
 }
 
+template <typename graph_view_t>
+void ecg(raft::handle_t const &handle,
+         graph_view_t const &graph_view,
+         typename graph_view_t::weight_type min_weight,
+         typename graph_view_t::vertex_type ensemble_size,
+         typename graph_view_t::vertex_type *clustering)
+{
+  using vertex_t = typename graph_view_t::vertex_type;
+  using edge_t   = typename graph_view_t::edge_type;
+  using weight_t = typename graph_view_t::weight_type;
+
+  static_assert(!graph_view_t::is_adj_matrix_transposed,
+                "Invalid input argument: graph_view_t::is_adj_matrix_transposed should be false.");
+
+  CUGRAPH_EXPECTS(graph_view.is_weighted(), "Invalid input argument: ecg expects a weighted graph");
+  CUGRAPH_EXPECTS(ensemble_size > 0,
+                  "Invalid input argument: ensemble_size should be a positive integer.");
+  CUGRAPH_EXPECTS(clustering != nullptr,
+                  "Invalid input argument: clustering is NULL, should be a device pointer to "
+                  "memory for storing the result");
+
+  // "FIXME": remove this check
+  //
+  // Disable ecg(experimental::graph_view_t,...)
+  // versions for GPU architectures < 700
+  // (cuco/static_map.cuh depends on features not supported on or before Pascal)
+  //
+  cudaDeviceProp device_prop;
+  CUDA_CHECK(cudaGetDeviceProperties(&device_prop, 0));
+
+  if (device_prop.major < 7) {
+    CUGRAPH_FAIL("ECG not supported on Pascal and older architectures");
+  }
+
+  auto stream = handle.get_stream();
+
+  // 1. run level 1 Louvain for every member of the ensemble, the clusterings are stored
+  // vertex-major (a vertex's clusters in all the ensemble members are consecutive in memory) to
+  // count co-memberships for the entire ensemble in a single pass over the edges
+
+  // FIXME: the ensemble members are independent, but the experimental Louvain runs on the handle's
+  // stream (and the communicator in multi-GPU), so the members are currently run one after another
+
+  rmm::device_uvector<vertex_t> ensemble_clusters_v(
+    static_cast<size_t>(graph_view.get_number_of_local_vertices()) * ensemble_size, stream);
+
+  // FIXME:  This seed should be a parameter
+  vertex_t seed{1};
+
+  for (vertex_t i = 0; i < ensemble_size; ++i) {
+    EcgExperimentalLouvain<graph_view_t> runner(handle, graph_view, seed);
+    seed += graph_view.get_number_of_vertices();
+
+    runner(size_t{1}, weight_t{1});
+
+    auto level_first = runner.get_dendrogram().get_level_ptr_nocheck(0);
+    thrust::scatter(
+      rmm::exec_policy(stream)->on(stream),
+      level_first,
+      level_first + graph_view.get_number_of_local_vertices(),
+      thrust::make_transform_iterator(
+        thrust::make_counting_iterator(vertex_t{0}),
+        ensemble_offset_t<vertex_t>{static_cast<size_t>(ensemble_size), static_cast<size_t>(i)}),
+      ensemble_clusters_v.begin());
+  }
+
+  vertex_t const *adj_matrix_row_clusters = ensemble_clusters_v.data();
+  vertex_t const *adj_matrix_col_clusters = ensemble_clusters_v.data();
+  rmm::device_uvector<vertex_t> adj_matrix_row_clusters_v(0, stream);
+  rmm::device_uvector<vertex_t> adj_matrix_col_clusters_v(0, stream);
+  if (graph_view_t::is_multi_gpu) {
+    adj_matrix_row_clusters_v.resize(
+      static_cast<size_t>(graph_view.get_number_of_local_adj_matrix_partition_rows()) *
+        ensemble_size,
+      stream);
+    adj_matrix_col_clusters_v.resize(
+      static_cast<size_t>(graph_view.get_number_of_local_adj_matrix_partition_cols()) *
+        ensemble_size,
+      stream);
+    experimental::copy_to_adj_matrix_row(handle,
+                                         graph_view,
+                                         static_cast<size_t>(ensemble_size),
+                                         ensemble_clusters_v.begin(),
+                                         adj_matrix_row_clusters_v.begin());
+    experimental::copy_to_adj_matrix_col(handle,
+                                         graph_view,
+                                         static_cast<size_t>(ensemble_size),
+                                         ensemble_clusters_v.begin(),
+                                         adj_matrix_col_clusters_v.begin());
+    ensemble_clusters_v.resize(0, stream);
+    ensemble_clusters_v.shrink_to_fit(stream);
+    adj_matrix_row_clusters = adj_matrix_row_clusters_v.data();
+    adj_matrix_col_clusters = adj_matrix_col_clusters_v.data();
+  }
+
+  // 2. compute the ECG weights (edge-parallel, the major offset of every edge is computed once
+  // instead of searching the offsets array for every edge)
+
+  std::vector<rmm::device_uvector<weight_t>> ecg_weights{};
+  std::vector<weight_t const *> ecg_weight_ptrs{};
+  ecg_weights.reserve(graph_view.get_number_of_local_adj_matrix_partitions());
+  ecg_weight_ptrs.reserve(graph_view.get_number_of_local_adj_matrix_partitions());
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    experimental::matrix_partition_device_t<graph_view_t> matrix_partition(graph_view, i);
+
+    auto number_of_edges = graph_view.get_number_of_local_adj_matrix_partition_edges(i);
+    auto dense_size      = std::min(matrix_partition.get_major_hypersparse_first_offset(),
+                                   matrix_partition.get_major_size());
+
+    rmm::device_uvector<vertex_t> major_offsets_v(number_of_edges, stream);
+    thrust::for_each(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator(vertex_t{0}),
+      thrust::make_counting_iterator(dense_size + matrix_partition.get_dcs_nzd_vertex_count()),
+      expand_major_offsets_t<graph_view_t>{matrix_partition, dense_size, major_offsets_v.data()});
+
+    ecg_weights.emplace_back(number_of_edges, stream);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator(edge_t{0}),
+                      thrust::make_counting_iterator(number_of_edges),
+                      ecg_weights.back().begin(),
+                      ecg_weight_t<graph_view_t>{matrix_partition,
+                                                 major_offsets_v.data(),
+                                                 adj_matrix_row_clusters,
+                                                 adj_matrix_col_clusters,
+                                                 static_cast<size_t>(ensemble_size),
+                                                 min_weight});
+    ecg_weight_ptrs.push_back(ecg_weights.back().data());
+  }
+
+  adj_matrix_row_clusters_v.resize(0, stream);
+  adj_matrix_row_clusters_v.shrink_to_fit(stream);
+  adj_matrix_col_clusters_v.resize(0, stream);
+  adj_matrix_col_clusters_v.shrink_to_fit(stream);
+  ensemble_clusters_v.resize(0, stream);
+  ensemble_clusters_v.shrink_to_fit(stream);
+
+  // 3. run Louvain on the input graph with the ECG weights (pass max_level = 100 for a "full run")
+
+  cugraph::louvain(
+    handle, graph_view.with_weights(ecg_weight_ptrs), clustering, size_t{100}, weight_t{1});
+}
+
 // Explicit template instantiations.
 template void ecg<int32_t, int32_t, float>(raft::handle_t const &,
                                            GraphCSRView<int32_t, int32_t, float> const &graph,
@@ -211,4 +465,66 @@ template void ecg<int32_t, int32_t, double>(raft::handle_t const &,
                                             double min_weight,
                                             int32_t ensemble_size,
                                             int32_t *clustering);
+
+template void ecg(raft::handle_t const &,
+                  experimental::graph_view_t<int32_t, int32_t, float, false, false> const &,
+                  float,
+                  int32_t,
+                  int32_t *);
+template void ecg(raft::handle_t const &,
+                  experimental::graph_view_t<int32_t, int32_t, double, false, false> const &,
+                  double,
+                  int32_t,
+                  int32_t *);
+template void ecg(raft::handle_t const &,
+                  experimental::graph_view_t<int32_t, int64_t, float, false, false> const &,
+                  float,
+                  int32_t,
+                  int32_t *);
+template void ecg(raft::handle_t const &,
+                  experimental::graph_view_t<int32_t, int64_t, double, false, false> const &,
+                  double,
+                  int32_t,
+                  int32_t *);
+template void ecg(raft::handle_t const &,
+                  experimental::graph_view_t<int64_t, int64_t, float, false, false> const &,
+                  float,
+                  int64_t,
+                  int64_t *);
+template void ecg(raft::handle_t const &,
+                  experimental::graph_view_t<int64_t, int64_t, double, false, false> const &,
+                  double,
+                  int64_t,
+                  int64_t *);
+template void ecg(raft::handle_t const &,
+                  experimental::graph_view_t<int32_t, int32_t, float, false, true> const &,
+                  float,
+                  int32_t,
+                  int32_t *);
+template void ecg(raft::handle_t const &,
+                  experimental::graph_view_t<int32_t, int32_t, double, false, true> const &,
+                  double,
+                  int32_t,
+                  int32_t *);
+template void ecg(raft::handle_t const &,
+                  experimental::graph_view_t<int32_t, int64_t, float, false, true> const &,
+                  float,
+                  int32_t,
+                  int32_t *);
+template void ecg(raft::handle_t const &,
+                  experimental::graph_view_t<int32_t, int64_t, double, false, true> const &,
+                  double,
+                  int32_t,
+                  int32_t *);
+template void ecg(raft::handle_t const &,
+                  experimental::graph_view_t<int64_t, int64_t, float, false, true> const &,
+                  float,
+                  int64_t,
+                  int64_t *);
+template void ecg(raft::handle_t const &,
+                  experimental::graph_view_t<int64_t, int64_t, double, false, true> const &,
+                  double,
+                  int64_t,
+                  int64_t *);
+
 }  // namespace cugraph
@@ -51,7 +51,8 @@ all edges between them. Naive algorithm
 an edge between y and z in original graph, add edge (y, z) to our new graph.
 
 Rather than doing custom one/two hops features, we propose a generic k-hops solution leveraging BFS
-cutoff and subgraph extraction
+cutoff and subgraph extraction. BFS runs from all the sources at once (multi_source_bfs), so each
+edge is expanded once per hop for every source.
 */
 
 template <typename vertex_t, typename edge_t, typename weight_t>
@@ -66,106 +67,18 @@ extract(
   vertex_t n_subgraphs,
   vertex_t radius)
 {
-  auto v                = csr_view.get_number_of_vertices();
-  auto e                = csr_view.get_number_of_edges();
-  auto user_stream_view = handle.get_stream_view();
-  rmm::device_vector<size_t> neighbors_offsets(n_subgraphs + 1);
-  rmm::device_vector<vertex_t> neighbors;
-
-  std::vector<vertex_t> h_source_vertex(n_subgraphs);
-  std::vector<size_t> h_neighbors_offsets(n_subgraphs + 1);
-
-  raft::update_host(&h_source_vertex[0], source_vertex, n_subgraphs, user_stream_view.value());
-
-  // Streams will allocate concurrently later
-  std::vector<rmm::device_uvector<vertex_t>> reached{};
-  reached.reserve(n_subgraphs);
-  for (vertex_t i = 0; i < n_subgraphs; i++) {
-    // Allocations and operations are attached to the worker stream
-    rmm::device_uvector<vertex_t> local_reach(v, handle.get_internal_stream_view(i));
-    reached.push_back(std::move(local_reach));
-  }
-
-  // h_source_vertex[i] is used by other streams in the for loop
-  user_stream_view.synchronize();
 #ifdef TIMING
   HighResTimer hr_timer;
   hr_timer.start("ego_neighbors");
 #endif
 
-  for (vertex_t i = 0; i < n_subgraphs; i++) {
-    // get light handle from worker pool
-    raft::handle_t light_handle(handle, i);
-    auto worker_stream_view = light_handle.get_stream_view();
-
-    // BFS with cutoff
-    // consider adding a device API to BFS (ie. accept source on the device)
-    rmm::device_uvector<vertex_t> predecessors(v, worker_stream_view);  // not used
-    bool direction_optimizing = false;
-    thrust::fill(rmm::exec_policy(worker_stream_view),
-                 reached[i].begin(),
-                 reached[i].end(),
-                 std::numeric_limits<vertex_t>::max());
-    thrust::fill(
-      rmm::exec_policy(worker_stream_view), reached[i].begin(), reached[i].begin() + 100, 1.0);
-
-    cugraph::experimental::bfs<vertex_t, edge_t, weight_t, false>(light_handle,
-                                                                  csr_view,
-                                                                  reached[i].data(),
-                                                                  predecessors.data(),
-                                                                  h_source_vertex[i],
-                                                                  direction_optimizing,
-                                                                  radius);
-
-    // identify reached vertex ids from distance array
-    thrust::transform(rmm::exec_policy(worker_stream_view),
-                      thrust::make_counting_iterator(vertex_t{0}),
-                      thrust::make_counting_iterator(v),
-                      reached[i].begin(),
-                      reached[i].begin(),
-                      [sentinel = std::numeric_limits<vertex_t>::max()] __device__(
-                        auto id, auto val) { return val < sentinel ? id : sentinel; });
-
-    // removes unreached data
-    auto reached_end = thrust::remove(rmm::exec_policy(worker_stream_view),
-                                      reached[i].begin(),
-                                      reached[i].end(),
-                                      std::numeric_limits<vertex_t>::max());
-    // release temp storage
-    reached[i].resize(thrust::distance(reached[i].begin(), reached_end), worker_stream_view);
-    reached[i].shrink_to_fit(worker_stream_view);
-  }
-
-  // wait on every one to identify their neighboors before proceeding to concatenation
-  handle.wait_on_internal_streams();
-
-  // Construct neighboors offsets (just a scan on neighborhod vector sizes)
-  h_neighbors_offsets[0] = 0;
-  for (vertex_t i = 0; i < n_subgraphs; i++) {
-    h_neighbors_offsets[i + 1] = h_neighbors_offsets[i] + reached[i].size();
-  }
-  raft::update_device(neighbors_offsets.data().get(),
-                      &h_neighbors_offsets[0],
-                      n_subgraphs + 1,
-                      user_stream_view.value());
-  neighbors.resize(h_neighbors_offsets[n_subgraphs]);
-  user_stream_view.synchronize();
-
-  // Construct the neighboors list concurrently
-  for (vertex_t i = 0; i < n_subgraphs; i++) {
-    auto worker_stream_view = handle.get_internal_stream_view(i);
-    thrust::copy(rmm::exec_policy(worker_stream_view),
-                 reached[i].begin(),
-                 reached[i].end(),
-                 neighbors.begin() + h_neighbors_offsets[i]);
-
-    // reached info is not needed anymore
-    reached[i].resize(0, worker_stream_view);
-    reached[i].shrink_to_fit(worker_stream_view);
-  }
-
-  // wait on every one before proceeding to grouped extraction
-  handle.wait_on_internal_streams();
+  // BFS with cutoff from all the sources at once, reached vertices are grouped by source and sorted
+  // in ascending order (as required by extract_induced_subgraphs)
+  rmm::device_uvector<size_t> neighbors_offsets(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> neighbors(0, handle.get_stream());
+  std::tie(neighbors_offsets, neighbors, std::ignore) =
+    cugraph::experimental::multi_source_bfs<vertex_t, edge_t, weight_t, false>(
+      handle, csr_view, source_vertex, static_cast<size_t>(n_subgraphs), radius);
 
 #ifdef TIMING
   hr_timer.stop();
@@ -174,7 +87,7 @@ extract(
 
   // extract
   return cugraph::experimental::extract_induced_subgraphs(
-    handle, csr_view, neighbors_offsets.data().get(), neighbors.data().get(), n_subgraphs);
+    handle, csr_view, neighbors_offsets.data(), neighbors.data(), n_subgraphs);
 }
 }  // namespace
 namespace cugraph {
@@ -202,7 +115,7 @@ extract_ego(raft::handle_t const &handle,
                   "Can't have more sources to extract from than vertices in the graph");
   CUGRAPH_EXPECTS(radius > 0, "Radius should be at least 1");
   CUGRAPH_EXPECTS(radius < graph_view.get_number_of_vertices(), "radius is too large");
-  // source_vertex range is checked in bfs.
+  // source_vertex range is checked in multi_source_bfs.
 
   return extract<vertex_t, edge_t, weight_t>(
     handle, graph_view, source_vertex, n_subgraphs, radius);
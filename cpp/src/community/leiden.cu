@@ -16,6 +16,8 @@
 
 #include <community/flatten_dendrogram.cuh>
 #include <community/leiden.cuh>
+#include <experimental/graph.hpp>
+#include <experimental/leiden.cuh>
 
 #include <rmm/device_uvector.hpp>
 
@@ -55,6 +57,56 @@ std::pair<size_t, weight_t> leiden(raft::handle_t const &handle,
   return std::make_pair(runner.get_dendrogram().num_levels(), wt);
 }
 
+template <typename graph_view_t>
+std::pair<size_t, typename graph_view_t::weight_type> leiden(
+  raft::handle_t const &handle,
+  graph_view_t const &graph_view,
+  typename graph_view_t::vertex_type *clustering,
+  size_t max_level,
+  typename graph_view_t::weight_type resolution)
+{
+  using vertex_t = typename graph_view_t::vertex_type;
+  using weight_t = typename graph_view_t::weight_type;
+
+  CUGRAPH_EXPECTS(graph_view.is_weighted(),
+                  "Invalid input argument: leiden expects a weighted graph");
+  CUGRAPH_EXPECTS(clustering != nullptr,
+                  "Invalid input argument: clustering is null, should be a device pointer to "
+                  "memory for storing the result");
+
+  // "FIXME": remove this check
+  //
+  // Disable leiden(experimental::graph_view_t,...)
+  // versions for GPU architectures < 700
+  // (cuco/static_map.cuh depends on features not supported on or before Pascal)
+  //
+  cudaDeviceProp device_prop;
+  CUDA_CHECK(cudaGetDeviceProperties(&device_prop, 0));
+
+  if (device_prop.major < 7) {
+    CUGRAPH_FAIL("Leiden not supported on Pascal and older architectures");
+  }
+
+  experimental::Leiden<graph_view_t> runner(handle, graph_view);
+  weight_t wt = runner(max_level, resolution);
+
+  rmm::device_uvector<vertex_t> vertex_ids_v(graph_view.get_number_of_local_vertices(),
+                                             handle.get_stream());
+
+  thrust::sequence(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   vertex_ids_v.begin(),
+                   vertex_ids_v.end(),
+                   graph_view.get_local_vertex_first());
+
+  partition_at_level<vertex_t, graph_view_t::is_multi_gpu>(handle,
+                                                           runner.get_dendrogram(),
+                                                           vertex_ids_v.data(),
+                                                           clustering,
+                                                           runner.get_dendrogram().num_levels());
+
+  return std::make_pair(runner.get_dendrogram().num_levels(), wt);
+}
+
 // Explicit template instantations
 template std::pair<size_t, float> leiden(
   raft::handle_t const &, GraphCSRView<int32_t, int32_t, float> const &, int32_t *, size_t, float);
@@ -65,4 +117,77 @@ template std::pair<size_t, double> leiden(raft::handle_t const &,
                                           size_t,
                                           double);
 
+template std::pair<size_t, float> leiden(
+  raft::handle_t const &,
+  experimental::graph_view_t<int32_t, int32_t, float, false, false> const &,
+  int32_t *,
+  size_t,
+  float);
+template std::pair<size_t, double> leiden(
+  raft::handle_t const &,
+  experimental::graph_view_t<int32_t, int32_t, double, false, false> const &,
+  int32_t *,
+  size_t,
+  double);
+template std::pair<size_t, float> leiden(
+  raft::handle_t const &,
+  experimental::graph_view_t<int32_t, int64_t, float, false, false> const &,
+  int32_t *,
+  size_t,
+  float);
+template std::pair<size_t, double> leiden(
+  raft::handle_t const &,
+  experimental::graph_view_t<int32_t, int64_t, double, false, false> const &,
+  int32_t *,
+  size_t,
+  double);
+template std::pair<size_t, float> leiden(
+  raft::handle_t const &,
+  experimental::graph_view_t<int64_t, int64_t, float, false, false> const &,
+  int64_t *,
+  size_t,
+  float);
+template std::pair<size_t, double> leiden(
+  raft::handle_t const &,
+  experimental::graph_view_t<int64_t, int64_t, double, false, false> const &,
+  int64_t *,
+  size_t,
+  double);
+template std::pair<size_t, float> leiden(
+  raft::handle_t const &,
+  experimental::graph_view_t<int32_t, int32_t, float, false, true> const &,
+  int32_t *,
+  size_t,
+  float);
+template std::pair<size_t, double> leiden(
+  raft::handle_t const &,
+  experimental::graph_view_t<int32_t, int32_t, double, false, true> const &,
+  int32_t *,
+  size_t,
+  double);
+template std::pair<size_t, float> leiden(
+  raft::handle_t const &,
+  experimental::graph_view_t<int32_t, int64_t, float, false, true> const &,
+  int32_t *,
+  size_t,
+  float);
+template std::pair<size_t, double> leiden(
+  raft::handle_t const &,
+  experimental::graph_view_t<int32_t, int64_t, double, false, true> const &,
+  int32_t *,
+  size_t,
+  double);
+template std::pair<size_t, float> leiden(
+  raft::handle_t const &,
+  experimental::graph_view_t<int64_t, int64_t, float, false, true> const &,
+  int64_t *,
+  size_t,
+  float);
+template std::pair<size_t, double> leiden(
+  raft::handle_t const &,
+  experimental::graph_view_t<int64_t, int64_t, double, false, true> const &,
+  int64_t *,
+  size_t,
+  double);
+
 }  // namespace cugraph
@@ -30,10 +30,13 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
   raft::handle_t const &handle,
   GraphCSRView<vertex_t, edge_t, weight_t> const &graph_view,
   size_t max_level,
-  weight_t resolution)
+  weight_t resolution,
+  bool use_vertex_coloring)
 {
   CUGRAPH_EXPECTS(graph_view.edge_data != nullptr,
                   "Invalid input argument: louvain expects a weighted graph");
+  CUGRAPH_EXPECTS(!use_vertex_coloring,
+                  "Invalid input argument: vertex coloring is not supported for GraphCSRView.");
 
   Louvain<GraphCSRView<vertex_t, edge_t, weight_t>> runner(handle, graph_view);
   weight_t wt = runner(max_level, resolution);
@@ -46,7 +49,8 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
   raft::handle_t const &handle,
   experimental::graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
   size_t max_level,
-  weight_t resolution)
+  weight_t resolution,
+  bool use_vertex_coloring)
 {
   // "FIXME": remove this check and the guards below
   //
@@ -61,7 +65,7 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
     CUGRAPH_FAIL("Louvain not supported on Pascal and older architectures");
   } else {
     experimental::Louvain<experimental::graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>>
-      runner(handle, graph_view);
+      runner(handle, graph_view, use_vertex_coloring);
 
     weight_t wt = runner(max_level, resolution);
 
@@ -69,6 +73,51 @@ std::pair<std::unique_ptr<Dendrogram<vertex_t>>, weight_t> louvain(
   }
 }
 
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::pair<size_t, weight_t> memory_bounded_louvain(
+  raft::handle_t const &handle,
+  GraphCSRView<vertex_t, edge_t, weight_t> const &graph_view,
+  vertex_t *clustering,
+  size_t max_level,
+  weight_t resolution,
+  bool use_vertex_coloring)
+{
+  CUGRAPH_FAIL("Invalid input argument: memory bounded mode is not supported for GraphCSRView.");
+  return std::make_pair(size_t{0}, weight_t{0});
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::pair<size_t, weight_t> memory_bounded_louvain(
+  raft::handle_t const &handle,
+  experimental::graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t *clustering,
+  size_t max_level,
+  weight_t resolution,
+  bool use_vertex_coloring)
+{
+  // "FIXME": see louvain() above
+  cudaDeviceProp device_prop;
+  CUDA_CHECK(cudaGetDeviceProperties(&device_prop, 0));
+
+  if (device_prop.major < 7) {
+    CUGRAPH_FAIL("Louvain not supported on Pascal and older architectures");
+  } else {
+    experimental::Louvain<experimental::graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>>
+      runner(handle, graph_view, use_vertex_coloring, true);
+
+    weight_t wt = runner(max_level, resolution);
+
+    // the only dendrogram level is the final clustering (in the input graph's vertex ID space)
+    auto const &dendrogram = runner.get_dendrogram();
+    raft::copy(clustering,
+               dendrogram.get_level_ptr_nocheck(0),
+               dendrogram.get_level_size_nocheck(0),
+               handle.get_stream());
+
+    return std::make_pair(runner.get_num_levels(), wt);
+  }
+}
+
 template <typename vertex_t, typename edge_t, typename weight_t>
 void flatten_dendrogram(raft::handle_t const &handle,
                         GraphCSRView<vertex_t, edge_t, weight_t> const &graph_view,
@@ -113,9 +162,10 @@ std::pair<std::unique_ptr<Dendrogram<typename graph_view_t::vertex_type>>,
 louvain(raft::handle_t const &handle,
         graph_view_t const &graph_view,
         size_t max_level,
-        typename graph_view_t::weight_type resolution)
+        typename graph_view_t::weight_type resolution,
+        bool use_vertex_coloring)
 {
-  return detail::louvain(handle, graph_view, max_level, resolution);
+  return detail::louvain(handle, graph_view, max_level, resolution, use_vertex_coloring);
 }
 
 template <typename graph_view_t>
@@ -133,17 +183,25 @@ std::pair<size_t, typename graph_view_t::weight_type> louvain(
   graph_view_t const &graph_view,
   typename graph_view_t::vertex_type *clustering,
   size_t max_level,
-  typename graph_view_t::weight_type resolution)
+  typename graph_view_t::weight_type resolution,
+  bool use_vertex_coloring,
+  bool memory_bounded)
 {
   using vertex_t = typename graph_view_t::vertex_type;
   using weight_t = typename graph_view_t::weight_type;
 
   CUGRAPH_EXPECTS(clustering != nullptr, "Invalid input argument: clustering is null");
 
+  if (memory_bounded) {
+    return detail::memory_bounded_louvain(
+      handle, graph_view, clustering, max_level, resolution, use_vertex_coloring);
+  }
+
   std::unique_ptr<Dendrogram<vertex_t>> dendrogram;
   weight_t modularity;
 
-  std::tie(dendrogram, modularity) = louvain(handle, graph_view, max_level, resolution);
+  std::tie(dendrogram, modularity) =
+    louvain(handle, graph_view, max_level, resolution, use_vertex_coloring);
 
   flatten_dendrogram(handle, graph_view, *dendrogram, clustering);
 
@@ -155,106 +213,137 @@ template std::pair<std::unique_ptr<Dendrogram<int32_t>>, float> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int32_t, int32_t, float, false, false> const &,
   size_t,
-  float);
+  float,
+  bool);
 template std::pair<std::unique_ptr<Dendrogram<int32_t>>, float> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int32_t, int64_t, float, false, false> const &,
   size_t,
-  float);
+  float,
+  bool);
 template std::pair<std::unique_ptr<Dendrogram<int64_t>>, float> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int64_t, int64_t, float, false, false> const &,
   size_t,
-  float);
+  float,
+  bool);
 template std::pair<std::unique_ptr<Dendrogram<int32_t>>, double> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int32_t, int32_t, double, false, false> const &,
   size_t,
-  double);
+  double,
+  bool);
 template std::pair<std::unique_ptr<Dendrogram<int32_t>>, double> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int32_t, int64_t, double, false, false> const &,
   size_t,
-  double);
+  double,
+  bool);
 template std::pair<std::unique_ptr<Dendrogram<int64_t>>, double> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int64_t, int64_t, double, false, false> const &,
   size_t,
-  double);
+  double,
+  bool);
 template std::pair<std::unique_ptr<Dendrogram<int32_t>>, float> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int32_t, int32_t, float, false, true> const &,
   size_t,
-  float);
+  float,
+  bool);
 template std::pair<std::unique_ptr<Dendrogram<int32_t>>, float> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int32_t, int64_t, float, false, true> const &,
   size_t,
-  float);
+  float,
+  bool);
 template std::pair<std::unique_ptr<Dendrogram<int64_t>>, float> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int64_t, int64_t, float, false, true> const &,
   size_t,
-  float);
+  float,
+  bool);
 template std::pair<std::unique_ptr<Dendrogram<int32_t>>, double> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int32_t, int32_t, double, false, true> const &,
   size_t,
-  double);
+  double,
+  bool);
 template std::pair<std::unique_ptr<Dendrogram<int32_t>>, double> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int32_t, int64_t, double, false, true> const &,
   size_t,
-  double);
+  double,
+  bool);
 template std::pair<std::unique_ptr<Dendrogram<int64_t>>, double> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int64_t, int64_t, double, false, true> const &,
   size_t,
-  double);
-
-template std::pair<size_t, float> louvain(
-  raft::handle_t const &, GraphCSRView<int32_t, int32_t, float> const &, int32_t *, size_t, float);
+  double,
+  bool);
+
+template std::pair<size_t, float> louvain(raft::handle_t const &,
+                                          GraphCSRView<int32_t, int32_t, float> const &,
+                                          int32_t *,
+                                          size_t,
+                                          float,
+                                          bool,
+                                          bool);
 template std::pair<size_t, double> louvain(raft::handle_t const &,
                                            GraphCSRView<int32_t, int32_t, double> const &,
                                            int32_t *,
                                            size_t,
-                                           double);
+                                           double,
+                                           bool,
+                                           bool);
 template std::pair<size_t, float> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int32_t, int32_t, float, false, false> const &,
   int32_t *,
   size_t,
-  float);
+  float,
+  bool,
+  bool);
 template std::pair<size_t, double> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int32_t, int32_t, double, false, false> const &,
   int32_t *,
   size_t,
-  double);
+  double,
+  bool,
+  bool);
 template std::pair<size_t, float> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int32_t, int64_t, float, false, false> const &,
   int32_t *,
   size_t,
-  float);
+  float,
+  bool,
+  bool);
 template std::pair<size_t, double> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int32_t, int64_t, double, false, false> const &,
   int32_t *,
   size_t,
-  double);
+  double,
+  bool,
+  bool);
 template std::pair<size_t, float> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int64_t, int64_t, float, false, false> const &,
   int64_t *,
   size_t,
-  float);
+  float,
+  bool,
+  bool);
 template std::pair<size_t, double> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int64_t, int64_t, double, false, false> const &,
   int64_t *,
   size_t,
-  double);
+  double,
+  bool,
+  bool);
 
 // instantations with multi_gpu = true
 template std::pair<size_t, float> louvain(
@@ -262,38 +351,50 @@ template std::pair<size_t, float> louvain(
   experimental::graph_view_t<int32_t, int32_t, float, false, true> const &,
   int32_t *,
   size_t,
-  float);
+  float,
+  bool,
+  bool);
 template std::pair<size_t, double> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int32_t, int32_t, double, false, true> const &,
   int32_t *,
   size_t,
-  double);
+  double,
+  bool,
+  bool);
 
 template std::pair<size_t, float> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int32_t, int64_t, float, false, true> const &,
   int32_t *,
   size_t,
-  float);
+  float,
+  bool,
+  bool);
 template std::pair<size_t, double> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int32_t, int64_t, double, false, true> const &,
   int32_t *,
   size_t,
-  double);
+  double,
+  bool,
+  bool);
 template std::pair<size_t, float> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int64_t, int64_t, float, false, true> const &,
   int64_t *,
   size_t,
-  float);
+  float,
+  bool,
+  bool);
 template std::pair<size_t, double> louvain(
   raft::handle_t const &,
   experimental::graph_view_t<int64_t, int64_t, double, false, true> const &,
   int64_t *,
   size_t,
-  double);
+  double,
+  bool,
+  bool);
 
 }  // namespace cugraph
 
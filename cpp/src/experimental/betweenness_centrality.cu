@@ -0,0 +1,1681 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithms.hpp>
+#include <experimental/graph_view.hpp>
+#include <matrix_partition_device.cuh>
+#include <partition_manager.hpp>
+#include <patterns/copy_to_adj_matrix_row_col.cuh>
+#include <patterns/count_if_e.cuh>
+#include <utilities/device_comm.cuh>
+#include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+#include <vertex_partition_device.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/extrema.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+namespace detail {
+
+// FIXME: block size requires tuning
+int32_t constexpr betweenness_centrality_block_size = 128;
+
+// FIXME: this value requires tuning; every kernel assigns one warp per vertex and one lane per
+// source (so this should not exceed the warp size), and each batch requires sizeof(vertex_t) + 4 *
+// sizeof(double) bytes per vertex per source (+ sizeof(weight_t) + 2 * sizeof(uint32_t) bytes for
+// weighted betweenness centrality) in addition to the adjacency matrix row & column buffers.
+size_t constexpr betweenness_centrality_max_batch_size = 32;
+
+// (u, v) is an edge of the shortest path DAG if v is one hop farther than u
+template <typename vertex_t, typename weight_t>
+struct is_bfs_dag_edge_t {
+  __device__ bool operator()(vertex_t row_distance, vertex_t col_distance, weight_t w) const
+  {
+    return (row_distance != std::numeric_limits<vertex_t>::max()) &&
+           (col_distance == row_distance + 1);
+  }
+};
+
+// (u, v) is an edge of the shortest path DAG if the shortest path to v can go through u (exact
+// floating point comparison, as the distance of v is computed by adding the edge weight to the
+// distance of one of its predecessors)
+template <typename weight_t>
+struct is_sssp_dag_edge_t {
+  __device__ bool operator()(weight_t row_distance, weight_t col_distance, weight_t w) const
+  {
+    return (row_distance != std::numeric_limits<weight_t>::max()) &&
+           (row_distance + w == col_distance);
+  }
+};
+
+// Each warp takes one major vertex and adds its shortest path counts (for the sources the major
+// vertex is in the frontier of, frontier_sigma_first is 0 otherwise) to the path counts of its
+// unreached neighbors. Rows without any frontier source skip their edges.
+template <typename GraphViewType>
+__global__ void for_all_major_push_frontier_sigmas(
+  matrix_partition_device_t<GraphViewType> matrix_partition,
+  double const *frontier_sigma_first,
+  typename GraphViewType::vertex_type const *col_distance_first,
+  double *next_sigma_first,
+  size_t batch_size)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(betweenness_centrality_block_size % raft::warp_size() == 0);
+
+  auto const unreached = std::numeric_limits<vertex_t>::max();
+  auto const tid       = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const lane_id   = static_cast<size_t>(tid % raft::warp_size());
+  auto idx             = static_cast<size_t>(tid / raft::warp_size());
+
+  while (idx < static_cast<size_t>(matrix_partition.get_major_size())) {
+    auto sigma = lane_id < batch_size ? frontier_sigma_first[idx * batch_size + lane_id] : 0.0;
+    if (__any_sync(raft::warp_full_mask(), sigma != 0.0)) {
+      minor_index_iterator_t<vertex_t, edge_t> indices{};
+      weight_t const *weights{nullptr};
+      edge_t local_degree{};
+      thrust::tie(indices, weights, local_degree) =
+        matrix_partition.get_local_edges(static_cast<vertex_t>(idx));
+      if (sigma != 0.0) {
+        for (edge_t i = 0; i < local_degree; ++i) {
+          auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(indices[i]);
+          auto offset       = static_cast<size_t>(minor_offset) * batch_size + lane_id;
+          if (col_distance_first[offset] == unreached) {
+            atomicAdd(next_sigma_first + offset, sigma);
+          }
+        }
+      }
+    }
+    idx += gridDim.x * (blockDim.x / raft::warp_size());
+  }
+}
+
+// Each warp takes one major vertex and adds its shortest path counts (for the sources the major
+// vertex is in the frontier of, frontier_sigma_first is 0 otherwise) to the path counts of its
+// weighted shortest path DAG successors, and counts the number of the pushing DAG predecessors of
+// each successor. Rows without any frontier source skip their edges.
+template <typename GraphViewType>
+__global__ void for_all_major_push_dag_frontier_sigmas(
+  matrix_partition_device_t<GraphViewType> matrix_partition,
+  typename GraphViewType::weight_type const *row_distance_first,
+  double const *frontier_sigma_first,
+  typename GraphViewType::weight_type const *col_distance_first,
+  double *next_sigma_first,
+  uint32_t *next_count_first,
+  size_t batch_size)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(betweenness_centrality_block_size % raft::warp_size() == 0);
+
+  auto const tid     = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const lane_id = static_cast<size_t>(tid % raft::warp_size());
+  auto idx           = static_cast<size_t>(tid / raft::warp_size());
+
+  while (idx < static_cast<size_t>(matrix_partition.get_major_size())) {
+    auto sigma = lane_id < batch_size ? frontier_sigma_first[idx * batch_size + lane_id] : 0.0;
+    if (__any_sync(raft::warp_full_mask(), sigma != 0.0)) {
+      minor_index_iterator_t<vertex_t, edge_t> indices{};
+      weight_t const *weights{nullptr};
+      edge_t local_degree{};
+      thrust::tie(indices, weights, local_degree) =
+        matrix_partition.get_local_edges(static_cast<vertex_t>(idx));
+      if (sigma != 0.0) {
+        auto distance = row_distance_first[idx * batch_size + lane_id];
+        for (edge_t i = 0; i < local_degree; ++i) {
+          auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(indices[i]);
+          auto offset       = static_cast<size_t>(minor_offset) * batch_size + lane_id;
+          auto w            = weights != nullptr ? weights[i] : weight_t{1.0};
+          if (is_sssp_dag_edge_t<weight_t>{}(distance, col_distance_first[offset], w)) {
+            atomicAdd(next_sigma_first + offset, sigma);
+            atomicAdd(next_count_first + offset, uint32_t{1});
+          }
+        }
+      }
+    }
+    idx += gridDim.x * (blockDim.x / raft::warp_size());
+  }
+}
+
+// Each warp takes one major vertex and sums the (1 + delta) / sigma values of its shortest path DAG
+// successors (for the sources the major vertex is at level of). Rows without any source at level
+// skip their edges.
+template <typename GraphViewType, typename DistanceType, typename IsDagEdgeOp>
+__global__ void for_all_major_pull_successor_coefficients(
+  matrix_partition_device_t<GraphViewType> matrix_partition,
+  typename GraphViewType::vertex_type const *row_level_first,
+  DistanceType const *row_distance_first,
+  DistanceType const *col_distance_first,
+  double const *col_coefficient_first,
+  double *coefficient_sum_first,
+  size_t batch_size,
+  typename GraphViewType::vertex_type level,
+  IsDagEdgeOp is_dag_edge)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(betweenness_centrality_block_size % raft::warp_size() == 0);
+
+  auto const tid     = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const lane_id = static_cast<size_t>(tid % raft::warp_size());
+  auto idx           = static_cast<size_t>(tid / raft::warp_size());
+
+  while (idx < static_cast<size_t>(matrix_partition.get_major_size())) {
+    auto at_level =
+      (lane_id < batch_size) && (row_level_first[idx * batch_size + lane_id] == level);
+    double sum{0.0};
+    if (__any_sync(raft::warp_full_mask(), at_level)) {
+      minor_index_iterator_t<vertex_t, edge_t> indices{};
+      weight_t const *weights{nullptr};
+      edge_t local_degree{};
+      thrust::tie(indices, weights, local_degree) =
+        matrix_partition.get_local_edges(static_cast<vertex_t>(idx));
+      if (at_level) {
+        auto distance = row_distance_first[idx * batch_size + lane_id];
+        for (edge_t i = 0; i < local_degree; ++i) {
+          auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(indices[i]);
+          auto offset       = static_cast<size_t>(minor_offset) * batch_size + lane_id;
+          auto w            = weights != nullptr ? weights[i] : weight_t{1.0};
+          if (is_dag_edge(distance, col_distance_first[offset], w)) {
+            sum += col_coefficient_first[offset];
+          }
+        }
+      }
+    }
+    if (lane_id < batch_size) { coefficient_sum_first[idx * batch_size + lane_id] = sum; }
+    idx += gridDim.x * (blockDim.x / raft::warp_size());
+  }
+}
+
+// Each warp takes one major vertex and adds the edge dependencies (summed over the sources of the
+// batch) of its outgoing edges. col_coefficient_first holds (1 + delta) / sigma of the reached
+// columns (and 0 for the unreached columns).
+template <typename GraphViewType, typename DistanceType, typename IsDagEdgeOp, typename result_t>
+__global__ void for_all_major_accumulate_edge_dependencies(
+  matrix_partition_device_t<GraphViewType> matrix_partition,
+  DistanceType const *row_distance_first,
+  double const *row_sigma_first,
+  DistanceType const *col_distance_first,
+  double const *col_coefficient_first,
+  result_t *edge_centrality_first,
+  size_t batch_size,
+  IsDagEdgeOp is_dag_edge)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(betweenness_centrality_block_size % raft::warp_size() == 0);
+
+  auto const tid     = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const lane_id = static_cast<size_t>(tid % raft::warp_size());
+  auto idx           = static_cast<size_t>(tid / raft::warp_size());
+
+  while (idx < static_cast<size_t>(matrix_partition.get_major_size())) {
+    auto sigma = lane_id < batch_size ? row_sigma_first[idx * batch_size + lane_id] : 0.0;
+    if (__any_sync(raft::warp_full_mask(), sigma != 0.0)) {
+      auto distance = sigma != 0.0 ? row_distance_first[idx * batch_size + lane_id]
+                                   : std::numeric_limits<DistanceType>::max();
+      minor_index_iterator_t<vertex_t, edge_t> indices{};
+      weight_t const *weights{nullptr};
+      edge_t local_degree{};
+      thrust::tie(indices, weights, local_degree) =
+        matrix_partition.get_local_edges(static_cast<vertex_t>(idx));
+      auto local_offset = matrix_partition.get_local_offset(static_cast<vertex_t>(idx));
+      for (edge_t i = 0; i < local_degree; ++i) {
+        auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(indices[i]);
+        auto offset       = static_cast<size_t>(minor_offset) * batch_size + lane_id;
+        auto w            = weights != nullptr ? weights[i] : weight_t{1.0};
+        double dependency{0.0};
+        if ((sigma != 0.0) && is_dag_edge(distance, col_distance_first[offset], w)) {
+          dependency = sigma * col_coefficient_first[offset];
+        }
+        for (int j = raft::warp_size() / 2; j > 0; j /= 2) {
+          dependency += __shfl_down_sync(raft::warp_full_mask(), dependency, j);
+        }
+        if (lane_id == 0) {
+          edge_centrality_first[local_offset + i] += static_cast<result_t>(dependency);
+        }
+      }
+    }
+    idx += gridDim.x * (blockDim.x / raft::warp_size());
+  }
+}
+
+// reduce (sum) the adjacency matrix column values (batch_size values per column) of the GPUs in
+// row_comm to the GPUs owning the column vertices
+template <typename GraphViewType, typename T>
+void reduce_adj_matrix_col_values(raft::handle_t const &handle,
+                                  GraphViewType const &push_graph_view,
+                                  size_t batch_size,
+                                  T const *adj_matrix_col_value_first,
+                                  T *vertex_value_first)
+{
+  auto &row_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+  auto const row_comm_size = row_comm.get_size();
+  auto &col_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+  auto const col_comm_rank = col_comm.get_rank();
+
+  for (int i = 0; i < row_comm_size; ++i) {
+    auto offset = (push_graph_view.get_vertex_partition_first(col_comm_rank * row_comm_size + i) -
+                   push_graph_view.get_vertex_partition_first(col_comm_rank * row_comm_size));
+    device_reduce(
+      row_comm,
+      adj_matrix_col_value_first + static_cast<size_t>(offset) * batch_size,
+      vertex_value_first,
+      static_cast<size_t>(
+        push_graph_view.get_vertex_partition_size(col_comm_rank * row_comm_size + i)) *
+        batch_size,
+      raft::comms::op_t::SUM,
+      i,
+      handle.get_stream());
+  }
+}
+
+template <typename GraphViewType>
+void initialize_source_path_counts(
+  raft::handle_t const &handle,
+  GraphViewType const &push_graph_view,
+  typename GraphViewType::vertex_type const *batch_sources,
+  size_t batch_size,
+  rmm::device_uvector<typename GraphViewType::vertex_type> &levels,
+  rmm::device_uvector<double> &sigmas)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               levels.begin(),
+               levels.end(),
+               std::numeric_limits<vertex_t>::max());
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               sigmas.begin(),
+               sigmas.end(),
+               0.0);
+
+  vertex_partition_device_t<GraphViewType> vertex_partition(push_graph_view);
+  thrust::for_each(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(batch_size),
+                   [vertex_partition,
+                    batch_sources,
+                    batch_size,
+                    levels = levels.data(),
+                    sigmas = sigmas.data()] __device__(auto i) {
+                     auto v = batch_sources[i];
+                     if (vertex_partition.is_local_vertex_nocheck(v)) {
+                       auto offset =
+                         static_cast<size_t>(
+                           vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v)) *
+                           batch_size +
+                         i;
+                       levels[offset] = vertex_t{0};
+                       sigmas[offset] = 1.0;
+                     }
+                   });
+}
+
+// forward sweep (unweighted): compute the distances (levels) and shortest path counts from every
+// source in the batch, return the maximum distance
+template <typename GraphViewType>
+typename GraphViewType::vertex_type multi_source_shortest_path_counts(
+  raft::handle_t const &handle,
+  GraphViewType const &push_graph_view,
+  typename GraphViewType::vertex_type const *batch_sources,
+  size_t batch_size,
+  rmm::device_uvector<typename GraphViewType::vertex_type> &distances,
+  rmm::device_uvector<double> &sigmas)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto const unreached = std::numeric_limits<vertex_t>::max();
+  auto const num_rows =
+    GraphViewType::is_multi_gpu ? push_graph_view.get_number_of_local_adj_matrix_partition_rows()
+                                : vertex_t{0};
+  auto const num_cols =
+    GraphViewType::is_multi_gpu ? push_graph_view.get_number_of_local_adj_matrix_partition_cols()
+                                : vertex_t{0};
+
+  initialize_source_path_counts(
+    handle, push_graph_view, batch_sources, batch_size, distances, sigmas);
+
+  rmm::device_uvector<double> frontier_sigmas(distances.size(), handle.get_stream());
+  rmm::device_uvector<double> next_sigmas(distances.size(), handle.get_stream());
+  rmm::device_uvector<double> adj_matrix_row_frontier_sigmas(num_rows * batch_size,
+                                                             handle.get_stream());
+  rmm::device_uvector<vertex_t> adj_matrix_col_distances(num_cols * batch_size,
+                                                         handle.get_stream());
+  rmm::device_uvector<double> adj_matrix_col_next_sigmas(num_cols * batch_size,
+                                                         handle.get_stream());
+
+  vertex_t depth{0};
+  while (true) {
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      distances.begin(),
+                      distances.end(),
+                      sigmas.begin(),
+                      frontier_sigmas.begin(),
+                      [depth] __device__(auto distance, auto sigma) {
+                        return distance == depth ? sigma : 0.0;
+                      });
+
+    if (GraphViewType::is_multi_gpu) {
+      copy_to_adj_matrix_row(handle,
+                             push_graph_view,
+                             batch_size,
+                             frontier_sigmas.begin(),
+                             adj_matrix_row_frontier_sigmas.begin());
+      copy_to_adj_matrix_col(
+        handle, push_graph_view, batch_size, distances.begin(), adj_matrix_col_distances.begin());
+    }
+
+    auto next_first =
+      GraphViewType::is_multi_gpu ? adj_matrix_col_next_sigmas.data() : next_sigmas.data();
+    thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 next_first,
+                 next_first + (GraphViewType::is_multi_gpu ? adj_matrix_col_next_sigmas.size()
+                                                           : next_sigmas.size()),
+                 0.0);
+
+    for (size_t i = 0; i < push_graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      matrix_partition_device_t<GraphViewType> matrix_partition(push_graph_view, i);
+
+      if (matrix_partition.get_major_size() > 0) {
+        raft::grid_1d_thread_t update_grid(
+          static_cast<size_t>(matrix_partition.get_major_size()) * raft::warp_size(),
+          betweenness_centrality_block_size,
+          handle.get_device_properties().maxGridSize[0]);
+        for_all_major_push_frontier_sigmas<<<update_grid.num_blocks,
+                                             update_grid.block_size,
+                                             0,
+                                             handle.get_stream()>>>(
+          matrix_partition,
+          (GraphViewType::is_multi_gpu ? adj_matrix_row_frontier_sigmas.data()
+                                       : frontier_sigmas.data()) +
+            static_cast<size_t>(matrix_partition.get_major_value_start_offset()) * batch_size,
+          GraphViewType::is_multi_gpu ? adj_matrix_col_distances.data() : distances.data(),
+          next_first,
+          batch_size);
+      }
+    }
+
+    if (GraphViewType::is_multi_gpu) {
+      reduce_adj_matrix_col_values(handle,
+                                   push_graph_view,
+                                   batch_size,
+                                   adj_matrix_col_next_sigmas.data(),
+                                   next_sigmas.data());
+    }
+
+    // every unreached vertex with a non-zero path count is one hop farther than the frontier
+    thrust::for_each(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(distances.size()),
+                     [distances   = distances.data(),
+                      sigmas      = sigmas.data(),
+                      next_sigmas = next_sigmas.data(),
+                      unreached,
+                      depth] __device__(auto idx) {
+                       if ((distances[idx] == unreached) && (next_sigmas[idx] > 0.0)) {
+                         distances[idx] = depth + 1;
+                         sigmas[idx]    = next_sigmas[idx];
+                       }
+                     });
+
+    auto num_reached = static_cast<size_t>(
+      thrust::count(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    distances.begin(),
+                    distances.end(),
+                    depth + 1));
+    if (GraphViewType::is_multi_gpu) {
+      num_reached = host_scalar_allreduce(handle.get_comms(), num_reached, handle.get_stream());
+    }
+    if (num_reached == 0) { break; }
+    ++depth;
+  }
+
+  return depth;
+}
+
+// push the frontier (the vertices with non-zero frontier_sigmas) along the weighted shortest path
+// DAG edges, next_sigmas and next_counts store the sums of the pushed path counts and the numbers
+// of the pushing DAG predecessors
+template <typename GraphViewType>
+void push_dag_frontier(raft::handle_t const &handle,
+                       GraphViewType const &push_graph_view,
+                       size_t batch_size,
+                       typename GraphViewType::weight_type const *row_distance_first,
+                       typename GraphViewType::weight_type const *col_distance_first,
+                       rmm::device_uvector<double> const &frontier_sigmas,
+                       rmm::device_uvector<double> &next_sigmas,
+                       rmm::device_uvector<uint32_t> &next_counts)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto const num_rows =
+    GraphViewType::is_multi_gpu ? push_graph_view.get_number_of_local_adj_matrix_partition_rows()
+                                : vertex_t{0};
+  auto const num_cols =
+    GraphViewType::is_multi_gpu ? push_graph_view.get_number_of_local_adj_matrix_partition_cols()
+                                : vertex_t{0};
+
+  rmm::device_uvector<double> adj_matrix_row_frontier_sigmas(num_rows * batch_size,
+                                                             handle.get_stream());
+  rmm::device_uvector<double> adj_matrix_col_next_sigmas(num_cols * batch_size,
+                                                         handle.get_stream());
+  rmm::device_uvector<uint32_t> adj_matrix_col_next_counts(num_cols * batch_size,
+                                                           handle.get_stream());
+  if (GraphViewType::is_multi_gpu) {
+    copy_to_adj_matrix_row(handle,
+                           push_graph_view,
+                           batch_size,
+                           frontier_sigmas.begin(),
+                           adj_matrix_row_frontier_sigmas.begin());
+  }
+
+  auto next_sigma_first =
+    GraphViewType::is_multi_gpu ? adj_matrix_col_next_sigmas.data() : next_sigmas.data();
+  auto next_count_first =
+    GraphViewType::is_multi_gpu ? adj_matrix_col_next_counts.data() : next_counts.data();
+  auto next_size = GraphViewType::is_multi_gpu ? adj_matrix_col_next_sigmas.size()
+                                               : next_sigmas.size();
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               next_sigma_first,
+               next_sigma_first + next_size,
+               0.0);
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               next_count_first,
+               next_count_first + next_size,
+               uint32_t{0});
+
+  for (size_t i = 0; i < push_graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    matrix_partition_device_t<GraphViewType> matrix_partition(push_graph_view, i);
+
+    if (matrix_partition.get_major_size() > 0) {
+      auto row_value_start_offset =
+        static_cast<size_t>(matrix_partition.get_major_value_start_offset()) * batch_size;
+      raft::grid_1d_thread_t update_grid(
+        static_cast<size_t>(matrix_partition.get_major_size()) * raft::warp_size(),
+        betweenness_centrality_block_size,
+        handle.get_device_properties().maxGridSize[0]);
+      for_all_major_push_dag_frontier_sigmas<<<update_grid.num_blocks,
+                                               update_grid.block_size,
+                                               0,
+                                               handle.get_stream()>>>(
+        matrix_partition,
+        row_distance_first + row_value_start_offset,
+        (GraphViewType::is_multi_gpu ? adj_matrix_row_frontier_sigmas.data()
+                                     : frontier_sigmas.data()) +
+          row_value_start_offset,
+        col_distance_first,
+        next_sigma_first,
+        next_count_first,
+        batch_size);
+    }
+  }
+
+  if (GraphViewType::is_multi_gpu) {
+    reduce_adj_matrix_col_values(handle,
+                                 push_graph_view,
+                                 batch_size,
+                                 adj_matrix_col_next_sigmas.data(),
+                                 next_sigmas.data());
+    reduce_adj_matrix_col_values(handle,
+                                 push_graph_view,
+                                 batch_size,
+                                 adj_matrix_col_next_counts.data(),
+                                 next_counts.data());
+  }
+}
+
+// forward sweep (weighted): count the shortest paths from every source in the batch over the
+// shortest path DAG (of the precomputed distances) in topological order. Every vertex tracks the
+// number of its DAG predecessors (multiplicity) whose path counts are not yet pushed, and a vertex
+// joins the frontier (its level is set) once every predecessor has pushed. Return the maximum
+// level.
+template <typename GraphViewType>
+typename GraphViewType::vertex_type multi_source_dag_path_counts(
+  raft::handle_t const &handle,
+  GraphViewType const &push_graph_view,
+  typename GraphViewType::vertex_type const *batch_sources,
+  size_t batch_size,
+  rmm::device_uvector<typename GraphViewType::weight_type> const &distances,
+  typename GraphViewType::weight_type const *row_distance_first,
+  typename GraphViewType::weight_type const *col_distance_first,
+  rmm::device_uvector<typename GraphViewType::vertex_type> &levels,
+  rmm::device_uvector<double> &sigmas)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto const unassigned         = std::numeric_limits<vertex_t>::max();
+  auto const unreached_distance = std::numeric_limits<weight_t>::max();
+
+  rmm::device_uvector<double> frontier_sigmas(distances.size(), handle.get_stream());
+  rmm::device_uvector<double> next_sigmas(distances.size(), handle.get_stream());
+  rmm::device_uvector<uint32_t> next_counts(distances.size(), handle.get_stream());
+  rmm::device_uvector<uint32_t> remaining_counts(distances.size(), handle.get_stream());
+
+  // 1. count the DAG predecessors of every vertex (every reached vertex pushes)
+
+  thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    distances.begin(),
+                    distances.end(),
+                    frontier_sigmas.begin(),
+                    [unreached_distance] __device__(auto distance) {
+                      return distance != unreached_distance ? 1.0 : 0.0;
+                    });
+  push_dag_frontier(handle,
+                    push_graph_view,
+                    batch_size,
+                    row_distance_first,
+                    col_distance_first,
+                    frontier_sigmas,
+                    next_sigmas,
+                    remaining_counts);
+
+  // 2. push the path counts in topological order
+
+  initialize_source_path_counts(
+    handle, push_graph_view, batch_sources, batch_size, levels, sigmas);
+
+  vertex_t level{0};
+  while (true) {
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      levels.begin(),
+                      levels.end(),
+                      sigmas.begin(),
+                      frontier_sigmas.begin(),
+                      [level] __device__(auto l, auto sigma) { return l == level ? sigma : 0.0; });
+
+    push_dag_frontier(handle,
+                      push_graph_view,
+                      batch_size,
+                      row_distance_first,
+                      col_distance_first,
+                      frontier_sigmas,
+                      next_sigmas,
+                      next_counts);
+
+    thrust::for_each(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(levels.size()),
+                     [levels           = levels.data(),
+                      sigmas           = sigmas.data(),
+                      next_sigmas      = next_sigmas.data(),
+                      next_counts      = next_counts.data(),
+                      remaining_counts = remaining_counts.data(),
+                      unassigned,
+                      level] __device__(auto idx) {
+                       if ((levels[idx] == unassigned) && (next_counts[idx] > 0)) {
+                         sigmas[idx] += next_sigmas[idx];
+                         remaining_counts[idx] -= next_counts[idx];
+                         if (remaining_counts[idx] == 0) { levels[idx] = level + 1; }
+                       }
+                     });
+
+    auto num_leveled = static_cast<size_t>(
+      thrust::count(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    levels.begin(),
+                    levels.end(),
+                    level + 1));
+    if (GraphViewType::is_multi_gpu) {
+      num_leveled = host_scalar_allreduce(handle.get_comms(), num_leveled, handle.get_stream());
+    }
+    if (num_leveled == 0) { break; }
+    ++level;
+  }
+
+  return level;
+}
+
+template <typename vertex_t>
+void compute_successor_coefficients(raft::handle_t const &handle,
+                                    rmm::device_uvector<vertex_t> const &levels,
+                                    rmm::device_uvector<double> const &sigmas,
+                                    rmm::device_uvector<double> const &deltas,
+                                    rmm::device_uvector<double> &coefficients)
+{
+  thrust::transform(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(levels.size()),
+    coefficients.begin(),
+    [levels     = levels.data(),
+     sigmas     = sigmas.data(),
+     deltas     = deltas.data(),
+     unassigned = std::numeric_limits<vertex_t>::max()] __device__(auto idx) {
+      return levels[idx] != unassigned ? (1.0 + deltas[idx]) / sigmas[idx] : 0.0;
+    });
+}
+
+// backward sweep: accumulate the dependencies of every vertex on every source in the batch (in the
+// reverse level order) and add them to the vertex and edge centralities (and the squared
+// per-source vertex dependencies to vertex_dependency_squares if not nullptr). row_level_first,
+// row_distance_first, and col_distance_first point to the adjacency matrix row & column copies in
+// multi-GPU (and to the vertex values in single-GPU).
+template <typename GraphViewType, typename DistanceType, typename IsDagEdgeOp, typename result_t>
+void accumulate_dependencies(raft::handle_t const &handle,
+                             GraphViewType const &push_graph_view,
+                             size_t batch_size,
+                             typename GraphViewType::vertex_type max_level,
+                             rmm::device_uvector<typename GraphViewType::vertex_type> const &levels,
+                             typename GraphViewType::vertex_type const *row_level_first,
+                             DistanceType const *row_distance_first,
+                             DistanceType const *col_distance_first,
+                             rmm::device_uvector<double> const &sigmas,
+                             IsDagEdgeOp is_dag_edge,
+                             result_t *vertex_centralities,
+                             double *vertex_dependency_squares,
+                             result_t *edge_centralities,
+                             bool endpoints)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  auto const unassigned         = std::numeric_limits<vertex_t>::max();
+  auto const num_local_vertices = push_graph_view.get_number_of_local_vertices();
+  auto const num_rows =
+    GraphViewType::is_multi_gpu ? push_graph_view.get_number_of_local_adj_matrix_partition_rows()
+                                : vertex_t{0};
+  auto const num_cols =
+    GraphViewType::is_multi_gpu ? push_graph_view.get_number_of_local_adj_matrix_partition_cols()
+                                : vertex_t{0};
+
+  rmm::device_uvector<double> deltas(levels.size(), handle.get_stream());
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               deltas.begin(),
+               deltas.end(),
+               0.0);
+
+  rmm::device_uvector<double> coefficients(levels.size(), handle.get_stream());
+  rmm::device_uvector<double> coefficient_sums(levels.size(), handle.get_stream());
+  rmm::device_uvector<double> adj_matrix_col_coefficients(num_cols * batch_size,
+                                                          handle.get_stream());
+
+  // the dependency of a source on itself is the number of the vertices reached from the source
+  // (excluding the source), this is required only to count the endpoints
+  auto min_level = ((vertex_centralities != nullptr) && endpoints) ? vertex_t{0} : vertex_t{1};
+  for (auto level = max_level - 1; level >= min_level; --level) {
+    compute_successor_coefficients(handle, levels, sigmas, deltas, coefficients);
+    if (GraphViewType::is_multi_gpu) {
+      copy_to_adj_matrix_col(handle,
+                             push_graph_view,
+                             batch_size,
+                             coefficients.begin(),
+                             adj_matrix_col_coefficients.begin());
+    }
+
+    for (size_t i = 0; i < push_graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      matrix_partition_device_t<GraphViewType> matrix_partition(push_graph_view, i);
+
+      rmm::device_uvector<double> major_coefficient_sums(
+        GraphViewType::is_multi_gpu
+          ? static_cast<size_t>(matrix_partition.get_major_size()) * batch_size
+          : size_t{0},
+        handle.get_stream());
+
+      if (matrix_partition.get_major_size() > 0) {
+        auto row_value_start_offset =
+          static_cast<size_t>(matrix_partition.get_major_value_start_offset()) * batch_size;
+        raft::grid_1d_thread_t update_grid(
+          static_cast<size_t>(matrix_partition.get_major_size()) * raft::warp_size(),
+          betweenness_centrality_block_size,
+          handle.get_device_properties().maxGridSize[0]);
+        for_all_major_pull_successor_coefficients<<<update_grid.num_blocks,
+                                                    update_grid.block_size,
+                                                    0,
+                                                    handle.get_stream()>>>(
+          matrix_partition,
+          row_level_first + row_value_start_offset,
+          row_distance_first + row_value_start_offset,
+          col_distance_first,
+          GraphViewType::is_multi_gpu ? adj_matrix_col_coefficients.data() : coefficients.data(),
+          GraphViewType::is_multi_gpu ? major_coefficient_sums.data() : coefficient_sums.data(),
+          batch_size,
+          level,
+          is_dag_edge);
+      }
+
+      if (GraphViewType::is_multi_gpu) {
+        auto &col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+
+        device_reduce(col_comm,
+                      major_coefficient_sums.begin(),
+                      coefficient_sums.begin(),
+                      major_coefficient_sums.size(),
+                      raft::comms::op_t::SUM,
+                      static_cast<int>(i),
+                      handle.get_stream());
+      }
+    }
+
+    thrust::for_each(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(levels.size()),
+                     [levels           = levels.data(),
+                      sigmas           = sigmas.data(),
+                      coefficient_sums = coefficient_sums.data(),
+                      deltas           = deltas.data(),
+                      level] __device__(auto idx) {
+                       if (levels[idx] == level) {
+                         deltas[idx] = sigmas[idx] * coefficient_sums[idx];
+                       }
+                     });
+  }
+
+  if (vertex_centralities != nullptr) {
+    thrust::for_each(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     thrust::make_counting_iterator(vertex_t{0}),
+                     thrust::make_counting_iterator(num_local_vertices),
+                     [levels = levels.data(),
+                      deltas = deltas.data(),
+                      vertex_centralities,
+                      vertex_dependency_squares,
+                      batch_size,
+                      endpoints,
+                      unassigned] __device__(auto v_offset) {
+                       double sum{0.0};
+                       double square_sum{0.0};
+                       for (size_t j = 0; j < batch_size; ++j) {
+                         auto idx = static_cast<size_t>(v_offset) * batch_size + j;
+                         double dependency{0.0};
+                         if (levels[idx] != unassigned) {
+                           if (levels[idx] > vertex_t{0}) {
+                             dependency = deltas[idx] + (endpoints ? 1.0 : 0.0);
+                           } else if (endpoints) {
+                             dependency = deltas[idx];
+                           }
+                         }
+                         sum += dependency;
+                         square_sum += dependency * dependency;
+                       }
+                       vertex_centralities[v_offset] += static_cast<result_t>(sum);
+                       if (vertex_dependency_squares != nullptr) {
+                         vertex_dependency_squares[v_offset] += square_sum;
+                       }
+                     });
+  }
+
+  if (edge_centralities != nullptr) {
+    compute_successor_coefficients(handle, levels, sigmas, deltas, coefficients);
+
+    rmm::device_uvector<double> adj_matrix_row_sigmas(num_rows * batch_size, handle.get_stream());
+    if (GraphViewType::is_multi_gpu) {
+      copy_to_adj_matrix_row(
+        handle, push_graph_view, batch_size, sigmas.begin(), adj_matrix_row_sigmas.begin());
+      copy_to_adj_matrix_col(handle,
+                             push_graph_view,
+                             batch_size,
+                             coefficients.begin(),
+                             adj_matrix_col_coefficients.begin());
+    }
+
+    edge_t edge_offset{0};
+    for (size_t i = 0; i < push_graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      matrix_partition_device_t<GraphViewType> matrix_partition(push_graph_view, i);
+
+      if (matrix_partition.get_major_size() > 0) {
+        auto row_value_start_offset =
+          static_cast<size_t>(matrix_partition.get_major_value_start_offset()) * batch_size;
+        raft::grid_1d_thread_t update_grid(
+          static_cast<size_t>(matrix_partition.get_major_size()) * raft::warp_size(),
+          betweenness_centrality_block_size,
+          handle.get_device_properties().maxGridSize[0]);
+        for_all_major_accumulate_edge_dependencies<<<update_grid.num_blocks,
+                                                     update_grid.block_size,
+                                                     0,
+                                                     handle.get_stream()>>>(
+          matrix_partition,
+          row_distance_first + row_value_start_offset,
+          (GraphViewType::is_multi_gpu ? adj_matrix_row_sigmas.data() : sigmas.data()) +
+            row_value_start_offset,
+          col_distance_first,
+          GraphViewType::is_multi_gpu ? adj_matrix_col_coefficients.data() : coefficients.data(),
+          edge_centralities + edge_offset,
+          batch_size,
+          is_dag_edge);
+      }
+      edge_offset += matrix_partition.get_number_of_edges();
+    }
+  }
+}
+
+// validate the sources and collect the sources of every GPU (every GPU participates in every
+// traversal), every vertex is a source if the (total) number of sources is 0
+template <typename GraphViewType>
+rmm::device_uvector<typename GraphViewType::vertex_type> gather_sources(
+  raft::handle_t const &handle,
+  GraphViewType const &push_graph_view,
+  typename GraphViewType::vertex_type const *sources,
+  size_t num_sources)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto const num_vertices = push_graph_view.get_number_of_vertices();
+
+  CUGRAPH_EXPECTS((sources != nullptr) || (num_sources == 0),
+                  "Invalid input argument: sources should not be nullptr if num_sources > 0.");
+
+  vertex_partition_device_t<GraphViewType> vertex_partition(push_graph_view);
+
+  auto num_invalid_sources = static_cast<size_t>(
+    thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     sources,
+                     sources + num_sources,
+                     [vertex_partition] __device__(auto v) {
+                       return !vertex_partition.is_valid_vertex(v);
+                     }));
+  if (GraphViewType::is_multi_gpu) {
+    num_invalid_sources =
+      host_scalar_allreduce(handle.get_comms(), num_invalid_sources, handle.get_stream());
+  }
+  CUGRAPH_EXPECTS(num_invalid_sources == 0,
+                  "Invalid input argument: sources have out-of-range vertex IDs.");
+
+  rmm::device_uvector<vertex_t> all_sources(0, handle.get_stream());
+  if (GraphViewType::is_multi_gpu) {
+    auto &comm = handle.get_comms();
+
+    auto total_num_sources = host_scalar_allreduce(comm, num_sources, handle.get_stream());
+    if (total_num_sources == 0) {
+      all_sources.resize(num_vertices, handle.get_stream());
+      thrust::sequence(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                       all_sources.begin(),
+                       all_sources.end(),
+                       vertex_t{0});
+    } else {
+      auto rx_counts = host_scalar_allgather(comm, num_sources, handle.get_stream());
+      std::vector<size_t> displacements(rx_counts.size(), size_t{0});
+      std::partial_sum(rx_counts.begin(), rx_counts.end() - 1, displacements.begin() + 1);
+      all_sources.resize(total_num_sources, handle.get_stream());
+      device_allgatherv(
+        comm, sources, all_sources.data(), rx_counts, displacements, handle.get_stream());
+    }
+  } else {
+    all_sources.resize(num_sources > 0 ? num_sources : static_cast<size_t>(num_vertices),
+                       handle.get_stream());
+    if (num_sources > 0) {
+      thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   sources,
+                   sources + num_sources,
+                   all_sources.begin());
+    } else {
+      thrust::sequence(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                       all_sources.begin(),
+                       all_sources.end(),
+                       vertex_t{0});
+    }
+  }
+
+  return all_sources;
+}
+
+// run the forward & backward sweeps for a batch of (at most betweenness_centrality_max_batch_size)
+// sources and add the dependencies to the vertex and edge centralities (and the squared per-source
+// vertex dependencies to vertex_dependency_squares if not nullptr)
+template <typename GraphViewType, typename result_t>
+void accumulate_batch_dependencies(raft::handle_t const &handle,
+                                   GraphViewType const &push_graph_view,
+                                   typename GraphViewType::vertex_type const *batch_sources,
+                                   size_t batch_size,
+                                   result_t *vertex_centralities,
+                                   double *vertex_dependency_squares,
+                                   result_t *edge_centralities,
+                                   bool endpoints,
+                                   bool weighted)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto const num_local_vertices = push_graph_view.get_number_of_local_vertices();
+  auto const num_rows =
+    GraphViewType::is_multi_gpu ? push_graph_view.get_number_of_local_adj_matrix_partition_rows()
+                                : vertex_t{0};
+  auto const num_cols =
+    GraphViewType::is_multi_gpu ? push_graph_view.get_number_of_local_adj_matrix_partition_cols()
+                                : vertex_t{0};
+
+  // vertex-major (the level, path count, and dependency of the i'th vertex on the j'th source of
+  // the batch are stored at i * batch_size + j), levels are the distances for unweighted graphs
+  rmm::device_uvector<vertex_t> levels(num_local_vertices * batch_size, handle.get_stream());
+  rmm::device_uvector<double> sigmas(levels.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> adj_matrix_row_levels(num_rows * batch_size, handle.get_stream());
+  auto row_level_first = GraphViewType::is_multi_gpu ? adj_matrix_row_levels.data() : levels.data();
+
+  if (weighted) {
+    // FIXME: the delta-stepping SSSP runs one source at a time, a multi-source SSSP would reduce
+    // the number of edge scans
+    rmm::device_uvector<weight_t> distances(levels.size(), handle.get_stream());
+    {
+      std::vector<vertex_t> h_batch_sources(batch_size);
+      raft::update_host(h_batch_sources.data(), batch_sources, batch_size, handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      rmm::device_uvector<weight_t> source_distances(num_local_vertices, handle.get_stream());
+      for (size_t j = 0; j < batch_size; ++j) {
+        sssp(handle,
+             push_graph_view,
+             source_distances.data(),
+             static_cast<vertex_t *>(nullptr),
+             h_batch_sources[j],
+             std::numeric_limits<weight_t>::max(),
+             false,
+             false);
+        thrust::for_each(
+          rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+          thrust::make_counting_iterator(vertex_t{0}),
+          thrust::make_counting_iterator(num_local_vertices),
+          [source_distances = source_distances.data(),
+           distances        = distances.data(),
+           batch_size,
+           j] __device__(auto v_offset) {
+            distances[static_cast<size_t>(v_offset) * batch_size + j] = source_distances[v_offset];
+          });
+      }
+    }
+
+    rmm::device_uvector<weight_t> adj_matrix_row_distances(num_rows * batch_size,
+                                                           handle.get_stream());
+    rmm::device_uvector<weight_t> adj_matrix_col_distances(num_cols * batch_size,
+                                                           handle.get_stream());
+    if (GraphViewType::is_multi_gpu) {
+      copy_to_adj_matrix_row(
+        handle, push_graph_view, batch_size, distances.begin(), adj_matrix_row_distances.begin());
+      copy_to_adj_matrix_col(
+        handle, push_graph_view, batch_size, distances.begin(), adj_matrix_col_distances.begin());
+    }
+    auto row_distance_first =
+      GraphViewType::is_multi_gpu ? adj_matrix_row_distances.data() : distances.data();
+    auto col_distance_first =
+      GraphViewType::is_multi_gpu ? adj_matrix_col_distances.data() : distances.data();
+
+    auto max_level = multi_source_dag_path_counts(handle,
+                                                  push_graph_view,
+                                                  batch_sources,
+                                                  batch_size,
+                                                  distances,
+                                                  row_distance_first,
+                                                  col_distance_first,
+                                                  levels,
+                                                  sigmas);
+    if (GraphViewType::is_multi_gpu) {
+      copy_to_adj_matrix_row(
+        handle, push_graph_view, batch_size, levels.begin(), adj_matrix_row_levels.begin());
+    }
+
+    accumulate_dependencies(handle,
+                            push_graph_view,
+                            batch_size,
+                            max_level,
+                            levels,
+                            row_level_first,
+                            row_distance_first,
+                            col_distance_first,
+                            sigmas,
+                            is_sssp_dag_edge_t<weight_t>{},
+                            vertex_centralities,
+                            vertex_dependency_squares,
+                            edge_centralities,
+                            endpoints);
+  } else {
+    auto max_level = multi_source_shortest_path_counts(
+      handle, push_graph_view, batch_sources, batch_size, levels, sigmas);
+
+    rmm::device_uvector<vertex_t> adj_matrix_col_levels(num_cols * batch_size, handle.get_stream());
+    if (GraphViewType::is_multi_gpu) {
+      copy_to_adj_matrix_row(
+        handle, push_graph_view, batch_size, levels.begin(), adj_matrix_row_levels.begin());
+      copy_to_adj_matrix_col(
+        handle, push_graph_view, batch_size, levels.begin(), adj_matrix_col_levels.begin());
+    }
+
+    accumulate_dependencies(
+      handle,
+      push_graph_view,
+      batch_size,
+      max_level,
+      levels,
+      row_level_first,
+      row_level_first,
+      GraphViewType::is_multi_gpu ? adj_matrix_col_levels.data() : levels.data(),
+      sigmas,
+      is_bfs_dag_edge_t<vertex_t, weight_t>{},
+      vertex_centralities,
+      vertex_dependency_squares,
+      edge_centralities,
+      endpoints);
+  }
+}
+
+template <typename GraphViewType, typename result_t>
+void betweenness_centrality(raft::handle_t const &handle,
+                            GraphViewType const &push_graph_view,
+                            typename GraphViewType::vertex_type const *sources,
+                            size_t num_sources,
+                            result_t *vertex_centralities,
+                            result_t *edge_centralities,
+                            bool normalized,
+                            bool endpoints,
+                            bool weighted,
+                            bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_vertices       = push_graph_view.get_number_of_vertices();
+  auto const num_local_vertices = push_graph_view.get_number_of_local_vertices();
+
+  edge_t num_local_edges{0};
+  for (size_t i = 0; i < push_graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    num_local_edges += push_graph_view.get_number_of_local_adj_matrix_partition_edges(i);
+  }
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(!weighted || push_graph_view.is_weighted(),
+                  "Invalid input argument: weighted betweenness centrality requires a weighted "
+                  "graph.");
+
+  if (do_expensive_check) {
+    if (weighted) {
+      auto num_nonpositive_edge_weights =
+        count_if_e(handle,
+                   push_graph_view,
+                   thrust::make_constant_iterator(0) /* dummy */,
+                   thrust::make_constant_iterator(0) /* dummy */,
+                   [] __device__(vertex_t, vertex_t, weight_t w, auto, auto) { return w <= 0.0; });
+      CUGRAPH_EXPECTS(num_nonpositive_edge_weights == 0,
+                      "Invalid input argument: input graph should have positive edge weights.");
+    }
+  }
+
+  // 2. collect the sources of every GPU (every GPU participates in every traversal)
+
+  auto all_sources = gather_sources(handle, push_graph_view, sources, num_sources);
+
+  // 3. accumulate the dependencies of each batch of sources
+
+  if (vertex_centralities != nullptr) {
+    thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 vertex_centralities,
+                 vertex_centralities + num_local_vertices,
+                 result_t{0.0});
+  }
+  if (edge_centralities != nullptr) {
+    thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 edge_centralities,
+                 edge_centralities + num_local_edges,
+                 result_t{0.0});
+  }
+
+  for (size_t batch_first = 0; batch_first < all_sources.size();
+       batch_first += betweenness_centrality_max_batch_size) {
+    auto const batch_size =
+      std::min(betweenness_centrality_max_batch_size, all_sources.size() - batch_first);
+    accumulate_batch_dependencies(handle,
+                                  push_graph_view,
+                                  all_sources.data() + batch_first,
+                                  batch_size,
+                                  vertex_centralities,
+                                  static_cast<double *>(nullptr),
+                                  edge_centralities,
+                                  endpoints,
+                                  weighted);
+  }
+
+  // 4. rescale (following the single-GPU betweenness_centrality & edge_betweenness_centrality)
+
+  auto const n = static_cast<result_t>(num_vertices);
+  result_t rescale_factor{1.0};
+  if (vertex_centralities != nullptr) {
+    if (normalized) {
+      if (num_vertices > 2) {
+        rescale_factor /= endpoints ? n * (n - result_t{1.0})
+                                    : (n - result_t{1.0}) * (n - result_t{2.0});
+      }
+    } else if (push_graph_view.is_symmetric()) {
+      rescale_factor /= result_t{2.0};
+    }
+    if ((normalized || push_graph_view.is_symmetric()) && (num_vertices > 2)) {
+      rescale_factor *= n / static_cast<result_t>(all_sources.size());
+    }
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      vertex_centralities,
+                      vertex_centralities + num_local_vertices,
+                      vertex_centralities,
+                      [rescale_factor] __device__(auto c) { return c * rescale_factor; });
+  }
+
+  rescale_factor = result_t{1.0};
+  if (edge_centralities != nullptr) {
+    if (normalized) {
+      if (num_vertices > 1) { rescale_factor /= n * (n - result_t{1.0}); }
+    } else if (push_graph_view.is_symmetric()) {
+      rescale_factor /= result_t{2.0};
+    }
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      edge_centralities,
+                      edge_centralities + num_local_edges,
+                      edge_centralities,
+                      [rescale_factor] __device__(auto c) { return c * rescale_factor; });
+  }
+}
+
+// the i'th sampled source (uniform with replacement), sources depend only on the seed and the
+// sample index so every GPU draws the same sources without communication
+template <typename vertex_t>
+struct sample_source_t {
+  uint64_t seed{0};
+  vertex_t num_vertices{0};
+
+  __device__ vertex_t operator()(size_t i) const
+  {
+    return static_cast<vertex_t>(mix(seed ^ mix(static_cast<uint64_t>(i))) %
+                                 static_cast<uint64_t>(num_vertices));
+  }
+
+  __device__ static uint64_t mix(uint64_t x)
+  {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+  }
+};
+
+// empirical Bernstein bound (Maurer & Pontil) on the deviation of the mean of num_samples samples
+// (in [0, 1] after dividing by max_dependency) from its expectation
+struct empirical_bernstein_bound_t {
+  double num_samples{0.0};
+  double max_dependency{1.0};
+  double log_term{0.0};  // ln(4 / per-vertex failure probability)
+
+  __device__ double operator()(thrust::tuple<double, double> sums) const
+  {
+    auto mean       = thrust::get<0>(sums) / (num_samples * max_dependency);
+    auto square_sum = thrust::get<1>(sums) / (max_dependency * max_dependency);
+    auto variance =
+      thrust::max((square_sum - num_samples * mean * mean) / (num_samples - 1.0), 0.0);
+    return sqrt(2.0 * variance * log_term / num_samples) +
+           7.0 * log_term / (3.0 * (num_samples - 1.0));
+  }
+};
+
+// a sampled source's dependency of a vertex is at most max_dependency, the normalized betweenness
+// centrality is the expected dependency (over a uniformly sampled source) / max_dependency scaled
+// by n / (n - 1) if endpoints is false
+template <typename GraphViewType, typename result_t>
+size_t approximate_betweenness_centrality(raft::handle_t const &handle,
+                                          GraphViewType const &push_graph_view,
+                                          result_t *centralities,
+                                          double epsilon,
+                                          double delta,
+                                          uint64_t seed,
+                                          bool normalized,
+                                          bool endpoints,
+                                          bool weighted,
+                                          bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto const num_vertices       = push_graph_view.get_number_of_vertices();
+  auto const num_local_vertices = push_graph_view.get_number_of_local_vertices();
+
+  CUGRAPH_EXPECTS(epsilon > 0.0, "Invalid input argument: epsilon should be positive.");
+  CUGRAPH_EXPECTS((delta > 0.0) && (delta < 1.0),
+                  "Invalid input argument: delta should be in (0, 1).");
+
+  if (num_vertices <= 2) {
+    thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 centralities,
+                 centralities + num_local_vertices,
+                 result_t{0.0});
+    return size_t{0};
+  }
+
+  // 1. find the maximum number of samples (Hoeffding's inequality and the union bound over every
+  // vertex with a half of delta), exact betweenness centrality is cheaper if this exceeds the
+  // number of vertices
+
+  auto const n              = static_cast<double>(num_vertices);
+  auto const max_dependency = endpoints ? n - 1.0 : n - 2.0;
+  auto const sample_epsilon = endpoints ? epsilon : epsilon * (n - 1.0) / n;
+  auto const max_num_samples = static_cast<size_t>(
+    std::ceil(std::log(4.0 * n / delta) / (2.0 * sample_epsilon * sample_epsilon)));
+  if (max_num_samples >= static_cast<size_t>(num_vertices)) {
+    betweenness_centrality(handle,
+                           push_graph_view,
+                           static_cast<vertex_t const *>(nullptr),
+                           size_t{0},
+                           centralities,
+                           static_cast<result_t *>(nullptr),
+                           normalized,
+                           endpoints,
+                           weighted,
+                           do_expensive_check);
+    return static_cast<size_t>(num_vertices);
+  }
+
+  // 2. sample the sources in rounds (each round doubles the number of samples) till the empirical
+  // Bernstein bound of every vertex (with the union bound over every vertex and every round with
+  // the other half of delta) falls below epsilon (or the number of samples reaches the maximum)
+
+  auto round_log_term = [n, delta](size_t num_rounds) {
+    return std::log(4.0 * 2.0 * n * static_cast<double>(num_rounds) / delta);
+  };
+  auto num_samples = std::max(
+    betweenness_centrality_max_batch_size,
+    static_cast<size_t>(std::ceil(7.0 * round_log_term(1) / (3.0 * sample_epsilon))) + 1);
+  size_t num_rounds{1};
+  while ((num_samples << (num_rounds - 1)) < max_num_samples) { ++num_rounds; }
+  auto const log_term = round_log_term(num_rounds);
+
+  rmm::device_uvector<double> dependency_sums(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<double> dependency_squares(num_local_vertices, handle.get_stream());
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               dependency_sums.begin(),
+               dependency_sums.end(),
+               0.0);
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               dependency_squares.begin(),
+               dependency_squares.end(),
+               0.0);
+
+  rmm::device_uvector<vertex_t> batch_sources(betweenness_centrality_max_batch_size,
+                                              handle.get_stream());
+  size_t num_sampled{0};
+  while (true) {
+    auto const round_num_samples = std::min(num_samples, max_num_samples);
+    while (num_sampled < round_num_samples) {
+      auto const batch_size =
+        std::min(betweenness_centrality_max_batch_size, round_num_samples - num_sampled);
+      thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        thrust::make_counting_iterator(num_sampled),
+                        thrust::make_counting_iterator(num_sampled + batch_size),
+                        batch_sources.begin(),
+                        sample_source_t<vertex_t>{seed, num_vertices});
+      accumulate_batch_dependencies(handle,
+                                    push_graph_view,
+                                    batch_sources.data(),
+                                    batch_size,
+                                    dependency_sums.data(),
+                                    dependency_squares.data(),
+                                    static_cast<double *>(nullptr),
+                                    endpoints,
+                                    weighted);
+      num_sampled += batch_size;
+    }
+    if (num_sampled >= max_num_samples) { break; }
+
+    auto max_bound = thrust::transform_reduce(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(dependency_sums.begin(), dependency_squares.begin())),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(dependency_sums.end(), dependency_squares.end())),
+      empirical_bernstein_bound_t{static_cast<double>(num_sampled), max_dependency, log_term},
+      0.0,
+      thrust::maximum<double>());
+    if (GraphViewType::is_multi_gpu) {
+      max_bound = host_scalar_allreduce(
+        handle.get_comms(), max_bound, raft::comms::op_t::MAX, handle.get_stream());
+    }
+    if (max_bound <= sample_epsilon) { break; }
+    num_samples *= 2;
+  }
+
+  // 3. rescale (the estimated dependency sum over every source is n / num_sampled times the sum
+  // over the sampled sources)
+
+  auto rescale_factor = n / static_cast<double>(num_sampled);
+  if (normalized) {
+    rescale_factor /= endpoints ? n * (n - 1.0) : (n - 1.0) * (n - 2.0);
+  } else if (push_graph_view.is_symmetric()) {
+    rescale_factor /= 2.0;
+  }
+  thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    dependency_sums.begin(),
+                    dependency_sums.end(),
+                    centralities,
+                    [rescale_factor] __device__(auto c) {
+                      return static_cast<result_t>(c * rescale_factor);
+                    });
+
+  return num_sampled;
+}
+
+// closeness centrality from the distances of the sources to every vertex (added by the forward
+// sweeps of the batched traversals), the sums over the sampled sources estimate the sums over every
+// vertex scaled by n / the number of sources
+template <typename GraphViewType, typename result_t>
+void closeness_centrality(raft::handle_t const &handle,
+                          GraphViewType const &push_graph_view,
+                          rmm::device_uvector<typename GraphViewType::vertex_type> const &sources,
+                          result_t *centralities,
+                          bool wf_improved)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto const unreached          = std::numeric_limits<vertex_t>::max();
+  auto const num_vertices       = push_graph_view.get_number_of_vertices();
+  auto const num_local_vertices = push_graph_view.get_number_of_local_vertices();
+
+  rmm::device_uvector<double> distance_sums(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<double> reached_counts(num_local_vertices, handle.get_stream());
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               distance_sums.begin(),
+               distance_sums.end(),
+               0.0);
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               reached_counts.begin(),
+               reached_counts.end(),
+               0.0);
+
+  for (size_t batch_first = 0; batch_first < sources.size();
+       batch_first += betweenness_centrality_max_batch_size) {
+    auto const batch_size =
+      std::min(betweenness_centrality_max_batch_size, sources.size() - batch_first);
+
+    rmm::device_uvector<vertex_t> distances(num_local_vertices * batch_size, handle.get_stream());
+    rmm::device_uvector<double> sigmas(distances.size(), handle.get_stream());
+    multi_source_shortest_path_counts(
+      handle, push_graph_view, sources.data() + batch_first, batch_size, distances, sigmas);
+
+    thrust::for_each(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     thrust::make_counting_iterator(vertex_t{0}),
+                     thrust::make_counting_iterator(num_local_vertices),
+                     [distances      = distances.data(),
+                      distance_sums  = distance_sums.data(),
+                      reached_counts = reached_counts.data(),
+                      batch_size,
+                      unreached] __device__(auto v_offset) {
+                       double sum{0.0};
+                       double count{0.0};
+                       for (size_t j = 0; j < batch_size; ++j) {
+                         auto d = distances[static_cast<size_t>(v_offset) * batch_size + j];
+                         if ((d != unreached) && (d > vertex_t{0})) {
+                           sum += static_cast<double>(d);
+                           count += 1.0;
+                         }
+                       }
+                       distance_sums[v_offset] += sum;
+                       reached_counts[v_offset] += count;
+                     });
+  }
+
+  // the Wasserman & Faust scaling multiplies by the (estimated) fraction of the other vertices that
+  // reach the vertex
+  auto const n               = static_cast<double>(num_vertices);
+  auto const reached_scaling = n / static_cast<double>(sources.size());
+  thrust::transform(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    distance_sums.begin(),
+    distance_sums.end(),
+    reached_counts.begin(),
+    centralities,
+    [n, reached_scaling, wf_improved] __device__(auto distance_sum, auto reached_count) {
+      if (distance_sum == 0.0) { return result_t{0.0}; }
+      auto closeness = reached_count / distance_sum;
+      if (wf_improved && (n > 1.0)) {
+        closeness *= thrust::min(reached_count * reached_scaling / (n - 1.0), 1.0);
+      }
+      return static_cast<result_t>(closeness);
+    });
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void betweenness_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t const *sources,
+  size_t num_sources,
+  result_t *centralities,
+  bool normalized,
+  bool endpoints,
+  bool weighted,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(centralities != nullptr,
+                  "Invalid input argument: centralities should not be nullptr.");
+
+  detail::betweenness_centrality(handle,
+                                 graph_view,
+                                 sources,
+                                 num_sources,
+                                 centralities,
+                                 static_cast<result_t *>(nullptr),
+                                 normalized,
+                                 endpoints,
+                                 weighted,
+                                 do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void edge_betweenness_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t const *sources,
+  size_t num_sources,
+  result_t *centralities,
+  bool normalized,
+  bool weighted,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(centralities != nullptr,
+                  "Invalid input argument: centralities should not be nullptr.");
+
+  detail::betweenness_centrality(handle,
+                                 graph_view,
+                                 sources,
+                                 num_sources,
+                                 static_cast<result_t *>(nullptr),
+                                 centralities,
+                                 normalized,
+                                 false,
+                                 weighted,
+                                 do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+size_t approximate_betweenness_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  result_t *centralities,
+  double epsilon,
+  double delta,
+  uint64_t seed,
+  bool normalized,
+  bool endpoints,
+  bool weighted,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(centralities != nullptr,
+                  "Invalid input argument: centralities should not be nullptr.");
+
+  return detail::approximate_betweenness_centrality(handle,
+                                                    graph_view,
+                                                    centralities,
+                                                    epsilon,
+                                                    delta,
+                                                    seed,
+                                                    normalized,
+                                                    endpoints,
+                                                    weighted,
+                                                    do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void closeness_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t const *sources,
+  size_t num_sources,
+  result_t *centralities,
+  bool wf_improved)
+{
+  CUGRAPH_EXPECTS(centralities != nullptr,
+                  "Invalid input argument: centralities should not be nullptr.");
+
+  auto all_sources = detail::gather_sources(handle, graph_view, sources, num_sources);
+  detail::closeness_centrality(handle, graph_view, all_sources, centralities, wf_improved);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+size_t approximate_closeness_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  result_t *centralities,
+  double epsilon,
+  double delta,
+  uint64_t seed,
+  bool wf_improved)
+{
+  CUGRAPH_EXPECTS(centralities != nullptr,
+                  "Invalid input argument: centralities should not be nullptr.");
+  CUGRAPH_EXPECTS(epsilon > 0.0, "Invalid input argument: epsilon should be positive.");
+  CUGRAPH_EXPECTS((delta > 0.0) && (delta < 1.0),
+                  "Invalid input argument: delta should be in (0, 1).");
+
+  // Eppstein & Wang: Hoeffding's inequality (for the sampled distances divided by the diameter)
+  // and the union bound over every vertex
+  auto const num_vertices = graph_view.get_number_of_vertices();
+  auto const n            = static_cast<double>(num_vertices);
+  auto num_samples =
+    static_cast<size_t>(std::ceil(std::log(2.0 * n / delta) / (2.0 * epsilon * epsilon)));
+
+  rmm::device_uvector<vertex_t> sources(0, handle.get_stream());
+  if (num_samples >= static_cast<size_t>(num_vertices)) {
+    sources = detail::gather_sources(
+      handle, graph_view, static_cast<vertex_t const *>(nullptr), size_t{0});
+  } else {
+    sources.resize(num_samples, handle.get_stream());
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(num_samples),
+                      sources.begin(),
+                      detail::sample_source_t<vertex_t>{seed, num_vertices});
+  }
+  detail::closeness_centrality(handle, graph_view, sources, centralities, wf_improved);
+
+  return sources.size();
+}
+
+// explicit instantiation
+
+#define INSTANTIATE_BETWEENNESS_CENTRALITY(vertex_t, edge_t, weight_t, multi_gpu)             \
+  template void betweenness_centrality(                                                     \
+    raft::handle_t const &handle,                                                           \
+    graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,           \
+    vertex_t const *sources,                                                                \
+    size_t num_sources,                                                                     \
+    weight_t *centralities,                                                                 \
+    bool normalized,                                                                        \
+    bool endpoints,                                                                         \
+    bool weighted,                                                                          \
+    bool do_expensive_check);                                                               \
+  template void edge_betweenness_centrality(                                                \
+    raft::handle_t const &handle,                                                           \
+    graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,           \
+    vertex_t const *sources,                                                                \
+    size_t num_sources,                                                                     \
+    weight_t *centralities,                                                                 \
+    bool normalized,                                                                        \
+    bool weighted,                                                                          \
+    bool do_expensive_check);                                                               \
+  template size_t approximate_betweenness_centrality(                                       \
+    raft::handle_t const &handle,                                                           \
+    graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,           \
+    weight_t *centralities,                                                                 \
+    double epsilon,                                                                         \
+    double delta,                                                                           \
+    uint64_t seed,                                                                          \
+    bool normalized,                                                                        \
+    bool endpoints,                                                                         \
+    bool weighted,                                                                          \
+    bool do_expensive_check);                                                               \
+  template void closeness_centrality(                                                       \
+    raft::handle_t const &handle,                                                           \
+    graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,           \
+    vertex_t const *sources,                                                                \
+    size_t num_sources,                                                                     \
+    weight_t *centralities,                                                                 \
+    bool wf_improved);                                                                      \
+  template size_t approximate_closeness_centrality(                                         \
+    raft::handle_t const &handle,                                                           \
+    graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,           \
+    weight_t *centralities,                                                                 \
+    double epsilon,                                                                         \
+    double delta,                                                                           \
+    uint64_t seed,                                                                          \
+    bool wf_improved);
+
+INSTANTIATE_BETWEENNESS_CENTRALITY(int32_t, int32_t, float, true)
+INSTANTIATE_BETWEENNESS_CENTRALITY(int32_t, int32_t, double, true)
+INSTANTIATE_BETWEENNESS_CENTRALITY(int32_t, int64_t, float, true)
+INSTANTIATE_BETWEENNESS_CENTRALITY(int32_t, int64_t, double, true)
+INSTANTIATE_BETWEENNESS_CENTRALITY(int64_t, int64_t, float, true)
+INSTANTIATE_BETWEENNESS_CENTRALITY(int64_t, int64_t, double, true)
+INSTANTIATE_BETWEENNESS_CENTRALITY(int32_t, int32_t, float, false)
+INSTANTIATE_BETWEENNESS_CENTRALITY(int32_t, int32_t, double, false)
+INSTANTIATE_BETWEENNESS_CENTRALITY(int32_t, int64_t, float, false)
+INSTANTIATE_BETWEENNESS_CENTRALITY(int32_t, int64_t, double, false)
+INSTANTIATE_BETWEENNESS_CENTRALITY(int64_t, int64_t, float, false)
+INSTANTIATE_BETWEENNESS_CENTRALITY(int64_t, int64_t, double, false)
+
+}  // namespace experimental
+}  // namespace cugraph
@@ -16,30 +16,235 @@
 
 #include <algorithms.hpp>
 #include <experimental/graph_view.hpp>
+#include <matrix_partition_device.cuh>
+#include <partition_manager.hpp>
+#include <patterns/copy_to_adj_matrix_row_col.cuh>
 #include <patterns/reduce_op.cuh>
 #include <patterns/update_frontier_v_push_if_out_nbr.cuh>
 #include <patterns/vertex_frontier.cuh>
+#include <utilities/device_comm.cuh>
 #include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+#include <utilities/profiling.hpp>
 #include <vertex_partition_device.cuh>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <raft/handle.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/count.h>
 #include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
 
 #include <limits>
+#include <tuple>
 #include <type_traits>
+#include <vector>
 
 namespace cugraph {
 namespace experimental {
 namespace detail {
 
+// FIXME: block size requires tuning
+int32_t constexpr bfs_bottom_up_block_size = 128;
+
+// FIXME: these values require tuning, the default values are from S. Beamer et. al.,
+// "Direction-optimizing breadth-first search", 2012.
+double constexpr direction_optimizing_alpha = 14.0;
+double constexpr direction_optimizing_beta  = 24.0;
+
+// Each thread takes one (unvisited) major vertex and scans its neighbors until it finds a neighbor
+// in the current frontier (i.e. a neighbor with the distance == depth). The graph is symmetric, so
+// out-going neighbors are also in-coming neighbors.
+// FIXME: This is inefficient for high-degree vertices that do not have a neighbor in the current
+// frontier. Unvisited high-degree vertices are rare after the first few BFS iterations (and bottom
+// up steps are used only once the frontier becomes large), but we may consider warp/block level
+// processing for the high-degree segments.
+template <typename GraphViewType,
+          typename AdjMatrixRowDistanceIterator,
+          typename AdjMatrixColDistanceIterator,
+          typename ParentOutputIterator>
+__global__ void for_all_unvisited_major_find_frontier_nbr(
+  matrix_partition_device_t<GraphViewType> matrix_partition,
+  AdjMatrixRowDistanceIterator adj_matrix_row_distance_first,
+  AdjMatrixColDistanceIterator adj_matrix_col_distance_first,
+  ParentOutputIterator parent_output_first,
+  typename GraphViewType::vertex_type depth)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto constexpr invalid_distance = std::numeric_limits<vertex_t>::max();
+  auto constexpr no_parent        = std::numeric_limits<vertex_t>::max();
+
+  auto const tid = threadIdx.x + blockIdx.x * blockDim.x;
+  auto idx       = static_cast<size_t>(tid);
+
+  while (idx < static_cast<size_t>(matrix_partition.get_major_size())) {
+    auto parent = no_parent;
+    if (*(adj_matrix_row_distance_first + idx) == invalid_distance) {
+      minor_index_iterator_t<vertex_t, edge_t> indices{};
+      weight_t const* weights{nullptr};
+      edge_t local_degree{};
+      thrust::tie(indices, weights, local_degree) =
+        matrix_partition.get_local_edges(static_cast<vertex_t>(idx));
+      for (edge_t i = 0; i < local_degree; ++i) {
+        auto minor        = indices[i];
+        auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
+        if (*(adj_matrix_col_distance_first + minor_offset) == depth) {
+          parent = minor;
+          break;
+        }
+      }
+    }
+    *(parent_output_first + idx) = parent;
+    idx += gridDim.x * blockDim.x;
+  }
+}
+
+// pull based BFS step, find a parent in the current frontier for every unvisited vertex, update
+// distances & predecessors of the newly discovered vertices, and append them to the frontier bucket
+template <typename GraphViewType, typename PredecessorIterator, typename BucketType>
+void bfs_bottom_up_step(raft::handle_t const &handle,
+                        GraphViewType const &push_graph_view,
+                        typename GraphViewType::vertex_type *distances,
+                        PredecessorIterator predecessor_first,
+                        typename GraphViewType::vertex_type depth,
+                        BucketType &bucket)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto constexpr no_parent = std::numeric_limits<vertex_t>::max();
+
+  rmm::device_uvector<vertex_t> parents(push_graph_view.get_number_of_local_vertices(),
+                                        handle.get_stream());
+
+  if (GraphViewType::is_multi_gpu) {
+    auto &col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+
+    rmm::device_uvector<vertex_t> adj_matrix_row_distances(
+      push_graph_view.get_number_of_local_adj_matrix_partition_rows(), handle.get_stream());
+    rmm::device_uvector<vertex_t> adj_matrix_col_distances(
+      push_graph_view.get_number_of_local_adj_matrix_partition_cols(), handle.get_stream());
+    copy_to_adj_matrix_row(handle, push_graph_view, distances, adj_matrix_row_distances.begin());
+    copy_to_adj_matrix_col(handle, push_graph_view, distances, adj_matrix_col_distances.begin());
+
+    for (size_t i = 0; i < push_graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      matrix_partition_device_t<GraphViewType> matrix_partition(push_graph_view, i);
+
+      rmm::device_uvector<vertex_t> major_parents(matrix_partition.get_major_size(),
+                                                  handle.get_stream());
+      if (matrix_partition.get_major_size() > 0) {
+        raft::grid_1d_thread_t bottom_up_grid(matrix_partition.get_major_size(),
+                                              bfs_bottom_up_block_size,
+                                              handle.get_device_properties().maxGridSize[0]);
+        for_all_unvisited_major_find_frontier_nbr<<<bottom_up_grid.num_blocks,
+                                                    bottom_up_grid.block_size,
+                                                    0,
+                                                    handle.get_stream()>>>(
+          matrix_partition,
+          adj_matrix_row_distances.begin() + matrix_partition.get_major_value_start_offset(),
+          adj_matrix_col_distances.begin(),
+          major_parents.begin(),
+          depth);
+      }
+
+      // every GPU in col_comm holds a different column range of the same rows, any parent found in
+      // any GPU is valid (no_parent is the maximum value, so MIN picks a valid parent if exists)
+      device_reduce(col_comm,
+                    major_parents.begin(),
+                    parents.begin(),
+                    major_parents.size(),
+                    raft::comms::op_t::MIN,
+                    static_cast<int>(i),
+                    handle.get_stream());
+    }
+  } else {
+    matrix_partition_device_t<GraphViewType> matrix_partition(push_graph_view, 0);
+    if (matrix_partition.get_major_size() > 0) {
+      raft::grid_1d_thread_t bottom_up_grid(matrix_partition.get_major_size(),
+                                            bfs_bottom_up_block_size,
+                                            handle.get_device_properties().maxGridSize[0]);
+      for_all_unvisited_major_find_frontier_nbr<<<bottom_up_grid.num_blocks,
+                                                  bottom_up_grid.block_size,
+                                                  0,
+                                                  handle.get_stream()>>>(
+        matrix_partition, distances, distances, parents.begin(), depth);
+    }
+  }
+
+  thrust::for_each(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    thrust::make_counting_iterator(vertex_t{0}),
+    thrust::make_counting_iterator(push_graph_view.get_number_of_local_vertices()),
+    [parents = parents.data(), distances, predecessor_first, depth] __device__(auto i) {
+      auto parent = parents[i];
+      if (parent != no_parent) {
+        *(distances + i)         = depth + 1;
+        *(predecessor_first + i) = parent;
+      }
+    });
+
+  auto num_new_vertices =
+    thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     parents.begin(),
+                     parents.end(),
+                     [] __device__(auto parent) { return parent != no_parent; });
+  bucket.reserve(bucket.size() + num_new_vertices);
+  auto new_vertex_last =
+    thrust::copy_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    thrust::make_counting_iterator(push_graph_view.get_local_vertex_first()),
+                    thrust::make_counting_iterator(push_graph_view.get_local_vertex_last()),
+                    parents.begin(),
+                    bucket.end(),
+                    [] __device__(auto parent) { return parent != no_parent; });
+  bucket.set_size(static_cast<size_t>(thrust::distance(bucket.begin(), new_vertex_last)));
+}
+
+// returns the aggregate size of the frontier [vertex_first, vertex_last) and (if out_degrees is not
+// nullptr) the aggregate number of the frontier vertices' outgoing edges, in multi-GPU, both are
+// aggregated with a single collective
+template <typename GraphViewType, typename VertexIterator>
+std::tuple<size_t, size_t> aggregate_frontier_size_and_num_edges(
+  raft::handle_t const &handle,
+  GraphViewType const &push_graph_view,
+  VertexIterator vertex_first,
+  VertexIterator vertex_last,
+  typename GraphViewType::edge_type const *out_degrees)
+{
+  std::vector<size_t> aggregates{static_cast<size_t>(thrust::distance(vertex_first, vertex_last)),
+                                 size_t{0}};
+  if (out_degrees != nullptr) {
+    vertex_partition_device_t<GraphViewType> vertex_partition(push_graph_view);
+    aggregates[1] = thrust::transform_reduce(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      vertex_first,
+      vertex_last,
+      [vertex_partition, out_degrees] __device__(auto v) {
+        return static_cast<size_t>(
+          out_degrees[vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v)]);
+      },
+      size_t{0},
+      thrust::plus<size_t>());
+  }
+  if (GraphViewType::is_multi_gpu) {
+    aggregates = host_scalar_allreduce(handle.get_comms(), aggregates, handle.get_stream());
+  }
+  return std::make_tuple(aggregates[0], aggregates[1]);
+}
+
 template <typename GraphViewType, typename PredecessorIterator>
 void bfs(raft::handle_t const &handle,
          GraphViewType const &push_graph_view,
@@ -51,12 +256,15 @@ void bfs(raft::handle_t const &handle,
          bool do_expensive_check)
 {
   using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
 
   static_assert(std::is_integral<vertex_t>::value,
                 "GraphViewType::vertex_type should be integral.");
   static_assert(!GraphViewType::is_adj_matrix_transposed,
                 "GraphViewType should support the push model.");
 
+  profile_range_t profile_range(handle, "bfs");
+
   auto const num_vertices = push_graph_view.get_number_of_vertices();
   if (num_vertices == 0) { return; }
 
@@ -102,19 +310,61 @@ void bfs(raft::handle_t const &handle,
 
   // 4. BFS iteration
 
+  rmm::device_uvector<edge_t> out_degrees(0, handle.get_stream());
+  edge_t num_unexplored_edges{0};  // m_u in Beamer's paper, relevant only if direction_optimizing
+  if (direction_optimizing) {
+    out_degrees          = push_graph_view.compute_out_degrees(handle);
+    num_unexplored_edges = push_graph_view.get_number_of_edges();
+  }
+
   vertex_t depth{0};
-  auto cur_local_vertex_frontier_first =
-    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).begin();
-  auto cur_vertex_frontier_aggregate_size =
-    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).aggregate_size();
+  bool top_down{true};
+  // the bucket may grow (and be re-allocated) in every iteration, so we keep offsets (instead of
+  // iterators) to the current frontier
+  size_t cur_local_vertex_frontier_first_offset{0};
+  // the frontier size and the number of the frontier vertices' outgoing edges (relevant only if
+  // direction_optimizing) are aggregated together once per iteration
+  size_t num_frontier_edges{0};           // m_f in Beamer's paper
+  size_t cur_frontier_aggregate_size{0};  // n_f in Beamer's paper
+  std::tie(cur_frontier_aggregate_size, num_frontier_edges) =
+    aggregate_frontier_size_and_num_edges(
+      handle,
+      push_graph_view,
+      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).begin(),
+      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).end(),
+      direction_optimizing ? out_degrees.data() : static_cast<edge_t const *>(nullptr));
+  size_t prev_frontier_aggregate_size{0};
   while (true) {
+    auto cur_local_vertex_frontier_last_offset =
+      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).size();
+    auto cur_local_vertex_frontier_first =
+      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).begin() +
+      cur_local_vertex_frontier_first_offset;
+    auto cur_local_vertex_frontier_last =
+      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).begin() +
+      cur_local_vertex_frontier_last_offset;
+
     if (direction_optimizing) {
-      CUGRAPH_FAIL("unimplemented.");
-    } else {
+      num_unexplored_edges -= static_cast<edge_t>(num_frontier_edges);
+
+      auto growing = cur_frontier_aggregate_size > prev_frontier_aggregate_size;
+      if (top_down) {
+        if (growing && (static_cast<double>(num_frontier_edges) * direction_optimizing_alpha >
+                        static_cast<double>(num_unexplored_edges))) {
+          top_down = false;
+        }
+      } else {
+        if (!growing && (static_cast<double>(cur_frontier_aggregate_size) *
+                           direction_optimizing_beta <
+                         static_cast<double>(num_vertices))) {
+          top_down = true;
+        }
+      }
+    }
+
+    if (top_down) {
       vertex_partition_device_t<GraphViewType> vertex_partition(push_graph_view);
 
-      auto cur_local_vertex_frontier_last =
-        vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).end();
       update_frontier_v_push_if_out_nbr(
         handle,
         push_graph_view,
@@ -141,17 +391,33 @@ void bfs(raft::handle_t const &handle,
                                                  : VertexFrontier<vertex_t>::kInvalidBucketIdx;
           return thrust::make_tuple(idx, thrust::make_tuple(depth + 1, pushed_val));
         });
+    } else {
+      bfs_bottom_up_step(handle,
+                         push_graph_view,
+                         distances,
+                         predecessor_first,
+                         depth,
+                         vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)));
+    }
 
-      auto new_vertex_frontier_aggregate_size =
-        vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).aggregate_size() -
-        cur_vertex_frontier_aggregate_size;
-      if (new_vertex_frontier_aggregate_size == 0) { break; }
+    size_t new_frontier_aggregate_size{0};
+    std::tie(new_frontier_aggregate_size, num_frontier_edges) =
+      aggregate_frontier_size_and_num_edges(
+        handle,
+        push_graph_view,
+        vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).begin() +
+          cur_local_vertex_frontier_last_offset,
+        vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).end(),
+        direction_optimizing ? out_degrees.data() : static_cast<edge_t const *>(nullptr));
+    add_profile_counter("frontier_size", static_cast<int64_t>(new_frontier_aggregate_size));
+    if (new_frontier_aggregate_size == 0) { break; }
 
-      cur_local_vertex_frontier_first = cur_local_vertex_frontier_last;
-      cur_vertex_frontier_aggregate_size += new_vertex_frontier_aggregate_size;
-    }
+    cur_local_vertex_frontier_first_offset = cur_local_vertex_frontier_last_offset;
+    prev_frontier_aggregate_size           = cur_frontier_aggregate_size;
+    cur_frontier_aggregate_size            = new_frontier_aggregate_size;
 
     depth++;
+    add_profile_counter("iterations", 1);
     if (depth >= depth_limit) { break; }
   }
 
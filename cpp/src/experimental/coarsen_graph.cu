@@ -18,6 +18,7 @@
 #include <experimental/graph.hpp>
 #include <experimental/graph_functions.hpp>
 #include <experimental/graph_view.hpp>
+#include <experimental/include_cuco_static_map.cuh>
 #include <patterns/copy_to_adj_matrix_row_col.cuh>
 #include <utilities/error.hpp>
 #include <utilities/shuffle_comm.cuh>
@@ -27,13 +28,18 @@
 #include <rmm/device_uvector.hpp>
 
 #include <thrust/copy.h>
+#include <thrust/count.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/partition.h>
 #include <thrust/scan.h>
 #include <thrust/sort.h>
+#include <thrust/transform.h>
 #include <thrust/tuple.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <iterator>
+#include <limits>
 #include <numeric>
 #include <tuple>
 #include <utility>
@@ -47,15 +53,23 @@ std::
   tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
   compressed_sparse_to_edgelist(edge_t const *compressed_sparse_offsets,
                                 vertex_t const *compressed_sparse_indices,
+                                uint32_t const *compressed_sparse_local_indices,
                                 weight_t const *compressed_sparse_weights,
+                                vertex_t const *dcs_nzd_vertices,
+                                vertex_t dcs_nzd_vertex_count,
                                 vertex_t major_first,
+                                vertex_t major_hypersparse_first,
                                 vertex_t major_last,
+                                vertex_t minor_first,
                                 bool is_weighted,
                                 cudaStream_t stream)
 {
   edge_t number_of_edges{0};
-  raft::update_host(
-    &number_of_edges, compressed_sparse_offsets + (major_last - major_first), 1, stream);
+  raft::update_host(&number_of_edges,
+                    compressed_sparse_offsets +
+                      ((major_hypersparse_first - major_first) + dcs_nzd_vertex_count),
+                    1,
+                    stream);
   CUDA_TRY(cudaStreamSynchronize(stream));
   rmm::device_uvector<vertex_t> edgelist_major_vertices(number_of_edges, stream);
   rmm::device_uvector<vertex_t> edgelist_minor_vertices(number_of_edges, stream);
@@ -66,7 +80,7 @@ std::
   // warp per vertex, and low-degree vertices using one CUDA thread per block
   thrust::for_each(rmm::exec_policy(stream)->on(stream),
                    thrust::make_counting_iterator(major_first),
-                   thrust::make_counting_iterator(major_last),
+                   thrust::make_counting_iterator(major_hypersparse_first),
                    [compressed_sparse_offsets,
                     major_first,
                     p_majors = edgelist_major_vertices.begin()] __device__(auto v) {
@@ -74,10 +88,34 @@ std::
                      auto last  = compressed_sparse_offsets[v - major_first + 1];
                      thrust::fill(thrust::seq, p_majors + first, p_majors + last, v);
                    });
-  thrust::copy(rmm::exec_policy(stream)->on(stream),
-               compressed_sparse_indices,
-               compressed_sparse_indices + number_of_edges,
-               edgelist_minor_vertices.begin());
+  if (dcs_nzd_vertex_count > 0) {
+    thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator(vertex_t{0}),
+                     thrust::make_counting_iterator(dcs_nzd_vertex_count),
+                     [compressed_sparse_offsets,
+                      dcs_nzd_vertices,
+                      dense_size = major_hypersparse_first - major_first,
+                      p_majors   = edgelist_major_vertices.begin()] __device__(auto i) {
+                       auto first = compressed_sparse_offsets[dense_size + i];
+                       auto last  = compressed_sparse_offsets[dense_size + i + 1];
+                       thrust::fill(
+                         thrust::seq, p_majors + first, p_majors + last, dcs_nzd_vertices[i]);
+                     });
+  }
+  if (compressed_sparse_local_indices != nullptr) {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      compressed_sparse_local_indices,
+                      compressed_sparse_local_indices + number_of_edges,
+                      edgelist_minor_vertices.begin(),
+                      [minor_first] __device__(auto local_index) {
+                        return minor_first + static_cast<vertex_t>(local_index);
+                      });
+  } else {
+    thrust::copy(rmm::exec_policy(stream)->on(stream),
+                 compressed_sparse_indices,
+                 compressed_sparse_indices + number_of_edges,
+                 edgelist_minor_vertices.begin());
+  }
   if (is_weighted) {
     thrust::copy(rmm::exec_policy(stream)->on(stream),
                  compressed_sparse_weights,
@@ -142,16 +180,168 @@ edge_t groupby_e_and_coarsen_edgelist(vertex_t *edgelist_major_vertices /* [INOU
   }
 }
 
+// pack (major, minor) pairs of 32 bit vertex IDs to 64 bit hash map keys
+template <typename vertex_t>
+struct pack_edge_t {
+  __device__ uint64_t operator()(thrust::tuple<vertex_t, vertex_t> e) const
+  {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(thrust::get<0>(e))) << 32) |
+           static_cast<uint64_t>(static_cast<uint32_t>(thrust::get<1>(e)));
+  }
+};
+
+// true if the edges of major should take the sort path (groupby_e_and_coarsen_edgelist) only;
+// false for majors with degree >= mid_degree_threshold, whose edges are pre-aggregated with
+// hashing first. Majors in the hypersparse segment always take the sort path: their degrees are
+// low by construction, and compressed_sparse_offsets is not indexed by major - major_first there.
+template <typename vertex_t, typename edge_t>
+struct is_low_degree_major_t {
+  edge_t const *compressed_sparse_offsets{nullptr};
+  vertex_t major_first{};
+  vertex_t major_hypersparse_first{};
+
+  __device__ bool operator()(vertex_t major) const
+  {
+    return (major >= major_hypersparse_first) ||
+           ((compressed_sparse_offsets[major - major_first + 1] -
+             compressed_sparse_offsets[major - major_first]) <
+            static_cast<edge_t>(mid_degree_threshold));
+  }
+};
+
+template <typename edge_t>
+struct key_index_pair_t {
+  uint64_t const *keys{nullptr};
+
+  __device__ thrust::pair<uint64_t, edge_t> operator()(edge_t i) const
+  {
+    return thrust::make_pair(keys[i], i);
+  }
+};
+
+// hash based alternative to groupby_e_and_coarsen_edgelist; this does not sort the edges but works
+// in linear time and its memory footprint is proportional to the input size (no temporary copies
+// of the edge list), which is preferable for the edges of high-degree majors (many duplicates after
+// relabeling); applicable only if vertex_t is 32 bit (keys should fit in 64 bits), otherwise this
+// function returns number_of_edges without coarsening, the output edge list is compacted to the
+// front of the input
+// FIXME: the order of floating point additions is non-deterministic
+template <typename vertex_t, typename edge_t, typename weight_t>
+edge_t hash_coarsen_edgelist(vertex_t *edgelist_major_vertices /* [INOUT] */,
+                             vertex_t *edgelist_minor_vertices /* [INOUT] */,
+                             weight_t *edgelist_weights /* [INOUT] */,
+                             edge_t number_of_edges,
+                             bool is_weighted,
+                             cudaStream_t stream)
+{
+  if ((sizeof(vertex_t) != sizeof(uint32_t)) || (number_of_edges == 0)) { return number_of_edges; }
+
+#ifdef CUCO_STATIC_MAP_DEFINED
+  double constexpr load_factor = 0.7;
+
+  auto pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(edgelist_major_vertices, edgelist_minor_vertices));
+
+  rmm::device_uvector<uint64_t> keys(number_of_edges, stream);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    pair_first,
+                    pair_first + number_of_edges,
+                    keys.begin(),
+                    pack_edge_t<vertex_t>{});
+
+  // each unique (major, minor) pair is mapped to one of its edge indices (the representative)
+
+  rmm::device_uvector<edge_t> representatives(number_of_edges, stream);
+  {
+    CUDA_TRY(cudaStreamSynchronize(stream));  // cuco::static_map currently does not take stream
+
+    cuco::static_map<uint64_t, edge_t> edge_map{
+      // FIXME: std::max(..., ...) as a temporary workaround for
+      // https://github.com/NVIDIA/cuCollections/issues/72 and
+      // https://github.com/NVIDIA/cuCollections/issues/73
+      std::max(static_cast<size_t>(static_cast<double>(number_of_edges) / load_factor),
+               static_cast<size_t>(number_of_edges) + 1),
+      std::numeric_limits<uint64_t>::max(),
+      invalid_idx<edge_t>::value};
+
+    auto kv_pair_first = thrust::make_transform_iterator(thrust::make_counting_iterator(edge_t{0}),
+                                                         key_index_pair_t<edge_t>{keys.data()});
+    edge_map.insert(kv_pair_first, kv_pair_first + number_of_edges);
+    edge_map.find(keys.begin(), keys.end(), representatives.begin());
+  }
+  keys.resize(0, stream);
+  keys.shrink_to_fit(stream);
+
+  if (is_weighted) {
+    thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator(edge_t{0}),
+                     thrust::make_counting_iterator(number_of_edges),
+                     [edgelist_weights, representatives = representatives.data()] __device__(
+                       auto i) {
+                       auto r = representatives[i];
+                       if (r != i) { atomicAdd(edgelist_weights + r, edgelist_weights[i]); }
+                     });
+  }
+
+  auto is_representative = [representatives = representatives.data()] __device__(auto i) {
+    return representatives[i] == i;
+  };
+  auto ret = static_cast<edge_t>(thrust::count_if(rmm::exec_policy(stream)->on(stream),
+                                                  thrust::make_counting_iterator(edge_t{0}),
+                                                  thrust::make_counting_iterator(number_of_edges),
+                                                  is_representative));
+
+  rmm::device_uvector<vertex_t> tmp_edgelist_major_vertices(ret, stream);
+  rmm::device_uvector<vertex_t> tmp_edgelist_minor_vertices(ret, stream);
+  rmm::device_uvector<weight_t> tmp_edgelist_weights(is_weighted ? ret : edge_t{0}, stream);
+  if (is_weighted) {
+    auto edge_first = thrust::make_zip_iterator(
+      thrust::make_tuple(edgelist_major_vertices, edgelist_minor_vertices, edgelist_weights));
+    auto tmp_edge_first =
+      thrust::make_zip_iterator(thrust::make_tuple(tmp_edgelist_major_vertices.begin(),
+                                                   tmp_edgelist_minor_vertices.begin(),
+                                                   tmp_edgelist_weights.begin()));
+    thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                    edge_first,
+                    edge_first + number_of_edges,
+                    thrust::make_counting_iterator(edge_t{0}),
+                    tmp_edge_first,
+                    is_representative);
+    thrust::copy(
+      rmm::exec_policy(stream)->on(stream), tmp_edge_first, tmp_edge_first + ret, edge_first);
+  } else {
+    auto tmp_pair_first = thrust::make_zip_iterator(thrust::make_tuple(
+      tmp_edgelist_major_vertices.begin(), tmp_edgelist_minor_vertices.begin()));
+    thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                    pair_first,
+                    pair_first + number_of_edges,
+                    thrust::make_counting_iterator(edge_t{0}),
+                    tmp_pair_first,
+                    is_representative);
+    thrust::copy(
+      rmm::exec_policy(stream)->on(stream), tmp_pair_first, tmp_pair_first + ret, pair_first);
+  }
+
+  return ret;
+#else
+  return number_of_edges;
+#endif
+}
+
 template <typename vertex_t, typename edge_t, typename weight_t>
 std::
   tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
   compressed_sparse_to_relabeled_and_grouped_and_coarsened_edgelist(
     edge_t const *compressed_sparse_offsets,
     vertex_t const *compressed_sparse_indices,
+    uint32_t const *compressed_sparse_local_indices,
     weight_t const *compressed_sparse_weights,
+    vertex_t const *dcs_nzd_vertices,
+    vertex_t dcs_nzd_vertex_count,
     vertex_t const *p_major_labels,
     vertex_t const *p_minor_labels,
     vertex_t major_first,
+    vertex_t major_hypersparse_first,
     vertex_t major_last,
     vertex_t minor_first,
     vertex_t minor_last,
@@ -167,12 +357,57 @@ std::
   std::tie(edgelist_major_vertices, edgelist_minor_vertices, edgelist_weights) =
     compressed_sparse_to_edgelist(compressed_sparse_offsets,
                                   compressed_sparse_indices,
+                                  compressed_sparse_local_indices,
                                   compressed_sparse_weights,
+                                  dcs_nzd_vertices,
+                                  dcs_nzd_vertex_count,
                                   major_first,
+                                  major_hypersparse_first,
                                   major_last,
+                                  minor_first,
                                   is_weighted,
                                   stream);
 
+  // move the edges of high-degree majors (degree >= mid_degree_threshold, excluding the
+  // hypersparse segment) to the end; these edges are pre-aggregated with hashing before sorting
+  // the entire edge list
+
+  edge_t number_of_high_degree_edges{0};
+  if (sizeof(vertex_t) == sizeof(uint32_t)) {
+    is_low_degree_major_t<vertex_t, edge_t> is_low_degree_major{
+      compressed_sparse_offsets, major_first, major_hypersparse_first};
+    auto number_of_low_degree_edges = edgelist_major_vertices.size();
+    if (is_weighted) {
+      auto edge_first =
+        thrust::make_zip_iterator(thrust::make_tuple(edgelist_major_vertices.begin(),
+                                                     edgelist_minor_vertices.begin(),
+                                                     edgelist_weights.begin()));
+      number_of_low_degree_edges = static_cast<size_t>(thrust::distance(
+        edge_first,
+        thrust::stable_partition(
+          rmm::exec_policy(stream)->on(stream),
+          edge_first,
+          edge_first + edgelist_major_vertices.size(),
+          [is_low_degree_major] __device__(auto e) {
+            return is_low_degree_major(thrust::get<0>(e));
+          })));
+    } else {
+      auto pair_first = thrust::make_zip_iterator(
+        thrust::make_tuple(edgelist_major_vertices.begin(), edgelist_minor_vertices.begin()));
+      number_of_low_degree_edges = static_cast<size_t>(thrust::distance(
+        pair_first,
+        thrust::stable_partition(
+          rmm::exec_policy(stream)->on(stream),
+          pair_first,
+          pair_first + edgelist_major_vertices.size(),
+          [is_low_degree_major] __device__(auto e) {
+            return is_low_degree_major(thrust::get<0>(e));
+          })));
+    }
+    number_of_high_degree_edges =
+      static_cast<edge_t>(edgelist_major_vertices.size() - number_of_low_degree_edges);
+  }
+
   auto pair_first = thrust::make_zip_iterator(
     thrust::make_tuple(edgelist_major_vertices.begin(), edgelist_minor_vertices.begin()));
   thrust::transform(
@@ -185,13 +420,26 @@ std::
                                 p_minor_labels[thrust::get<1>(val) - minor_first]);
     });
 
-  auto number_of_edges =
-    groupby_e_and_coarsen_edgelist(edgelist_major_vertices.data(),
-                                   edgelist_minor_vertices.data(),
-                                   edgelist_weights.data(),
-                                   static_cast<edge_t>(edgelist_major_vertices.size()),
-                                   is_weighted,
-                                   stream);
+  auto number_of_edges = static_cast<edge_t>(edgelist_major_vertices.size());
+  if (number_of_high_degree_edges > 0) {
+    auto number_of_low_degree_edges = number_of_edges - number_of_high_degree_edges;
+    number_of_edges =
+      number_of_low_degree_edges +
+      hash_coarsen_edgelist(edgelist_major_vertices.data() + number_of_low_degree_edges,
+                            edgelist_minor_vertices.data() + number_of_low_degree_edges,
+                            is_weighted ? edgelist_weights.data() + number_of_low_degree_edges
+                                        : static_cast<weight_t *>(nullptr),
+                            number_of_high_degree_edges,
+                            is_weighted,
+                            stream);
+  }
+
+  number_of_edges = groupby_e_and_coarsen_edgelist(edgelist_major_vertices.data(),
+                                                   edgelist_minor_vertices.data(),
+                                                   edgelist_weights.data(),
+                                                   number_of_edges,
+                                                   is_weighted,
+                                                   stream);
   edgelist_major_vertices.resize(number_of_edges, stream);
   edgelist_major_vertices.shrink_to_fit(stream);
   edgelist_minor_vertices.resize(number_of_edges, stream);
@@ -262,10 +510,16 @@ coarsen_graph(
       coarsened_edgelist_weights.emplace_back(0, handle.get_stream());
     }
   }
-  // FIXME: we may compare performance/memory footprint with the hash_based approach especially when
-  // cuco::dynamic_map becomes available (so we don't need to preallocate memory assuming the worst
-  // case). We may be able to limit the memory requirement close to the final coarsened edgelist
-  // with the hash based approach.
+  std::vector<std::vector<rmm::device_uvector<vertex_t>>> coarsened_edgelist_chunk_major_vertices(
+    coarsened_edgelist_major_vertices.size());
+  std::vector<std::vector<rmm::device_uvector<vertex_t>>> coarsened_edgelist_chunk_minor_vertices(
+    coarsened_edgelist_major_vertices.size());
+  std::vector<std::vector<rmm::device_uvector<weight_t>>> coarsened_edgelist_chunk_weights(
+    coarsened_edgelist_major_vertices.size());
+  // FIXME: the edges of high-degree majors are pre-aggregated with the hash based approach (see
+  // compressed_sparse_to_relabeled_and_grouped_and_coarsened_edgelist); we may extend this to the
+  // entire edge list when cuco::dynamic_map becomes available (so we don't need to preallocate
+  // memory assuming the worst case).
   for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
     // 1-1. locally construct coarsened edge list
 
@@ -293,11 +547,15 @@ coarsen_graph(
       compressed_sparse_to_relabeled_and_grouped_and_coarsened_edgelist(
         graph_view.offsets(i),
         graph_view.indices(i),
+        graph_view.local_indices(i),
         graph_view.weights(i),
+        graph_view.dcs_nzd_vertices(i),
+        graph_view.get_local_adj_matrix_partition_dcs_nzd_vertex_count(i),
         major_labels.data(),
         adj_matrix_minor_labels.data(),
         store_transposed ? graph_view.get_local_adj_matrix_partition_col_first(i)
                          : graph_view.get_local_adj_matrix_partition_row_first(i),
+        graph_view.get_local_adj_matrix_partition_major_hypersparse_first(i),
         store_transposed ? graph_view.get_local_adj_matrix_partition_col_last(i)
                          : graph_view.get_local_adj_matrix_partition_row_last(i),
         store_transposed ? graph_view.get_local_adj_matrix_partition_row_first(i)
@@ -398,45 +656,76 @@ coarsen_graph(
         graph_view.is_weighted(),
         handle.get_stream());
 
-      auto cur_size = coarsened_edgelist_major_vertices[j].size();
-      // FIXME: this can lead to frequent costly reallocation; we may be able to avoid this if we
-      // can reserve address space to avoid expensive reallocation.
-      // https://devblogs.nvidia.com/introducing-low-level-gpu-virtual-memory-management
-      coarsened_edgelist_major_vertices[j].resize(cur_size + number_of_partition_edges,
-                                                  handle.get_stream());
-      coarsened_edgelist_minor_vertices[j].resize(coarsened_edgelist_major_vertices[j].size(),
-                                                  handle.get_stream());
+      // store the coarsened edges per (local adjacency matrix partition, step) and concatenate
+      // once after the loop (instead of growing the per-partition buffers in every step)
+      rmm::device_uvector<vertex_t> chunk_major_vertices(number_of_partition_edges,
+                                                         handle.get_stream());
+      rmm::device_uvector<vertex_t> chunk_minor_vertices(number_of_partition_edges,
+                                                         handle.get_stream());
+      rmm::device_uvector<weight_t> chunk_weights(
+        graph_view.is_weighted() ? number_of_partition_edges : edge_t{0}, handle.get_stream());
       if (graph_view.is_weighted()) {
-        coarsened_edgelist_weights[j].resize(coarsened_edgelist_major_vertices[j].size(),
-                                             handle.get_stream());
-
         auto src_edge_first =
           thrust::make_zip_iterator(thrust::make_tuple(edgelist_major_vertices.begin(),
                                                        edgelist_minor_vertices.begin(),
                                                        edgelist_weights.begin())) +
           h_displacements[j];
-        auto dst_edge_first =
-          thrust::make_zip_iterator(thrust::make_tuple(coarsened_edgelist_major_vertices[j].begin(),
-                                                       coarsened_edgelist_minor_vertices[j].begin(),
-                                                       coarsened_edgelist_weights[j].begin())) +
-          cur_size;
         thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
                      src_edge_first,
                      src_edge_first + number_of_partition_edges,
-                     dst_edge_first);
+                     thrust::make_zip_iterator(thrust::make_tuple(chunk_major_vertices.begin(),
+                                                                  chunk_minor_vertices.begin(),
+                                                                  chunk_weights.begin())));
       } else {
         auto src_edge_first = thrust::make_zip_iterator(thrust::make_tuple(
                                 edgelist_major_vertices.begin(), edgelist_minor_vertices.begin())) +
                               h_displacements[j];
-        auto dst_edge_first = thrust::make_zip_iterator(
-                                thrust::make_tuple(coarsened_edgelist_major_vertices[j].begin(),
-                                                   coarsened_edgelist_minor_vertices[j].begin())) +
-                              cur_size;
         thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
                      src_edge_first,
-                     src_edge_first + edgelist_major_vertices.size(),
-                     dst_edge_first);
+                     src_edge_first + number_of_partition_edges,
+                     thrust::make_zip_iterator(thrust::make_tuple(chunk_major_vertices.begin(),
+                                                                  chunk_minor_vertices.begin())));
       }
+      coarsened_edgelist_chunk_major_vertices[j].push_back(std::move(chunk_major_vertices));
+      coarsened_edgelist_chunk_minor_vertices[j].push_back(std::move(chunk_minor_vertices));
+      coarsened_edgelist_chunk_weights[j].push_back(std::move(chunk_weights));
+    }
+  }
+
+  for (size_t i = 0; i < coarsened_edgelist_major_vertices.size(); ++i) {
+    size_t number_of_partition_edges{0};
+    for (size_t j = 0; j < coarsened_edgelist_chunk_major_vertices[i].size(); ++j) {
+      number_of_partition_edges += coarsened_edgelist_chunk_major_vertices[i][j].size();
+    }
+    coarsened_edgelist_major_vertices[i].resize(number_of_partition_edges, handle.get_stream());
+    coarsened_edgelist_minor_vertices[i].resize(number_of_partition_edges, handle.get_stream());
+    if (graph_view.is_weighted()) {
+      coarsened_edgelist_weights[i].resize(number_of_partition_edges, handle.get_stream());
+    }
+    size_t offset{0};
+    for (size_t j = 0; j < coarsened_edgelist_chunk_major_vertices[i].size(); ++j) {
+      auto chunk_size = coarsened_edgelist_chunk_major_vertices[i][j].size();
+      thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   coarsened_edgelist_chunk_major_vertices[i][j].begin(),
+                   coarsened_edgelist_chunk_major_vertices[i][j].end(),
+                   coarsened_edgelist_major_vertices[i].begin() + offset);
+      thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   coarsened_edgelist_chunk_minor_vertices[i][j].begin(),
+                   coarsened_edgelist_chunk_minor_vertices[i][j].end(),
+                   coarsened_edgelist_minor_vertices[i].begin() + offset);
+      if (graph_view.is_weighted()) {
+        thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     coarsened_edgelist_chunk_weights[i][j].begin(),
+                     coarsened_edgelist_chunk_weights[i][j].end(),
+                     coarsened_edgelist_weights[i].begin() + offset);
+      }
+      offset += chunk_size;
+      coarsened_edgelist_chunk_major_vertices[i][j].resize(0, handle.get_stream());
+      coarsened_edgelist_chunk_major_vertices[i][j].shrink_to_fit(handle.get_stream());
+      coarsened_edgelist_chunk_minor_vertices[i][j].resize(0, handle.get_stream());
+      coarsened_edgelist_chunk_minor_vertices[i][j].shrink_to_fit(handle.get_stream());
+      coarsened_edgelist_chunk_weights[i][j].resize(0, handle.get_stream());
+      coarsened_edgelist_chunk_weights[i][j].shrink_to_fit(handle.get_stream());
     }
   }
 
@@ -582,11 +871,15 @@ coarsen_graph(
     compressed_sparse_to_relabeled_and_grouped_and_coarsened_edgelist(
       graph_view.offsets(),
       graph_view.indices(),
+      static_cast<uint32_t const *>(nullptr),
       graph_view.weights(),
+      static_cast<vertex_t const *>(nullptr),
+      vertex_t{0},
       labels,
       labels,
       vertex_t{0},
       graph_view.get_number_of_vertices(),
+      graph_view.get_number_of_vertices(),
       vertex_t{0},
       graph_view.get_number_of_vertices(),
       graph_view.is_weighted(),
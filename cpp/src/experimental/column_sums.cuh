@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <utilities/device_comm.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+
+namespace cugraph {
+namespace experimental {
+namespace detail {
+
+// maps an index to a row-major (vertex-major) dense block of num_columns vertex property vectors
+// in the column-major order (to compute per-column reductions with thrust::reduce_by_key)
+template <typename vertex_t>
+struct column_major_to_column_t {
+  vertex_t num_rows{};
+
+  __host__ __device__ size_t operator()(size_t i) const { return i / num_rows; }
+};
+
+// compute the per-column sums of a (local) row-major dense block (aggregated over the GPUs in
+// multi-GPU)
+template <bool multi_gpu, typename vertex_t, typename result_t, typename ColumnMajorValueOp>
+rmm::device_uvector<result_t> compute_column_sums(raft::handle_t const& handle,
+                                                  vertex_t num_rows,
+                                                  size_t num_columns,
+                                                  ColumnMajorValueOp value_op)
+{
+  rmm::device_uvector<result_t> sums(num_columns, handle.get_stream());
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               sums.begin(),
+               sums.end(),
+               result_t{0.0});
+  if (num_rows > 0) {
+    thrust::reduce_by_key(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_transform_iterator(thrust::make_counting_iterator(size_t{0}),
+                                      column_major_to_column_t<vertex_t>{num_rows}),
+      thrust::make_transform_iterator(
+        thrust::make_counting_iterator(static_cast<size_t>(num_rows) * num_columns),
+        column_major_to_column_t<vertex_t>{num_rows}),
+      thrust::make_transform_iterator(thrust::make_counting_iterator(size_t{0}), value_op),
+      thrust::make_discard_iterator(),
+      sums.begin());
+  }
+  if (multi_gpu) {
+    device_allreduce(handle.get_comms(),
+                     sums.begin(),
+                     sums.begin(),
+                     sums.size(),
+                     raft::comms::op_t::SUM,
+                     handle.get_stream());
+  }
+  return sums;
+}
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cugraph
@@ -0,0 +1,427 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithms.hpp>
+#include <experimental/graph_view.hpp>
+#include <matrix_partition_device.cuh>
+#include <patterns/copy_to_adj_matrix_row_col.cuh>
+#include <patterns/count_if_e.cuh>
+#include <patterns/reduce_op.cuh>
+#include <patterns/update_frontier_v_push_if_out_nbr.cuh>
+#include <patterns/vertex_frontier.cuh>
+#include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+#include <vertex_partition_device.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+namespace detail {
+
+// write the local edges of a matrix partition as (major, minor, weight) triplets, edges with an
+// end point of core number smaller than k are marked by an invalid major vertex ID
+template <typename GraphViewType>
+struct decompress_k_core_edges_t {
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  matrix_partition_device_t<GraphViewType> matrix_partition;
+  edge_t const *major_core_numbers{nullptr};
+  edge_t const *minor_core_numbers{nullptr};
+  edge_t k{0};
+  vertex_t *majors{nullptr};
+  vertex_t *minors{nullptr};
+  weight_t *weights{nullptr};  // nullptr if unweighted
+
+  __device__ void operator()(vertex_t major_offset) const
+  {
+    auto local_offset  = matrix_partition.get_local_offset(major_offset);
+    auto local_degree  = matrix_partition.get_local_degree(major_offset);
+    auto major         = matrix_partition.get_major_from_major_offset_nocheck(major_offset);
+    auto major_in_core = major_core_numbers[major_offset] >= k;
+    for (edge_t i = 0; i < local_degree; ++i) {
+      auto minor = matrix_partition.get_minor_nocheck(local_offset + i);
+      auto in_core =
+        major_in_core &&
+        (minor_core_numbers[matrix_partition.get_minor_offset_from_minor_nocheck(minor)] >= k);
+      majors[local_offset + i] = in_core ? major : invalid_vertex_id<vertex_t>::value;
+      minors[local_offset + i] = minor;
+      if (weights != nullptr) {
+        weights[local_offset + i] = matrix_partition.get_weights()[local_offset + i];
+      }
+    }
+  }
+};
+
+template <typename GraphViewType>
+void core_number(raft::handle_t const &handle,
+                 GraphViewType const &push_graph_view,
+                 typename GraphViewType::edge_type *core_numbers,
+                 bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  // implements the bucket-based peeling (Batagelj & Zaversnik, "An O(m) algorithm for cores
+  // decomposition of networks," 2003) on a vertex frontier; the vertices peeled at level k are
+  // pushed to their neighbors in bulk, so this takes one frontier update per peeling step (instead
+  // of one per vertex) and needs no global ordering of the vertices by degree
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(push_graph_view.is_symmetric(),
+                  "Invalid input argument: input graph should be symmetric for core number.");
+
+  if (do_expensive_check) {
+    auto num_self_loops = count_if_e(
+      handle,
+      push_graph_view,
+      thrust::make_constant_iterator(0) /* dummy */,
+      thrust::make_constant_iterator(0) /* dummy */,
+      [] __device__(vertex_t src, vertex_t dst, auto src_val, auto dst_val) { return src == dst; });
+    CUGRAPH_EXPECTS(num_self_loops == 0,
+                    "Invalid input argument: input graph should not have self-loops.");
+    // FIXME: check whether the graph is really symmetric (the graph property is not verified)
+  }
+
+  auto num_remaining_vertices = static_cast<size_t>(push_graph_view.get_number_of_vertices());
+  if (num_remaining_vertices == 0) { return; }
+
+  // 2. initialize core numbers to vertex degrees (core numbers hold remaining degrees until the
+  // vertices are peeled)
+
+  auto degrees = push_graph_view.compute_out_degrees(handle);
+  thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               degrees.begin(),
+               degrees.end(),
+               core_numbers);
+  degrees.resize(0, handle.get_stream());
+  degrees.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<uint8_t> peeled(push_graph_view.get_number_of_local_vertices(),
+                                      handle.get_stream());
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               peeled.begin(),
+               peeled.end(),
+               uint8_t{0});
+
+  // 3. initialize the peeling frontier
+
+  // the updated bucket collects the vertices with decremented degrees that stay above the current
+  // level (update_frontier_v_push_if_out_nbr writes vertex values only for the vertices inserted
+  // to a bucket), this bucket is never visited and cleared after every peeling step
+  enum class Bucket { cur, next, updated, num_buckets };
+  // FIXME: initial bucket capacities require tuning
+  std::vector<size_t> bucket_sizes(
+    static_cast<size_t>(Bucket::num_buckets),
+    std::min(push_graph_view.get_number_of_local_vertices(), vertex_t{1024}));
+  VertexFrontier<vertex_t, GraphViewType::is_multi_gpu, static_cast<size_t>(Bucket::num_buckets)>
+    vertex_frontier(handle, bucket_sizes);
+
+  vertex_partition_device_t<GraphViewType> vertex_partition(push_graph_view);
+
+  // 4. peel
+
+  auto val_first = thrust::make_zip_iterator(thrust::make_tuple(core_numbers, peeled.begin()));
+  edge_t k{0};
+  while (num_remaining_vertices > 0) {
+    // move to the next non-empty level (every remaining vertex has a remaining degree larger than
+    // the previous level)
+
+    k = thrust::transform_reduce(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      val_first,
+      val_first + push_graph_view.get_number_of_local_vertices(),
+      [] __device__(auto val) {
+        return thrust::get<1>(val) ? std::numeric_limits<edge_t>::max() : thrust::get<0>(val);
+      },
+      std::numeric_limits<edge_t>::max(),
+      thrust::minimum<edge_t>());
+    if (GraphViewType::is_multi_gpu) {
+      k = host_scalar_allreduce(handle.get_comms(), k, raft::comms::op_t::MIN, handle.get_stream());
+    }
+
+    auto &cur_bucket = vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur));
+    auto pred        = [k] __device__(auto val) {
+      return (thrust::get<1>(val) == uint8_t{0}) && (thrust::get<0>(val) <= k);
+    };
+    auto num_inserts = static_cast<size_t>(
+      thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                       val_first,
+                       val_first + push_graph_view.get_number_of_local_vertices(),
+                       pred));
+    cur_bucket.reserve(cur_bucket.size() + num_inserts);
+    thrust::copy_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    thrust::make_counting_iterator(push_graph_view.get_local_vertex_first()),
+                    thrust::make_counting_iterator(push_graph_view.get_local_vertex_last()),
+                    val_first,
+                    cur_bucket.end(),
+                    pred);
+    cur_bucket.set_size(cur_bucket.size() + num_inserts);
+
+    while (true) {
+      auto aggregate_frontier_size =
+        vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).aggregate_size();
+      if (aggregate_frontier_size == 0) { break; }
+      num_remaining_vertices -= aggregate_frontier_size;
+
+      thrust::for_each(
+        rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+        vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).begin(),
+        vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).end(),
+        [vertex_partition, core_numbers, peeled = peeled.data(), k] __device__(auto v) {
+          auto v_offset          = vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v);
+          core_numbers[v_offset] = k;
+          peeled[v_offset]       = uint8_t{1};
+        });
+
+      update_frontier_v_push_if_out_nbr(
+        handle,
+        push_graph_view,
+        vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).begin(),
+        vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).end(),
+        thrust::make_constant_iterator(0) /* dummy */,
+        thrust::make_constant_iterator(0) /* dummy */,
+        [vertex_partition, peeled = peeled.data()] __device__(
+          vertex_t src, vertex_t dst, auto src_val, auto dst_val) {
+          auto push = true;
+          if (vertex_partition.is_local_vertex_nocheck(dst)) {
+            push = peeled[vertex_partition.get_local_vertex_offset_from_vertex_nocheck(dst)] ==
+                   uint8_t{0};
+          }
+          return thrust::make_tuple(push, edge_t{1});
+        },
+        reduce_op::plus<edge_t>(),
+        val_first,
+        val_first,
+        vertex_frontier,
+        [k] __device__(auto v_val, auto pushed_val) {
+          auto degree     = thrust::get<0>(v_val);
+          auto new_degree = degree - pushed_val;
+          auto idx        = thrust::get<1>(v_val) != uint8_t{0}
+                       ? VertexFrontier<vertex_t>::kInvalidBucketIdx
+                       : (new_degree <= k ? static_cast<size_t>(Bucket::next)
+                                          : static_cast<size_t>(Bucket::updated));
+          return thrust::make_tuple(idx, thrust::make_tuple(new_degree, uint8_t{0}));
+        });
+
+      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).clear();
+      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::updated)).clear();
+      vertex_frontier.swap_buckets(static_cast<size_t>(Bucket::cur),
+                                   static_cast<size_t>(Bucket::next));
+    }
+  }
+}
+
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::weight_type>>
+k_core(raft::handle_t const &handle,
+       GraphViewType const &push_graph_view,
+       typename GraphViewType::edge_type k,
+       typename GraphViewType::edge_type const *core_numbers,
+       bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(k >= 0, "Invalid input argument: k should be non-negative.");
+
+  if (do_expensive_check) {
+    auto num_invalid_core_numbers =
+      thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                       core_numbers,
+                       core_numbers + push_graph_view.get_number_of_local_vertices(),
+                       [] __device__(auto c) { return c < 0; });
+    if (GraphViewType::is_multi_gpu) {
+      num_invalid_core_numbers = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_core_numbers, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_core_numbers == 0,
+                    "Invalid input argument: core numbers should be non-negative.");
+  }
+
+  // 2. copy core numbers to the adjacency matrix rows & columns
+
+  rmm::device_uvector<edge_t> adj_matrix_row_core_numbers(
+    push_graph_view.get_number_of_local_adj_matrix_partition_rows(), handle.get_stream());
+  rmm::device_uvector<edge_t> adj_matrix_col_core_numbers(
+    push_graph_view.get_number_of_local_adj_matrix_partition_cols(), handle.get_stream());
+  copy_to_adj_matrix_row(
+    handle, push_graph_view, core_numbers, adj_matrix_row_core_numbers.begin());
+  copy_to_adj_matrix_col(
+    handle, push_graph_view, core_numbers, adj_matrix_col_core_numbers.begin());
+
+  // 3. extract the local edges with both end points in the k-core
+
+  size_t num_local_edges{0};
+  for (size_t i = 0; i < push_graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    num_local_edges += push_graph_view.get_number_of_local_adj_matrix_partition_edges(i);
+  }
+
+  rmm::device_uvector<vertex_t> majors(num_local_edges, handle.get_stream());
+  rmm::device_uvector<vertex_t> minors(num_local_edges, handle.get_stream());
+  rmm::device_uvector<weight_t> weights(push_graph_view.is_weighted() ? num_local_edges : 0,
+                                        handle.get_stream());
+  size_t edge_displacement{0};
+  for (size_t i = 0; i < push_graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    matrix_partition_device_t<GraphViewType> matrix_partition(push_graph_view, i);
+    thrust::for_each(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(vertex_t{0}),
+      thrust::make_counting_iterator(matrix_partition.get_major_size()),
+      decompress_k_core_edges_t<GraphViewType>{
+        matrix_partition,
+        adj_matrix_row_core_numbers.data() + matrix_partition.get_major_value_start_offset(),
+        adj_matrix_col_core_numbers.data(),
+        k,
+        majors.data() + edge_displacement,
+        minors.data() + edge_displacement,
+        push_graph_view.is_weighted() ? weights.data() + edge_displacement : nullptr});
+    edge_displacement += push_graph_view.get_number_of_local_adj_matrix_partition_edges(i);
+  }
+
+  size_t num_k_core_edges{0};
+  if (push_graph_view.is_weighted()) {
+    auto edge_first = thrust::make_zip_iterator(
+      thrust::make_tuple(majors.begin(), minors.begin(), weights.begin()));
+    num_k_core_edges = static_cast<size_t>(thrust::distance(
+      edge_first,
+      thrust::remove_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        edge_first,
+                        edge_first + majors.size(),
+                        [] __device__(auto e) {
+                          return thrust::get<0>(e) == invalid_vertex_id<vertex_t>::value;
+                        })));
+  } else {
+    auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(majors.begin(), minors.begin()));
+    num_k_core_edges = static_cast<size_t>(thrust::distance(
+      edge_first,
+      thrust::remove_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        edge_first,
+                        edge_first + majors.size(),
+                        [] __device__(auto e) {
+                          return thrust::get<0>(e) == invalid_vertex_id<vertex_t>::value;
+                        })));
+  }
+  majors.resize(num_k_core_edges, handle.get_stream());
+  majors.shrink_to_fit(handle.get_stream());
+  minors.resize(num_k_core_edges, handle.get_stream());
+  minors.shrink_to_fit(handle.get_stream());
+  if (push_graph_view.is_weighted()) {
+    weights.resize(num_k_core_edges, handle.get_stream());
+    weights.shrink_to_fit(handle.get_stream());
+  }
+
+  return std::make_tuple(std::move(majors), std::move(minors), std::move(weights));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void core_number(raft::handle_t const &handle,
+                 graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+                 edge_t *core_numbers,
+                 bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS((core_numbers != nullptr) || (graph_view.get_number_of_local_vertices() == 0),
+                  "Invalid input argument: core_numbers should not be nullptr.");
+
+  detail::core_number(handle, graph_view, core_numbers, do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+k_core(raft::handle_t const &handle,
+       graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+       edge_t k,
+       edge_t const *core_numbers,
+       bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS((core_numbers != nullptr) || (graph_view.get_number_of_local_vertices() == 0),
+                  "Invalid input argument: core_numbers should not be nullptr.");
+
+  return detail::k_core(handle, graph_view, k, core_numbers, do_expensive_check);
+}
+
+// explicit instantiation
+
+#define INSTANTIATE_CORE_NUMBER(vertex_t, edge_t, weight_t, multi_gpu)                 \
+  template void core_number(                                                           \
+    raft::handle_t const &handle,                                                      \
+    graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,      \
+    edge_t *core_numbers,                                                              \
+    bool do_expensive_check);                                                          \
+                                                                                       \
+  template std::tuple<rmm::device_uvector<vertex_t>,                                   \
+                      rmm::device_uvector<vertex_t>,                                   \
+                      rmm::device_uvector<weight_t>>                                   \
+  k_core(raft::handle_t const &handle,                                                 \
+         graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view, \
+         edge_t k,                                                                     \
+         edge_t const *core_numbers,                                                   \
+         bool do_expensive_check);
+
+INSTANTIATE_CORE_NUMBER(int32_t, int32_t, float, true)
+INSTANTIATE_CORE_NUMBER(int32_t, int32_t, double, true)
+INSTANTIATE_CORE_NUMBER(int32_t, int64_t, float, true)
+INSTANTIATE_CORE_NUMBER(int32_t, int64_t, double, true)
+INSTANTIATE_CORE_NUMBER(int64_t, int64_t, float, true)
+INSTANTIATE_CORE_NUMBER(int64_t, int64_t, double, true)
+INSTANTIATE_CORE_NUMBER(int32_t, int32_t, float, false)
+INSTANTIATE_CORE_NUMBER(int32_t, int32_t, double, false)
+INSTANTIATE_CORE_NUMBER(int32_t, int64_t, float, false)
+INSTANTIATE_CORE_NUMBER(int32_t, int64_t, double, false)
+INSTANTIATE_CORE_NUMBER(int64_t, int64_t, float, false)
+INSTANTIATE_CORE_NUMBER(int64_t, int64_t, double, false)
+
+}  // namespace experimental
+}  // namespace cugraph
@@ -0,0 +1,582 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <experimental/detail/graph_utils.cuh>
+#include <experimental/dynamic_graph.hpp>
+#include <experimental/edge_mask.cuh>
+#include <experimental/edge_property.cuh>
+#include <experimental/graph.hpp>
+#include <experimental/graph_builder.hpp>
+#include <matrix_partition_device.cuh>
+#include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <limits>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+
+namespace {
+
+// clear the deletion mask bit of the compact storage edge matching the i'th deleted edge (if
+// exists)
+template <typename GraphViewType>
+struct mark_deleted_edge_t {
+  using edge_t = typename GraphViewType::edge_type;
+
+  detail::find_edge_offset_t<GraphViewType> find_edge_offset;
+  uint32_t* deletion_mask{nullptr};
+
+  __device__ void operator()(edge_t i) const
+  {
+    auto edge_offset = find_edge_offset(i);
+    if (edge_offset != std::numeric_limits<edge_t>::max()) {
+      atomicAnd(deletion_mask + edge_offset / 32, ~(uint32_t{1} << (edge_offset % 32)));
+    }
+  }
+};
+
+// returns true if the (major, minor) pair of the edge is in the sorted (major, minor) pair list
+template <typename vertex_t>
+struct is_in_sorted_edges_t {
+  vertex_t const* sorted_majors{nullptr};
+  vertex_t const* sorted_minors{nullptr};
+  size_t num_sorted_edges{0};
+
+  template <typename EdgeTuple>
+  __device__ bool operator()(EdgeTuple e) const
+  {
+    auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(sorted_majors, sorted_minors));
+    return thrust::binary_search(thrust::seq,
+                                 pair_first,
+                                 pair_first + num_sorted_edges,
+                                 thrust::make_tuple(thrust::get<0>(e), thrust::get<1>(e)));
+  }
+};
+
+template <typename edge_t>
+struct is_deleted_edge_t {
+  uint32_t const* deletion_mask{nullptr};
+
+  __device__ bool operator()(edge_t i) const
+  {
+    return (deletion_mask[i / 32] & (uint32_t{1} << (i % 32))) == uint32_t{0};
+  }
+};
+
+// decompress the edges of an adjacency matrix partition to an edge list (of sources and
+// destinations)
+template <typename GraphViewType>
+struct decompress_matrix_partition_t {
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  matrix_partition_device_t<GraphViewType> matrix_partition;
+  vertex_t* srcs{nullptr};
+  vertex_t* dsts{nullptr};
+  weight_t* weights{nullptr};
+
+  __device__ void operator()(vertex_t major_offset) const
+  {
+    auto local_offset = matrix_partition.get_local_offset(major_offset);
+    auto local_degree = matrix_partition.get_local_degree(major_offset);
+    auto major        = matrix_partition.get_major_from_major_offset_nocheck(major_offset);
+    for (edge_t i = 0; i < local_degree; ++i) {
+      auto minor             = matrix_partition.get_minor_nocheck(local_offset + i);
+      srcs[local_offset + i] = GraphViewType::is_adj_matrix_transposed ? minor : major;
+      dsts[local_offset + i] = GraphViewType::is_adj_matrix_transposed ? major : minor;
+      if (weights != nullptr) {
+        weights[local_offset + i] = *(matrix_partition.get_weights() + local_offset + i);
+      }
+    }
+  }
+};
+
+// copy (single-GPU) or shuffle (multi-GPU) a batch (in (major, minor) order) to the GPUs owning
+// the edges
+template <typename vertex_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+copy_batch_to_edge_owners(raft::handle_t const& handle,
+                          vertex_t const* majors,
+                          vertex_t const* minors,
+                          weight_t const* weights /* nullptr if unweighted */,
+                          size_t number_of_edges,
+                          vertex_t const* vertex_partition_lasts)
+{
+  if (multi_gpu) {
+    return detail::shuffle_chunk_to_edge_owners(
+      handle, majors, minors, weights, number_of_edges, vertex_partition_lasts);
+  } else {
+    rmm::device_uvector<vertex_t> rx_majors(number_of_edges, handle.get_stream());
+    rmm::device_uvector<vertex_t> rx_minors(number_of_edges, handle.get_stream());
+    rmm::device_uvector<weight_t> rx_weights(weights != nullptr ? number_of_edges : size_t{0},
+                                             handle.get_stream());
+    thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 majors,
+                 majors + number_of_edges,
+                 rx_majors.begin());
+    thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 minors,
+                 minors + number_of_edges,
+                 rx_minors.begin());
+    if (weights != nullptr) {
+      thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   weights,
+                   weights + number_of_edges,
+                   rx_weights.begin());
+    }
+    return std::make_tuple(std::move(rx_majors), std::move(rx_minors), std::move(rx_weights));
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+void check_batch(raft::handle_t const& handle,
+                 edgelist_t<vertex_t, edge_t, weight_t> const& edgelist,
+                 vertex_t number_of_vertices,
+                 bool weights_required,
+                 bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(
+    (edgelist.number_of_edges == 0) ||
+      ((edgelist.p_src_vertices != nullptr) && (edgelist.p_dst_vertices != nullptr) &&
+       (!weights_required || (edgelist.p_edge_weights != nullptr))),
+    "Invalid input argument: edgelist.p_src_vertices and edgelist.p_dst_vertices (and "
+    "edgelist.p_edge_weights if weighted) should not be nullptr if edgelist.number_of_edges > 0.");
+
+  if (do_expensive_check) {
+    auto edge_first = thrust::make_zip_iterator(
+      thrust::make_tuple(edgelist.p_src_vertices, edgelist.p_dst_vertices));
+    CUGRAPH_EXPECTS(thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                                     edge_first,
+                                     edge_first + edgelist.number_of_edges,
+                                     detail::is_invalid_edge_t<vertex_t>{number_of_vertices}) == 0,
+                    "Invalid input argument: edgelist has out-of-range vertex IDs.");
+  }
+}
+
+}  // namespace
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+dynamic_graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>::dynamic_graph_t(
+  raft::handle_t const& handle,
+  graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>&& graph,
+  double compaction_threshold)
+  : handle_ptr_(&handle),
+    graph_(std::move(graph)),
+    compaction_threshold_(compaction_threshold),
+    d_vertex_partition_lasts_(0, handle.get_stream()),
+    pending_majors_(0, handle.get_stream()),
+    pending_minors_(0, handle.get_stream()),
+    pending_weights_(0, handle.get_stream())
+{
+  CUGRAPH_EXPECTS(compaction_threshold >= 0.0,
+                  "Invalid input argument: compaction_threshold should be non-negative.");
+
+  if (multi_gpu) {
+    auto const comm_size = handle.get_comms().get_size();
+    auto graph_view      = graph_.view();
+    std::vector<vertex_t> h_vertex_partition_lasts(comm_size);
+    for (int i = 0; i < comm_size; ++i) {
+      h_vertex_partition_lasts[i] = graph_view.get_vertex_partition_last(i);
+    }
+    d_vertex_partition_lasts_.resize(comm_size, handle.get_stream());
+    raft::update_device(d_vertex_partition_lasts_.data(),
+                        h_vertex_partition_lasts.data(),
+                        comm_size,
+                        handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(
+      handle.get_stream()));  // this is necessary as h_vertex_partition_lasts will become
+                              // out-of-scope once control flow exits this function.
+  }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void dynamic_graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>::insert_edges(
+  edgelist_t<vertex_t, edge_t, weight_t> const& edgelist, bool do_expensive_check)
+{
+  auto& handle     = *handle_ptr_;
+  auto is_weighted = graph_.is_weighted();
+
+  check_batch(handle, edgelist, graph_.get_number_of_vertices(), is_weighted, do_expensive_check);
+
+  auto majors  = store_transposed ? edgelist.p_dst_vertices : edgelist.p_src_vertices;
+  auto minors  = store_transposed ? edgelist.p_src_vertices : edgelist.p_dst_vertices;
+  auto weights = is_weighted ? edgelist.p_edge_weights : static_cast<weight_t const*>(nullptr);
+
+  rmm::device_uvector<vertex_t> rx_majors(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> rx_minors(0, handle.get_stream());
+  rmm::device_uvector<weight_t> rx_weights(0, handle.get_stream());
+  std::tie(rx_majors, rx_minors, rx_weights) =
+    copy_batch_to_edge_owners<vertex_t, weight_t, multi_gpu>(
+      handle,
+      majors,
+      minors,
+      weights,
+      static_cast<size_t>(edgelist.number_of_edges),
+      d_vertex_partition_lasts_.data());
+
+  auto old_size = pending_majors_.size();
+  pending_majors_.resize(old_size + rx_majors.size(), handle.get_stream());
+  pending_minors_.resize(pending_majors_.size(), handle.get_stream());
+  thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               rx_majors.begin(),
+               rx_majors.end(),
+               pending_majors_.begin() + old_size);
+  thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               rx_minors.begin(),
+               rx_minors.end(),
+               pending_minors_.begin() + old_size);
+  if (is_weighted) {
+    pending_weights_.resize(pending_majors_.size(), handle.get_stream());
+    thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 rx_weights.begin(),
+                 rx_weights.end(),
+                 pending_weights_.begin() + old_size);
+  }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void dynamic_graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>::delete_edges(
+  edgelist_t<vertex_t, edge_t, weight_t> const& edgelist, bool do_expensive_check)
+{
+  using graph_view_type = graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>;
+
+  auto& handle = *handle_ptr_;
+
+  check_batch(handle, edgelist, graph_.get_number_of_vertices(), false, do_expensive_check);
+
+  auto majors = store_transposed ? edgelist.p_dst_vertices : edgelist.p_src_vertices;
+  auto minors = store_transposed ? edgelist.p_src_vertices : edgelist.p_dst_vertices;
+
+  rmm::device_uvector<vertex_t> rx_majors(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> rx_minors(0, handle.get_stream());
+  std::tie(rx_majors, rx_minors, std::ignore) =
+    copy_batch_to_edge_owners<vertex_t, weight_t, multi_gpu>(
+      handle,
+      majors,
+      minors,
+      static_cast<weight_t const*>(nullptr),
+      static_cast<size_t>(edgelist.number_of_edges),
+      d_vertex_partition_lasts_.data());
+
+  // mask out the deleted edges of the compact storage
+
+  auto graph_view = graph_.view();
+  if (deletion_masks_.size() == 0) {
+    deletion_masks_.reserve(graph_view.get_number_of_local_adj_matrix_partitions());
+    for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      deletion_masks_.emplace_back(
+        detail::get_edge_mask_size(graph_view.get_number_of_local_adj_matrix_partition_edges(i)),
+        handle.get_stream());
+      thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   deletion_masks_.back().begin(),
+                   deletion_masks_.back().end(),
+                   ~uint32_t{0});
+    }
+  }
+
+  auto rows = store_transposed ? rx_minors.data() : rx_majors.data();
+  auto cols = store_transposed ? rx_majors.data() : rx_minors.data();
+  edge_t number_of_local_active_edges{0};
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    detail::find_edge_offset_t<graph_view_type> find_edge_offset{
+      matrix_partition_device_t<graph_view_type>(graph_view, i),
+      rows,
+      cols,
+      graph_view.has_sorted_neighbor_lists()};
+    thrust::for_each(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     thrust::make_counting_iterator(edge_t{0}),
+                     thrust::make_counting_iterator(static_cast<edge_t>(rx_majors.size())),
+                     mark_deleted_edge_t<graph_view_type>{find_edge_offset,
+                                                          deletion_masks_[i].data()});
+
+    auto number_of_edges = graph_view.get_number_of_local_adj_matrix_partition_edges(i);
+    number_of_local_active_edges += thrust::transform_reduce(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(edge_t{0}),
+      thrust::make_counting_iterator(detail::get_edge_mask_size(number_of_edges)),
+      detail::count_active_edges_t<edge_t>{deletion_masks_[i].data(), number_of_edges},
+      edge_t{0},
+      thrust::plus<edge_t>());
+  }
+  edge_t number_of_local_edges{0};
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    number_of_local_edges += graph_view.get_number_of_local_adj_matrix_partition_edges(i);
+  }
+  number_of_local_deleted_edges_ = number_of_local_edges - number_of_local_active_edges;
+
+  // drop the matching edges pending insertion
+
+  if ((pending_majors_.size() > 0) && (rx_majors.size() > 0)) {
+    auto pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(rx_majors.begin(), rx_minors.begin()));
+    thrust::sort(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 pair_first,
+                 pair_first + rx_majors.size());
+    auto pred =
+      is_in_sorted_edges_t<vertex_t>{rx_majors.data(), rx_minors.data(), rx_majors.size()};
+    size_t new_size{0};
+    if (pending_weights_.size() > 0) {
+      auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(
+        pending_majors_.begin(), pending_minors_.begin(), pending_weights_.begin()));
+      new_size        = static_cast<size_t>(thrust::distance(
+        edge_first,
+        thrust::remove_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                          edge_first,
+                          edge_first + pending_majors_.size(),
+                          pred)));
+      pending_weights_.resize(new_size, handle.get_stream());
+    } else {
+      auto edge_first = thrust::make_zip_iterator(
+        thrust::make_tuple(pending_majors_.begin(), pending_minors_.begin()));
+      new_size        = static_cast<size_t>(thrust::distance(
+        edge_first,
+        thrust::remove_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                          edge_first,
+                          edge_first + pending_majors_.size(),
+                          pred)));
+    }
+    pending_majors_.resize(new_size, handle.get_stream());
+    pending_minors_.resize(new_size, handle.get_stream());
+  }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void dynamic_graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>::compact(
+  bool do_expensive_check)
+{
+  using graph_view_type = graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>;
+
+  auto& handle    = *handle_ptr_;
+  auto graph_view = graph_.view();  // without the deletion masks
+
+  std::vector<vertex_t> vertex_partition_offsets{};
+  if (multi_gpu) {
+    auto const comm_size = handle.get_comms().get_size();
+    vertex_partition_offsets.resize(comm_size + 1);
+    for (int i = 0; i < comm_size; ++i) {
+      vertex_partition_offsets[i] = graph_view.get_vertex_partition_first(i);
+    }
+    vertex_partition_offsets[comm_size] = graph_view.get_number_of_vertices();
+  }
+
+  // stream the surviving edges of the compact storage (one adjacency matrix partition at a time)
+  // and the edges pending insertion to graph_builder_t (in multi-GPU, every edge is already in its
+  // owning GPU, so graph_builder_t's shuffles send the edges back to the same GPU)
+
+  graph_builder_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> builder(
+    handle,
+    graph_view.get_number_of_vertices(),
+    graph_view.get_graph_properties(),
+    vertex_partition_offsets);
+
+  for (size_t pass = 0; pass < 2; ++pass) {
+    for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      matrix_partition_device_t<graph_view_type> matrix_partition(graph_view, i);
+      auto num_edges = graph_view.get_number_of_local_adj_matrix_partition_edges(i);
+
+      rmm::device_uvector<vertex_t> srcs(num_edges, handle.get_stream());
+      rmm::device_uvector<vertex_t> dsts(num_edges, handle.get_stream());
+      rmm::device_uvector<weight_t> weights(
+        (pass == 1) && graph_view.is_weighted() ? num_edges : edge_t{0}, handle.get_stream());
+      thrust::for_each(
+        rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+        thrust::make_counting_iterator(vertex_t{0}),
+        thrust::make_counting_iterator(matrix_partition.get_major_size()),
+        decompress_matrix_partition_t<graph_view_type>{
+          matrix_partition,
+          srcs.data(),
+          dsts.data(),
+          weights.size() > 0 ? weights.data() : static_cast<weight_t*>(nullptr)});
+
+      if (deletion_masks_.size() > 0) {
+        auto pred = is_deleted_edge_t<edge_t>{deletion_masks_[i].data()};
+        if (weights.size() > 0) {
+          auto edge_first = thrust::make_zip_iterator(
+            thrust::make_tuple(srcs.begin(), dsts.begin(), weights.begin()));
+          num_edges = static_cast<edge_t>(thrust::distance(
+            edge_first,
+            thrust::remove_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                              edge_first,
+                              edge_first + num_edges,
+                              thrust::make_counting_iterator(edge_t{0}),
+                              pred)));
+        } else {
+          auto edge_first =
+            thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin()));
+          num_edges = static_cast<edge_t>(thrust::distance(
+            edge_first,
+            thrust::remove_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                              edge_first,
+                              edge_first + num_edges,
+                              thrust::make_counting_iterator(edge_t{0}),
+                              pred)));
+        }
+      }
+
+      edgelist_t<vertex_t, edge_t, weight_t> chunk{
+        srcs.data(),
+        dsts.data(),
+        weights.size() > 0 ? weights.data() : static_cast<weight_t*>(nullptr),
+        num_edges};
+      if (pass == 0) {
+        builder.count_edges(chunk, do_expensive_check);
+      } else {
+        builder.insert_edges(chunk, do_expensive_check);
+      }
+    }
+
+    edgelist_t<vertex_t, edge_t, weight_t> pending_chunk{
+      store_transposed ? pending_minors_.data() : pending_majors_.data(),
+      store_transposed ? pending_majors_.data() : pending_minors_.data(),
+      pending_weights_.size() > 0 ? pending_weights_.data() : static_cast<weight_t*>(nullptr),
+      static_cast<edge_t>(pending_majors_.size())};
+    if (pass == 0) {
+      builder.count_edges(pending_chunk, do_expensive_check);
+    } else {
+      builder.insert_edges(pending_chunk, do_expensive_check);
+    }
+  }
+
+  // vertex IDs are no longer sorted by degree after updates
+  graph_ = builder.build(false, do_expensive_check);
+
+  deletion_masks_.clear();
+  number_of_local_deleted_edges_ = edge_t{0};
+  pending_majors_.resize(0, handle.get_stream());
+  pending_minors_.resize(0, handle.get_stream());
+  pending_weights_.resize(0, handle.get_stream());
+  pending_majors_.shrink_to_fit(handle.get_stream());
+  pending_minors_.shrink_to_fit(handle.get_stream());
+  pending_weights_.shrink_to_fit(handle.get_stream());
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>
+dynamic_graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>::snapshot(
+  bool do_expensive_check)
+{
+  auto& handle = *handle_ptr_;
+
+  auto number_of_pending_insertions = static_cast<edge_t>(pending_majors_.size());
+  auto number_of_deleted_edges      = number_of_local_deleted_edges_;
+  if (multi_gpu) {
+    number_of_pending_insertions = host_scalar_allreduce(
+      handle.get_comms(), number_of_pending_insertions, handle.get_stream());
+    number_of_deleted_edges =
+      host_scalar_allreduce(handle.get_comms(), number_of_deleted_edges, handle.get_stream());
+  }
+
+  if ((number_of_pending_insertions > 0) ||
+      (static_cast<double>(number_of_deleted_edges) >
+       compaction_threshold_ * static_cast<double>(graph_.get_number_of_edges()))) {
+    compact(do_expensive_check);
+  }
+
+  return view();
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>
+dynamic_graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>::view() const
+{
+  auto graph_view = graph_.view();
+  if (deletion_masks_.size() > 0) {
+    std::vector<uint32_t const*> masks(deletion_masks_.size());
+    for (size_t i = 0; i < deletion_masks_.size(); ++i) { masks[i] = deletion_masks_[i].data(); }
+    return graph_view.with_edge_mask(masks);
+  } else {
+    return graph_view;
+  }
+}
+
+// explicit instantiation
+
+template class dynamic_graph_t<int32_t, int32_t, float, true, true>;
+template class dynamic_graph_t<int32_t, int32_t, float, false, true>;
+template class dynamic_graph_t<int32_t, int32_t, double, true, true>;
+template class dynamic_graph_t<int32_t, int32_t, double, false, true>;
+template class dynamic_graph_t<int32_t, int64_t, float, true, true>;
+template class dynamic_graph_t<int32_t, int64_t, float, false, true>;
+template class dynamic_graph_t<int32_t, int64_t, double, true, true>;
+template class dynamic_graph_t<int32_t, int64_t, double, false, true>;
+template class dynamic_graph_t<int64_t, int64_t, float, true, true>;
+template class dynamic_graph_t<int64_t, int64_t, float, false, true>;
+template class dynamic_graph_t<int64_t, int64_t, double, true, true>;
+template class dynamic_graph_t<int64_t, int64_t, double, false, true>;
+//
+template class dynamic_graph_t<int32_t, int32_t, float, true, false>;
+template class dynamic_graph_t<int32_t, int32_t, float, false, false>;
+template class dynamic_graph_t<int32_t, int32_t, double, true, false>;
+template class dynamic_graph_t<int32_t, int32_t, double, false, false>;
+template class dynamic_graph_t<int32_t, int64_t, float, true, false>;
+template class dynamic_graph_t<int32_t, int64_t, float, false, false>;
+template class dynamic_graph_t<int32_t, int64_t, double, true, false>;
+template class dynamic_graph_t<int32_t, int64_t, double, false, false>;
+template class dynamic_graph_t<int64_t, int64_t, float, true, false>;
+template class dynamic_graph_t<int64_t, int64_t, float, false, false>;
+template class dynamic_graph_t<int64_t, int64_t, double, true, false>;
+template class dynamic_graph_t<int64_t, int64_t, double, false, false>;
+
+}  // namespace experimental
+}  // namespace cugraph
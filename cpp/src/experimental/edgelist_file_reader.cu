@@ -0,0 +1,729 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <experimental/graph_functions.hpp>
+#include <utilities/error.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+
+namespace detail {
+
+size_t constexpr edgelist_file_chunk_size{size_t{1} << 26};  // FIXME: requires tuning
+
+enum class line_status_t : uint8_t { valid = 0, skip, error };
+
+__device__ inline bool is_field_separator(char c)
+{
+  return (c == ' ') || (c == '\t') || (c == '\r') || (c == ',');
+}
+
+__device__ inline char const *skip_field_separators(char const *first, char const *last)
+{
+  while ((first != last) && is_field_separator(*first)) { ++first; }
+  return first;
+}
+
+// returns nullptr on failure, otherwise the position following the parsed integer
+__device__ inline char const *parse_integer(char const *first, char const *last, int64_t &ret)
+{
+  bool negative{false};
+  if ((first != last) && ((*first == '-') || (*first == '+'))) {
+    negative = *first == '-';
+    ++first;
+  }
+  if ((first == last) || (*first < '0') || (*first > '9')) { return nullptr; }
+  uint64_t value{0};
+  while ((first != last) && (*first >= '0') && (*first <= '9')) {
+    auto digit = static_cast<uint64_t>(*first - '0');
+    if (value > (static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) - digit) / 10) {
+      return nullptr;  // overflow
+    }
+    value = value * 10 + digit;
+    ++first;
+  }
+  ret = negative ? -static_cast<int64_t>(value) : static_cast<int64_t>(value);
+  return first;
+}
+
+// returns nullptr on failure, otherwise the position following the parsed real number; the result
+// is correctly rounded if the number has up to 19 significant digits and the decimal exponent
+// (after normalization) is in [-22, 22] (this covers real numbers in typical graph files)
+__device__ inline char const *parse_real(char const *first, char const *last, double &ret)
+{
+  bool negative{false};
+  if ((first != last) && ((*first == '-') || (*first == '+'))) {
+    negative = *first == '-';
+    ++first;
+  }
+  uint64_t mantissa{0};
+  int num_significant_digits{0};
+  int exponent{0};
+  bool has_digits{false};
+  while ((first != last) && (*first >= '0') && (*first <= '9')) {
+    if (num_significant_digits < 19) {
+      mantissa = mantissa * 10 + static_cast<uint64_t>(*first - '0');
+      if (mantissa > 0) { ++num_significant_digits; }
+    } else {
+      ++exponent;
+    }
+    has_digits = true;
+    ++first;
+  }
+  if ((first != last) && (*first == '.')) {
+    ++first;
+    while ((first != last) && (*first >= '0') && (*first <= '9')) {
+      if (num_significant_digits < 19) {
+        mantissa = mantissa * 10 + static_cast<uint64_t>(*first - '0');
+        if (mantissa > 0) { ++num_significant_digits; }
+        --exponent;
+      }
+      has_digits = true;
+      ++first;
+    }
+  }
+  if (!has_digits) { return nullptr; }
+  if ((first != last) && ((*first == 'e') || (*first == 'E'))) {
+    int64_t explicit_exponent{0};
+    first = parse_integer(first + 1, last, explicit_exponent);
+    if (first == nullptr) { return nullptr; }
+    auto constexpr max_exponent = int64_t{1} << 16;  // to avoid overflow, ret becomes 0 or inf
+    explicit_exponent = explicit_exponent > max_exponent ? max_exponent : explicit_exponent;
+    explicit_exponent = explicit_exponent < -max_exponent ? -max_exponent : explicit_exponent;
+    exponent += static_cast<int>(explicit_exponent);
+  }
+  auto value = static_cast<double>(mantissa);
+  if (mantissa != 0) {
+    // multiplying (or dividing) by an exactly representable power of 10 rounds only once
+    while (exponent > 22) {
+      value *= 1e22;
+      exponent -= 22;
+    }
+    while (exponent < -22) {
+      value /= 1e22;
+      exponent += 22;
+    }
+    double constexpr powers_of_10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                       1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                       1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    value = exponent >= 0 ? value * powers_of_10[exponent] : value / powers_of_10[-exponent];
+  }
+  ret = negative ? -value : value;
+  return first;
+}
+
+struct is_line_first_t {
+  char const *chars{nullptr};
+
+  __device__ bool operator()(size_t i) const { return (i == 0) || (chars[i - 1] == '\n'); }
+};
+
+// parse "row col [weight]" lines, blank lines and lines starting with a comment character are
+// skipped
+template <typename vertex_t, typename weight_t>
+struct parse_edge_line_t {
+  char const *chars{nullptr};
+  size_t num_chars{0};
+  size_t const *line_firsts{nullptr};
+  char const *comment_chars{nullptr};  // null terminated
+  int64_t index_base{0};
+  int64_t number_of_vertices{0};  // used to check vertex IDs
+  bool has_weights{false};
+  vertex_t *rows{nullptr};
+  vertex_t *cols{nullptr};
+  weight_t *weights{nullptr};
+  line_status_t *statuses{nullptr};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto first = chars + line_firsts[i];
+    auto last  = first;
+    while ((last != chars + num_chars) && (*last != '\n')) { ++last; }
+
+    first = skip_field_separators(first, last);
+    if (first == last) {
+      statuses[i] = line_status_t::skip;
+      return;
+    }
+    for (auto c = comment_chars; *c != '\0'; ++c) {
+      if (*first == *c) {
+        statuses[i] = line_status_t::skip;
+        return;
+      }
+    }
+
+    int64_t row{0};
+    int64_t col{0};
+    double weight{1.0};
+    first = parse_integer(first, last, row);
+    if (first != nullptr) { first = parse_integer(skip_field_separators(first, last), last, col); }
+    if ((first != nullptr) && has_weights) {
+      first = parse_real(skip_field_separators(first, last), last, weight);
+    }
+    row -= index_base;
+    col -= index_base;
+    if ((first == nullptr) || (row < 0) || (row >= number_of_vertices) || (col < 0) ||
+        (col >= number_of_vertices)) {
+      statuses[i] = line_status_t::error;
+      return;
+    }
+
+    rows[i]     = static_cast<vertex_t>(row);
+    cols[i]     = static_cast<vertex_t>(col);
+    weights[i]  = static_cast<weight_t>(weight);
+    statuses[i] = line_status_t::valid;
+  }
+};
+
+template <typename vertex_t>
+struct count_output_edges_t {
+  vertex_t const *rows{nullptr};
+  vertex_t const *cols{nullptr};
+  line_status_t const *statuses{nullptr};
+  size_t num_lines{0};
+  bool expand_symmetric{false};
+
+  __device__ size_t operator()(size_t i) const
+  {
+    if ((i == num_lines) || (statuses[i] != line_status_t::valid)) { return size_t{0}; }
+    return (expand_symmetric && (rows[i] != cols[i])) ? size_t{2} : size_t{1};
+  }
+};
+
+// compacts the parsed lines (and adds the symmetric complements of the non-diagonal entries right
+// after the entries, matching the order of the host Matrix Market reader)
+template <typename vertex_t, typename weight_t>
+struct scatter_edges_t {
+  vertex_t const *rows{nullptr};
+  vertex_t const *cols{nullptr};
+  weight_t const *weights{nullptr};
+  line_status_t const *statuses{nullptr};
+  size_t const *output_offsets{nullptr};
+  bool expand_symmetric{false};
+  vertex_t *output_rows{nullptr};
+  vertex_t *output_cols{nullptr};
+  weight_t *output_weights{nullptr};  // nullptr if weights are not requested
+
+  __device__ void operator()(size_t i) const
+  {
+    if (statuses[i] != line_status_t::valid) { return; }
+    auto offset         = output_offsets[i];
+    output_rows[offset] = rows[i];
+    output_cols[offset] = cols[i];
+    if (output_weights != nullptr) { output_weights[offset] = weights[i]; }
+    if (expand_symmetric && (rows[i] != cols[i])) {
+      output_rows[offset + 1] = cols[i];
+      output_cols[offset + 1] = rows[i];
+      if (output_weights != nullptr) { output_weights[offset + 1] = weights[i]; }
+    }
+  }
+};
+
+template <typename vertex_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+parse_edge_lines(raft::handle_t const &handle,
+                 char const *h_chars,
+                 size_t num_chars,
+                 size_t num_owned_chars /* lines starting in [0, num_owned_chars) are parsed */,
+                 char const *d_comment_chars,
+                 int64_t index_base,
+                 int64_t number_of_vertices,
+                 bool has_weights,
+                 bool read_weights,
+                 bool expand_symmetric)
+{
+  rmm::device_uvector<char> d_chars(num_chars, handle.get_stream());
+  raft::update_device(d_chars.data(), h_chars, num_chars, handle.get_stream());
+
+  auto num_lines = static_cast<size_t>(
+    thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(num_owned_chars),
+                     is_line_first_t{d_chars.data()}));
+  rmm::device_uvector<size_t> d_line_firsts(num_lines, handle.get_stream());
+  thrust::copy_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                  thrust::make_counting_iterator(size_t{0}),
+                  thrust::make_counting_iterator(num_owned_chars),
+                  d_line_firsts.begin(),
+                  is_line_first_t{d_chars.data()});
+
+  rmm::device_uvector<vertex_t> d_rows(num_lines, handle.get_stream());
+  rmm::device_uvector<vertex_t> d_cols(num_lines, handle.get_stream());
+  rmm::device_uvector<weight_t> d_weights(num_lines, handle.get_stream());
+  rmm::device_uvector<line_status_t> d_statuses(num_lines, handle.get_stream());
+  thrust::for_each(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(num_lines),
+    parse_edge_line_t<vertex_t, weight_t>{d_chars.data(),
+                                          num_chars,
+                                          d_line_firsts.data(),
+                                          d_comment_chars,
+                                          index_base,
+                                          number_of_vertices,
+                                          has_weights,
+                                          d_rows.data(),
+                                          d_cols.data(),
+                                          d_weights.data(),
+                                          d_statuses.data()});
+  d_chars.release();
+  d_line_firsts.release();
+
+  CUGRAPH_EXPECTS(thrust::count(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                                d_statuses.begin(),
+                                d_statuses.end(),
+                                line_status_t::error) == 0,
+                  "Invalid input argument: failed to parse an edge (or a vertex ID is out of "
+                  "range).");
+
+  rmm::device_uvector<size_t> d_output_offsets(num_lines + 1, handle.get_stream());
+  auto count_first = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(size_t{0}),
+    count_output_edges_t<vertex_t>{
+      d_rows.data(), d_cols.data(), d_statuses.data(), num_lines, expand_symmetric});
+  thrust::exclusive_scan(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                         count_first,
+                         count_first + (num_lines + 1),
+                         d_output_offsets.begin());
+  auto num_edges = d_output_offsets.element(num_lines, handle.get_stream());
+
+  rmm::device_uvector<vertex_t> d_output_rows(num_edges, handle.get_stream());
+  rmm::device_uvector<vertex_t> d_output_cols(num_edges, handle.get_stream());
+  rmm::device_uvector<weight_t> d_output_weights(read_weights ? num_edges : size_t{0},
+                                                 handle.get_stream());
+  thrust::for_each(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(num_lines),
+                   scatter_edges_t<vertex_t, weight_t>{
+                     d_rows.data(),
+                     d_cols.data(),
+                     d_weights.data(),
+                     d_statuses.data(),
+                     d_output_offsets.data(),
+                     expand_symmetric,
+                     d_output_rows.data(),
+                     d_output_cols.data(),
+                     read_weights ? d_output_weights.data() : static_cast<weight_t *>(nullptr)});
+
+  return std::make_tuple(
+    std::move(d_output_rows), std::move(d_output_cols), std::move(d_output_weights));
+}
+
+template <typename T>
+rmm::device_uvector<T> concatenate(raft::handle_t const &handle,
+                                   std::vector<rmm::device_uvector<T>> &&chunks)
+{
+  if (chunks.size() == 1) { return std::move(chunks[0]); }
+  size_t size{0};
+  for (auto const &chunk : chunks) { size += chunk.size(); }
+  rmm::device_uvector<T> ret(size, handle.get_stream());
+  size_t offset{0};
+  for (auto &chunk : chunks) {
+    thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 chunk.begin(),
+                 chunk.end(),
+                 ret.begin() + offset);
+    offset += chunk.size();
+    chunk.release();
+  }
+  return ret;
+}
+
+// reads the lines starting in [max(data_first, byte_range_first), byte_range_last) in chunks,
+// every chunk is cut at the last line break (the remaining bytes are carried over to the next
+// chunk) and tokenized and parsed on device
+template <typename vertex_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+read_edge_lines(raft::handle_t const &handle,
+                FILE *fp,
+                size_t data_first,
+                size_t byte_range_first,
+                size_t byte_range_last,
+                std::string const &comment_chars,
+                int64_t index_base,
+                int64_t number_of_vertices,
+                bool has_weights,
+                bool read_weights,
+                bool expand_symmetric)
+{
+  auto first = data_first;
+  if (byte_range_first > data_first) {
+    // skip the line started before byte_range_first
+    CUGRAPH_EXPECTS(std::fseek(fp, static_cast<long>(byte_range_first - 1), SEEK_SET) == 0,
+                    "Failed to set the file position.");
+    int c{0};
+    while (((c = std::fgetc(fp)) != EOF) && (c != '\n')) {}
+    CUGRAPH_EXPECTS(!std::ferror(fp), "Failed to read the file.");
+    first = (c == EOF) ? byte_range_last : static_cast<size_t>(std::ftell(fp));
+  } else {
+    CUGRAPH_EXPECTS(std::fseek(fp, static_cast<long>(data_first), SEEK_SET) == 0,
+                    "Failed to set the file position.");
+  }
+
+  rmm::device_uvector<char> d_comment_chars(comment_chars.size() + 1, handle.get_stream());
+  raft::update_device(
+    d_comment_chars.data(), comment_chars.c_str(), comment_chars.size() + 1, handle.get_stream());
+
+  std::vector<rmm::device_uvector<vertex_t>> row_chunks{};
+  std::vector<rmm::device_uvector<vertex_t>> col_chunks{};
+  std::vector<rmm::device_uvector<weight_t>> weight_chunks{};
+
+  std::vector<char> h_chars(edgelist_file_chunk_size);
+  size_t num_carried_chars{0};
+  while (first < byte_range_last) {
+    auto num_read_chars =
+      std::fread(h_chars.data() + num_carried_chars, 1, h_chars.size() - num_carried_chars, fp);
+    CUGRAPH_EXPECTS(!std::ferror(fp), "Failed to read the file.");
+    auto eof       = num_read_chars < h_chars.size() - num_carried_chars;
+    auto num_chars = num_carried_chars + num_read_chars;
+
+    auto num_parsed_chars = num_chars;
+    if (!eof) {
+      auto it = std::find(h_chars.rbegin(), h_chars.rbegin() + num_chars, '\n');
+      if (it == h_chars.rbegin() + num_chars) {  // a line longer than the buffer
+        num_carried_chars = num_chars;
+        h_chars.resize(h_chars.size() * 2);
+        continue;
+      }
+      num_parsed_chars = static_cast<size_t>(std::distance(it, h_chars.rend()));
+    }
+
+    if (num_parsed_chars > 0) {
+      rmm::device_uvector<vertex_t> d_rows(0, handle.get_stream());
+      rmm::device_uvector<vertex_t> d_cols(0, handle.get_stream());
+      rmm::device_uvector<weight_t> d_weights(0, handle.get_stream());
+      std::tie(d_rows, d_cols, d_weights) =
+        parse_edge_lines<vertex_t, weight_t>(handle,
+                                             h_chars.data(),
+                                             num_parsed_chars,
+                                             std::min(num_parsed_chars, byte_range_last - first),
+                                             d_comment_chars.data(),
+                                             index_base,
+                                             number_of_vertices,
+                                             has_weights,
+                                             read_weights,
+                                             expand_symmetric);
+      row_chunks.push_back(std::move(d_rows));
+      col_chunks.push_back(std::move(d_cols));
+      weight_chunks.push_back(std::move(d_weights));
+    }
+
+    num_carried_chars = num_chars - num_parsed_chars;
+    std::memmove(h_chars.data(), h_chars.data() + num_parsed_chars, num_carried_chars);
+    first += num_parsed_chars;
+    if (eof) { break; }
+    // h_chars gets overwritten in the next iteration
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+  }
+  CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));  // h_chars will become out-of-scope
+
+  if (row_chunks.size() == 0) {
+    return std::make_tuple(rmm::device_uvector<vertex_t>(0, handle.get_stream()),
+                           rmm::device_uvector<vertex_t>(0, handle.get_stream()),
+                           rmm::device_uvector<weight_t>(0, handle.get_stream()));
+  }
+  return std::make_tuple(concatenate(handle, std::move(row_chunks)),
+                         concatenate(handle, std::move(col_chunks)),
+                         concatenate(handle, std::move(weight_chunks)));
+}
+
+size_t get_file_size(FILE *fp)
+{
+  CUGRAPH_EXPECTS(std::fseek(fp, 0, SEEK_END) == 0, "Failed to set the file position.");
+  auto size = std::ftell(fp);
+  CUGRAPH_EXPECTS(size >= 0, "Failed to get the file size.");
+  return static_cast<size_t>(size);
+}
+
+bool read_line(FILE *fp, std::string &line)
+{
+  line.clear();
+  int c{0};
+  while (((c = std::fgetc(fp)) != EOF) && (c != '\n')) { line.push_back(static_cast<char>(c)); }
+  CUGRAPH_EXPECTS(!std::ferror(fp), "Failed to read the file.");
+  return (c != EOF) || (line.size() > 0);
+}
+
+std::string to_lower(std::string str)
+{
+  std::transform(str.begin(), str.end(), str.begin(), [](unsigned char c) {
+    return static_cast<char>(std::tolower(c));
+  });
+  return str;
+}
+
+class file_t {
+ public:
+  file_t(std::string const &file_path) : fp_(std::fopen(file_path.c_str(), "rb"))
+  {
+    CUGRAPH_EXPECTS(fp_ != nullptr, "Failed to open %s for reading.", file_path.c_str());
+  }
+
+  file_t(file_t const &) = delete;
+  file_t &operator=(file_t const &) = delete;
+
+  ~file_t() { std::fclose(fp_); }
+
+  FILE *get() const { return fp_; }
+
+ private:
+  FILE *fp_{nullptr};
+};
+
+}  // namespace detail
+
+template <typename vertex_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>,
+           vertex_t,
+           bool>
+read_edgelist_from_matrix_market_file(raft::handle_t const &handle,
+                                      std::string const &file_path,
+                                      bool read_weights,
+                                      size_t byte_range_offset,
+                                      size_t byte_range_size)
+{
+  detail::file_t file(file_path);
+  auto file_size = detail::get_file_size(file.get());
+  CUGRAPH_EXPECTS(std::fseek(file.get(), 0, SEEK_SET) == 0, "Failed to set the file position.");
+
+  // 1. parse the banner and the size line on host
+
+  std::string line{};
+  CUGRAPH_EXPECTS(detail::read_line(file.get(), line),
+                  "Invalid input argument: %s is empty.",
+                  file_path.c_str());
+  std::string banner{};
+  std::string object{};
+  std::string format{};
+  std::string field{};
+  std::string symmetry{};
+  std::istringstream(line) >> banner >> object >> format >> field >> symmetry;
+  banner   = detail::to_lower(banner);
+  object   = detail::to_lower(object);
+  format   = detail::to_lower(format);
+  field    = detail::to_lower(field);
+  symmetry = detail::to_lower(symmetry);
+  CUGRAPH_EXPECTS((banner == "%%matrixmarket") && (object == "matrix") && (format == "coordinate"),
+                  "Invalid input argument: %s is not a Matrix Market file in coordinate format.",
+                  file_path.c_str());
+  CUGRAPH_EXPECTS((field == "real") || (field == "integer") || (field == "pattern"),
+                  "Invalid input argument: unsupported Matrix Market field (%s).",
+                  field.c_str());
+  CUGRAPH_EXPECTS((symmetry == "general") || (symmetry == "symmetric"),
+                  "Invalid input argument: unsupported Matrix Market symmetry (%s).",
+                  symmetry.c_str());
+
+  long long m{0};
+  long long n{0};
+  long long nnz{0};
+  while (true) {
+    CUGRAPH_EXPECTS(detail::read_line(file.get(), line),
+                    "Invalid input argument: %s does not have a size line.",
+                    file_path.c_str());
+    if ((line.size() > 0) && (line[0] == '%')) { continue; }
+    if (line.find_first_not_of(" \t\r") == std::string::npos) { continue; }
+    CUGRAPH_EXPECTS(std::sscanf(line.c_str(), "%lld %lld %lld", &m, &n, &nnz) == 3,
+                    "Invalid input argument: failed to parse the size line of %s.",
+                    file_path.c_str());
+    break;
+  }
+  CUGRAPH_EXPECTS((m >= 0) && (n >= 0) && (nnz >= 0) &&
+                    (m <= static_cast<long long>(std::numeric_limits<vertex_t>::max())),
+                  "Invalid input argument: invalid Matrix Market matrix size.");
+  auto data_first = static_cast<size_t>(std::ftell(file.get()));
+
+  // 2. read & parse the edges in the byte range on device
+
+  auto is_symmetric    = symmetry == "symmetric";
+  auto byte_range_last = byte_range_size == 0
+                           ? file_size
+                           : std::min(file_size, byte_range_offset + byte_range_size);
+
+  rmm::device_uvector<vertex_t> d_rows(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> d_cols(0, handle.get_stream());
+  rmm::device_uvector<weight_t> d_weights(0, handle.get_stream());
+  std::tie(d_rows, d_cols, d_weights) =
+    detail::read_edge_lines<vertex_t, weight_t>(handle,
+                                                file.get(),
+                                                data_first,
+                                                byte_range_offset,
+                                                byte_range_last,
+                                                std::string("%"),
+                                                int64_t{1},
+                                                static_cast<int64_t>(m),
+                                                field != "pattern",
+                                                read_weights,
+                                                is_symmetric);
+
+  if ((byte_range_offset <= data_first) && (byte_range_last == file_size)) {
+    auto num_edges = static_cast<long long>(d_rows.size());
+    CUGRAPH_EXPECTS(
+      is_symmetric ? ((num_edges >= nnz) && (num_edges <= 2 * nnz)) : (num_edges == nnz),
+      "Invalid input argument: the number of entries does not match with the size line.");
+  }
+
+  return std::make_tuple(std::move(d_rows),
+                         std::move(d_cols),
+                         std::move(d_weights),
+                         static_cast<vertex_t>(m),
+                         is_symmetric);
+}
+
+template <typename vertex_t, typename weight_t>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+read_edgelist_from_text_file(raft::handle_t const &handle,
+                             std::string const &file_path,
+                             bool read_weights,
+                             vertex_t index_base,
+                             size_t byte_range_offset,
+                             size_t byte_range_size)
+{
+  detail::file_t file(file_path);
+  auto file_size = detail::get_file_size(file.get());
+
+  auto byte_range_last = byte_range_size == 0
+                           ? file_size
+                           : std::min(file_size, byte_range_offset + byte_range_size);
+
+  return detail::read_edge_lines<vertex_t, weight_t>(
+    handle,
+    file.get(),
+    size_t{0},
+    byte_range_offset,
+    byte_range_last,
+    std::string("#%"),
+    static_cast<int64_t>(index_base),
+    static_cast<int64_t>(std::numeric_limits<vertex_t>::max()),
+    read_weights,
+    read_weights,
+    false);
+}
+
+// explicit instantiation
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<float>,
+                    int32_t,
+                    bool>
+read_edgelist_from_matrix_market_file<int32_t, float>(raft::handle_t const &handle,
+                                                      std::string const &file_path,
+                                                      bool read_weights,
+                                                      size_t byte_range_offset,
+                                                      size_t byte_range_size);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<double>,
+                    int32_t,
+                    bool>
+read_edgelist_from_matrix_market_file<int32_t, double>(raft::handle_t const &handle,
+                                                       std::string const &file_path,
+                                                       bool read_weights,
+                                                       size_t byte_range_offset,
+                                                       size_t byte_range_size);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<float>,
+                    int64_t,
+                    bool>
+read_edgelist_from_matrix_market_file<int64_t, float>(raft::handle_t const &handle,
+                                                      std::string const &file_path,
+                                                      bool read_weights,
+                                                      size_t byte_range_offset,
+                                                      size_t byte_range_size);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<double>,
+                    int64_t,
+                    bool>
+read_edgelist_from_matrix_market_file<int64_t, double>(raft::handle_t const &handle,
+                                                       std::string const &file_path,
+                                                       bool read_weights,
+                                                       size_t byte_range_offset,
+                                                       size_t byte_range_size);
+
+template std::
+  tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>, rmm::device_uvector<float>>
+  read_edgelist_from_text_file<int32_t, float>(raft::handle_t const &handle,
+                                               std::string const &file_path,
+                                               bool read_weights,
+                                               int32_t index_base,
+                                               size_t byte_range_offset,
+                                               size_t byte_range_size);
+
+template std::
+  tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>, rmm::device_uvector<double>>
+  read_edgelist_from_text_file<int32_t, double>(raft::handle_t const &handle,
+                                                std::string const &file_path,
+                                                bool read_weights,
+                                                int32_t index_base,
+                                                size_t byte_range_offset,
+                                                size_t byte_range_size);
+
+template std::
+  tuple<rmm::device_uvector<int64_t>, rmm::device_uvector<int64_t>, rmm::device_uvector<float>>
+  read_edgelist_from_text_file<int64_t, float>(raft::handle_t const &handle,
+                                               std::string const &file_path,
+                                               bool read_weights,
+                                               int64_t index_base,
+                                               size_t byte_range_offset,
+                                               size_t byte_range_size);
+
+template std::
+  tuple<rmm::device_uvector<int64_t>, rmm::device_uvector<int64_t>, rmm::device_uvector<double>>
+  read_edgelist_from_text_file<int64_t, double>(raft::handle_t const &handle,
+                                                std::string const &file_path,
+                                                bool read_weights,
+                                                int64_t index_base,
+                                                size_t byte_range_offset,
+                                                size_t byte_range_size);
+
+}  // namespace experimental
+}  // namespace cugraph
@@ -0,0 +1,689 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <experimental/scramble.cuh>
+
+#include <experimental/graph.hpp>
+#include <experimental/graph_generator.hpp>
+#include <experimental/graph_view.hpp>
+#include <partition_manager.hpp>
+#include <utilities/error.hpp>
+
+#include <raft/handle.hpp>
+#include <raft/random/rng.cuh>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+
+namespace {
+
+size_t log2_if_power_of_two(size_t value)
+{
+  CUGRAPH_EXPECTS((value > 0) && ((value & (value - 1)) == 0),
+                  "Invalid input argument: the number of GPUs should be a power of two.");
+  size_t ret{0};
+  while ((size_t{1} << ret) < value) { ++ret; }
+  return ret;
+}
+
+// R-mat probability of the adjacency matrix block whose source IDs start with the src_prefix_bits
+// bit prefix src_prefix and destination IDs start with the dst_prefix_bits bit prefix dst_prefix
+double compute_rmat_block_probability(size_t src_prefix,
+                                      size_t src_prefix_bits,
+                                      size_t dst_prefix,
+                                      size_t dst_prefix_bits,
+                                      double a,
+                                      double b,
+                                      double c)
+{
+  auto d = 1.0 - (a + b + c);
+  auto p = 1.0;
+  for (size_t level = 0; level < std::max(src_prefix_bits, dst_prefix_bits); ++level) {
+    auto src_fixed = level < src_prefix_bits;
+    auto dst_fixed = level < dst_prefix_bits;
+    auto src_bit   = src_fixed && (((src_prefix >> (src_prefix_bits - 1 - level)) & 1) != 0);
+    auto dst_bit   = dst_fixed && (((dst_prefix >> (dst_prefix_bits - 1 - level)) & 1) != 0);
+    if (src_fixed && dst_fixed) {
+      p *= src_bit ? (dst_bit ? d : c) : (dst_bit ? b : a);
+    } else if (src_fixed) {
+      p *= src_bit ? (c + d) : (a + b);
+    } else {
+      p *= dst_bit ? (b + d) : (a + c);
+    }
+  }
+  return p;
+}
+
+// R-mat edges conditioned on falling in the block (src_prefix, dst_prefix); R-mat levels are
+// independent, so the top levels are fixed (or conditioned on the fixed bit of the other side) and
+// the remaining levels are sampled as usual
+template <typename vertex_t>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>
+generate_rmat_block_edgelist(raft::handle_t const& handle,
+                             size_t scale,
+                             size_t num_edges,
+                             double a,
+                             double b,
+                             double c,
+                             uint64_t seed,
+                             size_t src_prefix,
+                             size_t src_prefix_bits,
+                             size_t dst_prefix,
+                             size_t dst_prefix_bits)
+{
+  auto d = 1.0 - (a + b + c);
+
+  raft::random::Rng rng(seed);
+  // to limit memory footprint (1024 is a tuning parameter)
+  auto max_edges_to_generate_per_iteration =
+    static_cast<size_t>(handle.get_device_properties().multiProcessorCount) * 1024;
+  rmm::device_uvector<float> rands(
+    std::min(num_edges, max_edges_to_generate_per_iteration) * 2 * scale, handle.get_stream());
+
+  rmm::device_uvector<vertex_t> srcs(num_edges, handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(num_edges, handle.get_stream());
+
+  size_t num_edges_generated{0};
+  while (num_edges_generated < num_edges) {
+    auto num_edges_to_generate =
+      std::min(num_edges - num_edges_generated, max_edges_to_generate_per_iteration);
+    auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin())) +
+                      num_edges_generated;
+    rng.uniform<float, size_t>(
+      rands.data(), num_edges_to_generate * 2 * scale, 0.0f, 1.0f, handle.get_stream());
+    thrust::transform(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_edges_to_generate),
+      pair_first,
+      // conditional probabilities are irrelevant if the denominators are 0.0
+      [scale,
+       src_prefix,
+       src_prefix_bits,
+       dst_prefix,
+       dst_prefix_bits,
+       rands    = rands.data(),
+       a_plus_b = a + b,
+       a_norm   = (a + b) > 0.0 ? a / (a + b) : 0.0,
+       c_norm   = (c + d) > 0.0 ? c / (c + d) : 0.0,
+       a_norm_t = (a + c) > 0.0 ? a / (a + c) : 0.0,
+       b_norm_t = (b + d) > 0.0 ? b / (b + d) : 0.0] __device__(auto i) {
+        vertex_t src{0};
+        vertex_t dst{0};
+        for (size_t level = 0; level < scale; ++level) {
+          auto bit  = scale - 1 - level;
+          auto r0   = rands[i * 2 * scale + 2 * level];
+          auto r1   = rands[i * 2 * scale + 2 * level + 1];
+          bool src_bit_set{false};
+          bool dst_bit_set{false};
+          if (level < src_prefix_bits) {
+            src_bit_set = ((src_prefix >> (src_prefix_bits - 1 - level)) & 1) != 0;
+            dst_bit_set = level < dst_prefix_bits
+                            ? ((dst_prefix >> (dst_prefix_bits - 1 - level)) & 1) != 0
+                            : r1 > (src_bit_set ? c_norm : a_norm);
+          } else if (level < dst_prefix_bits) {
+            dst_bit_set = ((dst_prefix >> (dst_prefix_bits - 1 - level)) & 1) != 0;
+            src_bit_set = r0 > (dst_bit_set ? b_norm_t : a_norm_t);
+          } else {
+            src_bit_set = r0 > a_plus_b;
+            dst_bit_set = r1 > (src_bit_set ? c_norm : a_norm);
+          }
+          src += src_bit_set ? static_cast<vertex_t>(vertex_t{1} << bit) : vertex_t{0};
+          dst += dst_bit_set ? static_cast<vertex_t>(vertex_t{1} << bit) : vertex_t{0};
+        }
+        return thrust::make_tuple(src, dst);
+      });
+    num_edges_generated += num_edges_to_generate;
+  }
+
+  return std::make_tuple(std::move(srcs), std::move(dsts));
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::enable_if_t<multi_gpu, graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>>
+create_graph(raft::handle_t const& handle,
+             std::vector<edgelist_t<vertex_t, edge_t, weight_t>> const& edgelists,
+             std::vector<vertex_t> const& vertex_partition_offsets,
+             vertex_t number_of_vertices,
+             edge_t number_of_edges,
+             graph_properties_t properties,
+             bool do_expensive_check)
+{
+  auto& row_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+  auto& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+  return graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+    handle,
+    edgelists,
+    partition_t<vertex_t>(vertex_partition_offsets,
+                          row_comm.get_size(),
+                          col_comm.get_size(),
+                          row_comm.get_rank(),
+                          col_comm.get_rank()),
+    number_of_vertices,
+    number_of_edges,
+    properties,
+    false,
+    do_expensive_check);
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::enable_if_t<!multi_gpu, graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>>
+create_graph(raft::handle_t const& handle,
+             std::vector<edgelist_t<vertex_t, edge_t, weight_t>> const& edgelists,
+             std::vector<vertex_t> const& vertex_partition_offsets,
+             vertex_t number_of_vertices,
+             edge_t number_of_edges,
+             graph_properties_t properties,
+             bool do_expensive_check)
+{
+  return graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+    handle, edgelists[0], number_of_vertices, properties, false, do_expensive_check);
+}
+
+}  // namespace
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>,
+           rmm::device_uvector<vertex_t>>
+generate_rmat_graph(raft::handle_t const& handle,
+                    size_t scale,
+                    size_t edge_factor,
+                    double a,
+                    double b,
+                    double c,
+                    uint64_t seed,
+                    bool scramble_vertex_ids,
+                    bool generate_weights,
+                    bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS((size_t{1} << scale) <= static_cast<size_t>(std::numeric_limits<vertex_t>::max()),
+                  "Invalid input argument: scale too large for vertex_t.");
+  CUGRAPH_EXPECTS((size_t{1} << scale) * edge_factor <=
+                    static_cast<size_t>(std::numeric_limits<edge_t>::max()),
+                  "Invalid input argument: scale * edge_factor too large for edge_t.");
+  CUGRAPH_EXPECTS((a >= 0.0) && (b >= 0.0) && (c >= 0.0) && (a + b + c <= 1.0),
+                  "Invalid input argument: a, b, c should be non-negative and a + b + c should not "
+                  "be larger than 1.0.");
+
+  auto comm_size     = int{1};
+  auto row_comm_size = int{1};
+  auto row_comm_rank = int{0};
+  auto col_comm_size = int{1};
+  auto col_comm_rank = int{0};
+  if (multi_gpu) {
+    auto& row_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+    auto& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+    comm_size      = handle.get_comms().get_size();
+    row_comm_size  = row_comm.get_size();
+    row_comm_rank  = row_comm.get_rank();
+    col_comm_size  = col_comm.get_size();
+    col_comm_rank  = col_comm.get_rank();
+  }
+  auto comm_size_bits     = log2_if_power_of_two(static_cast<size_t>(comm_size));
+  auto col_comm_size_bits = log2_if_power_of_two(static_cast<size_t>(col_comm_size));
+  CUGRAPH_EXPECTS(comm_size_bits <= scale,
+                  "Invalid input argument: scale should be at least log2(the number of GPUs).");
+
+  auto number_of_vertices = static_cast<vertex_t>(size_t{1} << scale);
+  auto number_of_edges    = static_cast<edge_t>((size_t{1} << scale) * edge_factor);
+
+  // vertex partition i holds the vertices whose top comm_size_bits bits are i, so every
+  // adjacency matrix partition block is a block of the R-mat recursion
+
+  std::vector<vertex_t> vertex_partition_offsets(comm_size + 1);
+  for (int i = 0; i <= comm_size; ++i) {
+    vertex_partition_offsets[i] =
+      static_cast<vertex_t>((size_t{1} << (scale - comm_size_bits)) * i);
+  }
+
+  // 1. every GPU computes the same multinomial split of the edges over the (major vertex
+  // partition, minor vertex partition range) blocks, blocks are ordered by major vertex partition
+
+  auto num_blocks = static_cast<size_t>(comm_size) * static_cast<size_t>(col_comm_size);
+  std::vector<uint64_t> block_edge_counts(num_blocks);
+  {
+    std::mt19937_64 gen(seed);
+    auto remaining_edges       = static_cast<uint64_t>(number_of_edges);
+    auto remaining_probability = 1.0;
+    for (size_t i = 0; i < num_blocks; ++i) {
+      auto major_prefix = i / col_comm_size;
+      auto minor_prefix = i % col_comm_size;
+      auto p            = store_transposed ? compute_rmat_block_probability(minor_prefix,
+                                                                 col_comm_size_bits,
+                                                                 major_prefix,
+                                                                 comm_size_bits,
+                                                                 a,
+                                                                 b,
+                                                                 c)
+                                : compute_rmat_block_probability(major_prefix,
+                                                                 comm_size_bits,
+                                                                 minor_prefix,
+                                                                 col_comm_size_bits,
+                                                                 a,
+                                                                 b,
+                                                                 c);
+      if (i == num_blocks - 1) {
+        block_edge_counts[i] = remaining_edges;
+      } else {
+        auto conditional_p = remaining_probability > 0.0
+                               ? std::min(std::max(p / remaining_probability, 0.0), 1.0)
+                               : 0.0;
+        std::binomial_distribution<uint64_t> dist(remaining_edges, conditional_p);
+        block_edge_counts[i] = dist(gen);
+      }
+      remaining_edges -= block_edge_counts[i];
+      remaining_probability -= p;
+    }
+  }
+
+  // 2. generate the edges of the local blocks (local adjacency matrix partition i holds the
+  // majors in vertex partition i * row_comm_size + row_comm_rank and the minors in vertex
+  // partitions [col_comm_rank * row_comm_size, (col_comm_rank + 1) * row_comm_size))
+
+  std::vector<rmm::device_uvector<vertex_t>> edgelist_rows{};
+  std::vector<rmm::device_uvector<vertex_t>> edgelist_cols{};
+  std::vector<rmm::device_uvector<weight_t>> edgelist_weights{};
+  std::vector<edgelist_t<vertex_t, edge_t, weight_t>> edgelists{};
+  edgelist_rows.reserve(col_comm_size);
+  edgelist_cols.reserve(col_comm_size);
+  edgelist_weights.reserve(col_comm_size);
+  edgelists.reserve(col_comm_size);
+  for (int i = 0; i < col_comm_size; ++i) {
+    auto major_prefix = static_cast<size_t>(i * row_comm_size + row_comm_rank);
+    auto minor_prefix = static_cast<size_t>(col_comm_rank);
+    auto block_idx    = major_prefix * col_comm_size + minor_prefix;
+
+    rmm::device_uvector<vertex_t> d_rows(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_cols(0, handle.get_stream());
+    std::tie(d_rows, d_cols) = generate_rmat_block_edgelist<vertex_t>(
+      handle,
+      scale,
+      block_edge_counts[block_idx],
+      a,
+      b,
+      c,
+      seed + 1 + block_idx,
+      store_transposed ? minor_prefix : major_prefix,
+      store_transposed ? col_comm_size_bits : comm_size_bits,
+      store_transposed ? major_prefix : minor_prefix,
+      store_transposed ? comm_size_bits : col_comm_size_bits);
+
+    rmm::device_uvector<weight_t> d_weights(generate_weights ? d_rows.size() : size_t{0},
+                                            handle.get_stream());
+    if (generate_weights) {
+      raft::random::Rng rng(seed + 1 + num_blocks + block_idx);
+      rng.uniform<weight_t, size_t>(
+        d_weights.data(), d_weights.size(), weight_t{0.0}, weight_t{1.0}, handle.get_stream());
+    }
+
+    edgelists.push_back(edgelist_t<vertex_t, edge_t, weight_t>{
+      d_rows.data(),
+      d_cols.data(),
+      generate_weights ? d_weights.data() : static_cast<weight_t*>(nullptr),
+      static_cast<edge_t>(d_rows.size())});
+    edgelist_rows.push_back(std::move(d_rows));
+    edgelist_cols.push_back(std::move(d_cols));
+    edgelist_weights.push_back(std::move(d_weights));
+  }
+
+  // 3. create a graph (the generated vertex IDs serve as internal vertex IDs, scrambled vertex
+  // IDs serve as external vertex IDs)
+
+  auto graph = create_graph<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+    handle,
+    edgelists,
+    vertex_partition_offsets,
+    number_of_vertices,
+    number_of_edges,
+    graph_properties_t{false, true, generate_weights, false},
+    do_expensive_check);
+
+  auto local_vertex_first = vertex_partition_offsets[col_comm_rank * row_comm_size + row_comm_rank];
+  auto local_vertex_last =
+    vertex_partition_offsets[col_comm_rank * row_comm_size + row_comm_rank + 1];
+  rmm::device_uvector<vertex_t> renumber_map_labels(
+    scramble_vertex_ids ? local_vertex_last - local_vertex_first : vertex_t{0},
+    handle.get_stream());
+  if (scramble_vertex_ids) {
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      thrust::make_counting_iterator(local_vertex_first),
+                      thrust::make_counting_iterator(local_vertex_last),
+                      renumber_map_labels.begin(),
+                      [scale] __device__(auto v) { return detail::scramble(v, scale); });
+  }
+
+  return std::make_tuple(std::move(graph), std::move(renumber_map_labels));
+}
+
+// explicit instantiation
+
+template std::tuple<graph_t<int32_t, int32_t, float, false, false>, rmm::device_uvector<int32_t>>
+generate_rmat_graph<int32_t, int32_t, float, false, false>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int32_t, double, false, false>, rmm::device_uvector<int32_t>>
+generate_rmat_graph<int32_t, int32_t, double, false, false>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, float, false, false>, rmm::device_uvector<int32_t>>
+generate_rmat_graph<int32_t, int64_t, float, false, false>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, double, false, false>, rmm::device_uvector<int32_t>>
+generate_rmat_graph<int32_t, int64_t, double, false, false>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, float, false, false>, rmm::device_uvector<int64_t>>
+generate_rmat_graph<int64_t, int64_t, float, false, false>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, double, false, false>, rmm::device_uvector<int64_t>>
+generate_rmat_graph<int64_t, int64_t, double, false, false>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int32_t, float, true, false>, rmm::device_uvector<int32_t>>
+generate_rmat_graph<int32_t, int32_t, float, true, false>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int32_t, double, true, false>, rmm::device_uvector<int32_t>>
+generate_rmat_graph<int32_t, int32_t, double, true, false>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, float, true, false>, rmm::device_uvector<int32_t>>
+generate_rmat_graph<int32_t, int64_t, float, true, false>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, double, true, false>, rmm::device_uvector<int32_t>>
+generate_rmat_graph<int32_t, int64_t, double, true, false>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, float, true, false>, rmm::device_uvector<int64_t>>
+generate_rmat_graph<int64_t, int64_t, float, true, false>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, double, true, false>, rmm::device_uvector<int64_t>>
+generate_rmat_graph<int64_t, int64_t, double, true, false>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int32_t, float, false, true>, rmm::device_uvector<int32_t>>
+generate_rmat_graph<int32_t, int32_t, float, false, true>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int32_t, double, false, true>, rmm::device_uvector<int32_t>>
+generate_rmat_graph<int32_t, int32_t, double, false, true>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, float, false, true>, rmm::device_uvector<int32_t>>
+generate_rmat_graph<int32_t, int64_t, float, false, true>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, double, false, true>, rmm::device_uvector<int32_t>>
+generate_rmat_graph<int32_t, int64_t, double, false, true>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, float, false, true>, rmm::device_uvector<int64_t>>
+generate_rmat_graph<int64_t, int64_t, float, false, true>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, double, false, true>, rmm::device_uvector<int64_t>>
+generate_rmat_graph<int64_t, int64_t, double, false, true>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int32_t, float, true, true>, rmm::device_uvector<int32_t>>
+generate_rmat_graph<int32_t, int32_t, float, true, true>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int32_t, double, true, true>, rmm::device_uvector<int32_t>>
+generate_rmat_graph<int32_t, int32_t, double, true, true>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, float, true, true>, rmm::device_uvector<int32_t>>
+generate_rmat_graph<int32_t, int64_t, float, true, true>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, double, true, true>, rmm::device_uvector<int32_t>>
+generate_rmat_graph<int32_t, int64_t, double, true, true>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, float, true, true>, rmm::device_uvector<int64_t>>
+generate_rmat_graph<int64_t, int64_t, float, true, true>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, double, true, true>, rmm::device_uvector<int64_t>>
+generate_rmat_graph<int64_t, int64_t, double, true, true>(raft::handle_t const& handle,
+                                                  size_t scale,
+                                                  size_t edge_factor,
+                                                  double a,
+                                                  double b,
+                                                  double c,
+                                                  uint64_t seed,
+                                                  bool scramble_vertex_ids,
+                                                  bool generate_weights,
+                                                  bool do_expensive_check);
+
+}  // namespace experimental
+}  // namespace cugraph
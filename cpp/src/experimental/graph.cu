@@ -18,6 +18,7 @@
 #include <experimental/graph.hpp>
 #include <partition_manager.hpp>
 #include <utilities/error.hpp>
+#include <utilities/graph_storage.hpp>
 #include <utilities/host_scalar_comm.cuh>
 
 #include <rmm/thrust_rmm_allocator.h>
@@ -27,13 +28,19 @@
 
 #include <thrust/adjacent_difference.h>
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
 #include <thrust/fill.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
 #include <thrust/tuple.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <tuple>
 
 namespace cugraph {
@@ -59,6 +66,53 @@ struct out_of_range_t {
   }
 };
 
+template <typename vertex_t>
+struct minor_out_of_range_t {
+  vertex_t minor_first{};
+  vertex_t minor_last{};
+
+  __device__ bool operator()(vertex_t minor) const
+  {
+    return (minor < minor_first) || (minor >= minor_last);
+  }
+};
+
+template <typename vertex_t>
+struct minor_to_local_index_t {
+  vertex_t minor_first{};
+
+  __device__ uint32_t operator()(vertex_t minor) const
+  {
+    return static_cast<uint32_t>(minor - minor_first);
+  }
+};
+
+template <typename vertex_t>
+struct is_duplicate_edge_t {
+  vertex_t const *major_offsets{nullptr};
+  vertex_t const *indices{nullptr};
+
+  __device__ bool operator()(size_t i) const
+  {
+    return (major_offsets[i] == major_offsets[i - 1]) && (indices[i] == indices[i - 1]);
+  }
+};
+
+// edges with the same (major, minor) pair appear next to each other if neighbor lists are sorted
+template <typename vertex_t, typename edge_t>
+size_t count_duplicate_edges_in_sorted_neighbor_lists(rmm::device_uvector<edge_t> const &offsets,
+                                                      rmm::device_uvector<vertex_t> const &indices,
+                                                      cudaStream_t stream)
+{
+  if (indices.size() <= 1) { return size_t{0}; }
+  auto major_offsets = detail::compute_edge_major_offsets<vertex_t>(
+    offsets, static_cast<edge_t>(indices.size()), stream);
+  return thrust::count_if(rmm::exec_policy(stream)->on(stream),
+                          thrust::make_counting_iterator(size_t{1}),
+                          thrust::make_counting_iterator(indices.size()),
+                          is_duplicate_edge_t<vertex_t>{major_offsets.data(), indices.data()});
+}
+
 template <bool store_transposed, typename vertex_t, typename edge_t, typename weight_t>
 std::
   tuple<rmm::device_uvector<edge_t>, rmm::device_uvector<vertex_t>, rmm::device_uvector<weight_t>>
@@ -68,6 +122,7 @@ std::
                                 vertex_t minor_first,
                                 vertex_t minor_last,
                                 bool is_weighted,
+                                bool has_sorted_neighbor_lists,
                                 cudaStream_t stream)
 {
   rmm::device_uvector<edge_t> offsets((major_last - major_first) + 1, stream);
@@ -148,11 +203,114 @@ std::
                      });
   }
 
-  // FIXME: need to add an option to sort neighbor lists
+  if (has_sorted_neighbor_lists) {
+    detail::sort_neighbor_lists(offsets, indices, weights, is_weighted, stream);
+  }
 
   return std::make_tuple(std::move(offsets), std::move(indices), std::move(weights));
 }
 
+// convert the [major_hypersparse_first, major_last) part of the CSR (or CSC) offsets to DCSR (or
+// DCSC); returns an empty nzd vertex list (and leaves offsets as is) if DCSR (or DCSC) does not
+// reduce memory footprint
+template <typename vertex_t, typename edge_t>
+std::tuple<rmm::device_uvector<edge_t>, rmm::device_uvector<vertex_t>, bool>
+compressed_sparse_to_hypersparse(rmm::device_uvector<edge_t> &&offsets,
+                                 vertex_t major_first,
+                                 vertex_t major_hypersparse_first,
+                                 vertex_t major_last,
+                                 cudaStream_t stream)
+{
+  auto p_offsets = offsets.data();
+  auto nzd_vertex_count =
+    static_cast<vertex_t>(thrust::count_if(rmm::exec_policy(stream)->on(stream),
+                                           thrust::make_counting_iterator(major_hypersparse_first),
+                                           thrust::make_counting_iterator(major_last),
+                                           [p_offsets, major_first] __device__(auto major) {
+                                             auto major_offset = major - major_first;
+                                             return p_offsets[major_offset + 1] -
+                                                      p_offsets[major_offset] >
+                                                    0;
+                                           }));
+
+  rmm::device_uvector<vertex_t> dcs_nzd_vertices(0, stream);
+  if (static_cast<size_t>(nzd_vertex_count) * (sizeof(vertex_t) + sizeof(edge_t)) >=
+      static_cast<size_t>(major_last - major_hypersparse_first) * sizeof(edge_t)) {
+    return std::make_tuple(std::move(offsets), std::move(dcs_nzd_vertices), false);
+  }
+
+  dcs_nzd_vertices.resize(nzd_vertex_count, stream);
+  thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                  thrust::make_counting_iterator(major_hypersparse_first),
+                  thrust::make_counting_iterator(major_last),
+                  dcs_nzd_vertices.begin(),
+                  [p_offsets, major_first] __device__(auto major) {
+                    auto major_offset = major - major_first;
+                    return p_offsets[major_offset + 1] - p_offsets[major_offset] > 0;
+                  });
+
+  auto dense_size = major_hypersparse_first - major_first;
+  rmm::device_uvector<edge_t> compressed_offsets(dense_size + nzd_vertex_count + 1, stream);
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               offsets.begin(),
+               offsets.begin() + (dense_size + 1),
+               compressed_offsets.begin());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    dcs_nzd_vertices.begin(),
+                    dcs_nzd_vertices.end(),
+                    compressed_offsets.begin() + (dense_size + 1),
+                    [p_offsets, major_first] __device__(auto major) {
+                      return p_offsets[(major - major_first) + 1];
+                    });
+
+  return std::make_tuple(std::move(compressed_offsets), std::move(dcs_nzd_vertices), true);
+}
+
+// store minors as 32 bit offsets from minor_first if vertex_t is wider than 32 bits and the local
+// minor range fits in 32 bits (this halves the memory footprint and bandwidth requirement of the
+// index arrays)
+template <typename vertex_t>
+bool use_local_minor_indices(partition_t<vertex_t> const &partition)
+{
+  return (sizeof(vertex_t) > sizeof(uint32_t)) &&
+         (static_cast<uint64_t>(partition.get_matrix_partition_minor_last() -
+                                partition.get_matrix_partition_minor_first()) <=
+          static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()));
+}
+
+// convert indices to 32 bit local indices (indices is released to cut peak memory usage), local
+// indices are allocated from the memory resource of indices (e.g. managed memory)
+template <typename vertex_t>
+rmm::device_uvector<uint32_t> indices_to_local_indices(rmm::device_uvector<vertex_t> &indices,
+                                                       vertex_t minor_first,
+                                                       cudaStream_t stream)
+{
+  rmm::device_uvector<uint32_t> local_indices(indices.size(), stream, indices.memory_resource());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    indices.begin(),
+                    indices.end(),
+                    local_indices.begin(),
+                    minor_to_local_index_t<vertex_t>{minor_first});
+  detail::advise_read_mostly(local_indices.data(), local_indices.size() * sizeof(uint32_t));
+  indices.resize(0, stream);
+  indices.shrink_to_fit(stream);
+  return local_indices;
+}
+
+// neighbor lists are sorted if (major offset, minor) pairs are sorted
+template <typename vertex_t, typename edge_t>
+bool is_sorted_neighbor_lists(rmm::device_uvector<edge_t> const &offsets,
+                              rmm::device_uvector<vertex_t> const &indices,
+                              cudaStream_t stream)
+{
+  auto major_offsets = detail::compute_edge_major_offsets<vertex_t>(
+    offsets, static_cast<edge_t>(indices.size()), stream);
+  auto edge_first =
+    thrust::make_zip_iterator(thrust::make_tuple(major_offsets.begin(), indices.begin()));
+  return thrust::is_sorted(
+    rmm::exec_policy(stream)->on(stream), edge_first, edge_first + indices.size());
+}
+
 }  // namespace
 
 template <typename vertex_t,
@@ -208,7 +366,7 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
   CUGRAPH_EXPECTS(edgelists.size() == static_cast<size_t>(col_comm_size),
                   "Invalid input argument: errneous edgelists.size().");
 
-  // optional expensive checks (part 1/3)
+  // optional expensive checks (part 1/4)
 
   if (do_expensive_check) {
     edge_t number_of_local_edges_sum{};
@@ -246,8 +404,11 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
 
   // convert edge list (COO) to compressed sparse format (CSR or CSC)
 
+  auto use_local_indices = use_local_minor_indices(partition);
+
   adj_matrix_partition_offsets_.reserve(edgelists.size());
   adj_matrix_partition_indices_.reserve(edgelists.size());
+  adj_matrix_partition_local_indices_.reserve(use_local_indices ? edgelists.size() : 0);
   adj_matrix_partition_weights_.reserve(properties.is_weighted ? edgelists.size() : 0);
   for (size_t i = 0; i < edgelists.size(); ++i) {
     vertex_t major_first{};
@@ -267,8 +428,25 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
                                                       minor_first,
                                                       minor_last,
                                                       properties.is_weighted,
+                                                      properties.has_sorted_neighbor_lists,
                                                       this->get_handle_ptr()->get_stream());
+
+    // optional expensive checks (part 2/4)
+
+    if (do_expensive_check && properties.has_sorted_neighbor_lists && !this->is_multigraph()) {
+      CUGRAPH_EXPECTS(
+        count_duplicate_edges_in_sorted_neighbor_lists(offsets, indices, default_stream) == 0,
+        "Invalid input argument: is_multigraph is set to false, but edgelists[] have duplicate "
+        "edges.");
+    }
+
     adj_matrix_partition_offsets_.push_back(std::move(offsets));
+    if (use_local_indices) {
+      // FIXME: we may directly create local indices in edgelist_to_compressed_sparse to cut peak
+      // memory usage as well
+      adj_matrix_partition_local_indices_.push_back(
+        indices_to_local_indices(indices, minor_first, default_stream));
+    }
     adj_matrix_partition_indices_.push_back(std::move(indices));
     if (properties.is_weighted) { adj_matrix_partition_weights_.push_back(std::move(weights)); }
   }
@@ -276,77 +454,258 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
   // update degree-based segment offsets (to be used for graph analytics kernel optimization)
 
   if (sorted_by_global_degree_within_vertex_partition) {
-    auto degrees = detail::compute_major_degrees(
-      *(this->get_handle_ptr()), adj_matrix_partition_offsets_, partition_);
-
-    // optional expensive checks (part 2/3)
-
-    if (do_expensive_check) {
-      CUGRAPH_EXPECTS(thrust::is_sorted(rmm::exec_policy(default_stream)->on(default_stream),
-                                        degrees.begin(),
-                                        degrees.end(),
-                                        thrust::greater<edge_t>{}),
-                      "Invalid input argument: sorted_by_global_degree_within_vertex_partition is "
-                      "set to true, but degrees are not non-ascending.");
+    update_segment_offsets_and_hypersparse(do_expensive_check);
+  }
+
+  // optional expensive checks (part 4/4)
+
+  if (do_expensive_check) {
+    // FIXME: check for symmetricity may better be implemetned with transpose().
+    if (this->is_symmetric()) {}
+    // FIXME: check for duplicate edges if neighbor lists are not sorted (this is checked in part
+    // 2/4 if neighbor lists are sorted).
+    if (!this->is_multigraph() && !this->has_sorted_neighbor_lists()) {}
+  }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  graph_t(raft::handle_t const &handle,
+          std::vector<rmm::device_uvector<edge_t>> &&adj_matrix_partition_offsets,
+          std::vector<rmm::device_uvector<vertex_t>> &&adj_matrix_partition_indices,
+          std::vector<rmm::device_uvector<weight_t>> &&adj_matrix_partition_weights,
+          partition_t<vertex_t> const &partition,
+          vertex_t number_of_vertices,
+          edge_t number_of_edges,
+          graph_properties_t properties,
+          bool sorted_by_global_degree_within_vertex_partition,
+          bool do_expensive_check)
+  : detail::graph_base_t<vertex_t, edge_t, weight_t>(
+      handle, number_of_vertices, number_of_edges, properties),
+    partition_(partition)
+{
+  // cheap error checks
+
+  auto &comm           = this->get_handle_ptr()->get_comms();
+  auto const comm_size = comm.get_size();
+  auto &col_comm =
+    this->get_handle_ptr()->get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+  auto const col_comm_size = col_comm.get_size();
+  auto default_stream      = this->get_handle_ptr()->get_stream();
+
+  CUGRAPH_EXPECTS((adj_matrix_partition_offsets.size() == static_cast<size_t>(col_comm_size)) &&
+                    (adj_matrix_partition_indices.size() == static_cast<size_t>(col_comm_size)),
+                  "Invalid input argument: erroneous adj_matrix_partition_offsets.size() or "
+                  "adj_matrix_partition_indices.size().");
+  CUGRAPH_EXPECTS(adj_matrix_partition_weights.size() ==
+                    (properties.is_weighted ? static_cast<size_t>(col_comm_size) : size_t{0}),
+                  "Invalid input argument: erroneous adj_matrix_partition_weights.size().");
+  for (size_t i = 0; i < adj_matrix_partition_offsets.size(); ++i) {
+    CUGRAPH_EXPECTS(adj_matrix_partition_offsets[i].size() ==
+                      static_cast<size_t>(partition.get_matrix_partition_major_size(i)) + 1,
+                    "Invalid input argument: erroneous adj_matrix_partition_offsets[].size().");
+    CUGRAPH_EXPECTS(
+      !properties.is_weighted ||
+        (adj_matrix_partition_weights[i].size() == adj_matrix_partition_indices[i].size()),
+      "Invalid input argument: adj_matrix_partition_weights[].size() should coincide with "
+      "adj_matrix_partition_indices[].size().");
+  }
+
+  // optional expensive checks (part 1/4)
+
+  if (do_expensive_check) {
+    edge_t number_of_local_edges_sum{};
+    for (size_t i = 0; i < adj_matrix_partition_offsets.size(); ++i) {
+      auto const &offsets = adj_matrix_partition_offsets[i];
+      auto const &indices = adj_matrix_partition_indices[i];
+
+      number_of_local_edges_sum += static_cast<edge_t>(indices.size());
+
+      CUGRAPH_EXPECTS(
+        offsets.element(offsets.size() - 1, default_stream) == static_cast<edge_t>(indices.size()),
+        "Invalid input argument: adj_matrix_partition_offsets[] and "
+        "adj_matrix_partition_indices[] do not match.");
+      // better use thrust::any_of once https://github.com/thrust/thrust/issues/1016 is resolved
+      CUGRAPH_EXPECTS(thrust::count_if(rmm::exec_policy(default_stream)->on(default_stream),
+                                       indices.begin(),
+                                       indices.end(),
+                                       minor_out_of_range_t<vertex_t>{
+                                         partition.get_matrix_partition_minor_first(),
+                                         partition.get_matrix_partition_minor_last()}) == 0,
+                      "Invalid input argument: adj_matrix_partition_indices[] have out-of-range "
+                      "values.");
     }
+    number_of_local_edges_sum =
+      host_scalar_allreduce(comm, number_of_local_edges_sum, default_stream);
+    CUGRAPH_EXPECTS(
+      number_of_local_edges_sum == this->get_number_of_edges(),
+      "Invalid input argument: the sum of local edge counts does not match with number_of_edges.");
 
-    static_assert(detail::num_segments_per_vertex_partition == 3);
-    static_assert((detail::low_degree_threshold <= detail::mid_degree_threshold) &&
-                  (detail::mid_degree_threshold <= std::numeric_limits<edge_t>::max()));
-    rmm::device_uvector<edge_t> d_thresholds(detail::num_segments_per_vertex_partition - 1,
-                                             default_stream);
-    std::vector<edge_t> h_thresholds = {static_cast<edge_t>(detail::low_degree_threshold),
-                                        static_cast<edge_t>(detail::mid_degree_threshold)};
-    raft::update_device(
-      d_thresholds.data(), h_thresholds.data(), h_thresholds.size(), default_stream);
-
-    rmm::device_uvector<vertex_t> segment_offsets(detail::num_segments_per_vertex_partition + 1,
-                                                  default_stream);
-
-    // temporaries are necessary because the &&-overload of device_uvector is deleted
-    // Note that we must sync `default_stream` before these temporaries go out of scope to
-    // avoid use after free. (The syncs are at the end of this function)
-    auto zero_vertex  = vertex_t{0};
-    auto vertex_count = static_cast<vertex_t>(degrees.size());
-    segment_offsets.set_element_async(0, zero_vertex, default_stream);
-    segment_offsets.set_element_async(
-      detail::num_segments_per_vertex_partition, vertex_count, default_stream);
-
-    thrust::upper_bound(rmm::exec_policy(default_stream)->on(default_stream),
-                        degrees.begin(),
-                        degrees.end(),
-                        d_thresholds.begin(),
-                        d_thresholds.end(),
-                        segment_offsets.begin() + 1);
-
-    rmm::device_uvector<vertex_t> aggregate_segment_offsets(col_comm_size * segment_offsets.size(),
-                                                            default_stream);
-    col_comm.allgather(segment_offsets.data(),
-                       aggregate_segment_offsets.data(),
-                       segment_offsets.size(),
-                       default_stream);
-
-    vertex_partition_segment_offsets_.resize(aggregate_segment_offsets.size());
-    raft::update_host(vertex_partition_segment_offsets_.data(),
-                      aggregate_segment_offsets.data(),
-                      aggregate_segment_offsets.size(),
-                      default_stream);
-
-    auto status = col_comm.sync_stream(
-      default_stream);  // this is necessary as degrees, d_thresholds, and segment_offsets will
-                        // become out-of-scope once control flow exits this block and
-                        // vertex_partition_segment_offsets_ can be used right after return.
-    CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
+    CUGRAPH_EXPECTS(
+      partition.get_vertex_partition_last(comm_size - 1) == number_of_vertices,
+      "Invalid input argument: vertex partition should cover [0, number_of_vertices).");
+  }
+
+  // optional expensive checks (part 2/4)
+
+  if (do_expensive_check && properties.has_sorted_neighbor_lists) {
+    for (size_t i = 0; i < adj_matrix_partition_offsets.size(); ++i) {
+      CUGRAPH_EXPECTS(is_sorted_neighbor_lists(adj_matrix_partition_offsets[i],
+                                               adj_matrix_partition_indices[i],
+                                               default_stream),
+                      "Invalid input argument: has_sorted_neighbor_lists is set to true, but "
+                      "adj_matrix_partition_indices[] have unsorted neighbor lists.");
+      if (!this->is_multigraph()) {
+        CUGRAPH_EXPECTS(count_duplicate_edges_in_sorted_neighbor_lists(
+                          adj_matrix_partition_offsets[i],
+                          adj_matrix_partition_indices[i],
+                          default_stream) == 0,
+                        "Invalid input argument: is_multigraph is set to false, but "
+                        "adj_matrix_partition_indices[] have duplicate edges.");
+      }
+    }
+  }
+
+  // take ownership of the compressed sparse arrays
+
+  auto use_local_indices = use_local_minor_indices(partition);
+
+  adj_matrix_partition_offsets_ = std::move(adj_matrix_partition_offsets);
+  adj_matrix_partition_indices_ = std::move(adj_matrix_partition_indices);
+  if (use_local_indices) {
+    adj_matrix_partition_local_indices_.reserve(adj_matrix_partition_indices_.size());
+    for (size_t i = 0; i < adj_matrix_partition_indices_.size(); ++i) {
+      adj_matrix_partition_local_indices_.push_back(
+        indices_to_local_indices(adj_matrix_partition_indices_[i],
+                                 partition.get_matrix_partition_minor_first(),
+                                 default_stream));
+    }
+  }
+  if (properties.is_weighted) {
+    adj_matrix_partition_weights_ = std::move(adj_matrix_partition_weights);
+  }
+
+  // update degree-based segment offsets (to be used for graph analytics kernel optimization)
+
+  if (sorted_by_global_degree_within_vertex_partition) {
+    update_segment_offsets_and_hypersparse(do_expensive_check);
   }
 
-  // optional expensive checks (part 3/3)
+  // optional expensive checks (part 4/4)
 
   if (do_expensive_check) {
     // FIXME: check for symmetricity may better be implemetned with transpose().
     if (this->is_symmetric()) {}
-    // FIXME: check for duplicate edges may better be implemented after deciding whether to sort
-    // neighbor list or not.
-    if (!this->is_multigraph()) {}
+    // FIXME: check for duplicate edges if neighbor lists are not sorted (this is checked in part
+    // 2/4 if neighbor lists are sorted).
+    if (!this->is_multigraph() && !this->has_sorted_neighbor_lists()) {}
+  }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  update_segment_offsets_and_hypersparse(bool do_expensive_check)
+{
+  auto &col_comm =
+    this->get_handle_ptr()->get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+  auto const col_comm_size = col_comm.get_size();
+  auto default_stream      = this->get_handle_ptr()->get_stream();
+
+  auto degrees = detail::compute_major_degrees(
+    *(this->get_handle_ptr()), adj_matrix_partition_offsets_, partition_);
+
+  // optional expensive checks (part 3/4)
+
+  if (do_expensive_check) {
+    CUGRAPH_EXPECTS(thrust::is_sorted(rmm::exec_policy(default_stream)->on(default_stream),
+                                      degrees.begin(),
+                                      degrees.end(),
+                                      thrust::greater<edge_t>{}),
+                    "Invalid input argument: sorted_by_global_degree_within_vertex_partition is "
+                    "set to true, but degrees are not non-ascending.");
+  }
+
+  static_assert(detail::num_segments_per_vertex_partition == 3);
+  static_assert((detail::low_degree_threshold <= detail::mid_degree_threshold) &&
+                (detail::mid_degree_threshold <= std::numeric_limits<edge_t>::max()));
+  rmm::device_uvector<edge_t> d_thresholds(detail::num_segments_per_vertex_partition - 1,
+                                           default_stream);
+  std::vector<edge_t> h_thresholds = {static_cast<edge_t>(detail::low_degree_threshold),
+                                      static_cast<edge_t>(detail::mid_degree_threshold)};
+  raft::update_device(
+    d_thresholds.data(), h_thresholds.data(), h_thresholds.size(), default_stream);
+
+  rmm::device_uvector<vertex_t> segment_offsets(detail::num_segments_per_vertex_partition + 1,
+                                                default_stream);
+
+  // temporaries are necessary because the &&-overload of device_uvector is deleted
+  // Note that we must sync `default_stream` before these temporaries go out of scope to
+  // avoid use after free. (The syncs are at the end of this function)
+  auto zero_vertex  = vertex_t{0};
+  auto vertex_count = static_cast<vertex_t>(degrees.size());
+  segment_offsets.set_element_async(0, zero_vertex, default_stream);
+  segment_offsets.set_element_async(
+    detail::num_segments_per_vertex_partition, vertex_count, default_stream);
+
+  thrust::upper_bound(rmm::exec_policy(default_stream)->on(default_stream),
+                      degrees.begin(),
+                      degrees.end(),
+                      d_thresholds.begin(),
+                      d_thresholds.end(),
+                      segment_offsets.begin() + 1);
+
+  rmm::device_uvector<vertex_t> aggregate_segment_offsets(col_comm_size * segment_offsets.size(),
+                                                          default_stream);
+  col_comm.allgather(segment_offsets.data(),
+                     aggregate_segment_offsets.data(),
+                     segment_offsets.size(),
+                     default_stream);
+
+  vertex_partition_segment_offsets_.resize(aggregate_segment_offsets.size());
+  raft::update_host(vertex_partition_segment_offsets_.data(),
+                    aggregate_segment_offsets.data(),
+                    aggregate_segment_offsets.size(),
+                    default_stream);
+
+  auto status = col_comm.sync_stream(
+    default_stream);  // this is necessary as degrees, d_thresholds, and segment_offsets will
+                      // become out-of-scope once control flow exits this block and
+                      // vertex_partition_segment_offsets_ can be used right after return.
+  CUGRAPH_EXPECTS(status == raft::comms::status_t::SUCCESS, "sync_stream() failure.");
+
+  // store the low-degree segments in DCSR (or DCSC) format, with 2D partitioning, a large
+  // fraction of the low (global) degree majors have zero local degree in each matrix partition
+
+  adj_matrix_partition_dcs_nzd_vertices_.reserve(adj_matrix_partition_offsets_.size());
+  adj_matrix_partition_major_hypersparse_firsts_.reserve(adj_matrix_partition_offsets_.size());
+  for (size_t i = 0; i < adj_matrix_partition_offsets_.size(); ++i) {
+    vertex_t major_first{};
+    vertex_t major_last{};
+    std::tie(major_first, major_last) = partition_.get_matrix_partition_major_range(i);
+    auto low_degree_segment_first_idx = (detail::num_segments_per_vertex_partition + 1) * i +
+                                        (detail::num_segments_per_vertex_partition - 1);
+    auto major_hypersparse_first =
+      major_first + vertex_partition_segment_offsets_[low_degree_segment_first_idx];
+
+    rmm::device_uvector<vertex_t> dcs_nzd_vertices(0, default_stream);
+    bool use_dcs{false};
+    std::tie(adj_matrix_partition_offsets_[i], dcs_nzd_vertices, use_dcs) =
+      compressed_sparse_to_hypersparse(std::move(adj_matrix_partition_offsets_[i]),
+                                       major_first,
+                                       major_hypersparse_first,
+                                       major_last,
+                                       default_stream);
+    adj_matrix_partition_dcs_nzd_vertices_.push_back(std::move(dcs_nzd_vertices));
+    adj_matrix_partition_major_hypersparse_firsts_.push_back(use_dcs ? major_hypersparse_first
+                                                                     : major_last);
   }
 }
 
@@ -382,7 +741,7 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
     "not be nullptr if edgelist.number_of_edges > 0 and edgelist.p_edge_weights should be nullptr "
     "if unweighted or should not be nullptr if weighted and edgelist.number_of_edges > 0.");
 
-  // optional expensive checks (part 1/2)
+  // optional expensive checks (part 1/4)
 
   if (do_expensive_check) {
     auto edge_first = thrust::make_zip_iterator(
@@ -413,76 +772,175 @@ graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_
                                                     vertex_t{0},
                                                     this->get_number_of_vertices(),
                                                     properties.is_weighted,
+                                                    properties.has_sorted_neighbor_lists,
                                                     this->get_handle_ptr()->get_stream());
 
+  // optional expensive checks (part 2/4)
+
+  if (do_expensive_check && properties.has_sorted_neighbor_lists && !this->is_multigraph()) {
+    CUGRAPH_EXPECTS(
+      count_duplicate_edges_in_sorted_neighbor_lists(offsets_, indices_, default_stream) == 0,
+      "Invalid input argument: is_multigraph is set to false, but edgelist has duplicate edges.");
+  }
+
   // update degree-based segment offsets (to be used for graph analytics kernel optimization)
 
-  if (sorted_by_degree) {
-    auto degree_first = thrust::make_transform_iterator(
-      thrust::make_counting_iterator(vertex_t{0}),
-      detail::degree_from_offsets_t<vertex_t, edge_t>{offsets_.data()});
+  if (sorted_by_degree) { update_segment_offsets(do_expensive_check); }
 
-    // optional expensive checks (part 2/2)
+  // optional expensive checks (part 4/4)
 
-    if (do_expensive_check) {
-      CUGRAPH_EXPECTS(
-        thrust::is_sorted(rmm::exec_policy(default_stream)->on(default_stream),
-                          degree_first,
-                          degree_first + this->get_number_of_vertices(),
-                          thrust::greater<edge_t>{}),
-        "Invalid input argument: sorted_by_degree is set to true, but degrees are not "
-        "non-ascending.");
-    }
+  if (do_expensive_check) {
+    // FIXME: check for symmetricity may better be implemetned with transpose().
+    if (this->is_symmetric()) {}
+    // FIXME: check for duplicate edges if neighbor lists are not sorted (this is checked in part
+    // 2/4 if neighbor lists are sorted).
+    if (!this->is_multigraph() && !this->has_sorted_neighbor_lists()) {}
+  }
+}
 
-    static_assert(detail::num_segments_per_vertex_partition == 3);
-    static_assert((detail::low_degree_threshold <= detail::mid_degree_threshold) &&
-                  (detail::mid_degree_threshold <= std::numeric_limits<edge_t>::max()));
-    rmm::device_uvector<edge_t> d_thresholds(detail::num_segments_per_vertex_partition - 1,
-                                             default_stream);
-    std::vector<edge_t> h_thresholds = {static_cast<edge_t>(detail::low_degree_threshold),
-                                        static_cast<edge_t>(detail::mid_degree_threshold)};
-    raft::update_device(
-      d_thresholds.data(), h_thresholds.data(), h_thresholds.size(), default_stream);
-
-    rmm::device_uvector<vertex_t> segment_offsets(detail::num_segments_per_vertex_partition + 1,
-                                                  default_stream);
-
-    // temporaries are necessary because the &&-overload of device_uvector is deleted
-    // Note that we must sync `default_stream` before these temporaries go out of scope to
-    // avoid use after free. (The syncs are at the end of this function)
-    auto zero_vertex  = vertex_t{0};
-    auto vertex_count = static_cast<vertex_t>(this->get_number_of_vertices());
-    segment_offsets.set_element_async(0, zero_vertex, default_stream);
-
-    segment_offsets.set_element_async(
-      detail::num_segments_per_vertex_partition, vertex_count, default_stream);
-
-    thrust::upper_bound(rmm::exec_policy(default_stream)->on(default_stream),
-                        degree_first,
-                        degree_first + this->get_number_of_vertices(),
-                        d_thresholds.begin(),
-                        d_thresholds.end(),
-                        segment_offsets.begin() + 1);
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<!multi_gpu>>::
+  graph_t(raft::handle_t const &handle,
+          rmm::device_uvector<edge_t> &&offsets,
+          rmm::device_uvector<vertex_t> &&indices,
+          rmm::device_uvector<weight_t> &&weights,
+          vertex_t number_of_vertices,
+          graph_properties_t properties,
+          bool sorted_by_degree,
+          bool do_expensive_check)
+  : detail::graph_base_t<vertex_t, edge_t, weight_t>(
+      handle, number_of_vertices, static_cast<edge_t>(indices.size()), properties),
+    offsets_(std::move(offsets)),
+    indices_(std::move(indices)),
+    weights_(std::move(weights))
+{
+  // cheap error checks
+
+  auto default_stream = this->get_handle_ptr()->get_stream();
+
+  CUGRAPH_EXPECTS(offsets_.size() == static_cast<size_t>(this->get_number_of_vertices()) + 1,
+                  "Invalid input argument: erroneous offsets.size().");
+  CUGRAPH_EXPECTS(weights_.size() == (properties.is_weighted ? indices_.size() : size_t{0}),
+                  "Invalid input argument: weights.size() should coincide with indices.size() if "
+                  "weighted or should be 0 if unweighted.");
+
+  // optional expensive checks (part 1/4)
 
-    segment_offsets_.resize(segment_offsets.size());
-    raft::update_host(
-      segment_offsets_.data(), segment_offsets.data(), segment_offsets.size(), default_stream);
+  if (do_expensive_check) {
+    CUGRAPH_EXPECTS(offsets_.element(offsets_.size() - 1, default_stream) ==
+                      static_cast<edge_t>(indices_.size()),
+                    "Invalid input argument: offsets and indices do not match.");
+    // better use thrust::any_of once https://github.com/thrust/thrust/issues/1016 is resolved
+    CUGRAPH_EXPECTS(
+      thrust::count_if(
+        rmm::exec_policy(default_stream)->on(default_stream),
+        indices_.begin(),
+        indices_.end(),
+        minor_out_of_range_t<vertex_t>{vertex_t{0}, this->get_number_of_vertices()}) == 0,
+      "Invalid input argument: indices have out-of-range values.");
+  }
+
+  // optional expensive checks (part 2/4)
 
-    CUDA_TRY(cudaStreamSynchronize(
-      default_stream));  // this is necessary as segment_offsets_ can be used right after return.
+  if (do_expensive_check && properties.has_sorted_neighbor_lists) {
+    CUGRAPH_EXPECTS(is_sorted_neighbor_lists(offsets_, indices_, default_stream),
+                    "Invalid input argument: has_sorted_neighbor_lists is set to true, but indices "
+                    "have unsorted neighbor lists.");
+    if (!this->is_multigraph()) {
+      CUGRAPH_EXPECTS(
+        count_duplicate_edges_in_sorted_neighbor_lists(offsets_, indices_, default_stream) == 0,
+        "Invalid input argument: is_multigraph is set to false, but indices have duplicate "
+        "edges.");
+    }
   }
 
-  // optional expensive checks (part 3/3)
+  // update degree-based segment offsets (to be used for graph analytics kernel optimization)
+
+  if (sorted_by_degree) { update_segment_offsets(do_expensive_check); }
+
+  // optional expensive checks (part 4/4)
 
   if (do_expensive_check) {
     // FIXME: check for symmetricity may better be implemetned with transpose().
     if (this->is_symmetric()) {}
-    // FIXME: check for duplicate edges may better be implemented after deciding whether to sort
-    // neighbor list or not.
-    if (!this->is_multigraph()) {}
+    // FIXME: check for duplicate edges if neighbor lists are not sorted (this is checked in part
+    // 2/4 if neighbor lists are sorted).
+    if (!this->is_multigraph() && !this->has_sorted_neighbor_lists()) {}
   }
 }
 
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void graph_t<vertex_t,
+             edge_t,
+             weight_t,
+             store_transposed,
+             multi_gpu,
+             std::enable_if_t<!multi_gpu>>::update_segment_offsets(bool do_expensive_check)
+{
+  auto default_stream = this->get_handle_ptr()->get_stream();
+
+  auto degree_first = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(vertex_t{0}),
+    detail::degree_from_offsets_t<vertex_t, edge_t>{offsets_.data()});
+
+  // optional expensive checks (part 3/4)
+
+  if (do_expensive_check) {
+    CUGRAPH_EXPECTS(
+      thrust::is_sorted(rmm::exec_policy(default_stream)->on(default_stream),
+                        degree_first,
+                        degree_first + this->get_number_of_vertices(),
+                        thrust::greater<edge_t>{}),
+      "Invalid input argument: sorted_by_degree is set to true, but degrees are not "
+      "non-ascending.");
+  }
+
+  static_assert(detail::num_segments_per_vertex_partition == 3);
+  static_assert((detail::low_degree_threshold <= detail::mid_degree_threshold) &&
+                (detail::mid_degree_threshold <= std::numeric_limits<edge_t>::max()));
+  rmm::device_uvector<edge_t> d_thresholds(detail::num_segments_per_vertex_partition - 1,
+                                           default_stream);
+  std::vector<edge_t> h_thresholds = {static_cast<edge_t>(detail::low_degree_threshold),
+                                      static_cast<edge_t>(detail::mid_degree_threshold)};
+  raft::update_device(
+    d_thresholds.data(), h_thresholds.data(), h_thresholds.size(), default_stream);
+
+  rmm::device_uvector<vertex_t> segment_offsets(detail::num_segments_per_vertex_partition + 1,
+                                                default_stream);
+
+  // temporaries are necessary because the &&-overload of device_uvector is deleted
+  // Note that we must sync `default_stream` before these temporaries go out of scope to
+  // avoid use after free. (The syncs are at the end of this function)
+  auto zero_vertex  = vertex_t{0};
+  auto vertex_count = static_cast<vertex_t>(this->get_number_of_vertices());
+  segment_offsets.set_element_async(0, zero_vertex, default_stream);
+
+  segment_offsets.set_element_async(
+    detail::num_segments_per_vertex_partition, vertex_count, default_stream);
+
+  thrust::upper_bound(rmm::exec_policy(default_stream)->on(default_stream),
+                      degree_first,
+                      degree_first + this->get_number_of_vertices(),
+                      d_thresholds.begin(),
+                      d_thresholds.end(),
+                      segment_offsets.begin() + 1);
+
+  segment_offsets_.resize(segment_offsets.size());
+  raft::update_host(
+    segment_offsets_.data(), segment_offsets.data(), segment_offsets.size(), default_stream);
+
+  CUDA_TRY(cudaStreamSynchronize(
+    default_stream));  // this is necessary as segment_offsets_ can be used right after return.
+}
+
 // explicit instantiation
 
 template class graph_t<int32_t, int32_t, float, true, true>;
@@ -0,0 +1,840 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithms.hpp>
+#include <community/flatten_dendrogram.cuh>
+#include <experimental/graph.hpp>
+#include <experimental/graph_batch.hpp>
+#include <experimental/graph_view.hpp>
+#include <experimental/louvain.cuh>
+#include <patterns/copy_v_transform_reduce_in_out_nbr.cuh>
+#include <patterns/count_if_e.cuh>
+#include <utilities/error.hpp>
+#include <utilities/profiling.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <raft/handle.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <cub/cub.cuh>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <limits>
+
+namespace cugraph {
+namespace experimental {
+namespace detail {
+
+// the index of the segment (in [offsets[i], offsets[i + 1])) containing val
+template <typename offset_t, typename T>
+__device__ size_t find_segment(offset_t const* offsets, size_t num_segments, T val)
+{
+  return static_cast<size_t>(thrust::distance(
+    offsets + 1,
+    thrust::upper_bound(
+      thrust::seq, offsets + 1, offsets + (num_segments + 1), static_cast<offset_t>(val))));
+}
+
+template <typename vertex_t, typename edge_t>
+struct to_block_diagonal_edge_t {
+  vertex_t const* srcs{nullptr};
+  vertex_t const* dsts{nullptr};
+  edge_t const* graph_edge_offsets{nullptr};
+  vertex_t const* graph_vertex_offsets{nullptr};
+  size_t num_graphs{0};
+
+  __device__ thrust::tuple<vertex_t, vertex_t> operator()(edge_t e) const
+  {
+    auto vertex_first = graph_vertex_offsets[find_segment(graph_edge_offsets, num_graphs, e)];
+    return thrust::make_tuple(srcs[e] + vertex_first, dsts[e] + vertex_first);
+  }
+};
+
+template <typename vertex_t, typename edge_t>
+struct is_invalid_local_edge_t {
+  vertex_t const* srcs{nullptr};
+  vertex_t const* dsts{nullptr};
+  edge_t const* graph_edge_offsets{nullptr};
+  vertex_t const* graph_vertex_offsets{nullptr};
+  size_t num_graphs{0};
+
+  __device__ bool operator()(edge_t e) const
+  {
+    auto g          = find_segment(graph_edge_offsets, num_graphs, e);
+    auto num_locals = graph_vertex_offsets[g + 1] - graph_vertex_offsets[g];
+    return (srcs[e] < 0) || (srcs[e] >= num_locals) || (dsts[e] < 0) || (dsts[e] >= num_locals);
+  }
+};
+
+template <typename result_t, typename weight_t>
+struct dangling_pagerank_t {
+  __device__ result_t operator()(thrust::tuple<result_t, weight_t> val) const
+  {
+    return thrust::get<1>(val) == weight_t{0.0} ? thrust::get<0>(val) : result_t{0.0};
+  }
+};
+
+template <typename vertex_t>
+struct vertex_graph_id_t {
+  vertex_t const* vertex_graph_ids{nullptr};
+
+  __device__ vertex_t operator()(vertex_t v) const { return vertex_graph_ids[v]; }
+};
+
+template <typename T>
+struct square_t {
+  __device__ T operator()(T val) const { return val * val; }
+};
+
+template <typename result_t>
+struct abs_diff_t {
+  __device__ result_t operator()(thrust::tuple<result_t, result_t> val) const
+  {
+    auto diff = thrust::get<0>(val) - thrust::get<1>(val);
+    return diff < result_t{0.0} ? -diff : diff;
+  }
+};
+
+// per-graph sums of the vertex values (the vertices of every graph are contiguous in the
+// block-diagonal graph, 0 for graphs without vertices)
+template <typename vertex_t, typename InputIterator, typename T>
+void graph_segmented_sum(raft::handle_t const& handle,
+                         vertex_t const* vertex_offsets,
+                         size_t num_graphs,
+                         InputIterator input_first,
+                         T* output)
+{
+  CUGRAPH_EXPECTS(num_graphs <= static_cast<size_t>(std::numeric_limits<int>::max()),
+                  "Invalid input argument: the number of graphs exceeds the int range.");
+  size_t tmp_storage_bytes{0};
+  CUDA_TRY(cub::DeviceSegmentedReduce::Sum(nullptr,
+                                           tmp_storage_bytes,
+                                           input_first,
+                                           output,
+                                           static_cast<int>(num_graphs),
+                                           vertex_offsets,
+                                           vertex_offsets + 1,
+                                           handle.get_stream()));
+  rmm::device_buffer tmp_storage(tmp_storage_bytes, handle.get_stream());
+  CUDA_TRY(cub::DeviceSegmentedReduce::Sum(tmp_storage.data(),
+                                           tmp_storage_bytes,
+                                           input_first,
+                                           output,
+                                           static_cast<int>(num_graphs),
+                                           vertex_offsets,
+                                           vertex_offsets + 1,
+                                           handle.get_stream()));
+}
+
+// convert the (block-diagonal graph) vertex IDs to the graphs' local vertex IDs
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+void to_local_vertex_ids(
+  raft::handle_t const& handle,
+  graph_batch_t<vertex_t, edge_t, weight_t, store_transposed> const& graph_batch,
+  vertex_t* labels)
+{
+  auto num_vertices = graph_batch.view().get_number_of_vertices();
+  thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    labels,
+                    labels + num_vertices,
+                    graph_batch.vertex_graph_ids(),
+                    labels,
+                    [vertex_offsets = graph_batch.vertex_offsets()] __device__(auto label, auto g) {
+                      return label - vertex_offsets[g];
+                    });
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+graph_batch_t<vertex_t, edge_t, weight_t, store_transposed>::graph_batch_t(
+  raft::handle_t const& handle,
+  edgelist_t<vertex_t, edge_t, weight_t> const& edgelist,
+  edge_t const* graph_edge_offsets,
+  vertex_t const* graph_vertex_offsets,
+  size_t number_of_graphs,
+  graph_properties_t properties,
+  bool do_expensive_check)
+  : graph_(handle),
+    number_of_graphs_(number_of_graphs),
+    vertex_offsets_(number_of_graphs + 1, handle.get_stream()),
+    vertex_graph_ids_(0, handle.get_stream())
+{
+  auto default_stream = handle.get_stream();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((graph_edge_offsets != nullptr) && (graph_vertex_offsets != nullptr),
+                  "Invalid input argument: graph_edge_offsets and graph_vertex_offsets should not "
+                  "be nullptr.");
+  CUGRAPH_EXPECTS(
+    number_of_graphs <= static_cast<size_t>(std::numeric_limits<vertex_t>::max()),
+    "Invalid input argument: number_of_graphs should not exceed the maximum vertex_t value.");
+
+  edge_t edge_first{};
+  edge_t edge_last{};
+  vertex_t vertex_first{};
+  vertex_t number_of_vertices{};
+  raft::update_host(&edge_first, graph_edge_offsets, 1, default_stream);
+  raft::update_host(&edge_last, graph_edge_offsets + number_of_graphs, 1, default_stream);
+  raft::update_host(&vertex_first, graph_vertex_offsets, 1, default_stream);
+  raft::update_host(
+    &number_of_vertices, graph_vertex_offsets + number_of_graphs, 1, default_stream);
+  CUDA_TRY(cudaStreamSynchronize(default_stream));
+  CUGRAPH_EXPECTS((edge_first == 0) && (edge_last == edgelist.number_of_edges),
+                  "Invalid input argument: graph_edge_offsets should start from 0 and end at "
+                  "edgelist.number_of_edges.");
+  CUGRAPH_EXPECTS(vertex_first == 0,
+                  "Invalid input argument: graph_vertex_offsets should start from 0.");
+
+  if (do_expensive_check) {
+    CUGRAPH_EXPECTS(thrust::is_sorted(rmm::exec_policy(default_stream)->on(default_stream),
+                                      graph_edge_offsets,
+                                      graph_edge_offsets + (number_of_graphs + 1)) &&
+                      thrust::is_sorted(rmm::exec_policy(default_stream)->on(default_stream),
+                                        graph_vertex_offsets,
+                                        graph_vertex_offsets + (number_of_graphs + 1)),
+                    "Invalid input argument: graph_edge_offsets and graph_vertex_offsets should "
+                    "be non-decreasing.");
+    auto num_invalid_edges =
+      thrust::count_if(rmm::exec_policy(default_stream)->on(default_stream),
+                       thrust::make_counting_iterator(edge_t{0}),
+                       thrust::make_counting_iterator(edgelist.number_of_edges),
+                       detail::is_invalid_local_edge_t<vertex_t, edge_t>{edgelist.p_src_vertices,
+                                                                         edgelist.p_dst_vertices,
+                                                                         graph_edge_offsets,
+                                                                         graph_vertex_offsets,
+                                                                         number_of_graphs});
+    CUGRAPH_EXPECTS(num_invalid_edges == 0,
+                    "Invalid input argument: edgelist has vertex IDs out of the range of their "
+                    "graph's local vertex IDs.");
+  }
+
+  // 2. construct the block-diagonal graph
+
+  rmm::device_uvector<vertex_t> srcs(edgelist.number_of_edges, default_stream);
+  rmm::device_uvector<vertex_t> dsts(srcs.size(), default_stream);
+  thrust::transform(rmm::exec_policy(default_stream)->on(default_stream),
+                    thrust::make_counting_iterator(edge_t{0}),
+                    thrust::make_counting_iterator(edgelist.number_of_edges),
+                    thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin())),
+                    detail::to_block_diagonal_edge_t<vertex_t, edge_t>{edgelist.p_src_vertices,
+                                                                       edgelist.p_dst_vertices,
+                                                                       graph_edge_offsets,
+                                                                       graph_vertex_offsets,
+                                                                       number_of_graphs});
+
+  graph_ = graph_t<vertex_t, edge_t, weight_t, store_transposed, false>(
+    handle,
+    edgelist_t<vertex_t, edge_t, weight_t>{
+      srcs.data(), dsts.data(), edgelist.p_edge_weights, edgelist.number_of_edges},
+    number_of_vertices,
+    properties,
+    false,
+    do_expensive_check);
+
+  // 3. vertex offsets and graph IDs
+
+  raft::copy(vertex_offsets_.data(), graph_vertex_offsets, vertex_offsets_.size(), default_stream);
+  vertex_graph_ids_.resize(number_of_vertices, default_stream);
+  thrust::upper_bound(rmm::exec_policy(default_stream)->on(default_stream),
+                      vertex_offsets_.begin() + 1,
+                      vertex_offsets_.end(),
+                      thrust::make_counting_iterator(vertex_t{0}),
+                      thrust::make_counting_iterator(number_of_vertices),
+                      vertex_graph_ids_.begin());
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+void batched_weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_batch_t<vertex_t, edge_t, weight_t, false> const& graph_batch,
+  vertex_t* components,
+  bool do_expensive_check)
+{
+  profile_range_t profile_range(handle, "batched_weakly_connected_components");
+
+  // every component is within a graph, so its smallest vertex belongs to the same graph
+  weakly_connected_components(handle, graph_batch.view(), components, do_expensive_check);
+  detail::to_local_vertex_ids(handle, graph_batch, components);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+void batched_pagerank(raft::handle_t const& handle,
+                      graph_batch_t<vertex_t, edge_t, weight_t, true> const& graph_batch,
+                      result_t* pageranks,
+                      result_t alpha,
+                      result_t epsilon,
+                      size_t max_iterations,
+                      bool has_initial_guess,
+                      bool do_expensive_check)
+{
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+
+  profile_range_t profile_range(handle, "batched_pagerank");
+
+  auto pull_graph_view    = graph_batch.view();
+  auto const num_vertices = pull_graph_view.get_number_of_vertices();
+  auto const num_graphs   = graph_batch.get_number_of_graphs();
+  if (num_vertices == 0) { return; }
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha <= 1.0),
+                  "Invalid input argument: alpha should be in [0.0, 1.0].");
+  CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+
+  if (do_expensive_check) {
+    if (pull_graph_view.is_weighted()) {
+      auto num_nonpositive_edge_weights = count_if_e(
+        handle,
+        pull_graph_view,
+        thrust::make_constant_iterator(0) /* dummy */,
+        thrust::make_constant_iterator(0) /* dummy */,
+        [] __device__(vertex_t src, vertex_t dst, weight_t w, auto src_val, auto dst_val) {
+          return w <= 0.0;
+        });
+      CUGRAPH_EXPECTS(num_nonpositive_edge_weights == 0,
+                      "Invalid input argument: input graph should have postive edge weights.");
+    }
+
+    if (has_initial_guess) {
+      auto num_negative_values =
+        thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                         pageranks,
+                         pageranks + num_vertices,
+                         [] __device__(auto val) { return val < 0.0; });
+      CUGRAPH_EXPECTS(num_negative_values == 0,
+                      "Invalid input argument: initial guess values should be non-negative.");
+    }
+  }
+
+  auto vertex_out_weight_sums = pull_graph_view.get_out_weight_sums(handle);
+  auto vertex_offsets         = graph_batch.vertex_offsets();
+  auto vertex_graph_ids       = graph_batch.vertex_graph_ids();
+
+  // 2. initialize pagerank values
+
+  // per-graph sums (initial guess sums, dangling sums, and convergence measures)
+  rmm::device_uvector<result_t> graph_sums(num_graphs, handle.get_stream());
+
+  if (has_initial_guess) {
+    detail::graph_segmented_sum(handle, vertex_offsets, num_graphs, pageranks, graph_sums.data());
+    auto num_nonpositive_sums =
+      thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                       thrust::make_counting_iterator(size_t{0}),
+                       thrust::make_counting_iterator(num_graphs),
+                       [vertex_offsets, graph_sums = graph_sums.data()] __device__(auto g) {
+                         return (vertex_offsets[g + 1] > vertex_offsets[g]) &&
+                                (graph_sums[g] <= 0.0);
+                       });
+    CUGRAPH_EXPECTS(num_nonpositive_sums == 0,
+                    "Invalid input argument: sum of the PageRank initial guess values of every "
+                    "graph should be positive.");
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      pageranks,
+                      pageranks + num_vertices,
+                      vertex_graph_ids,
+                      pageranks,
+                      [graph_sums = graph_sums.data()] __device__(auto val, auto g) {
+                        return val / graph_sums[g];
+                      });
+  } else {
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      vertex_graph_ids,
+                      vertex_graph_ids + num_vertices,
+                      pageranks,
+                      [vertex_offsets] __device__(auto g) {
+                        return result_t{1.0} /
+                               static_cast<result_t>(vertex_offsets[g + 1] - vertex_offsets[g]);
+                      });
+  }
+
+  // 3. pagerank iteration
+
+  rmm::device_uvector<result_t> old_pageranks(num_vertices, handle.get_stream());
+  rmm::device_uvector<result_t> adj_matrix_row_pageranks(num_vertices, handle.get_stream());
+  size_t iter{0};
+  while (true) {
+    thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 pageranks,
+                 pageranks + num_vertices,
+                 old_pageranks.data());
+
+    auto vertex_val_first =
+      thrust::make_zip_iterator(thrust::make_tuple(pageranks, vertex_out_weight_sums));
+
+    detail::graph_segmented_sum(
+      handle,
+      vertex_offsets,
+      num_graphs,
+      thrust::make_transform_iterator(vertex_val_first,
+                                      detail::dangling_pagerank_t<result_t, weight_t>{}),
+      graph_sums.data());
+
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      vertex_val_first,
+                      vertex_val_first + num_vertices,
+                      adj_matrix_row_pageranks.begin(),
+                      [] __device__(auto val) {
+                        auto const pagerank       = thrust::get<0>(val);
+                        auto const out_weight_sum = thrust::get<1>(val);
+                        auto const divisor =
+                          out_weight_sum == result_t{0.0} ? result_t{1.0} : out_weight_sum;
+                        return pagerank / divisor;
+                      });
+
+    copy_v_transform_reduce_in_nbr(
+      handle,
+      pull_graph_view,
+      adj_matrix_row_pageranks.begin(),
+      thrust::make_constant_iterator(0) /* dummy */,
+      [alpha] __device__(vertex_t src, vertex_t dst, weight_t w, auto src_val, auto dst_val) {
+        return src_val * w * alpha;
+      },
+      result_t{0.0},
+      pageranks);
+
+    // the dangling sum and the teleport probability of every graph are spread over the graph
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      pageranks,
+                      pageranks + num_vertices,
+                      vertex_graph_ids,
+                      pageranks,
+                      [vertex_offsets, dangling_sums = graph_sums.data(), alpha] __device__(
+                        auto val, auto g) {
+                        auto const unvarying_part =
+                          (dangling_sums[g] * alpha + static_cast<result_t>(1.0 - alpha)) /
+                          static_cast<result_t>(vertex_offsets[g + 1] - vertex_offsets[g]);
+                        return val + unvarying_part;
+                      });
+
+    detail::graph_segmented_sum(
+      handle,
+      vertex_offsets,
+      num_graphs,
+      thrust::make_transform_iterator(
+        thrust::make_zip_iterator(thrust::make_tuple(pageranks, old_pageranks.data())),
+        detail::abs_diff_t<result_t>{}),
+      graph_sums.data());
+
+    iter++;
+    add_profile_counter("iterations", 1);
+
+    auto num_unconverged_graphs =
+      thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                       graph_sums.begin(),
+                       graph_sums.end(),
+                       [epsilon] __device__(auto diff_sum) { return diff_sum >= epsilon; });
+    if (num_unconverged_graphs == 0) {
+      break;
+    } else if (iter >= max_iterations) {
+      CUGRAPH_FAIL("PageRank failed to converge.");
+    }
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+size_t batched_louvain(raft::handle_t const& handle,
+                       graph_batch_t<vertex_t, edge_t, weight_t, false> const& graph_batch,
+                       vertex_t* clustering,
+                       weight_t* modularities,
+                       size_t max_level,
+                       weight_t resolution)
+{
+  profile_range_t profile_range(handle, "batched_louvain");
+
+  auto graph_view         = graph_batch.view();
+  auto const num_vertices = graph_view.get_number_of_vertices();
+  auto const num_edges    = graph_view.get_number_of_edges();
+  auto const num_graphs   = graph_batch.get_number_of_graphs();
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: batched_louvain expects symmetric graphs.");
+
+  // FIXME: see louvain(), cuco/static_map.cuh depends on features not supported on or before
+  // Pascal
+  cudaDeviceProp device_prop;
+  CUDA_TRY(cudaGetDeviceProperties(&device_prop, 0));
+  if (device_prop.major < 7) {
+    CUGRAPH_FAIL("Louvain not supported on Pascal and older architectures");
+  }
+
+  auto vertex_offsets   = graph_batch.vertex_offsets();
+  auto vertex_graph_ids = graph_batch.vertex_graph_ids();
+  auto vertex_weights   = graph_view.get_out_weight_sums(handle);
+
+  // 1. per-graph total edge weights
+
+  rmm::device_uvector<weight_t> graph_edge_weights(num_graphs, handle.get_stream());
+  detail::graph_segmented_sum(
+    handle, vertex_offsets, num_graphs, vertex_weights, graph_edge_weights.data());
+  auto num_graphs_with_edges =
+    thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     graph_edge_weights.begin(),
+                     graph_edge_weights.end(),
+                     [] __device__(auto w) { return w > weight_t{0.0}; });
+
+  // 2. run Louvain on the block-diagonal graph with the edge weights of every graph normalized (to
+  // sum to 1.0); the delta modularity of a move in the normalized graph with the resolution
+  // multiplied by the number of graphs with edges is the delta modularity of the move in its own
+  // graph divided by the number of graphs with edges
+
+  size_t num_levels{0};
+  if (num_graphs_with_edges > 0) {
+    rmm::device_uvector<vertex_t> srcs(num_edges, handle.get_stream());
+    rmm::device_uvector<weight_t> weights(num_edges, handle.get_stream());
+    thrust::upper_bound(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        graph_view.offsets() + 1,
+                        graph_view.offsets() + (num_vertices + 1),
+                        thrust::make_counting_iterator(edge_t{0}),
+                        thrust::make_counting_iterator(num_edges),
+                        srcs.begin());
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      thrust::make_counting_iterator(edge_t{0}),
+                      thrust::make_counting_iterator(num_edges),
+                      weights.begin(),
+                      [srcs               = srcs.data(),
+                       input_weights      = graph_view.weights(),
+                       vertex_graph_ids,
+                       graph_edge_weights = graph_edge_weights.data()] __device__(auto e) {
+                        auto w = input_weights != nullptr ? input_weights[e] : weight_t{1.0};
+                        return w / graph_edge_weights[vertex_graph_ids[srcs[e]]];
+                      });
+
+    graph_t<vertex_t, edge_t, weight_t, false, false> normalized_graph(
+      handle,
+      edgelist_t<vertex_t, edge_t, weight_t>{
+        srcs.data(), graph_view.indices(), weights.data(), num_edges},
+      num_vertices,
+      graph_properties_t{true, graph_view.is_multigraph(), true, false},
+      false);
+
+    Louvain<graph_view_t<vertex_t, edge_t, weight_t, false, false>> runner(
+      handle, normalized_graph.view());
+    runner(max_level, resolution * static_cast<weight_t>(num_graphs_with_edges));
+    num_levels = runner.get_dendrogram().num_levels();
+
+    rmm::device_uvector<vertex_t> vertex_ids(num_vertices, handle.get_stream());
+    thrust::sequence(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     vertex_ids.begin(),
+                     vertex_ids.end(),
+                     vertex_t{0});
+    partition_at_level<vertex_t, false>(
+      handle, runner.get_dendrogram(), vertex_ids.data(), clustering, num_levels);
+  } else {
+    thrust::sequence(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     clustering,
+                     clustering + num_vertices,
+                     vertex_t{0});
+  }
+
+  // 3. label every cluster with its smallest vertex (in the block-diagonal graph)
+
+  rmm::device_uvector<vertex_t> keys(num_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> vertices(num_vertices, handle.get_stream());
+  thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               clustering,
+               clustering + num_vertices,
+               keys.begin());
+  thrust::sequence(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   vertices.begin(),
+                   vertices.end(),
+                   vertex_t{0});
+  thrust::sort_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      keys.begin(),
+                      keys.end(),
+                      vertices.begin());
+  rmm::device_uvector<vertex_t> cluster_labels(num_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> cluster_min_vertices(num_vertices, handle.get_stream());
+  auto num_clusters = static_cast<size_t>(thrust::distance(
+    cluster_labels.begin(),
+    thrust::get<0>(
+      thrust::reduce_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                            keys.begin(),
+                            keys.end(),
+                            vertices.begin(),
+                            cluster_labels.begin(),
+                            cluster_min_vertices.begin(),
+                            thrust::equal_to<vertex_t>{},
+                            thrust::minimum<vertex_t>{}))));
+  thrust::transform(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    clustering,
+    clustering + num_vertices,
+    clustering,
+    [cluster_labels       = cluster_labels.data(),
+     cluster_min_vertices = cluster_min_vertices.data(),
+     num_clusters] __device__(auto label) {
+      return cluster_min_vertices[thrust::distance(
+        cluster_labels,
+        thrust::lower_bound(thrust::seq, cluster_labels, cluster_labels + num_clusters, label))];
+    });
+  vertices.resize(0, handle.get_stream());
+  vertices.shrink_to_fit(handle.get_stream());
+  cluster_labels.resize(0, handle.get_stream());
+  cluster_labels.shrink_to_fit(handle.get_stream());
+
+  // 4. per-graph modularities (with the input edge weights)
+
+  rmm::device_uvector<weight_t> internal_weights(num_vertices, handle.get_stream());
+  copy_v_transform_reduce_out_nbr(
+    handle,
+    graph_view,
+    clustering,
+    clustering,
+    [] __device__(auto src, auto dst, weight_t w, auto src_cluster, auto dst_cluster) {
+      return src_cluster == dst_cluster ? w : weight_t{0.0};
+    },
+    weight_t{0.0},
+    internal_weights.data());
+  rmm::device_uvector<weight_t> graph_internal_weights(num_graphs, handle.get_stream());
+  detail::graph_segmented_sum(
+    handle, vertex_offsets, num_graphs, internal_weights.data(), graph_internal_weights.data());
+
+  // cluster weights (clusters are labeled with their smallest vertices, so the clusters sorted by
+  // labels are also sorted by graph)
+  thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               clustering,
+               clustering + num_vertices,
+               keys.begin());
+  thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               vertex_weights,
+               vertex_weights + num_vertices,
+               internal_weights.begin());
+  thrust::sort_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      keys.begin(),
+                      keys.end(),
+                      internal_weights.begin());
+  rmm::device_uvector<weight_t> cluster_weights(num_clusters, handle.get_stream());
+  thrust::reduce_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        keys.begin(),
+                        keys.end(),
+                        internal_weights.begin(),
+                        cluster_min_vertices.begin(),
+                        cluster_weights.begin());
+  auto graph_id_first = thrust::make_transform_iterator(
+    cluster_min_vertices.begin(), detail::vertex_graph_id_t<vertex_t>{vertex_graph_ids});
+  auto square_first =
+    thrust::make_transform_iterator(cluster_weights.begin(), detail::square_t<weight_t>{});
+  rmm::device_uvector<vertex_t> cluster_graph_ids(num_clusters, handle.get_stream());
+  rmm::device_uvector<weight_t> cluster_graph_square_sums(num_clusters, handle.get_stream());
+  auto num_cluster_graphs = static_cast<size_t>(thrust::distance(
+    cluster_graph_ids.begin(),
+    thrust::get<0>(
+      thrust::reduce_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                            graph_id_first,
+                            graph_id_first + num_clusters,
+                            square_first,
+                            cluster_graph_ids.begin(),
+                            cluster_graph_square_sums.begin()))));
+  rmm::device_uvector<weight_t> graph_cluster_weight_square_sums(num_graphs, handle.get_stream());
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               graph_cluster_weight_square_sums.begin(),
+               graph_cluster_weight_square_sums.end(),
+               weight_t{0.0});
+  thrust::scatter(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                  cluster_graph_square_sums.begin(),
+                  cluster_graph_square_sums.begin() + num_cluster_graphs,
+                  cluster_graph_ids.begin(),
+                  graph_cluster_weight_square_sums.begin());
+
+  thrust::transform(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(num_graphs),
+    modularities,
+    [graph_edge_weights     = graph_edge_weights.data(),
+     graph_internal_weights = graph_internal_weights.data(),
+     graph_cluster_weight_square_sums = graph_cluster_weight_square_sums.data(),
+     resolution] __device__(auto g) {
+      auto m = graph_edge_weights[g];
+      return m > weight_t{0.0} ? graph_internal_weights[g] / m -
+                                   resolution * graph_cluster_weight_square_sums[g] / (m * m)
+                               : weight_t{0.0};
+    });
+
+  detail::to_local_vertex_ids(handle, graph_batch, clustering);
+
+  return num_levels;
+}
+
+// explicit instantiation
+
+template class graph_batch_t<int32_t, int32_t, float, true>;
+template class graph_batch_t<int32_t, int32_t, float, false>;
+template class graph_batch_t<int32_t, int32_t, double, true>;
+template class graph_batch_t<int32_t, int32_t, double, false>;
+template class graph_batch_t<int32_t, int64_t, float, true>;
+template class graph_batch_t<int32_t, int64_t, float, false>;
+template class graph_batch_t<int32_t, int64_t, double, true>;
+template class graph_batch_t<int32_t, int64_t, double, false>;
+template class graph_batch_t<int64_t, int64_t, float, true>;
+template class graph_batch_t<int64_t, int64_t, float, false>;
+template class graph_batch_t<int64_t, int64_t, double, true>;
+template class graph_batch_t<int64_t, int64_t, double, false>;
+
+template void batched_weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_batch_t<int32_t, int32_t, float, false> const& graph_batch,
+  int32_t* components,
+  bool do_expensive_check);
+
+template void batched_weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_batch_t<int32_t, int32_t, double, false> const& graph_batch,
+  int32_t* components,
+  bool do_expensive_check);
+
+template void batched_weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_batch_t<int32_t, int64_t, float, false> const& graph_batch,
+  int32_t* components,
+  bool do_expensive_check);
+
+template void batched_weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_batch_t<int32_t, int64_t, double, false> const& graph_batch,
+  int32_t* components,
+  bool do_expensive_check);
+
+template void batched_weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_batch_t<int64_t, int64_t, float, false> const& graph_batch,
+  int64_t* components,
+  bool do_expensive_check);
+
+template void batched_weakly_connected_components(
+  raft::handle_t const& handle,
+  graph_batch_t<int64_t, int64_t, double, false> const& graph_batch,
+  int64_t* components,
+  bool do_expensive_check);
+
+template void batched_pagerank(raft::handle_t const& handle,
+                               graph_batch_t<int32_t, int32_t, float, true> const& graph_batch,
+                               float* pageranks,
+                               float alpha,
+                               float epsilon,
+                               size_t max_iterations,
+                               bool has_initial_guess,
+                               bool do_expensive_check);
+
+template void batched_pagerank(raft::handle_t const& handle,
+                               graph_batch_t<int32_t, int32_t, double, true> const& graph_batch,
+                               double* pageranks,
+                               double alpha,
+                               double epsilon,
+                               size_t max_iterations,
+                               bool has_initial_guess,
+                               bool do_expensive_check);
+
+template void batched_pagerank(raft::handle_t const& handle,
+                               graph_batch_t<int32_t, int64_t, float, true> const& graph_batch,
+                               float* pageranks,
+                               float alpha,
+                               float epsilon,
+                               size_t max_iterations,
+                               bool has_initial_guess,
+                               bool do_expensive_check);
+
+template void batched_pagerank(raft::handle_t const& handle,
+                               graph_batch_t<int32_t, int64_t, double, true> const& graph_batch,
+                               double* pageranks,
+                               double alpha,
+                               double epsilon,
+                               size_t max_iterations,
+                               bool has_initial_guess,
+                               bool do_expensive_check);
+
+template void batched_pagerank(raft::handle_t const& handle,
+                               graph_batch_t<int64_t, int64_t, float, true> const& graph_batch,
+                               float* pageranks,
+                               float alpha,
+                               float epsilon,
+                               size_t max_iterations,
+                               bool has_initial_guess,
+                               bool do_expensive_check);
+
+template void batched_pagerank(raft::handle_t const& handle,
+                               graph_batch_t<int64_t, int64_t, double, true> const& graph_batch,
+                               double* pageranks,
+                               double alpha,
+                               double epsilon,
+                               size_t max_iterations,
+                               bool has_initial_guess,
+                               bool do_expensive_check);
+
+template size_t batched_louvain(raft::handle_t const& handle,
+                                graph_batch_t<int32_t, int32_t, float, false> const& graph_batch,
+                                int32_t* clustering,
+                                float* modularities,
+                                size_t max_level,
+                                float resolution);
+
+template size_t batched_louvain(raft::handle_t const& handle,
+                                graph_batch_t<int32_t, int32_t, double, false> const& graph_batch,
+                                int32_t* clustering,
+                                double* modularities,
+                                size_t max_level,
+                                double resolution);
+
+template size_t batched_louvain(raft::handle_t const& handle,
+                                graph_batch_t<int32_t, int64_t, float, false> const& graph_batch,
+                                int32_t* clustering,
+                                float* modularities,
+                                size_t max_level,
+                                float resolution);
+
+template size_t batched_louvain(raft::handle_t const& handle,
+                                graph_batch_t<int32_t, int64_t, double, false> const& graph_batch,
+                                int32_t* clustering,
+                                double* modularities,
+                                size_t max_level,
+                                double resolution);
+
+template size_t batched_louvain(raft::handle_t const& handle,
+                                graph_batch_t<int64_t, int64_t, float, false> const& graph_batch,
+                                int64_t* clustering,
+                                float* modularities,
+                                size_t max_level,
+                                float resolution);
+
+template size_t batched_louvain(raft::handle_t const& handle,
+                                graph_batch_t<int64_t, int64_t, double, false> const& graph_batch,
+                                int64_t* clustering,
+                                double* modularities,
+                                size_t max_level,
+                                double resolution);
+
+}  // namespace experimental
+}  // namespace cugraph
@@ -0,0 +1,505 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <experimental/detail/graph_utils.cuh>
+#include <experimental/graph.hpp>
+#include <experimental/graph_builder.hpp>
+#include <partition_manager.hpp>
+#include <utilities/error.hpp>
+#include <utilities/graph_storage.hpp>
+#include <utilities/host_scalar_comm.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/device_atomics.cuh>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/tuple.h>
+
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+
+namespace detail {
+
+template <typename vertex_t, typename edge_t>
+struct count_major_t {
+  vertex_t const *major_firsts{nullptr};
+  vertex_t const *major_lasts{nullptr};
+  edge_t *const *degrees{nullptr};
+  size_t num_partitions{0};
+
+  __device__ void operator()(vertex_t major) const
+  {
+    auto idx = find_partition_idx(major_lasts, num_partitions, major);
+    atomicAdd(degrees[idx] + (major - major_firsts[idx]), edge_t{1});
+  }
+};
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct insert_edge_t {
+  vertex_t const *major_firsts{nullptr};
+  vertex_t const *major_lasts{nullptr};
+  edge_t const *const *offsets{nullptr};
+  edge_t *const *insert_counts{nullptr};
+  vertex_t *const *indices{nullptr};
+  weight_t *const *weights{nullptr};
+  size_t num_partitions{0};
+
+  // returns false if more edges are inserted to major than counted (the mismatch is reported in
+  // graph_builder_t::build())
+  __device__ bool insert(vertex_t major, vertex_t minor, size_t &idx, edge_t &pos) const
+  {
+    idx               = find_partition_idx(major_lasts, num_partitions, major);
+    auto major_offset = major - major_firsts[idx];
+    pos = offsets[idx][major_offset] + atomicAdd(insert_counts[idx] + major_offset, edge_t{1});
+    if (pos >= offsets[idx][major_offset + 1]) { return false; }
+    indices[idx][pos] = minor;
+    return true;
+  }
+
+  __device__ void operator()(thrust::tuple<vertex_t, vertex_t> e) const
+  {
+    size_t idx{};
+    edge_t pos{};
+    insert(thrust::get<0>(e), thrust::get<1>(e), idx, pos);
+  }
+
+  __device__ void operator()(thrust::tuple<vertex_t, vertex_t, weight_t> e) const
+  {
+    size_t idx{};
+    edge_t pos{};
+    if (insert(thrust::get<0>(e), thrust::get<1>(e), idx, pos)) {
+      weights[idx][pos] = thrust::get<2>(e);
+    }
+  }
+};
+
+template <typename vertex_t, typename edge_t>
+struct is_insert_count_mismatch_t {
+  edge_t const *offsets{nullptr};
+  edge_t const *insert_counts{nullptr};
+
+  __device__ bool operator()(vertex_t major_offset) const
+  {
+    return insert_counts[major_offset] != offsets[major_offset + 1] - offsets[major_offset];
+  }
+};
+
+}  // namespace detail
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+graph_builder_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>::graph_builder_t(
+  raft::handle_t const &handle,
+  vertex_t number_of_vertices,
+  graph_properties_t properties,
+  std::vector<vertex_t> const &vertex_partition_offsets,
+  graph_storage_t storage)
+  : handle_ptr_(&handle),
+    number_of_vertices_(number_of_vertices),
+    properties_(properties),
+    storage_(storage),
+    d_vertex_partition_lasts_(0, handle.get_stream()),
+    d_major_firsts_(0, handle.get_stream()),
+    d_major_lasts_(0, handle.get_stream()),
+    d_offsets_(0, handle.get_stream()),
+    d_insert_counts_(0, handle.get_stream()),
+    d_indices_(0, handle.get_stream()),
+    d_weights_(0, handle.get_stream())
+{
+  auto default_stream = handle.get_stream();
+
+  std::vector<vertex_t> h_major_firsts{};
+  std::vector<vertex_t> h_major_lasts{};
+  if (multi_gpu) {
+    auto const comm_size = handle.get_comms().get_size();
+    auto &row_comm       = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+    auto &col_comm       = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+
+    CUGRAPH_EXPECTS(
+      (vertex_partition_offsets.size() == static_cast<size_t>(comm_size) + 1) &&
+        (vertex_partition_offsets.back() == number_of_vertices),
+      "Invalid input argument: vertex_partition_offsets should have comm_size + 1 elements and "
+      "should cover [0, number_of_vertices).");
+
+    partition_ = partition_t<vertex_t>(vertex_partition_offsets,
+                                       row_comm.get_size(),
+                                       col_comm.get_size(),
+                                       row_comm.get_rank(),
+                                       col_comm.get_rank());
+
+    d_vertex_partition_lasts_.resize(comm_size, default_stream);
+    raft::update_device(d_vertex_partition_lasts_.data(),
+                        vertex_partition_offsets.data() + 1,
+                        comm_size,
+                        default_stream);
+
+    for (size_t i = 0; i < partition_.get_number_of_matrix_partitions(); ++i) {
+      h_major_firsts.push_back(partition_.get_matrix_partition_major_first(i));
+      h_major_lasts.push_back(partition_.get_matrix_partition_major_last(i));
+    }
+  } else {
+    CUGRAPH_EXPECTS(vertex_partition_offsets.size() == 0,
+                    "Invalid input argument: vertex_partition_offsets should be empty in "
+                    "single-GPU.");
+
+    h_major_firsts.push_back(vertex_t{0});
+    h_major_lasts.push_back(number_of_vertices);
+  }
+
+  std::vector<edge_t *> h_offsets(h_major_firsts.size(), nullptr);
+  offsets_.reserve(h_major_firsts.size());
+  for (size_t i = 0; i < h_major_firsts.size(); ++i) {
+    offsets_.emplace_back((h_major_lasts[i] - h_major_firsts[i]) + 1, default_stream);
+    thrust::fill(rmm::exec_policy(default_stream)->on(default_stream),
+                 offsets_[i].begin(),
+                 offsets_[i].end(),
+                 edge_t{0});
+    h_offsets[i] = offsets_[i].data();
+  }
+
+  d_major_firsts_.resize(h_major_firsts.size(), default_stream);
+  d_major_lasts_.resize(h_major_lasts.size(), default_stream);
+  d_offsets_.resize(h_offsets.size(), default_stream);
+  raft::update_device(
+    d_major_firsts_.data(), h_major_firsts.data(), h_major_firsts.size(), default_stream);
+  raft::update_device(
+    d_major_lasts_.data(), h_major_lasts.data(), h_major_lasts.size(), default_stream);
+  raft::update_device(d_offsets_.data(), h_offsets.data(), h_offsets.size(), default_stream);
+
+  CUDA_TRY(cudaStreamSynchronize(
+    default_stream));  // this is necessary as h_major_firsts, h_major_lasts, and h_offsets will
+                       // become out-of-scope once control flow exits this function.
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void graph_builder_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>::count_edges(
+  edgelist_t<vertex_t, edge_t, weight_t> const &chunk, bool do_expensive_check)
+{
+  auto default_stream = handle_ptr_->get_stream();
+
+  CUGRAPH_EXPECTS(!inserting_ && !built_,
+                  "Invalid API call: count_edges() should not be called after insert_edges() or "
+                  "build().");
+  CUGRAPH_EXPECTS((chunk.number_of_edges == 0) ||
+                    ((chunk.p_src_vertices != nullptr) && (chunk.p_dst_vertices != nullptr)),
+                  "Invalid input argument: chunk.p_src_vertices and chunk.p_dst_vertices should "
+                  "not be nullptr if chunk.number_of_edges > 0.");
+
+  auto majors = store_transposed ? chunk.p_dst_vertices : chunk.p_src_vertices;
+  auto minors = store_transposed ? chunk.p_src_vertices : chunk.p_dst_vertices;
+
+  if (do_expensive_check) {
+    auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(majors, minors));
+    CUGRAPH_EXPECTS(thrust::count_if(rmm::exec_policy(default_stream)->on(default_stream),
+                                     edge_first,
+                                     edge_first + chunk.number_of_edges,
+                                     detail::is_invalid_edge_t<vertex_t>{number_of_vertices_}) == 0,
+                    "Invalid input argument: chunk has out-of-range vertex IDs.");
+  }
+
+  auto count_op = detail::count_major_t<vertex_t, edge_t>{
+    d_major_firsts_.data(), d_major_lasts_.data(), d_offsets_.data(), offsets_.size()};
+  if (multi_gpu) {
+    // FIXME: only majors are necessary in the receiving side, we may send majors with the GPU IDs
+    // computed in the sending side to cut communication volume.
+    rmm::device_uvector<vertex_t> rx_majors(0, default_stream);
+    std::tie(rx_majors, std::ignore, std::ignore) =
+      detail::shuffle_chunk_to_edge_owners(*handle_ptr_,
+                                           majors,
+                                           minors,
+                                           static_cast<weight_t const *>(nullptr),
+                                           static_cast<size_t>(chunk.number_of_edges),
+                                           d_vertex_partition_lasts_.data());
+    thrust::for_each(rmm::exec_policy(default_stream)->on(default_stream),
+                     rx_majors.begin(),
+                     rx_majors.end(),
+                     count_op);
+  } else {
+    thrust::for_each(rmm::exec_policy(default_stream)->on(default_stream),
+                     majors,
+                     majors + chunk.number_of_edges,
+                     count_op);
+  }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void graph_builder_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>::insert_edges(
+  edgelist_t<vertex_t, edge_t, weight_t> const &chunk, bool do_expensive_check)
+{
+  auto default_stream = handle_ptr_->get_stream();
+
+  CUGRAPH_EXPECTS(!built_, "Invalid API call: insert_edges() should not be called after build().");
+  CUGRAPH_EXPECTS(
+    (chunk.number_of_edges == 0) ||
+      ((chunk.p_src_vertices != nullptr) && (chunk.p_dst_vertices != nullptr) &&
+       (!properties_.is_weighted || (chunk.p_edge_weights != nullptr))),
+    "Invalid input argument: chunk.p_src_vertices and chunk.p_dst_vertices (and "
+    "chunk.p_edge_weights if weighted) should not be nullptr if chunk.number_of_edges > 0.");
+
+  auto majors = store_transposed ? chunk.p_dst_vertices : chunk.p_src_vertices;
+  auto minors = store_transposed ? chunk.p_src_vertices : chunk.p_dst_vertices;
+  auto weights =
+    properties_.is_weighted ? chunk.p_edge_weights : static_cast<weight_t const *>(nullptr);
+
+  if (do_expensive_check) {
+    auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(majors, minors));
+    CUGRAPH_EXPECTS(thrust::count_if(rmm::exec_policy(default_stream)->on(default_stream),
+                                     edge_first,
+                                     edge_first + chunk.number_of_edges,
+                                     detail::is_invalid_edge_t<vertex_t>{number_of_vertices_}) == 0,
+                    "Invalid input argument: chunk has out-of-range vertex IDs.");
+  }
+
+  if (!inserting_) { allocate(); }
+
+  auto insert_op = detail::insert_edge_t<vertex_t, edge_t, weight_t>{d_major_firsts_.data(),
+                                                                     d_major_lasts_.data(),
+                                                                     d_offsets_.data(),
+                                                                     d_insert_counts_.data(),
+                                                                     d_indices_.data(),
+                                                                     d_weights_.data(),
+                                                                     offsets_.size()};
+  if (multi_gpu) {
+    rmm::device_uvector<vertex_t> rx_majors(0, default_stream);
+    rmm::device_uvector<vertex_t> rx_minors(0, default_stream);
+    rmm::device_uvector<weight_t> rx_weights(0, default_stream);
+    std::tie(rx_majors, rx_minors, rx_weights) =
+      detail::shuffle_chunk_to_edge_owners(*handle_ptr_,
+                                           majors,
+                                           minors,
+                                           weights,
+                                           static_cast<size_t>(chunk.number_of_edges),
+                                           d_vertex_partition_lasts_.data());
+    if (properties_.is_weighted) {
+      auto edge_first = thrust::make_zip_iterator(
+        thrust::make_tuple(rx_majors.begin(), rx_minors.begin(), rx_weights.begin()));
+      thrust::for_each(rmm::exec_policy(default_stream)->on(default_stream),
+                       edge_first,
+                       edge_first + rx_majors.size(),
+                       insert_op);
+    } else {
+      auto edge_first =
+        thrust::make_zip_iterator(thrust::make_tuple(rx_majors.begin(), rx_minors.begin()));
+      thrust::for_each(rmm::exec_policy(default_stream)->on(default_stream),
+                       edge_first,
+                       edge_first + rx_majors.size(),
+                       insert_op);
+    }
+  } else {
+    if (properties_.is_weighted) {
+      auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(majors, minors, weights));
+      thrust::for_each(rmm::exec_policy(default_stream)->on(default_stream),
+                       edge_first,
+                       edge_first + chunk.number_of_edges,
+                       insert_op);
+    } else {
+      auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(majors, minors));
+      thrust::for_each(rmm::exec_policy(default_stream)->on(default_stream),
+                       edge_first,
+                       edge_first + chunk.number_of_edges,
+                       insert_op);
+    }
+  }
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>
+graph_builder_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>::build(
+  bool sorted_by_degree, bool do_expensive_check)
+{
+  auto default_stream = handle_ptr_->get_stream();
+
+  CUGRAPH_EXPECTS(!built_, "Invalid API call: build() should be called only once.");
+
+  if (!inserting_) { allocate(); }
+
+  // every counted edge should be inserted exactly once
+
+  size_t number_of_mismatches{0};
+  for (size_t i = 0; i < offsets_.size(); ++i) {
+    number_of_mismatches += thrust::count_if(
+      rmm::exec_policy(default_stream)->on(default_stream),
+      thrust::make_counting_iterator(vertex_t{0}),
+      thrust::make_counting_iterator(static_cast<vertex_t>(insert_counts_[i].size())),
+      detail::is_insert_count_mismatch_t<vertex_t, edge_t>{offsets_[i].data(),
+                                                           insert_counts_[i].data()});
+  }
+  if (multi_gpu) {
+    number_of_mismatches =
+      host_scalar_allreduce(handle_ptr_->get_comms(), number_of_mismatches, default_stream);
+  }
+  CUGRAPH_EXPECTS(number_of_mismatches == 0,
+                  "Invalid input argument: edges passed to insert_edges() do not coincide with "
+                  "edges passed to count_edges().");
+  insert_counts_.clear();
+
+  edge_t number_of_edges{0};
+  for (size_t i = 0; i < indices_.size(); ++i) {
+    // FIXME: sorting requires additional memory proportional to the number of local edges in the
+    // matrix partition, a segmented sort can cut this
+    if (properties_.has_sorted_neighbor_lists) {
+      rmm::device_uvector<weight_t> dummy_weights(0, default_stream);
+      detail::sort_neighbor_lists(offsets_[i],
+                                  indices_[i],
+                                  properties_.is_weighted ? weights_[i] : dummy_weights,
+                                  properties_.is_weighted,
+                                  default_stream);
+    }
+    // edges in managed memory are read only after this point
+    detail::advise_read_mostly(indices_[i].data(), indices_[i].size() * sizeof(vertex_t));
+    if (properties_.is_weighted) {
+      detail::advise_read_mostly(weights_[i].data(), weights_[i].size() * sizeof(weight_t));
+    }
+    number_of_edges += static_cast<edge_t>(indices_[i].size());
+  }
+  if (multi_gpu) {
+    number_of_edges =
+      host_scalar_allreduce(handle_ptr_->get_comms(), number_of_edges, default_stream);
+  }
+
+  built_ = true;
+
+  return detail::graph_from_compressed_sparse<vertex_t,
+                                              edge_t,
+                                              weight_t,
+                                              store_transposed,
+                                              multi_gpu>(*handle_ptr_,
+                                                         std::move(offsets_),
+                                                         std::move(indices_),
+                                                         std::move(weights_),
+                                                         partition_,
+                                                         number_of_vertices_,
+                                                         number_of_edges,
+                                                         properties_,
+                                                         sorted_by_degree,
+                                                         do_expensive_check);
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void graph_builder_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>::allocate()
+{
+  auto default_stream = handle_ptr_->get_stream();
+
+  // convert degrees to offsets and allocate the compressed sparse arrays (once for all the chunks)
+
+  auto edge_mr = detail::get_graph_storage_resource(storage_);
+
+  std::vector<edge_t *> h_insert_counts(offsets_.size(), nullptr);
+  std::vector<vertex_t *> h_indices(offsets_.size(), nullptr);
+  std::vector<weight_t *> h_weights(properties_.is_weighted ? offsets_.size() : 0, nullptr);
+  insert_counts_.reserve(offsets_.size());
+  indices_.reserve(offsets_.size());
+  weights_.reserve(properties_.is_weighted ? offsets_.size() : 0);
+  for (size_t i = 0; i < offsets_.size(); ++i) {
+    thrust::exclusive_scan(rmm::exec_policy(default_stream)->on(default_stream),
+                           offsets_[i].begin(),
+                           offsets_[i].end(),
+                           offsets_[i].begin());
+    auto number_of_local_edges = offsets_[i].element(offsets_[i].size() - 1, default_stream);
+
+    insert_counts_.emplace_back(offsets_[i].size() - 1, default_stream);
+    thrust::fill(rmm::exec_policy(default_stream)->on(default_stream),
+                 insert_counts_[i].begin(),
+                 insert_counts_[i].end(),
+                 edge_t{0});
+    indices_.emplace_back(number_of_local_edges, default_stream, edge_mr);
+    h_insert_counts[i] = insert_counts_[i].data();
+    h_indices[i]       = indices_[i].data();
+    if (properties_.is_weighted) {
+      weights_.emplace_back(number_of_local_edges, default_stream, edge_mr);
+      h_weights[i] = weights_[i].data();
+    }
+  }
+
+  d_insert_counts_.resize(h_insert_counts.size(), default_stream);
+  d_indices_.resize(h_indices.size(), default_stream);
+  d_weights_.resize(h_weights.size(), default_stream);
+  raft::update_device(
+    d_insert_counts_.data(), h_insert_counts.data(), h_insert_counts.size(), default_stream);
+  raft::update_device(d_indices_.data(), h_indices.data(), h_indices.size(), default_stream);
+  raft::update_device(d_weights_.data(), h_weights.data(), h_weights.size(), default_stream);
+
+  CUDA_TRY(cudaStreamSynchronize(
+    default_stream));  // this is necessary as h_insert_counts, h_indices, and h_weights will become
+                       // out-of-scope once control flow exits this function.
+
+  inserting_ = true;
+}
+
+// explicit instantiation
+
+template class graph_builder_t<int32_t, int32_t, float, true, true>;
+template class graph_builder_t<int32_t, int32_t, float, false, true>;
+template class graph_builder_t<int32_t, int32_t, double, true, true>;
+template class graph_builder_t<int32_t, int32_t, double, false, true>;
+template class graph_builder_t<int32_t, int64_t, float, true, true>;
+template class graph_builder_t<int32_t, int64_t, float, false, true>;
+template class graph_builder_t<int32_t, int64_t, double, true, true>;
+template class graph_builder_t<int32_t, int64_t, double, false, true>;
+template class graph_builder_t<int64_t, int64_t, float, true, true>;
+template class graph_builder_t<int64_t, int64_t, float, false, true>;
+template class graph_builder_t<int64_t, int64_t, double, true, true>;
+template class graph_builder_t<int64_t, int64_t, double, false, true>;
+//
+template class graph_builder_t<int32_t, int32_t, float, true, false>;
+template class graph_builder_t<int32_t, int32_t, float, false, false>;
+template class graph_builder_t<int32_t, int32_t, double, true, false>;
+template class graph_builder_t<int32_t, int32_t, double, false, false>;
+template class graph_builder_t<int32_t, int64_t, float, true, false>;
+template class graph_builder_t<int32_t, int64_t, float, false, false>;
+template class graph_builder_t<int32_t, int64_t, double, true, false>;
+template class graph_builder_t<int32_t, int64_t, double, false, false>;
+template class graph_builder_t<int64_t, int64_t, float, true, false>;
+template class graph_builder_t<int64_t, int64_t, float, false, false>;
+template class graph_builder_t<int64_t, int64_t, double, true, false>;
+template class graph_builder_t<int64_t, int64_t, double, false, false>;
+
+}  // namespace experimental
+}  // namespace cugraph
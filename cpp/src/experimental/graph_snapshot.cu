@@ -0,0 +1,788 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <experimental/detail/graph_utils.cuh>
+#include <experimental/graph.hpp>
+#include <experimental/graph_functions.hpp>
+#include <experimental/graph_view.hpp>
+#include <matrix_partition_device.cuh>
+#include <partition_manager.hpp>
+#include <utilities/error.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+
+namespace {
+
+uint64_t constexpr snapshot_magic{0x50414e5352475543};  // "CUGRSNAP"
+uint32_t constexpr snapshot_version{1};
+
+// every section starts at a multiple of the page size, this allows reading sections directly to
+// device memory (e.g. with O_DIRECT or GPUDirect Storage) in the future
+size_t constexpr snapshot_section_alignment{4096};
+
+size_t constexpr snapshot_staging_buffer_size{size_t{1} << 26};  // FIXME: requires tuning
+
+struct snapshot_header_t {
+  uint64_t magic{0};
+  uint32_t version{0};
+  uint32_t vertex_size{0};
+  uint32_t edge_size{0};
+  uint32_t weight_size{0};
+  uint8_t store_transposed{0};
+  uint8_t multi_gpu{0};
+  uint8_t is_symmetric{0};
+  uint8_t is_multigraph{0};
+  uint8_t is_weighted{0};
+  uint8_t has_sorted_neighbor_lists{0};
+  uint8_t sorted_by_degree{0};
+  uint8_t has_renumber_map_labels{0};
+  int32_t comm_size{0};
+  int32_t row_comm_size{0};
+  int32_t comm_rank{0};
+  int32_t padding{0};
+  int64_t number_of_vertices{0};
+  int64_t number_of_edges{0};
+  uint64_t number_of_local_adj_matrix_partitions{0};
+  uint64_t number_of_renumber_map_labels{0};
+};
+
+static_assert(std::is_trivially_copyable<snapshot_header_t>::value,
+              "snapshot_header_t should be trivially copyable.");
+
+size_t align_section_offset(size_t offset)
+{
+  return ((offset + (snapshot_section_alignment - 1)) / snapshot_section_alignment) *
+         snapshot_section_alignment;
+}
+
+// double buffered pinned host memory to stage copies between (memory-mapped) files and device
+// memory
+class staging_buffers_t {
+ public:
+  staging_buffers_t(size_t buffer_size) : buffer_size_(buffer_size)
+  {
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+      CUDA_TRY(cudaMallocHost(reinterpret_cast<void **>(&buffers_[i]), buffer_size_));
+      CUDA_TRY(cudaEventCreateWithFlags(&events_[i], cudaEventDisableTiming));
+    }
+  }
+
+  staging_buffers_t(staging_buffers_t const &) = delete;
+  staging_buffers_t &operator=(staging_buffers_t const &) = delete;
+
+  ~staging_buffers_t()
+  {
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+      if (events_[i] != nullptr) { cudaEventDestroy(events_[i]); }
+      if (buffers_[i] != nullptr) { cudaFreeHost(buffers_[i]); }
+    }
+  }
+
+  size_t buffer_size() const { return buffer_size_; }
+
+  size_t number_of_buffers() const { return buffers_.size(); }
+
+  char *buffer(size_t i) const { return buffers_[i]; }
+
+  cudaEvent_t event(size_t i) const { return events_[i]; }
+
+ private:
+  size_t buffer_size_{0};
+  std::array<char *, 2> buffers_{{nullptr, nullptr}};
+  std::array<cudaEvent_t, 2> events_{{nullptr, nullptr}};
+};
+
+class snapshot_writer_t {
+ public:
+  snapshot_writer_t(std::string const &file_path, staging_buffers_t const &staging_buffers)
+    : fp_(std::fopen(file_path.c_str(), "wb")), staging_buffers_(staging_buffers)
+  {
+    CUGRAPH_EXPECTS(fp_ != nullptr, "Failed to open %s for writing.", file_path.c_str());
+  }
+
+  snapshot_writer_t(snapshot_writer_t const &) = delete;
+  snapshot_writer_t &operator=(snapshot_writer_t const &) = delete;
+
+  ~snapshot_writer_t()
+  {
+    if (fp_ != nullptr) { std::fclose(fp_); }
+  }
+
+  void close()
+  {
+    auto ret = std::fclose(fp_);
+    fp_      = nullptr;
+    CUGRAPH_EXPECTS(ret == 0, "Failed to close the snapshot file.");
+  }
+
+  template <typename T>
+  void write_host_section(T const *values, size_t count)
+  {
+    write_bytes(values, sizeof(T) * count);
+    pad_to_alignment();
+  }
+
+  // values in [first, first + count) are copied to the staging buffer (via a temporary device
+  // buffer) chunk by chunk, so ValueIterator can be any (e.g. transform) device iterator
+  template <typename ValueIterator>
+  void write_device_section(ValueIterator first, size_t count, cudaStream_t stream)
+  {
+    using value_t = typename std::iterator_traits<ValueIterator>::value_type;
+
+    auto chunk_size = staging_buffers_.buffer_size() / sizeof(value_t);
+    rmm::device_uvector<value_t> tmp_values(std::min(chunk_size, count), stream);
+    for (size_t i = 0; i < count; i += chunk_size) {
+      auto this_chunk_size = std::min(chunk_size, count - i);
+      thrust::copy(rmm::exec_policy(stream)->on(stream),
+                   first + i,
+                   first + (i + this_chunk_size),
+                   tmp_values.begin());
+      raft::update_host(reinterpret_cast<value_t *>(staging_buffers_.buffer(0)),
+                        tmp_values.data(),
+                        this_chunk_size,
+                        stream);
+      CUDA_TRY(cudaStreamSynchronize(stream));
+      write_bytes(staging_buffers_.buffer(0), sizeof(value_t) * this_chunk_size);
+    }
+    pad_to_alignment();
+  }
+
+ private:
+  void write_bytes(void const *bytes, size_t size)
+  {
+    CUGRAPH_EXPECTS(std::fwrite(bytes, size_t{1}, size, fp_) == size,
+                    "Failed to write to the snapshot file.");
+    offset_ += size;
+  }
+
+  void pad_to_alignment()
+  {
+    std::array<char, 256> zeros{};
+    auto padding = align_section_offset(offset_) - offset_;
+    while (padding > 0) {
+      auto size = std::min(padding, zeros.size());
+      write_bytes(zeros.data(), size);
+      padding -= size;
+    }
+  }
+
+  FILE *fp_{nullptr};
+  staging_buffers_t const &staging_buffers_;
+  size_t offset_{0};
+};
+
+class snapshot_reader_t {
+ public:
+  snapshot_reader_t(std::string const &file_path, staging_buffers_t const &staging_buffers)
+    : staging_buffers_(staging_buffers)
+  {
+    fd_ = open(file_path.c_str(), O_RDONLY);
+    CUGRAPH_EXPECTS(fd_ >= 0, "Failed to open %s for reading.", file_path.c_str());
+    struct stat file_stat {
+    };
+    CUGRAPH_EXPECTS(fstat(fd_, &file_stat) == 0, "Failed to stat %s.", file_path.c_str());
+    size_ = static_cast<size_t>(file_stat.st_size);
+    CUGRAPH_EXPECTS(size_ >= sizeof(snapshot_header_t),
+                    "Invalid input argument: %s is not a graph snapshot file.",
+                    file_path.c_str());
+    addr_ = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    CUGRAPH_EXPECTS(addr_ != MAP_FAILED, "Failed to memory-map %s.", file_path.c_str());
+    madvise(addr_, size_, MADV_SEQUENTIAL);  // only a hint, failure is harmless
+  }
+
+  snapshot_reader_t(snapshot_reader_t const &) = delete;
+  snapshot_reader_t &operator=(snapshot_reader_t const &) = delete;
+
+  ~snapshot_reader_t()
+  {
+    if ((addr_ != nullptr) && (addr_ != MAP_FAILED)) { munmap(addr_, size_); }
+    if (fd_ >= 0) { ::close(fd_); }
+  }
+
+  template <typename T>
+  void read_host_section(T *values, size_t count)
+  {
+    std::memcpy(values, section_bytes(sizeof(T) * count), sizeof(T) * count);
+  }
+
+  // copy a section to device memory, copying chunk i + 1 from the memory-mapped file to a staging
+  // buffer overlaps with the host to device transfer of chunk i
+  template <typename T>
+  rmm::device_uvector<T> read_device_section(size_t count, cudaStream_t stream)
+  {
+    auto bytes = section_bytes(sizeof(T) * count);
+
+    rmm::device_uvector<T> values(count, stream);
+    auto chunk_size = (staging_buffers_.buffer_size() / sizeof(T)) * sizeof(T);
+    for (size_t i = 0; i * chunk_size < sizeof(T) * count; ++i) {
+      auto buffer_idx      = i % staging_buffers_.number_of_buffers();
+      auto this_chunk_size = std::min(chunk_size, sizeof(T) * count - i * chunk_size);
+      CUDA_TRY(cudaEventSynchronize(staging_buffers_.event(buffer_idx)));
+      std::memcpy(staging_buffers_.buffer(buffer_idx), bytes + i * chunk_size, this_chunk_size);
+      CUDA_TRY(cudaMemcpyAsync(reinterpret_cast<char *>(values.data()) + i * chunk_size,
+                               staging_buffers_.buffer(buffer_idx),
+                               this_chunk_size,
+                               cudaMemcpyHostToDevice,
+                               stream));
+      CUDA_TRY(cudaEventRecord(staging_buffers_.event(buffer_idx), stream));
+    }
+    return values;
+  }
+
+ private:
+  char const *section_bytes(size_t size)
+  {
+    CUGRAPH_EXPECTS(offset_ + size <= size_, "Invalid input argument: truncated snapshot file.");
+    auto ret = static_cast<char const *>(addr_) + offset_;
+    offset_  = std::min(align_section_offset(offset_ + size), size_);
+    return ret;
+  }
+
+  staging_buffers_t const &staging_buffers_;
+  int fd_{-1};
+  void *addr_{nullptr};
+  size_t size_{0};
+  size_t offset_{0};
+};
+
+// major offset (in [0, major size]) => CSR (or CSC) offset, this expands DCSR (or DCSC) offsets
+template <typename GraphViewType>
+struct major_offset_to_local_offset_t {
+  matrix_partition_device_t<GraphViewType> matrix_partition;
+
+  __device__ typename GraphViewType::edge_type operator()(
+    typename GraphViewType::vertex_type major_offset) const
+  {
+    return matrix_partition.get_local_offset(major_offset);
+  }
+};
+
+// edge offset => (global) minor, this decodes 32 bit local indices
+template <typename GraphViewType>
+struct edge_offset_to_minor_t {
+  matrix_partition_device_t<GraphViewType> matrix_partition;
+
+  __device__ typename GraphViewType::vertex_type operator()(
+    typename GraphViewType::edge_type edge_offset) const
+  {
+    return matrix_partition.get_minor_nocheck(edge_offset);
+  }
+};
+
+}  // namespace
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+void write_graph_snapshot(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> const &graph_view,
+  vertex_t const *renumber_map_labels,
+  std::string const &file_path)
+{
+  auto comm_size     = int{1};
+  auto row_comm_size = int{1};
+  auto comm_rank     = int{0};
+  if (multi_gpu) {
+    comm_size = handle.get_comms().get_size();
+    comm_rank = handle.get_comms().get_rank();
+    row_comm_size =
+      handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name()).get_size();
+  }
+
+  auto num_partitions   = graph_view.get_number_of_local_adj_matrix_partitions();
+  auto sorted_by_degree = graph_view.get_local_adj_matrix_partition_segment_offsets(0).size() > 0;
+
+  snapshot_header_t header{};
+  header.magic                     = snapshot_magic;
+  header.version                   = snapshot_version;
+  header.vertex_size               = sizeof(vertex_t);
+  header.edge_size                 = sizeof(edge_t);
+  header.weight_size               = sizeof(weight_t);
+  header.store_transposed          = store_transposed;
+  header.multi_gpu                 = multi_gpu;
+  header.is_symmetric              = graph_view.is_symmetric();
+  header.is_multigraph             = graph_view.is_multigraph();
+  header.is_weighted               = graph_view.is_weighted();
+  header.has_sorted_neighbor_lists = graph_view.has_sorted_neighbor_lists();
+  header.sorted_by_degree          = sorted_by_degree;
+  header.has_renumber_map_labels   = renumber_map_labels != nullptr;
+  header.comm_size                 = comm_size;
+  header.row_comm_size             = row_comm_size;
+  header.comm_rank                 = comm_rank;
+  header.number_of_vertices        = graph_view.get_number_of_vertices();
+  header.number_of_edges           = graph_view.get_number_of_edges();
+  header.number_of_local_adj_matrix_partitions = num_partitions;
+  header.number_of_renumber_map_labels =
+    renumber_map_labels != nullptr ? graph_view.get_number_of_local_vertices() : vertex_t{0};
+
+  std::vector<vertex_t> vertex_partition_offsets(comm_size + 1, vertex_t{0});
+  for (int i = 0; i < comm_size; ++i) {
+    vertex_partition_offsets[i] = graph_view.get_vertex_partition_first(i);
+  }
+  vertex_partition_offsets.back() = graph_view.get_number_of_vertices();
+
+  std::vector<uint64_t> edge_counts(num_partitions);
+  for (size_t i = 0; i < num_partitions; ++i) {
+    edge_counts[i] = graph_view.get_number_of_local_adj_matrix_partition_edges(i);
+  }
+
+  staging_buffers_t staging_buffers(snapshot_staging_buffer_size);
+  snapshot_writer_t writer(file_path, staging_buffers);
+
+  writer.write_host_section(&header, size_t{1});
+  writer.write_host_section(vertex_partition_offsets.data(), vertex_partition_offsets.size());
+  writer.write_host_section(edge_counts.data(), edge_counts.size());
+
+  // the snapshot stores CSR (or CSC) offsets and (global) minors, so the snapshot format does not
+  // depend on in-memory optimizations (DCSR (or DCSC) and 32 bit local indices) which are
+  // re-applied when the graph is read
+  using graph_view_type = graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>;
+  for (size_t i = 0; i < num_partitions; ++i) {
+    auto matrix_partition = matrix_partition_device_t<graph_view_type>(graph_view, i);
+
+    writer.write_device_section(
+      thrust::make_transform_iterator(
+        thrust::make_counting_iterator(vertex_t{0}),
+        major_offset_to_local_offset_t<graph_view_type>{matrix_partition}),
+      static_cast<size_t>(matrix_partition.get_major_size()) + 1,
+      handle.get_stream());
+    writer.write_device_section(
+      thrust::make_transform_iterator(thrust::make_counting_iterator(edge_t{0}),
+                                      edge_offset_to_minor_t<graph_view_type>{matrix_partition}),
+      edge_counts[i],
+      handle.get_stream());
+    if (graph_view.is_weighted()) {
+      writer.write_device_section(
+        matrix_partition.get_weights(), edge_counts[i], handle.get_stream());
+    }
+  }
+
+  if (renumber_map_labels != nullptr) {
+    writer.write_device_section(
+      renumber_map_labels, header.number_of_renumber_map_labels, handle.get_stream());
+  }
+
+  writer.close();
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>,
+           rmm::device_uvector<vertex_t>>
+read_graph_snapshot(raft::handle_t const &handle,
+                    std::string const &file_path,
+                    bool do_expensive_check)
+{
+  auto comm_size     = int{1};
+  auto row_comm_size = int{1};
+  auto col_comm_size = int{1};
+  auto comm_rank     = int{0};
+  auto row_comm_rank = int{0};
+  auto col_comm_rank = int{0};
+  if (multi_gpu) {
+    auto &row_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+    auto &col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+    comm_size      = handle.get_comms().get_size();
+    comm_rank      = handle.get_comms().get_rank();
+    row_comm_size  = row_comm.get_size();
+    row_comm_rank  = row_comm.get_rank();
+    col_comm_size  = col_comm.get_size();
+    col_comm_rank  = col_comm.get_rank();
+  }
+
+  staging_buffers_t staging_buffers(snapshot_staging_buffer_size);
+  snapshot_reader_t reader(file_path, staging_buffers);
+
+  snapshot_header_t header{};
+  reader.read_host_section(&header, size_t{1});
+
+  CUGRAPH_EXPECTS((header.magic == snapshot_magic) && (header.version == snapshot_version),
+                  "Invalid input argument: %s is not a graph snapshot file (or written by an "
+                  "incompatible version).",
+                  file_path.c_str());
+  CUGRAPH_EXPECTS((header.vertex_size == sizeof(vertex_t)) &&
+                    (header.edge_size == sizeof(edge_t)) &&
+                    (header.weight_size == sizeof(weight_t)) &&
+                    (static_cast<bool>(header.store_transposed) == store_transposed) &&
+                    (static_cast<bool>(header.multi_gpu) == multi_gpu),
+                  "Invalid input argument: template parameters do not match with the snapshot.");
+  CUGRAPH_EXPECTS((header.comm_size == comm_size) && (header.row_comm_size == row_comm_size) &&
+                    (header.comm_rank == comm_rank) &&
+                    (header.number_of_local_adj_matrix_partitions ==
+                     static_cast<uint64_t>(col_comm_size)),
+                  "Invalid input argument: the snapshot was written with different GPU "
+                  "configuration (or by a different rank).");
+
+  std::vector<vertex_t> vertex_partition_offsets(comm_size + 1);
+  std::vector<uint64_t> edge_counts(header.number_of_local_adj_matrix_partitions);
+  reader.read_host_section(vertex_partition_offsets.data(), vertex_partition_offsets.size());
+  reader.read_host_section(edge_counts.data(), edge_counts.size());
+
+  partition_t<vertex_t> partition{};
+  if (multi_gpu) {
+    partition = partition_t<vertex_t>(
+      vertex_partition_offsets, row_comm_size, col_comm_size, row_comm_rank, col_comm_rank);
+  }
+
+  std::vector<rmm::device_uvector<edge_t>> offsets{};
+  std::vector<rmm::device_uvector<vertex_t>> indices{};
+  std::vector<rmm::device_uvector<weight_t>> weights{};
+  offsets.reserve(edge_counts.size());
+  indices.reserve(edge_counts.size());
+  weights.reserve(header.is_weighted ? edge_counts.size() : size_t{0});
+  for (size_t i = 0; i < edge_counts.size(); ++i) {
+    auto major_size =
+      multi_gpu ? partition.get_matrix_partition_major_size(i)
+                : static_cast<vertex_t>(header.number_of_vertices);
+    offsets.push_back(
+      reader.read_device_section<edge_t>(static_cast<size_t>(major_size) + 1, handle.get_stream()));
+    indices.push_back(reader.read_device_section<vertex_t>(edge_counts[i], handle.get_stream()));
+    if (header.is_weighted) {
+      weights.push_back(reader.read_device_section<weight_t>(edge_counts[i], handle.get_stream()));
+    }
+  }
+
+  rmm::device_uvector<vertex_t> renumber_map_labels(0, handle.get_stream());
+  if (header.has_renumber_map_labels) {
+    renumber_map_labels = reader.read_device_section<vertex_t>(
+      header.number_of_renumber_map_labels, handle.get_stream());
+  }
+
+  CUDA_TRY(cudaStreamSynchronize(
+    handle.get_stream()));  // this is necessary as the staging buffers and the memory-mapped file
+                            // will become out-of-scope once control flow exits this function.
+
+  auto graph =
+    detail::graph_from_compressed_sparse<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
+      handle,
+      std::move(offsets),
+      std::move(indices),
+      std::move(weights),
+      partition,
+      static_cast<vertex_t>(header.number_of_vertices),
+      static_cast<edge_t>(header.number_of_edges),
+      graph_properties_t{static_cast<bool>(header.is_symmetric),
+                         static_cast<bool>(header.is_multigraph),
+                         static_cast<bool>(header.is_weighted),
+                         static_cast<bool>(header.has_sorted_neighbor_lists)},
+      static_cast<bool>(header.sorted_by_degree),
+      do_expensive_check);
+
+  return std::make_tuple(std::move(graph), std::move(renumber_map_labels));
+}
+
+// explicit instantiation
+
+template void write_graph_snapshot<int32_t, int32_t, float, true, true>(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, float, true, true> const &graph_view,
+  int32_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int32_t, int32_t, float, false, true>(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, float, false, true> const &graph_view,
+  int32_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int32_t, int32_t, double, true, true>(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, double, true, true> const &graph_view,
+  int32_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int32_t, int32_t, double, false, true>(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, double, false, true> const &graph_view,
+  int32_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int32_t, int64_t, float, true, true>(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, float, true, true> const &graph_view,
+  int32_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int32_t, int64_t, float, false, true>(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, float, false, true> const &graph_view,
+  int32_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int32_t, int64_t, double, true, true>(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, double, true, true> const &graph_view,
+  int32_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int32_t, int64_t, double, false, true>(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, double, false, true> const &graph_view,
+  int32_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int64_t, int64_t, float, true, true>(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, float, true, true> const &graph_view,
+  int64_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int64_t, int64_t, float, false, true>(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, float, false, true> const &graph_view,
+  int64_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int64_t, int64_t, double, true, true>(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, double, true, true> const &graph_view,
+  int64_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int64_t, int64_t, double, false, true>(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, double, false, true> const &graph_view,
+  int64_t const *renumber_map_labels,
+  std::string const &file_path);
+
+//
+template void write_graph_snapshot<int32_t, int32_t, float, true, false>(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, float, true, false> const &graph_view,
+  int32_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int32_t, int32_t, float, false, false>(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const &graph_view,
+  int32_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int32_t, int32_t, double, true, false>(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, double, true, false> const &graph_view,
+  int32_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int32_t, int32_t, double, false, false>(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const &graph_view,
+  int32_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int32_t, int64_t, float, true, false>(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, float, true, false> const &graph_view,
+  int32_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int32_t, int64_t, float, false, false>(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const &graph_view,
+  int32_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int32_t, int64_t, double, true, false>(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, double, true, false> const &graph_view,
+  int32_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int32_t, int64_t, double, false, false>(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const &graph_view,
+  int32_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int64_t, int64_t, float, true, false>(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, float, true, false> const &graph_view,
+  int64_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int64_t, int64_t, float, false, false>(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const &graph_view,
+  int64_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int64_t, int64_t, double, true, false>(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, double, true, false> const &graph_view,
+  int64_t const *renumber_map_labels,
+  std::string const &file_path);
+
+template void write_graph_snapshot<int64_t, int64_t, double, false, false>(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const &graph_view,
+  int64_t const *renumber_map_labels,
+  std::string const &file_path);
+
+//
+template std::tuple<graph_t<int32_t, int32_t, float, true, true>, rmm::device_uvector<int32_t>>
+read_graph_snapshot<int32_t, int32_t, float, true, true>(raft::handle_t const &handle,
+                                                         std::string const &file_path,
+                                                         bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int32_t, float, false, true>, rmm::device_uvector<int32_t>>
+read_graph_snapshot<int32_t, int32_t, float, false, true>(raft::handle_t const &handle,
+                                                          std::string const &file_path,
+                                                          bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int32_t, double, true, true>, rmm::device_uvector<int32_t>>
+read_graph_snapshot<int32_t, int32_t, double, true, true>(raft::handle_t const &handle,
+                                                          std::string const &file_path,
+                                                          bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int32_t, double, false, true>, rmm::device_uvector<int32_t>>
+read_graph_snapshot<int32_t, int32_t, double, false, true>(raft::handle_t const &handle,
+                                                           std::string const &file_path,
+                                                           bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, float, true, true>, rmm::device_uvector<int32_t>>
+read_graph_snapshot<int32_t, int64_t, float, true, true>(raft::handle_t const &handle,
+                                                         std::string const &file_path,
+                                                         bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, float, false, true>, rmm::device_uvector<int32_t>>
+read_graph_snapshot<int32_t, int64_t, float, false, true>(raft::handle_t const &handle,
+                                                          std::string const &file_path,
+                                                          bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, double, true, true>, rmm::device_uvector<int32_t>>
+read_graph_snapshot<int32_t, int64_t, double, true, true>(raft::handle_t const &handle,
+                                                          std::string const &file_path,
+                                                          bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, double, false, true>, rmm::device_uvector<int32_t>>
+read_graph_snapshot<int32_t, int64_t, double, false, true>(raft::handle_t const &handle,
+                                                           std::string const &file_path,
+                                                           bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, float, true, true>, rmm::device_uvector<int64_t>>
+read_graph_snapshot<int64_t, int64_t, float, true, true>(raft::handle_t const &handle,
+                                                         std::string const &file_path,
+                                                         bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, float, false, true>, rmm::device_uvector<int64_t>>
+read_graph_snapshot<int64_t, int64_t, float, false, true>(raft::handle_t const &handle,
+                                                          std::string const &file_path,
+                                                          bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, double, true, true>, rmm::device_uvector<int64_t>>
+read_graph_snapshot<int64_t, int64_t, double, true, true>(raft::handle_t const &handle,
+                                                          std::string const &file_path,
+                                                          bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, double, false, true>, rmm::device_uvector<int64_t>>
+read_graph_snapshot<int64_t, int64_t, double, false, true>(raft::handle_t const &handle,
+                                                           std::string const &file_path,
+                                                           bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int32_t, float, true, false>, rmm::device_uvector<int32_t>>
+read_graph_snapshot<int32_t, int32_t, float, true, false>(raft::handle_t const &handle,
+                                                          std::string const &file_path,
+                                                          bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int32_t, float, false, false>, rmm::device_uvector<int32_t>>
+read_graph_snapshot<int32_t, int32_t, float, false, false>(raft::handle_t const &handle,
+                                                           std::string const &file_path,
+                                                           bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int32_t, double, true, false>, rmm::device_uvector<int32_t>>
+read_graph_snapshot<int32_t, int32_t, double, true, false>(raft::handle_t const &handle,
+                                                           std::string const &file_path,
+                                                           bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int32_t, double, false, false>, rmm::device_uvector<int32_t>>
+read_graph_snapshot<int32_t, int32_t, double, false, false>(raft::handle_t const &handle,
+                                                            std::string const &file_path,
+                                                            bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, float, true, false>, rmm::device_uvector<int32_t>>
+read_graph_snapshot<int32_t, int64_t, float, true, false>(raft::handle_t const &handle,
+                                                          std::string const &file_path,
+                                                          bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, float, false, false>, rmm::device_uvector<int32_t>>
+read_graph_snapshot<int32_t, int64_t, float, false, false>(raft::handle_t const &handle,
+                                                           std::string const &file_path,
+                                                           bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, double, true, false>, rmm::device_uvector<int32_t>>
+read_graph_snapshot<int32_t, int64_t, double, true, false>(raft::handle_t const &handle,
+                                                           std::string const &file_path,
+                                                           bool do_expensive_check);
+
+template std::tuple<graph_t<int32_t, int64_t, double, false, false>, rmm::device_uvector<int32_t>>
+read_graph_snapshot<int32_t, int64_t, double, false, false>(raft::handle_t const &handle,
+                                                            std::string const &file_path,
+                                                            bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, float, true, false>, rmm::device_uvector<int64_t>>
+read_graph_snapshot<int64_t, int64_t, float, true, false>(raft::handle_t const &handle,
+                                                          std::string const &file_path,
+                                                          bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, float, false, false>, rmm::device_uvector<int64_t>>
+read_graph_snapshot<int64_t, int64_t, float, false, false>(raft::handle_t const &handle,
+                                                           std::string const &file_path,
+                                                           bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, double, true, false>, rmm::device_uvector<int64_t>>
+read_graph_snapshot<int64_t, int64_t, double, true, false>(raft::handle_t const &handle,
+                                                           std::string const &file_path,
+                                                           bool do_expensive_check);
+
+template std::tuple<graph_t<int64_t, int64_t, double, false, false>, rmm::device_uvector<int64_t>>
+read_graph_snapshot<int64_t, int64_t, double, false, false>(raft::handle_t const &handle,
+                                                            std::string const &file_path,
+                                                            bool do_expensive_check);
+
+}  // namespace experimental
+}  // namespace cugraph
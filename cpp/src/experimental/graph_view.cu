@@ -15,7 +15,10 @@
  */
 
 #include <experimental/detail/graph_utils.cuh>
+#include <experimental/graph.hpp>
+#include <experimental/graph_builder.hpp>
 #include <experimental/graph_view.hpp>
+#include <matrix_partition_device.cuh>
 #include <partition_manager.hpp>
 #include <patterns/copy_v_transform_reduce_in_out_nbr.cuh>
 #include <utilities/error.hpp>
@@ -27,12 +30,16 @@
 #include <rmm/device_scalar.hpp>
 
 #include <thrust/count.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/sort.h>
 
 #include <algorithm>
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <numeric>
 #include <type_traits>
 #include <vector>
 
@@ -51,20 +58,42 @@ struct out_of_range_t {
   __device__ bool operator()(vertex_t v) { return (v < min) || (v >= max); }
 };
 
+// returns the number of compressed majors (the size of the offset array - 1)
+template <typename vertex_t>
+vertex_t get_compressed_major_count(
+  std::vector<vertex_t> const& adj_matrix_partition_dcs_nzd_vertex_counts,
+  std::vector<vertex_t> const& adj_matrix_partition_major_hypersparse_firsts,
+  partition_t<vertex_t> const& partition,
+  size_t adj_matrix_partition_idx)
+{
+  vertex_t major_first{};
+  vertex_t major_last{};
+  std::tie(major_first, major_last) =
+    partition.get_matrix_partition_major_range(adj_matrix_partition_idx);
+  return adj_matrix_partition_major_hypersparse_firsts.size() > 0
+           ? (adj_matrix_partition_major_hypersparse_firsts[adj_matrix_partition_idx] -
+              major_first) +
+               adj_matrix_partition_dcs_nzd_vertex_counts[adj_matrix_partition_idx]
+           : (major_last - major_first);
+}
+
 template <typename vertex_t, typename edge_t>
 std::vector<edge_t> update_adj_matrix_partition_edge_counts(
   std::vector<edge_t const*> const& adj_matrix_partition_offsets,
+  std::vector<vertex_t> const& adj_matrix_partition_dcs_nzd_vertex_counts,
+  std::vector<vertex_t> const& adj_matrix_partition_major_hypersparse_firsts,
   partition_t<vertex_t> const& partition,
   cudaStream_t stream)
 {
   std::vector<edge_t> adj_matrix_partition_edge_counts(partition.get_number_of_matrix_partitions(),
                                                        0);
   for (size_t i = 0; i < adj_matrix_partition_offsets.size(); ++i) {
-    vertex_t major_first{};
-    vertex_t major_last{};
-    std::tie(major_first, major_last) = partition.get_matrix_partition_major_range(i);
     raft::update_host(&(adj_matrix_partition_edge_counts[i]),
-                      adj_matrix_partition_offsets[i] + (major_last - major_first),
+                      adj_matrix_partition_offsets[i] +
+                        get_compressed_major_count(adj_matrix_partition_dcs_nzd_vertex_counts,
+                                                   adj_matrix_partition_major_hypersparse_firsts,
+                                                   partition,
+                                                   i),
                       1,
                       stream);
   }
@@ -72,19 +101,21 @@ std::vector<edge_t> update_adj_matrix_partition_edge_counts(
   return adj_matrix_partition_edge_counts;
 }
 
-template <typename vertex_t,
+// counts the (unmasked) in (if in is true) or out (otherwise) edges of the local vertices
+template <bool in,
+          typename vertex_t,
           typename edge_t,
           typename weight_t,
           bool store_transposed,
           bool multi_gpu>
-rmm::device_uvector<edge_t> compute_minor_degrees(
+rmm::device_uvector<edge_t> compute_degrees_by_pattern(
   raft::handle_t const& handle,
   graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> const& graph_view)
 {
-  rmm::device_uvector<edge_t> minor_degrees(graph_view.get_number_of_local_vertices(),
-                                            handle.get_stream());
-  if (store_transposed) {
-    copy_v_transform_reduce_out_nbr(
+  rmm::device_uvector<edge_t> degrees(graph_view.get_number_of_local_vertices(),
+                                      handle.get_stream());
+  if (in) {
+    copy_v_transform_reduce_in_nbr(
       handle,
       graph_view,
       thrust::make_constant_iterator(0) /* dummy */,
@@ -93,9 +124,9 @@ rmm::device_uvector<edge_t> compute_minor_degrees(
         return edge_t{1};
       },
       edge_t{0},
-      minor_degrees.data());
+      degrees.data());
   } else {
-    copy_v_transform_reduce_in_nbr(
+    copy_v_transform_reduce_out_nbr(
       handle,
       graph_view,
       thrust::make_constant_iterator(0) /* dummy */,
@@ -104,10 +135,10 @@ rmm::device_uvector<edge_t> compute_minor_degrees(
         return edge_t{1};
       },
       edge_t{0},
-      minor_degrees.data());
+      degrees.data());
   }
 
-  return minor_degrees;
+  return degrees;
 }
 
 template <bool major,
@@ -149,6 +180,98 @@ rmm::device_uvector<weight_t> compute_weight_sums(
   return weight_sums;
 }
 
+// decompress the edges of an adjacency matrix partition to an edge list (of sources and
+// destinations)
+template <typename GraphViewType>
+struct decompress_matrix_partition_to_edgelist_t {
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  matrix_partition_device_t<GraphViewType> matrix_partition;
+  vertex_t* srcs{nullptr};
+  vertex_t* dsts{nullptr};
+  weight_t* weights{nullptr};
+
+  __device__ void operator()(vertex_t major_offset) const
+  {
+    auto local_offset = matrix_partition.get_local_offset(major_offset);
+    auto local_degree = matrix_partition.get_local_degree(major_offset);
+    auto major        = matrix_partition.get_major_from_major_offset_nocheck(major_offset);
+    for (edge_t i = 0; i < local_degree; ++i) {
+      auto minor             = matrix_partition.get_minor_nocheck(local_offset + i);
+      srcs[local_offset + i] = GraphViewType::is_adj_matrix_transposed ? minor : major;
+      dsts[local_offset + i] = GraphViewType::is_adj_matrix_transposed ? major : minor;
+      if (weights != nullptr) {
+        weights[local_offset + i] = *(matrix_partition.get_weights() + local_offset + i);
+      }
+    }
+  }
+};
+
+// build a graph_t object storing the graph of graph_view with the opposite store_transposed value;
+// the edges are streamed to graph_builder_t one adjacency matrix partition at a time (in
+// multi-GPU, graph_builder_t shuffles the edges to their new owners)
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+graph_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu> transpose_storage(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> const& graph_view,
+  graph_properties_t properties)
+{
+  using graph_view_type = graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>;
+
+  std::vector<vertex_t> vertex_partition_offsets{};
+  if (multi_gpu) {
+    auto const comm_size = handle.get_comms().get_size();
+    vertex_partition_offsets.resize(comm_size + 1);
+    for (int i = 0; i < comm_size; ++i) {
+      vertex_partition_offsets[i] = graph_view.get_vertex_partition_first(i);
+    }
+    vertex_partition_offsets[comm_size] = graph_view.get_number_of_vertices();
+  }
+
+  graph_builder_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu> builder(
+    handle, graph_view.get_number_of_vertices(), properties, vertex_partition_offsets);
+
+  for (size_t pass = 0; pass < 2; ++pass) {
+    for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      matrix_partition_device_t<graph_view_type> matrix_partition(graph_view, i);
+      auto num_edges = graph_view.get_number_of_local_adj_matrix_partition_edges(i);
+
+      rmm::device_uvector<vertex_t> srcs(num_edges, handle.get_stream());
+      rmm::device_uvector<vertex_t> dsts(num_edges, handle.get_stream());
+      rmm::device_uvector<weight_t> weights(
+        (pass == 1) && graph_view.is_weighted() ? num_edges : edge_t{0}, handle.get_stream());
+      thrust::for_each(
+        rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+        thrust::make_counting_iterator(vertex_t{0}),
+        thrust::make_counting_iterator(matrix_partition.get_major_size()),
+        decompress_matrix_partition_to_edgelist_t<graph_view_type>{
+          matrix_partition,
+          srcs.data(),
+          dsts.data(),
+          weights.size() > 0 ? weights.data() : static_cast<weight_t*>(nullptr)});
+
+      edgelist_t<vertex_t, edge_t, weight_t> chunk{
+        srcs.data(),
+        dsts.data(),
+        weights.size() > 0 ? weights.data() : static_cast<weight_t*>(nullptr),
+        num_edges};
+      if (pass == 0) {
+        builder.count_edges(chunk);
+      } else {
+        builder.insert_edges(chunk);
+      }
+    }
+  }
+
+  return builder.build();
+}
+
 }  // namespace
 
 template <typename vertex_t,
@@ -160,7 +283,11 @@ graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enabl
   graph_view_t(raft::handle_t const& handle,
                std::vector<edge_t const*> const& adj_matrix_partition_offsets,
                std::vector<vertex_t const*> const& adj_matrix_partition_indices,
+               std::vector<uint32_t const*> const& adj_matrix_partition_local_indices,
                std::vector<weight_t const*> const& adj_matrix_partition_weights,
+               std::vector<vertex_t const*> const& adj_matrix_partition_dcs_nzd_vertices,
+               std::vector<vertex_t> const& adj_matrix_partition_dcs_nzd_vertex_counts,
+               std::vector<vertex_t> const& adj_matrix_partition_major_hypersparse_firsts,
                std::vector<vertex_t> const& vertex_partition_segment_offsets,
                partition_t<vertex_t> const& partition,
                vertex_t number_of_vertices,
@@ -172,9 +299,17 @@ graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enabl
       handle, number_of_vertices, number_of_edges, properties),
     adj_matrix_partition_offsets_(adj_matrix_partition_offsets),
     adj_matrix_partition_indices_(adj_matrix_partition_indices),
+    adj_matrix_partition_local_indices_(adj_matrix_partition_local_indices),
     adj_matrix_partition_weights_(adj_matrix_partition_weights),
-    adj_matrix_partition_number_of_edges_(update_adj_matrix_partition_edge_counts(
-      adj_matrix_partition_offsets, partition, handle.get_stream())),
+    adj_matrix_partition_number_of_edges_(
+      update_adj_matrix_partition_edge_counts(adj_matrix_partition_offsets,
+                                              adj_matrix_partition_dcs_nzd_vertex_counts,
+                                              adj_matrix_partition_major_hypersparse_firsts,
+                                              partition,
+                                              handle.get_stream())),
+    adj_matrix_partition_dcs_nzd_vertices_(adj_matrix_partition_dcs_nzd_vertices),
+    adj_matrix_partition_dcs_nzd_vertex_counts_(adj_matrix_partition_dcs_nzd_vertex_counts),
+    adj_matrix_partition_major_hypersparse_firsts_(adj_matrix_partition_major_hypersparse_firsts),
     partition_(partition),
     vertex_partition_segment_offsets_(vertex_partition_segment_offsets)
 {
@@ -191,6 +326,12 @@ graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enabl
   CUGRAPH_EXPECTS(adj_matrix_partition_offsets.size() == adj_matrix_partition_indices.size(),
                   "Internal Error: adj_matrix_partition_offsets.size() and "
                   "adj_matrix_partition_indices.size() should coincide.");
+  CUGRAPH_EXPECTS(
+    (adj_matrix_partition_local_indices.size() == adj_matrix_partition_offsets.size()) ||
+      (adj_matrix_partition_local_indices.size() == 0),
+    "Internal Error: adj_matrix_partition_local_indices.size() should coincide with "
+    "adj_matrix_partition_offsets.size() (if minors are stored as local offsets) or 0 "
+    "(otherwise).");
   CUGRAPH_EXPECTS((adj_matrix_partition_weights.size() == adj_matrix_partition_offsets.size()) ||
                     (adj_matrix_partition_weights.size() == 0),
                   "Internal Error: adj_matrix_partition_weights.size() should coincide with "
@@ -199,6 +340,18 @@ graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enabl
   CUGRAPH_EXPECTS(adj_matrix_partition_offsets.size() == static_cast<size_t>(col_comm_size),
                   "Internal Error: erroneous adj_matrix_partition_offsets.size().");
 
+  CUGRAPH_EXPECTS(
+    ((adj_matrix_partition_dcs_nzd_vertices.size() == adj_matrix_partition_offsets.size()) ||
+     (adj_matrix_partition_dcs_nzd_vertices.size() == 0)) &&
+      (adj_matrix_partition_dcs_nzd_vertex_counts.size() ==
+       adj_matrix_partition_dcs_nzd_vertices.size()) &&
+      (adj_matrix_partition_major_hypersparse_firsts.size() ==
+       adj_matrix_partition_dcs_nzd_vertices.size()),
+    "Internal Error: adj_matrix_partition_dcs_nzd_vertices.size(), "
+    "adj_matrix_partition_dcs_nzd_vertex_counts.size(), and "
+    "adj_matrix_partition_major_hypersparse_firsts.size() should coincide with "
+    "adj_matrix_partition_offsets.size() (if DCSR/DCSC is used) or 0 (otherwise).");
+
   CUGRAPH_EXPECTS((sorted_by_global_degree_within_vertex_partition &&
                    (vertex_partition_segment_offsets.size() ==
                     col_comm_size * (detail::num_segments_per_vertex_partition + 1))) ||
@@ -227,26 +380,60 @@ graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enabl
       vertex_t minor_last{};
       std::tie(major_first, major_last) = partition.get_matrix_partition_major_range(i);
       std::tie(minor_first, minor_last) = partition.get_matrix_partition_minor_range();
+      auto compressed_major_count =
+        get_compressed_major_count(adj_matrix_partition_dcs_nzd_vertex_counts,
+                                   adj_matrix_partition_major_hypersparse_firsts,
+                                   partition,
+                                   i);
       CUGRAPH_EXPECTS(
         thrust::is_sorted(rmm::exec_policy(default_stream)->on(default_stream),
                           adj_matrix_partition_offsets[i],
-                          adj_matrix_partition_offsets[i] + (major_last - major_first + 1)),
+                          adj_matrix_partition_offsets[i] + (compressed_major_count + 1)),
         "Internal Error: adj_matrix_partition_offsets[] is not sorted.");
+      if (adj_matrix_partition_dcs_nzd_vertices.size() > 0) {
+        auto major_hypersparse_first = adj_matrix_partition_major_hypersparse_firsts[i];
+        CUGRAPH_EXPECTS(
+          (major_hypersparse_first >= major_first) && (major_hypersparse_first <= major_last),
+          "Internal Error: adj_matrix_partition_major_hypersparse_firsts[] is out-of-range.");
+        auto dcs_nzd_vertex_first = adj_matrix_partition_dcs_nzd_vertices[i];
+        auto dcs_nzd_vertex_last =
+          dcs_nzd_vertex_first + adj_matrix_partition_dcs_nzd_vertex_counts[i];
+        CUGRAPH_EXPECTS(
+          thrust::is_sorted(rmm::exec_policy(default_stream)->on(default_stream),
+                            dcs_nzd_vertex_first,
+                            dcs_nzd_vertex_last) &&
+            (thrust::count_if(rmm::exec_policy(default_stream)->on(default_stream),
+                              dcs_nzd_vertex_first,
+                              dcs_nzd_vertex_last,
+                              out_of_range_t<vertex_t>{major_hypersparse_first, major_last}) == 0),
+          "Internal Error: adj_matrix_partition_dcs_nzd_vertices[] is not sorted or has "
+          "out-of-range vertex IDs.");
+      }
       edge_t number_of_local_edges{};
       raft::update_host(&number_of_local_edges,
-                        adj_matrix_partition_offsets[i] + (major_last - major_first),
+                        adj_matrix_partition_offsets[i] + compressed_major_count,
                         1,
                         default_stream);
       CUDA_TRY(cudaStreamSynchronize(default_stream));
       number_of_local_edges_sum += number_of_local_edges;
 
       // better use thrust::any_of once https://github.com/thrust/thrust/issues/1016 is resolved
-      CUGRAPH_EXPECTS(
-        thrust::count_if(rmm::exec_policy(default_stream)->on(default_stream),
-                         adj_matrix_partition_indices[i],
-                         adj_matrix_partition_indices[i] + number_of_local_edges,
-                         out_of_range_t<vertex_t>{minor_first, minor_last}) == 0,
-        "Internal Error: adj_matrix_partition_indices[] have out-of-range vertex IDs.");
+      if (adj_matrix_partition_local_indices.size() > 0) {
+        CUGRAPH_EXPECTS(
+          thrust::count_if(rmm::exec_policy(default_stream)->on(default_stream),
+                           adj_matrix_partition_local_indices[i],
+                           adj_matrix_partition_local_indices[i] + number_of_local_edges,
+                           out_of_range_t<uint32_t>{
+                             uint32_t{0}, static_cast<uint32_t>(minor_last - minor_first)}) == 0,
+          "Internal Error: adj_matrix_partition_local_indices[] have out-of-range values.");
+      } else {
+        CUGRAPH_EXPECTS(
+          thrust::count_if(rmm::exec_policy(default_stream)->on(default_stream),
+                           adj_matrix_partition_indices[i],
+                           adj_matrix_partition_indices[i] + number_of_local_edges,
+                           out_of_range_t<vertex_t>{minor_first, minor_last}) == 0,
+          "Internal Error: adj_matrix_partition_indices[] have out-of-range vertex IDs.");
+      }
     }
     number_of_local_edges_sum = host_scalar_allreduce(
       this->get_handle_ptr()->get_comms(), number_of_local_edges_sum, default_stream);
@@ -255,7 +442,12 @@ graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enabl
                     "number_of_local_edges.");
 
     if (sorted_by_global_degree_within_vertex_partition) {
-      auto degrees = detail::compute_major_degrees(handle, adj_matrix_partition_offsets, partition);
+      auto degrees = detail::compute_major_degrees(handle,
+                                                   adj_matrix_partition_offsets,
+                                                   adj_matrix_partition_dcs_nzd_vertices,
+                                                   adj_matrix_partition_dcs_nzd_vertex_counts,
+                                                   adj_matrix_partition_major_hypersparse_firsts,
+                                                   partition);
       CUGRAPH_EXPECTS(
         thrust::is_sorted(rmm::exec_policy(default_stream)->on(default_stream),
                           degrees.begin(),
@@ -382,11 +574,16 @@ rmm::device_uvector<edge_t>
 graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
   compute_in_degrees(raft::handle_t const& handle) const
 {
-  if (store_transposed) {
-    return detail::compute_major_degrees(
-      handle, this->adj_matrix_partition_offsets_, this->partition_);
+  // major degrees from the offsets do not account for masked out edges
+  if (store_transposed && !this->has_edge_mask()) {
+    return detail::compute_major_degrees(handle,
+                                         this->adj_matrix_partition_offsets_,
+                                         this->adj_matrix_partition_dcs_nzd_vertices_,
+                                         this->adj_matrix_partition_dcs_nzd_vertex_counts_,
+                                         this->adj_matrix_partition_major_hypersparse_firsts_,
+                                         this->partition_);
   } else {
-    return compute_minor_degrees(handle, *this);
+    return compute_degrees_by_pattern<true>(handle, *this);
   }
 }
 
@@ -403,11 +600,12 @@ graph_view_t<vertex_t,
              multi_gpu,
              std::enable_if_t<!multi_gpu>>::compute_in_degrees(raft::handle_t const& handle) const
 {
-  if (store_transposed) {
+  // major degrees from the offsets do not account for masked out edges
+  if (store_transposed && !this->has_edge_mask()) {
     return detail::compute_major_degrees(
       handle, this->offsets_, this->get_number_of_local_vertices());
   } else {
-    return compute_minor_degrees(handle, *this);
+    return compute_degrees_by_pattern<true>(handle, *this);
   }
 }
 
@@ -420,11 +618,16 @@ rmm::device_uvector<edge_t>
 graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
   compute_out_degrees(raft::handle_t const& handle) const
 {
-  if (store_transposed) {
-    return compute_minor_degrees(handle, *this);
+  // major degrees from the offsets do not account for masked out edges
+  if (store_transposed || this->has_edge_mask()) {
+    return compute_degrees_by_pattern<false>(handle, *this);
   } else {
-    return detail::compute_major_degrees(
-      handle, this->adj_matrix_partition_offsets_, this->partition_);
+    return detail::compute_major_degrees(handle,
+                                         this->adj_matrix_partition_offsets_,
+                                         this->adj_matrix_partition_dcs_nzd_vertices_,
+                                         this->adj_matrix_partition_dcs_nzd_vertex_counts_,
+                                         this->adj_matrix_partition_major_hypersparse_firsts_,
+                                         this->partition_);
   }
 }
 
@@ -441,8 +644,9 @@ graph_view_t<vertex_t,
              multi_gpu,
              std::enable_if_t<!multi_gpu>>::compute_out_degrees(raft::handle_t const& handle) const
 {
-  if (store_transposed) {
-    return compute_minor_degrees(handle, *this);
+  // major degrees from the offsets do not account for masked out edges
+  if (store_transposed || this->has_edge_mask()) {
+    return compute_degrees_by_pattern<false>(handle, *this);
   } else {
     return detail::compute_major_degrees(
       handle, this->offsets_, this->get_number_of_local_vertices());
@@ -689,6 +893,84 @@ weight_t graph_view_t<
   return ret;
 }
 
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+double
+graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  compute_edge_partition_imbalance(raft::handle_t const& handle) const
+{
+  edge_t number_of_local_edges{0};
+  for (size_t i = 0; i < this->get_number_of_local_adj_matrix_partitions(); ++i) {
+    number_of_local_edges += this->get_number_of_local_adj_matrix_partition_edges(i);
+  }
+  auto local_edge_counts =
+    host_scalar_allgather(handle.get_comms(), number_of_local_edges, handle.get_stream());
+
+  auto max_count  = *std::max_element(local_edge_counts.begin(), local_edge_counts.end());
+  auto mean_count = static_cast<double>(std::accumulate(
+                      local_edge_counts.begin(), local_edge_counts.end(), edge_t{0})) /
+                    static_cast<double>(local_edge_counts.size());
+  return mean_count > 0.0 ? static_cast<double>(max_count) / mean_count : 1.0;
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+graph_view_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu>
+graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu, std::enable_if_t<multi_gpu>>::
+  get_transposed_storage_view(raft::handle_t const& handle) const
+{
+  using transposed_graph_t = graph_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu>;
+
+  CUGRAPH_EXPECTS(!this->has_edge_mask(),
+                  "Invalid input argument: edge masks are not supported for transposed storage.");
+
+  auto& cache = get_property_cache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  if (!cache.transposed_storage_graph) {
+    auto transposed_graph = std::make_shared<transposed_graph_t>(
+      transpose_storage(handle, *this, this->get_graph_properties()));
+    handle.get_stream_view().synchronize();  // see get_or_compute_graph_property()
+    cache.transposed_storage_graph = std::move(transposed_graph);
+  }
+  return std::static_pointer_cast<transposed_graph_t>(cache.transposed_storage_graph)->view();
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+graph_view_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu>
+graph_view_t<vertex_t,
+             edge_t,
+             weight_t,
+             store_transposed,
+             multi_gpu,
+             std::enable_if_t<!multi_gpu>>::get_transposed_storage_view(raft::handle_t const&
+                                                                          handle) const
+{
+  using transposed_graph_t = graph_t<vertex_t, edge_t, weight_t, !store_transposed, multi_gpu>;
+
+  CUGRAPH_EXPECTS(!this->has_edge_mask(),
+                  "Invalid input argument: edge masks are not supported for transposed storage.");
+
+  auto& cache = get_property_cache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  if (!cache.transposed_storage_graph) {
+    auto transposed_graph = std::make_shared<transposed_graph_t>(
+      transpose_storage(handle, *this, this->get_graph_properties()));
+    handle.get_stream_view().synchronize();  // see get_or_compute_graph_property()
+    cache.transposed_storage_graph = std::move(transposed_graph);
+  }
+  return std::static_pointer_cast<transposed_graph_t>(cache.transposed_storage_graph)->view();
+}
+
 // explicit instantiation
 
 template class graph_view_t<int32_t, int32_t, float, true, true>;
@@ -0,0 +1,377 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithms.hpp>
+#include <experimental/graph_view.hpp>
+#include <patterns/copy_to_adj_matrix_row_col.cuh>
+#include <patterns/copy_to_adj_matrix_row_col_bfloat16.cuh>
+#include <patterns/copy_v_transform_reduce_in_out_nbr.cuh>
+#include <patterns/count_if_v.cuh>
+#include <patterns/reduce_v.cuh>
+#include <patterns/transform_reduce_v.cuh>
+#include <utilities/device_comm.cuh>
+#include <utilities/error.hpp>
+#include <utilities/profiling.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <cub/cub.cuh>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <limits>
+#include <tuple>
+
+namespace cugraph {
+namespace experimental {
+namespace detail {
+
+// computes the (aggregate) maximum hub and authority values to maxima[0] and maxima[1] (in device
+// memory) without synchronizing the stream
+template <bool multi_gpu, typename vertex_t, typename result_t>
+void compute_max_hub_authority(raft::handle_t const &handle,
+                               result_t const *hubs,
+                               result_t const *authorities,
+                               vertex_t num_local_vertices,
+                               result_t *maxima)
+{
+  // an empty input yields the lowest value, so clamp the maxima later while dividing
+  size_t tmp_storage_bytes{0};
+  cub::DeviceReduce::Max(static_cast<void *>(nullptr),
+                         tmp_storage_bytes,
+                         hubs,
+                         maxima,
+                         num_local_vertices,
+                         handle.get_stream());
+  rmm::device_buffer tmp_storage(tmp_storage_bytes, handle.get_stream());
+  cub::DeviceReduce::Max(
+    tmp_storage.data(), tmp_storage_bytes, hubs, maxima, num_local_vertices, handle.get_stream());
+  cub::DeviceReduce::Max(tmp_storage.data(),
+                         tmp_storage_bytes,
+                         authorities,
+                         maxima + 1,
+                         num_local_vertices,
+                         handle.get_stream());
+  if (multi_gpu) {
+    // a single reduction for both maxima
+    device_allreduce(handle.get_comms(),
+                     maxima,
+                     maxima,
+                     size_t{2},
+                     raft::comms::op_t::MAX,
+                     handle.get_stream());
+  }
+}
+
+template <typename GraphViewType, typename result_t>
+std::tuple<result_t, size_t> hits(raft::handle_t const &handle,
+                                  GraphViewType const &pull_graph_view,
+                                  result_t *hubs,
+                                  result_t *authorities,
+                                  result_t epsilon,
+                                  size_t max_iterations,
+                                  bool has_initial_hubs_guess,
+                                  bool normalize,
+                                  bool do_expensive_check,
+                                  size_t convergence_check_interval,
+                                  bool reduced_precision)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the pull model.");
+
+  profile_range_t profile_range(handle, "hits");
+
+  auto const num_vertices       = pull_graph_view.get_number_of_vertices();
+  auto const num_local_vertices = pull_graph_view.get_number_of_local_vertices();
+  if (num_vertices == 0) { return std::make_tuple(result_t{0.0}, size_t{0}); }
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((hubs != nullptr) && (authorities != nullptr),
+                  "Invalid input argument: hubs and authorities should be provided.");
+  CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+  CUGRAPH_EXPECTS(convergence_check_interval > 0,
+                  "Invalid input argument: convergence_check_interval should be positive.");
+
+  if (do_expensive_check) {
+    if (has_initial_hubs_guess) {
+      auto num_negative_values = count_if_v(
+        handle, pull_graph_view, hubs, [] __device__(auto val) { return val < 0.0; });
+      CUGRAPH_EXPECTS(num_negative_values == 0,
+                      "Invalid input argument: initial guess values should be non-negative.");
+    }
+  }
+
+  // 2. initialize hub values
+
+  if (has_initial_hubs_guess) {
+    auto sum = reduce_v(handle, pull_graph_view, hubs, result_t{0.0});
+    CUGRAPH_EXPECTS(sum > 0.0,
+                    "Invalid input argument: sum of the initial hub values should be positive.");
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      hubs,
+                      hubs + num_local_vertices,
+                      hubs,
+                      [sum] __device__(auto val) { return val / sum; });
+  } else {
+    thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 hubs,
+                 hubs + num_local_vertices,
+                 result_t{1.0} / static_cast<result_t>(num_vertices));
+  }
+
+  // 3. HITS iteration
+
+  // old hub values
+  rmm::device_uvector<result_t> tmp_hubs(num_local_vertices, handle.get_stream());
+  // the adjacency matrix row & column values are stored (and communicated in multi-GPU) in bfloat16
+  // till the iteration gets close to convergence if reduced_precision is true
+  auto use_bfloat16 = reduced_precision;
+  auto const num_rows = pull_graph_view.get_number_of_local_adj_matrix_partition_rows();
+  auto const num_cols = pull_graph_view.get_number_of_local_adj_matrix_partition_cols();
+  rmm::device_uvector<result_t> adj_matrix_row_hubs(use_bfloat16 ? vertex_t{0} : num_rows,
+                                                    handle.get_stream());
+  rmm::device_uvector<result_t> adj_matrix_col_authorities(use_bfloat16 ? vertex_t{0} : num_cols,
+                                                           handle.get_stream());
+  rmm::device_uvector<bfloat16_t> adj_matrix_row_bfloat16_hubs(
+    use_bfloat16 ? num_rows : vertex_t{0}, handle.get_stream());
+  rmm::device_uvector<bfloat16_t> adj_matrix_col_bfloat16_authorities(
+    use_bfloat16 ? num_cols : vertex_t{0}, handle.get_stream());
+  auto new_hubs = hubs;
+  auto old_hubs = tmp_hubs.data();
+  // the maxima and the hub value difference sum stay in device memory, so iterations between
+  // convergence checks do not synchronize the stream
+  rmm::device_uvector<result_t> maxima(2, handle.get_stream());
+  rmm::device_scalar<result_t> d_diff_sum(result_t{0.0}, handle.get_stream());
+  result_t diff_sum{0.0};
+  auto last_diff_sum = std::numeric_limits<result_t>::max();
+  size_t iter{0};
+  while (true) {
+    std::swap(new_hubs, old_hubs);
+
+    // authority(v) = sum of hub(u) over the edges (u, v)
+
+    auto authority_e_op =
+      [] __device__(vertex_t src, vertex_t dst, weight_t w, auto src_val, auto dst_val) {
+        return src_val;
+      };
+    if (use_bfloat16) {
+      copy_to_adj_matrix_row_bfloat16(
+        handle, pull_graph_view, old_hubs, adj_matrix_row_bfloat16_hubs.data());
+
+      copy_v_transform_reduce_in_nbr(
+        handle,
+        pull_graph_view,
+        make_bfloat16_input_iterator<result_t>(adj_matrix_row_bfloat16_hubs.data()),
+        thrust::make_constant_iterator(0) /* dummy */,
+        authority_e_op,
+        result_t{0.0},
+        authorities);
+    } else {
+      copy_to_adj_matrix_row(handle, pull_graph_view, old_hubs, adj_matrix_row_hubs.begin());
+
+      copy_v_transform_reduce_in_nbr(handle,
+                                     pull_graph_view,
+                                     adj_matrix_row_hubs.begin(),
+                                     thrust::make_constant_iterator(0) /* dummy */,
+                                     authority_e_op,
+                                     result_t{0.0},
+                                     authorities);
+    }
+
+    // hub(u) = sum of authority(v) over the edges (u, v)
+
+    auto hub_e_op =
+      [] __device__(vertex_t src, vertex_t dst, weight_t w, auto src_val, auto dst_val) {
+        return dst_val;
+      };
+    if (use_bfloat16) {
+      copy_to_adj_matrix_col_bfloat16(
+        handle, pull_graph_view, authorities, adj_matrix_col_bfloat16_authorities.data());
+
+      copy_v_transform_reduce_out_nbr(
+        handle,
+        pull_graph_view,
+        thrust::make_constant_iterator(0) /* dummy */,
+        make_bfloat16_input_iterator<result_t>(adj_matrix_col_bfloat16_authorities.data()),
+        hub_e_op,
+        result_t{0.0},
+        new_hubs);
+    } else {
+      copy_to_adj_matrix_col(
+        handle, pull_graph_view, authorities, adj_matrix_col_authorities.begin());
+
+      copy_v_transform_reduce_out_nbr(handle,
+                                      pull_graph_view,
+                                      thrust::make_constant_iterator(0) /* dummy */,
+                                      adj_matrix_col_authorities.begin(),
+                                      hub_e_op,
+                                      result_t{0.0},
+                                      new_hubs);
+    }
+
+    // normalize both hubs and authorities by their maximum values in a single pass
+
+    compute_max_hub_authority<GraphViewType::is_multi_gpu>(
+      handle, new_hubs, authorities, num_local_vertices, maxima.data());
+
+    auto val_first = thrust::make_zip_iterator(thrust::make_tuple(new_hubs, authorities));
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      val_first,
+                      val_first + num_local_vertices,
+                      val_first,
+                      [maxima = maxima.data()] __device__(auto val) {
+                        auto hub_divisor       = maxima[0] > 0.0 ? maxima[0] : result_t{1.0};
+                        auto authority_divisor = maxima[1] > 0.0 ? maxima[1] : result_t{1.0};
+                        return thrust::make_tuple(thrust::get<0>(val) / hub_divisor,
+                                                  thrust::get<1>(val) / authority_divisor);
+                      });
+
+    transform_reduce_v_async(
+      handle,
+      pull_graph_view,
+      thrust::make_zip_iterator(thrust::make_tuple(new_hubs, old_hubs)),
+      [] __device__(auto val) { return std::abs(thrust::get<0>(val) - thrust::get<1>(val)); },
+      result_t{0.0},
+      d_diff_sum.data());
+
+    iter++;
+    add_profile_counter("iterations", 1);
+
+    if ((iter % convergence_check_interval == 0) || (iter >= max_iterations)) {
+      diff_sum = d_diff_sum.value(handle.get_stream());
+      if (use_bfloat16) {
+        // the last iterations run in full precision to reach the full precision tolerance
+        if (detail::fall_back_from_bfloat16(diff_sum, last_diff_sum, epsilon)) {
+          use_bfloat16 = false;
+          adj_matrix_row_bfloat16_hubs.resize(0, handle.get_stream());
+          adj_matrix_row_bfloat16_hubs.shrink_to_fit(handle.get_stream());
+          adj_matrix_col_bfloat16_authorities.resize(0, handle.get_stream());
+          adj_matrix_col_bfloat16_authorities.shrink_to_fit(handle.get_stream());
+          adj_matrix_row_hubs.resize(num_rows, handle.get_stream());
+          adj_matrix_col_authorities.resize(num_cols, handle.get_stream());
+          add_profile_counter("full_precision_fallbacks", 1);
+        }
+        last_diff_sum = diff_sum;
+        if (iter >= max_iterations) { break; }
+      } else if ((diff_sum < epsilon) || (iter >= max_iterations)) {
+        break;
+      }
+    }
+  }
+
+  if (new_hubs != hubs) {
+    thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 new_hubs,
+                 new_hubs + num_local_vertices,
+                 hubs);
+  }
+
+  if (normalize) {
+    auto hub_sum           = reduce_v(handle, pull_graph_view, hubs, result_t{0.0});
+    auto authority_sum     = reduce_v(handle, pull_graph_view, authorities, result_t{0.0});
+    auto hub_divisor       = hub_sum > 0.0 ? hub_sum : result_t{1.0};
+    auto authority_divisor = authority_sum > 0.0 ? authority_sum : result_t{1.0};
+    auto val_first         = thrust::make_zip_iterator(thrust::make_tuple(hubs, authorities));
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      val_first,
+                      val_first + num_local_vertices,
+                      val_first,
+                      [hub_divisor, authority_divisor] __device__(auto val) {
+                        return thrust::make_tuple(thrust::get<0>(val) / hub_divisor,
+                                                  thrust::get<1>(val) / authority_divisor);
+                      });
+  }
+
+  return std::make_tuple(diff_sum, iter);
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+std::tuple<result_t, size_t> hits(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const &graph_view,
+  result_t *hubs,
+  result_t *authorities,
+  result_t epsilon,
+  size_t max_iterations,
+  bool has_initial_hubs_guess,
+  bool normalize,
+  bool do_expensive_check,
+  size_t convergence_check_interval,
+  bool reduced_precision)
+{
+  return detail::hits(handle,
+                      graph_view,
+                      hubs,
+                      authorities,
+                      epsilon,
+                      max_iterations,
+                      has_initial_hubs_guess,
+                      normalize,
+                      do_expensive_check,
+                      convergence_check_interval,
+                      reduced_precision);
+}
+
+// explicit instantiation
+
+#define INSTANTIATE_HITS(vertex_t, edge_t, weight_t, multi_gpu)                  \
+  template std::tuple<weight_t, size_t> hits(                                    \
+    raft::handle_t const &handle,                                                \
+    graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const &graph_view, \
+    weight_t *hubs,                                                              \
+    weight_t *authorities,                                                       \
+    weight_t epsilon,                                                            \
+    size_t max_iterations,                                                       \
+    bool has_initial_hubs_guess,                                                 \
+    bool normalize,                                                              \
+    bool do_expensive_check,                                                     \
+    size_t convergence_check_interval,                                           \
+    bool reduced_precision);
+
+INSTANTIATE_HITS(int32_t, int32_t, float, true)
+INSTANTIATE_HITS(int32_t, int32_t, double, true)
+INSTANTIATE_HITS(int32_t, int64_t, float, true)
+INSTANTIATE_HITS(int32_t, int64_t, double, true)
+INSTANTIATE_HITS(int64_t, int64_t, float, true)
+INSTANTIATE_HITS(int64_t, int64_t, double, true)
+INSTANTIATE_HITS(int32_t, int32_t, float, false)
+INSTANTIATE_HITS(int32_t, int32_t, double, false)
+INSTANTIATE_HITS(int32_t, int64_t, float, false)
+INSTANTIATE_HITS(int32_t, int64_t, double, false)
+INSTANTIATE_HITS(int64_t, int64_t, float, false)
+INSTANTIATE_HITS(int64_t, int64_t, double, false)
+
+}  // namespace experimental
+}  // namespace cugraph
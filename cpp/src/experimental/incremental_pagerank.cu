@@ -0,0 +1,768 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithms.hpp>
+#include <experimental/detail/graph_utils.cuh>
+#include <experimental/graph_view.hpp>
+#include <patterns/copy_to_adj_matrix_row_col.cuh>
+#include <patterns/count_if_e.cuh>
+#include <patterns/count_if_v.cuh>
+#include <patterns/reduce_op.cuh>
+#include <patterns/update_frontier_v_push_if_out_nbr.cuh>
+#include <patterns/vertex_frontier.cuh>
+#include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+#include <utilities/shuffle_comm.cuh>
+#include <vertex_partition_device.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+namespace detail {
+
+// an edge delta weight is positive for an edge insertion and negative for an edge deletion
+template <typename weight_t, typename edge_t>
+struct delta_weight_to_delta_degree_t {
+  __host__ __device__ edge_t operator()(weight_t w) const
+  {
+    return w > weight_t{0.0} ? edge_t{1} : edge_t{-1};
+  }
+};
+
+template <typename GraphViewType, typename result_t>
+void insert_active_vertices(raft::handle_t const& handle,
+                            GraphViewType const& push_graph_view,
+                            result_t const* residuals,
+                            result_t threshold,
+                            Bucket<typename GraphViewType::vertex_type,
+                                   GraphViewType::is_multi_gpu>& bucket)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  rmm::device_uvector<vertex_t> active_vertices(push_graph_view.get_number_of_local_vertices(),
+                                                handle.get_stream());
+  auto local_vertex_first = push_graph_view.get_local_vertex_first();
+  auto last =
+    thrust::copy_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    thrust::make_counting_iterator(local_vertex_first),
+                    thrust::make_counting_iterator(push_graph_view.get_local_vertex_last()),
+                    active_vertices.begin(),
+                    [residuals, local_vertex_first, threshold] __device__(auto v) {
+                      return std::abs(*(residuals + (v - local_vertex_first))) > threshold;
+                    });
+  bucket.insert(active_vertices.begin(), last);
+}
+
+template <typename GraphViewType, typename result_t>
+void incremental_pagerank(raft::handle_t const& handle,
+                          GraphViewType const& push_graph_view,
+                          typename GraphViewType::vertex_type const* delta_srcs,
+                          typename GraphViewType::vertex_type const* delta_dsts,
+                          typename GraphViewType::weight_type const* delta_weights,
+                          typename GraphViewType::edge_type num_delta_edges,
+                          result_t* pageranks,
+                          result_t alpha,
+                          result_t epsilon,
+                          size_t max_iterations,
+                          bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_vertices = push_graph_view.get_number_of_vertices();
+  if (num_vertices == 0) { return; }
+
+  // implements residual (forward) push PageRank warm-started from the previous PageRank scores,
+  // the residuals of the previous scores on the updated graph are non-zero only near the updated
+  // edges (besides the uniform part coming from vertices becoming or ceasing to be dangling), so
+  // only the vertices in the frontier (vertices with a residual larger than the threshold) are
+  // visited in each iteration.
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((num_delta_edges >= 0) &&
+                    ((num_delta_edges == 0) ||
+                     ((delta_srcs != nullptr) && (delta_dsts != nullptr) &&
+                      (delta_weights != nullptr))),
+                  "Invalid input argument: num_delta_edges should be non-negative and delta_srcs, "
+                  "delta_dsts, and delta_weights should be provided if num_delta_edges is "
+                  "positive.");
+  CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha <= 1.0),
+                  "Invalid input argument: alpha should be in [0.0, 1.0].");
+  CUGRAPH_EXPECTS(epsilon > 0.0, "Invalid input argument: epsilon should be positive.");
+
+  if (do_expensive_check) {
+    if (push_graph_view.is_weighted()) {
+      auto num_nonpositive_edge_weights = count_if_e(
+        handle,
+        push_graph_view,
+        thrust::make_constant_iterator(0) /* dummy */,
+        thrust::make_constant_iterator(0) /* dummy */,
+        [] __device__(vertex_t src, vertex_t dst, weight_t w, auto src_val, auto dst_val) {
+          return w <= 0.0;
+        });
+      CUGRAPH_EXPECTS(num_nonpositive_edge_weights == 0,
+                      "Invalid input argument: input graph should have postive edge weights.");
+    }
+
+    auto num_negative_values = count_if_v(
+      handle, push_graph_view, pageranks, [] __device__(auto val) { return val < 0.0; });
+    CUGRAPH_EXPECTS(num_negative_values == 0,
+                    "Invalid input argument: previous PageRank values should be non-negative.");
+
+    vertex_partition_device_t<GraphViewType> vertex_partition(push_graph_view);
+    auto edge_first = thrust::make_zip_iterator(
+      thrust::make_tuple(delta_srcs, delta_dsts, delta_weights));
+    auto num_invalid_delta_edges = static_cast<size_t>(
+      thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                       edge_first,
+                       edge_first + num_delta_edges,
+                       [vertex_partition] __device__(auto e) {
+                         return !vertex_partition.is_valid_vertex(thrust::get<0>(e)) ||
+                                !vertex_partition.is_valid_vertex(thrust::get<1>(e)) ||
+                                (thrust::get<2>(e) == weight_t{0.0});
+                       }));
+    if (GraphViewType::is_multi_gpu) {
+      num_invalid_delta_edges = host_scalar_allreduce(
+        handle.get_comms(), num_invalid_delta_edges, handle.get_stream());
+    }
+    CUGRAPH_EXPECTS(num_invalid_delta_edges == 0,
+                    "Invalid input argument: delta edges should have valid vertex IDs and "
+                    "non-zero weights.");
+  }
+
+  // 2. compute the sums of the out-going edge weights and the out-degrees of the updated graph
+
+  auto vertex_out_weight_sums = push_graph_view.compute_out_weight_sums(handle);
+  auto vertex_out_degrees     = push_graph_view.compute_out_degrees(handle);
+
+  // 3. group the delta edges by their source vertices (and move them to the GPUs owning the source
+  // vertices)
+
+  rmm::device_uvector<vertex_t> srcs(num_delta_edges, handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(num_delta_edges, handle.get_stream());
+  rmm::device_uvector<weight_t> weights(num_delta_edges, handle.get_stream());
+  {
+    auto delta_edge_first =
+      thrust::make_zip_iterator(thrust::make_tuple(delta_srcs, delta_dsts, delta_weights));
+    thrust::copy(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      delta_edge_first,
+      delta_edge_first + num_delta_edges,
+      thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin(), weights.begin())));
+  }
+
+  rmm::device_uvector<vertex_t> d_vertex_partition_lasts(0, handle.get_stream());
+  if (GraphViewType::is_multi_gpu) {
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+
+    std::vector<vertex_t> h_vertex_partition_lasts(comm_size);
+    for (int i = 0; i < comm_size; ++i) {
+      h_vertex_partition_lasts[i] = push_graph_view.get_vertex_partition_last(i);
+    }
+    d_vertex_partition_lasts.resize(h_vertex_partition_lasts.size(), handle.get_stream());
+    raft::update_device(d_vertex_partition_lasts.data(),
+                        h_vertex_partition_lasts.data(),
+                        h_vertex_partition_lasts.size(),
+                        handle.get_stream());
+
+    rmm::device_uvector<vertex_t> rx_srcs(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> rx_dsts(0, handle.get_stream());
+    rmm::device_uvector<weight_t> rx_weights(0, handle.get_stream());
+    auto edge_first =
+      thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), dsts.begin(), weights.begin()));
+    std::forward_as_tuple(std::tie(rx_srcs, rx_dsts, rx_weights), std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        edge_first,
+        edge_first + srcs.size(),
+        [key_func = vertex_to_gpu_id_t<vertex_t>{d_vertex_partition_lasts.data(),
+                                                 comm_size}] __device__(auto val) {
+          return key_func(thrust::get<0>(val));
+        },
+        handle.get_stream());
+    srcs    = std::move(rx_srcs);
+    dsts    = std::move(rx_dsts);
+    weights = std::move(rx_weights);
+  }
+
+  thrust::sort_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      srcs.begin(),
+                      srcs.end(),
+                      thrust::make_zip_iterator(thrust::make_tuple(dsts.begin(), weights.begin())));
+
+  rmm::device_uvector<vertex_t> affected_srcs(srcs.size(), handle.get_stream());
+  rmm::device_uvector<weight_t> delta_out_weight_sums(srcs.size(), handle.get_stream());
+  rmm::device_uvector<edge_t> delta_out_degrees(srcs.size(), handle.get_stream());
+  auto num_affected_srcs = static_cast<size_t>(thrust::distance(
+    affected_srcs.begin(),
+    thrust::get<0>(
+      thrust::reduce_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                            srcs.begin(),
+                            srcs.end(),
+                            weights.begin(),
+                            affected_srcs.begin(),
+                            delta_out_weight_sums.begin()))));
+  thrust::reduce_by_key(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    srcs.begin(),
+    srcs.end(),
+    thrust::make_transform_iterator(weights.begin(),
+                                    delta_weight_to_delta_degree_t<weight_t, edge_t>{}),
+    thrust::make_discard_iterator(),
+    delta_out_degrees.begin());
+  affected_srcs.resize(num_affected_srcs, handle.get_stream());
+  delta_out_weight_sums.resize(num_affected_srcs, handle.get_stream());
+  delta_out_degrees.resize(num_affected_srcs, handle.get_stream());
+  affected_srcs.shrink_to_fit(handle.get_stream());
+  delta_out_weight_sums.shrink_to_fit(handle.get_stream());
+  delta_out_degrees.shrink_to_fit(handle.get_stream());
+
+  // 4. compute the residuals of the previous PageRank scores on the updated graph
+
+  // for an affected source vertex u, p_u * alpha * (w_new(u, v) / W_new(u) - w_old(u, v) /
+  // W_old(u)) is added to the residual of v (W is the sum of u's out-going edge weights), this is
+  // p_u * alpha * (1 / W_new(u) - 1 / W_old(u)) * w_new(u, v) for every out-going edge of u in the
+  // updated graph (push_values) and p_u * alpha * delta_w(u, v) / W_old(u) for every delta edge
+  // (delta_edge_coefficients), a dangling vertex's contribution is uniformly distributed to every
+  // vertex instead (uniform_residual_sum)
+
+  rmm::device_uvector<result_t> residuals(push_graph_view.get_number_of_local_vertices(),
+                                          handle.get_stream());
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               residuals.begin(),
+               residuals.end(),
+               result_t{0.0});
+
+  // (alpha * residual / out-going edge weight sum) of the frontier vertices
+  rmm::device_uvector<result_t> push_values(push_graph_view.get_number_of_local_vertices(),
+                                            handle.get_stream());
+  rmm::device_uvector<result_t> delta_edge_coefficients(num_affected_srcs, handle.get_stream());
+  auto local_vertex_first = push_graph_view.get_local_vertex_first();
+  thrust::for_each(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(num_affected_srcs),
+    [affected_srcs           = affected_srcs.data(),
+     delta_out_weight_sums   = delta_out_weight_sums.data(),
+     delta_out_degrees       = delta_out_degrees.data(),
+     vertex_out_weight_sums  = vertex_out_weight_sums.data(),
+     vertex_out_degrees      = vertex_out_degrees.data(),
+     pageranks,
+     push_values             = push_values.data(),
+     delta_edge_coefficients = delta_edge_coefficients.data(),
+     local_vertex_first,
+     alpha] __device__(auto i) {
+      auto v_offset       = *(affected_srcs + i) - local_vertex_first;
+      auto new_out_degree = *(vertex_out_degrees + v_offset);
+      auto old_out_degree = new_out_degree - *(delta_out_degrees + i);
+      auto new_out_weight_sum = static_cast<result_t>(*(vertex_out_weight_sums + v_offset));
+      auto old_out_weight_sum =
+        new_out_weight_sum - static_cast<result_t>(*(delta_out_weight_sums + i));
+      auto scaled_pagerank = alpha * *(pageranks + v_offset);
+      auto old_coefficient =
+        old_out_degree > 0 ? scaled_pagerank / old_out_weight_sum : result_t{0.0};
+      *(push_values + v_offset) =
+        new_out_degree > 0 ? scaled_pagerank / new_out_weight_sum - old_coefficient
+                           : result_t{0.0};
+      *(delta_edge_coefficients + i) = old_coefficient;
+    });
+
+  auto uniform_residual_sum = thrust::transform_reduce(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(num_affected_srcs),
+    [affected_srcs      = affected_srcs.data(),
+     delta_out_degrees  = delta_out_degrees.data(),
+     vertex_out_degrees = vertex_out_degrees.data(),
+     pageranks,
+     local_vertex_first,
+     alpha] __device__(auto i) {
+      auto v_offset       = *(affected_srcs + i) - local_vertex_first;
+      auto new_out_degree = *(vertex_out_degrees + v_offset);
+      auto old_out_degree = new_out_degree - *(delta_out_degrees + i);
+      auto scaled_pagerank = alpha * *(pageranks + v_offset);
+      return (new_out_degree == 0 ? scaled_pagerank : result_t{0.0}) -
+             (old_out_degree == 0 ? scaled_pagerank : result_t{0.0});
+    },
+    result_t{0.0},
+    thrust::plus<result_t>());
+
+  {
+    rmm::device_uvector<result_t> delta_edge_values(srcs.size(), handle.get_stream());
+    thrust::transform(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_zip_iterator(thrust::make_tuple(srcs.begin(), weights.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(srcs.end(), weights.end())),
+      delta_edge_values.begin(),
+      [affected_srcs           = affected_srcs.data(),
+       delta_edge_coefficients = delta_edge_coefficients.data(),
+       num_affected_srcs] __device__(auto e) {
+        auto i = thrust::distance(
+          affected_srcs,
+          thrust::lower_bound(
+            thrust::seq, affected_srcs, affected_srcs + num_affected_srcs, thrust::get<0>(e)));
+        return *(delta_edge_coefficients + i) * static_cast<result_t>(thrust::get<1>(e));
+      });
+    srcs.resize(0, handle.get_stream());
+    srcs.shrink_to_fit(handle.get_stream());
+    weights.resize(0, handle.get_stream());
+    weights.shrink_to_fit(handle.get_stream());
+
+    if (GraphViewType::is_multi_gpu) {
+      auto& comm           = handle.get_comms();
+      auto const comm_size = comm.get_size();
+
+      rmm::device_uvector<vertex_t> rx_dsts(0, handle.get_stream());
+      rmm::device_uvector<result_t> rx_delta_edge_values(0, handle.get_stream());
+      auto pair_first =
+        thrust::make_zip_iterator(thrust::make_tuple(dsts.begin(), delta_edge_values.begin()));
+      std::forward_as_tuple(std::tie(rx_dsts, rx_delta_edge_values), std::ignore) =
+        groupby_gpuid_and_shuffle_values(
+          comm,
+          pair_first,
+          pair_first + dsts.size(),
+          [key_func = vertex_to_gpu_id_t<vertex_t>{d_vertex_partition_lasts.data(),
+                                                   comm_size}] __device__(auto val) {
+            return key_func(thrust::get<0>(val));
+          },
+          handle.get_stream());
+      dsts              = std::move(rx_dsts);
+      delta_edge_values = std::move(rx_delta_edge_values);
+
+      uniform_residual_sum =
+        host_scalar_allreduce(comm, uniform_residual_sum, handle.get_stream());
+    }
+
+    auto pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(dsts.begin(), delta_edge_values.begin()));
+    thrust::for_each(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     pair_first,
+                     pair_first + dsts.size(),
+                     [residuals = residuals.data(), local_vertex_first] __device__(auto val) {
+                       atomicAdd(residuals + (thrust::get<0>(val) - local_vertex_first),
+                                 thrust::get<1>(val));
+                     });
+  }
+
+  // 5. initialize the frontier
+
+  enum class Bucket { cur, next, inactive, num_buckets };
+  // the inactive bucket is cleared after every push, v_op sends the vertices with a residual not
+  // exceeding the threshold to this bucket (update_frontier_v_push_if_out_nbr updates the vertex
+  // values of only the vertices inserted to a bucket)
+  // FIXME: inserting into the inactive bucket is unnecessary if update_frontier_v_push_if_out_nbr
+  // supports updating vertex values without inserting the vertices to a bucket.
+  std::vector<size_t> bucket_sizes(
+    static_cast<size_t>(Bucket::num_buckets),
+    std::max(num_affected_srcs,
+             static_cast<size_t>(
+               std::min(push_graph_view.get_number_of_local_vertices(), vertex_t{1024}))));
+  VertexFrontier<vertex_t, GraphViewType::is_multi_gpu, static_cast<size_t>(Bucket::num_buckets)>
+    vertex_frontier(handle, bucket_sizes);
+
+  bool vertex_and_adj_matrix_row_ranges_coincide =
+    push_graph_view.get_number_of_local_vertices() ==
+        push_graph_view.get_number_of_local_adj_matrix_partition_rows()
+      ? true
+      : false;
+  rmm::device_uvector<result_t> adj_matrix_row_push_values(0, handle.get_stream());
+  if (!vertex_and_adj_matrix_row_ranges_coincide) {
+    adj_matrix_row_push_values.resize(
+      push_graph_view.get_number_of_local_adj_matrix_partition_rows(), handle.get_stream());
+  }
+  auto row_push_values = !vertex_and_adj_matrix_row_ranges_coincide
+                           ? adj_matrix_row_push_values.data()
+                           : push_values.data();
+
+  auto e_op = [] __device__(vertex_t src, vertex_t dst, weight_t w, auto src_val, auto dst_val) {
+    return thrust::make_tuple(true, src_val * static_cast<result_t>(w));
+  };
+
+  vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur))
+    .insert(affected_srcs.begin(), affected_srcs.end());
+  if (!vertex_and_adj_matrix_row_ranges_coincide) {
+    copy_to_adj_matrix_row(handle,
+                           push_graph_view,
+                           vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).begin(),
+                           vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).end(),
+                           push_values.data(),
+                           row_push_values);
+  }
+  update_frontier_v_push_if_out_nbr(
+    handle,
+    push_graph_view,
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).begin(),
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).end(),
+    row_push_values,
+    thrust::make_constant_iterator(0) /* dummy */,
+    e_op,
+    reduce_op::plus<result_t>(),
+    residuals.data(),
+    residuals.data(),
+    vertex_frontier,
+    [] __device__(auto v_val, auto pushed_val) {
+      return thrust::make_tuple(static_cast<size_t>(Bucket::inactive), v_val + pushed_val);
+    });
+  vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).clear();
+  vertex_frontier.get_bucket(static_cast<size_t>(Bucket::inactive)).clear();
+
+  // half of epsilon is reserved for the uniform residuals, the sum of the absolute residual values
+  // stays below epsilon on termination
+  auto threshold = epsilon / (result_t{2.0} * static_cast<result_t>(num_vertices));
+  insert_active_vertices(handle,
+                         push_graph_view,
+                         residuals.data(),
+                         threshold,
+                         vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)));
+
+  // 6. residual push iteration
+
+  size_t iter{0};
+  while (true) {
+    if (vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).aggregate_size() == 0) {
+      if (std::abs(uniform_residual_sum) < epsilon / result_t{2.0}) { break; }
+      // distribute the uniform residuals accumulated so far
+      auto delta = uniform_residual_sum / static_cast<result_t>(num_vertices);
+      thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        residuals.begin(),
+                        residuals.end(),
+                        residuals.begin(),
+                        [delta] __device__(auto val) { return val + delta; });
+      uniform_residual_sum = result_t{0.0};
+      insert_active_vertices(handle,
+                             push_graph_view,
+                             residuals.data(),
+                             threshold,
+                             vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)));
+      continue;
+    }
+
+    if (iter >= max_iterations) { CUGRAPH_FAIL("Incremental PageRank failed to converge."); }
+
+    // move the frontier vertices' residuals to their PageRank values and compute the values to
+    // push
+
+    auto dangling_sum = thrust::transform_reduce(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).begin(),
+      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).end(),
+      [residuals          = residuals.data(),
+       vertex_out_degrees = vertex_out_degrees.data(),
+       local_vertex_first,
+       alpha] __device__(auto v) {
+        auto v_offset = v - local_vertex_first;
+        return *(vertex_out_degrees + v_offset) == 0 ? alpha * *(residuals + v_offset)
+                                                     : result_t{0.0};
+      },
+      result_t{0.0},
+      thrust::plus<result_t>());
+    if (GraphViewType::is_multi_gpu) {
+      dangling_sum = host_scalar_allreduce(handle.get_comms(), dangling_sum, handle.get_stream());
+    }
+    uniform_residual_sum += dangling_sum;
+
+    thrust::for_each(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).begin(),
+                     vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).end(),
+                     [residuals              = residuals.data(),
+                      vertex_out_weight_sums = vertex_out_weight_sums.data(),
+                      vertex_out_degrees     = vertex_out_degrees.data(),
+                      pageranks,
+                      push_values = push_values.data(),
+                      local_vertex_first,
+                      alpha] __device__(auto v) {
+                       auto v_offset = v - local_vertex_first;
+                       auto residual = *(residuals + v_offset);
+                       *(pageranks + v_offset) += residual;
+                       *(push_values + v_offset) =
+                         *(vertex_out_degrees + v_offset) > 0
+                           ? alpha * residual /
+                               static_cast<result_t>(*(vertex_out_weight_sums + v_offset))
+                           : result_t{0.0};
+                       *(residuals + v_offset) = result_t{0.0};
+                     });
+
+    if (!vertex_and_adj_matrix_row_ranges_coincide) {
+      copy_to_adj_matrix_row(handle,
+                             push_graph_view,
+                             vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).begin(),
+                             vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).end(),
+                             push_values.data(),
+                             row_push_values);
+    }
+
+    update_frontier_v_push_if_out_nbr(
+      handle,
+      push_graph_view,
+      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).begin(),
+      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).end(),
+      row_push_values,
+      thrust::make_constant_iterator(0) /* dummy */,
+      e_op,
+      reduce_op::plus<result_t>(),
+      residuals.data(),
+      residuals.data(),
+      vertex_frontier,
+      [threshold] __device__(auto v_val, auto pushed_val) {
+        auto new_residual = v_val + pushed_val;
+        auto idx          = std::abs(new_residual) > threshold ? static_cast<size_t>(Bucket::next)
+                                                      : static_cast<size_t>(Bucket::inactive);
+        return thrust::make_tuple(idx, new_residual);
+      });
+
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur)).clear();
+    vertex_frontier.get_bucket(static_cast<size_t>(Bucket::inactive)).clear();
+    vertex_frontier.swap_buckets(static_cast<size_t>(Bucket::cur),
+                                 static_cast<size_t>(Bucket::next));
+
+    iter++;
+  }
+
+  // the remaining uniform residuals are below the tolerance, but add them to keep the PageRank
+  // values summing to one
+
+  if (uniform_residual_sum != result_t{0.0}) {
+    auto delta = uniform_residual_sum / static_cast<result_t>(num_vertices);
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      pageranks,
+                      pageranks + push_graph_view.get_number_of_local_vertices(),
+                      pageranks,
+                      [delta] __device__(auto val) { return val + delta; });
+  }
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const& graph_view,
+  vertex_t const* delta_srcs,
+  vertex_t const* delta_dsts,
+  weight_t const* delta_weights,
+  edge_t num_delta_edges,
+  result_t* pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  bool do_expensive_check)
+{
+  detail::incremental_pagerank(handle,
+                               graph_view,
+                               delta_srcs,
+                               delta_dsts,
+                               delta_weights,
+                               num_delta_edges,
+                               pageranks,
+                               alpha,
+                               epsilon,
+                               max_iterations,
+                               do_expensive_check);
+}
+
+// explicit instantiation
+
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, true> const& graph_view,
+  int32_t const* delta_srcs,
+  int32_t const* delta_dsts,
+  float const* delta_weights,
+  int32_t num_delta_edges,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, true> const& graph_view,
+  int32_t const* delta_srcs,
+  int32_t const* delta_dsts,
+  double const* delta_weights,
+  int32_t num_delta_edges,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, true> const& graph_view,
+  int32_t const* delta_srcs,
+  int32_t const* delta_dsts,
+  float const* delta_weights,
+  int64_t num_delta_edges,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, true> const& graph_view,
+  int32_t const* delta_srcs,
+  int32_t const* delta_dsts,
+  double const* delta_weights,
+  int64_t num_delta_edges,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, true> const& graph_view,
+  int64_t const* delta_srcs,
+  int64_t const* delta_dsts,
+  float const* delta_weights,
+  int64_t num_delta_edges,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, true> const& graph_view,
+  int64_t const* delta_srcs,
+  int64_t const* delta_dsts,
+  double const* delta_weights,
+  int64_t num_delta_edges,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+  int32_t const* delta_srcs,
+  int32_t const* delta_dsts,
+  float const* delta_weights,
+  int32_t num_delta_edges,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+  int32_t const* delta_srcs,
+  int32_t const* delta_dsts,
+  double const* delta_weights,
+  int32_t num_delta_edges,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+  int32_t const* delta_srcs,
+  int32_t const* delta_dsts,
+  float const* delta_weights,
+  int64_t num_delta_edges,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+  int32_t const* delta_srcs,
+  int32_t const* delta_dsts,
+  double const* delta_weights,
+  int64_t num_delta_edges,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+  int64_t const* delta_srcs,
+  int64_t const* delta_dsts,
+  float const* delta_weights,
+  int64_t num_delta_edges,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+template void incremental_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+  int64_t const* delta_srcs,
+  int64_t const* delta_dsts,
+  double const* delta_weights,
+  int64_t num_delta_edges,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool do_expensive_check);
+
+}  // namespace experimental
+}  // namespace cugraph
@@ -16,27 +16,708 @@
 
 #include <experimental/graph_functions.hpp>
 #include <experimental/graph_view.hpp>
+#include <experimental/include_cuco_static_map.cuh>
 #include <matrix_partition_device.cuh>
+#include <utilities/device_comm.cuh>
 #include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+#include <utilities/shuffle_comm.cuh>
 #include <vertex_partition_device.cuh>
 
 #include <rmm/thrust_rmm_allocator.h>
+#include <raft/cudart_utils.h>
 #include <raft/handle.hpp>
 #include <rmm/device_uvector.hpp>
 
 #include <thrust/binary_search.h>
 #include <thrust/copy.h>
+#include <thrust/functional.h>
 #include <thrust/gather.h>
+#include <thrust/scan.h>
 #include <thrust/sort.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
 #include <tuple>
+#include <vector>
 
 #include <utilities/high_res_timer.hpp>
 
 namespace cugraph {
 namespace experimental {
 
+namespace detail {
+
+// subgraph vertices with their local degrees larger than hash_path_degree_ratio * (the number of
+// vertices in their subgraphs) are processed edge-parallel with hash table based membership tests
+// (instead of scanning the entire neighbor list in a single thread with a binary search per
+// neighbor), this is a tuning parameter
+size_t constexpr hash_path_degree_ratio{8};
+
+// returns the local degree (0 if the vertex is not a major of this matrix partition) and whether
+// to use the hash-based path for the i'th vertex in the aggregate subgraph vertex list
+template <typename GraphViewType>
+struct local_degree_and_path_t {
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  matrix_partition_device_t<GraphViewType> matrix_partition;
+  size_t const *subgraph_offsets{nullptr};
+  vertex_t const *subgraph_vertices{nullptr};
+  size_t const *subgraph_indices{nullptr};
+  bool hash_path_enabled{false};
+
+  __device__ thrust::tuple<edge_t, bool> operator()(size_t i) const
+  {
+    auto v = subgraph_vertices[i];
+    if ((v < matrix_partition.get_major_first()) || (v >= matrix_partition.get_major_last())) {
+      return thrust::make_tuple(edge_t{0}, false);
+    }
+    auto local_degree =
+      matrix_partition.get_local_degree(matrix_partition.get_major_offset_from_major_nocheck(v));
+    auto subgraph_idx  = subgraph_indices[i];
+    auto subgraph_size = subgraph_offsets[subgraph_idx + 1] - subgraph_offsets[subgraph_idx];
+    return thrust::make_tuple(
+      local_degree,
+      hash_path_enabled &&
+        (static_cast<size_t>(local_degree) > hash_path_degree_ratio * subgraph_size));
+  }
+};
+
+template <typename vertex_t>
+struct subgraph_vertex_key_value_pair_t {
+  size_t const *subgraph_indices{nullptr};
+  vertex_t const *subgraph_vertices{nullptr};
+  uint64_t number_of_vertices{0};
+
+  __device__ thrust::pair<uint64_t, vertex_t> operator()(size_t i) const
+  {
+    return thrust::make_pair(
+      static_cast<uint64_t>(subgraph_indices[i]) * number_of_vertices +
+        static_cast<uint64_t>(subgraph_vertices[i]),
+      subgraph_vertices[i]);
+  }
+};
+
+// extract the induced subgraph edges with their majors in the partition_idx'th local adjacency
+// matrix partition; subgraph_indices stores the subgraph index of each element of
+// subgraph_vertices
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>,
+           rmm::device_uvector<size_t>>
+extract_local_induced_subgraphs(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> const &graph_view,
+  size_t partition_idx,
+  size_t const *subgraph_offsets /* size == num_subgraphs + 1 */,
+  vertex_t const *subgraph_vertices /* size == num_aggregate_subgraph_vertices */,
+  size_t const *subgraph_indices /* size == num_aggregate_subgraph_vertices */,
+  size_t num_subgraphs,
+  size_t num_aggregate_subgraph_vertices)
+{
+  using graph_view_type = graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>;
+
+  matrix_partition_device_t<graph_view_type> matrix_partition(graph_view, partition_idx);
+
+  // (subgraph index, vertex) pairs are packed to 64 bit hash keys
+  auto number_of_vertices = static_cast<uint64_t>(graph_view.get_number_of_vertices());
+  auto hash_path_enabled =
+    (number_of_vertices > 0) &&
+    (static_cast<uint64_t>(num_subgraphs) <=
+     (std::numeric_limits<uint64_t>::max() - 1 /* reserved for the empty key */) /
+       number_of_vertices);
+  local_degree_and_path_t<graph_view_type> local_degree_and_path_op{
+    matrix_partition, subgraph_offsets, subgraph_vertices, subgraph_indices, hash_path_enabled};
+
+  // 1. Phase 1: calculate memory requirements
+
+  rmm::device_uvector<size_t> subgraph_vertex_output_offsets(
+    num_aggregate_subgraph_vertices + 1,
+    handle.get_stream());  // for each element of subgraph_vertices
+
+  // 1-1. count the numbers of the induced subgraph edges for each vertex in the aggregate subgraph
+  // vertex list (vertices taking the hash-based path are counted in 1-2)
+
+  thrust::transform(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(num_aggregate_subgraph_vertices),
+    subgraph_vertex_output_offsets.begin(),
+    [subgraph_offsets,
+     subgraph_vertices,
+     subgraph_indices,
+     matrix_partition,
+     local_degree_and_path_op] __device__(auto i) {
+      auto local_degree_and_path = local_degree_and_path_op(i);
+      if ((thrust::get<0>(local_degree_and_path) == 0) || thrust::get<1>(local_degree_and_path)) {
+        return size_t{0};
+      }
+      auto subgraph_idx = subgraph_indices[i];
+      minor_index_iterator_t<vertex_t, edge_t> indices{};
+      weight_t const *weights{nullptr};
+      edge_t local_degree{};
+      auto major_offset =
+        matrix_partition.get_major_offset_from_major_nocheck(subgraph_vertices[i]);
+      thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(major_offset);
+      return static_cast<size_t>(thrust::count_if(
+        thrust::seq,
+        indices,
+        indices + local_degree,
+        [vertex_first = subgraph_vertices + subgraph_offsets[subgraph_idx],
+         vertex_last  = subgraph_vertices + subgraph_offsets[subgraph_idx + 1]] __device__(
+          auto nbr) {
+          return thrust::binary_search(thrust::seq, vertex_first, vertex_last, nbr);
+        }));
+    });
+
+  // 1-2. test the neighbors of the vertices taking the hash-based path (one thread per edge)
+
+  rmm::device_uvector<size_t> hash_path_vertex_indices(num_aggregate_subgraph_vertices,
+                                                       handle.get_stream());
+  hash_path_vertex_indices.resize(
+    thrust::distance(
+      hash_path_vertex_indices.begin(),
+      thrust::copy_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(num_aggregate_subgraph_vertices),
+                      hash_path_vertex_indices.begin(),
+                      [local_degree_and_path_op] __device__(auto i) {
+                        return thrust::get<1>(local_degree_and_path_op(i));
+                      })),
+    handle.get_stream());
+  hash_path_vertex_indices.shrink_to_fit(handle.get_stream());
+
+  rmm::device_uvector<size_t> hash_path_edge_offsets(hash_path_vertex_indices.size() + 1,
+                                                     handle.get_stream());
+  rmm::device_uvector<vertex_t> hash_path_found_vertices(0, handle.get_stream());
+  rmm::device_uvector<size_t> hash_path_edge_output_offsets(0, handle.get_stream());
+  if (hash_path_vertex_indices.size() > 0) {
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      hash_path_vertex_indices.begin(),
+                      hash_path_vertex_indices.end(),
+                      hash_path_edge_offsets.begin(),
+                      [local_degree_and_path_op] __device__(auto i) {
+                        return static_cast<size_t>(thrust::get<0>(local_degree_and_path_op(i)));
+                      });
+    thrust::exclusive_scan(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                           hash_path_edge_offsets.begin(),
+                           hash_path_edge_offsets.end(),
+                           hash_path_edge_offsets.begin());
+    auto num_hash_path_edges =
+      hash_path_edge_offsets.element(hash_path_vertex_indices.size(), handle.get_stream());
+
+    rmm::device_uvector<uint64_t> keys(num_hash_path_edges, handle.get_stream());
+    thrust::transform(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_hash_path_edges),
+      keys.begin(),
+      [subgraph_vertices,
+       subgraph_indices,
+       matrix_partition,
+       number_of_vertices,
+       hash_path_vertex_indices = hash_path_vertex_indices.data(),
+       hash_path_edge_offsets   = hash_path_edge_offsets.data(),
+       num_hash_path_vertices   = hash_path_vertex_indices.size()] __device__(auto k) {
+        auto j = static_cast<size_t>(thrust::distance(
+          hash_path_edge_offsets + 1,
+          thrust::upper_bound(thrust::seq,
+                              hash_path_edge_offsets + 1,
+                              hash_path_edge_offsets + 1 + num_hash_path_vertices,
+                              k)));
+        auto i = hash_path_vertex_indices[j];
+        auto local_offset =
+          matrix_partition.get_local_offset(
+            matrix_partition.get_major_offset_from_major_nocheck(subgraph_vertices[i])) +
+          static_cast<edge_t>(k - hash_path_edge_offsets[j]);
+        return static_cast<uint64_t>(subgraph_indices[i]) * number_of_vertices +
+               static_cast<uint64_t>(matrix_partition.get_minor_nocheck(local_offset));
+      });
+
+    hash_path_found_vertices.resize(num_hash_path_edges, handle.get_stream());
+    {
+      double constexpr load_factor = 0.7;
+
+      // cuco::static_map currently does not take stream
+      CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+      cuco::static_map<uint64_t, vertex_t> subgraph_vertex_map{
+        // FIXME: std::max(..., ...) as a temporary workaround for
+        // https://github.com/NVIDIA/cuCollections/issues/72 and
+        // https://github.com/NVIDIA/cuCollections/issues/73
+        std::max(
+          static_cast<size_t>(static_cast<double>(num_aggregate_subgraph_vertices) / load_factor),
+          num_aggregate_subgraph_vertices + 1),
+        std::numeric_limits<uint64_t>::max(),
+        invalid_vertex_id<vertex_t>::value};
+      auto kv_pair_first = thrust::make_transform_iterator(
+        thrust::make_counting_iterator(size_t{0}),
+        subgraph_vertex_key_value_pair_t<vertex_t>{
+          subgraph_indices, subgraph_vertices, number_of_vertices});
+      subgraph_vertex_map.insert(kv_pair_first, kv_pair_first + num_aggregate_subgraph_vertices);
+      subgraph_vertex_map.find(keys.begin(), keys.end(), hash_path_found_vertices.begin());
+    }
+
+    hash_path_edge_output_offsets.resize(num_hash_path_edges + 1, handle.get_stream());
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      hash_path_found_vertices.begin(),
+                      hash_path_found_vertices.end(),
+                      hash_path_edge_output_offsets.begin(),
+                      [] __device__(auto v) {
+                        return v != invalid_vertex_id<vertex_t>::value ? size_t{1} : size_t{0};
+                      });
+    thrust::exclusive_scan(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                           hash_path_edge_output_offsets.begin(),
+                           hash_path_edge_output_offsets.end(),
+                           hash_path_edge_output_offsets.begin());
+    thrust::for_each(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(hash_path_vertex_indices.size()),
+      [hash_path_vertex_indices       = hash_path_vertex_indices.data(),
+       hash_path_edge_offsets         = hash_path_edge_offsets.data(),
+       hash_path_edge_output_offsets  = hash_path_edge_output_offsets.data(),
+       subgraph_vertex_output_offsets = subgraph_vertex_output_offsets.data()] __device__(auto j) {
+        subgraph_vertex_output_offsets[hash_path_vertex_indices[j]] =
+          hash_path_edge_output_offsets[hash_path_edge_offsets[j + 1]] -
+          hash_path_edge_output_offsets[hash_path_edge_offsets[j]];
+      });
+  }
+
+  thrust::exclusive_scan(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                         subgraph_vertex_output_offsets.begin(),
+                         subgraph_vertex_output_offsets.end(),
+                         subgraph_vertex_output_offsets.begin());
+
+  auto num_aggregate_edges =
+    subgraph_vertex_output_offsets.element(num_aggregate_subgraph_vertices, handle.get_stream());
+
+  // 2. Phase 2: find the edges in the induced subgraphs
+
+  rmm::device_uvector<vertex_t> edge_majors(num_aggregate_edges, handle.get_stream());
+  rmm::device_uvector<vertex_t> edge_minors(num_aggregate_edges, handle.get_stream());
+  rmm::device_uvector<weight_t> edge_weights(
+    graph_view.is_weighted() ? num_aggregate_edges : size_t{0}, handle.get_stream());
+
+  // 2-1. fill the edge list buffer (to be returned) for each vetex in the aggregate subgraph vertex
+  // list (use the offsets computed in the Phase 1)
+
+  thrust::for_each(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(num_aggregate_subgraph_vertices),
+    [subgraph_offsets,
+     subgraph_vertices,
+     subgraph_indices,
+     matrix_partition,
+     local_degree_and_path_op,
+     subgraph_vertex_output_offsets = subgraph_vertex_output_offsets.data(),
+     edge_majors                    = edge_majors.data(),
+     edge_minors                    = edge_minors.data(),
+     edge_weights                   = edge_weights.data()] __device__(auto i) {
+      auto local_degree_and_path = local_degree_and_path_op(i);
+      if ((thrust::get<0>(local_degree_and_path) == 0) || thrust::get<1>(local_degree_and_path)) {
+        return;
+      }
+      auto subgraph_idx = subgraph_indices[i];
+      minor_index_iterator_t<vertex_t, edge_t> indices{};
+      weight_t const *weights{nullptr};
+      edge_t local_degree{};
+      auto major_offset =
+        matrix_partition.get_major_offset_from_major_nocheck(subgraph_vertices[i]);
+      thrust::tie(indices, weights, local_degree) = matrix_partition.get_local_edges(major_offset);
+      if (weights != nullptr) {
+        auto triplet_first = thrust::make_zip_iterator(thrust::make_tuple(
+          thrust::make_constant_iterator(subgraph_vertices[i]), indices, weights));
+        thrust::copy_if(
+          thrust::seq,
+          triplet_first,
+          triplet_first + local_degree,
+          thrust::make_zip_iterator(thrust::make_tuple(edge_majors, edge_minors, edge_weights)) +
+            subgraph_vertex_output_offsets[i],
+          [vertex_first = subgraph_vertices + subgraph_offsets[subgraph_idx],
+           vertex_last =
+             subgraph_vertices + subgraph_offsets[subgraph_idx + 1]] __device__(auto t) {
+            return thrust::binary_search(
+              thrust::seq, vertex_first, vertex_last, thrust::get<1>(t));
+          });
+      } else {
+        auto pair_first = thrust::make_zip_iterator(
+          thrust::make_tuple(thrust::make_constant_iterator(subgraph_vertices[i]), indices));
+        thrust::copy_if(thrust::seq,
+                        pair_first,
+                        pair_first + local_degree,
+                        thrust::make_zip_iterator(thrust::make_tuple(edge_majors, edge_minors)) +
+                          subgraph_vertex_output_offsets[i],
+                        [vertex_first = subgraph_vertices + subgraph_offsets[subgraph_idx],
+                         vertex_last  = subgraph_vertices +
+                                       subgraph_offsets[subgraph_idx + 1]] __device__(auto t) {
+                          return thrust::binary_search(
+                            thrust::seq, vertex_first, vertex_last, thrust::get<1>(t));
+                        });
+      }
+    });
+
+  // 2-2. fill the edge list buffer for the vertices taking the hash-based path (neighbor order is
+  // preserved, so the output is identical to the output of the binary search based path)
+
+  if (hash_path_vertex_indices.size() > 0) {
+    thrust::for_each(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(hash_path_found_vertices.size()),
+      [subgraph_vertices,
+       matrix_partition,
+       hash_path_vertex_indices       = hash_path_vertex_indices.data(),
+       hash_path_edge_offsets         = hash_path_edge_offsets.data(),
+       num_hash_path_vertices         = hash_path_vertex_indices.size(),
+       hash_path_found_vertices       = hash_path_found_vertices.data(),
+       hash_path_edge_output_offsets  = hash_path_edge_output_offsets.data(),
+       subgraph_vertex_output_offsets = subgraph_vertex_output_offsets.data(),
+       edge_majors                    = edge_majors.data(),
+       edge_minors                    = edge_minors.data(),
+       edge_weights                   = edge_weights.data()] __device__(auto k) {
+        if (hash_path_found_vertices[k] == invalid_vertex_id<vertex_t>::value) { return; }
+        auto j = static_cast<size_t>(thrust::distance(
+          hash_path_edge_offsets + 1,
+          thrust::upper_bound(thrust::seq,
+                              hash_path_edge_offsets + 1,
+                              hash_path_edge_offsets + 1 + num_hash_path_vertices,
+                              k)));
+        auto i = hash_path_vertex_indices[j];
+        auto local_offset =
+          matrix_partition.get_local_offset(
+            matrix_partition.get_major_offset_from_major_nocheck(subgraph_vertices[i])) +
+          static_cast<edge_t>(k - hash_path_edge_offsets[j]);
+        auto output_offset =
+          subgraph_vertex_output_offsets[i] +
+          (hash_path_edge_output_offsets[k] -
+           hash_path_edge_output_offsets[hash_path_edge_offsets[j]]);
+        edge_majors[output_offset] = subgraph_vertices[i];
+        edge_minors[output_offset] = hash_path_found_vertices[k];
+        if (edge_weights != nullptr) {
+          edge_weights[output_offset] = *(matrix_partition.get_weights() + local_offset);
+        }
+      });
+  }
+
+  rmm::device_uvector<size_t> subgraph_edge_offsets(num_subgraphs + 1, handle.get_stream());
+  thrust::gather(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 subgraph_offsets,
+                 subgraph_offsets + (num_subgraphs + 1),
+                 subgraph_vertex_output_offsets.begin(),
+                 subgraph_edge_offsets.begin());
+
+  return std::make_tuple(std::move(edge_majors),
+                         std::move(edge_minors),
+                         std::move(edge_weights),
+                         std::move(subgraph_edge_offsets));
+}
+
+rmm::device_uvector<size_t> compute_subgraph_indices(raft::handle_t const &handle,
+                                                     size_t const *subgraph_offsets,
+                                                     size_t num_subgraphs,
+                                                     size_t num_aggregate_subgraph_vertices)
+{
+  rmm::device_uvector<size_t> subgraph_indices(num_aggregate_subgraph_vertices,
+                                               handle.get_stream());
+  thrust::upper_bound(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      subgraph_offsets + 1,
+                      subgraph_offsets + (num_subgraphs + 1),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(num_aggregate_subgraph_vertices),
+                      subgraph_indices.begin());
+  return subgraph_indices;
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::enable_if_t<!multi_gpu,
+                 std::tuple<rmm::device_uvector<vertex_t>,
+                            rmm::device_uvector<vertex_t>,
+                            rmm::device_uvector<weight_t>,
+                            rmm::device_uvector<size_t>>>
+extract_induced_subgraphs_impl(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> const &graph_view,
+  size_t const *subgraph_offsets,
+  vertex_t const *subgraph_vertices,
+  size_t num_subgraphs)
+{
+  size_t num_aggregate_subgraph_vertices{};
+  raft::update_host(
+    &num_aggregate_subgraph_vertices, subgraph_offsets + num_subgraphs, 1, handle.get_stream());
+  CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+  auto subgraph_indices = compute_subgraph_indices(
+    handle, subgraph_offsets, num_subgraphs, num_aggregate_subgraph_vertices);
+
+  return extract_local_induced_subgraphs(handle,
+                                         graph_view,
+                                         size_t{0},
+                                         subgraph_offsets,
+                                         subgraph_vertices,
+                                         subgraph_indices.data(),
+                                         num_subgraphs,
+                                         num_aggregate_subgraph_vertices);
+}
+
+// the subgraphs of every GPU are broadcast to all the GPUs, every GPU extracts the induced subgraph
+// edges stored in its local adjacency matrix partitions, and the edges are shuffled back to the
+// GPUs that specified the subgraphs
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::enable_if_t<multi_gpu,
+                 std::tuple<rmm::device_uvector<vertex_t>,
+                            rmm::device_uvector<vertex_t>,
+                            rmm::device_uvector<weight_t>,
+                            rmm::device_uvector<size_t>>>
+extract_induced_subgraphs_impl(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> const &graph_view,
+  size_t const *subgraph_offsets,
+  vertex_t const *subgraph_vertices,
+  size_t num_subgraphs)
+{
+  auto &comm           = handle.get_comms();
+  auto const comm_size = comm.get_size();
+  auto const comm_rank = comm.get_rank();
+
+  size_t num_aggregate_subgraph_vertices{};
+  raft::update_host(
+    &num_aggregate_subgraph_vertices, subgraph_offsets + num_subgraphs, 1, handle.get_stream());
+  CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+  // 1. gather the subgraphs of every GPU
+
+  auto rx_subgraph_counts = host_scalar_allgather(comm, num_subgraphs, handle.get_stream());
+  auto rx_subgraph_vertex_counts =
+    host_scalar_allgather(comm, num_aggregate_subgraph_vertices, handle.get_stream());
+  std::vector<size_t> rx_subgraph_displacements(comm_size + 1, size_t{0});
+  std::partial_sum(
+    rx_subgraph_counts.begin(), rx_subgraph_counts.end(), rx_subgraph_displacements.begin() + 1);
+  std::vector<size_t> rx_subgraph_vertex_displacements(comm_size, size_t{0});
+  std::partial_sum(rx_subgraph_vertex_counts.begin(),
+                   rx_subgraph_vertex_counts.end() - 1,
+                   rx_subgraph_vertex_displacements.begin() + 1);
+  auto num_all_subgraphs = rx_subgraph_displacements.back();
+  auto num_all_subgraph_vertices =
+    rx_subgraph_vertex_displacements.back() + rx_subgraph_vertex_counts.back();
+
+  rmm::device_uvector<size_t> subgraph_sizes(num_subgraphs, handle.get_stream());
+  thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    subgraph_offsets + 1,
+                    subgraph_offsets + (num_subgraphs + 1),
+                    subgraph_offsets,
+                    subgraph_sizes.begin(),
+                    thrust::minus<size_t>());
+  rmm::device_uvector<size_t> all_subgraph_offsets(num_all_subgraphs + 1, handle.get_stream());
+  device_allgatherv(comm,
+                    subgraph_sizes.begin(),
+                    all_subgraph_offsets.begin(),
+                    rx_subgraph_counts,
+                    std::vector<size_t>(rx_subgraph_displacements.begin(),
+                                        rx_subgraph_displacements.end() - 1),
+                    handle.get_stream());
+  all_subgraph_offsets.set_element_async(num_all_subgraphs, size_t{0}, handle.get_stream());
+  thrust::exclusive_scan(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                         all_subgraph_offsets.begin(),
+                         all_subgraph_offsets.end(),
+                         all_subgraph_offsets.begin());
+  rmm::device_uvector<vertex_t> all_subgraph_vertices(num_all_subgraph_vertices,
+                                                      handle.get_stream());
+  device_allgatherv(comm,
+                    subgraph_vertices,
+                    all_subgraph_vertices.begin(),
+                    rx_subgraph_vertex_counts,
+                    rx_subgraph_vertex_displacements,
+                    handle.get_stream());
+  subgraph_sizes.resize(0, handle.get_stream());
+  subgraph_sizes.shrink_to_fit(handle.get_stream());
+
+  auto all_subgraph_indices = compute_subgraph_indices(
+    handle, all_subgraph_offsets.data(), num_all_subgraphs, num_all_subgraph_vertices);
+
+  // 2. extract the induced subgraph edges in the local adjacency matrix partitions (tagged with
+  // the subgraph index in the gathered subgraph list)
+
+  std::vector<rmm::device_uvector<vertex_t>> partition_edge_majors{};
+  std::vector<rmm::device_uvector<vertex_t>> partition_edge_minors{};
+  std::vector<rmm::device_uvector<weight_t>> partition_edge_weights{};
+  std::vector<rmm::device_uvector<size_t>> partition_edge_subgraph_indices{};
+  size_t num_local_edges{0};
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    rmm::device_uvector<vertex_t> edge_majors(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> edge_minors(0, handle.get_stream());
+    rmm::device_uvector<weight_t> edge_weights(0, handle.get_stream());
+    rmm::device_uvector<size_t> subgraph_edge_offsets(0, handle.get_stream());
+    std::tie(edge_majors, edge_minors, edge_weights, subgraph_edge_offsets) =
+      extract_local_induced_subgraphs(handle,
+                                      graph_view,
+                                      i,
+                                      all_subgraph_offsets.data(),
+                                      all_subgraph_vertices.data(),
+                                      all_subgraph_indices.data(),
+                                      num_all_subgraphs,
+                                      num_all_subgraph_vertices);
+
+    rmm::device_uvector<size_t> edge_subgraph_indices(edge_majors.size(), handle.get_stream());
+    thrust::upper_bound(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        subgraph_edge_offsets.begin() + 1,
+                        subgraph_edge_offsets.end(),
+                        thrust::make_counting_iterator(size_t{0}),
+                        thrust::make_counting_iterator(edge_majors.size()),
+                        edge_subgraph_indices.begin());
+
+    num_local_edges += edge_majors.size();
+    partition_edge_majors.push_back(std::move(edge_majors));
+    partition_edge_minors.push_back(std::move(edge_minors));
+    partition_edge_weights.push_back(std::move(edge_weights));
+    partition_edge_subgraph_indices.push_back(std::move(edge_subgraph_indices));
+  }
+
+  rmm::device_uvector<vertex_t> edge_majors(num_local_edges, handle.get_stream());
+  rmm::device_uvector<vertex_t> edge_minors(num_local_edges, handle.get_stream());
+  rmm::device_uvector<weight_t> edge_weights(graph_view.is_weighted() ? num_local_edges : size_t{0},
+                                             handle.get_stream());
+  rmm::device_uvector<size_t> edge_subgraph_indices(num_local_edges, handle.get_stream());
+  {
+    size_t offset{0};
+    for (size_t i = 0; i < partition_edge_majors.size(); ++i) {
+      thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   partition_edge_majors[i].begin(),
+                   partition_edge_majors[i].end(),
+                   edge_majors.begin() + offset);
+      thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   partition_edge_minors[i].begin(),
+                   partition_edge_minors[i].end(),
+                   edge_minors.begin() + offset);
+      if (graph_view.is_weighted()) {
+        thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     partition_edge_weights[i].begin(),
+                     partition_edge_weights[i].end(),
+                     edge_weights.begin() + offset);
+      }
+      thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   partition_edge_subgraph_indices[i].begin(),
+                   partition_edge_subgraph_indices[i].end(),
+                   edge_subgraph_indices.begin() + offset);
+      offset += partition_edge_majors[i].size();
+    }
+  }
+  partition_edge_majors.clear();
+  partition_edge_minors.clear();
+  partition_edge_weights.clear();
+  partition_edge_subgraph_indices.clear();
+
+  // 3. shuffle the edges back to the GPUs that specified the subgraphs
+
+  rmm::device_uvector<size_t> d_rx_subgraph_displacements(rx_subgraph_displacements.size(),
+                                                          handle.get_stream());
+  raft::update_device(d_rx_subgraph_displacements.data(),
+                      rx_subgraph_displacements.data(),
+                      rx_subgraph_displacements.size(),
+                      handle.get_stream());
+  auto subgraph_idx_to_gpu_id_op =
+    [displacements = d_rx_subgraph_displacements.data(), comm_size] __device__(auto idx) {
+      return static_cast<int>(thrust::distance(
+        displacements + 1,
+        thrust::upper_bound(thrust::seq, displacements + 1, displacements + 1 + comm_size, idx)));
+    };
+  if (graph_view.is_weighted()) {
+    auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(edge_subgraph_indices.begin(),
+                                                                   edge_majors.begin(),
+                                                                   edge_minors.begin(),
+                                                                   edge_weights.begin()));
+    rmm::device_uvector<size_t> rx_edge_subgraph_indices(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> rx_edge_majors(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> rx_edge_minors(0, handle.get_stream());
+    rmm::device_uvector<weight_t> rx_edge_weights(0, handle.get_stream());
+    std::forward_as_tuple(
+      std::tie(rx_edge_subgraph_indices, rx_edge_majors, rx_edge_minors, rx_edge_weights),
+      std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        edge_first,
+        edge_first + num_local_edges,
+        [subgraph_idx_to_gpu_id_op] __device__(auto val) {
+          return subgraph_idx_to_gpu_id_op(thrust::get<0>(val));
+        },
+        handle.get_stream());
+    edge_subgraph_indices = std::move(rx_edge_subgraph_indices);
+    edge_majors           = std::move(rx_edge_majors);
+    edge_minors           = std::move(rx_edge_minors);
+    edge_weights          = std::move(rx_edge_weights);
+  } else {
+    auto edge_first = thrust::make_zip_iterator(
+      thrust::make_tuple(edge_subgraph_indices.begin(), edge_majors.begin(), edge_minors.begin()));
+    rmm::device_uvector<size_t> rx_edge_subgraph_indices(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> rx_edge_majors(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> rx_edge_minors(0, handle.get_stream());
+    std::forward_as_tuple(std::tie(rx_edge_subgraph_indices, rx_edge_majors, rx_edge_minors),
+                          std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        edge_first,
+        edge_first + num_local_edges,
+        [subgraph_idx_to_gpu_id_op] __device__(auto val) {
+          return subgraph_idx_to_gpu_id_op(thrust::get<0>(val));
+        },
+        handle.get_stream());
+    edge_subgraph_indices = std::move(rx_edge_subgraph_indices);
+    edge_majors           = std::move(rx_edge_majors);
+    edge_minors           = std::move(rx_edge_minors);
+  }
+
+  // 4. group the received edges by subgraph
+
+  if (graph_view.is_weighted()) {
+    auto key_first = thrust::make_zip_iterator(
+      thrust::make_tuple(edge_subgraph_indices.begin(), edge_majors.begin(), edge_minors.begin()));
+    thrust::sort_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        key_first,
+                        key_first + edge_majors.size(),
+                        edge_weights.begin());
+  } else {
+    auto key_first = thrust::make_zip_iterator(
+      thrust::make_tuple(edge_subgraph_indices.begin(), edge_majors.begin(), edge_minors.begin()));
+    thrust::sort(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 key_first,
+                 key_first + edge_majors.size());
+  }
+
+  rmm::device_uvector<size_t> subgraph_edge_offsets(num_subgraphs + 1, handle.get_stream());
+  thrust::lower_bound(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    edge_subgraph_indices.begin(),
+    edge_subgraph_indices.end(),
+    thrust::make_counting_iterator(rx_subgraph_displacements[comm_rank]),
+    thrust::make_counting_iterator(rx_subgraph_displacements[comm_rank] + (num_subgraphs + 1)),
+    subgraph_edge_offsets.begin());
+
+  return std::make_tuple(std::move(edge_majors),
+                         std::move(edge_minors),
+                         std::move(edge_weights),
+                         std::move(subgraph_edge_offsets));
+}
+
+}  // namespace detail
+
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
@@ -58,12 +739,10 @@ extract_induced_subgraphs(
   HighResTimer hr_timer;
   hr_timer.start("extract_induced_subgraphs");
 #endif
-  // FIXME: this code is inefficient for the vertices with their local degrees much larger than the
-  // number of vertices in the subgraphs (in this case, searching that the subgraph vertices are
-  // included in the local neighbors is more efficient than searching the local neighbors are
-  // included in the subgraph vertices). We may later add additional code to handle such cases.
   // FIXME: we may consider the performance (speed & memory footprint, hash based approach uses
-  // extra-memory) of hash table based and binary search based approaches
+  // extra-memory) of hash table based and binary search based approaches for the low degree
+  // vertices as well; currently, only the vertices with their local degrees much larger than the
+  // number of vertices in their subgraphs take the hash based path
 
   // 1. check input arguments
 
@@ -82,14 +761,14 @@ extract_induced_subgraphs(
                         subgraph_offsets,
                         subgraph_offsets + (num_subgraphs + 1)),
       "Invalid input argument: subgraph_offsets is not sorted.");
+    // in multi-GPU, subgraph vertices are not necessarily local vertices
     vertex_partition_device_t<graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>>
       vertex_partition(graph_view);
     CUGRAPH_EXPECTS(thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
                                      subgraph_vertices,
                                      subgraph_vertices + num_aggregate_subgraph_vertices,
                                      [vertex_partition] __device__(auto v) {
-                                       return !vertex_partition.is_valid_vertex(v) ||
-                                              !vertex_partition.is_local_vertex_nocheck(v);
+                                       return !vertex_partition.is_valid_vertex(v);
                                      }) == 0,
                     "Invalid input argument: subgraph_vertices has invalid vertex IDs.");
 
@@ -117,148 +796,13 @@ extract_induced_subgraphs(
 
   // 2. extract induced subgraphs
 
-  if (multi_gpu) {
-    CUGRAPH_FAIL("Unimplemented.");
-    return std::make_tuple(rmm::device_uvector<vertex_t>(0, handle.get_stream()),
-                           rmm::device_uvector<vertex_t>(0, handle.get_stream()),
-                           rmm::device_uvector<weight_t>(0, handle.get_stream()),
-                           rmm::device_uvector<size_t>(0, handle.get_stream()));
-  } else {
-    // 2-1. Phase 1: calculate memory requirements
-
-    size_t num_aggregate_subgraph_vertices{};
-    raft::update_host(
-      &num_aggregate_subgraph_vertices, subgraph_offsets + num_subgraphs, 1, handle.get_stream());
-    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
-
-    rmm::device_uvector<size_t> subgraph_vertex_output_offsets(
-      num_aggregate_subgraph_vertices + 1,
-      handle.get_stream());  // for each element of subgraph_vertices
-
-    matrix_partition_device_t<graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>>
-      matrix_partition(graph_view, 0);
-    // count the numbers of the induced subgraph edges for each vertex in the aggregate subgraph
-    // vertex list.
-    thrust::transform(
-      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-      thrust::make_counting_iterator(size_t{0}),
-      thrust::make_counting_iterator(num_aggregate_subgraph_vertices),
-      subgraph_vertex_output_offsets.begin(),
-      [subgraph_offsets, subgraph_vertices, num_subgraphs, matrix_partition] __device__(auto i) {
-        auto subgraph_idx = thrust::distance(
-          subgraph_offsets + 1,
-          thrust::upper_bound(thrust::seq, subgraph_offsets, subgraph_offsets + num_subgraphs, i));
-        vertex_t const *indices{nullptr};
-        weight_t const *weights{nullptr};
-        edge_t local_degree{};
-        auto major_offset =
-          matrix_partition.get_major_offset_from_major_nocheck(subgraph_vertices[i]);
-        thrust::tie(indices, weights, local_degree) =
-          matrix_partition.get_local_edges(major_offset);
-        // FIXME: this is inefficient for high local degree vertices
-        return thrust::count_if(
-          thrust::seq,
-          indices,
-          indices + local_degree,
-          [vertex_first = subgraph_vertices + subgraph_offsets[subgraph_idx],
-           vertex_last =
-             subgraph_vertices + subgraph_offsets[subgraph_idx + 1]] __device__(auto nbr) {
-            return thrust::binary_search(thrust::seq, vertex_first, vertex_last, nbr);
-          });
-      });
-    thrust::exclusive_scan(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-                           subgraph_vertex_output_offsets.begin(),
-                           subgraph_vertex_output_offsets.end(),
-                           subgraph_vertex_output_offsets.begin());
-
-    size_t num_aggregate_edges{};
-    raft::update_host(&num_aggregate_edges,
-                      subgraph_vertex_output_offsets.data() + num_aggregate_subgraph_vertices,
-                      1,
-                      handle.get_stream());
-    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
-
-    // 2-2. Phase 2: find the edges in the induced subgraphs
-
-    rmm::device_uvector<vertex_t> edge_majors(num_aggregate_edges, handle.get_stream());
-    rmm::device_uvector<vertex_t> edge_minors(num_aggregate_edges, handle.get_stream());
-    rmm::device_uvector<weight_t> edge_weights(
-      graph_view.is_weighted() ? num_aggregate_edges : size_t{0}, handle.get_stream());
-
-    // fill the edge list buffer (to be returned) for each vetex in the aggregate subgraph vertex
-    // list (use the offsets computed in the Phase 1)
-    thrust::for_each(
-      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-      thrust::make_counting_iterator(size_t{0}),
-      thrust::make_counting_iterator(num_aggregate_subgraph_vertices),
-      [subgraph_offsets,
-       subgraph_vertices,
-       num_subgraphs,
-       matrix_partition,
-       subgraph_vertex_output_offsets = subgraph_vertex_output_offsets.data(),
-       edge_majors                    = edge_majors.data(),
-       edge_minors                    = edge_minors.data(),
-       edge_weights                   = edge_weights.data()] __device__(auto i) {
-        auto subgraph_idx = thrust::distance(
-          subgraph_offsets + 1,
-          thrust::upper_bound(
-            thrust::seq, subgraph_offsets, subgraph_offsets + num_subgraphs, size_t{i}));
-        vertex_t const *indices{nullptr};
-        weight_t const *weights{nullptr};
-        edge_t local_degree{};
-        auto major_offset =
-          matrix_partition.get_major_offset_from_major_nocheck(subgraph_vertices[i]);
-        thrust::tie(indices, weights, local_degree) =
-          matrix_partition.get_local_edges(major_offset);
-        if (weights != nullptr) {
-          auto triplet_first = thrust::make_zip_iterator(thrust::make_tuple(
-            thrust::make_constant_iterator(subgraph_vertices[i]), indices, weights));
-          // FIXME: this is inefficient for high local degree vertices
-          thrust::copy_if(
-            thrust::seq,
-            triplet_first,
-            triplet_first + local_degree,
-            thrust::make_zip_iterator(thrust::make_tuple(edge_majors, edge_minors, edge_weights)) +
-              subgraph_vertex_output_offsets[i],
-            [vertex_first = subgraph_vertices + subgraph_offsets[subgraph_idx],
-             vertex_last =
-               subgraph_vertices + subgraph_offsets[subgraph_idx + 1]] __device__(auto t) {
-              return thrust::binary_search(
-                thrust::seq, vertex_first, vertex_last, thrust::get<1>(t));
-            });
-        } else {
-          auto pair_first = thrust::make_zip_iterator(
-            thrust::make_tuple(thrust::make_constant_iterator(subgraph_vertices[i]), indices));
-          // FIXME: this is inefficient for high local degree vertices
-          thrust::copy_if(thrust::seq,
-                          pair_first,
-                          pair_first + local_degree,
-                          thrust::make_zip_iterator(thrust::make_tuple(edge_majors, edge_minors)) +
-                            subgraph_vertex_output_offsets[i],
-                          [vertex_first = subgraph_vertices + subgraph_offsets[subgraph_idx],
-                           vertex_last  = subgraph_vertices +
-                                         subgraph_offsets[subgraph_idx + 1]] __device__(auto t) {
-                            return thrust::binary_search(
-                              thrust::seq, vertex_first, vertex_last, thrust::get<1>(t));
-                          });
-        }
-      });
-
-    rmm::device_uvector<size_t> subgraph_edge_offsets(num_subgraphs + 1, handle.get_stream());
-    thrust::gather(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-                   subgraph_offsets,
-                   subgraph_offsets + (num_subgraphs + 1),
-                   subgraph_vertex_output_offsets.begin(),
-                   subgraph_edge_offsets.begin());
+  auto ret = detail::extract_induced_subgraphs_impl(
+    handle, graph_view, subgraph_offsets, subgraph_vertices, num_subgraphs);
 #ifdef TIMING
-    hr_timer.stop();
-    hr_timer.display(std::cout);
+  hr_timer.stop();
+  hr_timer.display(std::cout);
 #endif
-    return std::make_tuple(std::move(edge_majors),
-                           std::move(edge_minors),
-                           std::move(edge_weights),
-                           std::move(subgraph_edge_offsets));
-  }
+  return ret;
 }
 
 // explicit instantiation
@@ -395,5 +939,137 @@ extract_induced_subgraphs(raft::handle_t const &handle,
                           size_t num_subgraphs,
                           bool do_expensive_check);
 
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<float>,
+                    rmm::device_uvector<size_t>>
+extract_induced_subgraphs(raft::handle_t const &handle,
+                          graph_view_t<int32_t, int32_t, float, true, true> const &graph_view,
+                          size_t const *subgraph_offsets,
+                          int32_t const *subgraph_vertices,
+                          size_t num_subgraphs,
+                          bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<float>,
+                    rmm::device_uvector<size_t>>
+extract_induced_subgraphs(raft::handle_t const &handle,
+                          graph_view_t<int32_t, int32_t, float, false, true> const &graph_view,
+                          size_t const *subgraph_offsets,
+                          int32_t const *subgraph_vertices,
+                          size_t num_subgraphs,
+                          bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<double>,
+                    rmm::device_uvector<size_t>>
+extract_induced_subgraphs(raft::handle_t const &handle,
+                          graph_view_t<int32_t, int32_t, double, true, true> const &graph_view,
+                          size_t const *subgraph_offsets,
+                          int32_t const *subgraph_vertices,
+                          size_t num_subgraphs,
+                          bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<double>,
+                    rmm::device_uvector<size_t>>
+extract_induced_subgraphs(raft::handle_t const &handle,
+                          graph_view_t<int32_t, int32_t, double, false, true> const &graph_view,
+                          size_t const *subgraph_offsets,
+                          int32_t const *subgraph_vertices,
+                          size_t num_subgraphs,
+                          bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<float>,
+                    rmm::device_uvector<size_t>>
+extract_induced_subgraphs(raft::handle_t const &handle,
+                          graph_view_t<int32_t, int64_t, float, true, true> const &graph_view,
+                          size_t const *subgraph_offsets,
+                          int32_t const *subgraph_vertices,
+                          size_t num_subgraphs,
+                          bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<float>,
+                    rmm::device_uvector<size_t>>
+extract_induced_subgraphs(raft::handle_t const &handle,
+                          graph_view_t<int32_t, int64_t, float, false, true> const &graph_view,
+                          size_t const *subgraph_offsets,
+                          int32_t const *subgraph_vertices,
+                          size_t num_subgraphs,
+                          bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<double>,
+                    rmm::device_uvector<size_t>>
+extract_induced_subgraphs(raft::handle_t const &handle,
+                          graph_view_t<int32_t, int64_t, double, true, true> const &graph_view,
+                          size_t const *subgraph_offsets,
+                          int32_t const *subgraph_vertices,
+                          size_t num_subgraphs,
+                          bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<double>,
+                    rmm::device_uvector<size_t>>
+extract_induced_subgraphs(raft::handle_t const &handle,
+                          graph_view_t<int32_t, int64_t, double, false, true> const &graph_view,
+                          size_t const *subgraph_offsets,
+                          int32_t const *subgraph_vertices,
+                          size_t num_subgraphs,
+                          bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<float>,
+                    rmm::device_uvector<size_t>>
+extract_induced_subgraphs(raft::handle_t const &handle,
+                          graph_view_t<int64_t, int64_t, float, true, true> const &graph_view,
+                          size_t const *subgraph_offsets,
+                          int64_t const *subgraph_vertices,
+                          size_t num_subgraphs,
+                          bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<float>,
+                    rmm::device_uvector<size_t>>
+extract_induced_subgraphs(raft::handle_t const &handle,
+                          graph_view_t<int64_t, int64_t, float, false, true> const &graph_view,
+                          size_t const *subgraph_offsets,
+                          int64_t const *subgraph_vertices,
+                          size_t num_subgraphs,
+                          bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<double>,
+                    rmm::device_uvector<size_t>>
+extract_induced_subgraphs(raft::handle_t const &handle,
+                          graph_view_t<int64_t, int64_t, double, true, true> const &graph_view,
+                          size_t const *subgraph_offsets,
+                          int64_t const *subgraph_vertices,
+                          size_t num_subgraphs,
+                          bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<double>,
+                    rmm::device_uvector<size_t>>
+extract_induced_subgraphs(raft::handle_t const &handle,
+                          graph_view_t<int64_t, int64_t, double, false, true> const &graph_view,
+                          size_t const *subgraph_offsets,
+                          int64_t const *subgraph_vertices,
+                          size_t num_subgraphs,
+                          bool do_expensive_check);
+
 }  // namespace experimental
 }  // namespace cugraph
@@ -0,0 +1,773 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithms.hpp>
+#include <experimental/graph_view.hpp>
+#include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+#include <utilities/shuffle_comm.cuh>
+#include "neighbor_intersection.cuh"
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <limits>
+#include <tuple>
+
+// An undirected edge {u, v} (u < v) is represented by its canonical entry (u, v) in the local CSR
+// of the GPU owning u (the entry holds the edge support, i.e. the number of triangles including
+// the edge), the entry (v, u) in the local CSR of the GPU owning v is kept only to intersect the
+// neighbor lists of v. Only the first degrees[row] entries of each (sorted) neighbor list are
+// alive; peeling an edge removes its two entries and compacts the affected neighbor lists in
+// place.
+
+namespace cugraph {
+namespace experimental {
+namespace detail {
+
+// index of the alive entry (row, v) or std::numeric_limits<edge_t>::max() if there is none
+template <typename vertex_t, typename edge_t>
+__device__ edge_t find_alive_entry(
+  edge_t const *offsets, vertex_t const *indices, edge_t const *degrees, vertex_t row, vertex_t v)
+{
+  auto first = indices + offsets[row];
+  auto last  = first + degrees[row];
+  auto it    = thrust::lower_bound(thrust::seq, first, last, v);
+  return ((it != last) && (*it == v))
+           ? offsets[row] + static_cast<edge_t>(thrust::distance(first, it))
+           : std::numeric_limits<edge_t>::max();
+}
+
+template <typename vertex_t, typename edge_t>
+struct local_csr_t {
+  edge_t const *offsets{nullptr};
+  vertex_t const *indices{nullptr};
+  edge_t const *degrees{nullptr};
+  vertex_t const *entry_rows{nullptr};
+  vertex_t local_first{};
+
+  __device__ bool is_alive_canonical_entry(edge_t e) const
+  {
+    auto row = entry_rows[e];
+    return (e - offsets[row] < degrees[row]) && (indices[e] > local_first + row);
+  }
+};
+
+// support of every alive canonical entry (and std::numeric_limits<edge_t>::max() for the other
+// entries)
+template <typename vertex_t, typename edge_t>
+struct alive_canonical_support_t {
+  local_csr_t<vertex_t, edge_t> csr{};
+  edge_t const *supports{nullptr};
+
+  __device__ edge_t operator()(edge_t e) const
+  {
+    return csr.is_alive_canonical_entry(e) ? supports[e] : std::numeric_limits<edge_t>::max();
+  }
+};
+
+// remove the entries flagged dead from the neighbor list of row (keeping the alive entries sorted),
+// the flags of the row are reset
+template <typename vertex_t, typename edge_t>
+struct compact_neighbor_list_t {
+  edge_t const *offsets{nullptr};
+  vertex_t *indices{nullptr};
+  edge_t *degrees{nullptr};
+  edge_t *supports{nullptr};
+  uint8_t *dead_flags{nullptr};
+
+  // FIXME: this is inefficient for very high-degree vertices, for better performance, we can
+  // compact high-degree neighbor lists using one CUDA block per vertex
+  __device__ void operator()(vertex_t row) const
+  {
+    auto first = offsets[row];
+    edge_t num_alives{0};
+    for (edge_t i = 0; i < degrees[row]; ++i) {
+      if (dead_flags[first + i] == uint8_t{0}) {
+        indices[first + num_alives]  = indices[first + i];
+        supports[first + num_alives] = supports[first + i];
+        ++num_alives;
+      } else {
+        dead_flags[first + i] = uint8_t{0};
+      }
+    }
+    degrees[row] = num_alives;
+  }
+};
+
+// a match w of the intersection of the (alive) neighbor lists of a peeled edge (u, v) is a
+// triangle {u, v, w} destroyed by peeling (u, v), the two other edges of the triangle lose a
+// triangle; every (canonical edge, opposite vertex) record is emitted
+template <typename vertex_t, typename edge_t>
+struct emit_triangle_records_t {
+  neighbor_lists_t<vertex_t, edge_t> first_lists{};
+  vertex_t const *us{nullptr};
+  vertex_t const *vs{nullptr};
+  edge_t const *record_offsets{nullptr};
+  edge_t *cursors{nullptr};
+  vertex_t *record_ps{nullptr};
+  vertex_t *record_qs{nullptr};
+  vertex_t *record_xs{nullptr};
+
+  __device__ void operator()(size_t pair_id, edge_t first_list_index) const
+  {
+    auto u   = us[pair_id];
+    auto v   = vs[pair_id];
+    auto w   = first_lists.neighbors(pair_id)[first_list_index];
+    auto pos = record_offsets[pair_id] + edge_t{2} * atomicAdd(cursors + pair_id, edge_t{1});
+    record_ps[pos]     = thrust::min(u, w);
+    record_qs[pos]     = thrust::max(u, w);
+    record_xs[pos]     = v;
+    record_ps[pos + 1] = thrust::min(v, w);
+    record_qs[pos + 1] = thrust::max(v, w);
+    record_xs[pos + 1] = u;
+  }
+};
+
+// remove self-loops from a (tight) local CSR
+template <typename vertex_t, typename edge_t>
+void remove_self_loops(raft::handle_t const &handle,
+                       rmm::device_uvector<edge_t> &offsets,
+                       rmm::device_uvector<vertex_t> &indices,
+                       vertex_t local_first)
+{
+  auto stream = handle.get_stream();
+
+  auto num_rows = static_cast<vertex_t>(offsets.size() - 1);
+  rmm::device_uvector<vertex_t> rows_v(indices.size(), stream);
+  thrust::upper_bound(rmm::exec_policy(stream)->on(stream),
+                      offsets.begin() + 1,
+                      offsets.end(),
+                      thrust::make_counting_iterator(edge_t{0}),
+                      thrust::make_counting_iterator(static_cast<edge_t>(indices.size())),
+                      rows_v.begin());
+  auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(rows_v.begin(), indices.begin()));
+  auto num_edges  = static_cast<size_t>(thrust::distance(
+    edge_first,
+    thrust::remove_if(rmm::exec_policy(stream)->on(stream),
+                      edge_first,
+                      edge_first + indices.size(),
+                      [local_first] __device__(auto e) {
+                        return local_first + thrust::get<0>(e) == thrust::get<1>(e);
+                      })));
+  rows_v.resize(num_edges, stream);
+  indices.resize(num_edges, stream);
+  indices.shrink_to_fit(stream);
+  thrust::lower_bound(rmm::exec_policy(stream)->on(stream),
+                      rows_v.begin(),
+                      rows_v.end(),
+                      thrust::make_counting_iterator(vertex_t{0}),
+                      thrust::make_counting_iterator(num_rows + 1),
+                      offsets.begin());
+}
+
+// 1. Build the complete, sorted, and duplicate & self-loop free neighbor lists of the local
+// vertices (a copy of the CSR if the graph is single-GPU with sorted neighbor lists).
+// 2. Compute the support of every canonical entry (u, v) by intersecting N(u) and N(v) (N(v) is
+// fetched from the owner of v in multi-GPU).
+// 3. Peel level by level: at level k, the edges with support at most k - 2 have truss number k.
+// Peeling an edge set destroys the triangles including the peeled edges, the destroyed triangles
+// are listed by intersecting the alive neighbor lists of the peeled edges, and the supports of the
+// surviving edges of the destroyed triangles are decremented (records are de-duplicated, so a
+// triangle with multiple peeled edges is subtracted once). The edges dropping to support k - 2 form
+// the next peeling frontier of the level; the supports are never recomputed.
+// The edges left (if peeling stops at k_last) are reported with truss number k_last.
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<edge_t>>
+truss_decomposition(raft::handle_t const &handle,
+                    graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+                    edge_t k_last)
+{
+  auto stream = handle.get_stream();
+
+  auto const local_first       = graph_view.get_local_vertex_first();
+  auto const local_size        = graph_view.get_number_of_local_vertices();
+  auto constexpr invalid_entry = std::numeric_limits<edge_t>::max();
+
+  rmm::device_uvector<vertex_t> d_vertex_partition_lasts(0, stream);
+  vertex_to_gpu_id_t<vertex_t> vertex_to_gpu_id{};
+  if (multi_gpu) {
+    d_vertex_partition_lasts = vertex_partition_lasts(handle, graph_view);
+    vertex_to_gpu_id =
+      vertex_to_gpu_id_t<vertex_t>{d_vertex_partition_lasts.data(), handle.get_comms().get_size()};
+  }
+
+  // 1. complete neighbor lists of the local vertices
+
+  rmm::device_uvector<edge_t> offsets_v(0, stream);
+  rmm::device_uvector<vertex_t> indices_v(0, stream);
+  if (!multi_gpu && graph_view.has_sorted_neighbor_lists() && !graph_view.is_multigraph()) {
+    offsets_v.resize(local_size + 1, stream);
+    indices_v.resize(graph_view.get_number_of_edges(), stream);
+    thrust::copy(rmm::exec_policy(stream)->on(stream),
+                 graph_view.offsets(),
+                 graph_view.offsets() + offsets_v.size(),
+                 offsets_v.begin());
+    thrust::copy(rmm::exec_policy(stream)->on(stream),
+                 graph_view.indices(),
+                 graph_view.indices() + indices_v.size(),
+                 indices_v.begin());
+  } else {
+    rmm::device_uvector<vertex_t> rows_v(0, stream);
+    rmm::device_uvector<vertex_t> cols_v(0, stream);
+    std::tie(rows_v, cols_v) = decompress_local_edges(handle, graph_view);
+    if (multi_gpu) {
+      std::tie(rows_v, cols_v) = shuffle_edges_to_row_owners(
+        handle, vertex_to_gpu_id, std::move(rows_v), std::move(cols_v));
+    }
+    std::tie(offsets_v, indices_v) = compress_edgelist<edge_t>(
+      handle, std::move(rows_v), std::move(cols_v), local_first, local_size, true);
+  }
+  remove_self_loops(handle, offsets_v, indices_v, local_first);
+
+  auto num_entries = indices_v.size();
+
+  rmm::device_uvector<edge_t> degrees_v(local_size, stream);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    offsets_v.begin() + 1,
+                    offsets_v.end(),
+                    offsets_v.begin(),
+                    degrees_v.begin(),
+                    thrust::minus<edge_t>());
+
+  // entries move only within their neighbor lists, so entry rows never change
+  rmm::device_uvector<vertex_t> entry_rows_v(num_entries, stream);
+  thrust::upper_bound(rmm::exec_policy(stream)->on(stream),
+                      offsets_v.begin() + 1,
+                      offsets_v.end(),
+                      thrust::make_counting_iterator(edge_t{0}),
+                      thrust::make_counting_iterator(static_cast<edge_t>(num_entries)),
+                      entry_rows_v.begin());
+
+  local_csr_t<vertex_t, edge_t> csr{
+    offsets_v.data(), indices_v.data(), degrees_v.data(), entry_rows_v.data(), local_first};
+
+  // 2. initial supports
+
+  rmm::device_uvector<edge_t> supports_v(num_entries, stream);
+  size_t num_local_edges{0};
+  {
+    rmm::device_uvector<edge_t> entries_v(num_entries, stream);
+    entries_v.resize(
+      static_cast<size_t>(thrust::distance(
+        entries_v.begin(),
+        thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_counting_iterator(edge_t{0}),
+                        thrust::make_counting_iterator(static_cast<edge_t>(num_entries)),
+                        entries_v.begin(),
+                        [csr] __device__(auto e) { return csr.is_alive_canonical_entry(e); }))),
+      stream);
+    num_local_edges = entries_v.size();
+
+    rmm::device_uvector<vertex_t> firsts_v(entries_v.size(), stream);
+    rmm::device_uvector<vertex_t> seconds_v(entries_v.size(), stream);
+    thrust::transform(
+      rmm::exec_policy(stream)->on(stream),
+      entries_v.begin(),
+      entries_v.end(),
+      thrust::make_zip_iterator(thrust::make_tuple(firsts_v.begin(), seconds_v.begin())),
+      [csr, local_first] __device__(auto e) {
+        return thrust::make_tuple(csr.entry_rows[e],
+                                  multi_gpu ? csr.indices[e] : csr.indices[e] - local_first);
+      });
+
+    rmm::device_uvector<edge_t> remote_offsets_v(0, stream);
+    rmm::device_uvector<vertex_t> remote_indices_v(0, stream);
+    if (multi_gpu) {
+      std::tie(remote_offsets_v, remote_indices_v) = gather_neighbor_lists(handle,
+                                                                           vertex_to_gpu_id,
+                                                                           local_first,
+                                                                           offsets_v,
+                                                                           indices_v,
+                                                                           seconds_v.data(),
+                                                                           seconds_v.size());
+    }
+
+    rmm::device_uvector<edge_t> intersection_sizes_v(entries_v.size(), stream);
+    compute_intersection_sizes(
+      handle,
+      neighbor_lists_t<vertex_t, edge_t>{offsets_v.data(), indices_v.data(), firsts_v.data()},
+      neighbor_lists_t<vertex_t, edge_t>{
+        multi_gpu ? remote_offsets_v.data() : offsets_v.data(),
+        multi_gpu ? remote_indices_v.data() : indices_v.data(),
+        seconds_v.data()},
+      entries_v.size(),
+      intersection_sizes_v.data());
+    thrust::scatter(rmm::exec_policy(stream)->on(stream),
+                    intersection_sizes_v.begin(),
+                    intersection_sizes_v.end(),
+                    entries_v.begin(),
+                    supports_v.begin());
+  }
+
+  // 3. peel
+
+  rmm::device_uvector<vertex_t> srcs_v(num_local_edges, stream);
+  rmm::device_uvector<vertex_t> dsts_v(num_local_edges, stream);
+  rmm::device_uvector<edge_t> truss_numbers_v(num_local_edges, stream);
+  size_t num_peeled_edges{0};
+
+  rmm::device_uvector<uint8_t> dead_flags_v(num_entries, stream);
+  thrust::fill(
+    rmm::exec_policy(stream)->on(stream), dead_flags_v.begin(), dead_flags_v.end(), uint8_t{0});
+
+  auto num_remaining_edges = num_local_edges;
+  if (multi_gpu) {
+    num_remaining_edges = host_scalar_allreduce(handle.get_comms(), num_remaining_edges, stream);
+  }
+
+  while (num_remaining_edges > 0) {
+    // move to the next non-empty level
+
+    auto min_support = thrust::transform_reduce(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator(edge_t{0}),
+      thrust::make_counting_iterator(static_cast<edge_t>(num_entries)),
+      alive_canonical_support_t<vertex_t, edge_t>{csr, supports_v.data()},
+      std::numeric_limits<edge_t>::max(),
+      thrust::minimum<edge_t>());
+    if (multi_gpu) {
+      min_support =
+        host_scalar_allreduce(handle.get_comms(), min_support, raft::comms::op_t::MIN, stream);
+    }
+    auto k = min_support + 2;
+    if (k >= k_last) { break; }
+
+    rmm::device_uvector<edge_t> frontier_v(num_entries, stream);
+    frontier_v.resize(
+      static_cast<size_t>(thrust::distance(
+        frontier_v.begin(),
+        thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_counting_iterator(edge_t{0}),
+                        thrust::make_counting_iterator(static_cast<edge_t>(num_entries)),
+                        frontier_v.begin(),
+                        [csr, supports = supports_v.data(), min_support] __device__(auto e) {
+                          return csr.is_alive_canonical_entry(e) && (supports[e] <= min_support);
+                        }))),
+      stream);
+
+    while (true) {
+      auto aggregate_frontier_size = frontier_v.size();
+      if (multi_gpu) {
+        aggregate_frontier_size =
+          host_scalar_allreduce(handle.get_comms(), aggregate_frontier_size, stream);
+      }
+      if (aggregate_frontier_size == 0) { break; }
+      num_remaining_edges -= aggregate_frontier_size;
+
+      auto num_pairs = frontier_v.size();
+
+      // 3-1. record the truss numbers of the peeled edges
+
+      rmm::device_uvector<vertex_t> us_v(num_pairs, stream);
+      rmm::device_uvector<vertex_t> vs_v(num_pairs, stream);
+      rmm::device_uvector<vertex_t> firsts_v(num_pairs, stream);
+      thrust::transform(
+        rmm::exec_policy(stream)->on(stream),
+        frontier_v.begin(),
+        frontier_v.end(),
+        thrust::make_zip_iterator(thrust::make_tuple(us_v.begin(), vs_v.begin(), firsts_v.begin())),
+        [csr] __device__(auto e) {
+          return thrust::make_tuple(
+            csr.local_first + csr.entry_rows[e], csr.indices[e], csr.entry_rows[e]);
+        });
+      auto result_first = thrust::make_zip_iterator(thrust::make_tuple(
+        srcs_v.begin() + num_peeled_edges, dsts_v.begin() + num_peeled_edges));
+      thrust::copy(rmm::exec_policy(stream)->on(stream),
+                   thrust::make_zip_iterator(thrust::make_tuple(us_v.begin(), vs_v.begin())),
+                   thrust::make_zip_iterator(thrust::make_tuple(us_v.end(), vs_v.end())),
+                   result_first);
+      thrust::fill(rmm::exec_policy(stream)->on(stream),
+                   truss_numbers_v.begin() + num_peeled_edges,
+                   truss_numbers_v.begin() + num_peeled_edges + num_pairs,
+                   k);
+      num_peeled_edges += num_pairs;
+
+      // 3-2. list the destroyed triangles
+
+      rmm::device_uvector<vertex_t> record_ps_v(0, stream);
+      rmm::device_uvector<vertex_t> record_qs_v(0, stream);
+      rmm::device_uvector<vertex_t> record_xs_v(0, stream);
+      {
+        rmm::device_uvector<vertex_t> seconds_v(num_pairs, stream);
+        thrust::transform(rmm::exec_policy(stream)->on(stream),
+                          vs_v.begin(),
+                          vs_v.end(),
+                          seconds_v.begin(),
+                          [local_first] __device__(auto v) {
+                            return multi_gpu ? v : v - local_first;
+                          });
+
+        rmm::device_uvector<edge_t> remote_offsets_v(0, stream);
+        rmm::device_uvector<vertex_t> remote_indices_v(0, stream);
+        if (multi_gpu) {
+          std::tie(remote_offsets_v, remote_indices_v) =
+            gather_neighbor_lists(handle,
+                                  vertex_to_gpu_id,
+                                  local_first,
+                                  offsets_v,
+                                  indices_v,
+                                  seconds_v.data(),
+                                  seconds_v.size(),
+                                  degrees_v.data());
+        }
+
+        neighbor_lists_t<vertex_t, edge_t> first_lists{
+          offsets_v.data(), indices_v.data(), firsts_v.data(), degrees_v.data()};
+        neighbor_lists_t<vertex_t, edge_t> second_lists{
+          multi_gpu ? remote_offsets_v.data() : offsets_v.data(),
+          multi_gpu ? remote_indices_v.data() : indices_v.data(),
+          seconds_v.data(),
+          multi_gpu ? static_cast<edge_t const *>(nullptr) : degrees_v.data()};
+
+        rmm::device_uvector<edge_t> intersection_sizes_v(num_pairs, stream);
+        compute_intersection_sizes(
+          handle, first_lists, second_lists, num_pairs, intersection_sizes_v.data());
+
+        rmm::device_uvector<edge_t> record_offsets_v(num_pairs + 1, stream);
+        edge_t zero{0};
+        record_offsets_v.set_element_async(0, zero, stream);
+        thrust::transform_inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                                         intersection_sizes_v.begin(),
+                                         intersection_sizes_v.end(),
+                                         record_offsets_v.begin() + 1,
+                                         [] __device__(auto size) { return size * edge_t{2}; },
+                                         thrust::plus<edge_t>());
+        edge_t num_records{0};
+        raft::update_host(&num_records, record_offsets_v.data() + num_pairs, 1, stream);
+        CUDA_TRY(cudaStreamSynchronize(stream));
+
+        record_ps_v.resize(num_records, stream);
+        record_qs_v.resize(num_records, stream);
+        record_xs_v.resize(num_records, stream);
+        thrust::fill(rmm::exec_policy(stream)->on(stream),
+                     intersection_sizes_v.begin(),
+                     intersection_sizes_v.end(),
+                     edge_t{0});  // reused as emission cursors
+        rmm::device_uvector<edge_t> tmp_sizes_v(num_pairs, stream);
+        compute_intersection_sizes(
+          handle,
+          first_lists,
+          second_lists,
+          num_pairs,
+          tmp_sizes_v.data(),
+          emit_triangle_records_t<vertex_t, edge_t>{first_lists,
+                                                    us_v.data(),
+                                                    vs_v.data(),
+                                                    record_offsets_v.data(),
+                                                    intersection_sizes_v.data(),
+                                                    record_ps_v.data(),
+                                                    record_qs_v.data(),
+                                                    record_xs_v.data()});
+      }
+
+      if (multi_gpu) {
+        auto record_first = thrust::make_zip_iterator(
+          thrust::make_tuple(record_ps_v.begin(), record_qs_v.begin(), record_xs_v.begin()));
+        std::forward_as_tuple(std::tie(record_ps_v, record_qs_v, record_xs_v), std::ignore) =
+          groupby_gpuid_and_shuffle_values(
+            handle.get_comms(),
+            record_first,
+            record_first + record_ps_v.size(),
+            first_element_to_gpu_id_t<vertex_t, thrust::tuple<vertex_t, vertex_t, vertex_t>>{
+              vertex_to_gpu_id},
+            stream);
+      }
+
+      // 3-3. remove the peeled edges (both entries)
+
+      rmm::device_uvector<vertex_t> reverse_us_v(num_pairs, stream);
+      rmm::device_uvector<vertex_t> reverse_vs_v(num_pairs, stream);
+      thrust::copy(
+        rmm::exec_policy(stream)->on(stream), us_v.begin(), us_v.end(), reverse_us_v.begin());
+      thrust::copy(
+        rmm::exec_policy(stream)->on(stream), vs_v.begin(), vs_v.end(), reverse_vs_v.begin());
+      if (multi_gpu) {
+        auto pair_first = thrust::make_zip_iterator(
+          thrust::make_tuple(reverse_vs_v.begin(), reverse_us_v.begin()));
+        std::forward_as_tuple(std::tie(reverse_vs_v, reverse_us_v), std::ignore) =
+          groupby_gpuid_and_shuffle_values(
+            handle.get_comms(),
+            pair_first,
+            pair_first + reverse_vs_v.size(),
+            first_element_to_gpu_id_t<vertex_t, thrust::tuple<vertex_t, vertex_t>>{
+              vertex_to_gpu_id},
+            stream);
+      }
+
+      thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                       frontier_v.begin(),
+                       frontier_v.end(),
+                       [dead_flags = dead_flags_v.data()] __device__(auto e) {
+                         dead_flags[e] = uint8_t{1};
+                       });
+      auto reverse_pair_first =
+        thrust::make_zip_iterator(thrust::make_tuple(reverse_vs_v.begin(), reverse_us_v.begin()));
+      thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                       reverse_pair_first,
+                       reverse_pair_first + reverse_vs_v.size(),
+                       [csr, dead_flags = dead_flags_v.data()] __device__(auto pair) {
+                         auto e = find_alive_entry(csr.offsets,
+                                                   csr.indices,
+                                                   csr.degrees,
+                                                   thrust::get<0>(pair) - csr.local_first,
+                                                   thrust::get<1>(pair));
+                         if (e != std::numeric_limits<edge_t>::max()) {
+                           dead_flags[e] = uint8_t{1};
+                         }
+                       });
+
+      rmm::device_uvector<vertex_t> affected_rows_v(firsts_v.size() + reverse_vs_v.size(),
+                                                    stream);
+      thrust::copy(rmm::exec_policy(stream)->on(stream),
+                   firsts_v.begin(),
+                   firsts_v.end(),
+                   affected_rows_v.begin());
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        reverse_vs_v.begin(),
+                        reverse_vs_v.end(),
+                        affected_rows_v.begin() + firsts_v.size(),
+                        [local_first] __device__(auto v) { return v - local_first; });
+      thrust::sort(
+        rmm::exec_policy(stream)->on(stream), affected_rows_v.begin(), affected_rows_v.end());
+      affected_rows_v.resize(
+        static_cast<size_t>(thrust::distance(affected_rows_v.begin(),
+                                             thrust::unique(rmm::exec_policy(stream)->on(stream),
+                                                            affected_rows_v.begin(),
+                                                            affected_rows_v.end()))),
+        stream);
+      thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                       affected_rows_v.begin(),
+                       affected_rows_v.end(),
+                       compact_neighbor_list_t<vertex_t, edge_t>{offsets_v.data(),
+                                                                 indices_v.data(),
+                                                                 degrees_v.data(),
+                                                                 supports_v.data(),
+                                                                 dead_flags_v.data()});
+
+      // 3-4. decrement the supports of the surviving edges of the destroyed triangles (the
+      // records of the peeled edges find no alive entry)
+
+      auto record_first = thrust::make_zip_iterator(
+        thrust::make_tuple(record_ps_v.begin(), record_qs_v.begin(), record_xs_v.begin()));
+      thrust::sort(
+        rmm::exec_policy(stream)->on(stream), record_first, record_first + record_ps_v.size());
+      auto num_unique_records = static_cast<size_t>(thrust::distance(
+        record_first,
+        thrust::unique(
+          rmm::exec_policy(stream)->on(stream), record_first, record_first + record_ps_v.size())));
+      record_xs_v.resize(0, stream);
+      record_xs_v.shrink_to_fit(stream);
+
+      rmm::device_uvector<vertex_t> edge_ps_v(num_unique_records, stream);
+      rmm::device_uvector<vertex_t> edge_qs_v(num_unique_records, stream);
+      rmm::device_uvector<edge_t> decrements_v(num_unique_records, stream);
+      auto key_first =
+        thrust::make_zip_iterator(thrust::make_tuple(record_ps_v.begin(), record_qs_v.begin()));
+      auto edge_first =
+        thrust::make_zip_iterator(thrust::make_tuple(edge_ps_v.begin(), edge_qs_v.begin()));
+      auto num_decremented_edges = static_cast<size_t>(thrust::distance(
+        edge_first,
+        thrust::get<0>(thrust::reduce_by_key(rmm::exec_policy(stream)->on(stream),
+                                             key_first,
+                                             key_first + num_unique_records,
+                                             thrust::make_constant_iterator(edge_t{1}),
+                                             edge_first,
+                                             decrements_v.begin()))));
+      record_ps_v.resize(0, stream);
+      record_ps_v.shrink_to_fit(stream);
+      record_qs_v.resize(0, stream);
+      record_qs_v.shrink_to_fit(stream);
+
+      frontier_v.resize(num_decremented_edges, stream);
+      auto decrement_first = thrust::make_zip_iterator(
+        thrust::make_tuple(edge_ps_v.begin(), edge_qs_v.begin(), decrements_v.begin()));
+      thrust::transform(
+        rmm::exec_policy(stream)->on(stream),
+        decrement_first,
+        decrement_first + num_decremented_edges,
+        frontier_v.begin(),
+        [csr, supports = supports_v.data(), min_support, invalid_entry] __device__(auto t) {
+          auto e = find_alive_entry(csr.offsets,
+                                    csr.indices,
+                                    csr.degrees,
+                                    thrust::get<0>(t) - csr.local_first,
+                                    thrust::get<1>(t));
+          if (e == invalid_entry) { return invalid_entry; }
+          auto support = supports[e] - thrust::get<2>(t);
+          supports[e]  = support > min_support ? support : min_support;
+          return support <= min_support ? e : invalid_entry;
+        });
+      frontier_v.resize(
+        static_cast<size_t>(thrust::distance(
+          frontier_v.begin(),
+          thrust::remove(rmm::exec_policy(stream)->on(stream),
+                         frontier_v.begin(),
+                         frontier_v.end(),
+                         invalid_entry))),
+        stream);
+    }
+  }
+
+  // 4. the edges left have truss numbers no smaller than k_last
+
+  if (num_peeled_edges < num_local_edges) {
+    rmm::device_uvector<edge_t> entries_v(num_local_edges - num_peeled_edges, stream);
+    thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator(edge_t{0}),
+                    thrust::make_counting_iterator(static_cast<edge_t>(num_entries)),
+                    entries_v.begin(),
+                    [csr] __device__(auto e) { return csr.is_alive_canonical_entry(e); });
+    thrust::transform(
+      rmm::exec_policy(stream)->on(stream),
+      entries_v.begin(),
+      entries_v.end(),
+      thrust::make_zip_iterator(thrust::make_tuple(srcs_v.begin() + num_peeled_edges,
+                                                   dsts_v.begin() + num_peeled_edges,
+                                                   truss_numbers_v.begin() + num_peeled_edges)),
+      [csr, k_last] __device__(auto e) {
+        return thrust::make_tuple(csr.local_first + csr.entry_rows[e], csr.indices[e], k_last);
+      });
+  }
+
+  return std::make_tuple(std::move(srcs_v), std::move(dsts_v), std::move(truss_numbers_v));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<edge_t>>
+truss_decomposition(raft::handle_t const &handle,
+                    graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+                    bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: truss_decomposition requires a symmetric graph.");
+
+  if (do_expensive_check) {
+    // FIXME: check whether the graph is really symmetric (the graph property is not verified)
+  }
+
+  return detail::truss_decomposition(handle, graph_view, std::numeric_limits<edge_t>::max());
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> k_truss(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  edge_t k,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: k_truss requires a symmetric graph.");
+  CUGRAPH_EXPECTS(k >= 2, "Invalid input argument: k should be at least 2.");
+
+  if (do_expensive_check) {
+    // FIXME: check whether the graph is really symmetric (the graph property is not verified)
+  }
+
+  auto stream = handle.get_stream();
+
+  rmm::device_uvector<vertex_t> srcs_v(0, stream);
+  rmm::device_uvector<vertex_t> dsts_v(0, stream);
+  rmm::device_uvector<edge_t> truss_numbers_v(0, stream);
+  std::tie(srcs_v, dsts_v, truss_numbers_v) = detail::truss_decomposition(handle, graph_view, k);
+
+  // peeling stops before level k, the edges left (reported with truss number k) are in the k-truss
+  auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(srcs_v.begin(), dsts_v.begin()));
+  auto num_edges  = static_cast<size_t>(
+    thrust::distance(edge_first,
+                     thrust::remove_if(rmm::exec_policy(stream)->on(stream),
+                                       edge_first,
+                                       edge_first + srcs_v.size(),
+                                       truss_numbers_v.begin(),
+                                       [k] __device__(auto truss_number) {
+                                         return truss_number < k;
+                                       })));
+  truss_numbers_v.release();
+
+  // symmetrize
+  srcs_v.resize(num_edges * 2, stream);
+  dsts_v.resize(num_edges * 2, stream);
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               srcs_v.begin(),
+               srcs_v.begin() + num_edges,
+               dsts_v.begin() + num_edges);
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               dsts_v.begin(),
+               dsts_v.begin() + num_edges,
+               srcs_v.begin() + num_edges);
+
+  return std::make_tuple(std::move(srcs_v), std::move(dsts_v));
+}
+
+// explicit instantiation
+
+#define INSTANTIATE_K_TRUSS(vertex_t, edge_t, weight_t, multi_gpu)                  \
+  template std::tuple<rmm::device_uvector<vertex_t>,                                \
+                      rmm::device_uvector<vertex_t>,                                \
+                      rmm::device_uvector<edge_t>>                                  \
+  truss_decomposition(                                                              \
+    raft::handle_t const &handle,                                                   \
+    graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,   \
+    bool do_expensive_check);                                                       \
+                                                                                    \
+  template std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>> \
+  k_truss(                                                                          \
+    raft::handle_t const &handle,                                                   \
+    graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,   \
+    edge_t k,                                                                       \
+    bool do_expensive_check);
+
+INSTANTIATE_K_TRUSS(int32_t, int32_t, float, true)
+INSTANTIATE_K_TRUSS(int32_t, int32_t, double, true)
+INSTANTIATE_K_TRUSS(int32_t, int64_t, float, true)
+INSTANTIATE_K_TRUSS(int32_t, int64_t, double, true)
+INSTANTIATE_K_TRUSS(int64_t, int64_t, float, true)
+INSTANTIATE_K_TRUSS(int64_t, int64_t, double, true)
+INSTANTIATE_K_TRUSS(int32_t, int32_t, float, false)
+INSTANTIATE_K_TRUSS(int32_t, int32_t, double, false)
+INSTANTIATE_K_TRUSS(int32_t, int64_t, float, false)
+INSTANTIATE_K_TRUSS(int32_t, int64_t, double, false)
+INSTANTIATE_K_TRUSS(int64_t, int64_t, float, false)
+INSTANTIATE_K_TRUSS(int64_t, int64_t, double, false)
+
+}  // namespace experimental
+}  // namespace cugraph
@@ -14,23 +14,36 @@
  * limitations under the License.
  */
 
+#include "column_sums.cuh"
+
 #include <algorithms.hpp>
 #include <experimental/graph_view.hpp>
 #include <patterns/copy_to_adj_matrix_row_col.cuh>
+#include <patterns/copy_to_adj_matrix_row_col_bfloat16.cuh>
 #include <patterns/copy_v_transform_reduce_in_out_nbr.cuh>
 #include <patterns/count_if_v.cuh>
 #include <patterns/transform_reduce_v.cuh>
 #include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+#include <utilities/profiling.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <raft/handle.hpp>
+#include <rmm/device_scalar.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/count.h>
 #include <thrust/fill.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
+#include <limits>
+#include <memory>
+
 namespace cugraph {
 namespace experimental {
 namespace detail {
@@ -46,7 +59,9 @@ void katz_centrality(raft::handle_t const &handle,
                      size_t max_iterations,
                      bool has_initial_guess,
                      bool normalize,
-                     bool do_expensive_check)
+                     bool do_expensive_check,
+                     size_t convergence_check_interval,
+                     bool reduced_precision)
 {
   using vertex_t = typename GraphViewType::vertex_type;
   using weight_t = typename GraphViewType::weight_type;
@@ -58,6 +73,8 @@ void katz_centrality(raft::handle_t const &handle,
   static_assert(GraphViewType::is_adj_matrix_transposed,
                 "GraphViewType should support the pull model.");
 
+  profile_range_t profile_range(handle, "katz_centrality");
+
   auto const num_vertices = pull_graph_view.get_number_of_vertices();
   if (num_vertices == 0) { return; }
 
@@ -66,6 +83,8 @@ void katz_centrality(raft::handle_t const &handle,
   CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha <= 1.0),
                   "Invalid input argument: alpha should be in [0.0, 1.0].");
   CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+  CUGRAPH_EXPECTS(convergence_check_interval > 0,
+                  "Invalid input argument: convergence_check_interval should be positive.");
 
   if (do_expensive_check) {
     // FIXME: should I check for betas?
@@ -92,27 +111,60 @@ void katz_centrality(raft::handle_t const &handle,
   // old katz centrality values
   rmm::device_uvector<result_t> tmp_katz_centralities(
     pull_graph_view.get_number_of_local_vertices(), handle.get_stream());
+  // the adjacency matrix row values are stored (and communicated in multi-GPU) in bfloat16 till the
+  // iteration gets close to convergence if reduced_precision is true
+  auto use_bfloat16 = reduced_precision;
   rmm::device_uvector<result_t> adj_matrix_row_katz_centralities(
-    pull_graph_view.get_number_of_local_adj_matrix_partition_rows(), handle.get_stream());
+    use_bfloat16 ? size_t{0} : pull_graph_view.get_number_of_local_adj_matrix_partition_rows(),
+    handle.get_stream());
+  rmm::device_uvector<bfloat16_t> adj_matrix_row_bfloat16_katz_centralities(
+    use_bfloat16 ? pull_graph_view.get_number_of_local_adj_matrix_partition_rows() : vertex_t{0},
+    handle.get_stream());
+  rmm::device_scalar<result_t> diff_sum(handle.get_stream());
+  auto last_diff_sum         = std::numeric_limits<result_t>::max();
   auto new_katz_centralities = katz_centralities;
   auto old_katz_centralities = tmp_katz_centralities.data();
+  // the CUDA stream and events for the multi-GPU copy_v_transform_reduce_in_nbr() calls are created
+  // once per run (instead of once per iteration)
+  auto pipeline_streams = GraphViewType::is_multi_gpu
+                            ? std::make_unique<major_reduce_pipeline_streams_t>()
+                            : std::unique_ptr<major_reduce_pipeline_streams_t>{nullptr};
   size_t iter{0};
   while (true) {
     std::swap(new_katz_centralities, old_katz_centralities);
 
-    copy_to_adj_matrix_row(
-      handle, pull_graph_view, old_katz_centralities, adj_matrix_row_katz_centralities.begin());
-
-    copy_v_transform_reduce_in_nbr(
-      handle,
-      pull_graph_view,
-      adj_matrix_row_katz_centralities.begin(),
-      thrust::make_constant_iterator(0) /* dummy */,
-      [alpha] __device__(vertex_t src, vertex_t dst, weight_t w, auto src_val, auto dst_val) {
-        return static_cast<result_t>(alpha * src_val * w);
-      },
-      betas != nullptr ? result_t{0.0} : beta,
-      new_katz_centralities);
+    auto e_op = [alpha] __device__(
+                  vertex_t src, vertex_t dst, weight_t w, auto src_val, auto dst_val) {
+      return static_cast<result_t>(alpha * src_val * w);
+    };
+    if (use_bfloat16) {
+      copy_to_adj_matrix_row_bfloat16(handle,
+                                      pull_graph_view,
+                                      old_katz_centralities,
+                                      adj_matrix_row_bfloat16_katz_centralities.data());
+
+      copy_v_transform_reduce_in_nbr(
+        handle,
+        pull_graph_view,
+        make_bfloat16_input_iterator<result_t>(adj_matrix_row_bfloat16_katz_centralities.data()),
+        thrust::make_constant_iterator(0) /* dummy */,
+        e_op,
+        betas != nullptr ? result_t{0.0} : beta,
+        new_katz_centralities,
+        pipeline_streams.get());
+    } else {
+      copy_to_adj_matrix_row(
+        handle, pull_graph_view, old_katz_centralities, adj_matrix_row_katz_centralities.begin());
+
+      copy_v_transform_reduce_in_nbr(handle,
+                                     pull_graph_view,
+                                     adj_matrix_row_katz_centralities.begin(),
+                                     thrust::make_constant_iterator(0) /* dummy */,
+                                     e_op,
+                                     betas != nullptr ? result_t{0.0} : beta,
+                                     new_katz_centralities,
+                                     pipeline_streams.get());
+    }
 
     if (betas != nullptr) {
       auto val_first = thrust::make_zip_iterator(thrust::make_tuple(new_katz_centralities, betas));
@@ -127,19 +179,38 @@ void katz_centrality(raft::handle_t const &handle,
                         });
     }
 
-    auto diff_sum = transform_reduce_v(
+    // the convergence measure stays in device memory, so the iteration runs without host
+    // synchronization between convergence checks
+    transform_reduce_v_async(
       handle,
       pull_graph_view,
       thrust::make_zip_iterator(thrust::make_tuple(new_katz_centralities, old_katz_centralities)),
       [] __device__(auto val) { return std::abs(thrust::get<0>(val) - thrust::get<1>(val)); },
-      result_t{0.0});
+      result_t{0.0},
+      diff_sum.data());
 
     iter++;
-
-    if (diff_sum < epsilon) {
-      break;
-    } else if (iter >= max_iterations) {
-      CUGRAPH_FAIL("Katz Centrality failed to converge.");
+    add_profile_counter("iterations", 1);
+
+    if ((iter % convergence_check_interval == 0) || (iter >= max_iterations)) {
+      auto h_diff_sum = diff_sum.value(handle.get_stream());
+      if (use_bfloat16) {
+        // the last iterations run in full precision to reach the full precision tolerance
+        if (detail::fall_back_from_bfloat16(h_diff_sum, last_diff_sum, epsilon)) {
+          use_bfloat16 = false;
+          adj_matrix_row_bfloat16_katz_centralities.resize(0, handle.get_stream());
+          adj_matrix_row_bfloat16_katz_centralities.shrink_to_fit(handle.get_stream());
+          adj_matrix_row_katz_centralities.resize(
+            pull_graph_view.get_number_of_local_adj_matrix_partition_rows(), handle.get_stream());
+          add_profile_counter("full_precision_fallbacks", 1);
+        }
+        last_diff_sum = h_diff_sum;
+        if (iter >= max_iterations) { CUGRAPH_FAIL("Katz Centrality failed to converge."); }
+      } else if (h_diff_sum < epsilon) {
+        break;
+      } else if (iter >= max_iterations) {
+        CUGRAPH_FAIL("Katz Centrality failed to converge.");
+      }
     }
   }
 
@@ -168,6 +239,209 @@ void katz_centrality(raft::handle_t const &handle,
   }
 }
 
+template <typename vertex_t, typename result_t>
+struct column_major_to_katz_centrality_diff_t {
+  result_t const *katz_centralities{nullptr};
+  result_t const *old_katz_centralities{nullptr};
+  vertex_t num_rows{};
+  size_t num_columns{};
+
+  __device__ result_t operator()(size_t i) const
+  {
+    auto offset = static_cast<size_t>(i % num_rows) * num_columns + i / num_rows;
+    return std::abs(*(katz_centralities + offset) - *(old_katz_centralities + offset));
+  }
+};
+
+template <typename vertex_t, typename result_t>
+struct column_major_to_squared_katz_centrality_t {
+  result_t const *katz_centralities{nullptr};
+  vertex_t num_rows{};
+  size_t num_columns{};
+
+  __device__ result_t operator()(size_t i) const
+  {
+    auto offset = static_cast<size_t>(i % num_rows) * num_columns + i / num_rows;
+    return *(katz_centralities + offset) * *(katz_centralities + offset);
+  }
+};
+
+template <typename GraphViewType, typename result_t>
+void batched_katz_centrality(raft::handle_t const &handle,
+                             GraphViewType const &pull_graph_view,
+                             size_t num_variants,
+                             result_t const *alphas,
+                             result_t const *betas,
+                             result_t *katz_centralities,
+                             result_t epsilon,
+                             size_t max_iterations,
+                             bool has_initial_guess,
+                             bool normalize,
+                             bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the pull model.");
+
+  profile_range_t profile_range(handle, "batched_katz_centrality");
+
+  auto const num_vertices       = pull_graph_view.get_number_of_vertices();
+  auto const num_local_vertices = pull_graph_view.get_number_of_local_vertices();
+  auto const num_columns        = num_variants;
+  if ((num_vertices == 0) || (num_columns == 0)) { return; }
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((alphas != nullptr) && (betas != nullptr),
+                  "Invalid input argument: alphas and betas should be provided.");
+  CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+
+  auto num_invalid_alphas =
+    thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     alphas,
+                     alphas + num_columns,
+                     [] __device__(auto val) { return !((val >= 0.0) && (val <= 1.0)); });
+  CUGRAPH_EXPECTS(num_invalid_alphas == 0,
+                  "Invalid input argument: alphas should be in [0.0, 1.0].");
+
+  auto num_local_values = static_cast<size_t>(num_local_vertices) * num_columns;
+
+  if (do_expensive_check) {
+    if (has_initial_guess) {
+      auto num_negative_values =
+        thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                         katz_centralities,
+                         katz_centralities + num_local_values,
+                         [] __device__(auto val) { return val < 0.0; });
+      if (GraphViewType::is_multi_gpu) {
+        num_negative_values =
+          host_scalar_allreduce(handle.get_comms(), num_negative_values, handle.get_stream());
+      }
+      CUGRAPH_EXPECTS(num_negative_values == 0,
+                      "Invalid input argument: initial guess values should be non-negative.");
+    }
+  }
+
+  // 2. initialize katz centrality values
+
+  if (!has_initial_guess) {
+    thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 katz_centralities,
+                 katz_centralities + num_local_values,
+                 result_t{0.0});
+  }
+
+  // 3. katz centrality iteration
+
+  // old katz centrality values
+  rmm::device_uvector<result_t> tmp_katz_centralities(num_local_values, handle.get_stream());
+  rmm::device_uvector<result_t> adj_matrix_row_katz_centralities(
+    static_cast<size_t>(pull_graph_view.get_number_of_local_adj_matrix_partition_rows()) *
+      num_columns,
+    handle.get_stream());
+  auto new_katz_centralities = katz_centralities;
+  auto old_katz_centralities = tmp_katz_centralities.data();
+  // the CUDA stream and events for the multi-GPU copy_v_transform_reduce_in_nbr() calls are created
+  // once per run (instead of once per iteration)
+  auto pipeline_streams = GraphViewType::is_multi_gpu
+                            ? std::make_unique<major_reduce_pipeline_streams_t>()
+                            : std::unique_ptr<major_reduce_pipeline_streams_t>{nullptr};
+  size_t iter{0};
+  while (true) {
+    std::swap(new_katz_centralities, old_katz_centralities);
+
+    copy_to_adj_matrix_row(handle,
+                           pull_graph_view,
+                           num_columns,
+                           old_katz_centralities,
+                           adj_matrix_row_katz_centralities.begin());
+
+    // a single pass over the edges for every (alpha, beta) variant, alpha is applied after the
+    // reduction as it differs per column
+    copy_v_transform_reduce_in_nbr(
+      handle,
+      pull_graph_view,
+      num_columns,
+      adj_matrix_row_katz_centralities.begin(),
+      thrust::make_constant_iterator(0) /* dummy */,
+      [] __device__(vertex_t src, vertex_t dst, weight_t w, auto src_val, auto dst_val) {
+        return static_cast<result_t>(src_val * w);
+      },
+      result_t{0.0},
+      new_katz_centralities,
+      pipeline_streams.get());
+
+    thrust::transform(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_local_values),
+      new_katz_centralities,
+      [new_katz_centralities, alphas, betas, num_columns] __device__(auto i) {
+        return *(alphas + i % num_columns) * *(new_katz_centralities + i) +
+               *(betas + i % num_columns);
+      });
+
+    auto diff_sums = compute_column_sums<GraphViewType::is_multi_gpu, vertex_t, result_t>(
+      handle,
+      num_local_vertices,
+      num_columns,
+      column_major_to_katz_centrality_diff_t<vertex_t, result_t>{
+        new_katz_centralities, old_katz_centralities, num_local_vertices, num_columns});
+    auto max_diff_sum =
+      thrust::reduce(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     diff_sums.begin(),
+                     diff_sums.end(),
+                     result_t{0.0},
+                     thrust::maximum<result_t>());
+
+    iter++;
+    add_profile_counter("iterations", 1);
+
+    if (max_diff_sum < epsilon) {
+      break;
+    } else if (iter >= max_iterations) {
+      CUGRAPH_FAIL("Batched Katz Centrality failed to converge.");
+    }
+  }
+
+  if (new_katz_centralities != katz_centralities) {
+    thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 new_katz_centralities,
+                 new_katz_centralities + num_local_values,
+                 katz_centralities);
+  }
+
+  if (normalize) {
+    auto l2_norms = compute_column_sums<GraphViewType::is_multi_gpu, vertex_t, result_t>(
+      handle,
+      num_local_vertices,
+      num_columns,
+      column_major_to_squared_katz_centrality_t<vertex_t, result_t>{
+        katz_centralities, num_local_vertices, num_columns});
+    auto num_nonpositive_l2_norms =
+      thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                       l2_norms.begin(),
+                       l2_norms.end(),
+                       [] __device__(auto val) { return val <= 0.0; });
+    CUGRAPH_EXPECTS(num_nonpositive_l2_norms == 0,
+                    "L2 norm of the computed Katz Centrality values should be positive.");
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(num_local_values),
+                      katz_centralities,
+                      [katz_centralities, l2_norms = l2_norms.data(), num_columns] __device__(
+                        auto i) {
+                        return *(katz_centralities + i) / std::sqrt(*(l2_norms + i % num_columns));
+                      });
+  }
+}
+
 }  // namespace detail
 
 template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
@@ -181,7 +455,9 @@ void katz_centrality(raft::handle_t const &handle,
                      size_t max_iterations,
                      bool has_initial_guess,
                      bool normalize,
-                     bool do_expensive_check)
+                     bool do_expensive_check,
+                     size_t convergence_check_interval,
+                     bool reduced_precision)
 {
   detail::katz_centrality(handle,
                           graph_view,
@@ -193,7 +469,36 @@ void katz_centrality(raft::handle_t const &handle,
                           max_iterations,
                           has_initial_guess,
                           normalize,
-                          do_expensive_check);
+                          do_expensive_check,
+                          convergence_check_interval,
+                          reduced_precision);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void batched_katz_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const &graph_view,
+  size_t num_variants,
+  result_t const *alphas,
+  result_t const *betas,
+  result_t *katz_centralities,
+  result_t epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check)
+{
+  detail::batched_katz_centrality(handle,
+                                  graph_view,
+                                  num_variants,
+                                  alphas,
+                                  betas,
+                                  katz_centralities,
+                                  epsilon,
+                                  max_iterations,
+                                  has_initial_guess,
+                                  normalize,
+                                  do_expensive_check);
 }
 
 // explicit instantiation
@@ -208,7 +513,9 @@ template void katz_centrality(raft::handle_t const &handle,
                               size_t max_iterations,
                               bool has_initial_guess,
                               bool normalize,
-                              bool do_expensive_check);
+                              bool do_expensive_check,
+                              size_t convergence_check_interval,
+                              bool reduced_precision);
 
 template void katz_centrality(raft::handle_t const &handle,
                               graph_view_t<int32_t, int32_t, double, true, true> const &graph_view,
@@ -220,7 +527,9 @@ template void katz_centrality(raft::handle_t const &handle,
                               size_t max_iterations,
                               bool has_initial_guess,
                               bool normalize,
-                              bool do_expensive_check);
+                              bool do_expensive_check,
+                              size_t convergence_check_interval,
+                              bool reduced_precision);
 
 template void katz_centrality(raft::handle_t const &handle,
                               graph_view_t<int32_t, int64_t, float, true, true> const &graph_view,
@@ -232,7 +541,9 @@ template void katz_centrality(raft::handle_t const &handle,
                               size_t max_iterations,
                               bool has_initial_guess,
                               bool normalize,
-                              bool do_expensive_check);
+                              bool do_expensive_check,
+                              size_t convergence_check_interval,
+                              bool reduced_precision);
 
 template void katz_centrality(raft::handle_t const &handle,
                               graph_view_t<int32_t, int64_t, double, true, true> const &graph_view,
@@ -244,7 +555,9 @@ template void katz_centrality(raft::handle_t const &handle,
                               size_t max_iterations,
                               bool has_initial_guess,
                               bool normalize,
-                              bool do_expensive_check);
+                              bool do_expensive_check,
+                              size_t convergence_check_interval,
+                              bool reduced_precision);
 
 template void katz_centrality(raft::handle_t const &handle,
                               graph_view_t<int64_t, int64_t, float, true, true> const &graph_view,
@@ -256,7 +569,9 @@ template void katz_centrality(raft::handle_t const &handle,
                               size_t max_iterations,
                               bool has_initial_guess,
                               bool normalize,
-                              bool do_expensive_check);
+                              bool do_expensive_check,
+                              size_t convergence_check_interval,
+                              bool reduced_precision);
 
 template void katz_centrality(raft::handle_t const &handle,
                               graph_view_t<int64_t, int64_t, double, true, true> const &graph_view,
@@ -268,7 +583,9 @@ template void katz_centrality(raft::handle_t const &handle,
                               size_t max_iterations,
                               bool has_initial_guess,
                               bool normalize,
-                              bool do_expensive_check);
+                              bool do_expensive_check,
+                              size_t convergence_check_interval,
+                              bool reduced_precision);
 
 template void katz_centrality(raft::handle_t const &handle,
                               graph_view_t<int32_t, int32_t, float, true, false> const &graph_view,
@@ -280,7 +597,9 @@ template void katz_centrality(raft::handle_t const &handle,
                               size_t max_iterations,
                               bool has_initial_guess,
                               bool normalize,
-                              bool do_expensive_check);
+                              bool do_expensive_check,
+                              size_t convergence_check_interval,
+                              bool reduced_precision);
 
 template void katz_centrality(raft::handle_t const &handle,
                               graph_view_t<int32_t, int32_t, double, true, false> const &graph_view,
@@ -292,7 +611,9 @@ template void katz_centrality(raft::handle_t const &handle,
                               size_t max_iterations,
                               bool has_initial_guess,
                               bool normalize,
-                              bool do_expensive_check);
+                              bool do_expensive_check,
+                              size_t convergence_check_interval,
+                              bool reduced_precision);
 
 template void katz_centrality(raft::handle_t const &handle,
                               graph_view_t<int32_t, int64_t, float, true, false> const &graph_view,
@@ -304,7 +625,9 @@ template void katz_centrality(raft::handle_t const &handle,
                               size_t max_iterations,
                               bool has_initial_guess,
                               bool normalize,
-                              bool do_expensive_check);
+                              bool do_expensive_check,
+                              size_t convergence_check_interval,
+                              bool reduced_precision);
 
 template void katz_centrality(raft::handle_t const &handle,
                               graph_view_t<int32_t, int64_t, double, true, false> const &graph_view,
@@ -316,7 +639,9 @@ template void katz_centrality(raft::handle_t const &handle,
                               size_t max_iterations,
                               bool has_initial_guess,
                               bool normalize,
-                              bool do_expensive_check);
+                              bool do_expensive_check,
+                              size_t convergence_check_interval,
+                              bool reduced_precision);
 
 template void katz_centrality(raft::handle_t const &handle,
                               graph_view_t<int64_t, int64_t, float, true, false> const &graph_view,
@@ -328,7 +653,9 @@ template void katz_centrality(raft::handle_t const &handle,
                               size_t max_iterations,
                               bool has_initial_guess,
                               bool normalize,
-                              bool do_expensive_check);
+                              bool do_expensive_check,
+                              size_t convergence_check_interval,
+                              bool reduced_precision);
 
 template void katz_centrality(raft::handle_t const &handle,
                               graph_view_t<int64_t, int64_t, double, true, false> const &graph_view,
@@ -340,7 +667,165 @@ template void katz_centrality(raft::handle_t const &handle,
                               size_t max_iterations,
                               bool has_initial_guess,
                               bool normalize,
-                              bool do_expensive_check);
+                              bool do_expensive_check,
+                              size_t convergence_check_interval,
+                              bool reduced_precision);
+
+template void batched_katz_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, float, true, true> const &graph_view,
+  size_t num_variants,
+  float const *alphas,
+  float const *betas,
+  float *katz_centralities,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+
+template void batched_katz_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, double, true, true> const &graph_view,
+  size_t num_variants,
+  double const *alphas,
+  double const *betas,
+  double *katz_centralities,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+
+template void batched_katz_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, float, true, true> const &graph_view,
+  size_t num_variants,
+  float const *alphas,
+  float const *betas,
+  float *katz_centralities,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+
+template void batched_katz_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, double, true, true> const &graph_view,
+  size_t num_variants,
+  double const *alphas,
+  double const *betas,
+  double *katz_centralities,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+
+template void batched_katz_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, float, true, true> const &graph_view,
+  size_t num_variants,
+  float const *alphas,
+  float const *betas,
+  float *katz_centralities,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+
+template void batched_katz_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, double, true, true> const &graph_view,
+  size_t num_variants,
+  double const *alphas,
+  double const *betas,
+  double *katz_centralities,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+
+template void batched_katz_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, float, true, false> const &graph_view,
+  size_t num_variants,
+  float const *alphas,
+  float const *betas,
+  float *katz_centralities,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+
+template void batched_katz_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, double, true, false> const &graph_view,
+  size_t num_variants,
+  double const *alphas,
+  double const *betas,
+  double *katz_centralities,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+
+template void batched_katz_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, float, true, false> const &graph_view,
+  size_t num_variants,
+  float const *alphas,
+  float const *betas,
+  float *katz_centralities,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+
+template void batched_katz_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, double, true, false> const &graph_view,
+  size_t num_variants,
+  double const *alphas,
+  double const *betas,
+  double *katz_centralities,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+
+template void batched_katz_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, float, true, false> const &graph_view,
+  size_t num_variants,
+  float const *alphas,
+  float const *betas,
+  float *katz_centralities,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
+
+template void batched_katz_centrality(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, double, true, false> const &graph_view,
+  size_t num_variants,
+  double const *alphas,
+  double const *betas,
+  double *katz_centralities,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool normalize,
+  bool do_expensive_check);
 
 }  // namespace experimental
 }  // namespace cugraph
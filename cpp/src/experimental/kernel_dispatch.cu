@@ -0,0 +1,374 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <patterns/kernel_dispatch.cuh>
+#include <utilities/error.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+
+namespace {
+
+// number of times every candidate configuration is timed in autotune mode (the minimum is used,
+// the first launch of a kernel may include one-time overheads)
+int32_t constexpr num_autotune_samples{2};
+
+// grid size caps in waves of fully resident blocks per SM, 0 means no cap (one thread, warp, or
+// block per major)
+int32_t constexpr candidate_waves[] = {1, 2, 4, 8, 0};
+
+struct pattern_kernel_choice_t {
+  major_mapping_t mapping{major_mapping_t::thread_per_major};
+  int32_t waves{0};
+};
+
+using tuning_key_t = std::tuple<int32_t, int32_t, int32_t, int32_t, int32_t>;
+
+struct tuning_entry_t {
+  bool recorded{false};
+  pattern_kernel_choice_t choice{};
+
+  // relevant only while autotuning
+  std::vector<pattern_kernel_choice_t> candidates{};
+  std::vector<float> elapsed_times{};  // minimum over the samples in milliseconds
+  size_t num_trials{0};
+  size_t num_reports{0};
+};
+
+struct tuning_state_t {
+  tuning_state_t()
+  {
+    auto autotune_env = std::getenv("CUGRAPH_PATTERN_AUTOTUNE");
+    autotune = (autotune_env != nullptr) && (std::atoi(autotune_env) != 0);
+  }
+
+  std::mutex mutex{};
+  std::map<tuning_key_t, tuning_entry_t> table{};
+  bool autotune{false};
+  bool env_file_loaded{false};
+};
+
+tuning_state_t& get_tuning_state()
+{
+  static tuning_state_t state{};
+  return state;
+}
+
+int32_t floor_log2(size_t x)
+{
+  int32_t ret{0};
+  while (x > 1) {
+    x >>= 1;
+    ++ret;
+  }
+  return ret;
+}
+
+bool is_reduction_pattern(pattern_kernel_t pattern)
+{
+  // these patterns write one partial result per block, capping the grid size also shrinks the
+  // partial result buffer and the follow-up reduction
+  return (pattern == pattern_kernel_t::count_if_e) ||
+         (pattern == pattern_kernel_t::transform_reduce_e);
+}
+
+std::vector<major_mapping_t> get_candidate_mappings(int32_t segment,
+                                                    bool multiple_mappings_supported)
+{
+  if (!multiple_mappings_supported) { return {major_mapping_t::thread_per_major}; }
+  switch (segment) {
+    case 0: return {major_mapping_t::block_per_major, major_mapping_t::warp_per_major};
+    case 1: return {major_mapping_t::warp_per_major, major_mapping_t::block_per_major};
+    case 2: return {major_mapping_t::thread_per_major, major_mapping_t::warp_per_major};
+    default: return {major_mapping_t::thread_per_major, major_mapping_t::warp_per_major};
+  }
+}
+
+// segment 0 holds the high-degree majors (degree >= detail::mid_degree_threshold), segment 1
+// the mid-degree majors, and segment 2 the low-degree majors
+pattern_kernel_choice_t get_default_choice(pattern_kernel_t pattern,
+                                           int32_t segment,
+                                           bool multiple_mappings_supported)
+{
+  pattern_kernel_choice_t ret{};
+  ret.mapping = get_candidate_mappings(segment, multiple_mappings_supported)[0];
+  ret.waves   = is_reduction_pattern(pattern) ? int32_t{2} : int32_t{0};
+  return ret;
+}
+
+int32_t compute_num_blocks(raft::handle_t const& handle,
+                           pattern_kernel_choice_t choice,
+                           int32_t block_size,
+                           size_t num_majors)
+{
+  auto const& props  = handle.get_device_properties();
+  auto major_threads = choice.mapping == major_mapping_t::thread_per_major
+                         ? size_t{1}
+                         : (choice.mapping == major_mapping_t::warp_per_major
+                              ? static_cast<size_t>(raft::warp_size())
+                              : static_cast<size_t>(block_size));
+  auto num_blocks = (num_majors * major_threads + block_size - 1) / block_size;
+  if (choice.waves > 0) {
+    auto blocks_per_sm = std::max(props.maxThreadsPerMultiProcessor / block_size, int32_t{1});
+    num_blocks = std::min(num_blocks,
+                          static_cast<size_t>(props.multiProcessorCount) * blocks_per_sm *
+                            static_cast<size_t>(choice.waves));
+  }
+  num_blocks = std::min(num_blocks, static_cast<size_t>(props.maxGridSize[0]));
+  return static_cast<int32_t>(std::max(num_blocks, size_t{1}));
+}
+
+void load_tuning_table(tuning_state_t& state, std::string const& path)
+{
+  std::ifstream file(path);
+  CUGRAPH_EXPECTS(file.is_open(), "Could not open the pattern kernel tuning table file.");
+
+  std::string line{};
+  while (std::getline(file, line)) {
+    if (line.empty() || (line[0] == '#')) { continue; }
+    std::istringstream iss(line);
+    int32_t pattern{}, arch{}, segment{}, size_bucket{}, degree_bucket{}, mapping{}, waves{};
+    CUGRAPH_EXPECTS(
+      static_cast<bool>(iss >> pattern >> arch >> segment >> size_bucket >> degree_bucket >>
+                        mapping >> waves),
+      "Invalid input argument: malformed pattern kernel tuning table entry.");
+    CUGRAPH_EXPECTS(
+      (pattern >= 0) &&
+        (pattern < static_cast<int32_t>(pattern_kernel_t::num_pattern_kernels)) &&
+        (mapping >= static_cast<int32_t>(major_mapping_t::thread_per_major)) &&
+        (mapping <= static_cast<int32_t>(major_mapping_t::block_per_major)) && (waves >= 0),
+      "Invalid input argument: pattern kernel tuning table entry out of range.");
+
+    auto key             = tuning_key_t{pattern, arch, segment, size_bucket, degree_bucket};
+    auto& entry          = state.table[key];
+    entry                = tuning_entry_t{};
+    entry.recorded       = true;
+    entry.choice.mapping = static_cast<major_mapping_t>(mapping);
+    entry.choice.waves   = waves;
+  }
+}
+
+}  // namespace
+
+void set_pattern_kernel_autotune(bool enable)
+{
+  auto& state = get_tuning_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.autotune = enable;
+}
+
+bool is_pattern_kernel_autotune_enabled()
+{
+  auto& state = get_tuning_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.autotune;
+}
+
+void load_pattern_kernel_tuning_table(std::string const& path)
+{
+  auto& state = get_tuning_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  load_tuning_table(state, path);
+}
+
+void save_pattern_kernel_tuning_table(std::string const& path)
+{
+  auto& state = get_tuning_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  std::ofstream file(path);
+  CUGRAPH_EXPECTS(file.is_open(), "Could not open the pattern kernel tuning table file.");
+  file << "# pattern arch segment log2_num_majors log2_average_degree mapping waves\n";
+  for (auto const& kv : state.table) {
+    if (!kv.second.recorded) { continue; }
+    file << std::get<0>(kv.first) << " " << std::get<1>(kv.first) << " " << std::get<2>(kv.first)
+         << " " << std::get<3>(kv.first) << " " << std::get<4>(kv.first) << " "
+         << static_cast<int32_t>(kv.second.choice.mapping) << " " << kv.second.choice.waves
+         << "\n";
+  }
+  CUGRAPH_EXPECTS(file.good(), "Failed to write the pattern kernel tuning table file.");
+}
+
+void clear_pattern_kernel_tuning_table()
+{
+  auto& state = get_tuning_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.table.clear();
+}
+
+namespace detail {
+
+std::vector<pattern_kernel_launch_t> get_pattern_kernel_launches(
+  raft::handle_t const& handle,
+  pattern_kernel_t pattern,
+  int32_t block_size,
+  size_t major_range_size,
+  size_t num_edges,
+  std::vector<size_t> const& segment_offsets,
+  bool multiple_mappings_supported)
+{
+  CUGRAPH_EXPECTS((block_size > 0) && (block_size % raft::warp_size() == 0),
+                  "Invalid input argument: block_size should be a multiple of the warp size.");
+  CUGRAPH_EXPECTS(segment_offsets.empty() || ((segment_offsets.size() >= 2) &&
+                                              (segment_offsets.front() == 0) &&
+                                              (segment_offsets.back() == major_range_size)),
+                  "Invalid input argument: segment_offsets should cover the major range.");
+
+  auto& state = get_tuning_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  if (!state.env_file_loaded) {
+    state.env_file_loaded = true;
+    auto path             = std::getenv("CUGRAPH_PATTERN_TUNING_FILE");
+    if (path != nullptr) { load_tuning_table(state, std::string(path)); }
+  }
+
+  auto const& props = handle.get_device_properties();
+  auto arch         = props.major * 10 + props.minor;
+  auto degree_bucket =
+    major_range_size > 0 ? floor_log2(std::max(num_edges / major_range_size, size_t{1})) : 0;
+
+  auto ranges =
+    segment_offsets.empty() ? std::vector<size_t>{0, major_range_size} : segment_offsets;
+
+  std::vector<pattern_kernel_launch_t> ret{};
+  for (size_t i = 0; i + 1 < ranges.size(); ++i) {
+    if (ranges[i + 1] <= ranges[i]) { continue; }
+
+    pattern_kernel_launch_t launch{};
+    launch.major_range_first = ranges[i];
+    launch.major_range_last  = ranges[i + 1];
+    launch.block_size        = block_size;
+    launch.pattern           = pattern;
+    launch.arch              = arch;
+    launch.segment =
+      segment_offsets.empty() ? unsegmented_major_range : static_cast<int32_t>(i);
+    launch.size_bucket   = floor_log2(ranges[i + 1] - ranges[i]);
+    launch.degree_bucket = degree_bucket;
+
+    auto key = tuning_key_t{static_cast<int32_t>(pattern),
+                            arch,
+                            launch.segment,
+                            launch.size_bucket,
+                            launch.degree_bucket};
+    auto it  = state.table.find(key);
+
+    auto choice = get_default_choice(pattern, launch.segment, multiple_mappings_supported);
+    if ((it != state.table.end()) && it->second.recorded) {
+      choice = it->second.choice;
+      // a table recorded for a pattern with multiple kernels may not apply to a call without
+      if (!multiple_mappings_supported) { choice.mapping = major_mapping_t::thread_per_major; }
+    } else if (state.autotune) {
+      auto& entry = state.table[key];
+      if (entry.candidates.empty()) {
+        for (auto mapping : get_candidate_mappings(launch.segment, multiple_mappings_supported)) {
+          for (auto waves : candidate_waves) {
+            entry.candidates.push_back(pattern_kernel_choice_t{mapping, waves});
+          }
+        }
+        entry.elapsed_times.assign(entry.candidates.size(), std::numeric_limits<float>::max());
+      }
+      if (entry.num_trials < entry.candidates.size() * num_autotune_samples) {
+        launch.candidate_idx = static_cast<int32_t>(entry.num_trials % entry.candidates.size());
+        choice               = entry.candidates[launch.candidate_idx];
+        ++entry.num_trials;
+      }
+    }
+
+    launch.mapping    = choice.mapping;
+    launch.num_blocks = compute_num_blocks(handle, choice, block_size, ranges[i + 1] - ranges[i]);
+    ret.push_back(launch);
+  }
+
+  return ret;
+}
+
+pattern_kernel_timer_t::pattern_kernel_timer_t(raft::handle_t const& handle,
+                                               pattern_kernel_launch_t const& launch)
+  : stream_(handle.get_stream()), launch_(launch), timing_(launch.candidate_idx >= 0)
+{
+  if (timing_) {
+    CUDA_TRY(cudaEventCreate(&start_));
+    CUDA_TRY(cudaEventCreate(&stop_));
+    CUDA_TRY(cudaEventRecord(start_, stream_));
+  }
+}
+
+pattern_kernel_timer_t::~pattern_kernel_timer_t()
+{
+  if (timing_) {
+    cudaEventDestroy(start_);
+    cudaEventDestroy(stop_);
+  }
+}
+
+void pattern_kernel_timer_t::stop()
+{
+  if (!timing_) { return; }
+
+  CUDA_TRY(cudaEventRecord(stop_, stream_));
+  CUDA_TRY(cudaEventSynchronize(stop_));
+  float elapsed{0.0};
+  CUDA_TRY(cudaEventElapsedTime(&elapsed, start_, stop_));
+  CUDA_TRY(cudaEventDestroy(start_));
+  CUDA_TRY(cudaEventDestroy(stop_));
+  timing_ = false;
+
+  auto& state = get_tuning_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  auto it = state.table.find(tuning_key_t{static_cast<int32_t>(launch_.pattern),
+                                          launch_.arch,
+                                          launch_.segment,
+                                          launch_.size_bucket,
+                                          launch_.degree_bucket});
+  if ((it == state.table.end()) || it->second.recorded ||
+      (static_cast<size_t>(launch_.candidate_idx) >= it->second.candidates.size())) {
+    return;  // the table was cleared or loaded while this launch was in flight
+  }
+
+  auto& entry = it->second;
+  entry.elapsed_times[launch_.candidate_idx] =
+    std::min(entry.elapsed_times[launch_.candidate_idx], elapsed);
+  ++entry.num_reports;
+  if (entry.num_reports >= entry.candidates.size() * num_autotune_samples) {
+    auto best = std::distance(
+      entry.elapsed_times.begin(),
+      std::min_element(entry.elapsed_times.begin(), entry.elapsed_times.end()));
+    entry.choice   = entry.candidates[best];
+    entry.recorded = true;
+    entry.candidates.clear();
+    entry.elapsed_times.clear();
+  }
+}
+
+}  // namespace detail
+
+}  // namespace experimental
+}  // namespace cugraph
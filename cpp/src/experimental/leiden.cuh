@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <experimental/louvain.cuh>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/sort.h>
+#include <thrust/unique.h>
+
+namespace cugraph {
+namespace experimental {
+
+// a vertex can move only to a neighbor cluster with the same constraint (the clustering from
+// Louvain's local moving phase), so every refined cluster stays a subset of a single community and
+// the constraint of a refined cluster is the constraint of the vertex used as the cluster ID
+template <typename vertex_t>
+struct leiden_move_constraint_t {
+  vertex_t const *cluster_first{nullptr};  // sorted neighbor clusters, nullptr to directly index
+  vertex_t const *cluster_constraint_first{nullptr};
+  vertex_t num_clusters{0};
+
+  __device__ bool operator()(vertex_t src_constraint, vertex_t cluster) const
+  {
+    auto offset = cluster;
+    if (cluster_first != nullptr) {
+      offset = static_cast<vertex_t>(thrust::distance(
+        cluster_first,
+        thrust::lower_bound(thrust::seq, cluster_first, cluster_first + num_clusters, cluster)));
+    }
+    return *(cluster_constraint_first + offset) == src_constraint;
+  }
+};
+
+template <typename graph_view_type>
+class Leiden : public Louvain<graph_view_type> {
+ public:
+  using graph_view_t = graph_view_type;
+  using vertex_t     = typename graph_view_t::vertex_type;
+  using edge_t       = typename graph_view_t::edge_type;
+  using weight_t     = typename graph_view_t::weight_type;
+
+  Leiden(raft::handle_t const &handle,
+         graph_view_t const &graph_view,
+         bool use_vertex_coloring = false)
+    : Louvain<graph_view_t>(handle, graph_view, use_vertex_coloring),
+      constraint_v_(0, handle.get_stream()),
+      src_constraint_cache_v_(0, handle.get_stream()),
+      constraint_keys_v_(0, handle.get_stream()),
+      constraint_values_v_(0, handle.get_stream())
+  {
+  }
+
+  weight_t operator()(size_t max_level, weight_t resolution) override
+  {
+    weight_t best_modularity = weight_t{-1};
+
+    weight_t total_edge_weight = experimental::transform_reduce_e(
+      this->handle_,
+      this->current_graph_view_,
+      thrust::make_constant_iterator(0),
+      thrust::make_constant_iterator(0),
+      [] __device__(auto src, auto dst, weight_t wt, auto, auto) { return wt; },
+      weight_t{0});
+
+    while (this->dendrogram_->num_levels() < max_level) {
+      //
+      //  Initialize every cluster to reference each vertex to itself
+      //
+      this->initialize_dendrogram_level(this->current_graph_view_.get_number_of_local_vertices());
+
+      this->compute_vertex_and_cluster_weights();
+
+      this->update_clustering(total_edge_weight, resolution);
+
+      weight_t new_Q = update_clustering_constrained(total_edge_weight, resolution);
+
+      if (new_Q <= best_modularity) { break; }
+
+      best_modularity = new_Q;
+
+      this->shrink_graph();
+    }
+
+    this->timer_display(std::cout);
+
+    return best_modularity;
+  }
+
+  // refinement phase, restart from singleton clusters and merge vertices only within the
+  // communities found by update_clustering()
+  weight_t update_clustering_constrained(weight_t total_edge_weight, weight_t resolution)
+  {
+    this->timer_start("update_clustering_constrained");
+
+    auto &handle = this->handle_;
+
+    constraint_v_.resize(this->dendrogram_->current_level_size(), handle.get_stream());
+    raft::copy(constraint_v_.begin(),
+               this->dendrogram_->current_level_begin(),
+               this->dendrogram_->current_level_size(),
+               handle.get_stream());
+    auto d_src_constraint_cache =
+      this->cache_src_vertex_properties(constraint_v_, src_constraint_cache_v_);
+
+    if (graph_view_t::is_multi_gpu) {
+      // (vertex, constraint) pairs are distributed the same way as (cluster, cluster weight)
+      // pairs, to look up the constraints of the refined clusters (named by their seed vertices)
+
+      auto const comm_size = handle.get_comms().get_size();
+
+      rmm::device_uvector<vertex_t> tx_keys_v(constraint_v_.size(), handle.get_stream());
+      thrust::sequence(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                       tx_keys_v.begin(),
+                       tx_keys_v.end(),
+                       this->current_graph_view_.get_local_vertex_first());
+
+      auto pair_first =
+        thrust::make_zip_iterator(thrust::make_tuple(tx_keys_v.begin(), constraint_v_.begin()));
+
+      std::forward_as_tuple(std::tie(constraint_keys_v_, constraint_values_v_), std::ignore) =
+        groupby_gpuid_and_shuffle_values(
+          handle.get_comms(),
+          pair_first,
+          pair_first + constraint_v_.size(),
+          [key_func =
+             cugraph::experimental::detail::compute_gpu_id_from_vertex_t<vertex_t>{
+               comm_size}] __device__(auto val) { return key_func(thrust::get<0>(val)); },
+          handle.get_stream());
+    }
+
+    thrust::sequence(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     this->dendrogram_->current_level_begin(),
+                     this->dendrogram_->current_level_end(),
+                     this->current_graph_view_.get_local_vertex_first());
+
+    // FIXME: this re-computes vertex weights (unchanged since update_clustering()) as well
+    this->compute_vertex_and_cluster_weights();
+
+    rmm::device_uvector<vertex_t> next_cluster_v(this->dendrogram_->current_level_size(),
+                                                 handle.get_stream());
+
+    raft::copy(next_cluster_v.begin(),
+               this->dendrogram_->current_level_begin(),
+               this->dendrogram_->current_level_size(),
+               handle.get_stream());
+
+    this->d_src_cluster_cache_ =
+      this->cache_src_vertex_properties(next_cluster_v, this->src_cluster_cache_v_);
+    this->d_dst_cluster_cache_ =
+      this->cache_dst_vertex_properties(next_cluster_v, this->dst_cluster_cache_v_);
+
+    weight_t new_Q = this->modularity(total_edge_weight, resolution);
+    weight_t cur_Q = new_Q - 1;
+
+    // To avoid the potential of having two vertices swap clusters
+    // we will only allow vertices to move up (true) or down (false)
+    // during each iteration of the loop
+    bool up_down = true;
+
+    rmm::device_uvector<vertex_t> neighbor_clusters_v(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> neighbor_cluster_constraints_v(0, handle.get_stream());
+
+    while (new_Q > (cur_Q + 0.0001)) {
+      cur_Q = new_Q;
+
+      leiden_move_constraint_t<vertex_t> move_constraint_op{nullptr, constraint_v_.data(), 0};
+      if (graph_view_t::is_multi_gpu) {
+        neighbor_clusters_v.resize(this->dst_cluster_cache_v_.size(), handle.get_stream());
+        thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     this->dst_cluster_cache_v_.begin(),
+                     this->dst_cluster_cache_v_.end(),
+                     neighbor_clusters_v.begin());
+        thrust::sort(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     neighbor_clusters_v.begin(),
+                     neighbor_clusters_v.end());
+        neighbor_clusters_v.resize(
+          thrust::distance(
+            neighbor_clusters_v.begin(),
+            thrust::unique(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                           neighbor_clusters_v.begin(),
+                           neighbor_clusters_v.end())),
+          handle.get_stream());
+        neighbor_clusters_v.shrink_to_fit(handle.get_stream());
+
+        neighbor_cluster_constraints_v = collect_values_for_unique_keys(
+          handle.get_comms(),
+          constraint_keys_v_.begin(),
+          constraint_keys_v_.end(),
+          constraint_values_v_.data(),
+          neighbor_clusters_v.begin(),
+          neighbor_clusters_v.end(),
+          cugraph::experimental::detail::compute_gpu_id_from_vertex_t<vertex_t>{
+            handle.get_comms().get_size()},
+          handle.get_stream());
+
+        move_constraint_op =
+          leiden_move_constraint_t<vertex_t>{neighbor_clusters_v.data(),
+                                             neighbor_cluster_constraints_v.data(),
+                                             static_cast<vertex_t>(neighbor_clusters_v.size())};
+      }
+
+      this->update_by_delta_modularity(total_edge_weight,
+                                       resolution,
+                                       next_cluster_v,
+                                       up_down,
+                                       d_src_constraint_cache,
+                                       move_constraint_op);
+
+      up_down = !up_down;
+
+      new_Q = this->modularity(total_edge_weight, resolution);
+
+      if (new_Q > cur_Q) {
+        raft::copy(this->dendrogram_->current_level_begin(),
+                   next_cluster_v.begin(),
+                   next_cluster_v.size(),
+                   handle.get_stream());
+      }
+    }
+
+    this->timer_stop(handle.get_stream());
+    return cur_Q;
+  }
+
+ private:
+  rmm::device_uvector<vertex_t> constraint_v_;
+  rmm::device_uvector<vertex_t> src_constraint_cache_v_;
+
+  // (vertex, constraint) pairs shuffled with compute_gpu_id_from_vertex_t (multi-GPU only)
+  rmm::device_uvector<vertex_t> constraint_keys_v_;
+  rmm::device_uvector<vertex_t> constraint_values_v_;
+};
+
+}  // namespace experimental
+}  // namespace cugraph
@@ -19,6 +19,7 @@
 
 #include <experimental/graph.hpp>
 #include <experimental/graph_functions.hpp>
+#include <experimental/vertex_coloring.cuh>
 
 #include <patterns/copy_to_adj_matrix_row_col.cuh>
 #include <patterns/copy_v_transform_reduce_in_out_nbr.cuh>
@@ -40,6 +41,33 @@
 namespace cugraph {
 namespace experimental {
 
+struct no_move_constraint_t {
+  template <typename vertex_t>
+  __device__ bool operator()(vertex_t, vertex_t) const
+  {
+    return true;
+  }
+};
+
+// select the (cluster, delta modularity) pair with the larger delta modularity (ties are broken by
+// the smaller cluster ID); this is a pure function, so partial results can be reduced in any
+// process
+template <typename vertex_t, typename weight_t>
+struct max_delta_modularity_t {
+  using type                          = thrust::tuple<vertex_t, weight_t>;
+  static constexpr bool pure_function = true;
+
+  __device__ type operator()(type const &p1, type const &p2) const
+  {
+    auto id1 = thrust::get<0>(p1);
+    auto id2 = thrust::get<0>(p2);
+    auto wt1 = thrust::get<1>(p1);
+    auto wt2 = thrust::get<1>(p2);
+
+    return (wt1 < wt2) ? p2 : ((wt1 > wt2) ? p1 : ((id1 < id2) ? p1 : p2));
+  }
+};
+
 template <typename graph_view_type>
 class Louvain {
  public:
@@ -53,7 +81,16 @@ class Louvain {
                                         graph_view_t::is_adj_matrix_transposed,
                                         graph_view_t::is_multi_gpu>;
 
-  Louvain(raft::handle_t const &handle, graph_view_t const &graph_view)
+  // if memory_bounded is true, the dendrogram keeps only the clustering composed up to the current
+  // level (the first level, in the input graph's vertex ID space, mapping each input vertex to its
+  // cluster in the current level's graph) and the current level; the other levels are composed
+  // into it and freed as the algorithm proceeds (the resulting dendrogram has a single level
+  // holding the final clustering, see get_num_levels() for the number of levels run), and the
+  // per-level work buffers are freed before coarsening the graph
+  Louvain(raft::handle_t const &handle,
+          graph_view_t const &graph_view,
+          bool use_vertex_coloring = false,
+          bool memory_bounded      = false)
     :
 #ifdef TIMING
       hr_timer_(),
@@ -61,6 +98,8 @@ class Louvain {
       handle_(handle),
       dendrogram_(std::make_unique<Dendrogram<vertex_t>>()),
       current_graph_view_(graph_view),
+      use_vertex_coloring_(use_vertex_coloring),
+      memory_bounded_(memory_bounded),
       cluster_keys_v_(graph_view.get_number_of_local_vertices(), handle.get_stream()),
       cluster_weights_v_(graph_view.get_number_of_local_vertices(), handle.get_stream()),
       vertex_weights_v_(graph_view.get_number_of_local_vertices(), handle.get_stream()),
@@ -76,6 +115,9 @@ class Louvain {
 
   std::unique_ptr<Dendrogram<vertex_t>> move_dendrogram() { return std::move(dendrogram_); }
 
+  // number of levels run (differs from the number of dendrogram levels if memory_bounded is true)
+  size_t get_num_levels() const { return num_levels_; }
+
   virtual weight_t operator()(size_t max_level, weight_t resolution)
   {
     weight_t best_modularity = weight_t{-1};
@@ -88,21 +130,28 @@ class Louvain {
       [] __device__(auto src, auto dst, weight_t wt, auto, auto) { return wt; },
       weight_t{0});
 
-    while (dendrogram_->num_levels() < max_level) {
+    while (num_levels_ < max_level) {
       //
       //  Initialize every cluster to reference each vertex to itself
       //
       initialize_dendrogram_level(current_graph_view_.get_number_of_local_vertices());
+      ++num_levels_;
 
       compute_vertex_and_cluster_weights();
 
       weight_t new_Q = update_clustering(total_edge_weight, resolution);
 
-      if (new_Q <= best_modularity) { break; }
+      bool improved = new_Q > best_modularity;
+      if (improved) {
+        best_modularity = new_Q;
 
-      best_modularity = new_Q;
+        // the coarsened graph is not used once we reach max_level
+        if (num_levels_ < max_level) { shrink_graph(); }
+      }
 
-      shrink_graph();
+      if (memory_bounded_) { compose_dendrogram_level(); }
+
+      if (!improved) { break; }
     }
 
     timer_display(std::cout);
@@ -149,7 +198,7 @@ class Louvain {
   }
 
  protected:
-  void initialize_dendrogram_level(vertex_t num_vertices)
+  virtual void initialize_dendrogram_level(vertex_t num_vertices)
   {
     dendrogram_->add_level(
       current_graph_view_.get_local_vertex_first(), num_vertices, handle_.get_stream());
@@ -200,12 +249,22 @@ class Louvain {
   {
     timer_start("compute_vertex_and_cluster_weights");
 
-    vertex_weights_v_ = current_graph_view_.compute_out_weight_sums(handle_);
+    // the weight sums of the input graph are cached in the graph (and reused by later calls)
+    vertex_weights_v_.resize(current_graph_view_.get_number_of_local_vertices(),
+                             handle_.get_stream());
+    raft::copy(vertex_weights_v_.begin(),
+               current_graph_view_.get_out_weight_sums(handle_),
+               vertex_weights_v_.size(),
+               handle_.get_stream());
 
-    thrust::sequence(rmm::exec_policy(handle_.get_stream())->on(handle_.get_stream()),
-                     cluster_keys_v_.begin(),
-                     cluster_keys_v_.end(),
-                     current_graph_view_.get_local_vertex_first());
+    // the initial clusters are singletons but the cluster IDs are not necessarily the vertex IDs
+    // (e.g. ECG starts from permuted cluster IDs)
+    cluster_keys_v_.resize(dendrogram_->current_level_size(), handle_.get_stream());
+    cluster_weights_v_.resize(vertex_weights_v_.size(), handle_.get_stream());
+    raft::copy(cluster_keys_v_.begin(),
+               dendrogram_->current_level_begin(),
+               dendrogram_->current_level_size(),
+               handle_.get_stream());
 
     raft::copy(cluster_weights_v_.begin(),
                vertex_weights_v_.begin(),
@@ -284,17 +343,36 @@ class Louvain {
     weight_t new_Q = modularity(total_edge_weight, resolution);
     weight_t cur_Q = new_Q - 1;
 
-    // To avoid the potential of having two vertices swap clusters
-    // we will only allow vertices to move up (true) or down (false)
-    // during each iteration of the loop
+    // With vertex coloring, the vertices of each color class move in a separate sub-step (no two
+    // neighbors move simultaneously). Otherwise, to avoid the potential of having two vertices
+    // swap clusters we will only allow vertices to move up (true) or down (false) during each
+    // iteration of the loop
+    rmm::device_uvector<vertex_t> vertex_colors_v(0, handle_.get_stream());
+    vertex_t num_colors{0};
+    if (use_vertex_coloring_) {
+      std::tie(vertex_colors_v, num_colors) = vertex_coloring(handle_, current_graph_view_);
+    }
     bool up_down = true;
 
     while (new_Q > (cur_Q + 0.0001)) {
       cur_Q = new_Q;
 
-      update_by_delta_modularity(total_edge_weight, resolution, next_cluster_v, up_down);
+      if (use_vertex_coloring_) {
+        for (vertex_t color = 0; color < num_colors; ++color) {
+          update_by_delta_modularity(total_edge_weight,
+                                     resolution,
+                                     next_cluster_v,
+                                     up_down,
+                                     thrust::make_constant_iterator(vertex_t{0}) /* dummy */,
+                                     no_move_constraint_t{},
+                                     vertex_colors_v.data(),
+                                     color);
+        }
+      } else {
+        update_by_delta_modularity(total_edge_weight, resolution, next_cluster_v, up_down);
 
-      up_down = !up_down;
+        up_down = !up_down;
+      }
 
       new_Q = modularity(total_edge_weight, resolution);
 
@@ -363,6 +441,28 @@ class Louvain {
                                   rmm::device_uvector<vertex_t> &next_cluster_v,
                                   bool up_down)
   {
+    update_by_delta_modularity(total_edge_weight,
+                               resolution,
+                               next_cluster_v,
+                               up_down,
+                               thrust::make_constant_iterator(vertex_t{0}) /* dummy */,
+                               no_move_constraint_t{});
+  }
+
+  // move_constraint_op(src_constraint, neighbor_cluster) returns false if the source vertex should
+  // not move to the neighbor cluster (the source vertex constraint values are read from
+  // src_constraint_first, which should be indexed by adjacency matrix row offsets). If
+  // vertex_colors is not nullptr, only the vertices of the given color move (up_down is ignored).
+  template <typename SrcConstraintIterator, typename MoveConstraintOp>
+  void update_by_delta_modularity(weight_t total_edge_weight,
+                                  weight_t resolution,
+                                  rmm::device_uvector<vertex_t> &next_cluster_v,
+                                  bool up_down,
+                                  SrcConstraintIterator src_constraint_first,
+                                  MoveConstraintOp move_constraint_op,
+                                  vertex_t const *vertex_colors = nullptr,
+                                  vertex_t color                = vertex_t{0})
+  {
 #ifdef CUCO_STATIC_MAP_DEFINED
     rmm::device_uvector<weight_t> old_cluster_sum_v(
       current_graph_view_.get_number_of_local_vertices(), handle_.get_stream());
@@ -437,19 +537,25 @@ class Louvain {
                                                    d_src_vertex_weights_cache_,
                                                    src_cluster_subtract_v.begin(),
                                                    d_src_cluster_cache_,
-                                                   src_cluster_weights_v.begin())),
+                                                   src_cluster_weights_v.begin(),
+                                                   src_constraint_first)),
 
       d_dst_cluster_cache_,
       map_key_first,
       map_key_last,
       map_value_first,
-      [total_edge_weight, resolution] __device__(
+      [total_edge_weight, resolution, move_constraint_op] __device__(
         auto src, auto neighbor_cluster, auto new_cluster_sum, auto src_info, auto a_new) {
         auto old_cluster_sum  = thrust::get<0>(src_info);
         auto k_k              = thrust::get<1>(src_info);
         auto cluster_subtract = thrust::get<2>(src_info);
         auto src_cluster      = thrust::get<3>(src_info);
         auto a_old            = thrust::get<4>(src_info);
+        auto src_constraint   = thrust::get<5>(src_info);
+
+        if (!move_constraint_op(src_constraint, neighbor_cluster)) {
+          return thrust::make_tuple(neighbor_cluster, weight_t{0});
+        }
 
         if (src_cluster == neighbor_cluster) new_cluster_sum -= cluster_subtract;
 
@@ -459,33 +565,46 @@ class Louvain {
 
         return thrust::make_tuple(neighbor_cluster, delta_modularity);
       },
-      [] __device__(auto p1, auto p2) {
-        auto id1 = thrust::get<0>(p1);
-        auto id2 = thrust::get<0>(p2);
-        auto wt1 = thrust::get<1>(p1);
-        auto wt2 = thrust::get<1>(p2);
-
-        return (wt1 < wt2) ? p2 : ((wt1 > wt2) ? p1 : ((id1 < id2) ? p1 : p2));
-      },
+      max_delta_modularity_t<vertex_t, weight_t>{},
       thrust::make_tuple(vertex_t{-1}, weight_t{0}),
       cugraph::experimental::get_dataframe_buffer_begin<thrust::tuple<vertex_t, weight_t>>(
         output_buffer));
 
-    thrust::transform(
-      rmm::exec_policy(handle_.get_stream())->on(handle_.get_stream()),
-      next_cluster_v.begin(),
-      next_cluster_v.end(),
-      cugraph::experimental::get_dataframe_buffer_begin<thrust::tuple<vertex_t, weight_t>>(
-        output_buffer),
-      next_cluster_v.begin(),
-      [up_down] __device__(vertex_t old_cluster, auto p) {
-        vertex_t new_cluster      = thrust::get<0>(p);
-        weight_t delta_modularity = thrust::get<1>(p);
-
-        return (delta_modularity > weight_t{0})
-                 ? (((new_cluster > old_cluster) != up_down) ? old_cluster : new_cluster)
-                 : old_cluster;
-      });
+    if (vertex_colors != nullptr) {
+      thrust::transform(
+        rmm::exec_policy(handle_.get_stream())->on(handle_.get_stream()),
+        thrust::make_zip_iterator(thrust::make_tuple(next_cluster_v.begin(), vertex_colors)),
+        thrust::make_zip_iterator(
+          thrust::make_tuple(next_cluster_v.end(), vertex_colors + next_cluster_v.size())),
+        cugraph::experimental::get_dataframe_buffer_begin<thrust::tuple<vertex_t, weight_t>>(
+          output_buffer),
+        next_cluster_v.begin(),
+        [color] __device__(auto cluster_color, auto p) {
+          vertex_t old_cluster      = thrust::get<0>(cluster_color);
+          vertex_t new_cluster      = thrust::get<0>(p);
+          weight_t delta_modularity = thrust::get<1>(p);
+
+          return ((thrust::get<1>(cluster_color) == color) && (delta_modularity > weight_t{0}))
+                   ? new_cluster
+                   : old_cluster;
+        });
+    } else {
+      thrust::transform(
+        rmm::exec_policy(handle_.get_stream())->on(handle_.get_stream()),
+        next_cluster_v.begin(),
+        next_cluster_v.end(),
+        cugraph::experimental::get_dataframe_buffer_begin<thrust::tuple<vertex_t, weight_t>>(
+          output_buffer),
+        next_cluster_v.begin(),
+        [up_down] __device__(vertex_t old_cluster, auto p) {
+          vertex_t new_cluster      = thrust::get<0>(p);
+          weight_t delta_modularity = thrust::get<1>(p);
+
+          return (delta_modularity > weight_t{0})
+                   ? (((new_cluster > old_cluster) != up_down) ? old_cluster : new_cluster)
+                   : old_cluster;
+        });
+    }
 
     d_src_cluster_cache_ = cache_src_vertex_properties(next_cluster_v, src_cluster_cache_v_);
     d_dst_cluster_cache_ = cache_dst_vertex_properties(next_cluster_v, dst_cluster_cache_v_);
@@ -506,6 +625,11 @@ class Louvain {
   {
     timer_start("shrinking graph");
 
+    if (memory_bounded_) {
+      // recomputed for the coarsened graph in the next level, free to lower the coarsening peak
+      release_level_buffers();
+    }
+
     rmm::device_uvector<vertex_t> numbering_map(0, handle_.get_stream());
 
     std::tie(current_graph_, numbering_map) =
@@ -530,6 +654,53 @@ class Louvain {
     timer_stop(handle_.get_stream());
   }
 
+  // compose the current level's clustering into the first level (the clustering composed so far)
+  // and free the current level
+  void compose_dendrogram_level()
+  {
+    if (dendrogram_->num_levels() < 2) { return; }
+
+    timer_start("composing dendrogram level");
+
+    auto level = dendrogram_->current_level();
+    rmm::device_uvector<vertex_t> level_vertex_ids(dendrogram_->get_level_size_nocheck(level),
+                                                   handle_.get_stream());
+    thrust::sequence(rmm::exec_policy(handle_.get_stream())->on(handle_.get_stream()),
+                     level_vertex_ids.begin(),
+                     level_vertex_ids.end(),
+                     dendrogram_->get_level_first_index_nocheck(level));
+
+    relabel<vertex_t, graph_view_t::is_multi_gpu>(
+      handle_,
+      std::make_tuple(static_cast<vertex_t const *>(level_vertex_ids.data()),
+                      static_cast<vertex_t const *>(dendrogram_->get_level_ptr_nocheck(level))),
+      static_cast<vertex_t>(level_vertex_ids.size()),
+      dendrogram_->get_level_ptr_nocheck(0),
+      static_cast<vertex_t>(dendrogram_->get_level_size_nocheck(0)));
+
+    dendrogram_->pop_level();
+
+    timer_stop(handle_.get_stream());
+  }
+
+  void release_level_buffers()
+  {
+    auto release = [this](auto &v) {
+      v.resize(0, handle_.get_stream());
+      v.shrink_to_fit(handle_.get_stream());
+    };
+    release(vertex_weights_v_);
+    release(src_vertex_weights_cache_v_);
+    release(src_cluster_cache_v_);
+    release(dst_cluster_cache_v_);
+    release(cluster_keys_v_);
+    release(cluster_weights_v_);
+
+    d_src_vertex_weights_cache_ = nullptr;
+    d_src_cluster_cache_        = nullptr;
+    d_dst_cluster_cache_        = nullptr;
+  }
+
  protected:
   raft::handle_t const &handle_;
 
@@ -543,6 +714,12 @@ class Louvain {
   std::unique_ptr<graph_t> current_graph_{};
   graph_view_t current_graph_view_;
 
+  // move one color class (an independent set) at a time instead of moving every vertex at once
+  bool use_vertex_coloring_{false};
+
+  bool memory_bounded_{false};
+  size_t num_levels_{0};
+
   rmm::device_uvector<weight_t> vertex_weights_v_;
   rmm::device_uvector<weight_t> src_vertex_weights_cache_v_;
   rmm::device_uvector<vertex_t> src_cluster_cache_v_;
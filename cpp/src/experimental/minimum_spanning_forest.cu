@@ -0,0 +1,642 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithms.hpp>
+#include <experimental/detail/graph_utils.cuh>
+#include <experimental/graph_view.hpp>
+#include <matrix_partition_device.cuh>
+#include <partition_manager.hpp>
+#include <patterns/copy_to_adj_matrix_row_col.cuh>
+#include <utilities/collect_comm.cuh>
+#include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+#include <utilities/shuffle_comm.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+namespace detail {
+
+// FIXME: block size requires tuning
+int32_t constexpr minimum_spanning_forest_block_size = 512;
+
+// Edges are totally ordered by (weight, smaller end point, larger end point), so ties in weights do
+// not create cycles; candidates are (weight, smaller end point, larger end point, target label)
+// tuples and the reduction keeps the smallest edge.
+template <typename vertex_t, typename weight_t>
+struct min_candidate_edge_t {
+  __device__ thrust::tuple<weight_t, vertex_t, vertex_t, vertex_t> operator()(
+    thrust::tuple<weight_t, vertex_t, vertex_t, vertex_t> const &lhs,
+    thrust::tuple<weight_t, vertex_t, vertex_t, vertex_t> const &rhs) const
+  {
+    if (thrust::get<0>(lhs) != thrust::get<0>(rhs)) {
+      return thrust::get<0>(lhs) < thrust::get<0>(rhs) ? lhs : rhs;
+    } else if (thrust::get<1>(lhs) != thrust::get<1>(rhs)) {
+      return thrust::get<1>(lhs) < thrust::get<1>(rhs) ? lhs : rhs;
+    } else {
+      return thrust::get<2>(lhs) <= thrust::get<2>(rhs) ? lhs : rhs;
+    }
+  }
+};
+
+// Each thread takes one major vertex and finds the smallest local edge (in the order of
+// min_candidate_edge_t) to a vertex with a different label; candidate_targets is set to
+// invalid_label if there is no such edge.
+template <typename GraphViewType>
+__global__ void for_all_major_find_min_outgoing_edge(
+  matrix_partition_device_t<GraphViewType> matrix_partition,
+  typename GraphViewType::vertex_type const *row_label_first,
+  typename GraphViewType::vertex_type const *col_label_first,
+  typename GraphViewType::weight_type *candidate_weight_first,
+  typename GraphViewType::vertex_type *candidate_src_first,
+  typename GraphViewType::vertex_type *candidate_dst_first,
+  typename GraphViewType::vertex_type *candidate_target_first)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto const invalid_label = std::numeric_limits<vertex_t>::max();
+  auto idx                 = static_cast<size_t>(threadIdx.x + blockIdx.x * blockDim.x);
+
+  // FIXME: thread per major vertex suffers from load imbalance on high degree vertices
+  while (idx < static_cast<size_t>(matrix_partition.get_major_size())) {
+    auto major       = matrix_partition.get_major_from_major_offset_nocheck(idx);
+    auto major_label = row_label_first[idx];
+    minor_index_iterator_t<vertex_t, edge_t> indices{};
+    weight_t const *weights{nullptr};
+    edge_t local_degree{};
+    thrust::tie(indices, weights, local_degree) =
+      matrix_partition.get_local_edges(static_cast<vertex_t>(idx));
+    auto best = thrust::make_tuple(
+      std::numeric_limits<weight_t>::max(), invalid_label, invalid_label, invalid_label);
+    for (edge_t i = 0; i < local_degree; ++i) {
+      auto minor       = indices[i];
+      auto minor_label =
+        col_label_first[matrix_partition.get_minor_offset_from_minor_nocheck(minor)];
+      if (minor_label != major_label) {
+        auto candidate = thrust::make_tuple(weights[i],
+                                            thrust::min(major, minor),
+                                            thrust::max(major, minor),
+                                            minor_label);
+        best = (thrust::get<3>(best) == invalid_label)
+                 ? candidate
+                 : min_candidate_edge_t<vertex_t, weight_t>{}(best, candidate);
+      }
+    }
+    candidate_weight_first[idx] = thrust::get<0>(best);
+    candidate_src_first[idx]    = thrust::get<1>(best);
+    candidate_dst_first[idx]    = thrust::get<2>(best);
+    candidate_target_first[idx] = thrust::get<3>(best);
+    idx += gridDim.x * blockDim.x;
+  }
+}
+
+// sort the candidates by label and keep the smallest candidate edge per label
+template <typename vertex_t, typename weight_t>
+void reduce_to_min_candidates(raft::handle_t const &handle,
+                              rmm::device_uvector<vertex_t> &labels,
+                              rmm::device_uvector<weight_t> &weights,
+                              rmm::device_uvector<vertex_t> &srcs,
+                              rmm::device_uvector<vertex_t> &dsts,
+                              rmm::device_uvector<vertex_t> &targets)
+{
+  auto value_first = thrust::make_zip_iterator(
+    thrust::make_tuple(weights.begin(), srcs.begin(), dsts.begin(), targets.begin()));
+  thrust::sort_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      labels.begin(),
+                      labels.end(),
+                      value_first);
+
+  rmm::device_uvector<vertex_t> unique_labels(labels.size(), handle.get_stream());
+  rmm::device_uvector<weight_t> min_weights(labels.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> min_srcs(labels.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> min_dsts(labels.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> min_targets(labels.size(), handle.get_stream());
+  auto num_unique_labels = static_cast<size_t>(thrust::distance(
+    unique_labels.begin(),
+    thrust::get<0>(thrust::reduce_by_key(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      labels.begin(),
+      labels.end(),
+      value_first,
+      unique_labels.begin(),
+      thrust::make_zip_iterator(thrust::make_tuple(
+        min_weights.begin(), min_srcs.begin(), min_dsts.begin(), min_targets.begin())),
+      thrust::equal_to<vertex_t>{},
+      min_candidate_edge_t<vertex_t, weight_t>{}))));
+
+  unique_labels.resize(num_unique_labels, handle.get_stream());
+  min_weights.resize(num_unique_labels, handle.get_stream());
+  min_srcs.resize(num_unique_labels, handle.get_stream());
+  min_dsts.resize(num_unique_labels, handle.get_stream());
+  min_targets.resize(num_unique_labels, handle.get_stream());
+
+  labels  = std::move(unique_labels);
+  weights = std::move(min_weights);
+  srcs    = std::move(min_srcs);
+  dsts    = std::move(min_dsts);
+  targets = std::move(min_targets);
+}
+
+// find the smallest outgoing edge of every supervertex (a set of vertices sharing a label, the
+// label is the ID of the root vertex of the supervertex), the returned candidates are owned by the
+// process owning the root vertex
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::weight_type>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>>
+find_min_outgoing_edges(
+  raft::handle_t const &handle,
+  GraphViewType const &graph_view,
+  typename GraphViewType::vertex_type const *components,
+  rmm::device_uvector<typename GraphViewType::vertex_type> const &vertex_partition_lasts)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto const invalid_label = std::numeric_limits<vertex_t>::max();
+
+  rmm::device_uvector<vertex_t> adj_matrix_row_components(
+    GraphViewType::is_multi_gpu ? graph_view.get_number_of_local_adj_matrix_partition_rows()
+                                : vertex_t{0},
+    handle.get_stream());
+  rmm::device_uvector<vertex_t> adj_matrix_col_components(
+    GraphViewType::is_multi_gpu ? graph_view.get_number_of_local_adj_matrix_partition_cols()
+                                : vertex_t{0},
+    handle.get_stream());
+  if (GraphViewType::is_multi_gpu) {
+    copy_to_adj_matrix_row(handle, graph_view, components, adj_matrix_row_components.begin());
+    copy_to_adj_matrix_col(handle, graph_view, components, adj_matrix_col_components.begin());
+  }
+
+  // 1. find the smallest outgoing local edge of every major vertex
+
+  rmm::device_uvector<vertex_t> labels(0, handle.get_stream());
+  rmm::device_uvector<weight_t> weights(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> srcs(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> dsts(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> targets(0, handle.get_stream());
+
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    matrix_partition_device_t<GraphViewType> matrix_partition(graph_view, i);
+
+    auto major_size        = static_cast<size_t>(matrix_partition.get_major_size());
+    auto const *row_labels = (GraphViewType::is_multi_gpu ? adj_matrix_row_components.data()
+                                                          : components) +
+                             matrix_partition.get_major_value_start_offset();
+
+    rmm::device_uvector<weight_t> major_weights(major_size, handle.get_stream());
+    rmm::device_uvector<vertex_t> major_srcs(major_size, handle.get_stream());
+    rmm::device_uvector<vertex_t> major_dsts(major_size, handle.get_stream());
+    rmm::device_uvector<vertex_t> major_targets(major_size, handle.get_stream());
+
+    if (major_size > 0) {
+      raft::grid_1d_thread_t update_grid(major_size,
+                                         minimum_spanning_forest_block_size,
+                                         handle.get_device_properties().maxGridSize[0]);
+      for_all_major_find_min_outgoing_edge<<<update_grid.num_blocks,
+                                             update_grid.block_size,
+                                             0,
+                                             handle.get_stream()>>>(
+        matrix_partition,
+        row_labels,
+        GraphViewType::is_multi_gpu ? adj_matrix_col_components.data() : components,
+        major_weights.data(),
+        major_srcs.data(),
+        major_dsts.data(),
+        major_targets.data());
+    }
+
+    auto input_first = thrust::make_zip_iterator(thrust::make_tuple(row_labels,
+                                                                    major_weights.begin(),
+                                                                    major_srcs.begin(),
+                                                                    major_dsts.begin(),
+                                                                    major_targets.begin()));
+    auto has_candidate = [invalid_label] __device__(auto val) {
+      return thrust::get<4>(val) != invalid_label;
+    };
+    auto num_candidates = static_cast<size_t>(
+      thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                       input_first,
+                       input_first + major_size,
+                       has_candidate));
+
+    auto old_size = labels.size();
+    labels.resize(old_size + num_candidates, handle.get_stream());
+    weights.resize(labels.size(), handle.get_stream());
+    srcs.resize(labels.size(), handle.get_stream());
+    dsts.resize(labels.size(), handle.get_stream());
+    targets.resize(labels.size(), handle.get_stream());
+    thrust::copy_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    input_first,
+                    input_first + major_size,
+                    thrust::make_zip_iterator(thrust::make_tuple(labels.begin() + old_size,
+                                                                 weights.begin() + old_size,
+                                                                 srcs.begin() + old_size,
+                                                                 dsts.begin() + old_size,
+                                                                 targets.begin() + old_size)),
+                    has_candidate);
+  }
+
+  // 2. reduce to the smallest outgoing edge per supervertex (locally, and then in the process
+  // owning the supervertex root in multi-GPU)
+
+  reduce_to_min_candidates(handle, labels, weights, srcs, dsts, targets);
+
+  if (GraphViewType::is_multi_gpu) {
+    auto &comm = handle.get_comms();
+
+    rmm::device_uvector<vertex_t> rx_labels(0, handle.get_stream());
+    rmm::device_uvector<weight_t> rx_weights(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> rx_srcs(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> rx_dsts(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> rx_targets(0, handle.get_stream());
+    auto candidate_first = thrust::make_zip_iterator(thrust::make_tuple(
+      labels.begin(), weights.begin(), srcs.begin(), dsts.begin(), targets.begin()));
+    std::forward_as_tuple(std::tie(rx_labels, rx_weights, rx_srcs, rx_dsts, rx_targets),
+                          std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        candidate_first,
+        candidate_first + labels.size(),
+        [key_func = vertex_to_gpu_id_t<vertex_t>{vertex_partition_lasts.data(),
+                                                 comm.get_size()}] __device__(auto val) {
+          return key_func(thrust::get<0>(val));
+        },
+        handle.get_stream());
+    labels  = std::move(rx_labels);
+    weights = std::move(rx_weights);
+    srcs    = std::move(rx_srcs);
+    dsts    = std::move(rx_dsts);
+    targets = std::move(rx_targets);
+
+    reduce_to_min_candidates(handle, labels, weights, srcs, dsts, targets);
+  }
+
+  return std::make_tuple(
+    std::move(labels), std::move(weights), std::move(srcs), std::move(dsts), std::move(targets));
+}
+
+// look up the values of the (local) vertex property array values for the vertices in
+// [key_first, key_last)
+template <typename GraphViewType>
+rmm::device_uvector<typename GraphViewType::vertex_type> lookup_vertex_values(
+  raft::handle_t const &handle,
+  GraphViewType const &graph_view,
+  typename GraphViewType::vertex_type const *values,
+  typename GraphViewType::vertex_type const *key_first,
+  typename GraphViewType::vertex_type const *key_last,
+  rmm::device_uvector<typename GraphViewType::vertex_type> const &vertex_partition_lasts)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  if (GraphViewType::is_multi_gpu) {
+    auto &comm = handle.get_comms();
+
+    return collect_values_for_keys(
+      comm,
+      thrust::make_counting_iterator(graph_view.get_local_vertex_first()),
+      thrust::make_counting_iterator(graph_view.get_local_vertex_last()),
+      values,
+      key_first,
+      key_last,
+      vertex_to_gpu_id_t<vertex_t>{vertex_partition_lasts.data(), comm.get_size()},
+      handle.get_stream());
+  } else {
+    rmm::device_uvector<vertex_t> ret(thrust::distance(key_first, key_last), handle.get_stream());
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      key_first,
+                      key_last,
+                      ret.begin(),
+                      [values] __device__(auto v) { return values[v]; });
+    return ret;
+  }
+}
+
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::weight_type>>
+minimum_spanning_forest(raft::handle_t const &handle,
+                        GraphViewType const &graph_view,
+                        bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_local_vertices = graph_view.get_number_of_local_vertices();
+  auto const local_first        = graph_view.get_local_vertex_first();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: minimum_spanning_forest requires a symmetric graph.");
+  CUGRAPH_EXPECTS(graph_view.is_weighted(),
+                  "Invalid input argument: minimum_spanning_forest requires a weighted graph.");
+
+  if (do_expensive_check) {
+    // FIXME: check whether the graph is really symmetric (the graph property is not verified)
+  }
+
+  rmm::device_uvector<vertex_t> vertex_partition_lasts(0, handle.get_stream());
+  if (GraphViewType::is_multi_gpu) {
+    auto const comm_size = handle.get_comms().get_size();
+
+    std::vector<vertex_t> h_vertex_partition_lasts(comm_size);
+    for (int i = 0; i < comm_size; ++i) {
+      h_vertex_partition_lasts[i] = graph_view.get_vertex_partition_last(i);
+    }
+    vertex_partition_lasts.resize(h_vertex_partition_lasts.size(), handle.get_stream());
+    raft::update_device(vertex_partition_lasts.data(),
+                        h_vertex_partition_lasts.data(),
+                        h_vertex_partition_lasts.size(),
+                        handle.get_stream());
+  }
+
+  // 2. initialize (every vertex is a supervertex of its own)
+
+  rmm::device_uvector<vertex_t> components(num_local_vertices, handle.get_stream());
+  thrust::sequence(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   components.begin(),
+                   components.end(),
+                   local_first);
+
+  rmm::device_uvector<vertex_t> forest_srcs(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> forest_dsts(0, handle.get_stream());
+  rmm::device_uvector<weight_t> forest_weights(0, handle.get_stream());
+
+  // 3. Boruvka rounds: every supervertex picks its smallest outgoing edge, and the supervertices
+  // connected by the picked edges are contracted (by relabeling the vertices)
+
+  while (true) {
+    rmm::device_uvector<vertex_t> roots(0, handle.get_stream());
+    rmm::device_uvector<weight_t> weights(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> srcs(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> dsts(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> targets(0, handle.get_stream());
+    std::tie(roots, weights, srcs, dsts, targets) =
+      find_min_outgoing_edges(handle, graph_view, components.data(), vertex_partition_lasts);
+
+    auto num_candidates = roots.size();
+    if (GraphViewType::is_multi_gpu) {
+      num_candidates =
+        host_scalar_allreduce(handle.get_comms(), num_candidates, handle.get_stream());
+    }
+    if (num_candidates == 0) { break; }
+
+    // 3-1. hook every root to its target; two supervertices picking each other (they pick the same
+    // edge as edges are totally ordered) form the only cycles, the smaller root remains a root
+
+    thrust::for_each(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_zip_iterator(thrust::make_tuple(roots.begin(), targets.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(roots.end(), targets.end())),
+      [components = components.data(), local_first] __device__(auto pair) {
+        components[thrust::get<0>(pair) - local_first] = thrust::get<1>(pair);
+      });
+
+    auto target_parents = lookup_vertex_values(handle,
+                                               graph_view,
+                                               components.data(),
+                                               targets.data(),
+                                               targets.data() + targets.size(),
+                                               vertex_partition_lasts);
+
+    rmm::device_uvector<bool> keep_roots(roots.size(), handle.get_stream());
+    thrust::transform(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(roots.begin(), targets.begin(), target_parents.begin())),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(roots.end(), targets.end(), target_parents.end())),
+      keep_roots.begin(),
+      [] __device__(auto val) {
+        return (thrust::get<2>(val) == thrust::get<0>(val)) &&
+               (thrust::get<0>(val) < thrust::get<1>(val));
+      });
+
+    thrust::for_each(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_zip_iterator(thrust::make_tuple(roots.begin(), keep_roots.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(roots.end(), keep_roots.end())),
+      [components = components.data(), local_first] __device__(auto pair) {
+        if (thrust::get<1>(pair)) {
+          components[thrust::get<0>(pair) - local_first] = thrust::get<0>(pair);
+        }
+      });
+
+    // 3-2. the edges picked by the hooked roots join the forest
+
+    auto edge_first = thrust::make_zip_iterator(
+      thrust::make_tuple(srcs.begin(), dsts.begin(), weights.begin()));
+    auto num_new_edges = static_cast<size_t>(
+      thrust::count(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    keep_roots.begin(),
+                    keep_roots.end(),
+                    false));
+    auto old_size = forest_srcs.size();
+    forest_srcs.resize(old_size + num_new_edges, handle.get_stream());
+    forest_dsts.resize(forest_srcs.size(), handle.get_stream());
+    forest_weights.resize(forest_srcs.size(), handle.get_stream());
+    auto forest_edge_first =
+      thrust::make_zip_iterator(thrust::make_tuple(forest_srcs.begin() + old_size,
+                                                   forest_dsts.begin() + old_size,
+                                                   forest_weights.begin() + old_size));
+    thrust::copy_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    edge_first,
+                    edge_first + srcs.size(),
+                    keep_roots.begin(),
+                    forest_edge_first,
+                    [] __device__(auto keep_root) { return !keep_root; });
+
+    // 3-3. pointer jumping until every vertex points to the root of its new supervertex
+
+    while (true) {
+      auto grandparents = lookup_vertex_values(handle,
+                                               graph_view,
+                                               components.data(),
+                                               components.data(),
+                                               components.data() + components.size(),
+                                               vertex_partition_lasts);
+
+      auto pair_first =
+        thrust::make_zip_iterator(thrust::make_tuple(components.begin(), grandparents.begin()));
+      auto num_updates = static_cast<size_t>(
+        thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                         pair_first,
+                         pair_first + num_local_vertices,
+                         [] __device__(auto pair) {
+                           return thrust::get<0>(pair) != thrust::get<1>(pair);
+                         }));
+      if (GraphViewType::is_multi_gpu) {
+        num_updates = host_scalar_allreduce(handle.get_comms(), num_updates, handle.get_stream());
+      }
+      if (num_updates == 0) { break; }
+
+      components = std::move(grandparents);
+    }
+  }
+
+  return std::make_tuple(
+    std::move(forest_srcs), std::move(forest_dsts), std::move(forest_weights));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<weight_t>>
+minimum_spanning_forest(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  bool do_expensive_check)
+{
+  return detail::minimum_spanning_forest(handle, graph_view, do_expensive_check);
+}
+
+// explicit instantiation
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<float>>
+minimum_spanning_forest(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, float, false, true> const &graph_view,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<double>>
+minimum_spanning_forest(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, double, false, true> const &graph_view,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<float>>
+minimum_spanning_forest(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, float, false, true> const &graph_view,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<double>>
+minimum_spanning_forest(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, double, false, true> const &graph_view,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<float>>
+minimum_spanning_forest(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, float, false, true> const &graph_view,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<double>>
+minimum_spanning_forest(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, double, false, true> const &graph_view,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<float>>
+minimum_spanning_forest(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const &graph_view,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<double>>
+minimum_spanning_forest(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const &graph_view,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<float>>
+minimum_spanning_forest(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const &graph_view,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<double>>
+minimum_spanning_forest(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const &graph_view,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<float>>
+minimum_spanning_forest(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const &graph_view,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<double>>
+minimum_spanning_forest(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const &graph_view,
+  bool do_expensive_check);
+
+}  // namespace experimental
+}  // namespace cugraph
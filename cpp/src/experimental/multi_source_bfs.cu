@@ -0,0 +1,616 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithms.hpp>
+#include <experimental/graph_view.hpp>
+#include <matrix_partition_device.cuh>
+#include <partition_manager.hpp>
+#include <patterns/copy_to_adj_matrix_row_col.cuh>
+#include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+#include <utilities/shuffle_comm.cuh>
+#include <vertex_partition_device.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <raft/handle.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+
+namespace cugraph {
+namespace experimental {
+namespace detail {
+
+// FIXME: block size requires tuning
+int32_t constexpr multi_source_bfs_expand_block_size = 128;
+
+// FIXME: this value requires tuning; larger values expand more sources per edge scan but the
+// bitsets (visited, frontier, and next, 32 sources per word) require
+// 3 * multi_source_bfs_max_words_per_vertex * 4 bytes per vertex.
+size_t constexpr multi_source_bfs_max_words_per_vertex = 8;
+
+// Each thread takes one major vertex and ORs its frontier bitset (every word with at least one bit
+// set, gathered once before scanning the edges) to the next bitsets of its neighbors in a single
+// pass over the major's neighbor list. frontier words are stored word-major
+// (frontier_first[j * frontier_stride + major_offset] for the j'th word) to allow copying each word
+// to the adjacency matrix rows separately, and next words are stored minor-major
+// (next_first[minor_offset * num_words + j]) to group the (sparse) updates by minor vertex.
+template <typename GraphViewType>
+__global__ void for_all_major_or_frontier_bitset_to_nbrs(
+  matrix_partition_device_t<GraphViewType> matrix_partition,
+  uint32_t const *frontier_first,
+  typename GraphViewType::vertex_type frontier_stride,
+  uint32_t *next_first,
+  size_t num_words)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const tid = threadIdx.x + blockIdx.x * blockDim.x;
+  auto idx       = static_cast<size_t>(tid);
+
+  while (idx < static_cast<size_t>(matrix_partition.get_major_size())) {
+    minor_index_iterator_t<vertex_t, edge_t> indices{};
+    weight_t const *weights{nullptr};
+    edge_t local_degree{};
+    thrust::tie(indices, weights, local_degree) =
+      matrix_partition.get_local_edges(static_cast<vertex_t>(idx));
+    // num_words <= multi_source_bfs_max_words_per_vertex (enforced by the batch size)
+    uint32_t nonzero_words[multi_source_bfs_max_words_per_vertex];
+    uint32_t nonzero_word_indices[multi_source_bfs_max_words_per_vertex];
+    size_t num_nonzero_words{0};
+    for (size_t j = 0; j < num_words; ++j) {
+      auto word = *(frontier_first + j * static_cast<size_t>(frontier_stride) + idx);
+      if (word != uint32_t{0}) {
+        nonzero_words[num_nonzero_words]        = word;
+        nonzero_word_indices[num_nonzero_words] = static_cast<uint32_t>(j);
+        ++num_nonzero_words;
+      }
+    }
+    if (num_nonzero_words > 0) {
+      for (edge_t i = 0; i < local_degree; ++i) {
+        auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(indices[i]);
+        auto next_ptr     = next_first + static_cast<size_t>(minor_offset) * num_words;
+        for (size_t k = 0; k < num_nonzero_words; ++k) {
+          auto word = nonzero_words[k];
+          auto ptr  = next_ptr + nonzero_word_indices[k];
+          // skip the atomic if every bit is already set (e.g. by another frontier vertex)
+          if ((*ptr & word) != word) { atomicOr(ptr, word); }
+        }
+      }
+    }
+    idx += gridDim.x * blockDim.x;
+  }
+}
+
+template <typename GraphViewType>
+void multi_source_bfs_expand(raft::handle_t const &handle,
+                             GraphViewType const &push_graph_view,
+                             rmm::device_uvector<uint32_t> const &frontier,
+                             rmm::device_uvector<uint32_t> &next,
+                             size_t num_words)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  CUGRAPH_EXPECTS(num_words <= multi_source_bfs_max_words_per_vertex,
+                  "Invalid input argument: num_words exceeds the maximum words per vertex.");
+
+  auto const num_local_vertices = push_graph_view.get_number_of_local_vertices();
+
+  thrust::fill(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()), next.begin(), next.end(), 0);
+
+  if (GraphViewType::is_multi_gpu) {
+    auto &row_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+    auto const row_comm_size = row_comm.get_size();
+    auto &col_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+    auto const col_comm_rank = col_comm.get_rank();
+
+    auto const num_rows = push_graph_view.get_number_of_local_adj_matrix_partition_rows();
+    auto const num_cols = push_graph_view.get_number_of_local_adj_matrix_partition_cols();
+    auto const col_first = push_graph_view.get_local_adj_matrix_partition_col_first(size_t{0});
+
+    // 1. copy frontier bitsets to the adjacency matrix rows (one word at a time)
+
+    rmm::device_uvector<uint32_t> adj_matrix_row_frontier(num_words * num_rows,
+                                                          handle.get_stream());
+    for (size_t j = 0; j < num_words; ++j) {
+      copy_to_adj_matrix_row(handle,
+                             push_graph_view,
+                             frontier.begin() + j * num_local_vertices,
+                             adj_matrix_row_frontier.begin() + j * num_rows);
+    }
+
+    // 2. expand to the adjacency matrix columns
+
+    rmm::device_uvector<uint32_t> adj_matrix_col_next(num_cols * num_words, handle.get_stream());
+    thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 adj_matrix_col_next.begin(),
+                 adj_matrix_col_next.end(),
+                 0);
+    for (size_t i = 0; i < push_graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      matrix_partition_device_t<GraphViewType> matrix_partition(push_graph_view, i);
+
+      if (matrix_partition.get_major_size() > 0) {
+        raft::grid_1d_thread_t expand_grid(matrix_partition.get_major_size(),
+                                           multi_source_bfs_expand_block_size,
+                                           handle.get_device_properties().maxGridSize[0]);
+        for_all_major_or_frontier_bitset_to_nbrs<<<expand_grid.num_blocks,
+                                                   expand_grid.block_size,
+                                                   0,
+                                                   handle.get_stream()>>>(
+          matrix_partition,
+          adj_matrix_row_frontier.data() + matrix_partition.get_major_value_start_offset(),
+          num_rows,
+          adj_matrix_col_next.data(),
+          num_words);
+      }
+    }
+
+    // 3. compact the non-zero words (ordered by column vertex) and send them to their owners in
+    // row_comm (there is no bitwise OR reduction in raft::comms, so we send sparse (vertex, word)
+    // pairs and OR them in the receiving GPU)
+
+    auto num_nonzero_words =
+      thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                       adj_matrix_col_next.begin(),
+                       adj_matrix_col_next.end(),
+                       [] __device__(auto word) { return word != uint32_t{0}; });
+    rmm::device_uvector<size_t> nonzero_word_indices(num_nonzero_words, handle.get_stream());
+    thrust::copy_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    thrust::make_counting_iterator(size_t{0}),
+                    thrust::make_counting_iterator(adj_matrix_col_next.size()),
+                    adj_matrix_col_next.begin(),
+                    nonzero_word_indices.begin(),
+                    [] __device__(auto word) { return word != uint32_t{0}; });
+
+    rmm::device_uvector<vertex_t> tx_vertices(num_nonzero_words, handle.get_stream());
+    rmm::device_uvector<uint64_t> tx_words(num_nonzero_words, handle.get_stream());
+    thrust::transform(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      nonzero_word_indices.begin(),
+      nonzero_word_indices.end(),
+      thrust::make_zip_iterator(thrust::make_tuple(tx_vertices.begin(), tx_words.begin())),
+      [col_first, num_words, adj_matrix_col_next = adj_matrix_col_next.data()] __device__(
+        auto idx) {
+        return thrust::make_tuple(
+          col_first + static_cast<vertex_t>(idx / num_words),
+          (static_cast<uint64_t>(idx % num_words) << 32) | uint64_t{adj_matrix_col_next[idx]});
+      });
+    nonzero_word_indices.resize(0, handle.get_stream());
+    nonzero_word_indices.shrink_to_fit(handle.get_stream());
+
+    std::vector<vertex_t> h_vertex_lasts(row_comm_size);
+    for (size_t i = 0; i < h_vertex_lasts.size(); ++i) {
+      h_vertex_lasts[i] =
+        push_graph_view.get_vertex_partition_last(col_comm_rank * row_comm_size + i);
+    }
+    rmm::device_uvector<vertex_t> d_vertex_lasts(h_vertex_lasts.size(), handle.get_stream());
+    raft::update_device(
+      d_vertex_lasts.data(), h_vertex_lasts.data(), h_vertex_lasts.size(), handle.get_stream());
+    rmm::device_uvector<size_t> d_tx_last_boundaries(d_vertex_lasts.size(), handle.get_stream());
+    thrust::lower_bound(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        tx_vertices.begin(),
+                        tx_vertices.end(),
+                        d_vertex_lasts.begin(),
+                        d_vertex_lasts.end(),
+                        d_tx_last_boundaries.begin());
+    std::vector<size_t> h_tx_last_boundaries(d_tx_last_boundaries.size());
+    raft::update_host(h_tx_last_boundaries.data(),
+                      d_tx_last_boundaries.data(),
+                      d_tx_last_boundaries.size(),
+                      handle.get_stream());
+    handle.get_stream_view().synchronize();
+    std::vector<size_t> tx_counts(h_tx_last_boundaries.size());
+    std::adjacent_difference(
+      h_tx_last_boundaries.begin(), h_tx_last_boundaries.end(), tx_counts.begin());
+
+    rmm::device_uvector<vertex_t> rx_vertices(size_t{0}, handle.get_stream());
+    std::tie(rx_vertices, std::ignore) =
+      shuffle_values(row_comm, tx_vertices.begin(), tx_counts, handle.get_stream());
+    rmm::device_uvector<uint64_t> rx_words(size_t{0}, handle.get_stream());
+    std::tie(rx_words, std::ignore) =
+      shuffle_values(row_comm, tx_words.begin(), tx_counts, handle.get_stream());
+
+    // 4. OR the received words
+
+    vertex_partition_device_t<GraphViewType> vertex_partition(push_graph_view);
+    thrust::for_each(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_zip_iterator(thrust::make_tuple(rx_vertices.begin(), rx_words.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(rx_vertices.end(), rx_words.end())),
+      [vertex_partition, num_words, next = next.data()] __device__(auto val) {
+        auto v_offset =
+          vertex_partition.get_local_vertex_offset_from_vertex_nocheck(thrust::get<0>(val));
+        auto j = static_cast<size_t>(thrust::get<1>(val) >> 32);
+        atomicOr(next + static_cast<size_t>(v_offset) * num_words + j,
+                 static_cast<uint32_t>(thrust::get<1>(val) & uint64_t{0xffffffff}));
+      });
+  } else {
+    matrix_partition_device_t<GraphViewType> matrix_partition(push_graph_view, 0);
+    if (matrix_partition.get_major_size() > 0) {
+      raft::grid_1d_thread_t expand_grid(matrix_partition.get_major_size(),
+                                         multi_source_bfs_expand_block_size,
+                                         handle.get_device_properties().maxGridSize[0]);
+      for_all_major_or_frontier_bitset_to_nbrs<<<expand_grid.num_blocks,
+                                                 expand_grid.block_size,
+                                                 0,
+                                                 handle.get_stream()>>>(
+        matrix_partition, frontier.data(), num_local_vertices, next.data(), num_words);
+    }
+  }
+}
+
+// append (source index, vertex, depth) triplets for every bit set in frontier (word-major) and
+// return the local number of appended triplets
+template <typename GraphViewType, typename vertex_t = typename GraphViewType::vertex_type>
+size_t multi_source_bfs_append_frontier(raft::handle_t const &handle,
+                                        GraphViewType const &push_graph_view,
+                                        rmm::device_uvector<uint32_t> const &frontier,
+                                        size_t source_idx_first,
+                                        vertex_t depth,
+                                        rmm::device_uvector<size_t> &source_indices,
+                                        rmm::device_uvector<vertex_t> &vertices,
+                                        rmm::device_uvector<vertex_t> &distances)
+{
+
+  auto const num_local_vertices = push_graph_view.get_number_of_local_vertices();
+
+  rmm::device_uvector<size_t> word_offsets(frontier.size() + 1, handle.get_stream());
+  auto zero = size_t{0};
+  word_offsets.set_element_async(0, zero, handle.get_stream());
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    frontier.begin(),
+    frontier.end(),
+    word_offsets.begin() + 1,
+    [] __device__(auto word) { return static_cast<size_t>(__popc(word)); },
+    thrust::plus<size_t>());
+  size_t num_new{0};
+  raft::update_host(&num_new, word_offsets.data() + frontier.size(), 1, handle.get_stream());
+  handle.get_stream_view().synchronize();
+
+  if (num_new > 0) {
+    auto old_size = vertices.size();
+    source_indices.resize(old_size + num_new, handle.get_stream());
+    vertices.resize(old_size + num_new, handle.get_stream());
+    distances.resize(old_size + num_new, handle.get_stream());
+    thrust::for_each(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(frontier.size()),
+      [frontier       = frontier.data(),
+       word_offsets   = word_offsets.data(),
+       source_indices = source_indices.data() + old_size,
+       vertices       = vertices.data() + old_size,
+       distances      = distances.data() + old_size,
+       num_local_vertices,
+       local_vertex_first = push_graph_view.get_local_vertex_first(),
+       source_idx_first,
+       depth] __device__(auto idx) {
+        auto word   = frontier[idx];
+        auto j      = idx / static_cast<size_t>(num_local_vertices);
+        auto v      = local_vertex_first + static_cast<vertex_t>(idx % num_local_vertices);
+        auto offset = word_offsets[idx];
+        while (word != uint32_t{0}) {
+          auto b                 = __ffs(word) - 1;
+          source_indices[offset] = source_idx_first + j * 32 + b;
+          vertices[offset]       = v;
+          distances[offset]      = depth;
+          ++offset;
+          word &= word - 1;
+        }
+      });
+  }
+
+  return num_new;
+}
+
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>>
+multi_source_bfs(raft::handle_t const &handle,
+                 GraphViewType const &push_graph_view,
+                 typename GraphViewType::vertex_type const *sources,
+                 size_t num_sources,
+                 typename GraphViewType::vertex_type depth_limit,
+                 bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  // 1. check input arguments
+
+  vertex_partition_device_t<GraphViewType> vertex_partition(push_graph_view);
+
+  auto num_invalid_sources =
+    thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     sources,
+                     sources + num_sources,
+                     [vertex_partition] __device__(auto v) {
+                       return !vertex_partition.is_valid_vertex(v);
+                     });
+  CUGRAPH_EXPECTS(num_invalid_sources == 0,
+                  "Invalid input argument: sources have out-of-range vertex IDs.");
+
+  if (do_expensive_check) {
+    // nothing to do
+  }
+
+  // 2. traverse from each batch of sources
+
+  auto const num_local_vertices = push_graph_view.get_number_of_local_vertices();
+
+  rmm::device_uvector<size_t> source_indices(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> vertices(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> distances(0, handle.get_stream());
+
+  auto const max_batch_size = multi_source_bfs_max_words_per_vertex * 32;
+  for (size_t batch_first = 0; batch_first < num_sources; batch_first += max_batch_size) {
+    auto batch_size = std::min(max_batch_size, num_sources - batch_first);
+    auto num_words  = (batch_size + 31) / 32;
+
+    // visited and next are vertex-major, frontier is word-major
+    rmm::device_uvector<uint32_t> visited(num_local_vertices * num_words, handle.get_stream());
+    rmm::device_uvector<uint32_t> frontier(num_words * num_local_vertices, handle.get_stream());
+    rmm::device_uvector<uint32_t> next(num_local_vertices * num_words, handle.get_stream());
+    thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 visited.begin(),
+                 visited.end(),
+                 0);
+    thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 frontier.begin(),
+                 frontier.end(),
+                 0);
+
+    thrust::for_each(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(batch_size),
+                     [vertex_partition,
+                      sources = sources + batch_first,
+                      visited = visited.data(),
+                      frontier = frontier.data(),
+                      num_local_vertices,
+                      num_words] __device__(auto i) {
+                       auto v = sources[i];
+                       if (vertex_partition.is_local_vertex_nocheck(v)) {
+                         auto v_offset =
+                           vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v);
+                         auto j   = i / 32;
+                         auto bit = uint32_t{1} << (i % 32);
+                         atomicOr(visited + static_cast<size_t>(v_offset) * num_words + j, bit);
+                         atomicOr(frontier + j * static_cast<size_t>(num_local_vertices) + v_offset,
+                                  bit);
+                       }
+                     });
+
+    multi_source_bfs_append_frontier(handle,
+                                     push_graph_view,
+                                     frontier,
+                                     batch_first,
+                                     vertex_t{0},
+                                     source_indices,
+                                     vertices,
+                                     distances);
+
+    vertex_t depth{0};
+    while (depth < depth_limit) {
+      multi_source_bfs_expand(handle, push_graph_view, frontier, next, num_words);
+
+      // next & ~visited becomes the new frontier
+      thrust::for_each(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                       thrust::make_counting_iterator(size_t{0}),
+                       thrust::make_counting_iterator(next.size()),
+                       [visited  = visited.data(),
+                        frontier = frontier.data(),
+                        next     = next.data(),
+                        num_local_vertices,
+                        num_words] __device__(auto idx) {
+                         auto v_offset = idx / num_words;
+                         auto j        = idx % num_words;
+                         auto word     = next[idx] & ~visited[idx];
+                         visited[idx] |= word;
+                         frontier[j * static_cast<size_t>(num_local_vertices) + v_offset] = word;
+                       });
+
+      ++depth;
+      auto num_new = multi_source_bfs_append_frontier(handle,
+                                                      push_graph_view,
+                                                      frontier,
+                                                      batch_first,
+                                                      depth,
+                                                      source_indices,
+                                                      vertices,
+                                                      distances);
+      if (GraphViewType::is_multi_gpu) {
+        num_new = host_scalar_allreduce(handle.get_comms(), num_new, handle.get_stream());
+      }
+      if (num_new == 0) { break; }
+    }
+  }
+
+  // 3. group the reached vertices by source (in ascending vertex ID order)
+
+  auto pair_first =
+    thrust::make_zip_iterator(thrust::make_tuple(source_indices.begin(), vertices.begin()));
+  thrust::sort_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      pair_first,
+                      pair_first + source_indices.size(),
+                      distances.begin());
+
+  rmm::device_uvector<size_t> offsets(num_sources + 1, handle.get_stream());
+  thrust::lower_bound(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      source_indices.begin(),
+                      source_indices.end(),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(num_sources + 1),
+                      offsets.begin());
+
+  return std::make_tuple(std::move(offsets), std::move(vertices), std::move(distances));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::tuple<rmm::device_uvector<size_t>,
+           rmm::device_uvector<vertex_t>,
+           rmm::device_uvector<vertex_t>>
+multi_source_bfs(raft::handle_t const &handle,
+                 graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+                 vertex_t const *sources,
+                 size_t num_sources,
+                 vertex_t depth_limit,
+                 bool do_expensive_check)
+{
+  return detail::multi_source_bfs(
+    handle, graph_view, sources, num_sources, depth_limit, do_expensive_check);
+}
+
+// explicit instantiation
+
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>
+  multi_source_bfs(raft::handle_t const &handle,
+                   graph_view_t<int32_t, int32_t, float, false, true> const &graph_view,
+                   int32_t const *sources,
+                   size_t num_sources,
+                   int32_t depth_limit,
+                   bool do_expensive_check);
+
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>
+  multi_source_bfs(raft::handle_t const &handle,
+                   graph_view_t<int32_t, int32_t, double, false, true> const &graph_view,
+                   int32_t const *sources,
+                   size_t num_sources,
+                   int32_t depth_limit,
+                   bool do_expensive_check);
+
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>
+  multi_source_bfs(raft::handle_t const &handle,
+                   graph_view_t<int32_t, int64_t, float, false, true> const &graph_view,
+                   int32_t const *sources,
+                   size_t num_sources,
+                   int32_t depth_limit,
+                   bool do_expensive_check);
+
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>
+  multi_source_bfs(raft::handle_t const &handle,
+                   graph_view_t<int32_t, int64_t, double, false, true> const &graph_view,
+                   int32_t const *sources,
+                   size_t num_sources,
+                   int32_t depth_limit,
+                   bool do_expensive_check);
+
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int64_t>, rmm::device_uvector<int64_t>>
+  multi_source_bfs(raft::handle_t const &handle,
+                   graph_view_t<int64_t, int64_t, float, false, true> const &graph_view,
+                   int64_t const *sources,
+                   size_t num_sources,
+                   int64_t depth_limit,
+                   bool do_expensive_check);
+
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int64_t>, rmm::device_uvector<int64_t>>
+  multi_source_bfs(raft::handle_t const &handle,
+                   graph_view_t<int64_t, int64_t, double, false, true> const &graph_view,
+                   int64_t const *sources,
+                   size_t num_sources,
+                   int64_t depth_limit,
+                   bool do_expensive_check);
+
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>
+  multi_source_bfs(raft::handle_t const &handle,
+                   graph_view_t<int32_t, int32_t, float, false, false> const &graph_view,
+                   int32_t const *sources,
+                   size_t num_sources,
+                   int32_t depth_limit,
+                   bool do_expensive_check);
+
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>
+  multi_source_bfs(raft::handle_t const &handle,
+                   graph_view_t<int32_t, int32_t, double, false, false> const &graph_view,
+                   int32_t const *sources,
+                   size_t num_sources,
+                   int32_t depth_limit,
+                   bool do_expensive_check);
+
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>
+  multi_source_bfs(raft::handle_t const &handle,
+                   graph_view_t<int32_t, int64_t, float, false, false> const &graph_view,
+                   int32_t const *sources,
+                   size_t num_sources,
+                   int32_t depth_limit,
+                   bool do_expensive_check);
+
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int32_t>, rmm::device_uvector<int32_t>>
+  multi_source_bfs(raft::handle_t const &handle,
+                   graph_view_t<int32_t, int64_t, double, false, false> const &graph_view,
+                   int32_t const *sources,
+                   size_t num_sources,
+                   int32_t depth_limit,
+                   bool do_expensive_check);
+
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int64_t>, rmm::device_uvector<int64_t>>
+  multi_source_bfs(raft::handle_t const &handle,
+                   graph_view_t<int64_t, int64_t, float, false, false> const &graph_view,
+                   int64_t const *sources,
+                   size_t num_sources,
+                   int64_t depth_limit,
+                   bool do_expensive_check);
+
+template std::
+  tuple<rmm::device_uvector<size_t>, rmm::device_uvector<int64_t>, rmm::device_uvector<int64_t>>
+  multi_source_bfs(raft::handle_t const &handle,
+                   graph_view_t<int64_t, int64_t, double, false, false> const &graph_view,
+                   int64_t const *sources,
+                   size_t num_sources,
+                   int64_t depth_limit,
+                   bool do_expensive_check);
+
+}  // namespace experimental
+}  // namespace cugraph
@@ -0,0 +1,603 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <experimental/detail/graph_utils.cuh>
+#include <experimental/graph_view.hpp>
+#include <matrix_partition_device.cuh>
+#include <utilities/dataframe_buffer.cuh>
+#include <utilities/error.hpp>
+#include <utilities/shuffle_comm.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/extrema.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/partition.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+// Building blocks for algorithms intersecting the (sorted) neighbor lists of vertex pairs (e.g.
+// similarity coefficients and triangle counting). In multi-GPU, the complete neighbor list of a
+// vertex is gathered on the GPU owning the vertex (graph_view_t stores the neighbor list of a
+// vertex in multiple adjacency matrix partitions) and the neighbor lists of remote vertices are
+// fetched from their owners.
+
+namespace cugraph {
+namespace experimental {
+namespace detail {
+
+// a pair is intersected by a warp (using merge path to split the merge of the two neighbor lists
+// to the lanes) if the sum of the two neighbor list sizes exceeds this threshold, and by a single
+// thread otherwise
+static constexpr size_t warp_intersection_threshold{128};
+static constexpr size_t intersection_block_size{256};
+static constexpr size_t max_intersection_grid_size{65535};
+
+// neighbor lists in CSR, the neighbor list of the pair_id'th pair is
+// indices[offsets[rows[pair_id]], offsets[rows[pair_id] + 1]) (and should be sorted), if degrees is
+// not nullptr, only the first degrees[rows[pair_id]] elements of the list are used
+template <typename vertex_t, typename edge_t>
+struct neighbor_lists_t {
+  edge_t const *offsets{nullptr};
+  vertex_t const *indices{nullptr};
+  vertex_t const *rows{nullptr};
+  edge_t const *degrees{nullptr};
+
+  __host__ __device__ edge_t offset(size_t pair_id) const { return offsets[rows[pair_id]]; }
+
+  __host__ __device__ vertex_t const *neighbors(size_t pair_id) const
+  {
+    return indices + offsets[rows[pair_id]];
+  }
+
+  __host__ __device__ edge_t degree(size_t pair_id) const
+  {
+    return degrees != nullptr ? degrees[rows[pair_id]]
+                              : offsets[rows[pair_id] + 1] - offsets[rows[pair_id]];
+  }
+};
+
+// match operator ignoring the matches (when only the intersection sizes are necessary)
+struct ignore_intersection_match_t {
+  template <typename edge_t>
+  __device__ void operator()(size_t pair_id, edge_t first_list_index) const
+  {
+  }
+};
+
+// number of elements of the merge of a and b taken from a in the first diagonal elements (ties are
+// taken from a first)
+template <typename vertex_t, typename edge_t>
+__device__ edge_t merge_path_search(
+  vertex_t const *a, edge_t a_size, vertex_t const *b, edge_t b_size, edge_t diagonal)
+{
+  auto lo = diagonal > b_size ? diagonal - b_size : edge_t{0};
+  auto hi = diagonal < a_size ? diagonal : a_size;
+  while (lo < hi) {
+    auto mid = lo + (hi - lo) / 2;
+    if (a[mid] <= b[diagonal - 1 - mid]) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+// merges num_steps elements starting from (a + i, b + j), an element of a matches if the next
+// element of b (which can be beyond the num_steps elements) is equal; match_op is called with the
+// index (in a) of every match
+template <typename vertex_t, typename edge_t, typename MatchOp>
+__device__ edge_t merge_intersect(vertex_t const *a,
+                                  edge_t a_size,
+                                  vertex_t const *b,
+                                  edge_t b_size,
+                                  edge_t i,
+                                  edge_t j,
+                                  edge_t num_steps,
+                                  size_t pair_id,
+                                  MatchOp match_op)
+{
+  edge_t count{0};
+  for (edge_t s = 0; s < num_steps; ++s) {
+    if ((i < a_size) && ((j >= b_size) || (a[i] <= b[j]))) {
+      if ((j < b_size) && (a[i] == b[j])) {
+        match_op(pair_id, i);
+        ++count;
+      }
+      ++i;
+    } else {
+      ++j;
+    }
+  }
+  return count;
+}
+
+template <typename vertex_t, typename edge_t, typename MatchOp>
+__global__ void per_thread_intersection_size(neighbor_lists_t<vertex_t, edge_t> first_lists,
+                                             neighbor_lists_t<vertex_t, edge_t> second_lists,
+                                             size_t const *pair_ids,
+                                             size_t num_pairs,
+                                             edge_t *intersection_sizes,
+                                             MatchOp match_op)
+{
+  for (size_t idx = threadIdx.x + blockIdx.x * static_cast<size_t>(blockDim.x); idx < num_pairs;
+       idx += gridDim.x * static_cast<size_t>(blockDim.x)) {
+    auto pair_id = pair_ids[idx];
+    auto a_size  = first_lists.degree(pair_id);
+    auto b_size  = second_lists.degree(pair_id);
+    intersection_sizes[pair_id] = merge_intersect(first_lists.neighbors(pair_id),
+                                                  a_size,
+                                                  second_lists.neighbors(pair_id),
+                                                  b_size,
+                                                  edge_t{0},
+                                                  edge_t{0},
+                                                  a_size + b_size,
+                                                  pair_id,
+                                                  match_op);
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename MatchOp>
+__global__ void per_warp_intersection_size(neighbor_lists_t<vertex_t, edge_t> first_lists,
+                                           neighbor_lists_t<vertex_t, edge_t> second_lists,
+                                           size_t const *pair_ids,
+                                           size_t num_pairs,
+                                           edge_t *intersection_sizes,
+                                           MatchOp match_op)
+{
+  auto const lane_id    = threadIdx.x % raft::warp_size();
+  auto const num_warps  = (gridDim.x * static_cast<size_t>(blockDim.x)) / raft::warp_size();
+  auto const first_warp =
+    (threadIdx.x + blockIdx.x * static_cast<size_t>(blockDim.x)) / raft::warp_size();
+
+  for (size_t idx = first_warp; idx < num_pairs; idx += num_warps) {
+    auto pair_id = pair_ids[idx];
+    auto a       = first_lists.neighbors(pair_id);
+    auto a_size  = first_lists.degree(pair_id);
+    auto b       = second_lists.neighbors(pair_id);
+    auto b_size  = second_lists.degree(pair_id);
+
+    auto merge_size     = a_size + b_size;
+    auto chunk_size     = (merge_size + raft::warp_size() - 1) / raft::warp_size();
+    auto diagonal_first = thrust::min(static_cast<edge_t>(lane_id) * chunk_size, merge_size);
+    auto diagonal_last  = thrust::min(diagonal_first + chunk_size, merge_size);
+
+    auto i     = merge_path_search(a, a_size, b, b_size, diagonal_first);
+    auto count = merge_intersect(a,
+                                 a_size,
+                                 b,
+                                 b_size,
+                                 i,
+                                 diagonal_first - i,
+                                 diagonal_last - diagonal_first,
+                                 pair_id,
+                                 match_op);
+
+    for (int offset = raft::warp_size() / 2; offset > 0; offset /= 2) {
+      count += __shfl_down_sync(raft::warp_full_mask(), count, offset);
+    }
+    if (lane_id == 0) { intersection_sizes[pair_id] = count; }
+  }
+}
+
+template <typename vertex_t, typename edge_t>
+struct is_low_degree_pair_t {
+  neighbor_lists_t<vertex_t, edge_t> first_lists{};
+  neighbor_lists_t<vertex_t, edge_t> second_lists{};
+
+  __device__ bool operator()(size_t pair_id) const
+  {
+    return static_cast<size_t>(first_lists.degree(pair_id) + second_lists.degree(pair_id)) <=
+           warp_intersection_threshold;
+  }
+};
+
+// compute the intersection size of the neighbor lists of each pair (the pair_id'th pair's first
+// and second neighbor lists), match_op(pair_id, index of the match in the first neighbor list) is
+// called for every match
+template <typename vertex_t, typename edge_t, typename MatchOp = ignore_intersection_match_t>
+void compute_intersection_sizes(raft::handle_t const &handle,
+                                neighbor_lists_t<vertex_t, edge_t> first_lists,
+                                neighbor_lists_t<vertex_t, edge_t> second_lists,
+                                size_t num_pairs,
+                                edge_t *intersection_sizes,
+                                MatchOp match_op = ignore_intersection_match_t{})
+{
+  auto stream = handle.get_stream();
+
+  rmm::device_uvector<size_t> pair_ids_v(num_pairs, stream);
+  thrust::sequence(
+    rmm::exec_policy(stream)->on(stream), pair_ids_v.begin(), pair_ids_v.end(), size_t{0});
+  auto num_low_degree_pairs = static_cast<size_t>(
+    thrust::distance(pair_ids_v.begin(),
+                     thrust::partition(rmm::exec_policy(stream)->on(stream),
+                                       pair_ids_v.begin(),
+                                       pair_ids_v.end(),
+                                       is_low_degree_pair_t<vertex_t, edge_t>{first_lists,
+                                                                              second_lists})));
+  auto num_high_degree_pairs = num_pairs - num_low_degree_pairs;
+
+  if (num_low_degree_pairs > 0) {
+    auto grid_size =
+      std::min((num_low_degree_pairs + intersection_block_size - 1) / intersection_block_size,
+               max_intersection_grid_size);
+    per_thread_intersection_size<<<grid_size, intersection_block_size, 0, stream>>>(
+      first_lists,
+      second_lists,
+      pair_ids_v.data(),
+      num_low_degree_pairs,
+      intersection_sizes,
+      match_op);
+    CUDA_TRY(cudaGetLastError());
+  }
+  if (num_high_degree_pairs > 0) {
+    auto warps_per_block = intersection_block_size / raft::warp_size();
+    auto grid_size       = std::min((num_high_degree_pairs + warps_per_block - 1) / warps_per_block,
+                              max_intersection_grid_size);
+    per_warp_intersection_size<<<grid_size, intersection_block_size, 0, stream>>>(
+      first_lists,
+      second_lists,
+      pair_ids_v.data() + num_low_degree_pairs,
+      num_high_degree_pairs,
+      intersection_sizes,
+      match_op);
+    CUDA_TRY(cudaGetLastError());
+  }
+}
+
+template <typename vertex_t, typename tuple_t>
+struct first_element_to_gpu_id_t {
+  vertex_to_gpu_id_t<vertex_t> vertex_to_gpu_id{};
+
+  __device__ int operator()(tuple_t t) const { return vertex_to_gpu_id(thrust::get<0>(t)); }
+};
+
+template <typename GraphViewType>
+rmm::device_uvector<typename GraphViewType::vertex_type> vertex_partition_lasts(
+  raft::handle_t const &handle, GraphViewType const &graph_view)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto const comm_size = handle.get_comms().get_size();
+
+  std::vector<vertex_t> h_vertex_partition_lasts(comm_size);
+  for (int i = 0; i < comm_size; ++i) {
+    h_vertex_partition_lasts[i] = graph_view.get_vertex_partition_last(i);
+  }
+  rmm::device_uvector<vertex_t> d_vertex_partition_lasts(h_vertex_partition_lasts.size(),
+                                                         handle.get_stream());
+  raft::update_device(d_vertex_partition_lasts.data(),
+                      h_vertex_partition_lasts.data(),
+                      h_vertex_partition_lasts.size(),
+                      handle.get_stream());
+  CUDA_TRY(cudaStreamSynchronize(
+    handle.get_stream()));  // h_vertex_partition_lasts will become out-of-scope
+
+  return d_vertex_partition_lasts;
+}
+
+template <typename GraphViewType>
+struct decompress_matrix_partition_t {
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  matrix_partition_device_t<GraphViewType> matrix_partition;
+  vertex_t *majors{nullptr};
+  vertex_t *minors{nullptr};
+
+  __device__ void operator()(vertex_t major_offset) const
+  {
+    auto local_offset = matrix_partition.get_local_offset(major_offset);
+    auto local_degree = matrix_partition.get_local_degree(major_offset);
+    auto major        = matrix_partition.get_major_from_major_offset_nocheck(major_offset);
+    for (edge_t i = 0; i < local_degree; ++i) {
+      majors[local_offset + i] = major;
+      minors[local_offset + i] = matrix_partition.get_minor_nocheck(local_offset + i);
+    }
+  }
+};
+
+// local edges (in the adjacency matrix partition order) as (major, minor) pairs
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>>
+decompress_local_edges(raft::handle_t const &handle, GraphViewType const &graph_view)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto stream = handle.get_stream();
+
+  size_t num_local_edges{0};
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    num_local_edges += graph_view.get_number_of_local_adj_matrix_partition_edges(i);
+  }
+
+  rmm::device_uvector<vertex_t> majors_v(num_local_edges, stream);
+  rmm::device_uvector<vertex_t> minors_v(num_local_edges, stream);
+  size_t edge_displacement{0};
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    matrix_partition_device_t<GraphViewType> matrix_partition(graph_view, i);
+    thrust::for_each(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator(vertex_t{0}),
+      thrust::make_counting_iterator(matrix_partition.get_major_size()),
+      decompress_matrix_partition_t<GraphViewType>{matrix_partition,
+                                                   majors_v.data() + edge_displacement,
+                                                   minors_v.data() + edge_displacement});
+    edge_displacement += graph_view.get_number_of_local_adj_matrix_partition_edges(i);
+  }
+
+  return std::make_tuple(std::move(majors_v), std::move(minors_v));
+}
+
+// sort (and optionally remove duplicates from) an edge list with every row in [row_first, row_first
+// + num_rows) and compress to CSR (offsets are relative to row_first)
+template <typename edge_t, typename vertex_t>
+std::tuple<rmm::device_uvector<edge_t>, rmm::device_uvector<vertex_t>> compress_edgelist(
+  raft::handle_t const &handle,
+  rmm::device_uvector<vertex_t> &&rows,
+  rmm::device_uvector<vertex_t> &&cols,
+  vertex_t row_first,
+  vertex_t num_rows,
+  bool remove_duplicates)
+{
+  auto stream = handle.get_stream();
+
+  auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(rows.begin(), cols.begin()));
+  thrust::sort(rmm::exec_policy(stream)->on(stream), edge_first, edge_first + rows.size());
+  if (remove_duplicates) {
+    auto num_edges = static_cast<size_t>(thrust::distance(
+      edge_first,
+      thrust::unique(rmm::exec_policy(stream)->on(stream), edge_first, edge_first + rows.size())));
+    rows.resize(num_edges, stream);
+    cols.resize(num_edges, stream);
+  }
+
+  rmm::device_uvector<edge_t> offsets(num_rows + 1, stream);
+  thrust::lower_bound(rmm::exec_policy(stream)->on(stream),
+                      rows.begin(),
+                      rows.end(),
+                      thrust::make_counting_iterator(row_first),
+                      thrust::make_counting_iterator(row_first + num_rows + 1),
+                      offsets.begin());
+
+  rows.resize(0, stream);
+  rows.shrink_to_fit(stream);
+
+  return std::make_tuple(std::move(offsets), std::move(cols));
+}
+
+// shuffle edges to the GPUs owning the edge rows
+template <typename vertex_t>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<vertex_t>>
+shuffle_edges_to_row_owners(raft::handle_t const &handle,
+                            vertex_to_gpu_id_t<vertex_t> vertex_to_gpu_id,
+                            rmm::device_uvector<vertex_t> &&rows,
+                            rmm::device_uvector<vertex_t> &&cols)
+{
+  auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(rows.begin(), cols.begin()));
+
+  rmm::device_uvector<vertex_t> rx_rows(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> rx_cols(0, handle.get_stream());
+  std::forward_as_tuple(std::tie(rx_rows, rx_cols), std::ignore) =
+    groupby_gpuid_and_shuffle_values(
+      handle.get_comms(),
+      edge_first,
+      edge_first + rows.size(),
+      first_element_to_gpu_id_t<vertex_t, thrust::tuple<vertex_t, vertex_t>>{vertex_to_gpu_id},
+      handle.get_stream());
+
+  return std::make_tuple(std::move(rx_rows), std::move(rx_cols));
+}
+
+template <typename vertex_t, typename edge_t>
+struct copy_neighbor_list_t {
+  vertex_t const *requested_vertices{nullptr};
+  edge_t const *tx_list_offsets{nullptr};
+  edge_t const *offsets{nullptr};
+  vertex_t const *indices{nullptr};
+  edge_t const *degrees{nullptr};
+  vertex_t *tx_lists{nullptr};
+  vertex_t local_first{};
+
+  __device__ void operator()(size_t i) const
+  {
+    auto v      = requested_vertices[i] - local_first;
+    auto degree = degrees != nullptr ? degrees[v] : offsets[v + 1] - offsets[v];
+    thrust::copy(thrust::seq,
+                 indices + offsets[v],
+                 indices + offsets[v] + degree,
+                 tx_lists + tx_list_offsets[i]);
+  }
+};
+
+template <typename vertex_t>
+struct vertex_to_position_t {
+  vertex_t const *sorted_vertices{nullptr};
+  vertex_t const *positions{nullptr};
+  size_t num_vertices{0};
+
+  __device__ vertex_t operator()(vertex_t v) const
+  {
+    return positions[thrust::distance(
+      sorted_vertices,
+      thrust::lower_bound(thrust::seq, sorted_vertices, sorted_vertices + num_vertices, v))];
+  }
+};
+
+/**
+ * @brief Fetch the neighbor lists of (possibly remote) vertices from the GPUs owning the vertices.
+ *
+ * Every GPU should hold the (complete) neighbor lists of its local vertices in [local_first,
+ * local_first + local_offsets.size() - 1) in CSR. This function is collective.
+ *
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param vertex_to_gpu_id Vertex ID to owning GPU ID mapping.
+ * @param local_first First vertex ID of the local vertices.
+ * @param local_offsets CSR offsets of the local vertices' neighbor lists.
+ * @param local_indices CSR indices of the local vertices' neighbor lists.
+ * @param vertices Vertices to fetch the neighbor lists (can have duplicates), on return, the
+ * elements are replaced with the row indices in the returned CSR.
+ * @param num_vertices Number of vertices in @p vertices.
+ * @param local_degrees If not nullptr, only the first local_degrees[v - local_first] elements of
+ * the neighbor list of a local vertex v are fetched.
+ * @return std::tuple<rmm::device_uvector<edge_t>, rmm::device_uvector<vertex_t>> Offsets and
+ * indices of the fetched neighbor lists.
+ */
+template <typename vertex_t, typename edge_t>
+std::tuple<rmm::device_uvector<edge_t>, rmm::device_uvector<vertex_t>> gather_neighbor_lists(
+  raft::handle_t const &handle,
+  vertex_to_gpu_id_t<vertex_t> vertex_to_gpu_id,
+  vertex_t local_first,
+  rmm::device_uvector<edge_t> const &local_offsets,
+  rmm::device_uvector<vertex_t> const &local_indices,
+  vertex_t *vertices,
+  size_t num_vertices,
+  edge_t const *local_degrees = nullptr)
+{
+  auto &comm           = handle.get_comms();
+  auto const comm_size = comm.get_size();
+  auto stream          = handle.get_stream();
+
+  rmm::device_uvector<vertex_t> requested_v(num_vertices, stream);
+  thrust::copy(
+    rmm::exec_policy(stream)->on(stream), vertices, vertices + num_vertices, requested_v.begin());
+  thrust::sort(rmm::exec_policy(stream)->on(stream), requested_v.begin(), requested_v.end());
+  requested_v.resize(
+    static_cast<size_t>(thrust::distance(
+      requested_v.begin(),
+      thrust::unique(
+        rmm::exec_policy(stream)->on(stream), requested_v.begin(), requested_v.end()))),
+    stream);
+
+  // requested_v is re-ordered by groupby_gpuid_and_shuffle_values (the received degrees and
+  // neighbor lists follow this order)
+  rmm::device_uvector<vertex_t> rx_requested_v(0, stream);
+  std::vector<size_t> request_rx_counts{};
+  std::tie(rx_requested_v, request_rx_counts) = groupby_gpuid_and_shuffle_values(
+    comm,
+    requested_v.begin(),
+    requested_v.end(),
+    [vertex_to_gpu_id] __device__(auto v) { return vertex_to_gpu_id(v); },
+    stream);
+
+  rmm::device_uvector<edge_t> tx_degrees_v(rx_requested_v.size(), stream);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    rx_requested_v.begin(),
+                    rx_requested_v.end(),
+                    tx_degrees_v.begin(),
+                    [offsets = local_offsets.data(), local_degrees, local_first] __device__(
+                      auto v) {
+                      return local_degrees != nullptr
+                               ? local_degrees[v - local_first]
+                               : offsets[v - local_first + 1] - offsets[v - local_first];
+                    });
+  rmm::device_uvector<edge_t> tx_list_offsets_v(tx_degrees_v.size() + 1, stream);
+  edge_t zero{0};
+  tx_list_offsets_v.set_element_async(0, zero, stream);
+  thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         tx_degrees_v.begin(),
+                         tx_degrees_v.end(),
+                         tx_list_offsets_v.begin() + 1);
+
+  std::vector<edge_t> h_tx_list_offsets(tx_list_offsets_v.size());
+  raft::update_host(
+    h_tx_list_offsets.data(), tx_list_offsets_v.data(), tx_list_offsets_v.size(), stream);
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  std::vector<size_t> tx_list_counts(comm_size, size_t{0});
+  {
+    size_t displacement{0};
+    for (int i = 0; i < comm_size; ++i) {
+      tx_list_counts[i] = static_cast<size_t>(
+        h_tx_list_offsets[displacement + request_rx_counts[i]] - h_tx_list_offsets[displacement]);
+      displacement += request_rx_counts[i];
+    }
+  }
+
+  rmm::device_uvector<vertex_t> tx_lists_v(h_tx_list_offsets.back(), stream);
+  thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(rx_requested_v.size()),
+                   copy_neighbor_list_t<vertex_t, edge_t>{rx_requested_v.data(),
+                                                          tx_list_offsets_v.data(),
+                                                          local_offsets.data(),
+                                                          local_indices.data(),
+                                                          local_degrees,
+                                                          tx_lists_v.data(),
+                                                          local_first});
+
+  rmm::device_uvector<edge_t> rx_degrees_v(0, stream);
+  std::tie(rx_degrees_v, std::ignore) =
+    shuffle_values(comm, tx_degrees_v.begin(), request_rx_counts, stream);
+  rmm::device_uvector<vertex_t> rx_indices_v(0, stream);
+  std::tie(rx_indices_v, std::ignore) =
+    shuffle_values(comm, tx_lists_v.begin(), tx_list_counts, stream);
+
+  tx_degrees_v.release();
+  tx_list_offsets_v.release();
+  tx_lists_v.release();
+  rx_requested_v.release();
+
+  rmm::device_uvector<edge_t> rx_offsets_v(rx_degrees_v.size() + 1, stream);
+  rx_offsets_v.set_element_async(0, zero, stream);
+  thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         rx_degrees_v.begin(),
+                         rx_degrees_v.end(),
+                         rx_offsets_v.begin() + 1);
+  rx_degrees_v.release();
+
+  rmm::device_uvector<vertex_t> requested_positions_v(requested_v.size(), stream);
+  thrust::sequence(rmm::exec_policy(stream)->on(stream),
+                   requested_positions_v.begin(),
+                   requested_positions_v.end(),
+                   vertex_t{0});
+  thrust::sort_by_key(rmm::exec_policy(stream)->on(stream),
+                      requested_v.begin(),
+                      requested_v.end(),
+                      requested_positions_v.begin());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    vertices,
+                    vertices + num_vertices,
+                    vertices,
+                    vertex_to_position_t<vertex_t>{
+                      requested_v.data(), requested_positions_v.data(), requested_v.size()});
+
+  CUDA_TRY(cudaStreamSynchronize(stream));  // zero will become out-of-scope
+
+  return std::make_tuple(std::move(rx_offsets_v), std::move(rx_indices_v));
+}
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cugraph
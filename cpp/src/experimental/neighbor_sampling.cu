@@ -0,0 +1,450 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithms.hpp>
+#include <experimental/graph_view.hpp>
+#include <matrix_partition_device.cuh>
+#include <partition_manager.hpp>
+#include <utilities/device_comm.cuh>
+#include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+#include <utilities/shuffle_comm.cuh>
+#include "neighbor_intersection.cuh"
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/merge.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+// Sampling k out-edges of a vertex without replacement is done by assigning a random key to every
+// out-edge and keeping the k edges with the smallest keys; with key = -log(u) / w (u uniform in
+// (0, 1], Efraimidis-Spirakis), this samples uniformly if every w is 1 and proportionally to the
+// edge weights otherwise. Keeping the k smallest keys of the union of the neighbor list parts is
+// the same as keeping the k smallest keys of the union of the k smallest keys of every part, so in
+// multi-GPU each GPU storing a part of a neighbor list (adjacency matrix partitions split a
+// neighbor list over the column communicator) samples its part and the GPU requesting the vertex
+// merges the candidates; only the frontier neighbor lists (not the k-hop neighborhoods) are
+// scanned and only the sampled edges are kept between hops.
+
+namespace cugraph {
+namespace experimental {
+namespace detail {
+
+// splitmix64 finalizer, maps counters to (statistically) independent 64 bit random numbers
+__device__ inline uint64_t splitmix64(uint64_t x)
+{
+  x += uint64_t{0x9e3779b97f4a7c15};
+  x = (x ^ (x >> 30)) * uint64_t{0xbf58476d1ce4e5b9};
+  x = (x ^ (x >> 27)) * uint64_t{0x94d049bb133111eb};
+  return x ^ (x >> 31);
+}
+
+__device__ inline double sampling_key(uint64_t r, double w)
+{
+  auto u = (static_cast<double>(r >> 11) + 1.0) / 9007199254740992.0;  // (0, 1], 2^53 levels
+  return w > 0.0 ? -log(u) / w : std::numeric_limits<double>::infinity();
+}
+
+template <typename vertex_t, typename weight_t>
+using sampled_edges_t = std::tuple<rmm::device_uvector<vertex_t>,
+                                   rmm::device_uvector<vertex_t>,
+                                   rmm::device_uvector<weight_t>>;
+
+// positions of the elements in their groups of consecutive equal keys
+template <typename KeyIterator>
+rmm::device_uvector<size_t> positions_in_groups(raft::handle_t const &handle,
+                                                KeyIterator key_first,
+                                                size_t num_elements)
+{
+  rmm::device_uvector<size_t> positions(num_elements, handle.get_stream());
+  thrust::exclusive_scan_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                                key_first,
+                                key_first + num_elements,
+                                thrust::make_constant_iterator(size_t{1}),
+                                positions.begin());
+  return positions;
+}
+
+// remove the elements beyond the first fan_out elements of their groups, returns the number of
+// remaining elements
+template <typename ValueIterator>
+size_t remove_beyond_fan_out(raft::handle_t const &handle,
+                             ValueIterator value_first,
+                             rmm::device_uvector<size_t> const &positions,
+                             int fan_out)
+{
+  auto value_last =
+    thrust::remove_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      value_first,
+                      value_first + positions.size(),
+                      positions.begin(),
+                      [fan_out] __device__(auto pos) {
+                        return pos >= static_cast<size_t>(fan_out);
+                      });
+  return static_cast<size_t>(thrust::distance(value_first, value_last));
+}
+
+// sample (at most) fan_out out-edges of every vertex in the (sorted, unique) frontier, returns the
+// sampled edges sorted by source
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+sampled_edges_t<vertex_t, weight_t> sample_frontier_out_edges(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  rmm::device_uvector<vertex_t> const &frontier,
+  int fan_out,
+  bool weighted,
+  uint64_t rng_seed,
+  size_t hop)
+{
+  using graph_view_type = graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>;
+
+  auto stream          = handle.get_stream();
+  auto const comm_rank = multi_gpu ? handle.get_comms().get_rank() : int{0};
+
+  // 1. send the frontier vertices to the GPUs storing (parts of) their neighbor lists (the GPUs in
+  // the column communicator of the vertex owner), the requesting GPU ranks are sent along
+
+  rmm::device_uvector<int> rx_ranks(frontier.size(), stream);
+  rmm::device_uvector<vertex_t> rx_majors(frontier.size(), stream);
+  thrust::fill(rmm::exec_policy(stream)->on(stream), rx_ranks.begin(), rx_ranks.end(), comm_rank);
+  thrust::copy(
+    rmm::exec_policy(stream)->on(stream), frontier.begin(), frontier.end(), rx_majors.begin());
+
+  if (multi_gpu) {
+    auto &comm     = handle.get_comms();
+    auto &col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+
+    auto d_vertex_partition_lasts = vertex_partition_lasts(handle, graph_view);
+    vertex_to_gpu_id_t<vertex_t> vertex_to_gpu_id{d_vertex_partition_lasts.data(),
+                                                  comm.get_size()};
+
+    auto pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(rx_ranks.begin(), rx_majors.begin()));
+    std::forward_as_tuple(std::tie(rx_ranks, rx_majors), std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        pair_first,
+        pair_first + rx_ranks.size(),
+        [vertex_to_gpu_id] __device__(auto val) { return vertex_to_gpu_id(thrust::get<1>(val)); },
+        stream);
+
+    auto rx_counts = host_scalar_allgather(col_comm, rx_ranks.size(), stream);
+    std::vector<size_t> displacements(rx_counts.size(), size_t{0});
+    std::partial_sum(rx_counts.begin(), rx_counts.end() - 1, displacements.begin() + 1);
+    rmm::device_uvector<int> gathered_ranks(displacements.back() + rx_counts.back(), stream);
+    rmm::device_uvector<vertex_t> gathered_majors(gathered_ranks.size(), stream);
+    device_allgatherv(
+      col_comm,
+      thrust::make_zip_iterator(thrust::make_tuple(rx_ranks.begin(), rx_majors.begin())),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(gathered_ranks.begin(), gathered_majors.begin())),
+      rx_counts,
+      displacements,
+      stream);
+    rx_ranks  = std::move(gathered_ranks);
+    rx_majors = std::move(gathered_majors);
+  }
+
+  // 2. enumerate the local out-edges of the received vertices (every received vertex is a major of
+  // exactly one local adjacency matrix partition) with their sampling keys
+
+  auto num_pairs = rx_majors.size();
+
+  rmm::device_uvector<edge_t> local_degrees(num_pairs, stream);
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    matrix_partition_device_t<graph_view_type> matrix_partition(graph_view, i);
+    thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(num_pairs),
+                     [matrix_partition,
+                      majors  = rx_majors.data(),
+                      degrees = local_degrees.data()] __device__(auto pair_idx) {
+                       auto major = majors[pair_idx];
+                       if ((major >= matrix_partition.get_major_first()) &&
+                           (major < matrix_partition.get_major_last())) {
+                         degrees[pair_idx] = matrix_partition.get_local_degree(
+                           matrix_partition.get_major_offset_from_major_nocheck(major));
+                       }
+                     });
+  }
+
+  rmm::device_uvector<size_t> edge_offsets(num_pairs, stream);
+  thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         local_degrees.begin(),
+                         local_degrees.end(),
+                         edge_offsets.begin(),
+                         size_t{0});
+  auto num_edges = thrust::reduce(rmm::exec_policy(stream)->on(stream),
+                                  local_degrees.begin(),
+                                  local_degrees.end(),
+                                  size_t{0});
+
+  rmm::device_uvector<int> candidate_ranks(num_edges, stream);
+  rmm::device_uvector<vertex_t> candidate_srcs(num_edges, stream);
+  rmm::device_uvector<vertex_t> candidate_dsts(num_edges, stream);
+  rmm::device_uvector<weight_t> candidate_weights(num_edges, stream);
+  rmm::device_uvector<double> candidate_keys(num_edges, stream);
+  for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    matrix_partition_device_t<graph_view_type> matrix_partition(graph_view, i);
+    // FIXME: a thread enumerates a whole neighbor list, this can be unbalanced for high degree
+    // frontier vertices
+    thrust::for_each(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_pairs),
+      [matrix_partition,
+       ranks       = rx_ranks.data(),
+       majors      = rx_majors.data(),
+       offsets     = edge_offsets.data(),
+       out_ranks   = candidate_ranks.data(),
+       out_srcs    = candidate_srcs.data(),
+       out_dsts    = candidate_dsts.data(),
+       out_weights = candidate_weights.data(),
+       out_keys    = candidate_keys.data(),
+       weighted,
+       stream_seed = rng_seed ^ (static_cast<uint64_t>(hop) << 48),
+       gpu_salt    = static_cast<uint64_t>(comm_rank) << 32] __device__(auto pair_idx) {
+        auto major = majors[pair_idx];
+        if ((major >= matrix_partition.get_major_first()) &&
+            (major < matrix_partition.get_major_last())) {
+          auto local_edges = matrix_partition.get_local_edges(
+            matrix_partition.get_major_offset_from_major_nocheck(major));
+          auto indices = thrust::get<0>(local_edges);
+          auto weights = thrust::get<1>(local_edges);
+          auto degree  = thrust::get<2>(local_edges);
+          auto offset  = offsets[pair_idx];
+          auto pair_seed =
+            splitmix64(stream_seed ^ splitmix64(static_cast<uint64_t>(major) ^ gpu_salt) ^
+                       static_cast<uint64_t>(ranks[pair_idx]));
+          for (edge_t j = 0; j < degree; ++j) {
+            auto w                  = weights != nullptr ? weights[j] : weight_t{1.0};
+            auto r                  = splitmix64(pair_seed + static_cast<uint64_t>(j));
+            out_ranks[offset + j]   = ranks[pair_idx];
+            out_srcs[offset + j]    = major;
+            out_dsts[offset + j]    = indices[j];
+            out_weights[offset + j] = w;
+            out_keys[offset + j]    = sampling_key(r, weighted ? static_cast<double>(w) : 1.0);
+          }
+        }
+      });
+  }
+  local_degrees.resize(0, stream);
+  local_degrees.shrink_to_fit(stream);
+  edge_offsets.resize(0, stream);
+  edge_offsets.shrink_to_fit(stream);
+
+  // 3. keep the fan_out smallest keys of every (received) neighbor list part
+
+  if (fan_out >= 0) {
+    auto key_first = thrust::make_zip_iterator(
+      thrust::make_tuple(candidate_ranks.begin(), candidate_srcs.begin(), candidate_keys.begin()));
+    thrust::sort_by_key(rmm::exec_policy(stream)->on(stream),
+                        key_first,
+                        key_first + num_edges,
+                        thrust::make_zip_iterator(
+                          thrust::make_tuple(candidate_dsts.begin(), candidate_weights.begin())));
+    auto positions = positions_in_groups(
+      handle,
+      thrust::make_zip_iterator(
+        thrust::make_tuple(candidate_ranks.begin(), candidate_srcs.begin())),
+      num_edges);
+    num_edges = remove_beyond_fan_out(
+      handle,
+      thrust::make_zip_iterator(thrust::make_tuple(candidate_ranks.begin(),
+                                                   candidate_srcs.begin(),
+                                                   candidate_dsts.begin(),
+                                                   candidate_weights.begin(),
+                                                   candidate_keys.begin())),
+      positions,
+      fan_out);
+    candidate_ranks.resize(num_edges, stream);
+    candidate_srcs.resize(num_edges, stream);
+    candidate_dsts.resize(num_edges, stream);
+    candidate_weights.resize(num_edges, stream);
+    candidate_keys.resize(num_edges, stream);
+  }
+
+  // 4. send the candidates to the requesting GPUs and merge the candidates of the neighbor list
+  // parts
+
+  if (multi_gpu) {
+    auto &comm = handle.get_comms();
+
+    auto candidate_first = thrust::make_zip_iterator(thrust::make_tuple(candidate_ranks.begin(),
+                                                                        candidate_srcs.begin(),
+                                                                        candidate_dsts.begin(),
+                                                                        candidate_weights.begin(),
+                                                                        candidate_keys.begin()));
+    std::forward_as_tuple(
+      std::tie(candidate_ranks, candidate_srcs, candidate_dsts, candidate_weights, candidate_keys),
+      std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        candidate_first,
+        candidate_first + candidate_ranks.size(),
+        [] __device__(auto val) { return thrust::get<0>(val); },
+        stream);
+    candidate_ranks.resize(0, stream);
+    candidate_ranks.shrink_to_fit(stream);
+    num_edges = candidate_srcs.size();
+
+    auto key_first = thrust::make_zip_iterator(
+      thrust::make_tuple(candidate_srcs.begin(), candidate_keys.begin()));
+    thrust::sort_by_key(rmm::exec_policy(stream)->on(stream),
+                        key_first,
+                        key_first + num_edges,
+                        thrust::make_zip_iterator(
+                          thrust::make_tuple(candidate_dsts.begin(), candidate_weights.begin())));
+    if (fan_out >= 0) {
+      auto positions = positions_in_groups(handle, candidate_srcs.begin(), num_edges);
+      num_edges      = remove_beyond_fan_out(
+        handle,
+        thrust::make_zip_iterator(thrust::make_tuple(candidate_srcs.begin(),
+                                                     candidate_dsts.begin(),
+                                                     candidate_weights.begin())),
+        positions,
+        fan_out);
+      candidate_srcs.resize(num_edges, stream);
+      candidate_dsts.resize(num_edges, stream);
+      candidate_weights.resize(num_edges, stream);
+    }
+  }
+
+  return std::make_tuple(
+    std::move(candidate_srcs), std::move(candidate_dsts), std::move(candidate_weights));
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+std::vector<std::tuple<rmm::device_uvector<vertex_t>,
+                       rmm::device_uvector<vertex_t>,
+                       rmm::device_uvector<weight_t>>>
+neighbor_sample(raft::handle_t const &handle,
+                graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+                vertex_t const *seeds,
+                size_t num_seeds,
+                std::vector<int> const &fan_out,
+                bool weighted,
+                uint64_t rng_seed)
+{
+  auto stream = handle.get_stream();
+
+  CUGRAPH_EXPECTS((num_seeds == 0) || (seeds != nullptr),
+                  "Invalid input argument: seeds should not be nullptr.");
+  CUGRAPH_EXPECTS(!weighted || graph_view.is_weighted(),
+                  "Invalid input argument: weighted sampling requires a weighted graph.");
+
+  auto num_vertices = graph_view.get_number_of_vertices();
+  CUGRAPH_EXPECTS(
+    static_cast<size_t>(thrust::count_if(
+      rmm::exec_policy(stream)->on(stream),
+      seeds,
+      seeds + num_seeds,
+      [num_vertices] __device__(auto v) { return (v < 0) || (v >= num_vertices); })) == 0,
+    "Invalid input argument: seeds should be valid vertices.");
+
+  rmm::device_uvector<vertex_t> frontier(num_seeds, stream);
+  thrust::copy(rmm::exec_policy(stream)->on(stream), seeds, seeds + num_seeds, frontier.begin());
+  thrust::sort(rmm::exec_policy(stream)->on(stream), frontier.begin(), frontier.end());
+  frontier.resize(static_cast<size_t>(thrust::distance(
+                    frontier.begin(),
+                    thrust::unique(
+                      rmm::exec_policy(stream)->on(stream), frontier.begin(), frontier.end()))),
+                  stream);
+
+  std::vector<detail::sampled_edges_t<vertex_t, weight_t>> hops{};
+  hops.reserve(fan_out.size());
+  for (size_t hop = 0; hop < fan_out.size(); ++hop) {
+    hops.push_back(detail::sample_frontier_out_edges(
+      handle, graph_view, frontier, fan_out[hop], weighted, rng_seed, hop));
+
+    // the next frontier is the union of the current frontier and the sampled neighbors (the
+    // frontier vertices are the destinations of the next hop block)
+
+    if (hop + 1 < fan_out.size()) {
+      auto const &dsts = std::get<1>(hops.back());
+      rmm::device_uvector<vertex_t> sorted_dsts(dsts.size(), stream);
+      thrust::copy(
+        rmm::exec_policy(stream)->on(stream), dsts.begin(), dsts.end(), sorted_dsts.begin());
+      thrust::sort(rmm::exec_policy(stream)->on(stream), sorted_dsts.begin(), sorted_dsts.end());
+      rmm::device_uvector<vertex_t> next_frontier(frontier.size() + sorted_dsts.size(), stream);
+      auto last = thrust::merge(rmm::exec_policy(stream)->on(stream),
+                                frontier.begin(),
+                                frontier.end(),
+                                sorted_dsts.begin(),
+                                sorted_dsts.end(),
+                                next_frontier.begin());
+      last = thrust::unique(rmm::exec_policy(stream)->on(stream), next_frontier.begin(), last);
+      next_frontier.resize(static_cast<size_t>(thrust::distance(next_frontier.begin(), last)),
+                           stream);
+      frontier = std::move(next_frontier);
+    }
+  }
+
+  return hops;
+}
+
+// explicit instantiation
+
+#define INSTANTIATE_NEIGHBOR_SAMPLE(vertex_t, edge_t, weight_t, multi_gpu)                      \
+  template std::vector<std::tuple<rmm::device_uvector<vertex_t>,                               \
+                                  rmm::device_uvector<vertex_t>,                               \
+                                  rmm::device_uvector<weight_t>>>                              \
+  neighbor_sample(raft::handle_t const &handle,                                                \
+                  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view, \
+                  vertex_t const *seeds,                                                       \
+                  size_t num_seeds,                                                            \
+                  std::vector<int> const &fan_out,                                             \
+                  bool weighted,                                                               \
+                  uint64_t rng_seed);
+
+INSTANTIATE_NEIGHBOR_SAMPLE(int32_t, int32_t, float, false)
+INSTANTIATE_NEIGHBOR_SAMPLE(int32_t, int32_t, double, false)
+INSTANTIATE_NEIGHBOR_SAMPLE(int32_t, int64_t, float, false)
+INSTANTIATE_NEIGHBOR_SAMPLE(int32_t, int64_t, double, false)
+INSTANTIATE_NEIGHBOR_SAMPLE(int64_t, int64_t, float, false)
+INSTANTIATE_NEIGHBOR_SAMPLE(int64_t, int64_t, double, false)
+INSTANTIATE_NEIGHBOR_SAMPLE(int32_t, int32_t, float, true)
+INSTANTIATE_NEIGHBOR_SAMPLE(int32_t, int32_t, double, true)
+INSTANTIATE_NEIGHBOR_SAMPLE(int32_t, int64_t, float, true)
+INSTANTIATE_NEIGHBOR_SAMPLE(int32_t, int64_t, double, true)
+INSTANTIATE_NEIGHBOR_SAMPLE(int64_t, int64_t, float, true)
+INSTANTIATE_NEIGHBOR_SAMPLE(int64_t, int64_t, double, true)
+
+}  // namespace experimental
+}  // namespace cugraph
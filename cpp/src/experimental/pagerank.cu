@@ -14,28 +14,45 @@
  * limitations under the License.
  */
 
+#include "column_sums.cuh"
+
 #include <algorithms.hpp>
 #include <experimental/graph_view.hpp>
 #include <patterns/any_of_adj_matrix_row.cuh>
 #include <patterns/copy_to_adj_matrix_row_col.cuh>
+#include <patterns/copy_to_adj_matrix_row_col_bfloat16.cuh>
 #include <patterns/copy_v_transform_reduce_in_out_nbr.cuh>
 #include <patterns/count_if_e.cuh>
 #include <patterns/count_if_v.cuh>
 #include <patterns/reduce_v.cuh>
 #include <patterns/transform_reduce_v.cuh>
+#include <utilities/device_comm.cuh>
 #include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+#include <utilities/profiling.hpp>
 #include <vertex_partition_device.cuh>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <raft/handle.hpp>
+#include <rmm/device_scalar.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
 #include <thrust/fill.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
+#include <limits>
+#include <memory>
+
 namespace cugraph {
 namespace experimental {
 namespace detail {
@@ -53,7 +70,9 @@ void pagerank(raft::handle_t const& handle,
               result_t epsilon,
               size_t max_iterations,
               bool has_initial_guess,
-              bool do_expensive_check)
+              bool do_expensive_check,
+              size_t convergence_check_interval,
+              bool reduced_precision)
 {
   using vertex_t = typename GraphViewType::vertex_type;
   using weight_t = typename GraphViewType::weight_type;
@@ -65,6 +84,8 @@ void pagerank(raft::handle_t const& handle,
   static_assert(GraphViewType::is_adj_matrix_transposed,
                 "GraphViewType should support the pull model.");
 
+  profile_range_t profile_range(handle, "pagerank");
+
   auto const num_vertices = pull_graph_view.get_number_of_vertices();
   if (num_vertices == 0) { return; }
 
@@ -85,6 +106,8 @@ void pagerank(raft::handle_t const& handle,
   CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha <= 1.0),
                   "Invalid input argument: alpha should be in [0.0, 1.0].");
   CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+  CUGRAPH_EXPECTS(convergence_check_interval > 0,
+                  "Invalid input argument: convergence_check_interval should be positive.");
 
   if (do_expensive_check) {
     if (precomputed_vertex_out_weight_sums != nullptr) {
@@ -140,14 +163,12 @@ void pagerank(raft::handle_t const& handle,
     }
   }
 
-  // 2. compute the sums of the out-going edge weights (if not provided)
+  // 2. compute the sums of the out-going edge weights (if not provided, cached in the graph after
+  // the first call)
 
-  auto tmp_vertex_out_weight_sums = precomputed_vertex_out_weight_sums == nullptr
-                                      ? pull_graph_view.compute_out_weight_sums(handle)
-                                      : rmm::device_uvector<weight_t>(0, handle.get_stream());
   auto vertex_out_weight_sums = precomputed_vertex_out_weight_sums != nullptr
                                   ? precomputed_vertex_out_weight_sums
-                                  : tmp_vertex_out_weight_sums.data();
+                                  : pull_graph_view.get_out_weight_sums(handle);
 
   // 3. initialize pagerank values
 
@@ -183,11 +204,29 @@ void pagerank(raft::handle_t const& handle,
 
   // 5. pagerank iteration
 
+  // the dangling sum and the convergence measure stay in device memory, so the iteration runs
+  // without host synchronization between convergence checks
+
   // old PageRank values
   rmm::device_uvector<result_t> old_pageranks(pull_graph_view.get_number_of_local_vertices(),
                                               handle.get_stream());
+  // the adjacency matrix row values are stored (and communicated in multi-GPU) in bfloat16 till the
+  // iteration gets close to convergence if reduced_precision is true
+  auto use_bfloat16 = reduced_precision;
   rmm::device_uvector<result_t> adj_matrix_row_pageranks(
-    pull_graph_view.get_number_of_local_adj_matrix_partition_rows(), handle.get_stream());
+    use_bfloat16 ? size_t{0} : pull_graph_view.get_number_of_local_adj_matrix_partition_rows(),
+    handle.get_stream());
+  rmm::device_uvector<bfloat16_t> adj_matrix_row_bfloat16_pageranks(
+    use_bfloat16 ? pull_graph_view.get_number_of_local_adj_matrix_partition_rows() : vertex_t{0},
+    handle.get_stream());
+  rmm::device_scalar<result_t> dangling_sum(handle.get_stream());
+  rmm::device_scalar<result_t> diff_sum(handle.get_stream());
+  auto last_diff_sum = std::numeric_limits<result_t>::max();
+  // the CUDA stream and events for the multi-GPU copy_v_transform_reduce_in_nbr() calls are created
+  // once per run (instead of once per iteration)
+  auto pipeline_streams = GraphViewType::is_multi_gpu
+                            ? std::make_unique<major_reduce_pipeline_streams_t>()
+                            : std::unique_ptr<major_reduce_pipeline_streams_t>{nullptr};
   size_t iter{0};
   while (true) {
     thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
@@ -198,7 +237,7 @@ void pagerank(raft::handle_t const& handle,
     auto vertex_val_first =
       thrust::make_zip_iterator(thrust::make_tuple(pageranks, vertex_out_weight_sums));
 
-    auto dangling_sum = transform_reduce_v(
+    transform_reduce_v_async(
       handle,
       pull_graph_view,
       vertex_val_first,
@@ -207,7 +246,8 @@ void pagerank(raft::handle_t const& handle,
         auto const out_weight_sum = thrust::get<1>(val);
         return out_weight_sum == result_t{0.0} ? pagerank : result_t{0.0};
       },
-      result_t{0.0});
+      result_t{0.0},
+      dangling_sum.data());
 
     thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
                       vertex_val_first,
@@ -221,25 +261,49 @@ void pagerank(raft::handle_t const& handle,
                         return pagerank / divisor;
                       });
 
-    copy_to_adj_matrix_row(handle, pull_graph_view, pageranks, adj_matrix_row_pageranks.begin());
+    auto e_op = [alpha] __device__(
+                  vertex_t src, vertex_t dst, weight_t w, auto src_val, auto dst_val) {
+      return src_val * w * alpha;
+    };
+    if (use_bfloat16) {
+      copy_to_adj_matrix_row_bfloat16(
+        handle, pull_graph_view, pageranks, adj_matrix_row_bfloat16_pageranks.data());
 
-    auto unvarying_part = aggregate_personalization_vector_size == 0
-                            ? (dangling_sum * alpha + static_cast<result_t>(1.0 - alpha)) /
-                                static_cast<result_t>(num_vertices)
-                            : result_t{0.0};
+      copy_v_transform_reduce_in_nbr(
+        handle,
+        pull_graph_view,
+        make_bfloat16_input_iterator<result_t>(adj_matrix_row_bfloat16_pageranks.data()),
+        thrust::make_constant_iterator(0) /* dummy */,
+        e_op,
+        result_t{0.0},
+        pageranks,
+        pipeline_streams.get());
+    } else {
+      copy_to_adj_matrix_row(handle, pull_graph_view, pageranks, adj_matrix_row_pageranks.begin());
 
-    copy_v_transform_reduce_in_nbr(
-      handle,
-      pull_graph_view,
-      adj_matrix_row_pageranks.begin(),
-      thrust::make_constant_iterator(0) /* dummy */,
-      [alpha] __device__(vertex_t src, vertex_t dst, weight_t w, auto src_val, auto dst_val) {
-        return src_val * w * alpha;
-      },
-      unvarying_part,
-      pageranks);
+      copy_v_transform_reduce_in_nbr(handle,
+                                     pull_graph_view,
+                                     adj_matrix_row_pageranks.begin(),
+                                     thrust::make_constant_iterator(0) /* dummy */,
+                                     e_op,
+                                     result_t{0.0},
+                                     pageranks,
+                                     pipeline_streams.get());
+    }
 
-    if (aggregate_personalization_vector_size > 0) {
+    auto d_dangling_sum = dangling_sum.data();
+    if (aggregate_personalization_vector_size == 0) {
+      thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        pageranks,
+                        pageranks + pull_graph_view.get_number_of_local_vertices(),
+                        pageranks,
+                        [d_dangling_sum, alpha, num_vertices] __device__(auto val) {
+                          auto const unvarying_part =
+                            (*d_dangling_sum * alpha + static_cast<result_t>(1.0 - alpha)) /
+                            static_cast<result_t>(num_vertices);
+                          return val + unvarying_part;
+                        });
+    } else {
       vertex_partition_device_t<GraphViewType> vertex_partition(pull_graph_view);
       auto val_first = thrust::make_zip_iterator(
         thrust::make_tuple(personalization_vertices, personalization_values));
@@ -247,29 +311,390 @@ void pagerank(raft::handle_t const& handle,
         rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
         val_first,
         val_first + personalization_vector_size,
-        [vertex_partition, pageranks, dangling_sum, personalization_sum, alpha] __device__(
+        [vertex_partition, pageranks, d_dangling_sum, personalization_sum, alpha] __device__(
           auto val) {
           auto v     = thrust::get<0>(val);
           auto value = thrust::get<1>(val);
           *(pageranks + vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v)) +=
-            (dangling_sum * alpha + static_cast<result_t>(1.0 - alpha)) *
+            (*d_dangling_sum * alpha + static_cast<result_t>(1.0 - alpha)) *
             (value / personalization_sum);
         });
     }
 
-    auto diff_sum = transform_reduce_v(
+    transform_reduce_v_async(
       handle,
       pull_graph_view,
       thrust::make_zip_iterator(thrust::make_tuple(pageranks, old_pageranks.data())),
       [] __device__(auto val) { return std::abs(thrust::get<0>(val) - thrust::get<1>(val)); },
-      result_t{0.0});
+      result_t{0.0},
+      diff_sum.data());
+
+    iter++;
+    add_profile_counter("iterations", 1);
+
+    if ((iter % convergence_check_interval == 0) || (iter >= max_iterations)) {
+      auto h_diff_sum = diff_sum.value(handle.get_stream());
+      if (use_bfloat16) {
+        // the last iterations run in full precision to reach the full precision tolerance
+        if (detail::fall_back_from_bfloat16(h_diff_sum, last_diff_sum, epsilon)) {
+          use_bfloat16 = false;
+          adj_matrix_row_bfloat16_pageranks.resize(0, handle.get_stream());
+          adj_matrix_row_bfloat16_pageranks.shrink_to_fit(handle.get_stream());
+          adj_matrix_row_pageranks.resize(
+            pull_graph_view.get_number_of_local_adj_matrix_partition_rows(), handle.get_stream());
+          add_profile_counter("full_precision_fallbacks", 1);
+        }
+        last_diff_sum = h_diff_sum;
+        if (iter >= max_iterations) { CUGRAPH_FAIL("PageRank failed to converge."); }
+      } else if (h_diff_sum < epsilon) {
+        break;
+      } else if (iter >= max_iterations) {
+        CUGRAPH_FAIL("PageRank failed to converge.");
+      }
+    }
+  }
+}
+
+template <typename vertex_t, typename weight_t, typename result_t>
+struct column_major_to_dangling_pagerank_t {
+  result_t const* pageranks{nullptr};
+  weight_t const* vertex_out_weight_sums{nullptr};
+  vertex_t num_rows{};
+  size_t num_columns{};
+
+  __device__ result_t operator()(size_t i) const
+  {
+    auto v = static_cast<vertex_t>(i % num_rows);
+    return *(vertex_out_weight_sums + v) == weight_t{0.0}
+             ? *(pageranks + static_cast<size_t>(v) * num_columns + i / num_rows)
+             : result_t{0.0};
+  }
+};
+
+template <typename vertex_t, typename result_t>
+struct column_major_to_pagerank_diff_t {
+  result_t const* pageranks{nullptr};
+  result_t const* old_pageranks{nullptr};
+  vertex_t num_rows{};
+  size_t num_columns{};
+
+  __device__ result_t operator()(size_t i) const
+  {
+    auto offset = static_cast<size_t>(i % num_rows) * num_columns + i / num_rows;
+    return std::abs(*(pageranks + offset) - *(old_pageranks + offset));
+  }
+};
+
+template <typename vertex_t, typename result_t>
+struct column_major_to_pagerank_t {
+  result_t const* pageranks{nullptr};
+  vertex_t num_rows{};
+  size_t num_columns{};
+
+  __device__ result_t operator()(size_t i) const
+  {
+    return *(pageranks + static_cast<size_t>(i % num_rows) * num_columns + i / num_rows);
+  }
+};
+
+template <typename GraphViewType, typename result_t>
+void batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  GraphViewType const& pull_graph_view,
+  typename GraphViewType::weight_type const* precomputed_vertex_out_weight_sums,
+  size_t num_personalization_vectors,
+  typename GraphViewType::edge_type const* personalization_offsets,
+  typename GraphViewType::vertex_type const* personalization_vertices,
+  result_t const* personalization_values,
+  result_t* pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(std::is_floating_point<result_t>::value,
+                "result_t should be a floating-point type.");
+  static_assert(GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the pull model.");
+
+  profile_range_t profile_range(handle, "batched_personalized_pagerank");
+
+  auto const num_vertices       = pull_graph_view.get_number_of_vertices();
+  auto const num_local_vertices = pull_graph_view.get_number_of_local_vertices();
+  auto const num_columns        = num_personalization_vectors;
+  if ((num_vertices == 0) || (num_columns == 0)) { return; }
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(
+    (personalization_offsets != nullptr) && (personalization_vertices != nullptr) &&
+      (personalization_values != nullptr),
+    "Invalid input argument: personalization offsets, vertices, and values should be provided.");
+  CUGRAPH_EXPECTS((alpha >= 0.0) && (alpha <= 1.0),
+                  "Invalid input argument: alpha should be in [0.0, 1.0].");
+  CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative.");
+
+  edge_t num_personalization_entries{};
+  raft::update_host(&num_personalization_entries,
+                    personalization_offsets + num_columns,
+                    size_t{1},
+                    handle.get_stream());
+  handle.get_stream_view().synchronize();
+
+  if (do_expensive_check) {
+    if (precomputed_vertex_out_weight_sums != nullptr) {
+      auto num_negative_precomputed_vertex_out_weight_sums = count_if_v(
+        handle, pull_graph_view, precomputed_vertex_out_weight_sums, [] __device__(auto val) {
+          return val < result_t{0.0};
+        });
+      CUGRAPH_EXPECTS(
+        num_negative_precomputed_vertex_out_weight_sums == 0,
+        "Invalid input argument: outgoing edge weight sum values should be non-negative.");
+    }
+
+    if (pull_graph_view.is_weighted()) {
+      auto num_nonpositive_edge_weights = count_if_e(
+        handle,
+        pull_graph_view,
+        thrust::make_constant_iterator(0) /* dummy */,
+        thrust::make_constant_iterator(0) /* dummy */,
+        [] __device__(vertex_t src, vertex_t dst, weight_t w, auto src_val, auto dst_val) {
+          return w <= 0.0;
+        });
+      CUGRAPH_EXPECTS(num_nonpositive_edge_weights == 0,
+                      "Invalid input argument: input graph should have postive edge weights.");
+    }
+
+    if (has_initial_guess) {
+      auto num_negative_values =
+        thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                         pageranks,
+                         pageranks + static_cast<size_t>(num_local_vertices) * num_columns,
+                         [] __device__(auto val) { return val < 0.0; });
+      if (GraphViewType::is_multi_gpu) {
+        num_negative_values =
+          host_scalar_allreduce(handle.get_comms(), num_negative_values, handle.get_stream());
+      }
+      CUGRAPH_EXPECTS(num_negative_values == 0,
+                      "Invalid input argument: initial guess values should be non-negative.");
+    }
+
+    auto num_invalid_offsets = thrust::count_if(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(num_columns + 1),
+      [personalization_offsets] __device__(auto i) {
+        return i == 0 ? (*personalization_offsets != edge_t{0})
+                      : (*(personalization_offsets + i) < *(personalization_offsets + (i - 1)));
+      });
+    CUGRAPH_EXPECTS(num_invalid_offsets == 0,
+                    "Invalid input argument: personalization offsets should start from 0 and "
+                    "should be non-decreasing.");
+
+    vertex_partition_device_t<GraphViewType> vertex_partition(pull_graph_view);
+    auto num_invalid_vertices =
+      count_if_v(handle,
+                 pull_graph_view,
+                 personalization_vertices,
+                 personalization_vertices + num_personalization_entries,
+                 [vertex_partition] __device__(auto val) {
+                   return !(vertex_partition.is_valid_vertex(val) &&
+                            vertex_partition.is_local_vertex_nocheck(val));
+                 });
+    CUGRAPH_EXPECTS(num_invalid_vertices == 0,
+                    "Invalid input argument: peresonalization vertices have invalid vertex IDs.");
+    auto num_negative_values = count_if_v(handle,
+                                          pull_graph_view,
+                                          personalization_values,
+                                          personalization_values + num_personalization_entries,
+                                          [] __device__(auto val) { return val < 0.0; });
+    CUGRAPH_EXPECTS(num_negative_values == 0,
+                    "Invalid input argument: peresonalization values should be non-negative.");
+  }
+
+  // 2. compute the sums of the out-going edge weights (if not provided, cached in the graph after
+  // the first call)
+
+  auto vertex_out_weight_sums = precomputed_vertex_out_weight_sums != nullptr
+                                  ? precomputed_vertex_out_weight_sums
+                                  : pull_graph_view.get_out_weight_sums(handle);
+
+  // 3. initialize pagerank values
+
+  auto num_local_values = static_cast<size_t>(num_local_vertices) * num_columns;
+  if (has_initial_guess) {
+    auto sums = compute_column_sums<GraphViewType::is_multi_gpu, vertex_t, result_t>(
+      handle,
+      num_local_vertices,
+      num_columns,
+      column_major_to_pagerank_t<vertex_t, result_t>{pageranks, num_local_vertices, num_columns});
+    auto num_nonpositive_sums =
+      thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                       sums.begin(),
+                       sums.end(),
+                       [] __device__(auto val) { return val <= 0.0; });
+    CUGRAPH_EXPECTS(
+      num_nonpositive_sums == 0,
+      "Invalid input argument: sum of the PageRank initial guess values should be positive.");
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(num_local_values),
+                      pageranks,
+                      [pageranks, sums = sums.data(), num_columns] __device__(auto i) {
+                        return *(pageranks + i) / *(sums + i % num_columns);
+                      });
+  } else {
+    thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 pageranks,
+                 pageranks + num_local_values,
+                 result_t{1.0} / static_cast<result_t>(num_vertices));
+  }
+
+  // 4. sum the personalization values
+
+  rmm::device_uvector<result_t> personalization_sums(num_columns, handle.get_stream());
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               personalization_sums.begin(),
+               personalization_sums.end(),
+               result_t{0.0});
+  thrust::for_each(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    thrust::make_counting_iterator(edge_t{0}),
+    thrust::make_counting_iterator(num_personalization_entries),
+    [personalization_offsets,
+     personalization_values,
+     personalization_sums = personalization_sums.data(),
+     num_columns] __device__(auto i) {
+      auto j = thrust::distance(
+        personalization_offsets + 1,
+        thrust::upper_bound(
+          thrust::seq, personalization_offsets + 1, personalization_offsets + num_columns, i));
+      atomicAdd(personalization_sums + j, *(personalization_values + i));
+    });
+  if (GraphViewType::is_multi_gpu) {
+    device_allreduce(handle.get_comms(),
+                     personalization_sums.begin(),
+                     personalization_sums.begin(),
+                     personalization_sums.size(),
+                     raft::comms::op_t::SUM,
+                     handle.get_stream());
+  }
+  auto num_nonpositive_personalization_sums =
+    thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     personalization_sums.begin(),
+                     personalization_sums.end(),
+                     [] __device__(auto val) { return val <= 0.0; });
+  CUGRAPH_EXPECTS(num_nonpositive_personalization_sums == 0,
+                  "Invalid input argument: sum of personalization valuese should be positive.");
+
+  // 5. pagerank iteration
+
+  // old PageRank values
+  rmm::device_uvector<result_t> old_pageranks(num_local_values, handle.get_stream());
+  rmm::device_uvector<result_t> adj_matrix_row_pageranks(
+    static_cast<size_t>(pull_graph_view.get_number_of_local_adj_matrix_partition_rows()) *
+      num_columns,
+    handle.get_stream());
+  // the CUDA stream and events for the multi-GPU copy_v_transform_reduce_in_nbr() calls are created
+  // once per run (instead of once per iteration)
+  auto pipeline_streams = GraphViewType::is_multi_gpu
+                            ? std::make_unique<major_reduce_pipeline_streams_t>()
+                            : std::unique_ptr<major_reduce_pipeline_streams_t>{nullptr};
+  size_t iter{0};
+  while (true) {
+    thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 pageranks,
+                 pageranks + num_local_values,
+                 old_pageranks.data());
+
+    auto dangling_sums = compute_column_sums<GraphViewType::is_multi_gpu, vertex_t, result_t>(
+      handle,
+      num_local_vertices,
+      num_columns,
+      column_major_to_dangling_pagerank_t<vertex_t, weight_t, result_t>{
+        pageranks, vertex_out_weight_sums, num_local_vertices, num_columns});
+
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(num_local_values),
+                      pageranks,
+                      [pageranks, vertex_out_weight_sums, num_columns] __device__(auto i) {
+                        auto const out_weight_sum = *(vertex_out_weight_sums + i / num_columns);
+                        auto const divisor =
+                          out_weight_sum == result_t{0.0} ? result_t{1.0} : out_weight_sum;
+                        return *(pageranks + i) / divisor;
+                      });
+
+    copy_to_adj_matrix_row(
+      handle, pull_graph_view, num_columns, pageranks, adj_matrix_row_pageranks.begin());
+
+    // a single pass over the edges for every personalization vector
+    copy_v_transform_reduce_in_nbr(
+      handle,
+      pull_graph_view,
+      num_columns,
+      adj_matrix_row_pageranks.begin(),
+      thrust::make_constant_iterator(0) /* dummy */,
+      [alpha] __device__(vertex_t src, vertex_t dst, weight_t w, auto src_val, auto dst_val) {
+        return src_val * w * alpha;
+      },
+      result_t{0.0},
+      pageranks,
+      pipeline_streams.get());
+
+    vertex_partition_device_t<GraphViewType> vertex_partition(pull_graph_view);
+    thrust::for_each(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(edge_t{0}),
+      thrust::make_counting_iterator(num_personalization_entries),
+      [vertex_partition,
+       personalization_offsets,
+       personalization_vertices,
+       personalization_values,
+       personalization_sums = personalization_sums.data(),
+       dangling_sums        = dangling_sums.data(),
+       pageranks,
+       num_columns,
+       alpha] __device__(auto i) {
+        auto j = static_cast<size_t>(thrust::distance(
+          personalization_offsets + 1,
+          thrust::upper_bound(
+            thrust::seq, personalization_offsets + 1, personalization_offsets + num_columns, i)));
+        auto v_offset = static_cast<size_t>(
+          vertex_partition.get_local_vertex_offset_from_vertex_nocheck(
+            *(personalization_vertices + i)));
+        atomicAdd(pageranks + v_offset * num_columns + j,
+                  (*(dangling_sums + j) * alpha + static_cast<result_t>(1.0 - alpha)) *
+                    (*(personalization_values + i) / *(personalization_sums + j)));
+      });
+
+    auto diff_sums = compute_column_sums<GraphViewType::is_multi_gpu, vertex_t, result_t>(
+      handle,
+      num_local_vertices,
+      num_columns,
+      column_major_to_pagerank_diff_t<vertex_t, result_t>{
+        pageranks, old_pageranks.data(), num_local_vertices, num_columns});
+    auto max_diff_sum =
+      thrust::reduce(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     diff_sums.begin(),
+                     diff_sums.end(),
+                     result_t{0.0},
+                     thrust::maximum<result_t>());
 
     iter++;
+    add_profile_counter("iterations", 1);
 
-    if (diff_sum < epsilon) {
+    if (max_diff_sum < epsilon) {
       break;
     } else if (iter >= max_iterations) {
-      CUGRAPH_FAIL("PageRank failed to converge.");
+      CUGRAPH_FAIL("Batched personalized PageRank failed to converge.");
     }
   }
 }
@@ -288,7 +713,9 @@ void pagerank(raft::handle_t const& handle,
               result_t epsilon,
               size_t max_iterations,
               bool has_initial_guess,
-              bool do_expensive_check)
+              bool do_expensive_check,
+              size_t convergence_check_interval,
+              bool reduced_precision)
 {
   detail::pagerank(handle,
                    graph_view,
@@ -301,7 +728,40 @@ void pagerank(raft::handle_t const& handle,
                    epsilon,
                    max_iterations,
                    has_initial_guess,
-                   do_expensive_check);
+                   do_expensive_check,
+                   convergence_check_interval,
+                   reduced_precision);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t, bool multi_gpu>
+void batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, true, multi_gpu> const& graph_view,
+  weight_t const* precomputed_vertex_out_weight_sums,
+  size_t num_personalization_vectors,
+  edge_t const* personalization_offsets,
+  vertex_t const* personalization_vertices,
+  result_t const* personalization_values,
+  result_t* pageranks,
+  result_t alpha,
+  result_t epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check)
+{
+  detail::batched_personalized_pagerank(handle,
+                                        graph_view,
+                                        precomputed_vertex_out_weight_sums,
+                                        num_personalization_vectors,
+                                        personalization_offsets,
+                                        personalization_vertices,
+                                        personalization_values,
+                                        pageranks,
+                                        alpha,
+                                        epsilon,
+                                        max_iterations,
+                                        has_initial_guess,
+                                        do_expensive_check);
 }
 
 // explicit instantiation
@@ -317,7 +777,9 @@ template void pagerank(raft::handle_t const& handle,
                        float epsilon,
                        size_t max_iterations,
                        bool has_initial_guess,
-                       bool do_expensive_check);
+                       bool do_expensive_check,
+                       size_t convergence_check_interval,
+                       bool reduced_precision);
 
 template void pagerank(raft::handle_t const& handle,
                        graph_view_t<int32_t, int32_t, double, true, true> const& graph_view,
@@ -330,7 +792,9 @@ template void pagerank(raft::handle_t const& handle,
                        double epsilon,
                        size_t max_iterations,
                        bool has_initial_guess,
-                       bool do_expensive_check);
+                       bool do_expensive_check,
+                       size_t convergence_check_interval,
+                       bool reduced_precision);
 
 template void pagerank(raft::handle_t const& handle,
                        graph_view_t<int32_t, int64_t, float, true, true> const& graph_view,
@@ -343,7 +807,9 @@ template void pagerank(raft::handle_t const& handle,
                        float epsilon,
                        size_t max_iterations,
                        bool has_initial_guess,
-                       bool do_expensive_check);
+                       bool do_expensive_check,
+                       size_t convergence_check_interval,
+                       bool reduced_precision);
 
 template void pagerank(raft::handle_t const& handle,
                        graph_view_t<int32_t, int64_t, double, true, true> const& graph_view,
@@ -356,7 +822,9 @@ template void pagerank(raft::handle_t const& handle,
                        double epsilon,
                        size_t max_iterations,
                        bool has_initial_guess,
-                       bool do_expensive_check);
+                       bool do_expensive_check,
+                       size_t convergence_check_interval,
+                       bool reduced_precision);
 
 template void pagerank(raft::handle_t const& handle,
                        graph_view_t<int64_t, int64_t, float, true, true> const& graph_view,
@@ -369,7 +837,9 @@ template void pagerank(raft::handle_t const& handle,
                        float epsilon,
                        size_t max_iterations,
                        bool has_initial_guess,
-                       bool do_expensive_check);
+                       bool do_expensive_check,
+                       size_t convergence_check_interval,
+                       bool reduced_precision);
 
 template void pagerank(raft::handle_t const& handle,
                        graph_view_t<int64_t, int64_t, double, true, true> const& graph_view,
@@ -382,7 +852,9 @@ template void pagerank(raft::handle_t const& handle,
                        double epsilon,
                        size_t max_iterations,
                        bool has_initial_guess,
-                       bool do_expensive_check);
+                       bool do_expensive_check,
+                       size_t convergence_check_interval,
+                       bool reduced_precision);
 
 template void pagerank(raft::handle_t const& handle,
                        graph_view_t<int32_t, int32_t, float, true, false> const& graph_view,
@@ -395,7 +867,9 @@ template void pagerank(raft::handle_t const& handle,
                        float epsilon,
                        size_t max_iterations,
                        bool has_initial_guess,
-                       bool do_expensive_check);
+                       bool do_expensive_check,
+                       size_t convergence_check_interval,
+                       bool reduced_precision);
 
 template void pagerank(raft::handle_t const& handle,
                        graph_view_t<int32_t, int32_t, double, true, false> const& graph_view,
@@ -408,7 +882,9 @@ template void pagerank(raft::handle_t const& handle,
                        double epsilon,
                        size_t max_iterations,
                        bool has_initial_guess,
-                       bool do_expensive_check);
+                       bool do_expensive_check,
+                       size_t convergence_check_interval,
+                       bool reduced_precision);
 
 template void pagerank(raft::handle_t const& handle,
                        graph_view_t<int32_t, int64_t, float, true, false> const& graph_view,
@@ -421,7 +897,9 @@ template void pagerank(raft::handle_t const& handle,
                        float epsilon,
                        size_t max_iterations,
                        bool has_initial_guess,
-                       bool do_expensive_check);
+                       bool do_expensive_check,
+                       size_t convergence_check_interval,
+                       bool reduced_precision);
 
 template void pagerank(raft::handle_t const& handle,
                        graph_view_t<int32_t, int64_t, double, true, false> const& graph_view,
@@ -434,7 +912,9 @@ template void pagerank(raft::handle_t const& handle,
                        double epsilon,
                        size_t max_iterations,
                        bool has_initial_guess,
-                       bool do_expensive_check);
+                       bool do_expensive_check,
+                       size_t convergence_check_interval,
+                       bool reduced_precision);
 
 template void pagerank(raft::handle_t const& handle,
                        graph_view_t<int64_t, int64_t, float, true, false> const& graph_view,
@@ -447,7 +927,9 @@ template void pagerank(raft::handle_t const& handle,
                        float epsilon,
                        size_t max_iterations,
                        bool has_initial_guess,
-                       bool do_expensive_check);
+                       bool do_expensive_check,
+                       size_t convergence_check_interval,
+                       bool reduced_precision);
 
 template void pagerank(raft::handle_t const& handle,
                        graph_view_t<int64_t, int64_t, double, true, false> const& graph_view,
@@ -460,7 +942,189 @@ template void pagerank(raft::handle_t const& handle,
                        double epsilon,
                        size_t max_iterations,
                        bool has_initial_guess,
-                       bool do_expensive_check);
+                       bool do_expensive_check,
+                       size_t convergence_check_interval,
+                       bool reduced_precision);
+
+template void batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, true, true> const& graph_view,
+  float const* precomputed_vertex_out_weight_sums,
+  size_t num_personalization_vectors,
+  int32_t const* personalization_offsets,
+  int32_t const* personalization_vertices,
+  float const* personalization_values,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, true, true> const& graph_view,
+  double const* precomputed_vertex_out_weight_sums,
+  size_t num_personalization_vectors,
+  int32_t const* personalization_offsets,
+  int32_t const* personalization_vertices,
+  double const* personalization_values,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, true, true> const& graph_view,
+  float const* precomputed_vertex_out_weight_sums,
+  size_t num_personalization_vectors,
+  int64_t const* personalization_offsets,
+  int32_t const* personalization_vertices,
+  float const* personalization_values,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, true, true> const& graph_view,
+  double const* precomputed_vertex_out_weight_sums,
+  size_t num_personalization_vectors,
+  int64_t const* personalization_offsets,
+  int32_t const* personalization_vertices,
+  double const* personalization_values,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, true, true> const& graph_view,
+  float const* precomputed_vertex_out_weight_sums,
+  size_t num_personalization_vectors,
+  int64_t const* personalization_offsets,
+  int64_t const* personalization_vertices,
+  float const* personalization_values,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, true, true> const& graph_view,
+  double const* precomputed_vertex_out_weight_sums,
+  size_t num_personalization_vectors,
+  int64_t const* personalization_offsets,
+  int64_t const* personalization_vertices,
+  double const* personalization_values,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, float, true, false> const& graph_view,
+  float const* precomputed_vertex_out_weight_sums,
+  size_t num_personalization_vectors,
+  int32_t const* personalization_offsets,
+  int32_t const* personalization_vertices,
+  float const* personalization_values,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int32_t, double, true, false> const& graph_view,
+  double const* precomputed_vertex_out_weight_sums,
+  size_t num_personalization_vectors,
+  int32_t const* personalization_offsets,
+  int32_t const* personalization_vertices,
+  double const* personalization_values,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, float, true, false> const& graph_view,
+  float const* precomputed_vertex_out_weight_sums,
+  size_t num_personalization_vectors,
+  int64_t const* personalization_offsets,
+  int32_t const* personalization_vertices,
+  float const* personalization_values,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int32_t, int64_t, double, true, false> const& graph_view,
+  double const* precomputed_vertex_out_weight_sums,
+  size_t num_personalization_vectors,
+  int64_t const* personalization_offsets,
+  int32_t const* personalization_vertices,
+  double const* personalization_values,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, float, true, false> const& graph_view,
+  float const* precomputed_vertex_out_weight_sums,
+  size_t num_personalization_vectors,
+  int64_t const* personalization_offsets,
+  int64_t const* personalization_vertices,
+  float const* personalization_values,
+  float* pageranks,
+  float alpha,
+  float epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void batched_personalized_pagerank(
+  raft::handle_t const& handle,
+  graph_view_t<int64_t, int64_t, double, true, false> const& graph_view,
+  double const* precomputed_vertex_out_weight_sums,
+  size_t num_personalization_vectors,
+  int64_t const* personalization_offsets,
+  int64_t const* personalization_vertices,
+  double const* personalization_values,
+  double* pageranks,
+  double alpha,
+  double epsilon,
+  size_t max_iterations,
+  bool has_initial_guess,
+  bool do_expensive_check);
 
 }  // namespace experimental
 }  // namespace cugraph
@@ -18,9 +18,16 @@
 //
 #pragma once
 
+#include <algorithms.hpp>
+#include <compute_partition.cuh>
 #include <experimental/graph.hpp>
+#include <matrix_partition_device.cuh>
+#include <partition_manager.hpp>
 
+#include <utilities/device_comm.cuh>
 #include <utilities/graph_utils.cuh>
+#include <utilities/host_scalar_comm.cuh>
+#include <utilities/shuffle_comm.cuh>
 
 #include <raft/device_atomics.cuh>
 #include <raft/handle.hpp>
@@ -29,23 +36,33 @@
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_uvector.hpp>
 
+#include <thrust/binary_search.h>
 #include <thrust/copy.h>
 #include <thrust/count.h>
+#include <thrust/extrema.h>
 #include <thrust/find.h>
+#include <thrust/for_each.h>
 #include <thrust/gather.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/logical.h>
+#include <thrust/random.h>
+#include <thrust/reduce.h>
 #include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
 #include <cassert>
 #include <ctime>
+#include <numeric>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 namespace cugraph {
 namespace experimental {
@@ -103,6 +120,18 @@ struct device_const_vector_view {
   index_t size_;
 };
 
+// maps a real random value in [0,1] to an index in [0, crt_out_deg)
+// (pre-condition: crt_out_deg > 0):
+//
+template <typename vertex_t, typename edge_t, typename real_t>
+__device__ vertex_t uniform_col_index(real_t rnd_vindx, edge_t crt_out_deg)
+{
+  real_t max_ub     = static_cast<real_t>(crt_out_deg - 1);
+  auto interp_vindx = rnd_vindx * max_ub + real_t{.5};
+  vertex_t v_indx   = static_cast<vertex_t>(interp_vindx);
+  return (v_indx >= crt_out_deg ? crt_out_deg - 1 : v_indx);
+}
+
 // raft random generator:
 // (using upper-bound cached "map"
 //  giving out_deg(v) for each v in [0, |V|);
@@ -158,10 +187,7 @@ struct rrandom_gen_t {
       d_ptr_out_degs_,             // also stencil
       d_col_indx.begin(),
       [] __device__(real_t rnd_vindx, edge_t crt_out_deg) {
-        real_t max_ub     = static_cast<real_t>(crt_out_deg - 1);
-        auto interp_vindx = rnd_vindx * max_ub + real_t{.5};
-        vertex_t v_indx   = static_cast<vertex_t>(interp_vindx);
-        return (v_indx >= crt_out_deg ? crt_out_deg - 1 : v_indx);
+        return uniform_col_index<vertex_t>(rnd_vindx, crt_out_deg);
       },
       [] __device__(auto crt_out_deg) { return crt_out_deg > 0; });
   }
@@ -198,6 +224,183 @@ struct fixed_seeding_t {
   seed_t seed_;
 };
 
+// sampling policies: device functors selecting the column index of the next vertex in a path;
+// i.e., the offset of the next vertex in the neighbor list of the most recent vertex in the path;
+//
+// signature:
+// col_indx = selector(path_indx,    // index of the path in [0, num_paths)
+//                     ptr_path_v,   // pointer to the first vertex of the (coalesced) path
+//                     path_sz,      // current number of vertices in the path
+//                     crt_out_deg,  // out-degree of the most recent vertex (> 0)
+//                     rnd,          // real random value in [0,1], generated by the random engine
+//                     seed);        // seed of the current step (for extra random values)
+//
+
+// uniform sampling (the same mapping as rrandom_gen_t::generate_col_indices()):
+//
+template <typename vertex_t, typename edge_t>
+struct uniform_selector_t {
+  template <typename index_t, typename real_t, typename seed_t>
+  __device__ vertex_t operator()(index_t path_indx,
+                                 vertex_t const* ptr_path_v,
+                                 index_t path_sz,
+                                 edge_t crt_out_deg,
+                                 real_t rnd,
+                                 seed_t seed) const
+  {
+    return uniform_col_index<vertex_t>(rnd, crt_out_deg);
+  }
+};
+
+// maps a real random value in [0,1] to an index in [0, crt_out_deg) with probabilities
+// proportional to the edge weights, by binary searching the (per neighbor list) inclusive prefix
+// sums of the weights;
+//
+template <typename vertex_t, typename edge_t, typename weight_t, typename real_t>
+__device__ vertex_t cumulative_weight_col_index(weight_t const* ptr_cumulative_w,
+                                                edge_t crt_out_deg,
+                                                real_t rnd)
+{
+  auto target = static_cast<weight_t>(rnd) * ptr_cumulative_w[crt_out_deg - 1];
+  auto it =
+    thrust::upper_bound(thrust::seq, ptr_cumulative_w, ptr_cumulative_w + crt_out_deg, target);
+  auto v_indx = static_cast<vertex_t>(thrust::distance(ptr_cumulative_w, it));
+  return (v_indx >= crt_out_deg ? crt_out_deg - 1 : v_indx);
+}
+
+// biased (weighted) sampling: probability of picking an out-edge is proportional to its weight;
+//
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct biased_selector_t {
+  edge_t const* row_offsets{nullptr};
+  weight_t const* cumulative_w{nullptr};  // per neighbor list inclusive prefix sums of weights
+
+  template <typename index_t, typename real_t, typename seed_t>
+  __device__ vertex_t operator()(index_t path_indx,
+                                 vertex_t const* ptr_path_v,
+                                 index_t path_sz,
+                                 edge_t crt_out_deg,
+                                 real_t rnd,
+                                 seed_t seed) const
+  {
+    auto v = ptr_path_v[path_sz - 1];
+    return cumulative_weight_col_index<vertex_t>(
+      cumulative_w + row_offsets[v], crt_out_deg, rnd);
+  }
+};
+
+// node2vec second order sampling: the (weighted, if cumulative_w != nullptr) probability of
+// moving from v to next(v) is scaled by 1/p if next(v) is the previous vertex in the path, by 1 if
+// next(v) is a neighbor of the previous vertex, and by 1/q otherwise; the first step is first
+// order;
+//
+// sampling is exact, by rejection: candidates are drawn from the first order distribution and
+// accepted with probability bias / max(1/p, 1, 1/q); so no per (previous vertex, vertex) state is
+// needed and path state stays in the coalesced vectors;
+//
+template <typename vertex_t, typename edge_t, typename weight_t, typename real_t>
+struct node2vec_selector_t {
+  edge_t const* row_offsets{nullptr};
+  vertex_t const* col_indices{nullptr};
+  weight_t const* cumulative_w{nullptr};  // nullptr for uniform first order probabilities
+  real_t p{1.0};                          // return parameter
+  real_t q{1.0};                          // in-out parameter
+  bool sorted_neighbor_lists{false};
+
+  template <typename index_t, typename seed_t>
+  __device__ vertex_t operator()(index_t path_indx,
+                                 vertex_t const* ptr_path_v,
+                                 index_t path_sz,
+                                 edge_t crt_out_deg,
+                                 real_t rnd,
+                                 seed_t seed) const
+  {
+    auto v         = ptr_path_v[path_sz - 1];
+    auto start_row = row_offsets[v];
+    auto col_indx  = first_order_col_index(start_row, crt_out_deg, rnd);
+    if (path_sz < 2) { return col_indx; }
+
+    auto prev_v   = ptr_path_v[path_sz - 2];
+    auto max_bias = thrust::max(thrust::max(real_t{1.0} / p, real_t{1.0}), real_t{1.0} / q);
+
+    // independent stream of random values for the extra draws of each path in each step:
+    //
+    thrust::default_random_engine rng(
+      static_cast<unsigned int>(mix(static_cast<uint64_t>(seed) ^ mix(path_indx))));
+    thrust::uniform_real_distribution<real_t> dist(real_t{0.0}, real_t{1.0});
+    while (true) {
+      auto next_v = col_indices[start_row + col_indx];
+      auto bias   = next_v == prev_v ? real_t{1.0} / p
+                                   : (is_neighbor(prev_v, next_v) ? real_t{1.0} : real_t{1.0} / q);
+      if (dist(rng) * max_bias < bias) { return col_indx; }
+      col_indx = first_order_col_index(start_row, crt_out_deg, dist(rng));
+    }
+  }
+
+ private:
+  __device__ vertex_t first_order_col_index(edge_t start_row, edge_t crt_out_deg, real_t rnd) const
+  {
+    if (cumulative_w != nullptr) {
+      return cumulative_weight_col_index<vertex_t>(cumulative_w + start_row, crt_out_deg, rnd);
+    } else {
+      auto v_indx = static_cast<vertex_t>(rnd * static_cast<real_t>(crt_out_deg));
+      return (v_indx >= crt_out_deg ? crt_out_deg - 1 : v_indx);
+    }
+  }
+
+  __device__ bool is_neighbor(vertex_t src, vertex_t dst) const
+  {
+    auto first = col_indices + row_offsets[src];
+    auto last  = col_indices + row_offsets[src + 1];
+    return sorted_neighbor_lists ? thrust::binary_search(thrust::seq, first, last, dst)
+                                 : (thrust::find(thrust::seq, first, last, dst) != last);
+  }
+
+  // splitmix64 finalizer:
+  //
+  __device__ static uint64_t mix(uint64_t x)
+  {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+  }
+};
+
+// per neighbor list inclusive prefix sums of the edge weights (for weighted sampling):
+//
+template <typename graph_t>
+device_vec_t<typename graph_t::weight_type> compute_cumulative_weights(
+  raft::handle_t const& handle, graph_t const& graph)
+{
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t   = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+
+  CUGRAPH_EXPECTS(graph.is_weighted(), "Invalid input argument: the graph should be weighted.");
+
+  auto num_edges = graph.get_number_of_edges();
+  device_vec_t<weight_t> d_cumulative_w(num_edges, handle.get_stream());
+
+  auto row_first = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<edge_t>(0),
+    [row_offsets = graph.offsets(), num_vertices = graph.get_number_of_vertices()] __device__(
+      auto indx) {
+      return static_cast<vertex_t>(
+        thrust::distance(row_offsets + 1,
+                         thrust::upper_bound(
+                           thrust::seq, row_offsets + 1, row_offsets + num_vertices + 1, indx)));
+    });
+
+  thrust::inclusive_scan_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                                row_first,
+                                row_first + num_edges,
+                                graph.weights(),
+                                d_cumulative_w.begin());
+
+  return d_cumulative_w;
+}
+
 // classes abstracting the next vertex extraction mechanism:
 //
 // primary template, purposely undefined
@@ -309,7 +512,9 @@ struct col_indx_extract_t<graph_t, index_t, std::enable_if_t<graph_t::is_multi_g
         auto delta     = ptr_d_sizes[indx] - 1;
         auto v_indx    = ptr_d_coalesced_v[indx * max_depth + delta];
         auto start_row = row_offsets[v_indx];
-        return thrust::make_tuple(col_indices[start_row + col_indx], values[start_row + col_indx]);
+        return thrust::make_tuple(
+          col_indices[start_row + col_indx],
+          values != nullptr ? values[start_row + col_indx] : weight_t{1.0});
       },
       [] __device__(auto crt_out_deg) { return crt_out_deg > 0; });
   }
@@ -464,6 +669,86 @@ struct random_walker_t {
 
     rgen.generate_col_indices(d_col_indx);
 
+    advance(graph,
+            d_coalesced_v,
+            d_coalesced_w,
+            d_paths_sz,
+            d_crt_out_degs,
+            d_col_indx,
+            d_next_v,
+            d_next_w);
+  }
+
+  // overload for step() with a sampling policy (selector_t) picking the column indices
+  // (see uniform_selector_t, biased_selector_t, node2vec_selector_t); the random engine only
+  // provides one real random value in [0,1] per path:
+  //
+  template <typename selector_t>
+  void step(
+    graph_t const& graph,
+    seed_t seed,
+    selector_t const& selector,
+    device_vec_t<vertex_t>& d_coalesced_v,  // crt coalesced vertex set
+    device_vec_t<weight_t>& d_coalesced_w,  // crt coalesced weight set
+    device_vec_t<index_t>& d_paths_sz,      // crt paths sizes
+    device_vec_t<edge_t>& d_crt_out_degs,   // crt out-degs for current set of vertices
+    device_vec_t<real_t>& d_random,         // crt set of random real values
+    device_vec_t<vertex_t>& d_col_indx,  // crt col col indices to be used for retrieving next step
+    device_vec_t<vertex_t>& d_next_v,    // crt set of destination vertices, for next step
+    device_vec_t<weight_t>& d_next_w)
+    const  // set of weights between src and destination vertices, for next step
+  {
+    gather_from_coalesced(
+      d_coalesced_v, d_cached_out_degs_, d_paths_sz, d_crt_out_degs, max_depth_, num_paths_);
+
+    // generate random values (mapped to destination indices by the selector):
+    //
+    random_engine_t rgen(handle_, num_paths_, d_random, d_crt_out_degs, seed);
+
+    thrust::transform_if(
+      rmm::exec_policy(handle_.get_stream())->on(handle_.get_stream()),
+      thrust::make_counting_iterator<index_t>(0),
+      thrust::make_counting_iterator<index_t>(num_paths_),
+      d_crt_out_degs.begin(),  // stencil
+      d_col_indx.begin(),
+      [selector,
+       seed,
+       max_depth        = max_depth_,
+       ptr_coalesced_v  = raw_const_ptr(d_coalesced_v),
+       ptr_paths_sz     = raw_const_ptr(d_paths_sz),
+       ptr_crt_out_degs = raw_const_ptr(d_crt_out_degs),
+       ptr_random       = raw_const_ptr(d_random)] __device__(auto path_indx) {
+        return selector(path_indx,
+                        ptr_coalesced_v + path_indx * max_depth,
+                        ptr_paths_sz[path_indx],
+                        ptr_crt_out_degs[path_indx],
+                        ptr_random[path_indx],
+                        seed);
+      },
+      [] __device__(auto crt_out_deg) { return crt_out_deg > 0; });
+
+    advance(graph,
+            d_coalesced_v,
+            d_coalesced_w,
+            d_paths_sz,
+            d_crt_out_degs,
+            d_col_indx,
+            d_next_v,
+            d_next_w);
+  }
+
+  // extracts the next vertices (and weights) given the column indices picked by step(),
+  // and appends them to the paths that have not reached sinks:
+  //
+  void advance(graph_t const& graph,
+               device_vec_t<vertex_t>& d_coalesced_v,
+               device_vec_t<weight_t>& d_coalesced_w,
+               device_vec_t<index_t>& d_paths_sz,
+               device_vec_t<edge_t> const& d_crt_out_degs,
+               device_vec_t<vertex_t> const& d_col_indx,
+               device_vec_t<vertex_t>& d_next_v,
+               device_vec_t<weight_t>& d_next_w) const
+  {
     // dst extraction from dst indices:
     //
     col_indx_extract_t<graph_t> col_extractor(handle_,
@@ -696,12 +981,19 @@ struct random_walker_t {
  *
  * @tparam graph_t Type of graph (view).
  * @tparam random_engine_t Type of random engine used to generate RW.
+ * @tparam seeding_policy_t Type of seeding policy.
+ * @tparam index_t Type used to store indexing and sizes.
+ * @tparam selector_t Type of sampling policy.
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
  * @param graph Graph object to generate RW on.
  * @param d_v_start Device (view) set of starting vertex indices for the RW.
  * number(paths) == d_v_start.size().
  * @param max_depth maximum length of RWs.
+ * @param seeder Seeding policy, providing the seed of the first step.
+ * @param selector Sampling policy, picking the next vertex of each path (see
+ * uniform_selector_t, biased_selector_t, node2vec_selector_t).
+ * @param use_padding If true, paths are returned padded (see random_walks()) instead of coalesced.
  * @return std::tuple<device_vec_t<vertex_t>, device_vec_t<weight_t>,
  * device_vec_t<index_t>, seed> Quadruplet of coalesced RW paths, with corresponding edge weights
  * for each, and corresponding path sizes. This is meant to minimize the number of DF's to be passed
@@ -712,7 +1004,9 @@ template <typename graph_t,
           typename random_engine_t =
             rrandom_gen_t<typename graph_t::vertex_type, typename graph_t::edge_type>,
           typename seeding_policy_t = clock_seeding_t<typename random_engine_t::seed_type>,
-          typename index_t          = typename graph_t::edge_type>
+          typename index_t          = typename graph_t::edge_type,
+          typename selector_t =
+            uniform_selector_t<typename graph_t::vertex_type, typename graph_t::edge_type>>
 std::enable_if_t<graph_t::is_multi_gpu == false,
                  std::tuple<device_vec_t<typename graph_t::vertex_type>,
                             device_vec_t<typename graph_t::weight_type>,
@@ -722,7 +1016,9 @@ random_walks_impl(raft::handle_t const& handle,
                   graph_t const& graph,
                   device_const_vector_view<typename graph_t::vertex_type, index_t>& d_v_start,
                   index_t max_depth,
-                  seeding_policy_t seeder = clock_seeding_t<typename random_engine_t::seed_type>{})
+                  seeding_policy_t seeder = clock_seeding_t<typename random_engine_t::seed_type>{},
+                  selector_t selector     = selector_t{},
+                  bool use_padding        = false)
 {
   using vertex_t = typename graph_t::vertex_type;
   using edge_t   = typename graph_t::edge_type;
@@ -754,6 +1050,16 @@ random_walks_impl(raft::handle_t const& handle,
   auto coalesced_sz = num_paths * max_depth;
   device_vec_t<vertex_t> d_coalesced_v(coalesced_sz, stream);  // coalesced vertex set
   device_vec_t<weight_t> d_coalesced_w(coalesced_sz, stream);  // coalesced weight set
+  if (use_padding) {
+    thrust::fill(rmm::exec_policy(stream)->on(stream),
+                 d_coalesced_v.begin(),
+                 d_coalesced_v.end(),
+                 invalid_vertex_id<vertex_t>::value);
+    thrust::fill(rmm::exec_policy(stream)->on(stream),
+                 d_coalesced_w.begin(),
+                 d_coalesced_w.end(),
+                 weight_t{0.0});
+  }
   device_vec_t<index_t> d_paths_sz(num_paths, stream);         // paths sizes
   device_vec_t<edge_t> d_crt_out_degs(num_paths, stream);  // out-degs for current set of vertices
   device_vec_t<real_t> d_random(num_paths, stream);
@@ -776,6 +1082,7 @@ random_walks_impl(raft::handle_t const& handle,
     //
     rand_walker.step(graph,
                      seed0 + static_cast<seed_t>(step_indx),
+                     selector,
                      d_coalesced_v,
                      d_coalesced_w,
                      d_paths_sz,
@@ -792,8 +1099,13 @@ random_walks_impl(raft::handle_t const& handle,
 
   // wrap-up, post-process:
   // truncate v_set, w_set to actual space used
+  // (the padded layout is the working layout, no post-processing needed)
   //
-  rand_walker.stop(d_coalesced_v, d_coalesced_w, d_paths_sz);
+  if (use_padding) {
+    d_coalesced_w.resize(num_paths * (max_depth - 1), stream);
+  } else {
+    rand_walker.stop(d_coalesced_v, d_coalesced_w, d_paths_sz);
+  }
 
   // because device_uvector is not copy-cnstr-able:
   //
@@ -803,29 +1115,110 @@ random_walks_impl(raft::handle_t const& handle,
                          seed0);  // also return seed for repro
 }
 
+// Multi-GPU helper: returns a (col_comm_size x number of local vertices, col_comm rank major)
+// array of the inclusive prefix sums (over the col_comm ranks) of the out-degrees of the local
+// vertices in the adjacency matrix partitions of each col_comm rank; i.e., entry (c, v) is the
+// number of out-edges of v stored by col_comm ranks [0, c] (entry (col_comm_size - 1, v) is the
+// out-degree of v);
+//
+template <typename graph_t>
+device_vec_t<typename graph_t::edge_type> compute_cumulative_local_out_degrees(
+  raft::handle_t const& handle, graph_t const& graph)
+{
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t   = typename graph_t::edge_type;
+
+  auto& col_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+  auto const col_comm_size = col_comm.get_size();
+
+  auto num_local_vertices = static_cast<size_t>(graph.get_number_of_local_vertices());
+
+  device_vec_t<edge_t> d_cumulative_degs(num_local_vertices * col_comm_size, handle.get_stream());
+  device_vec_t<edge_t> d_local_degs(0, handle.get_stream());
+  for (int i = 0; i < col_comm_size; ++i) {
+    matrix_partition_device_t<graph_t> matrix_partition(graph, i);
+
+    auto major_size = static_cast<size_t>(matrix_partition.get_major_size());
+    d_local_degs.resize(major_size, handle.get_stream());
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      thrust::make_counting_iterator(vertex_t{0}),
+                      thrust::make_counting_iterator(static_cast<vertex_t>(major_size)),
+                      d_local_degs.begin(),
+                      [matrix_partition] __device__(auto major_offset) {
+                        return matrix_partition.get_local_degree(major_offset);
+                      });
+
+    // the majors of the i'th adjacency matrix partition are the local vertices of col_comm rank i
+    //
+    std::vector<size_t> rx_counts(col_comm_size, major_size);
+    std::vector<size_t> displacements(col_comm_size, size_t{0});
+    std::partial_sum(rx_counts.begin(), rx_counts.end() - 1, displacements.begin() + 1);
+    device_gatherv(col_comm,
+                   d_local_degs.data(),
+                   d_cumulative_degs.data(),
+                   major_size,
+                   rx_counts,
+                   displacements,
+                   i,
+                   handle.get_stream());
+  }
+
+  thrust::for_each(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   thrust::make_counting_iterator(size_t{0}),
+                   thrust::make_counting_iterator(num_local_vertices),
+                   [ptr_cumulative_degs = d_cumulative_degs.data(),
+                    num_local_vertices,
+                    col_comm_size] __device__(auto v_offset) {
+                     for (int c = 1; c < col_comm_size; ++c) {
+                       ptr_cumulative_degs[c * num_local_vertices + v_offset] +=
+                         ptr_cumulative_degs[(c - 1) * num_local_vertices + v_offset];
+                     }
+                   });
+
+  return d_cumulative_degs;
+}
+
 /**
  * @brief returns random walks (RW) from starting sources, where each path is of given maximum
  * length. Multi-GPU specialization.
  *
+ * Paths are advanced by walkers (path index, rank of the GPU starting the path, current vertex,
+ * current path size). The out-edges of a vertex are split over the GPUs of its column
+ * communicator (2D partitioning), so a step takes two hops: (1) walkers are migrated to the
+ * owners of their current vertices, which pick a random out-edge index and send each walker to the
+ * GPU storing the picked edge; (2) that GPU resolves the edge and records the new path entry. All
+ * the walkers of a step migrate in a single shuffle per hop, and walkers reaching sinks or
+ * max_depth are compacted out, so later steps only pay for live paths. Path entries are recorded
+ * where they are resolved, and shuffled back to the GPUs starting the paths once, in the end.
+ *
  * @tparam graph_t Type of graph (view).
  * @tparam random_engine_t Type of random engine used to generate RW.
+ * @tparam seeding_policy_t Type of seeding policy.
+ * @tparam index_t Type used to store indexing and sizes.
+ * @tparam selector_t Type of sampling policy (only uniform_selector_t is supported, yet).
  * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
  * handles to various CUDA libraries) to run graph algorithms.
  * @param graph Graph object to generate RW on.
- * @param d_v_start Device (view) set of starting vertex indices for the RW. number(RW) ==
- * d_v_start.size().
+ * @param d_v_start Device (view) set of starting vertex indices for the RW started on this GPU.
+ * number(RW) == d_v_start.size().
  * @param max_depth maximum length of RWs.
+ * @param seeder Seeding policy, providing the seed of the first step.
+ * @param selector Sampling policy, picking the next vertex of each path.
+ * @param use_padding If true, paths are returned padded (see random_walks()) instead of coalesced.
  * @return std::tuple<device_vec_t<vertex_t>, device_vec_t<weight_t>,
- * device_vec_t<index_t>, seed> Quadruplet of coalesced RW paths, with corresponding edge weights
- * for each, and coresponding path sizes. This is meant to minimize the number of DF's to be passed
- * to the Python layer. Also returning seed for testing / debugging repro. The meaning of
- * "coalesced" here is that a 2D array of paths of different sizes is represented as a 1D array.
+ * device_vec_t<index_t>, seed> Quadruplet of coalesced RW paths (started on this GPU), with
+ * corresponding edge weights for each, and coresponding path sizes. This is meant to minimize the
+ * number of DF's to be passed to the Python layer. Also returning seed for testing / debugging
+ * repro. The meaning of "coalesced" here is that a 2D array of paths of different sizes is
+ * represented as a 1D array.
  */
 template <typename graph_t,
           typename random_engine_t =
             rrandom_gen_t<typename graph_t::vertex_type, typename graph_t::edge_type>,
           typename seeding_policy_t = clock_seeding_t<typename random_engine_t::seed_type>,
-          typename index_t          = typename graph_t::edge_type>
+          typename index_t          = typename graph_t::edge_type,
+          typename selector_t =
+            uniform_selector_t<typename graph_t::vertex_type, typename graph_t::edge_type>>
 std::enable_if_t<graph_t::is_multi_gpu == true,
                  std::tuple<device_vec_t<typename graph_t::vertex_type>,
                             device_vec_t<typename graph_t::weight_type>,
@@ -835,9 +1228,398 @@ random_walks_impl(raft::handle_t const& handle,
                   graph_t const& graph,
                   device_const_vector_view<typename graph_t::vertex_type, index_t>& d_v_start,
                   index_t max_depth,
-                  seeding_policy_t seeder = clock_seeding_t<typename random_engine_t::seed_type>{})
+                  seeding_policy_t seeder = clock_seeding_t<typename random_engine_t::seed_type>{},
+                  selector_t selector     = selector_t{},
+                  bool use_padding        = false)
 {
-  CUGRAPH_FAIL("Not implemented yet.");
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t   = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+  using seed_t   = typename random_engine_t::seed_type;
+  using real_t   = typename random_engine_t::real_type;
+
+  static_assert(!graph_t::is_adj_matrix_transposed,
+                "graph_t::is_adj_matrix_transposed should be false.");
+
+  // FIXME: biased and node2vec sampling require per GPU cumulative weights (and neighbor lists of
+  // the previous vertices, for node2vec), not supported in multi-GPU yet
+  //
+  CUGRAPH_EXPECTS((std::is_same<selector_t, uniform_selector_t<vertex_t, edge_t>>::value),
+                  "Not implemented yet: multi-GPU random walks support uniform sampling only.");
+
+  auto& comm               = handle.get_comms();
+  auto const comm_rank     = comm.get_rank();
+  auto& row_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+  auto const row_comm_rank = row_comm.get_rank();
+  auto const row_comm_size = row_comm.get_size();
+  auto& col_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+  auto const col_comm_size = col_comm.get_size();
+
+  vertex_t num_vertices = graph.get_number_of_vertices();
+
+  auto how_many_valid =
+    thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     d_v_start.begin(),
+                     d_v_start.end(),
+                     [num_vertices] __device__(auto crt_vertex) {
+                       return (crt_vertex >= 0) && (crt_vertex < num_vertices);
+                     });
+
+  CUGRAPH_EXPECTS(static_cast<index_t>(how_many_valid) == d_v_start.size(),
+                  "Invalid set of starting vertices.");
+
+  auto num_paths = d_v_start.size();
+  auto stream    = handle.get_stream();
+
+  // abstracted out seed initialization:
+  //
+  seed_t seed0 = static_cast<seed_t>(seeder());
+
+  auto d_cumulative_degs = compute_cumulative_local_out_degrees(handle, graph);
+
+  compute_partition_t<graph_t> partition(handle, graph);
+  auto vertex_partition = partition.vertex_device_view();
+
+  auto local_vertex_first = graph.get_local_vertex_first();
+  auto num_local_vertices = static_cast<size_t>(graph.get_number_of_local_vertices());
+
+  // walkers, initially one per path started on this GPU:
+  //
+  device_vec_t<index_t> d_walker_paths(num_paths, stream);  // path indices (in the starting GPU)
+  device_vec_t<int> d_walker_ranks(num_paths, stream);      // ranks of the starting GPUs
+  device_vec_t<vertex_t> d_walker_v(num_paths, stream);     // current vertices
+  device_vec_t<index_t> d_walker_sizes(num_paths, stream);  // current path sizes
+  thrust::sequence(rmm::exec_policy(stream)->on(stream),
+                   d_walker_paths.begin(),
+                   d_walker_paths.end(),
+                   index_t{0});
+  thrust::fill(
+    rmm::exec_policy(stream)->on(stream), d_walker_ranks.begin(), d_walker_ranks.end(), comm_rank);
+  thrust::copy(
+    rmm::exec_policy(stream)->on(stream), d_v_start.begin(), d_v_start.end(), d_walker_v.begin());
+  thrust::fill(rmm::exec_policy(stream)->on(stream),
+               d_walker_sizes.begin(),
+               d_walker_sizes.end(),
+               index_t{1});
+
+  // path entries (but the starting vertices) resolved on this GPU:
+  //
+  device_vec_t<index_t> d_entry_paths(0, stream);
+  device_vec_t<int> d_entry_ranks(0, stream);
+  device_vec_t<index_t> d_entry_positions(0, stream);  // positions in the paths
+  device_vec_t<vertex_t> d_entry_v(0, stream);
+  device_vec_t<weight_t> d_entry_w(0, stream);
+
+  for (decltype(max_depth) step_indx = 1; step_indx < max_depth; ++step_indx) {
+    // (1) migrate the walkers to the owners of their current vertices:
+    //
+    {
+      auto walker_first = thrust::make_zip_iterator(thrust::make_tuple(d_walker_paths.begin(),
+                                                                       d_walker_ranks.begin(),
+                                                                       d_walker_v.begin(),
+                                                                       d_walker_sizes.begin()));
+      std::forward_as_tuple(std::tie(d_walker_paths, d_walker_ranks, d_walker_v, d_walker_sizes),
+                            std::ignore) =
+        groupby_gpuid_and_shuffle_values(
+          comm,
+          walker_first,
+          walker_first + d_walker_paths.size(),
+          [vertex_partition] __device__(auto val) {
+            return vertex_partition(thrust::get<2>(val));
+          },
+          stream);
+    }
+
+    // (2) compact out the walkers which reached sinks:
+    //
+    {
+      auto walker_first = thrust::make_zip_iterator(thrust::make_tuple(d_walker_paths.begin(),
+                                                                       d_walker_ranks.begin(),
+                                                                       d_walker_v.begin(),
+                                                                       d_walker_sizes.begin()));
+      auto walker_last = thrust::remove_if(
+        rmm::exec_policy(stream)->on(stream),
+        walker_first,
+        walker_first + d_walker_paths.size(),
+        [ptr_out_degs = d_cumulative_degs.data() + (col_comm_size - 1) * num_local_vertices,
+         local_vertex_first] __device__(auto val) {
+          return ptr_out_degs[thrust::get<2>(val) - local_vertex_first] == edge_t{0};
+        });
+      auto num_walkers = static_cast<size_t>(thrust::distance(walker_first, walker_last));
+      d_walker_paths.resize(num_walkers, stream);
+      d_walker_ranks.resize(num_walkers, stream);
+      d_walker_v.resize(num_walkers, stream);
+      d_walker_sizes.resize(num_walkers, stream);
+    }
+
+    // early exit: all paths have reached sinks (or max_depth):
+    //
+    if (host_scalar_allreduce(comm, d_walker_paths.size(), stream) == 0) { break; }
+
+    // (3) pick an out-edge for each walker and send the walker to the GPU storing the edge:
+    //
+    auto num_walkers = d_walker_paths.size();
+
+    device_vec_t<real_t> d_random(num_walkers, stream);
+    if (num_walkers > 0) {
+      raft::random::Rng rng(seed0 + static_cast<seed_t>(step_indx) +
+                            static_cast<seed_t>(comm_rank) * static_cast<seed_t>(max_depth));
+      rng.uniform<real_t, size_t>(d_random.data(), num_walkers, real_t{0.0}, real_t{1.0}, stream);
+    }
+
+    device_vec_t<edge_t> d_walker_col_indices(num_walkers, stream);  // local to the target GPUs
+    device_vec_t<int> d_walker_targets(num_walkers, stream);
+    thrust::transform(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_zip_iterator(thrust::make_tuple(d_walker_v.begin(), d_random.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(d_walker_v.end(), d_random.end())),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(d_walker_col_indices.begin(), d_walker_targets.begin())),
+      [ptr_cumulative_degs = d_cumulative_degs.data(),
+       num_local_vertices,
+       local_vertex_first,
+       row_comm_rank,
+       row_comm_size,
+       col_comm_size] __device__(auto val) {
+        auto v_offset = static_cast<size_t>(thrust::get<0>(val) - local_vertex_first);
+        auto out_deg  = ptr_cumulative_degs[(col_comm_size - 1) * num_local_vertices + v_offset];
+        auto col_indx =
+          static_cast<edge_t>(uniform_col_index<vertex_t>(thrust::get<1>(val), out_deg));
+        int c{0};
+        while ((c < col_comm_size - 1) &&
+               (col_indx >= ptr_cumulative_degs[c * num_local_vertices + v_offset])) {
+          ++c;
+        }
+        auto local_col_indx =
+          col_indx - (c > 0 ? ptr_cumulative_degs[(c - 1) * num_local_vertices + v_offset]
+                            : edge_t{0});
+        return thrust::make_tuple(local_col_indx, c * row_comm_size + row_comm_rank);
+      });
+    d_random.resize(0, stream);
+    d_random.shrink_to_fit(stream);
+
+    {
+      auto walker_first = thrust::make_zip_iterator(thrust::make_tuple(d_walker_paths.begin(),
+                                                                       d_walker_ranks.begin(),
+                                                                       d_walker_v.begin(),
+                                                                       d_walker_sizes.begin(),
+                                                                       d_walker_col_indices.begin(),
+                                                                       d_walker_targets.begin()));
+      std::forward_as_tuple(std::tie(d_walker_paths,
+                                     d_walker_ranks,
+                                     d_walker_v,
+                                     d_walker_sizes,
+                                     d_walker_col_indices,
+                                     d_walker_targets),
+                            std::ignore) =
+        groupby_gpuid_and_shuffle_values(
+          comm,
+          walker_first,
+          walker_first + d_walker_paths.size(),
+          [] __device__(auto val) { return thrust::get<5>(val); },
+          stream);
+    }
+
+    // (4) resolve the picked edges (the current vertex of a walker is a major of exactly one
+    // local adjacency matrix partition):
+    //
+    num_walkers = d_walker_paths.size();
+
+    device_vec_t<vertex_t> d_next_v(num_walkers, stream);
+    device_vec_t<weight_t> d_next_w(num_walkers, stream);
+    for (int i = 0; i < col_comm_size; ++i) {
+      matrix_partition_device_t<graph_t> matrix_partition(graph, i);
+
+      thrust::for_each(
+        rmm::exec_policy(stream)->on(stream),
+        thrust::make_counting_iterator(size_t{0}),
+        thrust::make_counting_iterator(num_walkers),
+        [matrix_partition,
+         ptr_walker_v           = d_walker_v.data(),
+         ptr_walker_col_indices = d_walker_col_indices.data(),
+         ptr_next_v             = d_next_v.data(),
+         ptr_next_w             = d_next_w.data()] __device__(auto indx) {
+          auto v = ptr_walker_v[indx];
+          if ((v >= matrix_partition.get_major_first()) &&
+              (v < matrix_partition.get_major_last())) {
+            auto local_edges = matrix_partition.get_local_edges(
+              matrix_partition.get_major_offset_from_major_nocheck(v));
+            auto col_indx    = ptr_walker_col_indices[indx];
+            ptr_next_v[indx] = thrust::get<0>(local_edges)[col_indx];
+            ptr_next_w[indx] = thrust::get<1>(local_edges) != nullptr
+                                 ? thrust::get<1>(local_edges)[col_indx]
+                                 : weight_t{1.0};
+          }
+        });
+    }
+    d_walker_col_indices.resize(0, stream);
+    d_walker_col_indices.shrink_to_fit(stream);
+    d_walker_targets.resize(0, stream);
+    d_walker_targets.shrink_to_fit(stream);
+
+    // (5) record the new path entries:
+    //
+    auto num_entries = d_entry_paths.size();
+    d_entry_paths.resize(num_entries + num_walkers, stream);
+    d_entry_ranks.resize(num_entries + num_walkers, stream);
+    d_entry_positions.resize(num_entries + num_walkers, stream);
+    d_entry_v.resize(num_entries + num_walkers, stream);
+    d_entry_w.resize(num_entries + num_walkers, stream);
+    thrust::copy(rmm::exec_policy(stream)->on(stream),
+                 thrust::make_zip_iterator(thrust::make_tuple(d_walker_paths.begin(),
+                                                              d_walker_ranks.begin(),
+                                                              d_walker_sizes.begin(),
+                                                              d_next_v.begin(),
+                                                              d_next_w.begin())),
+                 thrust::make_zip_iterator(thrust::make_tuple(d_walker_paths.end(),
+                                                              d_walker_ranks.end(),
+                                                              d_walker_sizes.end(),
+                                                              d_next_v.end(),
+                                                              d_next_w.end())),
+                 thrust::make_zip_iterator(thrust::make_tuple(d_entry_paths.begin(),
+                                                              d_entry_ranks.begin(),
+                                                              d_entry_positions.begin(),
+                                                              d_entry_v.begin(),
+                                                              d_entry_w.begin())) +
+                   num_entries);
+
+    // (6) advance the walkers, and compact out the walkers which reached max_depth:
+    //
+    d_walker_v = std::move(d_next_v);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      d_walker_sizes.begin(),
+                      d_walker_sizes.end(),
+                      d_walker_sizes.begin(),
+                      [] __device__(auto crt_sz) { return crt_sz + 1; });
+    {
+      auto walker_first = thrust::make_zip_iterator(thrust::make_tuple(d_walker_paths.begin(),
+                                                                       d_walker_ranks.begin(),
+                                                                       d_walker_v.begin(),
+                                                                       d_walker_sizes.begin()));
+      auto walker_last = thrust::remove_if(
+        rmm::exec_policy(stream)->on(stream),
+        walker_first,
+        walker_first + num_walkers,
+        [max_depth] __device__(auto val) { return thrust::get<3>(val) >= max_depth; });
+      num_walkers = static_cast<size_t>(thrust::distance(walker_first, walker_last));
+      d_walker_paths.resize(num_walkers, stream);
+      d_walker_ranks.resize(num_walkers, stream);
+      d_walker_v.resize(num_walkers, stream);
+      d_walker_sizes.resize(num_walkers, stream);
+    }
+  }
+
+  // send the path entries back to the GPUs which started the paths:
+  //
+  {
+    auto entry_first = thrust::make_zip_iterator(thrust::make_tuple(d_entry_paths.begin(),
+                                                                    d_entry_ranks.begin(),
+                                                                    d_entry_positions.begin(),
+                                                                    d_entry_v.begin(),
+                                                                    d_entry_w.begin()));
+    std::forward_as_tuple(
+      std::tie(d_entry_paths, d_entry_ranks, d_entry_positions, d_entry_v, d_entry_w),
+      std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        entry_first,
+        entry_first + d_entry_paths.size(),
+        [] __device__(auto val) { return thrust::get<1>(val); },
+        stream);
+  }
+
+  // path sizes (1 + the number of entries of each path):
+  //
+  device_vec_t<index_t> d_paths_sz(num_paths, stream);
+  thrust::fill(
+    rmm::exec_policy(stream)->on(stream), d_paths_sz.begin(), d_paths_sz.end(), index_t{1});
+  {
+    device_vec_t<index_t> d_sorted_paths(d_entry_paths.size(), stream);
+    thrust::copy(rmm::exec_policy(stream)->on(stream),
+                 d_entry_paths.begin(),
+                 d_entry_paths.end(),
+                 d_sorted_paths.begin());
+    thrust::sort(
+      rmm::exec_policy(stream)->on(stream), d_sorted_paths.begin(), d_sorted_paths.end());
+    device_vec_t<index_t> d_unique_paths(d_sorted_paths.size(), stream);
+    device_vec_t<index_t> d_counts(d_sorted_paths.size(), stream);
+    auto it = thrust::reduce_by_key(rmm::exec_policy(stream)->on(stream),
+                                    d_sorted_paths.begin(),
+                                    d_sorted_paths.end(),
+                                    thrust::make_constant_iterator(index_t{1}),
+                                    d_unique_paths.begin(),
+                                    d_counts.begin());
+    auto num_unique_paths = thrust::distance(d_unique_paths.begin(), thrust::get<0>(it));
+    thrust::scatter(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_transform_iterator(d_counts.begin(),
+                                      [] __device__(auto count) { return count + 1; }),
+      thrust::make_transform_iterator(d_counts.begin() + num_unique_paths,
+                                      [] __device__(auto count) { return count + 1; }),
+      d_unique_paths.begin(),
+      d_paths_sz.begin());
+  }
+
+  // path p occupies [v_offset[p], v_offset[p] + sz[p]) in the coalesced vertex set and
+  // [v_offset[p] - p, v_offset[p] - p + sz[p] - 1) in the coalesced weight set (v_offset[p] =
+  // p * max_depth if padded):
+  //
+  device_vec_t<index_t> d_v_offsets(num_paths, stream);
+  size_t coalesced_sz{0};
+  if (use_padding) {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator(index_t{0}),
+                      thrust::make_counting_iterator(num_paths),
+                      d_v_offsets.begin(),
+                      [max_depth] __device__(auto path_indx) { return path_indx * max_depth; });
+    coalesced_sz = static_cast<size_t>(num_paths) * static_cast<size_t>(max_depth);
+  } else {
+    thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                           d_paths_sz.begin(),
+                           d_paths_sz.end(),
+                           d_v_offsets.begin());
+    coalesced_sz = static_cast<size_t>(thrust::reduce(
+      rmm::exec_policy(stream)->on(stream), d_paths_sz.begin(), d_paths_sz.end(), index_t{0}));
+  }
+
+  device_vec_t<vertex_t> d_coalesced_v(coalesced_sz, stream);  // coalesced vertex set
+  device_vec_t<weight_t> d_coalesced_w(coalesced_sz - static_cast<size_t>(num_paths),
+                                       stream);  // coalesced weight set
+  if (use_padding) {
+    thrust::fill(rmm::exec_policy(stream)->on(stream),
+                 d_coalesced_v.begin(),
+                 d_coalesced_v.end(),
+                 invalid_vertex_id<vertex_t>::value);
+    thrust::fill(rmm::exec_policy(stream)->on(stream),
+                 d_coalesced_w.begin(),
+                 d_coalesced_w.end(),
+                 weight_t{0.0});
+  }
+
+  thrust::scatter(rmm::exec_policy(stream)->on(stream),
+                  d_v_start.begin(),
+                  d_v_start.end(),
+                  d_v_offsets.begin(),
+                  d_coalesced_v.begin());
+  thrust::for_each(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_zip_iterator(thrust::make_tuple(
+      d_entry_paths.begin(), d_entry_positions.begin(), d_entry_v.begin(), d_entry_w.begin())),
+    thrust::make_zip_iterator(thrust::make_tuple(
+      d_entry_paths.end(), d_entry_positions.end(), d_entry_v.end(), d_entry_w.end())),
+    [ptr_v_offsets   = d_v_offsets.data(),
+     ptr_coalesced_v = d_coalesced_v.data(),
+     ptr_coalesced_w = d_coalesced_w.data()] __device__(auto val) {
+      auto path_indx = thrust::get<0>(val);
+      auto pos       = thrust::get<1>(val);
+      ptr_coalesced_v[ptr_v_offsets[path_indx] + pos]                 = thrust::get<2>(val);
+      ptr_coalesced_w[ptr_v_offsets[path_indx] - path_indx + pos - 1] = thrust::get<3>(val);
+    });
+
+  return std::make_tuple(std::move(d_coalesced_v),
+                         std::move(d_coalesced_w),
+                         std::move(d_paths_sz),
+                         seed0);  // also return seed for repro
 }
 
 }  // namespace detail
@@ -854,10 +1636,14 @@ random_walks_impl(raft::handle_t const& handle,
  * @param ptr_d_start Device pointer to set of starting vertex indices for the RW.
  * @param num_paths = number(paths).
  * @param max_depth maximum length of RWs.
+ * @param use_padding If true, paths are returned padded (num_paths x max_depth vertices, padded
+ * with invalid_vertex_id, and num_paths x (max_depth - 1) weights, padded with 0) instead of
+ * coalesced.
+ * @param sampling_params Sampling strategy (uniform, biased or node2vec) and node2vec parameters.
  * @return std::tuple<device_vec_t<vertex_t>, device_vec_t<weight_t>,
- * device_vec_t<index_t>> Triplet of coalesced RW paths, with corresponding edge weights for
- * each, and coresponding path sizes. This is meant to minimize the number of DF's to be passed to
- * the Python layer.
+ * device_vec_t<index_t>> Triplet of coalesced (or padded) RW paths, with corresponding edge
+ * weights for each, and coresponding path sizes. This is meant to minimize the number of DF's to
+ * be passed to the Python layer.
  */
 template <typename graph_t, typename index_t>
 std::tuple<rmm::device_uvector<typename graph_t::vertex_type>,
@@ -867,15 +1653,63 @@ random_walks(raft::handle_t const& handle,
              graph_t const& graph,
              typename graph_t::vertex_type const* ptr_d_start,
              index_t num_paths,
-             index_t max_depth)
+             index_t max_depth,
+             bool use_padding,
+             random_walk_sampling_params_t const& sampling_params)
 {
   using vertex_t = typename graph_t::vertex_type;
+  using edge_t   = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+
+  using random_engine_t  = detail::rrandom_gen_t<vertex_t, edge_t>;
+  using seed_t           = typename random_engine_t::seed_type;
+  using real_t           = typename random_engine_t::real_type;
+  using seeding_policy_t = detail::clock_seeding_t<seed_t>;
 
   // 0-copy const device view:
   //
   detail::device_const_vector_view<vertex_t, index_t> d_v_start{ptr_d_start, num_paths};
 
-  auto quad_tuple = detail::random_walks_impl(handle, graph, d_v_start, max_depth);
+  auto run = [&handle, &graph, &d_v_start, max_depth, use_padding](auto selector) {
+    return detail::
+      random_walks_impl<graph_t, random_engine_t, seeding_policy_t, index_t, decltype(selector)>(
+        handle, graph, d_v_start, max_depth, seeding_policy_t{}, selector, use_padding);
+  };
+
+  // FIXME: only uniform sampling is supported in multi-GPU, yet
+  //
+  CUGRAPH_EXPECTS(
+    !graph_t::is_multi_gpu || (sampling_params.sampling_type == random_walk_sampling_t::UNIFORM),
+    "Not implemented yet: multi-GPU random walks support uniform sampling only.");
+
+  auto quad_tuple = [&]() {
+    switch (sampling_params.sampling_type) {
+      case random_walk_sampling_t::UNIFORM:
+        return run(detail::uniform_selector_t<vertex_t, edge_t>{});
+      case random_walk_sampling_t::BIASED: {
+        CUGRAPH_EXPECTS(graph.is_weighted(),
+                        "Invalid input argument: biased sampling requires a weighted graph.");
+        auto d_cumulative_w = detail::compute_cumulative_weights(handle, graph);
+        return run(detail::biased_selector_t<vertex_t, edge_t, weight_t>{
+          graph.offsets(), d_cumulative_w.data()});
+      }
+      case random_walk_sampling_t::NODE2VEC: {
+        CUGRAPH_EXPECTS((sampling_params.p > 0.0) && (sampling_params.q > 0.0),
+                        "Invalid input argument: node2vec p and q should be positive.");
+        auto d_cumulative_w = graph.is_weighted()
+                                ? detail::compute_cumulative_weights(handle, graph)
+                                : detail::device_vec_t<weight_t>(0, handle.get_stream());
+        return run(detail::node2vec_selector_t<vertex_t, edge_t, weight_t, real_t>{
+          graph.offsets(),
+          graph.indices(),
+          graph.is_weighted() ? d_cumulative_w.data() : nullptr,
+          static_cast<real_t>(sampling_params.p),
+          static_cast<real_t>(sampling_params.q),
+          graph.has_sorted_neighbor_lists()});
+      }
+      default: CUGRAPH_FAIL("Invalid input argument: unsupported sampling type.");
+    }
+  }();
   // ignore last element of the quad, seed,
   // since it's meant for testing / debugging, only:
   //
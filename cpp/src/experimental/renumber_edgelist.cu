@@ -23,28 +23,159 @@
 #include <utilities/error.hpp>
 #include <utilities/host_scalar_comm.cuh>
 #include <utilities/shuffle_comm.cuh>
+#include <utilities/workspace.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
+#include <raft/cudart_utils.h>
+#include <raft/device_atomics.cuh>
 #include <raft/handle.hpp>
 #include <rmm/device_uvector.hpp>
 
 #include <thrust/binary_search.h>
 #include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
 #include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
 
 #include <algorithm>
+#include <functional>
 #include <iterator>
+#include <limits>
 #include <numeric>
+#include <queue>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 namespace cugraph {
 namespace experimental {
 namespace detail {
 
 #ifdef CUCO_STATIC_MAP_DEFINED
+// sorted unique labels (and their multiplicities if compute_counts is true) of the label lists,
+// labels are deduplicated with a hash map (so only the unique labels are sorted); the hash map
+// capacity is proportional to the total number of labels
+template <typename vertex_t, typename edge_t>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<edge_t>> unique_labels_and_counts(
+  raft::handle_t const& handle,
+  std::vector<vertex_t const*> const& label_lists,
+  std::vector<edge_t> const& label_list_sizes,
+  bool compute_counts)
+{
+  double constexpr load_factor = 0.7;
+
+  std::vector<edge_t> displs(label_list_sizes.size(), edge_t{0});
+  std::partial_sum(label_list_sizes.begin(), label_list_sizes.end() - 1, displs.begin() + 1);
+  auto num_labels = displs.back() + label_list_sizes.back();
+
+  rmm::device_uvector<vertex_t> unique_labels(0, handle.get_stream());
+  rmm::device_uvector<edge_t> counts(0, handle.get_stream());
+  if (num_labels == 0) { return std::make_tuple(std::move(unique_labels), std::move(counts)); }
+
+  CUDA_TRY(cudaStreamSynchronize(
+    handle.get_stream()));  // cuco::static_map currently does not take stream
+
+  // the value of a label is the (global) position of its first inserted instance
+  cuco::static_map<vertex_t, edge_t> label_map{
+    // FIXME: std::max(..., ...) as a temporary workaround for
+    // https://github.com/NVIDIA/cuCollections/issues/72 and
+    // https://github.com/NVIDIA/cuCollections/issues/73
+    std::max(static_cast<size_t>(static_cast<double>(num_labels) / load_factor),
+             static_cast<size_t>(num_labels) + 1),
+    invalid_vertex_id<vertex_t>::value,
+    std::numeric_limits<edge_t>::max()};
+
+  rmm::device_uvector<bool> is_first(num_labels, handle.get_stream());
+  for (size_t i = 0; i < label_lists.size(); ++i) {
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      thrust::make_counting_iterator(edge_t{0}),
+                      thrust::make_counting_iterator(label_list_sizes[i]),
+                      is_first.begin() + displs[i],
+                      [labels = label_lists[i],
+                       displ  = displs[i],
+                       view   = label_map.get_device_mutable_view()] __device__(auto j) mutable {
+                        return view.insert(thrust::make_pair(labels[j], displ + j));
+                      });
+  }
+
+  auto num_unique_labels = static_cast<size_t>(
+    thrust::count(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                  is_first.begin(),
+                  is_first.end(),
+                  true));
+  rmm::device_uvector<edge_t> first_positions(num_unique_labels, handle.get_stream());
+  thrust::copy_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                  thrust::make_counting_iterator(edge_t{0}),
+                  thrust::make_counting_iterator(num_labels),
+                  is_first.begin(),
+                  first_positions.begin(),
+                  thrust::identity<bool>());
+  is_first.resize(0, handle.get_stream());
+  is_first.shrink_to_fit(handle.get_stream());
+
+  unique_labels.resize(num_unique_labels, handle.get_stream());
+  for (size_t i = 0; i < label_lists.size(); ++i) {
+    auto first = thrust::lower_bound(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                                     first_positions.begin(),
+                                     first_positions.end(),
+                                     displs[i]);
+    auto last  = thrust::lower_bound(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                                     first_positions.begin(),
+                                     first_positions.end(),
+                                     displs[i] + label_list_sizes[i]);
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      first,
+                      last,
+                      unique_labels.begin() + thrust::distance(first_positions.begin(), first),
+                      [labels = label_lists[i], displ = displs[i]] __device__(auto pos) {
+                        return labels[pos - displ];
+                      });
+  }
+
+  if (compute_counts) {
+    counts.resize(num_unique_labels, handle.get_stream());
+    thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 counts.begin(),
+                 counts.end(),
+                 edge_t{0});
+    for (size_t i = 0; i < label_lists.size(); ++i) {
+      thrust::for_each(
+        rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+        label_lists[i],
+        label_lists[i] + label_list_sizes[i],
+        [position_first = first_positions.begin(),
+         position_last  = first_positions.end(),
+         counts         = counts.data(),
+         view           = label_map.get_device_view()] __device__(auto label) {
+          auto pos = view.find(label)->second.load(cuda::std::memory_order_relaxed);
+          auto idx = thrust::distance(
+            position_first, thrust::lower_bound(thrust::seq, position_first, position_last, pos));
+          atomicAdd(counts + idx, edge_t{1});
+        });
+    }
+    thrust::sort_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        unique_labels.begin(),
+                        unique_labels.end(),
+                        counts.begin());
+  } else {
+    thrust::sort(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 unique_labels.begin(),
+                 unique_labels.end());
+  }
+
+  return std::make_tuple(std::move(unique_labels), std::move(counts));
+}
+
 template <typename vertex_t, typename edge_t, bool multi_gpu>
 rmm::device_uvector<vertex_t> compute_renumber_map(
   raft::handle_t const& handle,
@@ -52,11 +183,11 @@ rmm::device_uvector<vertex_t> compute_renumber_map(
   vertex_t num_local_vertices /* relevant only if vertices != nullptr */,
   std::vector<vertex_t const*> const& edgelist_major_vertices,
   std::vector<vertex_t const*> const& edgelist_minor_vertices,
-  std::vector<edge_t> const& edgelist_edge_counts)
+  std::vector<edge_t> const& edgelist_edge_counts,
+  vertex_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  vertex_t num_hubs)
 {
-  // FIXME: compare this sort based approach with hash based approach in both speed and memory
-  // footprint
-
   // 1. acquire (unique major label, count) pairs
 
   rmm::device_uvector<vertex_t> major_labels(0, handle.get_stream());
@@ -64,40 +195,23 @@ rmm::device_uvector<vertex_t> compute_renumber_map(
   for (size_t i = 0; i < edgelist_major_vertices.size(); ++i) {
     rmm::device_uvector<vertex_t> tmp_major_labels(0, handle.get_stream());
     rmm::device_uvector<edge_t> tmp_major_counts(0, handle.get_stream());
-    {
-      rmm::device_uvector<vertex_t> sorted_major_labels(edgelist_edge_counts[i],
-                                                        handle.get_stream());
-      thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-                   edgelist_major_vertices[i],
-                   edgelist_major_vertices[i] + edgelist_edge_counts[i],
-                   sorted_major_labels.begin());
-      thrust::sort(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-                   sorted_major_labels.begin(),
-                   sorted_major_labels.end());
-      auto num_unique_labels =
-        thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-                         thrust::make_counting_iterator(size_t{0}),
-                         thrust::make_counting_iterator(sorted_major_labels.size()),
-                         [labels = sorted_major_labels.data()] __device__(auto i) {
-                           return (i == 0) || (labels[i - 1] != labels[i]);
-                         });
-      tmp_major_labels.resize(num_unique_labels, handle.get_stream());
-      tmp_major_counts.resize(tmp_major_labels.size(), handle.get_stream());
-      thrust::reduce_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-                            sorted_major_labels.begin(),
-                            sorted_major_labels.end(),
-                            thrust::make_constant_iterator(edge_t{1}),
-                            tmp_major_labels.begin(),
-                            tmp_major_counts.begin());
-    }
+    std::tie(tmp_major_labels, tmp_major_counts) =
+      unique_labels_and_counts(handle,
+                               std::vector<vertex_t const*>{edgelist_major_vertices[i]},
+                               std::vector<edge_t>{edgelist_edge_counts[i]},
+                               true);
 
     if (multi_gpu) {
       auto& col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
       auto const col_comm_rank = col_comm.get_rank();
       auto const col_comm_size = col_comm.get_size();
 
-      rmm::device_uvector<vertex_t> rx_major_labels(0, handle.get_stream());
-      rmm::device_uvector<edge_t> rx_major_counts(0, handle.get_stream());
+      // the gathered (label, count) pairs are reduced to major_labels & major_counts
+      detail::workspace_phase_t workspace_phase(handle);
+      auto workspace_mr = detail::get_workspace_resource(handle);
+
+      rmm::device_uvector<vertex_t> rx_major_labels(0, handle.get_stream(), workspace_mr);
+      rmm::device_uvector<edge_t> rx_major_counts(0, handle.get_stream(), workspace_mr);
       auto rx_sizes = host_scalar_gather(
         col_comm, tmp_major_labels.size(), static_cast<int>(i), handle.get_stream());
       std::vector<size_t> rx_displs{};
@@ -147,37 +261,25 @@ rmm::device_uvector<vertex_t> compute_renumber_map(
 
   // 2. acquire unique minor labels
 
-  std::vector<edge_t> minor_displs(edgelist_minor_vertices.size(), edge_t{0});
-  std::partial_sum(
-    edgelist_edge_counts.begin(), edgelist_edge_counts.end() - 1, minor_displs.begin() + 1);
-  rmm::device_uvector<vertex_t> minor_labels(minor_displs.back() + edgelist_edge_counts.back(),
-                                             handle.get_stream());
-  for (size_t i = 0; i < edgelist_minor_vertices.size(); ++i) {
-    thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-                 edgelist_minor_vertices[i],
-                 edgelist_minor_vertices[i] + edgelist_edge_counts[i],
-                 minor_labels.begin() + minor_displs[i]);
-  }
-  thrust::sort(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-               minor_labels.begin(),
-               minor_labels.end());
-  minor_labels.resize(
-    thrust::distance(minor_labels.begin(),
-                     thrust::unique(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-                                    minor_labels.begin(),
-                                    minor_labels.end())),
-    handle.get_stream());
+  rmm::device_uvector<vertex_t> minor_labels(0, handle.get_stream());
+  std::tie(minor_labels, std::ignore) = unique_labels_and_counts(
+    handle, edgelist_minor_vertices, edgelist_edge_counts, false);
   if (multi_gpu) {
+    auto const comm_size     = handle.get_comms().get_size();
     auto& row_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
     auto const row_comm_size = row_comm.get_size();
 
+    // the minor labels are shuffled to the row_comm ranks of the GPUs owning the labels
     rmm::device_uvector<vertex_t> rx_minor_labels(0, handle.get_stream());
     std::tie(rx_minor_labels, std::ignore) = groupby_gpuid_and_shuffle_values(
       row_comm,
       minor_labels.begin(),
       minor_labels.end(),
-      [key_func = detail::compute_gpu_id_from_vertex_t<vertex_t>{row_comm_size}] __device__(
-        auto val) { return key_func(val); },
+      [row_comm_size,
+       key_func = detail::compute_gpu_id_from_vertex_t<vertex_t>{
+         comm_size, hub_vertices, hub_gpu_ids, num_hubs}] __device__(auto val) {
+        return key_func(val) % row_comm_size;
+      },
       handle.get_stream());
     thrust::sort(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
                  rx_minor_labels.begin(),
@@ -285,7 +387,10 @@ void expensive_check_edgelist(
   vertex_t num_local_vertices /* relevant only if local_vertices != nullptr */,
   std::vector<vertex_t const*> const& edgelist_major_vertices,
   std::vector<vertex_t const*> const& edgelist_minor_vertices,
-  std::vector<edge_t> const& edgelist_edge_counts)
+  std::vector<edge_t> const& edgelist_edge_counts,
+  vertex_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  vertex_t num_hubs)
 {
   rmm::device_uvector<vertex_t> sorted_local_vertices(
     local_vertices != nullptr ? num_local_vertices : vertex_t{0}, handle.get_stream());
@@ -325,8 +430,8 @@ void expensive_check_edgelist(
         local_vertices,
         local_vertices + num_local_vertices,
         [comm_rank,
-         key_func =
-           detail::compute_gpu_id_from_vertex_t<vertex_t>{comm_size}] __device__(auto val) {
+         key_func = detail::compute_gpu_id_from_vertex_t<vertex_t>{
+           comm_size, hub_vertices, hub_gpu_ids, num_hubs}] __device__(auto val) {
           return key_func(val) != comm_rank;
         }) == 0,
       "Invalid input argument: local_vertices should be pre-shuffled.");
@@ -346,10 +451,12 @@ void expensive_check_edgelist(
            col_comm_rank,
            i,
            gpu_id_key_func =
-             detail::compute_gpu_id_from_edge_t<vertex_t>{comm_size, row_comm_size, col_comm_size},
+             detail::compute_gpu_id_from_edge_t<vertex_t>{
+               comm_size, row_comm_size, col_comm_size, hub_vertices, hub_gpu_ids, num_hubs},
            partition_id_key_func =
              detail::compute_partition_id_from_edge_t<vertex_t>{
-               comm_size, row_comm_size, col_comm_size}] __device__(auto edge) {
+               comm_size, row_comm_size, col_comm_size, hub_vertices, hub_gpu_ids, num_hubs}]
+          __device__(auto edge) {
             return (gpu_id_key_func(thrust::get<0>(edge), thrust::get<1>(edge)) != comm_rank) ||
                    (partition_id_key_func(thrust::get<0>(edge), thrust::get<1>(edge)) !=
                     row_comm_rank * col_comm_size + col_comm_rank + i * comm_size);
@@ -466,6 +573,9 @@ renumber_edgelist(raft::handle_t const& handle,
                   std::vector<vertex_t*> const& edgelist_major_vertices /* [INOUT] */,
                   std::vector<vertex_t*> const& edgelist_minor_vertices /* [INOUT] */,
                   std::vector<edge_t> const& edgelist_edge_counts,
+                  vertex_t const* hub_vertices,
+                  int const* hub_gpu_ids,
+                  vertex_t num_hubs,
                   bool do_expensive_check)
 {
   // FIXME: remove this check once we drop Pascal support
@@ -497,7 +607,10 @@ renumber_edgelist(raft::handle_t const& handle,
                                                           num_local_vertices,
                                                           edgelist_const_major_vertices,
                                                           edgelist_const_minor_vertices,
-                                                          edgelist_edge_counts);
+                                                          edgelist_edge_counts,
+                                                          hub_vertices,
+                                                          hub_gpu_ids,
+                                                          num_hubs);
   }
 
   // 1. compute renumber map
@@ -508,7 +621,10 @@ renumber_edgelist(raft::handle_t const& handle,
                                                               num_local_vertices,
                                                               edgelist_const_major_vertices,
                                                               edgelist_const_minor_vertices,
-                                                              edgelist_edge_counts);
+                                                              edgelist_edge_counts,
+                                                              hub_vertices,
+                                                              hub_gpu_ids,
+                                                              num_hubs);
 
   // 2. initialize partition_t object, number_of_vertices, and number_of_edges for the coarsened
   // graph
@@ -665,7 +781,10 @@ std::enable_if_t<!multi_gpu, rmm::device_uvector<vertex_t>> renumber_edgelist(
       num_vertices,
       std::vector<vertex_t const*>{edgelist_major_vertices},
       std::vector<vertex_t const*>{edgelist_minor_vertices},
-      std::vector<edge_t>{num_edgelist_edges});
+      std::vector<edge_t>{num_edgelist_edges},
+      static_cast<vertex_t const*>(nullptr),
+      static_cast<int const*>(nullptr),
+      vertex_t{0});
   }
 
   auto renumber_map_labels = detail::compute_renumber_map<vertex_t, edge_t, multi_gpu>(
@@ -674,7 +793,10 @@ std::enable_if_t<!multi_gpu, rmm::device_uvector<vertex_t>> renumber_edgelist(
     num_vertices,
     std::vector<vertex_t const*>{edgelist_major_vertices},
     std::vector<vertex_t const*>{edgelist_minor_vertices},
-    std::vector<edge_t>{num_edgelist_edges});
+    std::vector<edge_t>{num_edgelist_edges},
+    static_cast<vertex_t const*>(nullptr),
+    static_cast<int const*>(nullptr),
+    vertex_t{0});
 
   double constexpr load_factor = 0.7;
 
@@ -719,6 +841,193 @@ std::enable_if_t<!multi_gpu, rmm::device_uvector<vertex_t>> renumber_edgelist(
 
 }  // namespace detail
 
+template <typename vertex_t, typename edge_t>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<int>>
+compute_edge_balanced_hub_gpu_ids(raft::handle_t const& handle,
+                                  vertex_t const* edgelist_rows,
+                                  vertex_t const* edgelist_cols,
+                                  edge_t num_edgelist_edges)
+{
+  size_t constexpr max_hubs_per_gpu = 1024;  // FIXME: requires tuning
+
+  auto& comm           = handle.get_comms();
+  auto const comm_size = comm.get_size();
+
+  // 1. compute the degrees (in-degrees + out-degrees) of the vertices hashed to this GPU
+
+  rmm::device_uvector<vertex_t> labels(static_cast<size_t>(num_edgelist_edges) * 2,
+                                       handle.get_stream());
+  thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               edgelist_rows,
+               edgelist_rows + num_edgelist_edges,
+               labels.begin());
+  thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               edgelist_cols,
+               edgelist_cols + num_edgelist_edges,
+               labels.begin() + num_edgelist_edges);
+  thrust::sort(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()), labels.begin(), labels.end());
+
+  rmm::device_uvector<vertex_t> unique_labels(labels.size(), handle.get_stream());
+  rmm::device_uvector<edge_t> degrees(unique_labels.size(), handle.get_stream());
+  auto pair_it =
+    thrust::reduce_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                          labels.begin(),
+                          labels.end(),
+                          thrust::make_constant_iterator(edge_t{1}),
+                          unique_labels.begin(),
+                          degrees.begin());
+  unique_labels.resize(thrust::distance(unique_labels.begin(), thrust::get<0>(pair_it)),
+                       handle.get_stream());
+  degrees.resize(unique_labels.size(), handle.get_stream());
+  labels.resize(0, handle.get_stream());
+  labels.shrink_to_fit(handle.get_stream());
+
+  {
+    rmm::device_uvector<vertex_t> rx_labels(0, handle.get_stream());
+    rmm::device_uvector<edge_t> rx_degrees(0, handle.get_stream());
+    auto pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(unique_labels.begin(), degrees.begin()));
+    std::forward_as_tuple(std::tie(rx_labels, rx_degrees), std::ignore) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        pair_first,
+        pair_first + unique_labels.size(),
+        [key_func = detail::compute_gpu_id_from_vertex_t<vertex_t>{comm_size}] __device__(
+          auto val) { return key_func(thrust::get<0>(val)); },
+        handle.get_stream());
+    thrust::sort_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        rx_labels.begin(),
+                        rx_labels.end(),
+                        rx_degrees.begin());
+    unique_labels.resize(rx_labels.size(), handle.get_stream());
+    degrees.resize(unique_labels.size(), handle.get_stream());
+    pair_it = thrust::reduce_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                                    rx_labels.begin(),
+                                    rx_labels.end(),
+                                    rx_degrees.begin(),
+                                    unique_labels.begin(),
+                                    degrees.begin());
+    unique_labels.resize(thrust::distance(unique_labels.begin(), thrust::get<0>(pair_it)),
+                         handle.get_stream());
+    degrees.resize(unique_labels.size(), handle.get_stream());
+  }
+
+  // 2. vertices with degrees no smaller than hub_degree_threshold are hubs (there are at most
+  // about comm_size * max_hubs_per_gpu hubs), the remaining vertices stay in the GPUs they are
+  // hashed to and their degrees add up to the base loads of those GPUs
+
+  auto total_degree = host_scalar_allreduce(
+    comm, static_cast<edge_t>(num_edgelist_edges * 2), handle.get_stream());
+  auto hub_degree_threshold = std::max(
+    total_degree / static_cast<edge_t>(comm_size * max_hubs_per_gpu), edge_t{1});
+
+  auto base_load = thrust::transform_reduce(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    degrees.begin(),
+    degrees.end(),
+    [hub_degree_threshold] __device__(auto degree) {
+      return degree < hub_degree_threshold ? degree : edge_t{0};
+    },
+    edge_t{0},
+    thrust::plus<edge_t>());
+  auto num_local_hubs = static_cast<size_t>(
+    thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     degrees.begin(),
+                     degrees.end(),
+                     [hub_degree_threshold] __device__(auto degree) {
+                       return degree >= hub_degree_threshold;
+                     }));
+  rmm::device_uvector<vertex_t> local_hubs(num_local_hubs, handle.get_stream());
+  rmm::device_uvector<edge_t> local_hub_degrees(num_local_hubs, handle.get_stream());
+  {
+    auto pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(unique_labels.begin(), degrees.begin()));
+    thrust::copy_if(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      pair_first,
+      pair_first + unique_labels.size(),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(local_hubs.begin(), local_hub_degrees.begin())),
+      [hub_degree_threshold] __device__(auto pair) {
+        return thrust::get<1>(pair) >= hub_degree_threshold;
+      });
+  }
+
+  // 3. gather the hubs and the base loads (every GPU computes the same assignment)
+
+  auto base_loads = host_scalar_allgather(comm, base_load, handle.get_stream());
+  auto rx_counts  = host_scalar_allgather(comm, num_local_hubs, handle.get_stream());
+  std::vector<size_t> displacements(rx_counts.size(), size_t{0});
+  std::partial_sum(rx_counts.begin(), rx_counts.end() - 1, displacements.begin() + 1);
+
+  rmm::device_uvector<vertex_t> hubs(displacements.back() + rx_counts.back(),
+                                     handle.get_stream());
+  rmm::device_uvector<edge_t> hub_degrees(hubs.size(), handle.get_stream());
+  device_allgatherv(
+    comm, local_hubs.data(), hubs.data(), rx_counts, displacements, handle.get_stream());
+  device_allgatherv(comm,
+                    local_hub_degrees.data(),
+                    hub_degrees.data(),
+                    rx_counts,
+                    displacements,
+                    handle.get_stream());
+
+  std::vector<vertex_t> h_hubs(hubs.size());
+  std::vector<edge_t> h_hub_degrees(h_hubs.size());
+  raft::update_host(h_hubs.data(), hubs.data(), hubs.size(), handle.get_stream());
+  raft::update_host(
+    h_hub_degrees.data(), hub_degrees.data(), hub_degrees.size(), handle.get_stream());
+  handle.get_stream_view().synchronize();
+
+  // 4. assign the hubs (in non-ascending degree order, ties are broken by vertex IDs) to the least
+  // loaded GPUs (ties are broken by GPU IDs)
+
+  std::vector<size_t> hub_indices(h_hubs.size());
+  std::iota(hub_indices.begin(), hub_indices.end(), size_t{0});
+  std::sort(hub_indices.begin(), hub_indices.end(), [&h_hubs, &h_hub_degrees](auto lhs, auto rhs) {
+    return h_hub_degrees[lhs] != h_hub_degrees[rhs] ? h_hub_degrees[lhs] > h_hub_degrees[rhs]
+                                                    : h_hubs[lhs] < h_hubs[rhs];
+  });
+
+  std::priority_queue<std::pair<edge_t, int>,
+                      std::vector<std::pair<edge_t, int>>,
+                      std::greater<std::pair<edge_t, int>>>
+    gpu_loads{};
+  for (int i = 0; i < comm_size; ++i) {
+    gpu_loads.push(std::make_pair(base_loads[i], i));
+  }
+  std::vector<int> h_hub_gpu_ids(h_hubs.size());
+  for (auto i : hub_indices) {
+    auto least_loaded = gpu_loads.top();
+    gpu_loads.pop();
+    h_hub_gpu_ids[i] = least_loaded.second;
+    gpu_loads.push(std::make_pair(least_loaded.first + h_hub_degrees[i], least_loaded.second));
+  }
+
+  // 5. sort the hubs by vertex ID (for binary search)
+
+  std::sort(hub_indices.begin(), hub_indices.end(), [&h_hubs](auto lhs, auto rhs) {
+    return h_hubs[lhs] < h_hubs[rhs];
+  });
+  std::vector<vertex_t> h_sorted_hubs(hub_indices.size());
+  std::vector<int> h_sorted_hub_gpu_ids(hub_indices.size());
+  for (size_t i = 0; i < hub_indices.size(); ++i) {
+    h_sorted_hubs[i]        = h_hubs[hub_indices[i]];
+    h_sorted_hub_gpu_ids[i] = h_hub_gpu_ids[hub_indices[i]];
+  }
+
+  rmm::device_uvector<int> hub_gpu_ids(hubs.size(), handle.get_stream());
+  raft::update_device(hubs.data(), h_sorted_hubs.data(), h_sorted_hubs.size(), handle.get_stream());
+  raft::update_device(hub_gpu_ids.data(),
+                      h_sorted_hub_gpu_ids.data(),
+                      h_sorted_hub_gpu_ids.size(),
+                      handle.get_stream());
+  handle.get_stream_view().synchronize();  // h_sorted_hubs & h_sorted_hub_gpu_ids go out of scope
+
+  return std::make_tuple(std::move(hubs), std::move(hub_gpu_ids));
+}
+
 template <typename vertex_t, typename edge_t, bool multi_gpu>
 std::enable_if_t<multi_gpu,
                  std::tuple<rmm::device_uvector<vertex_t>, partition_t<vertex_t>, vertex_t, edge_t>>
@@ -732,13 +1041,17 @@ renumber_edgelist(raft::handle_t const& handle,
   CUGRAPH_EXPECTS(
     handle.get_device_properties().major >= 7,
     "This version of renumber_edgelist not supported on Pascal and older architectures.");
-  return detail::renumber_edgelist<vertex_t, edge_t, multi_gpu>(handle,
-                                                                static_cast<vertex_t*>(nullptr),
-                                                                vertex_t{0},
-                                                                edgelist_major_vertices,
-                                                                edgelist_minor_vertices,
-                                                                edgelist_edge_counts,
-                                                                do_expensive_check);
+  return detail::renumber_edgelist<vertex_t, edge_t, multi_gpu>(
+    handle,
+    static_cast<vertex_t*>(nullptr),
+    vertex_t{0},
+    edgelist_major_vertices,
+    edgelist_minor_vertices,
+    edgelist_edge_counts,
+    static_cast<vertex_t const*>(nullptr),
+    static_cast<int const*>(nullptr),
+    vertex_t{0},
+    do_expensive_check);
 }
 
 template <typename vertex_t, typename edge_t, bool multi_gpu>
@@ -772,6 +1085,37 @@ renumber_edgelist(raft::handle_t const& handle,
                   std::vector<vertex_t*> const& edgelist_minor_vertices /* [INOUT] */,
                   std::vector<edge_t> const& edgelist_edge_counts,
                   bool do_expensive_check)
+{
+  // FIXME: remove this check once we drop Pascal support
+  CUGRAPH_EXPECTS(
+    handle.get_device_properties().major >= 7,
+    "This version of renumber_edgelist not supported on Pascal and older architectures.");
+  return detail::renumber_edgelist<vertex_t, edge_t, multi_gpu>(
+    handle,
+    local_vertices,
+    num_local_vertices,
+    edgelist_major_vertices,
+    edgelist_minor_vertices,
+    edgelist_edge_counts,
+    static_cast<vertex_t const*>(nullptr),
+    static_cast<int const*>(nullptr),
+    vertex_t{0},
+    do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, bool multi_gpu>
+std::enable_if_t<multi_gpu,
+                 std::tuple<rmm::device_uvector<vertex_t>, partition_t<vertex_t>, vertex_t, edge_t>>
+renumber_edgelist(raft::handle_t const& handle,
+                  vertex_t const* local_vertices,
+                  vertex_t num_local_vertices,
+                  std::vector<vertex_t*> const& edgelist_major_vertices /* [INOUT] */,
+                  std::vector<vertex_t*> const& edgelist_minor_vertices /* [INOUT] */,
+                  std::vector<edge_t> const& edgelist_edge_counts,
+                  vertex_t const* hub_vertices,
+                  int const* hub_gpu_ids,
+                  vertex_t num_hubs,
+                  bool do_expensive_check)
 {
   // FIXME: remove this check once we drop Pascal support
   CUGRAPH_EXPECTS(
@@ -783,6 +1127,9 @@ renumber_edgelist(raft::handle_t const& handle,
                                                                 edgelist_major_vertices,
                                                                 edgelist_minor_vertices,
                                                                 edgelist_edge_counts,
+                                                                hub_vertices,
+                                                                hub_gpu_ids,
+                                                                num_hubs,
                                                                 do_expensive_check);
 }
 
@@ -838,6 +1185,25 @@ renumber_edgelist<int32_t, int32_t, true>(
   std::vector<int32_t> const& edgelist_edge_counts,
   bool do_expensive_check);
 
+template std::tuple<rmm::device_uvector<int32_t>, partition_t<int32_t>, int32_t, int32_t>
+renumber_edgelist<int32_t, int32_t, true>(
+  raft::handle_t const& handle,
+  int32_t const* local_vertices,
+  int32_t num_local_vertices,
+  std::vector<int32_t*> const& edgelist_major_vertices /* [INOUT] */,
+  std::vector<int32_t*> const& edgelist_minor_vertices /* [INOUT] */,
+  std::vector<int32_t> const& edgelist_edge_counts,
+  int32_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int32_t num_hubs,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<int>>
+compute_edge_balanced_hub_gpu_ids<int32_t, int32_t>(raft::handle_t const& handle,
+                                                    int32_t const* edgelist_rows,
+                                                    int32_t const* edgelist_cols,
+                                                    int32_t num_edgelist_edges);
+
 template rmm::device_uvector<int32_t> renumber_edgelist<int32_t, int32_t, false>(
   raft::handle_t const& handle,
   int32_t const* vertices,
@@ -874,6 +1240,25 @@ renumber_edgelist<int32_t, int64_t, true>(
   std::vector<int64_t> const& edgelist_edge_counts,
   bool do_expensive_check);
 
+template std::tuple<rmm::device_uvector<int32_t>, partition_t<int32_t>, int32_t, int64_t>
+renumber_edgelist<int32_t, int64_t, true>(
+  raft::handle_t const& handle,
+  int32_t const* local_vertices,
+  int32_t num_local_vertices,
+  std::vector<int32_t*> const& edgelist_major_vertices /* [INOUT] */,
+  std::vector<int32_t*> const& edgelist_minor_vertices /* [INOUT] */,
+  std::vector<int64_t> const& edgelist_edge_counts,
+  int32_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int32_t num_hubs,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<int>>
+compute_edge_balanced_hub_gpu_ids<int32_t, int64_t>(raft::handle_t const& handle,
+                                                    int32_t const* edgelist_rows,
+                                                    int32_t const* edgelist_cols,
+                                                    int64_t num_edgelist_edges);
+
 template rmm::device_uvector<int32_t> renumber_edgelist<int32_t, int64_t, false>(
   raft::handle_t const& handle,
   int32_t const* vertices,
@@ -910,6 +1295,25 @@ renumber_edgelist<int64_t, int64_t, true>(
   std::vector<int64_t> const& edgelist_edge_counts,
   bool do_expensive_check);
 
+template std::tuple<rmm::device_uvector<int64_t>, partition_t<int64_t>, int64_t, int64_t>
+renumber_edgelist<int64_t, int64_t, true>(
+  raft::handle_t const& handle,
+  int64_t const* local_vertices,
+  int64_t num_local_vertices,
+  std::vector<int64_t*> const& edgelist_major_vertices /* [INOUT] */,
+  std::vector<int64_t*> const& edgelist_minor_vertices /* [INOUT] */,
+  std::vector<int64_t> const& edgelist_edge_counts,
+  int64_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int64_t num_hubs,
+  bool do_expensive_check);
+
+template std::tuple<rmm::device_uvector<int64_t>, rmm::device_uvector<int>>
+compute_edge_balanced_hub_gpu_ids<int64_t, int64_t>(raft::handle_t const& handle,
+                                                    int64_t const* edgelist_rows,
+                                                    int64_t const* edgelist_cols,
+                                                    int64_t num_edgelist_edges);
+
 template rmm::device_uvector<int64_t> renumber_edgelist<int64_t, int64_t, false>(
   raft::handle_t const& handle,
   int64_t const* vertices,
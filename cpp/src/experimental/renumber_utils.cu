@@ -21,6 +21,8 @@
 #include <experimental/graph_functions.hpp>
 #include <utilities/collect_comm.cuh>
 #include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+#include <utilities/shuffle_comm.cuh>
 
 #include <thrust/binary_search.h>
 #include <thrust/copy.h>
@@ -31,6 +33,10 @@
 #include <thrust/sort.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <memory>
+#include <vector>
 
 namespace cugraph {
 namespace experimental {
@@ -42,6 +48,9 @@ void renumber_ext_vertices(raft::handle_t const& handle,
                            vertex_t const* renumber_map_labels,
                            vertex_t local_int_vertex_first,
                            vertex_t local_int_vertex_last,
+                           vertex_t const* hub_vertices,
+                           int const* hub_gpu_ids,
+                           vertex_t num_hubs,
                            bool do_expensive_check)
 {
   double constexpr load_factor = 0.7;
@@ -100,7 +109,8 @@ void renumber_ext_vertices(raft::handle_t const& handle,
       thrust::make_counting_iterator(local_int_vertex_first),
       sorted_unique_ext_vertices.begin(),
       sorted_unique_ext_vertices.end(),
-      detail::compute_gpu_id_from_vertex_t<vertex_t>{comm_size},
+      detail::compute_gpu_id_from_vertex_t<vertex_t>{
+        comm_size, hub_vertices, hub_gpu_ids, num_hubs},
       handle.get_stream());
 
     handle.get_stream_view().synchronize();  // cuco::static_map currently does not take stream
@@ -198,6 +208,27 @@ void renumber_ext_vertices(raft::handle_t const& handle,
 #endif
 }
 
+template <typename vertex_t, bool multi_gpu>
+void renumber_ext_vertices(raft::handle_t const& handle,
+                           vertex_t* vertices /* [INOUT] */,
+                           size_t num_vertices,
+                           vertex_t const* renumber_map_labels,
+                           vertex_t local_int_vertex_first,
+                           vertex_t local_int_vertex_last,
+                           bool do_expensive_check)
+{
+  renumber_ext_vertices<vertex_t, multi_gpu>(handle,
+                                             vertices,
+                                             num_vertices,
+                                             renumber_map_labels,
+                                             local_int_vertex_first,
+                                             local_int_vertex_last,
+                                             static_cast<vertex_t const*>(nullptr),
+                                             static_cast<int const*>(nullptr),
+                                             vertex_t{0},
+                                             do_expensive_check);
+}
+
 template <typename vertex_t>
 void unrenumber_local_int_vertices(
   raft::handle_t const& handle,
@@ -387,8 +418,285 @@ void unrenumber_int_vertices(raft::handle_t const& handle,
 #endif
 }
 
+namespace detail {
+
+template <typename vertex_t>
+struct ext_to_int_vertex_map_t {
+#ifdef CUCO_STATIC_MAP_DEFINED
+  std::unique_ptr<cuco::static_map<vertex_t, vertex_t>> map_ptr{};
+#endif
+};
+
+#ifdef CUCO_STATIC_MAP_DEFINED
+// (extended device lambdas are not allowed in constructors)
+template <typename vertex_t>
+std::unique_ptr<cuco::static_map<vertex_t, vertex_t>> build_ext_to_int_vertex_map(
+  raft::handle_t const& handle,
+  vertex_t const* labels,
+  vertex_t local_int_vertex_first,
+  size_t num_labels)
+{
+  double constexpr load_factor = 0.7;
+
+  handle.get_stream_view().synchronize();  // cuco::static_map currently does not take stream
+
+  auto map_ptr = std::make_unique<cuco::static_map<vertex_t, vertex_t>>(
+    // FIXME: std::max(..., ...) as a temporary workaround for
+    // https://github.com/NVIDIA/cuCollections/issues/72 and
+    // https://github.com/NVIDIA/cuCollections/issues/73
+    std::max(static_cast<size_t>(static_cast<double>(num_labels) / load_factor), num_labels + 1),
+    invalid_vertex_id<vertex_t>::value,
+    invalid_vertex_id<vertex_t>::value);
+
+  auto pair_first = thrust::make_transform_iterator(
+    thrust::make_zip_iterator(
+      thrust::make_tuple(labels, thrust::make_counting_iterator(local_int_vertex_first))),
+    [] __device__(auto val) {
+      return thrust::make_pair(thrust::get<0>(val), thrust::get<1>(val));
+    });
+  // FIXME: a temporary workaround. cuco::static_map currently launches a kernel even if the grid
+  // size is 0; this leads to cudaErrorInvaildConfiguration.
+  if (num_labels > 0) { map_ptr->insert(pair_first, pair_first + num_labels); }
+
+  return map_ptr;
+}
+#endif
+
+}  // namespace detail
+
+template <typename vertex_t, bool multi_gpu>
+renumber_map_t<vertex_t, multi_gpu>::renumber_map_t(
+  raft::handle_t const& handle,
+  rmm::device_uvector<vertex_t>&& renumber_map_labels,
+  vertex_t local_int_vertex_first,
+  vertex_t local_int_vertex_last,
+  std::vector<vertex_t> const& vertex_partition_lasts,
+  bool do_expensive_check)
+  : labels_(std::move(renumber_map_labels)),
+    local_int_vertex_first_(local_int_vertex_first),
+    local_int_vertex_last_(local_int_vertex_last),
+    vertex_partition_lasts_(multi_gpu ? vertex_partition_lasts
+                                      : std::vector<vertex_t>{local_int_vertex_last}),
+    ext_to_int_map_ptr_(std::make_unique<detail::ext_to_int_vertex_map_t<vertex_t>>())
+{
+  // FIXME: remove this check once we drop Pascal support
+  CUGRAPH_EXPECTS(handle.get_device_properties().major >= 7,
+                  "renumber_map_t not supported on Pascal and older architectures.");
+  CUGRAPH_EXPECTS(static_cast<size_t>(local_int_vertex_last - local_int_vertex_first) ==
+                    labels_.size(),
+                  "Invalid input arguments: renumber_map_labels size does not match with "
+                  "[local_int_vertex_first, local_int_vertex_last).");
+  CUGRAPH_EXPECTS(!multi_gpu || (vertex_partition_lasts.size() ==
+                                 static_cast<size_t>(handle.get_comms().get_size())),
+                  "Invalid input arguments: vertex_partition_lasts size should coincide with the "
+                  "number of processes.");
+
+#ifdef CUCO_STATIC_MAP_DEFINED
+  if (do_expensive_check) {
+    rmm::device_uvector<vertex_t> labels(labels_.size(), handle.get_stream());
+    thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 labels_.begin(),
+                 labels_.end(),
+                 labels.begin());
+    thrust::sort(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()), labels.begin(), labels.end());
+    CUGRAPH_EXPECTS(thrust::unique(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                                   labels.begin(),
+                                   labels.end()) == labels.end(),
+                    "Invalid input arguments: renumber_map_labels have duplicate elements.");
+  }
+
+  ext_to_int_map_ptr_->map_ptr = detail::build_ext_to_int_vertex_map(
+    handle, labels_.data(), local_int_vertex_first, labels_.size());
+#endif
+}
+
+template <typename vertex_t, bool multi_gpu>
+renumber_map_t<vertex_t, multi_gpu>::renumber_map_t(renumber_map_t&&) noexcept = default;
+
+template <typename vertex_t, bool multi_gpu>
+renumber_map_t<vertex_t, multi_gpu>& renumber_map_t<vertex_t, multi_gpu>::operator=(
+  renumber_map_t&&) noexcept = default;
+
+template <typename vertex_t, bool multi_gpu>
+renumber_map_t<vertex_t, multi_gpu>::~renumber_map_t() = default;
+
+template <typename vertex_t, bool multi_gpu>
+void renumber_map_t<vertex_t, multi_gpu>::renumber_ext_vertices(raft::handle_t const& handle,
+                                                                vertex_t* vertices /* [INOUT] */,
+                                                                size_t num_vertices,
+                                                                bool do_expensive_check) const
+{
+#ifdef CUCO_STATIC_MAP_DEFINED
+  // 1. in multi-GPU, the (unique) external vertices are looked up in the hash maps of the GPUs
+  // owning them and the internal vertices are sent back; otherwise, the vertices are looked up
+  // directly
+
+  rmm::device_uvector<vertex_t> unique_ext_vertices(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> int_vertices_for_unique_ext_vertices(0, handle.get_stream());
+  if (multi_gpu) {
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+
+    unique_ext_vertices.resize(num_vertices, handle.get_stream());
+    unique_ext_vertices.resize(
+      thrust::distance(
+        unique_ext_vertices.begin(),
+        thrust::copy_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        vertices,
+                        vertices + num_vertices,
+                        unique_ext_vertices.begin(),
+                        [] __device__(auto v) { return v != invalid_vertex_id<vertex_t>::value; })),
+      handle.get_stream());
+    thrust::sort(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 unique_ext_vertices.begin(),
+                 unique_ext_vertices.end());
+    unique_ext_vertices.resize(
+      thrust::distance(
+        unique_ext_vertices.begin(),
+        thrust::unique(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                       unique_ext_vertices.begin(),
+                       unique_ext_vertices.end())),
+      handle.get_stream());
+
+    rmm::device_uvector<vertex_t> rx_ext_vertices(0, handle.get_stream());
+    std::vector<size_t> rx_counts{};
+    std::tie(rx_ext_vertices, rx_counts) = groupby_gpuid_and_shuffle_values(
+      comm,
+      unique_ext_vertices.begin(),
+      unique_ext_vertices.end(),
+      [key_func = detail::compute_gpu_id_from_vertex_t<vertex_t>{comm_size}] __device__(
+        auto val) { return key_func(val); },
+      handle.get_stream());  // unique_ext_vertices are grouped by the owning GPUs
+
+    if (do_expensive_check) {
+      rmm::device_uvector<bool> contains(rx_ext_vertices.size(), handle.get_stream());
+      // FIXME: a temporary workaround. cuco::static_map currently launches a kernel even if the
+      // grid size is 0; this leads to cudaErrorInvaildConfiguration.
+      if (rx_ext_vertices.size() > 0) {
+        ext_to_int_map_ptr_->map_ptr->contains(
+          rx_ext_vertices.begin(), rx_ext_vertices.end(), contains.begin());
+      }
+      CUGRAPH_EXPECTS(
+        host_scalar_allreduce(
+          comm,
+          static_cast<size_t>(
+            thrust::count(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                          contains.begin(),
+                          contains.end(),
+                          false)),
+          handle.get_stream()) == 0,
+        "Invalid input arguments: vertices have elements that are missing in (aggregate) "
+        "renumber_map_labels.");
+    }
+
+    // FIXME: a temporary workaround for https://github.com/NVIDIA/cuCollections/issues/74
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      rx_ext_vertices.begin(),
+                      rx_ext_vertices.end(),
+                      rx_ext_vertices.begin(),
+                      [view = ext_to_int_map_ptr_->map_ptr->get_device_view()] __device__(auto v) {
+                        return view.find(v)->second.load(cuda::std::memory_order_relaxed);
+                      });
+
+    std::tie(int_vertices_for_unique_ext_vertices, std::ignore) =
+      shuffle_values(comm, rx_ext_vertices.begin(), rx_counts, handle.get_stream());
+
+    thrust::sort_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        unique_ext_vertices.begin(),
+                        unique_ext_vertices.end(),
+                        int_vertices_for_unique_ext_vertices.begin());
+  } else if (do_expensive_check) {
+    rmm::device_uvector<bool> contains(num_vertices, handle.get_stream());
+    // FIXME: a temporary workaround. cuco::static_map currently launches a kernel even if the grid
+    // size is 0; this leads to cudaErrorInvaildConfiguration.
+    if (num_vertices > 0) {
+      ext_to_int_map_ptr_->map_ptr->contains(vertices, vertices + num_vertices, contains.begin());
+    }
+    auto vc_pair_first = thrust::make_zip_iterator(thrust::make_tuple(vertices, contains.begin()));
+    CUGRAPH_EXPECTS(thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                                     vc_pair_first,
+                                     vc_pair_first + num_vertices,
+                                     [] __device__(auto pair) {
+                                       return (thrust::get<0>(pair) !=
+                                               invalid_vertex_id<vertex_t>::value) &&
+                                              !thrust::get<1>(pair);
+                                     }) == 0,
+                    "Invalid input arguments: vertices have elements that are missing in "
+                    "renumber_map_labels.");
+  }
+
+  // 2. renumber
+
+  if (multi_gpu) {
+    thrust::transform(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      vertices,
+      vertices + num_vertices,
+      vertices,
+      [unique_first = unique_ext_vertices.begin(),
+       unique_last  = unique_ext_vertices.end(),
+       int_vertices = int_vertices_for_unique_ext_vertices.begin()] __device__(auto v) {
+        if (v == invalid_vertex_id<vertex_t>::value) { return v; }
+        auto it = thrust::lower_bound(thrust::seq, unique_first, unique_last, v);
+        return *(int_vertices + thrust::distance(unique_first, it));
+      });
+  } else {
+    // FIXME: a temporary workaround for https://github.com/NVIDIA/cuCollections/issues/74
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      vertices,
+                      vertices + num_vertices,
+                      vertices,
+                      [view = ext_to_int_map_ptr_->map_ptr->get_device_view()] __device__(auto v) {
+                        return v != invalid_vertex_id<vertex_t>::value
+                                 ? view.find(v)->second.load(cuda::std::memory_order_relaxed)
+                                 : invalid_vertex_id<vertex_t>::value;
+                      });
+  }
+#endif
+}
+
+template <typename vertex_t, bool multi_gpu>
+void renumber_map_t<vertex_t, multi_gpu>::unrenumber_local_int_vertices(
+  raft::handle_t const& handle,
+  vertex_t* vertices /* [INOUT] */,
+  size_t num_vertices,
+  bool do_expensive_check) const
+{
+  cugraph::experimental::unrenumber_local_int_vertices(handle,
+                                                       vertices,
+                                                       num_vertices,
+                                                       labels_.data(),
+                                                       local_int_vertex_first_,
+                                                       local_int_vertex_last_,
+                                                       do_expensive_check);
+}
+
+template <typename vertex_t, bool multi_gpu>
+void renumber_map_t<vertex_t, multi_gpu>::unrenumber_int_vertices(
+  raft::handle_t const& handle,
+  vertex_t* vertices /* [INOUT] */,
+  size_t num_vertices,
+  bool do_expensive_check) const
+{
+  auto vertex_partition_lasts = vertex_partition_lasts_;
+  cugraph::experimental::unrenumber_int_vertices<vertex_t, multi_gpu>(handle,
+                                                                      vertices,
+                                                                      num_vertices,
+                                                                      labels_.data(),
+                                                                      local_int_vertex_first_,
+                                                                      local_int_vertex_last_,
+                                                                      vertex_partition_lasts,
+                                                                      do_expensive_check);
+}
+
 // explicit instantiation
 
+template class renumber_map_t<int32_t, false>;
+template class renumber_map_t<int32_t, true>;
+template class renumber_map_t<int64_t, false>;
+template class renumber_map_t<int64_t, true>;
+
 template void renumber_ext_vertices<int32_t, false>(raft::handle_t const& handle,
                                                     int32_t* vertices,
                                                     size_t num_vertices,
@@ -405,6 +713,17 @@ template void renumber_ext_vertices<int32_t, true>(raft::handle_t const& handle,
                                                    int32_t local_int_vertex_last,
                                                    bool do_expensive_check);
 
+template void renumber_ext_vertices<int32_t, true>(raft::handle_t const& handle,
+                                                   int32_t* vertices,
+                                                   size_t num_vertices,
+                                                   int32_t const* renumber_map_labels,
+                                                   int32_t local_int_vertex_first,
+                                                   int32_t local_int_vertex_last,
+                                                   int32_t const* hub_vertices,
+                                                   int const* hub_gpu_ids,
+                                                   int32_t num_hubs,
+                                                   bool do_expensive_check);
+
 template void renumber_ext_vertices<int64_t, false>(raft::handle_t const& handle,
                                                     int64_t* vertices,
                                                     size_t num_vertices,
@@ -421,6 +740,17 @@ template void renumber_ext_vertices<int64_t, true>(raft::handle_t const& handle,
                                                    int64_t local_int_vertex_last,
                                                    bool do_expensive_check);
 
+template void renumber_ext_vertices<int64_t, true>(raft::handle_t const& handle,
+                                                   int64_t* vertices,
+                                                   size_t num_vertices,
+                                                   int64_t const* renumber_map_labels,
+                                                   int64_t local_int_vertex_first,
+                                                   int64_t local_int_vertex_last,
+                                                   int64_t const* hub_vertices,
+                                                   int const* hub_gpu_ids,
+                                                   int64_t num_hubs,
+                                                   bool do_expensive_check);
+
 template void unrenumber_local_int_vertices<int32_t>(raft::handle_t const& handle,
                                                      int32_t* vertices,
                                                      size_t num_vertices,
@@ -0,0 +1,457 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <experimental/detail/graph_utils.cuh>
+#include <experimental/graph.hpp>
+#include <experimental/graph_functions.hpp>
+#include <experimental/graph_view.hpp>
+#include <utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/extrema.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/reverse.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <memory>
+#include <tuple>
+#include <utility>
+
+namespace cugraph {
+namespace experimental {
+namespace detail {
+
+// Cuthill-McKee order (new vertex to old vertex map) of a level synchronous breadth-first traversal
+// from the highest degree vertex: the vertices of each level are ordered by the new IDs of their
+// first (in this order) parents and then by degree; vertices not reached by the traversal follow in
+// non-ascending degree order
+template <typename vertex_t, typename edge_t>
+rmm::device_uvector<vertex_t> compute_cuthill_mckee_order(raft::handle_t const& handle,
+                                                          edge_t const* offsets,
+                                                          vertex_t const* indices,
+                                                          vertex_t num_vertices)
+{
+  rmm::device_uvector<vertex_t> new_to_old(num_vertices, handle.get_stream());
+  if (num_vertices == 0) { return new_to_old; }
+
+  rmm::device_uvector<vertex_t> old_to_new(num_vertices, handle.get_stream());
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               old_to_new.begin(),
+               old_to_new.end(),
+               invalid_vertex_id<vertex_t>::value);
+
+  auto degree_first =
+    thrust::make_transform_iterator(thrust::make_counting_iterator(vertex_t{0}),
+                                    degree_from_offsets_t<vertex_t, edge_t>{offsets});
+  auto start = static_cast<vertex_t>(thrust::distance(
+    degree_first,
+    thrust::max_element(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        degree_first,
+                        degree_first + num_vertices)));
+  auto zero_vertex = vertex_t{0};
+  new_to_old.set_element_async(0, start, handle.get_stream());
+  old_to_new.set_element_async(start, zero_vertex, handle.get_stream());
+
+  vertex_t level_first{0};
+  vertex_t level_last{1};
+  rmm::device_uvector<edge_t> frontier_offsets(0, handle.get_stream());
+  while (level_last > level_first) {
+    auto frontier_size = level_last - level_first;
+    frontier_offsets.resize(frontier_size + 1, handle.get_stream());
+    frontier_offsets.set_element_to_zero_async(0, handle.get_stream());
+    thrust::transform_inclusive_scan(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      new_to_old.begin() + level_first,
+      new_to_old.begin() + level_last,
+      frontier_offsets.begin() + 1,
+      [offsets] __device__(auto v) { return offsets[v + 1] - offsets[v]; },
+      thrust::plus<edge_t>());
+    auto num_frontier_edges = frontier_offsets.back_element(handle.get_stream());
+
+    // (neighbor, parent's new ID) pairs of the unvisited neighbors
+
+    rmm::device_uvector<vertex_t> nbrs(num_frontier_edges, handle.get_stream());
+    rmm::device_uvector<vertex_t> parents(nbrs.size(), handle.get_stream());
+    auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(nbrs.begin(), parents.begin()));
+    thrust::transform(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(edge_t{0}),
+      thrust::make_counting_iterator(num_frontier_edges),
+      pair_first,
+      [offsets,
+       indices,
+       frontier         = new_to_old.data() + level_first,
+       frontier_offsets = frontier_offsets.data(),
+       frontier_size,
+       level_first] __device__(auto i) {
+        auto idx = static_cast<vertex_t>(thrust::distance(
+          frontier_offsets + 1,
+          thrust::upper_bound(
+            thrust::seq, frontier_offsets + 1, frontier_offsets + (frontier_size + 1), i)));
+        auto v = frontier[idx];
+        return thrust::make_tuple(indices[offsets[v] + (i - frontier_offsets[idx])],
+                                  level_first + idx);
+      });
+    auto pair_last = thrust::remove_if(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      pair_first,
+      pair_first + nbrs.size(),
+      [old_to_new = old_to_new.data()] __device__(auto pair) {
+        return old_to_new[thrust::get<0>(pair)] != invalid_vertex_id<vertex_t>::value;
+      });
+
+    // keep only the first parent of each neighbor, and order the neighbors by their parents' new
+    // IDs and then by (non-descending) degree
+
+    thrust::sort(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()), pair_first, pair_last);
+    pair_last = thrust::unique(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                               pair_first,
+                               pair_last,
+                               [] __device__(auto lhs, auto rhs) {
+                                 return thrust::get<0>(lhs) == thrust::get<0>(rhs);
+                               });
+    auto num_next_level_vertices = static_cast<vertex_t>(thrust::distance(pair_first, pair_last));
+    thrust::sort(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 pair_first,
+                 pair_last,
+                 [offsets] __device__(auto lhs, auto rhs) {
+                   auto lhs_v      = thrust::get<0>(lhs);
+                   auto rhs_v      = thrust::get<0>(rhs);
+                   auto lhs_degree = offsets[lhs_v + 1] - offsets[lhs_v];
+                   auto rhs_degree = offsets[rhs_v + 1] - offsets[rhs_v];
+                   if (thrust::get<1>(lhs) != thrust::get<1>(rhs)) {
+                     return thrust::get<1>(lhs) < thrust::get<1>(rhs);
+                   } else if (lhs_degree != rhs_degree) {
+                     return lhs_degree < rhs_degree;
+                   } else {
+                     return lhs_v < rhs_v;
+                   }
+                 });
+
+    thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 nbrs.begin(),
+                 nbrs.begin() + num_next_level_vertices,
+                 new_to_old.begin() + level_last);
+    thrust::scatter(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    thrust::make_counting_iterator(level_last),
+                    thrust::make_counting_iterator(level_last + num_next_level_vertices),
+                    nbrs.begin(),
+                    old_to_new.begin());
+
+    level_first = level_last;
+    level_last += num_next_level_vertices;
+  }
+
+  if (level_last < num_vertices) {
+    thrust::copy_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    thrust::make_counting_iterator(vertex_t{0}),
+                    thrust::make_counting_iterator(num_vertices),
+                    new_to_old.begin() + level_last,
+                    [old_to_new = old_to_new.data()] __device__(auto v) {
+                      return old_to_new[v] == invalid_vertex_id<vertex_t>::value;
+                    });
+    thrust::stable_sort(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        new_to_old.begin() + level_last,
+                        new_to_old.end(),
+                        [offsets] __device__(auto lhs, auto rhs) {
+                          return (offsets[lhs + 1] - offsets[lhs]) >
+                                 (offsets[rhs + 1] - offsets[rhs]);
+                        });
+  }
+
+  CUDA_TRY(cudaStreamSynchronize(
+    handle.get_stream()));  // zero_vertex should not go out of scope before the copy finishes
+
+  return new_to_old;
+}
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::enable_if_t<
+  !multi_gpu,
+  std::tuple<std::unique_ptr<graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>>,
+             rmm::device_uvector<vertex_t>>>
+reorder_graph(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> const& graph_view,
+  vertex_order_t order,
+  vertex_t const* clusters,
+  vertex_t const* renumber_map_labels,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS((order != vertex_order_t::cluster) || (clusters != nullptr),
+                  "Invalid input argument: clusters should not be nullptr if order is "
+                  "vertex_order_t::cluster.");
+
+  if (do_expensive_check) {
+    // currently, nothing to do
+  }
+
+  auto num_vertices = graph_view.get_number_of_vertices();
+  auto num_edges    = graph_view.get_number_of_edges();
+  auto offsets      = graph_view.offsets();
+  auto indices      = graph_view.indices();
+
+  // 1. compute the new order (new vertex to old vertex map)
+
+  rmm::device_uvector<vertex_t> new_to_old(0, handle.get_stream());
+  if (order == vertex_order_t::reverse_cuthill_mckee) {
+    new_to_old = compute_cuthill_mckee_order(handle, offsets, indices, num_vertices);
+    thrust::reverse(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    new_to_old.begin(),
+                    new_to_old.end());
+  } else {
+    new_to_old.resize(num_vertices, handle.get_stream());
+    thrust::sequence(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     new_to_old.begin(),
+                     new_to_old.end(),
+                     vertex_t{0});
+    thrust::stable_sort(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        new_to_old.begin(),
+                        new_to_old.end(),
+                        [offsets] __device__(auto lhs, auto rhs) {
+                          return (offsets[lhs + 1] - offsets[lhs]) >
+                                 (offsets[rhs + 1] - offsets[rhs]);
+                        });
+    if (order == vertex_order_t::cluster) {
+      thrust::stable_sort(
+        rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+        new_to_old.begin(),
+        new_to_old.end(),
+        [clusters] __device__(auto lhs, auto rhs) { return clusters[lhs] < clusters[rhs]; });
+    }
+  }
+
+  // 2. relabel the edges
+
+  rmm::device_uvector<vertex_t> old_to_new(num_vertices, handle.get_stream());
+  thrust::scatter(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                  thrust::make_counting_iterator(vertex_t{0}),
+                  thrust::make_counting_iterator(num_vertices),
+                  new_to_old.begin(),
+                  old_to_new.begin());
+
+  rmm::device_uvector<vertex_t> edgelist_major_vertices(num_edges, handle.get_stream());
+  rmm::device_uvector<vertex_t> edgelist_minor_vertices(num_edges, handle.get_stream());
+  rmm::device_uvector<weight_t> edgelist_weights(graph_view.is_weighted() ? num_edges : edge_t{0},
+                                                 handle.get_stream());
+  thrust::upper_bound(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      offsets + 1,
+                      offsets + (num_vertices + 1),
+                      thrust::make_counting_iterator(edge_t{0}),
+                      thrust::make_counting_iterator(num_edges),
+                      edgelist_major_vertices.begin());
+  thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    edgelist_major_vertices.begin(),
+                    edgelist_major_vertices.end(),
+                    edgelist_major_vertices.begin(),
+                    [old_to_new = old_to_new.data()] __device__(auto v) { return old_to_new[v]; });
+  thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    indices,
+                    indices + num_edges,
+                    edgelist_minor_vertices.begin(),
+                    [old_to_new = old_to_new.data()] __device__(auto v) { return old_to_new[v]; });
+  if (graph_view.is_weighted()) {
+    thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 graph_view.weights(),
+                 graph_view.weights() + num_edges,
+                 edgelist_weights.begin());
+  }
+
+  edgelist_t<vertex_t, edge_t, weight_t> edgelist{};
+  edgelist.p_src_vertices =
+    store_transposed ? edgelist_minor_vertices.data() : edgelist_major_vertices.data();
+  edgelist.p_dst_vertices =
+    store_transposed ? edgelist_major_vertices.data() : edgelist_minor_vertices.data();
+  edgelist.p_edge_weights  = graph_view.is_weighted() ? edgelist_weights.data() : nullptr;
+  edgelist.number_of_edges = num_edges;
+
+  auto reordered_graph =
+    std::make_unique<graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>>(
+      handle,
+      edgelist,
+      num_vertices,
+      graph_view.get_graph_properties(),
+      order == vertex_order_t::degree,
+      do_expensive_check);
+
+  // 3. compose with the renumber map
+
+  if (renumber_map_labels != nullptr) {
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      new_to_old.begin(),
+                      new_to_old.end(),
+                      new_to_old.begin(),
+                      [renumber_map_labels] __device__(auto v) { return renumber_map_labels[v]; });
+  }
+
+  return std::make_tuple(std::move(reordered_graph), std::move(new_to_old));
+}
+
+}  // namespace detail
+
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool store_transposed,
+          bool multi_gpu>
+std::enable_if_t<
+  !multi_gpu,
+  std::tuple<std::unique_ptr<graph_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>>,
+             rmm::device_uvector<vertex_t>>>
+reorder_graph(
+  raft::handle_t const& handle,
+  graph_view_t<vertex_t, edge_t, weight_t, store_transposed, multi_gpu> const& graph_view,
+  vertex_order_t order,
+  vertex_t const* clusters,
+  vertex_t const* renumber_map_labels,
+  bool do_expensive_check)
+{
+  return detail::reorder_graph(
+    handle, graph_view, order, clusters, renumber_map_labels, do_expensive_check);
+}
+
+// explicit instantiation
+
+template std::tuple<std::unique_ptr<graph_t<int32_t, int32_t, float, true, false>>,
+                    rmm::device_uvector<int32_t>>
+reorder_graph(raft::handle_t const& handle,
+              graph_view_t<int32_t, int32_t, float, true, false> const& graph_view,
+              vertex_order_t order,
+              int32_t const* clusters,
+              int32_t const* renumber_map_labels,
+              bool do_expensive_check);
+
+template std::tuple<std::unique_ptr<graph_t<int32_t, int32_t, float, false, false>>,
+                    rmm::device_uvector<int32_t>>
+reorder_graph(raft::handle_t const& handle,
+              graph_view_t<int32_t, int32_t, float, false, false> const& graph_view,
+              vertex_order_t order,
+              int32_t const* clusters,
+              int32_t const* renumber_map_labels,
+              bool do_expensive_check);
+
+template std::tuple<std::unique_ptr<graph_t<int32_t, int32_t, double, true, false>>,
+                    rmm::device_uvector<int32_t>>
+reorder_graph(raft::handle_t const& handle,
+              graph_view_t<int32_t, int32_t, double, true, false> const& graph_view,
+              vertex_order_t order,
+              int32_t const* clusters,
+              int32_t const* renumber_map_labels,
+              bool do_expensive_check);
+
+template std::tuple<std::unique_ptr<graph_t<int32_t, int32_t, double, false, false>>,
+                    rmm::device_uvector<int32_t>>
+reorder_graph(raft::handle_t const& handle,
+              graph_view_t<int32_t, int32_t, double, false, false> const& graph_view,
+              vertex_order_t order,
+              int32_t const* clusters,
+              int32_t const* renumber_map_labels,
+              bool do_expensive_check);
+
+template std::tuple<std::unique_ptr<graph_t<int32_t, int64_t, float, true, false>>,
+                    rmm::device_uvector<int32_t>>
+reorder_graph(raft::handle_t const& handle,
+              graph_view_t<int32_t, int64_t, float, true, false> const& graph_view,
+              vertex_order_t order,
+              int32_t const* clusters,
+              int32_t const* renumber_map_labels,
+              bool do_expensive_check);
+
+template std::tuple<std::unique_ptr<graph_t<int32_t, int64_t, float, false, false>>,
+                    rmm::device_uvector<int32_t>>
+reorder_graph(raft::handle_t const& handle,
+              graph_view_t<int32_t, int64_t, float, false, false> const& graph_view,
+              vertex_order_t order,
+              int32_t const* clusters,
+              int32_t const* renumber_map_labels,
+              bool do_expensive_check);
+
+template std::tuple<std::unique_ptr<graph_t<int32_t, int64_t, double, true, false>>,
+                    rmm::device_uvector<int32_t>>
+reorder_graph(raft::handle_t const& handle,
+              graph_view_t<int32_t, int64_t, double, true, false> const& graph_view,
+              vertex_order_t order,
+              int32_t const* clusters,
+              int32_t const* renumber_map_labels,
+              bool do_expensive_check);
+
+template std::tuple<std::unique_ptr<graph_t<int32_t, int64_t, double, false, false>>,
+                    rmm::device_uvector<int32_t>>
+reorder_graph(raft::handle_t const& handle,
+              graph_view_t<int32_t, int64_t, double, false, false> const& graph_view,
+              vertex_order_t order,
+              int32_t const* clusters,
+              int32_t const* renumber_map_labels,
+              bool do_expensive_check);
+
+template std::tuple<std::unique_ptr<graph_t<int64_t, int64_t, float, true, false>>,
+                    rmm::device_uvector<int64_t>>
+reorder_graph(raft::handle_t const& handle,
+              graph_view_t<int64_t, int64_t, float, true, false> const& graph_view,
+              vertex_order_t order,
+              int64_t const* clusters,
+              int64_t const* renumber_map_labels,
+              bool do_expensive_check);
+
+template std::tuple<std::unique_ptr<graph_t<int64_t, int64_t, float, false, false>>,
+                    rmm::device_uvector<int64_t>>
+reorder_graph(raft::handle_t const& handle,
+              graph_view_t<int64_t, int64_t, float, false, false> const& graph_view,
+              vertex_order_t order,
+              int64_t const* clusters,
+              int64_t const* renumber_map_labels,
+              bool do_expensive_check);
+
+template std::tuple<std::unique_ptr<graph_t<int64_t, int64_t, double, true, false>>,
+                    rmm::device_uvector<int64_t>>
+reorder_graph(raft::handle_t const& handle,
+              graph_view_t<int64_t, int64_t, double, true, false> const& graph_view,
+              vertex_order_t order,
+              int64_t const* clusters,
+              int64_t const* renumber_map_labels,
+              bool do_expensive_check);
+
+template std::tuple<std::unique_ptr<graph_t<int64_t, int64_t, double, false, false>>,
+                    rmm::device_uvector<int64_t>>
+reorder_graph(raft::handle_t const& handle,
+              graph_view_t<int64_t, int64_t, double, false, false> const& graph_view,
+              vertex_order_t order,
+              int64_t const* clusters,
+              int64_t const* renumber_map_labels,
+              bool do_expensive_check);
+
+}  // namespace experimental
+}  // namespace cugraph
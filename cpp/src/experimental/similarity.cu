@@ -0,0 +1,392 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithms.hpp>
+#include <experimental/graph_view.hpp>
+#include <utilities/error.hpp>
+#include <utilities/shuffle_comm.cuh>
+#include "neighbor_intersection.cuh"
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+namespace detail {
+
+enum class similarity_coefficient_t { jaccard, overlap, sorensen };
+
+template <similarity_coefficient_t coefficient,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t>
+struct compute_coefficient_t {
+  neighbor_lists_t<vertex_t, edge_t> first_lists{};
+  neighbor_lists_t<vertex_t, edge_t> second_lists{};
+  edge_t const *intersection_sizes{nullptr};
+
+  __device__ weight_t operator()(size_t pair_id) const
+  {
+    auto intersection = static_cast<weight_t>(intersection_sizes[pair_id]);
+    auto first_size   = static_cast<weight_t>(first_lists.degree(pair_id));
+    auto second_size  = static_cast<weight_t>(second_lists.degree(pair_id));
+
+    weight_t denominator{};
+    switch (coefficient) {
+      case similarity_coefficient_t::jaccard:
+        denominator = first_size + second_size - intersection;
+        break;
+      case similarity_coefficient_t::overlap: denominator = min(first_size, second_size); break;
+      case similarity_coefficient_t::sorensen:
+        intersection *= weight_t{2.0};
+        denominator = first_size + second_size;
+        break;
+    }
+    return denominator > weight_t{0.0} ? intersection / denominator : weight_t{0.0};
+  }
+};
+
+template <similarity_coefficient_t coefficient,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t>
+void compute_coefficients(raft::handle_t const &handle,
+                          neighbor_lists_t<vertex_t, edge_t> first_lists,
+                          neighbor_lists_t<vertex_t, edge_t> second_lists,
+                          size_t num_pairs,
+                          weight_t *coefficients)
+{
+  auto stream = handle.get_stream();
+
+  rmm::device_uvector<edge_t> intersection_sizes_v(num_pairs, stream);
+  compute_intersection_sizes(
+    handle, first_lists, second_lists, num_pairs, intersection_sizes_v.data());
+
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator(size_t{0}),
+                    thrust::make_counting_iterator(num_pairs),
+                    coefficients,
+                    compute_coefficient_t<coefficient, vertex_t, edge_t, weight_t>{
+                      first_lists, second_lists, intersection_sizes_v.data()});
+}
+
+template <similarity_coefficient_t coefficient,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool multi_gpu>
+std::enable_if_t<!multi_gpu, void> similarity(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t const *first,
+  vertex_t const *second,
+  size_t num_pairs,
+  weight_t *coefficients)
+{
+  auto stream = handle.get_stream();
+
+  // the intersection kernels require sorted (and duplicate free for set semantics) neighbor lists,
+  // build a sorted copy if necessary
+  rmm::device_uvector<edge_t> offsets_v(0, stream);
+  rmm::device_uvector<vertex_t> indices_v(0, stream);
+  auto offsets = graph_view.offsets();
+  auto indices = graph_view.indices();
+  if (!graph_view.has_sorted_neighbor_lists() || graph_view.is_multigraph()) {
+    rmm::device_uvector<vertex_t> rows_v(0, stream);
+    rmm::device_uvector<vertex_t> cols_v(0, stream);
+    std::tie(rows_v, cols_v) = decompress_local_edges(handle, graph_view);
+    std::tie(offsets_v, indices_v) =
+      compress_edgelist<edge_t>(handle,
+                                std::move(rows_v),
+                                std::move(cols_v),
+                                vertex_t{0},
+                                graph_view.get_number_of_vertices(),
+                                graph_view.is_multigraph());
+    offsets = offsets_v.data();
+    indices = indices_v.data();
+  }
+
+  compute_coefficients<coefficient>(handle,
+                                    neighbor_lists_t<vertex_t, edge_t>{offsets, indices, first},
+                                    neighbor_lists_t<vertex_t, edge_t>{offsets, indices, second},
+                                    num_pairs,
+                                    coefficients);
+}
+
+// 1. The local edges are shuffled to the GPUs owning the edge sources (to build the complete
+// neighbor lists of the local vertices).
+// 2. The pairs are shuffled to the GPUs owning the first vertices of the pairs.
+// 3. The neighbor lists of the second vertices of the pairs are fetched from the GPUs owning the
+// second vertices.
+// 4. The coefficients are shuffled back.
+template <similarity_coefficient_t coefficient,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool multi_gpu>
+std::enable_if_t<multi_gpu, void> similarity(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t const *first,
+  vertex_t const *second,
+  size_t num_pairs,
+  weight_t *coefficients)
+{
+  auto &comm  = handle.get_comms();
+  auto stream = handle.get_stream();
+
+  auto const local_first = graph_view.get_local_vertex_first();
+
+  auto d_vertex_partition_lasts = vertex_partition_lasts(handle, graph_view);
+  vertex_to_gpu_id_t<vertex_t> vertex_to_gpu_id{d_vertex_partition_lasts.data(), comm.get_size()};
+
+  // 1. complete (sorted) neighbor lists of the local vertices
+
+  rmm::device_uvector<edge_t> local_offsets_v(0, stream);
+  rmm::device_uvector<vertex_t> local_indices_v(0, stream);
+  {
+    rmm::device_uvector<vertex_t> rows_v(0, stream);
+    rmm::device_uvector<vertex_t> cols_v(0, stream);
+    std::tie(rows_v, cols_v) = decompress_local_edges(handle, graph_view);
+    std::tie(rows_v, cols_v) =
+      shuffle_edges_to_row_owners(handle, vertex_to_gpu_id, std::move(rows_v), std::move(cols_v));
+    std::tie(local_offsets_v, local_indices_v) =
+      compress_edgelist<edge_t>(handle,
+                                std::move(rows_v),
+                                std::move(cols_v),
+                                local_first,
+                                graph_view.get_number_of_local_vertices(),
+                                graph_view.is_multigraph());
+  }
+
+  // 2. shuffle the pairs to the GPUs owning the first vertices
+
+  rmm::device_uvector<vertex_t> rx_firsts_v(num_pairs, stream);
+  rmm::device_uvector<vertex_t> rx_seconds_v(num_pairs, stream);
+  rmm::device_uvector<size_t> rx_pair_ids_v(num_pairs, stream);
+  thrust::copy(rmm::exec_policy(stream)->on(stream), first, first + num_pairs, rx_firsts_v.begin());
+  thrust::copy(
+    rmm::exec_policy(stream)->on(stream), second, second + num_pairs, rx_seconds_v.begin());
+  thrust::sequence(
+    rmm::exec_policy(stream)->on(stream), rx_pair_ids_v.begin(), rx_pair_ids_v.end(), size_t{0});
+
+  std::vector<size_t> pair_rx_counts{};
+  {
+    auto pair_first = thrust::make_zip_iterator(
+      thrust::make_tuple(rx_firsts_v.begin(), rx_seconds_v.begin(), rx_pair_ids_v.begin()));
+    std::forward_as_tuple(std::tie(rx_firsts_v, rx_seconds_v, rx_pair_ids_v), pair_rx_counts) =
+      groupby_gpuid_and_shuffle_values(
+        comm,
+        pair_first,
+        pair_first + num_pairs,
+        first_element_to_gpu_id_t<vertex_t, thrust::tuple<vertex_t, vertex_t, size_t>>{
+          vertex_to_gpu_id},
+        stream);
+  }
+  auto num_rx_pairs = rx_firsts_v.size();
+
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    rx_firsts_v.begin(),
+                    rx_firsts_v.end(),
+                    rx_firsts_v.begin(),
+                    [local_first] __device__(auto v) { return v - local_first; });
+
+  // 3. fetch the neighbor lists of the second vertices
+
+  rmm::device_uvector<edge_t> remote_offsets_v(0, stream);
+  rmm::device_uvector<vertex_t> remote_indices_v(0, stream);
+  std::tie(remote_offsets_v, remote_indices_v) = gather_neighbor_lists(handle,
+                                                                       vertex_to_gpu_id,
+                                                                       local_first,
+                                                                       local_offsets_v,
+                                                                       local_indices_v,
+                                                                       rx_seconds_v.data(),
+                                                                       rx_seconds_v.size());
+
+  rmm::device_uvector<weight_t> rx_coefficients_v(num_rx_pairs, stream);
+  compute_coefficients<coefficient>(
+    handle,
+    neighbor_lists_t<vertex_t, edge_t>{
+      local_offsets_v.data(), local_indices_v.data(), rx_firsts_v.data()},
+    neighbor_lists_t<vertex_t, edge_t>{
+      remote_offsets_v.data(), remote_indices_v.data(), rx_seconds_v.data()},
+    num_rx_pairs,
+    rx_coefficients_v.data());
+
+  // 4. shuffle back the coefficients
+
+  rmm::device_uvector<size_t> pair_ids_v(0, stream);
+  rmm::device_uvector<weight_t> pair_coefficients_v(0, stream);
+  {
+    auto tx_first = thrust::make_zip_iterator(
+      thrust::make_tuple(rx_pair_ids_v.begin(), rx_coefficients_v.begin()));
+    std::forward_as_tuple(std::tie(pair_ids_v, pair_coefficients_v), std::ignore) =
+      shuffle_values(comm, tx_first, pair_rx_counts, stream);
+  }
+  thrust::scatter(rmm::exec_policy(stream)->on(stream),
+                  pair_coefficients_v.begin(),
+                  pair_coefficients_v.end(),
+                  pair_ids_v.begin(),
+                  coefficients);
+}
+
+template <similarity_coefficient_t coefficient,
+          typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          bool multi_gpu>
+void similarity(raft::handle_t const &handle,
+                graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+                weight_t *coefficients)
+{
+  rmm::device_uvector<vertex_t> rows_v(0, handle.get_stream());
+  rmm::device_uvector<vertex_t> cols_v(0, handle.get_stream());
+  std::tie(rows_v, cols_v) = decompress_local_edges(handle, graph_view);
+
+  similarity<coefficient>(
+    handle, graph_view, rows_v.data(), cols_v.data(), rows_v.size(), coefficients);
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void jaccard_coefficients(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t const *first,
+  vertex_t const *second,
+  size_t num_pairs,
+  weight_t *coefficients)
+{
+  CUGRAPH_EXPECTS((num_pairs == 0) || ((first != nullptr) && (second != nullptr)),
+                  "Invalid input argument: first and second should not be nullptr.");
+  CUGRAPH_EXPECTS((num_pairs == 0) || (coefficients != nullptr),
+                  "Invalid input argument: coefficients should not be nullptr.");
+
+  detail::similarity<detail::similarity_coefficient_t::jaccard>(
+    handle, graph_view, first, second, num_pairs, coefficients);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void overlap_coefficients(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t const *first,
+  vertex_t const *second,
+  size_t num_pairs,
+  weight_t *coefficients)
+{
+  CUGRAPH_EXPECTS((num_pairs == 0) || ((first != nullptr) && (second != nullptr)),
+                  "Invalid input argument: first and second should not be nullptr.");
+  CUGRAPH_EXPECTS((num_pairs == 0) || (coefficients != nullptr),
+                  "Invalid input argument: coefficients should not be nullptr.");
+
+  detail::similarity<detail::similarity_coefficient_t::overlap>(
+    handle, graph_view, first, second, num_pairs, coefficients);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void sorensen_coefficients(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t const *first,
+  vertex_t const *second,
+  size_t num_pairs,
+  weight_t *coefficients)
+{
+  CUGRAPH_EXPECTS((num_pairs == 0) || ((first != nullptr) && (second != nullptr)),
+                  "Invalid input argument: first and second should not be nullptr.");
+  CUGRAPH_EXPECTS((num_pairs == 0) || (coefficients != nullptr),
+                  "Invalid input argument: coefficients should not be nullptr.");
+
+  detail::similarity<detail::similarity_coefficient_t::sorensen>(
+    handle, graph_view, first, second, num_pairs, coefficients);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void jaccard_coefficients(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  weight_t *coefficients)
+{
+  detail::similarity<detail::similarity_coefficient_t::jaccard>(handle, graph_view, coefficients);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void overlap_coefficients(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  weight_t *coefficients)
+{
+  detail::similarity<detail::similarity_coefficient_t::overlap>(handle, graph_view, coefficients);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void sorensen_coefficients(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  weight_t *coefficients)
+{
+  detail::similarity<detail::similarity_coefficient_t::sorensen>(handle, graph_view, coefficients);
+}
+
+// explicit instantiation
+
+#define INSTANTIATE_SIMILARITY(name, vertex_t, edge_t, weight_t, multi_gpu)                    \
+  template void name(raft::handle_t const &handle,                                            \
+                     graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &,      \
+                     vertex_t const *,                                                        \
+                     vertex_t const *,                                                        \
+                     size_t,                                                                  \
+                     weight_t *);                                                             \
+  template void name(raft::handle_t const &handle,                                            \
+                     graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &,      \
+                     weight_t *);
+
+#define INSTANTIATE_SIMILARITIES(vertex_t, edge_t, weight_t, multi_gpu)       \
+  INSTANTIATE_SIMILARITY(jaccard_coefficients, vertex_t, edge_t, weight_t, multi_gpu) \
+  INSTANTIATE_SIMILARITY(overlap_coefficients, vertex_t, edge_t, weight_t, multi_gpu) \
+  INSTANTIATE_SIMILARITY(sorensen_coefficients, vertex_t, edge_t, weight_t, multi_gpu)
+
+INSTANTIATE_SIMILARITIES(int32_t, int32_t, float, false)
+INSTANTIATE_SIMILARITIES(int32_t, int32_t, double, false)
+INSTANTIATE_SIMILARITIES(int32_t, int64_t, float, false)
+INSTANTIATE_SIMILARITIES(int32_t, int64_t, double, false)
+INSTANTIATE_SIMILARITIES(int64_t, int64_t, float, false)
+INSTANTIATE_SIMILARITIES(int64_t, int64_t, double, false)
+INSTANTIATE_SIMILARITIES(int32_t, int32_t, float, true)
+INSTANTIATE_SIMILARITIES(int32_t, int32_t, double, true)
+INSTANTIATE_SIMILARITIES(int32_t, int64_t, float, true)
+INSTANTIATE_SIMILARITIES(int32_t, int64_t, double, true)
+INSTANTIATE_SIMILARITIES(int64_t, int64_t, float, true)
+INSTANTIATE_SIMILARITIES(int64_t, int64_t, double, true)
+
+}  // namespace experimental
+}  // namespace cugraph
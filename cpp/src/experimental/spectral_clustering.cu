@@ -0,0 +1,1176 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "column_sums.cuh"
+
+#include <algorithms.hpp>
+#include <experimental/graph_view.hpp>
+#include <patterns/copy_to_adj_matrix_row_col.cuh>
+#include <patterns/copy_v_transform_reduce_in_out_nbr.cuh>
+#include <utilities/device_comm.cuh>
+#include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/extrema.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+namespace detail {
+
+// the number of extra (not returned) vectors in the eigensolver block, extra vectors speed up the
+// convergence of the wanted eigenpairs
+size_t constexpr spectral_min_block_oversampling = 8;
+
+// Cyclic Jacobi eigen decomposition of a (small, dense, row-major) symmetric matrix on host.
+// Eigenvalues are returned in the descending order and the matching eigenvectors are stored in the
+// columns of eigenvectors (row-major).
+inline void symmetric_eigen_decomposition(std::vector<double> a,
+                                          size_t n,
+                                          std::vector<double> &eigenvalues,
+                                          std::vector<double> &eigenvectors)
+{
+  std::vector<double> v(n * n, 0.0);
+  for (size_t i = 0; i < n; ++i) { v[i * n + i] = 1.0; }
+
+  size_t constexpr max_sweeps = 100;
+  for (size_t sweep = 0; sweep < max_sweeps; ++sweep) {
+    double off{0.0};
+    double diag{0.0};
+    for (size_t i = 0; i < n; ++i) {
+      diag += a[i * n + i] * a[i * n + i];
+      for (size_t j = i + 1; j < n; ++j) { off += a[i * n + j] * a[i * n + j]; }
+    }
+    if (off <= std::numeric_limits<double>::epsilon() * std::numeric_limits<double>::epsilon() *
+                 std::max(diag, std::numeric_limits<double>::min())) {
+      break;
+    }
+    for (size_t p = 0; p < n; ++p) {
+      for (size_t q = p + 1; q < n; ++q) {
+        if (a[p * n + q] == 0.0) { continue; }
+        auto theta = (a[q * n + q] - a[p * n + p]) / (2.0 * a[p * n + q]);
+        auto t =
+          (theta >= 0.0 ? 1.0 : -1.0) / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+        auto c     = 1.0 / std::sqrt(t * t + 1.0);
+        auto s     = t * c;
+        for (size_t k = 0; k < n; ++k) {
+          auto akp     = a[k * n + p];
+          auto akq     = a[k * n + q];
+          a[k * n + p] = c * akp - s * akq;
+          a[k * n + q] = s * akp + c * akq;
+        }
+        for (size_t k = 0; k < n; ++k) {
+          auto apk     = a[p * n + k];
+          auto aqk     = a[q * n + k];
+          a[p * n + k] = c * apk - s * aqk;
+          a[q * n + k] = s * apk + c * aqk;
+        }
+        for (size_t k = 0; k < n; ++k) {
+          auto vkp     = v[k * n + p];
+          auto vkq     = v[k * n + q];
+          v[k * n + p] = c * vkp - s * vkq;
+          v[k * n + q] = s * vkp + c * vkq;
+        }
+      }
+    }
+  }
+
+  std::vector<size_t> order(n);
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::sort(order.begin(), order.end(), [&a, n](auto lhs, auto rhs) {
+    return a[lhs * n + lhs] > a[rhs * n + rhs];
+  });
+
+  eigenvalues.resize(n);
+  eigenvectors.resize(n * n);
+  for (size_t j = 0; j < n; ++j) {
+    eigenvalues[j] = a[order[j] * n + order[j]];
+    for (size_t i = 0; i < n; ++i) { eigenvectors[i * n + j] = v[i * n + order[j]]; }
+  }
+}
+
+// maps an index in the column-major order of a (num_rows x (lhs_num_columns * rhs_num_columns))
+// matrix to the products of the lhs & rhs row-major block entries, so compute_column_sums
+// computes the (row-major, lhs_num_columns x rhs_num_columns) matrix lhs^T * rhs
+template <typename vertex_t, typename weight_t>
+struct block_inner_product_t {
+  weight_t const *lhs{nullptr};
+  weight_t const *rhs{nullptr};
+  vertex_t num_rows{};
+  size_t lhs_num_columns{};
+  size_t rhs_num_columns{};
+
+  __device__ double operator()(size_t i) const
+  {
+    auto row = i % static_cast<size_t>(num_rows);
+    auto col = i / static_cast<size_t>(num_rows);
+    return static_cast<double>(lhs[row * lhs_num_columns + col / rhs_num_columns]) *
+           static_cast<double>(rhs[row * rhs_num_columns + col % rhs_num_columns]);
+  }
+};
+
+template <typename vertex_t, typename weight_t>
+struct squared_residual_t {
+  weight_t const *vectors{nullptr};
+  weight_t const *products{nullptr};
+  double const *eigenvalues{nullptr};
+  vertex_t num_rows{};
+  size_t num_columns{};
+
+  __device__ double operator()(size_t i) const
+  {
+    auto row    = i % static_cast<size_t>(num_rows);
+    auto col    = i / static_cast<size_t>(num_rows);
+    auto offset = row * num_columns + col;
+    auto diff   = static_cast<double>(products[offset]) -
+                eigenvalues[col] * static_cast<double>(vectors[offset]);
+    return diff * diff;
+  }
+};
+
+template <typename vertex_t, typename weight_t>
+struct column_major_block_value_t {
+  weight_t const *block{nullptr};
+  vertex_t num_rows{};
+  size_t num_columns{};
+
+  __device__ double operator()(size_t i) const
+  {
+    auto row = i % static_cast<size_t>(num_rows);
+    auto col = i / static_cast<size_t>(num_rows);
+    return static_cast<double>(block[row * num_columns + col]);
+  }
+};
+
+// lhs^T * rhs for (local) row-major blocks, aggregated over the GPUs in multi-GPU
+template <bool multi_gpu, typename vertex_t, typename weight_t>
+std::vector<double> compute_block_inner_products(raft::handle_t const &handle,
+                                                 weight_t const *lhs,
+                                                 weight_t const *rhs,
+                                                 vertex_t num_rows,
+                                                 size_t lhs_num_columns,
+                                                 size_t rhs_num_columns)
+{
+  auto d_products = compute_column_sums<multi_gpu, vertex_t, double>(
+    handle,
+    num_rows,
+    lhs_num_columns * rhs_num_columns,
+    block_inner_product_t<vertex_t, weight_t>{
+      lhs, rhs, num_rows, lhs_num_columns, rhs_num_columns});
+  std::vector<double> h_products(d_products.size());
+  raft::update_host(h_products.data(), d_products.data(), d_products.size(), handle.get_stream());
+  CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+  return h_products;
+}
+
+// block * matrix for a (local, num_rows x num_columns) row-major block and a (host, num_columns x
+// num_output_columns) row-major matrix
+template <typename vertex_t, typename weight_t>
+rmm::device_uvector<weight_t> multiply_block(raft::handle_t const &handle,
+                                             weight_t const *block,
+                                             vertex_t num_rows,
+                                             size_t num_columns,
+                                             std::vector<double> const &matrix,
+                                             size_t num_output_columns)
+{
+  rmm::device_uvector<double> d_matrix(matrix.size(), handle.get_stream());
+  raft::update_device(d_matrix.data(), matrix.data(), matrix.size(), handle.get_stream());
+
+  rmm::device_uvector<weight_t> ret(static_cast<size_t>(num_rows) * num_output_columns,
+                                    handle.get_stream());
+  thrust::transform(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(ret.size()),
+    ret.begin(),
+    [block, matrix = d_matrix.data(), num_columns, num_output_columns] __device__(auto i) {
+      auto row = i / num_output_columns;
+      auto col = i % num_output_columns;
+      double sum{0.0};
+      for (size_t k = 0; k < num_columns; ++k) {
+        sum += static_cast<double>(block[row * num_columns + k]) *
+               matrix[k * num_output_columns + col];
+      }
+      return static_cast<weight_t>(sum);
+    });
+
+  return ret;
+}
+
+// orthonormalize the columns of a (local) row-major block; the block is multiplied by V * L^-1/2
+// (where the Gram matrix is V * L * V^T) twice, the second pass removes the loss of orthogonality
+// from the first pass
+template <bool multi_gpu, typename vertex_t, typename weight_t>
+void orthonormalize_block(raft::handle_t const &handle,
+                          rmm::device_uvector<weight_t> &block,
+                          vertex_t num_rows,
+                          size_t num_columns)
+{
+  for (size_t pass = 0; pass < 2; ++pass) {
+    auto gram = compute_block_inner_products<multi_gpu>(
+      handle, block.data(), block.data(), num_rows, num_columns, num_columns);
+    std::vector<double> eigenvalues{};
+    std::vector<double> eigenvectors{};
+    symmetric_eigen_decomposition(gram, num_columns, eigenvalues, eigenvectors);
+    auto threshold = std::max(eigenvalues[0], std::numeric_limits<double>::min()) *
+                     std::numeric_limits<double>::epsilon();
+    for (size_t i = 0; i < num_columns; ++i) {
+      for (size_t j = 0; j < num_columns; ++j) {
+        eigenvectors[i * num_columns + j] /= std::sqrt(std::max(eigenvalues[j], threshold));
+      }
+    }
+    block = multiply_block(handle, block.data(), num_rows, num_columns, eigenvectors, num_columns);
+  }
+}
+
+// Apply the shifted, positive semi-definite operator whose largest eigenvectors are the wanted
+// eigenvectors: shift * I - L (L = D - A) for balanced cut and shift * I + B (B = A - d * d^T /
+// (2 * m)) for modularity maximization. A multiplies every column in a single pass over the edges.
+template <typename GraphViewType>
+rmm::device_uvector<typename GraphViewType::weight_type> apply_spectral_operator(
+  raft::handle_t const &handle,
+  GraphViewType const &graph_view,
+  spectral_objective_t objective,
+  rmm::device_uvector<typename GraphViewType::weight_type> const &block,
+  size_t num_columns,
+  rmm::device_uvector<typename GraphViewType::weight_type> const &degrees,
+  double shift,
+  double total_weight)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto const num_local_vertices = graph_view.get_number_of_local_vertices();
+
+  rmm::device_uvector<weight_t> adj_matrix_row_values(
+    static_cast<size_t>(graph_view.get_number_of_local_adj_matrix_partition_rows()) * num_columns,
+    handle.get_stream());
+  copy_to_adj_matrix_row(
+    handle, graph_view, num_columns, block.data(), adj_matrix_row_values.begin());
+
+  rmm::device_uvector<weight_t> ret(block.size(), handle.get_stream());
+  copy_v_transform_reduce_in_nbr(
+    handle,
+    graph_view,
+    num_columns,
+    adj_matrix_row_values.begin(),
+    thrust::make_constant_iterator(0) /* dummy */,
+    [] __device__(vertex_t src, vertex_t dst, weight_t w, auto src_val, auto dst_val) {
+      return static_cast<weight_t>(src_val * w);
+    },
+    weight_t{0.0},
+    ret.data());
+
+  rmm::device_uvector<double> degree_products(objective == spectral_objective_t::modularity
+                                                ? num_columns
+                                                : size_t{0},
+                                              handle.get_stream());
+  if (objective == spectral_objective_t::modularity) {
+    degree_products = compute_column_sums<GraphViewType::is_multi_gpu, vertex_t, double>(
+      handle,
+      num_local_vertices,
+      num_columns,
+      [block = block.data(), degrees = degrees.data(), num_local_vertices, num_columns] __device__(
+        auto i) {
+        auto row = i % static_cast<size_t>(num_local_vertices);
+        auto col = i / static_cast<size_t>(num_local_vertices);
+        return static_cast<double>(degrees[row]) *
+               static_cast<double>(block[row * num_columns + col]);
+      });
+  }
+
+  thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    thrust::make_counting_iterator(size_t{0}),
+                    thrust::make_counting_iterator(ret.size()),
+                    ret.begin(),
+                    [ret             = ret.data(),
+                     block           = block.data(),
+                     degrees         = degrees.data(),
+                     degree_products = degree_products.data(),
+                     num_columns,
+                     shift,
+                     total_weight,
+                     modularity = (objective == spectral_objective_t::modularity)] __device__(
+                      auto i) {
+                      auto row = i / num_columns;
+                      auto col = i % num_columns;
+                      auto ax  = static_cast<double>(ret[i]);
+                      auto x   = static_cast<double>(block[i]);
+                      auto d   = static_cast<double>(degrees[row]);
+                      return static_cast<weight_t>(
+                        modularity ? (ax - d * degree_products[col] / total_weight + shift * x)
+                                   : ((shift - d) * x + ax));
+                    });
+
+  return ret;
+}
+
+template <typename vertex_t, typename weight_t>
+struct random_block_value_t {
+  vertex_t local_vertex_first{};
+  size_t num_columns{};
+  uint64_t seed{};
+
+  __device__ weight_t operator()(size_t i) const
+  {
+    // splitmix64 hash of the (global vertex, column) pair, so the initial block does not depend on
+    // the number of GPUs
+    uint64_t z = (static_cast<uint64_t>(local_vertex_first) * num_columns + i) +
+                 seed * 0x9e3779b97f4a7c15ull;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    z = z ^ (z >> 31);
+    return static_cast<weight_t>(static_cast<double>(z >> 11) * (2.0 / 9007199254740992.0) - 1.0);
+  }
+};
+
+template <typename GraphViewType>
+void compute_spectral_embedding(raft::handle_t const &handle,
+                                GraphViewType const &graph_view,
+                                spectral_objective_t objective,
+                                size_t n_eig_vects,
+                                typename GraphViewType::weight_type *eig_vals,
+                                typename GraphViewType::weight_type *eig_vects,
+                                typename GraphViewType::weight_type evs_tolerance,
+                                size_t evs_max_iter,
+                                bool has_initial_guess,
+                                bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  static_assert(std::is_floating_point<weight_t>::value,
+                "GraphViewType::weight_type should be a floating-point type.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_vertices       = graph_view.get_number_of_vertices();
+  auto const num_local_vertices = graph_view.get_number_of_local_vertices();
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: spectral clustering requires a symmetric graph.");
+  CUGRAPH_EXPECTS((n_eig_vects > 0) && (n_eig_vects <= static_cast<size_t>(num_vertices)),
+                  "Invalid input argument: n_eig_vects should be in [1, # vertices].");
+  CUGRAPH_EXPECTS((eig_vals != nullptr) &&
+                    ((eig_vects != nullptr) || (num_local_vertices == 0)),
+                  "Invalid input argument: eig_vals and eig_vects should not be nullptr.");
+  CUGRAPH_EXPECTS((evs_tolerance > weight_t{0.0}) && (evs_tolerance < weight_t{1.0}),
+                  "Invalid input argument: evs_tolerance should be in (0.0, 1.0).");
+
+  if (do_expensive_check) {
+    // FIXME: check whether the graph is really symmetric (the graph property is not verified)
+  }
+
+  // 2. compute the (weighted) degrees and the operator shift (an upper bound of the spectral
+  // radius, from the Gershgorin circle theorem)
+
+  rmm::device_uvector<weight_t> degrees(0, handle.get_stream());
+  if (graph_view.is_weighted()) {
+    degrees = graph_view.compute_out_weight_sums(handle);
+  } else {
+    auto out_degrees = graph_view.compute_out_degrees(handle);
+    degrees.resize(out_degrees.size(), handle.get_stream());
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      out_degrees.begin(),
+                      out_degrees.end(),
+                      degrees.begin(),
+                      [] __device__(auto d) { return static_cast<weight_t>(d); });
+  }
+
+  double total_weight =
+    thrust::reduce(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   degrees.begin(),
+                   degrees.end(),
+                   double{0.0});
+  double max_degree = static_cast<double>(
+    thrust::reduce(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   degrees.begin(),
+                   degrees.end(),
+                   weight_t{0.0},
+                   thrust::maximum<weight_t>()));
+  if (GraphViewType::is_multi_gpu) {
+    total_weight = host_scalar_allreduce(handle.get_comms(), total_weight, handle.get_stream());
+    max_degree   = host_scalar_allreduce(
+      handle.get_comms(), max_degree, raft::comms::op_t::MAX, handle.get_stream());
+  }
+  CUGRAPH_EXPECTS(total_weight > 0.0,
+                  "Invalid input argument: the graph should have at least one edge with a "
+                  "positive weight.");
+  auto shift = 2.0 * max_degree;
+
+  // 3. block subspace iteration with Rayleigh-Ritz projection (a single pass over the edges per
+  // iteration for the entire block)
+
+  auto num_columns = std::min(
+    static_cast<size_t>(num_vertices),
+    n_eig_vects + std::max(n_eig_vects, spectral_min_block_oversampling));
+
+  rmm::device_uvector<weight_t> block(static_cast<size_t>(num_local_vertices) * num_columns,
+                                      handle.get_stream());
+  thrust::transform(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(block.size()),
+    block.begin(),
+    random_block_value_t<vertex_t, weight_t>{
+      graph_view.get_local_vertex_first(), num_columns, uint64_t{1234567}});
+  if (has_initial_guess) {
+    thrust::for_each(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(static_cast<size_t>(num_local_vertices) * n_eig_vects),
+      [block = block.data(), eig_vects, num_local_vertices, num_columns] __device__(auto i) {
+        auto row                       = i % static_cast<size_t>(num_local_vertices);
+        auto col                       = i / static_cast<size_t>(num_local_vertices);
+        block[row * num_columns + col] = eig_vects[i];
+      });
+  }
+  orthonormalize_block<GraphViewType::is_multi_gpu>(
+    handle, block, num_local_vertices, num_columns);
+
+  std::vector<double> ritz_values{};
+  std::vector<double> ritz_vectors{};
+  size_t iter{0};
+  while (true) {
+    auto products = apply_spectral_operator(
+      handle, graph_view, objective, block, num_columns, degrees, shift, total_weight);
+
+    auto projection = compute_block_inner_products<GraphViewType::is_multi_gpu>(
+      handle, block.data(), products.data(), num_local_vertices, num_columns, num_columns);
+    for (size_t i = 0; i < num_columns; ++i) {
+      for (size_t j = i + 1; j < num_columns; ++j) {
+        auto val                          = 0.5 * (projection[i * num_columns + j] +
+                              projection[j * num_columns + i]);
+        projection[i * num_columns + j] = val;
+        projection[j * num_columns + i] = val;
+      }
+    }
+    symmetric_eigen_decomposition(projection, num_columns, ritz_values, ritz_vectors);
+
+    block = multiply_block(
+      handle, block.data(), num_local_vertices, num_columns, ritz_vectors, num_columns);
+    products = multiply_block(
+      handle, products.data(), num_local_vertices, num_columns, ritz_vectors, num_columns);
+
+    ++iter;
+
+    rmm::device_uvector<double> d_ritz_values(ritz_values.size(), handle.get_stream());
+    raft::update_device(
+      d_ritz_values.data(), ritz_values.data(), ritz_values.size(), handle.get_stream());
+    auto residuals = compute_column_sums<GraphViewType::is_multi_gpu, vertex_t, double>(
+      handle,
+      num_local_vertices,
+      n_eig_vects,
+      squared_residual_t<vertex_t, weight_t>{
+        block.data(), products.data(), d_ritz_values.data(), num_local_vertices, num_columns});
+    auto max_residual =
+      std::sqrt(thrust::reduce(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                               residuals.begin(),
+                               residuals.end(),
+                               double{0.0},
+                               thrust::maximum<double>()));
+
+    // the residuals are relative to the operator norm bound
+    if ((max_residual <= static_cast<double>(evs_tolerance) * std::max(shift, 1.0)) ||
+        (iter >= evs_max_iter)) {
+      break;
+    }
+
+    block = std::move(products);
+    orthonormalize_block<GraphViewType::is_multi_gpu>(
+      handle, block, num_local_vertices, num_columns);
+  }
+
+  // 4. copy the wanted eigenpairs (undoing the shift), eigenvectors are stored in the column-major
+  // order
+
+  std::vector<weight_t> h_eig_vals(n_eig_vects);
+  for (size_t j = 0; j < n_eig_vects; ++j) {
+    h_eig_vals[j] = static_cast<weight_t>(objective == spectral_objective_t::modularity
+                                            ? ritz_values[j] - shift
+                                            : shift - ritz_values[j]);
+  }
+  raft::update_device(eig_vals, h_eig_vals.data(), h_eig_vals.size(), handle.get_stream());
+
+  thrust::transform(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(static_cast<size_t>(num_local_vertices) * n_eig_vects),
+    eig_vects,
+    [block = block.data(), num_local_vertices, num_columns] __device__(auto i) {
+      auto row = i % static_cast<size_t>(num_local_vertices);
+      auto col = i / static_cast<size_t>(num_local_vertices);
+      return block[row * num_columns + col];
+    });
+}
+
+// select the row of the (local) points block with (global) index point_idx (the process owning the
+// point contributes the point, every process gets the point)
+template <bool multi_gpu, typename weight_t>
+void broadcast_point(raft::handle_t const &handle,
+                     rmm::device_uvector<weight_t> const &points,
+                     size_t dimension,
+                     int owner_rank,
+                     size_t local_point_idx,
+                     weight_t *output)
+{
+  auto const comm_rank = multi_gpu ? handle.get_comms().get_rank() : int{0};
+
+  if (comm_rank == owner_rank) {
+    thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 points.begin() + local_point_idx * dimension,
+                 points.begin() + (local_point_idx + 1) * dimension,
+                 output);
+  } else {
+    thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 output,
+                 output + dimension,
+                 weight_t{0.0});
+  }
+  if (multi_gpu) {
+    device_allreduce(
+      handle.get_comms(), output, output, dimension, raft::comms::op_t::SUM, handle.get_stream());
+  }
+}
+
+// assign every point to the nearest centroid, returns the sum of the squared distances (over the
+// local points)
+template <typename vertex_t, typename weight_t>
+double assign_points(raft::handle_t const &handle,
+                     rmm::device_uvector<weight_t> const &points,
+                     size_t dimension,
+                     rmm::device_uvector<weight_t> const &centroids,
+                     size_t num_centroids,
+                     vertex_t *labels)
+{
+  auto num_points = points.size() / dimension;
+
+  rmm::device_uvector<double> distances(num_points, handle.get_stream());
+  thrust::for_each(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(num_points),
+    [points    = points.data(),
+     centroids = centroids.data(),
+     distances = distances.data(),
+     labels,
+     dimension,
+     num_centroids] __device__(auto i) {
+      auto min_distance = std::numeric_limits<double>::max();
+      vertex_t min_c{0};
+      for (size_t c = 0; c < num_centroids; ++c) {
+        double distance{0.0};
+        for (size_t k = 0; k < dimension; ++k) {
+          auto diff = static_cast<double>(points[i * dimension + k]) -
+                      static_cast<double>(centroids[c * dimension + k]);
+          distance += diff * diff;
+        }
+        if (distance < min_distance) {
+          min_distance = distance;
+          min_c        = static_cast<vertex_t>(c);
+        }
+      }
+      distances[i] = min_distance;
+      labels[i]    = min_c;
+    });
+
+  return thrust::reduce(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        distances.begin(),
+                        distances.end(),
+                        double{0.0});
+}
+
+template <typename GraphViewType>
+void cluster_spectral_embedding(raft::handle_t const &handle,
+                                GraphViewType const &graph_view,
+                                typename GraphViewType::weight_type const *eig_vects,
+                                size_t n_eig_vects,
+                                typename GraphViewType::vertex_type n_clusters,
+                                typename GraphViewType::vertex_type *clustering,
+                                typename GraphViewType::weight_type kmean_tolerance,
+                                size_t kmean_max_iter,
+                                uint64_t seed)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto const num_vertices       = graph_view.get_number_of_vertices();
+  auto const num_local_vertices = graph_view.get_number_of_local_vertices();
+  auto const comm_size = GraphViewType::is_multi_gpu ? handle.get_comms().get_size() : int{1};
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS((n_clusters > 1) && (n_clusters < num_vertices),
+                  "Invalid input argument: n_clusters should be in [2, # vertices).");
+  CUGRAPH_EXPECTS(n_eig_vects > 0, "Invalid input argument: n_eig_vects should be positive.");
+  CUGRAPH_EXPECTS(((eig_vects != nullptr) && (clustering != nullptr)) || (num_local_vertices == 0),
+                  "Invalid input argument: eig_vects and clustering should not be nullptr.");
+  CUGRAPH_EXPECTS((kmean_tolerance >= weight_t{0.0}) && (kmean_tolerance < weight_t{1.0}),
+                  "Invalid input argument: kmean_tolerance should be in [0.0, 1.0).");
+
+  // 2. whiten the leading eigenvectors (zero mean & unit variance per eigenvector) to form the
+  // k-means points
+
+  auto dimension = std::min(static_cast<size_t>(n_clusters), n_eig_vects);
+
+  auto means = compute_column_sums<GraphViewType::is_multi_gpu, vertex_t, double>(
+    handle,
+    num_local_vertices,
+    dimension,
+    [eig_vects] __device__(auto i) { return static_cast<double>(eig_vects[i]); });
+  auto squares = compute_column_sums<GraphViewType::is_multi_gpu, vertex_t, double>(
+    handle,
+    num_local_vertices,
+    dimension,
+    [eig_vects] __device__(auto i) {
+      return static_cast<double>(eig_vects[i]) * static_cast<double>(eig_vects[i]);
+    });
+
+  rmm::device_uvector<weight_t> points(static_cast<size_t>(num_local_vertices) * dimension,
+                                       handle.get_stream());
+  thrust::transform(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    thrust::make_counting_iterator(size_t{0}),
+    thrust::make_counting_iterator(points.size()),
+    points.begin(),
+    [eig_vects,
+     means   = means.data(),
+     squares = squares.data(),
+     num_local_vertices,
+     dimension,
+     num_vertices = static_cast<double>(num_vertices)] __device__(auto i) {
+      auto row      = i / dimension;
+      auto col      = i % dimension;
+      auto mean     = means[col] / num_vertices;
+      auto variance = squares[col] / num_vertices - mean * mean;
+      auto stddev   = variance > 0.0 ? std::sqrt(variance) : 1.0;
+      auto val =
+        static_cast<double>(eig_vects[col * static_cast<size_t>(num_local_vertices) + row]);
+      return static_cast<weight_t>((val - mean) / stddev);
+    });
+
+  // 3. k-means++ initialization (every process draws the same random numbers, the process owning a
+  // selected point broadcasts the point)
+
+  std::mt19937_64 gen(seed);
+  rmm::device_uvector<weight_t> centroids(static_cast<size_t>(n_clusters) * dimension,
+                                          handle.get_stream());
+  rmm::device_uvector<double> min_distances(num_local_vertices, handle.get_stream());
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               min_distances.begin(),
+               min_distances.end(),
+               std::numeric_limits<double>::max());
+
+  std::vector<vertex_t> local_counts(comm_size, num_local_vertices);
+  if (GraphViewType::is_multi_gpu) {
+    local_counts =
+      host_scalar_allgather(handle.get_comms(), num_local_vertices, handle.get_stream());
+  }
+
+  for (vertex_t c = 0; c < n_clusters; ++c) {
+    int owner_rank{0};
+    size_t local_point_idx{0};
+
+    rmm::device_uvector<double> prefix_sums(num_local_vertices, handle.get_stream());
+    thrust::inclusive_scan(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                           min_distances.begin(),
+                           min_distances.end(),
+                           prefix_sums.begin());
+    double local_sum{0.0};
+    if ((c > 0) && (num_local_vertices > 0)) {
+      raft::update_host(
+        &local_sum, prefix_sums.data() + (num_local_vertices - 1), size_t{1}, handle.get_stream());
+      CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+    }
+    std::vector<double> local_sums(comm_size, local_sum);
+    if (GraphViewType::is_multi_gpu) {
+      local_sums = host_scalar_allgather(handle.get_comms(), local_sum, handle.get_stream());
+    }
+    auto total_sum = std::accumulate(local_sums.begin(), local_sums.end(), double{0.0});
+
+    if ((c == 0) || !(total_sum > 0.0)) {
+      // uniform sampling
+      auto point_idx = std::uniform_int_distribution<vertex_t>(0, num_vertices - 1)(gen);
+      while (point_idx >= local_counts[owner_rank]) {
+        point_idx -= local_counts[owner_rank];
+        ++owner_rank;
+      }
+      local_point_idx = static_cast<size_t>(point_idx);
+    } else {
+      // sampling in proportion to the squared distance to the nearest centroid
+      auto r = std::uniform_real_distribution<double>(0.0, total_sum)(gen);
+      while ((owner_rank < comm_size - 1) && (r >= local_sums[owner_rank])) {
+        r -= local_sums[owner_rank];
+        ++owner_rank;
+      }
+      if (owner_rank == (GraphViewType::is_multi_gpu ? handle.get_comms().get_rank() : int{0})) {
+        local_point_idx = std::min(
+          static_cast<size_t>(thrust::distance(
+            prefix_sums.begin(),
+            thrust::upper_bound(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                                prefix_sums.begin(),
+                                prefix_sums.end(),
+                                r))),
+          static_cast<size_t>(num_local_vertices - 1));
+      }
+    }
+
+    auto centroid = centroids.data() + static_cast<size_t>(c) * dimension;
+    broadcast_point<GraphViewType::is_multi_gpu>(
+      handle, points, dimension, owner_rank, local_point_idx, centroid);
+
+    thrust::transform(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(size_t{0}),
+      thrust::make_counting_iterator(static_cast<size_t>(num_local_vertices)),
+      min_distances.begin(),
+      [points        = points.data(),
+       min_distances = min_distances.data(),
+       centroid,
+       dimension] __device__(auto i) {
+        double distance{0.0};
+        for (size_t k = 0; k < dimension; ++k) {
+          auto diff = static_cast<double>(points[i * dimension + k]) -
+                      static_cast<double>(centroid[k]);
+          distance += diff * diff;
+        }
+        return thrust::min(min_distances[i], distance);
+      });
+  }
+
+  // 4. Lloyd iterations
+
+  rmm::device_uvector<double> centroid_sums(centroids.size(), handle.get_stream());
+  rmm::device_uvector<double> centroid_counts(n_clusters, handle.get_stream());
+  auto previous_inertia = std::numeric_limits<double>::max();
+  for (size_t iter = 0; iter < kmean_max_iter; ++iter) {
+    auto inertia = assign_points(handle, points, dimension, centroids, n_clusters, clustering);
+    if (GraphViewType::is_multi_gpu) {
+      inertia = host_scalar_allreduce(handle.get_comms(), inertia, handle.get_stream());
+    }
+    if (previous_inertia - inertia <= static_cast<double>(kmean_tolerance) * inertia) { break; }
+    previous_inertia = inertia;
+
+    thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 centroid_sums.begin(),
+                 centroid_sums.end(),
+                 double{0.0});
+    thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 centroid_counts.begin(),
+                 centroid_counts.end(),
+                 double{0.0});
+    thrust::for_each(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(static_cast<size_t>(num_local_vertices)),
+                     [points          = points.data(),
+                      centroid_sums   = centroid_sums.data(),
+                      centroid_counts = centroid_counts.data(),
+                      clustering,
+                      dimension] __device__(auto i) {
+                       auto c = static_cast<size_t>(clustering[i]);
+                       for (size_t k = 0; k < dimension; ++k) {
+                         atomicAdd(centroid_sums + c * dimension + k,
+                                   static_cast<double>(points[i * dimension + k]));
+                       }
+                       atomicAdd(centroid_counts + c, 1.0);
+                     });
+    if (GraphViewType::is_multi_gpu) {
+      device_allreduce(handle.get_comms(),
+                       centroid_sums.begin(),
+                       centroid_sums.begin(),
+                       centroid_sums.size(),
+                       raft::comms::op_t::SUM,
+                       handle.get_stream());
+      device_allreduce(handle.get_comms(),
+                       centroid_counts.begin(),
+                       centroid_counts.begin(),
+                       centroid_counts.size(),
+                       raft::comms::op_t::SUM,
+                       handle.get_stream());
+    }
+
+    // empty clusters keep their centroids
+    thrust::for_each(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(centroids.size()),
+                     [centroids       = centroids.data(),
+                      centroid_sums   = centroid_sums.data(),
+                      centroid_counts = centroid_counts.data(),
+                      dimension] __device__(auto i) {
+                       auto count = centroid_counts[i / dimension];
+                       if (count > 0.0) {
+                         centroids[i] = static_cast<weight_t>(centroid_sums[i] / count);
+                       }
+                     });
+  }
+
+  assign_points(handle, points, dimension, centroids, n_clusters, clustering);
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void compute_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  spectral_objective_t objective,
+  size_t n_eig_vects,
+  weight_t *eig_vals,
+  weight_t *eig_vects,
+  weight_t evs_tolerance,
+  size_t evs_max_iter,
+  bool has_initial_guess,
+  bool do_expensive_check)
+{
+  detail::compute_spectral_embedding(handle,
+                                     graph_view,
+                                     objective,
+                                     n_eig_vects,
+                                     eig_vals,
+                                     eig_vects,
+                                     evs_tolerance,
+                                     evs_max_iter,
+                                     has_initial_guess,
+                                     do_expensive_check);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void cluster_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  weight_t const *eig_vects,
+  size_t n_eig_vects,
+  vertex_t n_clusters,
+  vertex_t *clustering,
+  weight_t kmean_tolerance,
+  size_t kmean_max_iter,
+  uint64_t seed)
+{
+  detail::cluster_spectral_embedding(handle,
+                                     graph_view,
+                                     eig_vects,
+                                     n_eig_vects,
+                                     n_clusters,
+                                     clustering,
+                                     kmean_tolerance,
+                                     kmean_max_iter,
+                                     seed);
+}
+
+// explicit instantiation
+
+template void compute_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, float, false, true> const &graph_view,
+  spectral_objective_t objective,
+  size_t n_eig_vects,
+  float *eig_vals,
+  float *eig_vects,
+  float evs_tolerance,
+  size_t evs_max_iter,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void cluster_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, float, false, true> const &graph_view,
+  float const *eig_vects,
+  size_t n_eig_vects,
+  int32_t n_clusters,
+  int32_t *clustering,
+  float kmean_tolerance,
+  size_t kmean_max_iter,
+  uint64_t seed);
+
+template void compute_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, double, false, true> const &graph_view,
+  spectral_objective_t objective,
+  size_t n_eig_vects,
+  double *eig_vals,
+  double *eig_vects,
+  double evs_tolerance,
+  size_t evs_max_iter,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void cluster_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, double, false, true> const &graph_view,
+  double const *eig_vects,
+  size_t n_eig_vects,
+  int32_t n_clusters,
+  int32_t *clustering,
+  double kmean_tolerance,
+  size_t kmean_max_iter,
+  uint64_t seed);
+
+template void compute_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, float, false, true> const &graph_view,
+  spectral_objective_t objective,
+  size_t n_eig_vects,
+  float *eig_vals,
+  float *eig_vects,
+  float evs_tolerance,
+  size_t evs_max_iter,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void cluster_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, float, false, true> const &graph_view,
+  float const *eig_vects,
+  size_t n_eig_vects,
+  int32_t n_clusters,
+  int32_t *clustering,
+  float kmean_tolerance,
+  size_t kmean_max_iter,
+  uint64_t seed);
+
+template void compute_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, double, false, true> const &graph_view,
+  spectral_objective_t objective,
+  size_t n_eig_vects,
+  double *eig_vals,
+  double *eig_vects,
+  double evs_tolerance,
+  size_t evs_max_iter,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void cluster_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, double, false, true> const &graph_view,
+  double const *eig_vects,
+  size_t n_eig_vects,
+  int32_t n_clusters,
+  int32_t *clustering,
+  double kmean_tolerance,
+  size_t kmean_max_iter,
+  uint64_t seed);
+
+template void compute_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, float, false, true> const &graph_view,
+  spectral_objective_t objective,
+  size_t n_eig_vects,
+  float *eig_vals,
+  float *eig_vects,
+  float evs_tolerance,
+  size_t evs_max_iter,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void cluster_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, float, false, true> const &graph_view,
+  float const *eig_vects,
+  size_t n_eig_vects,
+  int64_t n_clusters,
+  int64_t *clustering,
+  float kmean_tolerance,
+  size_t kmean_max_iter,
+  uint64_t seed);
+
+template void compute_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, double, false, true> const &graph_view,
+  spectral_objective_t objective,
+  size_t n_eig_vects,
+  double *eig_vals,
+  double *eig_vects,
+  double evs_tolerance,
+  size_t evs_max_iter,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void cluster_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, double, false, true> const &graph_view,
+  double const *eig_vects,
+  size_t n_eig_vects,
+  int64_t n_clusters,
+  int64_t *clustering,
+  double kmean_tolerance,
+  size_t kmean_max_iter,
+  uint64_t seed);
+
+template void compute_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const &graph_view,
+  spectral_objective_t objective,
+  size_t n_eig_vects,
+  float *eig_vals,
+  float *eig_vects,
+  float evs_tolerance,
+  size_t evs_max_iter,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void cluster_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const &graph_view,
+  float const *eig_vects,
+  size_t n_eig_vects,
+  int32_t n_clusters,
+  int32_t *clustering,
+  float kmean_tolerance,
+  size_t kmean_max_iter,
+  uint64_t seed);
+
+template void compute_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const &graph_view,
+  spectral_objective_t objective,
+  size_t n_eig_vects,
+  double *eig_vals,
+  double *eig_vects,
+  double evs_tolerance,
+  size_t evs_max_iter,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void cluster_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const &graph_view,
+  double const *eig_vects,
+  size_t n_eig_vects,
+  int32_t n_clusters,
+  int32_t *clustering,
+  double kmean_tolerance,
+  size_t kmean_max_iter,
+  uint64_t seed);
+
+template void compute_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const &graph_view,
+  spectral_objective_t objective,
+  size_t n_eig_vects,
+  float *eig_vals,
+  float *eig_vects,
+  float evs_tolerance,
+  size_t evs_max_iter,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void cluster_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const &graph_view,
+  float const *eig_vects,
+  size_t n_eig_vects,
+  int32_t n_clusters,
+  int32_t *clustering,
+  float kmean_tolerance,
+  size_t kmean_max_iter,
+  uint64_t seed);
+
+template void compute_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const &graph_view,
+  spectral_objective_t objective,
+  size_t n_eig_vects,
+  double *eig_vals,
+  double *eig_vects,
+  double evs_tolerance,
+  size_t evs_max_iter,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void cluster_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const &graph_view,
+  double const *eig_vects,
+  size_t n_eig_vects,
+  int32_t n_clusters,
+  int32_t *clustering,
+  double kmean_tolerance,
+  size_t kmean_max_iter,
+  uint64_t seed);
+
+template void compute_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const &graph_view,
+  spectral_objective_t objective,
+  size_t n_eig_vects,
+  float *eig_vals,
+  float *eig_vects,
+  float evs_tolerance,
+  size_t evs_max_iter,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void cluster_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const &graph_view,
+  float const *eig_vects,
+  size_t n_eig_vects,
+  int64_t n_clusters,
+  int64_t *clustering,
+  float kmean_tolerance,
+  size_t kmean_max_iter,
+  uint64_t seed);
+
+template void compute_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const &graph_view,
+  spectral_objective_t objective,
+  size_t n_eig_vects,
+  double *eig_vals,
+  double *eig_vects,
+  double evs_tolerance,
+  size_t evs_max_iter,
+  bool has_initial_guess,
+  bool do_expensive_check);
+
+template void cluster_spectral_embedding(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const &graph_view,
+  double const *eig_vects,
+  size_t n_eig_vects,
+  int64_t n_clusters,
+  int64_t *clustering,
+  double kmean_tolerance,
+  size_t kmean_max_iter,
+  uint64_t seed);
+
+}  // namespace experimental
+}  // namespace cugraph
@@ -19,10 +19,12 @@
 #include <patterns/copy_to_adj_matrix_row_col.cuh>
 #include <patterns/count_if_e.cuh>
 #include <patterns/reduce_op.cuh>
-#include <patterns/transform_reduce_e.cuh>
+#include <patterns/transform_reduce_v.cuh>
 #include <patterns/update_frontier_v_push_if_out_nbr.cuh>
 #include <patterns/vertex_frontier.cuh>
 #include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+#include <utilities/profiling.hpp>
 #include <vertex_partition_device.cuh>
 
 #include <raft/cudart_utils.h>
@@ -33,22 +35,32 @@
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 
 namespace cugraph {
 namespace experimental {
 namespace detail {
 
+// FIXME: these values require tuning; in the adaptive delta mode, delta is scaled (within
+// [adaptive_delta_min_scale, adaptive_delta_max_scale] per far queue split) to make the average
+// near queue size approach the number of concurrently executable threads.
+double constexpr adaptive_delta_min_scale = 0.5;
+double constexpr adaptive_delta_max_scale = 2.0;
+
 template <typename GraphViewType, typename PredecessorIterator>
-void sssp(raft::handle_t const &handle,
-          GraphViewType const &push_graph_view,
-          typename GraphViewType::weight_type *distances,
-          PredecessorIterator predecessor_first,
-          typename GraphViewType::vertex_type source_vertex,
-          typename GraphViewType::weight_type cutoff,
-          bool do_expensive_check)
+size_t sssp(raft::handle_t const &handle,
+            GraphViewType const &push_graph_view,
+            typename GraphViewType::weight_type *distances,
+            PredecessorIterator predecessor_first,
+            typename GraphViewType::vertex_type source_vertex,
+            typename GraphViewType::weight_type cutoff,
+            bool adaptive_delta,
+            bool do_expensive_check)
 {
   using vertex_t = typename GraphViewType::vertex_type;
   using weight_t = typename GraphViewType::weight_type;
@@ -58,9 +70,11 @@ void sssp(raft::handle_t const &handle,
   static_assert(!GraphViewType::is_adj_matrix_transposed,
                 "GraphViewType should support the push model.");
 
+  profile_range_t profile_range(handle, "sssp");
+
   auto const num_vertices = push_graph_view.get_number_of_vertices();
   auto const num_edges    = push_graph_view.get_number_of_edges();
-  if (num_vertices == 0) { return; }
+  if (num_vertices == 0) { return size_t{0}; }
 
   // implements the Near-Far Pile method in
   // A. Davidson, S. Baxter, M. Garland, and J. D. Owens, "Work-efficient parallel GPU methods for
@@ -103,34 +117,39 @@ void sssp(raft::handle_t const &handle,
                       return thrust::make_tuple(distance, invalid_vertex);
                     });
 
-  if (num_edges == 0) { return; }
+  if (num_edges == 0) { return size_t{0}; }
 
   // 3. update delta
 
-  weight_t average_vertex_degree{0.0};
-  weight_t average_edge_weight{0.0};
-  thrust::tie(average_vertex_degree, average_edge_weight) = transform_reduce_e(
+  // the total edge weight is the sum of the vertex out-weight sums (cached in the graph, so this is
+  // O(V) instead of O(E) after the first call)
+  auto total_edge_weight = transform_reduce_v(
     handle,
     push_graph_view,
-    thrust::make_constant_iterator(0) /* dummy */,
-    thrust::make_constant_iterator(0) /* dummy */,
-    [] __device__(vertex_t row, vertex_t col, weight_t w, auto row_val, auto col_val) {
-      return thrust::make_tuple(weight_t{1.0}, w);
-    },
-    thrust::make_tuple(weight_t{0.0}, weight_t{0.0}));
-  average_vertex_degree /= static_cast<weight_t>(num_vertices);
-  average_edge_weight /= static_cast<weight_t>(num_edges);
+    push_graph_view.get_out_weight_sums(handle),
+    [] __device__(auto w) { return w; },
+    weight_t{0.0});
+  auto average_vertex_degree =
+    static_cast<weight_t>(num_edges) / static_cast<weight_t>(num_vertices);
+  auto average_edge_weight = total_edge_weight / static_cast<weight_t>(num_edges);
   auto delta =
     (static_cast<weight_t>(raft::warp_size()) * average_edge_weight) / average_vertex_degree;
 
   // 4. initialize SSSP frontier
 
   enum class Bucket { cur_near, new_near, far, num_buckets };
-  // FIXME: need to double check the bucket sizes are sufficient
-  std::vector<size_t> bucket_sizes(static_cast<size_t>(Bucket::num_buckets),
-                                   push_graph_view.get_number_of_local_vertices());
+  // buckets grow on demand, the near and far queue sizes are typically much smaller than the number
+  // of vertices; a queue switches to a bitmap over the local vertices if it grows large (the far
+  // queue accumulates duplicates as distances get updated, the bitmap drops them)
+  // FIXME: initial bucket capacities require tuning
+  std::vector<size_t> bucket_sizes(
+    static_cast<size_t>(Bucket::num_buckets),
+    std::min(push_graph_view.get_number_of_local_vertices(), vertex_t{1024}));
   VertexFrontier<vertex_t, GraphViewType::is_multi_gpu, static_cast<size_t>(Bucket::num_buckets)>
-    vertex_frontier(handle, bucket_sizes);
+    vertex_frontier(handle,
+                    bucket_sizes,
+                    push_graph_view.get_local_vertex_first(),
+                    push_graph_view.get_local_vertex_last());
 
   // 5. SSSP iteration
 
@@ -155,8 +174,31 @@ void sssp(raft::handle_t const &handle,
     vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur_near)).insert(source_vertex);
   }
 
+  // target (aggregate) near queue size in the adaptive delta mode
+  auto target_frontier_size =
+    static_cast<double>(handle.get_device_properties().multiProcessorCount) *
+    static_cast<double>(handle.get_device_properties().maxThreadsPerMultiProcessor);
+  if (GraphViewType::is_multi_gpu) {
+    target_frontier_size *= static_cast<double>(handle.get_comms().get_size());
+  }
+
+  size_t num_iterations{0};
+  size_t num_bucket_iterations{0};     // number of iterations since the last far queue split
+  size_t bucket_frontier_size_sum{0};  // sum of the near queue sizes since the last split
   auto near_far_threshold = delta;
+  // the aggregate near queue size is relevant only in the adaptive delta mode, the queue sizes are
+  // aggregated in a single collective per iteration (instead of one per queue)
+  size_t cur_near_aggregate_size{0};
+  if (adaptive_delta) {
+    cur_near_aggregate_size =
+      vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur_near)).aggregate_size();
+  }
   while (true) {
+    if (adaptive_delta) {
+      bucket_frontier_size_sum += cur_near_aggregate_size;
+      ++num_bucket_iterations;
+    }
+
     if (!vertex_and_adj_matrix_row_ranges_coincide) {
       copy_to_adj_matrix_row(
         handle,
@@ -202,44 +244,75 @@ void sssp(raft::handle_t const &handle,
                      : VertexFrontier<vertex_t>::kInvalidBucketIdx;
         return thrust::make_tuple(idx, pushed_val);
       });
+    ++num_iterations;
+    add_profile_counter("iterations", 1);
 
     vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur_near)).clear();
-    if (vertex_frontier.get_bucket(static_cast<size_t>(Bucket::new_near)).aggregate_size() > 0) {
+    auto aggregate_bucket_sizes = vertex_frontier.aggregate_bucket_sizes(
+      {static_cast<size_t>(Bucket::new_near), static_cast<size_t>(Bucket::far)});
+    if (aggregate_bucket_sizes[0] > 0) {
       vertex_frontier.swap_buckets(static_cast<size_t>(Bucket::cur_near),
                                    static_cast<size_t>(Bucket::new_near));
-    } else if (vertex_frontier.get_bucket(static_cast<size_t>(Bucket::far)).aggregate_size() >
-               0) {  // near queue is empty, split the far queue
+      cur_near_aggregate_size = aggregate_bucket_sizes[0];
+    } else if (aggregate_bucket_sizes[1] > 0) {  // near queue is empty, split the far queue
+      if (adaptive_delta) {
+        auto average_frontier_size = static_cast<double>(bucket_frontier_size_sum) /
+                                     static_cast<double>(num_bucket_iterations);
+        auto scale = target_frontier_size / std::max(average_frontier_size, 1.0);
+        scale = std::min(std::max(scale, adaptive_delta_min_scale), adaptive_delta_max_scale);
+        delta *= static_cast<weight_t>(scale);
+        bucket_frontier_size_sum = 0;
+        num_bucket_iterations    = 0;
+      }
+
       auto old_near_far_threshold = near_far_threshold;
-      near_far_threshold += delta;
-
-      size_t new_near_size{0};
-      size_t new_far_size{0};
-      while (true) {
-        vertex_frontier.split_bucket(
-          static_cast<size_t>(Bucket::far),
-          [vertex_partition, distances, old_near_far_threshold, near_far_threshold] __device__(
-            auto v) {
-            auto dist =
-              *(distances + vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v));
-            if (dist < old_near_far_threshold) {
-              return VertexFrontier<vertex_t>::kInvalidBucketIdx;
-            } else if (dist < near_far_threshold) {
-              return static_cast<size_t>(Bucket::cur_near);
-            } else {
-              return static_cast<size_t>(Bucket::far);
-            }
-          });
-        new_near_size =
+
+      // find the minimum distance in the far queue (vertices with distances smaller than
+      // old_near_far_threshold are already settled in the near queue, skip them) and move the
+      // threshold past this distance (in multiples of delta), so a single split moves at least one
+      // vertex to the near queue (instead of repeatedly scanning the far queue for empty ranges)
+      auto min_far_distance = thrust::transform_reduce(
+        rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+        vertex_frontier.get_bucket(static_cast<size_t>(Bucket::far)).begin(),
+        vertex_frontier.get_bucket(static_cast<size_t>(Bucket::far)).end(),
+        [vertex_partition, distances, old_near_far_threshold] __device__(auto v) {
+          auto dist =
+            *(distances + vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v));
+          return dist < old_near_far_threshold ? invalid_distance : dist;
+        },
+        invalid_distance,
+        thrust::minimum<weight_t>());
+      if (GraphViewType::is_multi_gpu) {
+        min_far_distance = host_scalar_allreduce(
+          handle.get_comms(), min_far_distance, raft::comms::op_t::MIN, handle.get_stream());
+      }
+      if (min_far_distance == invalid_distance) { break; }  // every far queue vertex is settled
+
+      near_far_threshold =
+        old_near_far_threshold +
+        delta * (std::floor((min_far_distance - old_near_far_threshold) / delta) + weight_t{1.0});
+      if (near_far_threshold <= min_far_distance) {  // to be safe with floating point round-off
+        near_far_threshold = min_far_distance + delta;
+      }
+
+      vertex_frontier.split_bucket(
+        static_cast<size_t>(Bucket::far),
+        [vertex_partition, distances, old_near_far_threshold, near_far_threshold] __device__(
+          auto v) {
+          auto dist =
+            *(distances + vertex_partition.get_local_vertex_offset_from_vertex_nocheck(v));
+          if (dist < old_near_far_threshold) {
+            return VertexFrontier<vertex_t>::kInvalidBucketIdx;
+          } else if (dist < near_far_threshold) {
+            return static_cast<size_t>(Bucket::cur_near);
+          } else {
+            return static_cast<size_t>(Bucket::far);
+          }
+        });
+      if (adaptive_delta) {
+        cur_near_aggregate_size =
           vertex_frontier.get_bucket(static_cast<size_t>(Bucket::cur_near)).aggregate_size();
-        new_far_size =
-          vertex_frontier.get_bucket(static_cast<size_t>(Bucket::far)).aggregate_size();
-        if ((new_near_size > 0) || (new_far_size == 0)) {
-          break;
-        } else {
-          near_far_threshold += delta;
-        }
       }
-      if ((new_near_size == 0) && (new_far_size == 0)) { break; }
     } else {
       break;
     }
@@ -249,130 +322,152 @@ void sssp(raft::handle_t const &handle,
     handle.get_stream()));  // this is as necessary vertex_frontier will become out-of-scope once
                             // this function returns (FIXME: should I stream sync in VertexFrontier
                             // destructor?)
+
+  return num_iterations;
 }
 
 }  // namespace detail
 
 template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
-void sssp(raft::handle_t const &handle,
-          graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
-          weight_t *distances,
-          vertex_t *predecessors,
-          vertex_t source_vertex,
-          weight_t cutoff,
-          bool do_expensive_check)
+size_t sssp(raft::handle_t const &handle,
+            graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+            weight_t *distances,
+            vertex_t *predecessors,
+            vertex_t source_vertex,
+            weight_t cutoff,
+            bool do_expensive_check,
+            bool adaptive_delta)
 {
   if (predecessors != nullptr) {
-    detail::sssp(
-      handle, graph_view, distances, predecessors, source_vertex, cutoff, do_expensive_check);
+    return detail::sssp(handle,
+                        graph_view,
+                        distances,
+                        predecessors,
+                        source_vertex,
+                        cutoff,
+                        adaptive_delta,
+                        do_expensive_check);
   } else {
-    detail::sssp(handle,
-                 graph_view,
-                 distances,
-                 thrust::make_discard_iterator(),
-                 source_vertex,
-                 cutoff,
-                 do_expensive_check);
+    return detail::sssp(handle,
+                        graph_view,
+                        distances,
+                        thrust::make_discard_iterator(),
+                        source_vertex,
+                        cutoff,
+                        adaptive_delta,
+                        do_expensive_check);
   }
 }
 
 // explicit instantiation
 
-template void sssp(raft::handle_t const &handle,
-                   graph_view_t<int32_t, int32_t, float, false, true> const &graph_view,
-                   float *distances,
-                   int32_t *predecessors,
-                   int32_t source_vertex,
-                   float cutoff,
-                   bool do_expensive_check);
-
-template void sssp(raft::handle_t const &handle,
-                   graph_view_t<int32_t, int32_t, double, false, true> const &graph_view,
-                   double *distances,
-                   int32_t *predecessors,
-                   int32_t source_vertex,
-                   double cutoff,
-                   bool do_expensive_check);
-
-template void sssp(raft::handle_t const &handle,
-                   graph_view_t<int32_t, int64_t, float, false, true> const &graph_view,
-                   float *distances,
-                   int32_t *predecessors,
-                   int32_t source_vertex,
-                   float cutoff,
-                   bool do_expensive_check);
-
-template void sssp(raft::handle_t const &handle,
-                   graph_view_t<int32_t, int64_t, double, false, true> const &graph_view,
-                   double *distances,
-                   int32_t *predecessors,
-                   int32_t source_vertex,
-                   double cutoff,
-                   bool do_expensive_check);
-
-template void sssp(raft::handle_t const &handle,
-                   graph_view_t<int64_t, int64_t, float, false, true> const &graph_view,
-                   float *distances,
-                   int64_t *predecessors,
-                   int64_t source_vertex,
-                   float cutoff,
-                   bool do_expensive_check);
-
-template void sssp(raft::handle_t const &handle,
-                   graph_view_t<int64_t, int64_t, double, false, true> const &graph_view,
-                   double *distances,
-                   int64_t *predecessors,
-                   int64_t source_vertex,
-                   double cutoff,
-                   bool do_expensive_check);
-
-template void sssp(raft::handle_t const &handle,
-                   graph_view_t<int32_t, int32_t, float, false, false> const &graph_view,
-                   float *distances,
-                   int32_t *predecessors,
-                   int32_t source_vertex,
-                   float cutoff,
-                   bool do_expensive_check);
-
-template void sssp(raft::handle_t const &handle,
-                   graph_view_t<int32_t, int32_t, double, false, false> const &graph_view,
-                   double *distances,
-                   int32_t *predecessors,
-                   int32_t source_vertex,
-                   double cutoff,
-                   bool do_expensive_check);
-
-template void sssp(raft::handle_t const &handle,
-                   graph_view_t<int32_t, int64_t, float, false, false> const &graph_view,
-                   float *distances,
-                   int32_t *predecessors,
-                   int32_t source_vertex,
-                   float cutoff,
-                   bool do_expensive_check);
-
-template void sssp(raft::handle_t const &handle,
-                   graph_view_t<int32_t, int64_t, double, false, false> const &graph_view,
-                   double *distances,
-                   int32_t *predecessors,
-                   int32_t source_vertex,
-                   double cutoff,
-                   bool do_expensive_check);
-
-template void sssp(raft::handle_t const &handle,
-                   graph_view_t<int64_t, int64_t, float, false, false> const &graph_view,
-                   float *distances,
-                   int64_t *predecessors,
-                   int64_t source_vertex,
-                   float cutoff,
-                   bool do_expensive_check);
-
-template void sssp(raft::handle_t const &handle,
-                   graph_view_t<int64_t, int64_t, double, false, false> const &graph_view,
-                   double *distances,
-                   int64_t *predecessors,
-                   int64_t source_vertex,
-                   double cutoff,
-                   bool do_expensive_check);
+template size_t sssp(raft::handle_t const &handle,
+                     graph_view_t<int32_t, int32_t, float, false, true> const &graph_view,
+                     float *distances,
+                     int32_t *predecessors,
+                     int32_t source_vertex,
+                     float cutoff,
+                     bool do_expensive_check,
+                     bool adaptive_delta);
+
+template size_t sssp(raft::handle_t const &handle,
+                     graph_view_t<int32_t, int32_t, double, false, true> const &graph_view,
+                     double *distances,
+                     int32_t *predecessors,
+                     int32_t source_vertex,
+                     double cutoff,
+                     bool do_expensive_check,
+                     bool adaptive_delta);
+
+template size_t sssp(raft::handle_t const &handle,
+                     graph_view_t<int32_t, int64_t, float, false, true> const &graph_view,
+                     float *distances,
+                     int32_t *predecessors,
+                     int32_t source_vertex,
+                     float cutoff,
+                     bool do_expensive_check,
+                     bool adaptive_delta);
+
+template size_t sssp(raft::handle_t const &handle,
+                     graph_view_t<int32_t, int64_t, double, false, true> const &graph_view,
+                     double *distances,
+                     int32_t *predecessors,
+                     int32_t source_vertex,
+                     double cutoff,
+                     bool do_expensive_check,
+                     bool adaptive_delta);
+
+template size_t sssp(raft::handle_t const &handle,
+                     graph_view_t<int64_t, int64_t, float, false, true> const &graph_view,
+                     float *distances,
+                     int64_t *predecessors,
+                     int64_t source_vertex,
+                     float cutoff,
+                     bool do_expensive_check,
+                     bool adaptive_delta);
+
+template size_t sssp(raft::handle_t const &handle,
+                     graph_view_t<int64_t, int64_t, double, false, true> const &graph_view,
+                     double *distances,
+                     int64_t *predecessors,
+                     int64_t source_vertex,
+                     double cutoff,
+                     bool do_expensive_check,
+                     bool adaptive_delta);
+
+template size_t sssp(raft::handle_t const &handle,
+                     graph_view_t<int32_t, int32_t, float, false, false> const &graph_view,
+                     float *distances,
+                     int32_t *predecessors,
+                     int32_t source_vertex,
+                     float cutoff,
+                     bool do_expensive_check,
+                     bool adaptive_delta);
+
+template size_t sssp(raft::handle_t const &handle,
+                     graph_view_t<int32_t, int32_t, double, false, false> const &graph_view,
+                     double *distances,
+                     int32_t *predecessors,
+                     int32_t source_vertex,
+                     double cutoff,
+                     bool do_expensive_check,
+                     bool adaptive_delta);
+
+template size_t sssp(raft::handle_t const &handle,
+                     graph_view_t<int32_t, int64_t, float, false, false> const &graph_view,
+                     float *distances,
+                     int32_t *predecessors,
+                     int32_t source_vertex,
+                     float cutoff,
+                     bool do_expensive_check,
+                     bool adaptive_delta);
+
+template size_t sssp(raft::handle_t const &handle,
+                     graph_view_t<int32_t, int64_t, double, false, false> const &graph_view,
+                     double *distances,
+                     int32_t *predecessors,
+                     int32_t source_vertex,
+                     double cutoff,
+                     bool do_expensive_check,
+                     bool adaptive_delta);
+
+template size_t sssp(raft::handle_t const &handle,
+                     graph_view_t<int64_t, int64_t, float, false, false> const &graph_view,
+                     float *distances,
+                     int64_t *predecessors,
+                     int64_t source_vertex,
+                     float cutoff,
+                     bool do_expensive_check,
+                     bool adaptive_delta);
+
+template size_t sssp(raft::handle_t const &handle,
+                     graph_view_t<int64_t, int64_t, double, false, false> const &graph_view,
+                     double *distances,
+                     int64_t *predecessors,
+                     int64_t source_vertex,
+                     double cutoff,
+                     bool do_expensive_check,
+                     bool adaptive_delta);
 
 }  // namespace experimental
 }  // namespace cugraph
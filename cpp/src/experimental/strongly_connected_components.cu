@@ -0,0 +1,1027 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithms.hpp>
+#include <experimental/detail/graph_utils.cuh>
+#include <experimental/graph_view.hpp>
+#include <matrix_partition_device.cuh>
+#include <partition_manager.hpp>
+#include <patterns/copy_to_adj_matrix_row_col.cuh>
+#include <utilities/collect_comm.cuh>
+#include <utilities/device_comm.cuh>
+#include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+#include <utilities/shuffle_comm.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scatter.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+namespace detail {
+
+// FIXME: block size requires tuning
+int32_t constexpr strongly_connected_components_block_size = 512;
+
+// the parts of a color class after a forward-backward sweep (the vertices reached in both
+// directions form a strongly connected component and are removed)
+uint8_t constexpr scc_part_unreached     = 0;
+uint8_t constexpr scc_part_forward_only  = 1;
+uint8_t constexpr scc_part_backward_only = 2;
+uint8_t constexpr scc_num_parts          = 3;
+
+// a color class key is color * scc_num_parts + part, the class is owned by the GPU owning the color
+template <typename vertex_t>
+struct class_key_to_gpu_id_t {
+  vertex_to_gpu_id_t<vertex_t> vertex_to_gpu_id{};
+
+  __device__ int operator()(int64_t key) const
+  {
+    return vertex_to_gpu_id(static_cast<vertex_t>(key / scc_num_parts));
+  }
+};
+
+__device__ inline void atomic_min(int32_t *addr, int32_t val) { atomicMin(addr, val); }
+
+// vertex IDs are non-negative, so the unsigned comparison preserves the order
+__device__ inline void atomic_min(int64_t *addr, int64_t val)
+{
+  atomicMin(reinterpret_cast<unsigned long long int *>(addr),
+            static_cast<unsigned long long int>(val));
+}
+
+// Each thread takes one major vertex and counts its outgoing edges to the active minor vertices of
+// the same color (ignoring self-loops); the last such neighbor is recorded (which is the unique
+// neighbor if the count is 1). The incoming edge counts and the (smallest) incoming neighbors of
+// the minor vertices are updated with atomics.
+template <typename GraphViewType>
+__global__ void for_all_major_count_active_degrees(
+  matrix_partition_device_t<GraphViewType> matrix_partition,
+  typename GraphViewType::vertex_type const *row_color_first,
+  uint8_t const *row_active_first,
+  typename GraphViewType::vertex_type const *col_color_first,
+  uint8_t const *col_active_first,
+  uint32_t *major_out_degree_first,
+  typename GraphViewType::vertex_type *major_out_neighbor_first,
+  uint32_t *minor_in_degree_first,
+  typename GraphViewType::vertex_type *minor_in_neighbor_first)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto const invalid_vertex = std::numeric_limits<vertex_t>::max();
+  auto idx                  = static_cast<size_t>(threadIdx.x + blockIdx.x * blockDim.x);
+
+  while (idx < static_cast<size_t>(matrix_partition.get_major_size())) {
+    uint32_t out_degree{0};
+    auto out_neighbor = invalid_vertex;
+    if (row_active_first[idx]) {
+      auto major = matrix_partition.get_major_from_major_offset_nocheck(static_cast<vertex_t>(idx));
+      auto color = row_color_first[idx];
+      minor_index_iterator_t<vertex_t, edge_t> indices{};
+      weight_t const *weights{nullptr};
+      edge_t local_degree{};
+      thrust::tie(indices, weights, local_degree) =
+        matrix_partition.get_local_edges(static_cast<vertex_t>(idx));
+      for (edge_t i = 0; i < local_degree; ++i) {
+        auto minor        = indices[i];
+        auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(minor);
+        if ((minor != major) && col_active_first[minor_offset] &&
+            (col_color_first[minor_offset] == color)) {
+          ++out_degree;
+          out_neighbor = minor;
+          atomicAdd(minor_in_degree_first + minor_offset, uint32_t{1});
+          atomic_min(minor_in_neighbor_first + minor_offset, major);
+        }
+      }
+    }
+    major_out_degree_first[idx]   = out_degree;
+    major_out_neighbor_first[idx] = out_neighbor;
+    idx += gridDim.x * blockDim.x;
+  }
+}
+
+// Each thread takes one major vertex reached (forward) and marks its unreached active neighbors of
+// the same color.
+template <typename GraphViewType>
+__global__ void for_all_major_push_forward_reachability(
+  matrix_partition_device_t<GraphViewType> matrix_partition,
+  typename GraphViewType::vertex_type const *row_color_first,
+  uint8_t const *row_reached_first,
+  typename GraphViewType::vertex_type const *col_color_first,
+  uint8_t const *col_active_first,
+  uint8_t const *col_reached_first,
+  uint8_t *minor_next_first)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto idx = static_cast<size_t>(threadIdx.x + blockIdx.x * blockDim.x);
+
+  while (idx < static_cast<size_t>(matrix_partition.get_major_size())) {
+    if (row_reached_first[idx]) {
+      auto color = row_color_first[idx];
+      minor_index_iterator_t<vertex_t, edge_t> indices{};
+      weight_t const *weights{nullptr};
+      edge_t local_degree{};
+      thrust::tie(indices, weights, local_degree) =
+        matrix_partition.get_local_edges(static_cast<vertex_t>(idx));
+      for (edge_t i = 0; i < local_degree; ++i) {
+        auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(indices[i]);
+        if (col_active_first[minor_offset] && !col_reached_first[minor_offset] &&
+            (col_color_first[minor_offset] == color)) {
+          minor_next_first[minor_offset] = uint8_t{1};
+        }
+      }
+    }
+    idx += gridDim.x * blockDim.x;
+  }
+}
+
+// Each thread takes one active major vertex not yet reached (backward) and checks whether any of
+// its neighbors of the same color is reached.
+template <typename GraphViewType>
+__global__ void for_all_major_pull_backward_reachability(
+  matrix_partition_device_t<GraphViewType> matrix_partition,
+  typename GraphViewType::vertex_type const *row_color_first,
+  uint8_t const *row_active_first,
+  uint8_t const *row_reached_first,
+  typename GraphViewType::vertex_type const *col_color_first,
+  uint8_t const *col_reached_first,
+  uint8_t *major_next_first)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto idx = static_cast<size_t>(threadIdx.x + blockIdx.x * blockDim.x);
+
+  while (idx < static_cast<size_t>(matrix_partition.get_major_size())) {
+    uint8_t next{0};
+    if (row_active_first[idx] && !row_reached_first[idx]) {
+      auto color = row_color_first[idx];
+      minor_index_iterator_t<vertex_t, edge_t> indices{};
+      weight_t const *weights{nullptr};
+      edge_t local_degree{};
+      thrust::tie(indices, weights, local_degree) =
+        matrix_partition.get_local_edges(static_cast<vertex_t>(idx));
+      for (edge_t i = 0; i < local_degree; ++i) {
+        auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(indices[i]);
+        if (col_reached_first[minor_offset] && (col_color_first[minor_offset] == color)) {
+          next = uint8_t{1};
+          break;
+        }
+      }
+    }
+    major_next_first[idx] = next;
+    idx += gridDim.x * blockDim.x;
+  }
+}
+
+// reduce the adjacency matrix column values of the GPUs in row_comm to the GPUs owning the column
+// vertices
+template <typename GraphViewType, typename T>
+void reduce_adj_matrix_col_values(raft::handle_t const &handle,
+                                  GraphViewType const &push_graph_view,
+                                  T const *adj_matrix_col_value_first,
+                                  T *vertex_value_first,
+                                  raft::comms::op_t op)
+{
+  auto &row_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+  auto const row_comm_size = row_comm.get_size();
+  auto &col_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+  auto const col_comm_rank = col_comm.get_rank();
+
+  for (int i = 0; i < row_comm_size; ++i) {
+    auto offset = (push_graph_view.get_vertex_partition_first(col_comm_rank * row_comm_size + i) -
+                   push_graph_view.get_vertex_partition_first(col_comm_rank * row_comm_size));
+    device_reduce(row_comm,
+                  adj_matrix_col_value_first + offset,
+                  vertex_value_first,
+                  static_cast<size_t>(
+                    push_graph_view.get_vertex_partition_size(col_comm_rank * row_comm_size + i)),
+                  op,
+                  i,
+                  handle.get_stream());
+  }
+}
+
+// look up the values of (local or remote) vertices
+template <typename GraphViewType, typename T>
+rmm::device_uvector<T> collect_vertex_values(
+  raft::handle_t const &handle,
+  GraphViewType const &push_graph_view,
+  T const *vertex_value_first,
+  rmm::device_uvector<typename GraphViewType::vertex_type> const &lookup_vertices,
+  rmm::device_uvector<typename GraphViewType::vertex_type> const &vertex_partition_lasts)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  if (GraphViewType::is_multi_gpu) {
+    auto &comm = handle.get_comms();
+
+    return collect_values_for_keys(
+      comm,
+      thrust::make_counting_iterator(push_graph_view.get_local_vertex_first()),
+      thrust::make_counting_iterator(push_graph_view.get_local_vertex_last()),
+      vertex_value_first,
+      lookup_vertices.begin(),
+      lookup_vertices.end(),
+      vertex_to_gpu_id_t<vertex_t>{vertex_partition_lasts.data(), comm.get_size()},
+      handle.get_stream());
+  } else {
+    rmm::device_uvector<T> values(lookup_vertices.size(), handle.get_stream());
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      lookup_vertices.begin(),
+                      lookup_vertices.end(),
+                      values.begin(),
+                      [vertex_value_first] __device__(auto v) { return vertex_value_first[v]; });
+    return values;
+  }
+}
+
+// the in/out-degrees and the unique in/out-neighbors (valid if the degree is 1) of the vertices
+// within the subgraph induced by the active vertices of each color
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<uint32_t>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>,
+           rmm::device_uvector<uint32_t>,
+           rmm::device_uvector<typename GraphViewType::vertex_type>>
+count_active_degrees(raft::handle_t const &handle,
+                     GraphViewType const &push_graph_view,
+                     rmm::device_uvector<typename GraphViewType::vertex_type> const &colors,
+                     rmm::device_uvector<uint8_t> const &actives)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto const invalid_vertex     = std::numeric_limits<vertex_t>::max();
+  auto const num_local_vertices = push_graph_view.get_number_of_local_vertices();
+  auto const num_rows =
+    GraphViewType::is_multi_gpu ? push_graph_view.get_number_of_local_adj_matrix_partition_rows()
+                                : vertex_t{0};
+  auto const num_cols =
+    GraphViewType::is_multi_gpu ? push_graph_view.get_number_of_local_adj_matrix_partition_cols()
+                                : vertex_t{0};
+
+  rmm::device_uvector<vertex_t> adj_matrix_row_colors(num_rows, handle.get_stream());
+  rmm::device_uvector<uint8_t> adj_matrix_row_actives(num_rows, handle.get_stream());
+  rmm::device_uvector<vertex_t> adj_matrix_col_colors(num_cols, handle.get_stream());
+  rmm::device_uvector<uint8_t> adj_matrix_col_actives(num_cols, handle.get_stream());
+  rmm::device_uvector<uint32_t> adj_matrix_col_in_degrees(num_cols, handle.get_stream());
+  rmm::device_uvector<vertex_t> adj_matrix_col_in_neighbors(num_cols, handle.get_stream());
+  if (GraphViewType::is_multi_gpu) {
+    copy_to_adj_matrix_row(
+      handle, push_graph_view, colors.begin(), adj_matrix_row_colors.begin());
+    copy_to_adj_matrix_row(
+      handle, push_graph_view, actives.begin(), adj_matrix_row_actives.begin());
+    copy_to_adj_matrix_col(
+      handle, push_graph_view, colors.begin(), adj_matrix_col_colors.begin());
+    copy_to_adj_matrix_col(
+      handle, push_graph_view, actives.begin(), adj_matrix_col_actives.begin());
+  }
+
+  rmm::device_uvector<uint32_t> out_degrees(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> out_neighbors(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<uint32_t> in_degrees(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> in_neighbors(num_local_vertices, handle.get_stream());
+
+  auto in_degree_first =
+    GraphViewType::is_multi_gpu ? adj_matrix_col_in_degrees.data() : in_degrees.data();
+  auto in_neighbor_first =
+    GraphViewType::is_multi_gpu ? adj_matrix_col_in_neighbors.data() : in_neighbors.data();
+  auto in_size = GraphViewType::is_multi_gpu ? static_cast<size_t>(num_cols)
+                                             : static_cast<size_t>(num_local_vertices);
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               in_degree_first,
+               in_degree_first + in_size,
+               uint32_t{0});
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               in_neighbor_first,
+               in_neighbor_first + in_size,
+               invalid_vertex);
+
+  for (size_t i = 0; i < push_graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    matrix_partition_device_t<GraphViewType> matrix_partition(push_graph_view, i);
+
+    auto major_size = GraphViewType::is_multi_gpu ? matrix_partition.get_major_size() : vertex_t{0};
+    rmm::device_uvector<uint32_t> major_out_degrees(major_size, handle.get_stream());
+    rmm::device_uvector<vertex_t> major_out_neighbors(major_size, handle.get_stream());
+
+    if (matrix_partition.get_major_size() > 0) {
+      auto row_value_start_offset = matrix_partition.get_major_value_start_offset();
+      raft::grid_1d_thread_t update_grid(matrix_partition.get_major_size(),
+                                         strongly_connected_components_block_size,
+                                         handle.get_device_properties().maxGridSize[0]);
+      for_all_major_count_active_degrees<<<update_grid.num_blocks,
+                                           update_grid.block_size,
+                                           0,
+                                           handle.get_stream()>>>(
+        matrix_partition,
+        (GraphViewType::is_multi_gpu ? adj_matrix_row_colors.data() : colors.data()) +
+          row_value_start_offset,
+        (GraphViewType::is_multi_gpu ? adj_matrix_row_actives.data() : actives.data()) +
+          row_value_start_offset,
+        GraphViewType::is_multi_gpu ? adj_matrix_col_colors.data() : colors.data(),
+        GraphViewType::is_multi_gpu ? adj_matrix_col_actives.data() : actives.data(),
+        GraphViewType::is_multi_gpu ? major_out_degrees.data() : out_degrees.data(),
+        GraphViewType::is_multi_gpu ? major_out_neighbors.data() : out_neighbors.data(),
+        in_degree_first,
+        in_neighbor_first);
+    }
+
+    if (GraphViewType::is_multi_gpu) {
+      auto &col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+
+      device_reduce(col_comm,
+                    major_out_degrees.begin(),
+                    out_degrees.begin(),
+                    major_out_degrees.size(),
+                    raft::comms::op_t::SUM,
+                    static_cast<int>(i),
+                    handle.get_stream());
+      // if the out-degree is 1, exactly one GPU has a valid neighbor
+      device_reduce(col_comm,
+                    major_out_neighbors.begin(),
+                    out_neighbors.begin(),
+                    major_out_neighbors.size(),
+                    raft::comms::op_t::MIN,
+                    static_cast<int>(i),
+                    handle.get_stream());
+    }
+  }
+
+  if (GraphViewType::is_multi_gpu) {
+    reduce_adj_matrix_col_values(handle,
+                                 push_graph_view,
+                                 adj_matrix_col_in_degrees.data(),
+                                 in_degrees.data(),
+                                 raft::comms::op_t::SUM);
+    reduce_adj_matrix_col_values(handle,
+                                 push_graph_view,
+                                 adj_matrix_col_in_neighbors.data(),
+                                 in_neighbors.data(),
+                                 raft::comms::op_t::MIN);
+  }
+
+  return std::make_tuple(std::move(in_degrees),
+                         std::move(in_neighbors),
+                         std::move(out_degrees),
+                         std::move(out_neighbors));
+}
+
+// remove the vertices of the trivial strongly connected components, trim-1 (a vertex without an
+// incoming or outgoing edge within its color class is a singleton component) is repeated until
+// nothing is trimmed, then trim-2 (two vertices whose only outgoing (or incoming) neighbors within
+// the class are each other form a component) is tried
+template <typename GraphViewType>
+void trim(raft::handle_t const &handle,
+          GraphViewType const &push_graph_view,
+          rmm::device_uvector<typename GraphViewType::vertex_type> const &colors,
+          rmm::device_uvector<uint8_t> &actives,
+          typename GraphViewType::vertex_type *components,
+          rmm::device_uvector<typename GraphViewType::vertex_type> const &vertex_partition_lasts)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto const invalid_vertex     = std::numeric_limits<vertex_t>::max();
+  auto const num_local_vertices = push_graph_view.get_number_of_local_vertices();
+  auto const local_first        = push_graph_view.get_local_vertex_first();
+
+  while (true) {
+    rmm::device_uvector<uint32_t> in_degrees(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> in_neighbors(0, handle.get_stream());
+    rmm::device_uvector<uint32_t> out_degrees(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> out_neighbors(0, handle.get_stream());
+    std::tie(in_degrees, in_neighbors, out_degrees, out_neighbors) =
+      count_active_degrees(handle, push_graph_view, colors, actives);
+
+    // 1. trim-1
+
+    auto num_trimmed = thrust::transform_reduce(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(vertex_t{0}),
+      thrust::make_counting_iterator(num_local_vertices),
+      [actives     = actives.data(),
+       in_degrees  = in_degrees.data(),
+       out_degrees = out_degrees.data(),
+       components,
+       local_first] __device__(auto v_offset) {
+        if (actives[v_offset] && ((in_degrees[v_offset] == 0) || (out_degrees[v_offset] == 0))) {
+          actives[v_offset]    = uint8_t{0};
+          components[v_offset] = local_first + v_offset;
+          return size_t{1};
+        }
+        return size_t{0};
+      },
+      size_t{0},
+      thrust::plus<size_t>());
+    if (GraphViewType::is_multi_gpu) {
+      num_trimmed = host_scalar_allreduce(handle.get_comms(), num_trimmed, handle.get_stream());
+    }
+    if (num_trimmed > 0) { continue; }
+
+    // 2. trim-2 (the unique neighbor of a vertex should have the vertex as its unique neighbor, a
+    // vertex without a unique neighbor looks itself up to keep the lookups in range)
+
+    auto to_unique_neighbor = [] __device__(auto pair) {
+      return thrust::get<0>(pair) == 1 ? thrust::get<1>(pair)
+                                       : std::numeric_limits<vertex_t>::max();
+    };
+    auto in_pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(in_degrees.begin(), in_neighbors.begin()));
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      in_pair_first,
+                      in_pair_first + num_local_vertices,
+                      in_neighbors.begin(),
+                      to_unique_neighbor);
+    auto out_pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(out_degrees.begin(), out_neighbors.begin()));
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      out_pair_first,
+                      out_pair_first + num_local_vertices,
+                      out_neighbors.begin(),
+                      to_unique_neighbor);
+
+    rmm::device_uvector<vertex_t> lookup_vertices(num_local_vertices, handle.get_stream());
+    auto invalid_to_self = [invalid_vertex, local_first] __device__(auto v_offset, auto nbr) {
+      return nbr != invalid_vertex ? nbr : local_first + v_offset;
+    };
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      thrust::make_counting_iterator(vertex_t{0}),
+                      thrust::make_counting_iterator(num_local_vertices),
+                      in_neighbors.begin(),
+                      lookup_vertices.begin(),
+                      invalid_to_self);
+    auto in_neighbors_of_in_neighbors = collect_vertex_values(
+      handle, push_graph_view, in_neighbors.data(), lookup_vertices, vertex_partition_lasts);
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      thrust::make_counting_iterator(vertex_t{0}),
+                      thrust::make_counting_iterator(num_local_vertices),
+                      out_neighbors.begin(),
+                      lookup_vertices.begin(),
+                      invalid_to_self);
+    auto out_neighbors_of_out_neighbors = collect_vertex_values(
+      handle, push_graph_view, out_neighbors.data(), lookup_vertices, vertex_partition_lasts);
+
+    num_trimmed = thrust::transform_reduce(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(vertex_t{0}),
+      thrust::make_counting_iterator(num_local_vertices),
+      [actives                        = actives.data(),
+       in_neighbors                   = in_neighbors.data(),
+       in_neighbors_of_in_neighbors   = in_neighbors_of_in_neighbors.data(),
+       out_neighbors                  = out_neighbors.data(),
+       out_neighbors_of_out_neighbors = out_neighbors_of_out_neighbors.data(),
+       components,
+       invalid_vertex,
+       local_first] __device__(auto v_offset) {
+        auto v       = local_first + v_offset;
+        auto partner = invalid_vertex;
+        if ((in_neighbors[v_offset] != invalid_vertex) &&
+            (in_neighbors_of_in_neighbors[v_offset] == v)) {
+          partner = in_neighbors[v_offset];
+        } else if ((out_neighbors[v_offset] != invalid_vertex) &&
+                   (out_neighbors_of_out_neighbors[v_offset] == v)) {
+          partner = out_neighbors[v_offset];
+        }
+        if (actives[v_offset] && (partner != invalid_vertex)) {
+          actives[v_offset]    = uint8_t{0};
+          components[v_offset] = thrust::min(v, partner);
+          return size_t{1};
+        }
+        return size_t{0};
+      },
+      size_t{0},
+      thrust::plus<size_t>());
+    if (GraphViewType::is_multi_gpu) {
+      num_trimmed = host_scalar_allreduce(handle.get_comms(), num_trimmed, handle.get_stream());
+    }
+    if (num_trimmed == 0) { break; }
+  }
+}
+
+// split the color classes by the parts and set the colors to the smallest active vertex IDs in the
+// new classes (so a vertex is the pivot of its class if its color is its own ID)
+template <typename GraphViewType>
+void update_colors(
+  raft::handle_t const &handle,
+  GraphViewType const &push_graph_view,
+  rmm::device_uvector<uint8_t> const &actives,
+  rmm::device_uvector<uint8_t> const &parts,
+  rmm::device_uvector<typename GraphViewType::vertex_type> &colors,
+  rmm::device_uvector<typename GraphViewType::vertex_type> const &vertex_partition_lasts)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto const num_local_vertices = push_graph_view.get_number_of_local_vertices();
+  auto const local_first        = push_graph_view.get_local_vertex_first();
+
+  auto num_local_actives = static_cast<size_t>(
+    thrust::count(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                  actives.begin(),
+                  actives.end(),
+                  uint8_t{1}));
+
+  rmm::device_uvector<vertex_t> active_offsets(num_local_actives, handle.get_stream());
+  thrust::copy_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                  thrust::make_counting_iterator(vertex_t{0}),
+                  thrust::make_counting_iterator(num_local_vertices),
+                  active_offsets.begin(),
+                  [actives = actives.data()] __device__(auto v_offset) {
+                    return actives[v_offset] == uint8_t{1};
+                  });
+  rmm::device_uvector<int64_t> active_keys(num_local_actives, handle.get_stream());
+  thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    active_offsets.begin(),
+                    active_offsets.end(),
+                    active_keys.begin(),
+                    [colors = colors.data(), parts = parts.data()] __device__(auto v_offset) {
+                      return static_cast<int64_t>(colors[v_offset]) * scc_num_parts +
+                             parts[v_offset];
+                    });
+
+  // 1. find the smallest vertex ID of each class
+
+  rmm::device_uvector<int64_t> keys(active_keys.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> min_vertices(active_keys.size(), handle.get_stream());
+  thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               active_keys.begin(),
+               active_keys.end(),
+               keys.begin());
+  thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    active_offsets.begin(),
+                    active_offsets.end(),
+                    min_vertices.begin(),
+                    [local_first] __device__(auto v_offset) { return local_first + v_offset; });
+
+  auto reduce_by_class = [&handle](rmm::device_uvector<int64_t> &keys,
+                                   rmm::device_uvector<vertex_t> &min_vertices) {
+    thrust::sort_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        keys.begin(),
+                        keys.end(),
+                        min_vertices.begin());
+    rmm::device_uvector<int64_t> unique_keys(keys.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> unique_min_vertices(keys.size(), handle.get_stream());
+    auto num_unique_keys = static_cast<size_t>(thrust::distance(
+      unique_keys.begin(),
+      thrust::get<0>(
+        thrust::reduce_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                              keys.begin(),
+                              keys.end(),
+                              min_vertices.begin(),
+                              unique_keys.begin(),
+                              unique_min_vertices.begin(),
+                              thrust::equal_to<int64_t>(),
+                              thrust::minimum<vertex_t>()))));
+    unique_keys.resize(num_unique_keys, handle.get_stream());
+    unique_min_vertices.resize(num_unique_keys, handle.get_stream());
+    keys         = std::move(unique_keys);
+    min_vertices = std::move(unique_min_vertices);
+  };
+
+  reduce_by_class(keys, min_vertices);
+
+  // 2. update the colors
+
+  rmm::device_uvector<vertex_t> new_colors(0, handle.get_stream());
+  if (GraphViewType::is_multi_gpu) {
+    auto &comm = handle.get_comms();
+
+    auto key_func = class_key_to_gpu_id_t<vertex_t>{
+      vertex_to_gpu_id_t<vertex_t>{vertex_partition_lasts.data(), comm.get_size()}};
+
+    rmm::device_uvector<int64_t> rx_keys(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> rx_min_vertices(0, handle.get_stream());
+    std::tie(rx_keys, rx_min_vertices, std::ignore) = groupby_gpuid_and_shuffle_kv_pairs(
+      comm, keys.begin(), keys.end(), min_vertices.begin(), key_func, handle.get_stream());
+    keys         = std::move(rx_keys);
+    min_vertices = std::move(rx_min_vertices);
+
+    reduce_by_class(keys, min_vertices);
+
+    new_colors = collect_values_for_keys(comm,
+                                         keys.begin(),
+                                         keys.end(),
+                                         min_vertices.begin(),
+                                         active_keys.begin(),
+                                         active_keys.end(),
+                                         key_func,
+                                         handle.get_stream());
+  } else {
+    new_colors.resize(active_keys.size(), handle.get_stream());
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      active_keys.begin(),
+                      active_keys.end(),
+                      new_colors.begin(),
+                      [keys         = keys.data(),
+                       min_vertices = min_vertices.data(),
+                       num_keys     = keys.size()] __device__(auto key) {
+                        return min_vertices[thrust::distance(
+                          keys, thrust::lower_bound(thrust::seq, keys, keys + num_keys, key))];
+                      });
+  }
+
+  thrust::scatter(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                  new_colors.begin(),
+                  new_colors.end(),
+                  active_offsets.begin(),
+                  colors.begin());
+}
+
+// mark the vertices reachable from (forward) or reaching (backward) the pivots within their color
+// classes, reached should store the pivots on entry
+template <bool forward, typename GraphViewType>
+void reach(raft::handle_t const &handle,
+           GraphViewType const &push_graph_view,
+           rmm::device_uvector<typename GraphViewType::vertex_type> const &colors,
+           rmm::device_uvector<uint8_t> const &actives,
+           rmm::device_uvector<uint8_t> &reached)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto const num_local_vertices = push_graph_view.get_number_of_local_vertices();
+  auto const num_rows =
+    GraphViewType::is_multi_gpu ? push_graph_view.get_number_of_local_adj_matrix_partition_rows()
+                                : vertex_t{0};
+  auto const num_cols =
+    GraphViewType::is_multi_gpu ? push_graph_view.get_number_of_local_adj_matrix_partition_cols()
+                                : vertex_t{0};
+
+  rmm::device_uvector<vertex_t> adj_matrix_row_colors(num_rows, handle.get_stream());
+  rmm::device_uvector<uint8_t> adj_matrix_row_actives(forward ? vertex_t{0} : num_rows,
+                                                      handle.get_stream());
+  rmm::device_uvector<uint8_t> adj_matrix_row_reached(num_rows, handle.get_stream());
+  rmm::device_uvector<vertex_t> adj_matrix_col_colors(num_cols, handle.get_stream());
+  rmm::device_uvector<uint8_t> adj_matrix_col_actives(forward ? num_cols : vertex_t{0},
+                                                      handle.get_stream());
+  rmm::device_uvector<uint8_t> adj_matrix_col_reached(num_cols, handle.get_stream());
+  rmm::device_uvector<uint8_t> adj_matrix_col_next(forward ? num_cols : vertex_t{0},
+                                                   handle.get_stream());
+  if (GraphViewType::is_multi_gpu) {
+    copy_to_adj_matrix_row(
+      handle, push_graph_view, colors.begin(), adj_matrix_row_colors.begin());
+    copy_to_adj_matrix_col(
+      handle, push_graph_view, colors.begin(), adj_matrix_col_colors.begin());
+    if (forward) {
+      copy_to_adj_matrix_col(
+        handle, push_graph_view, actives.begin(), adj_matrix_col_actives.begin());
+    } else {
+      copy_to_adj_matrix_row(
+        handle, push_graph_view, actives.begin(), adj_matrix_row_actives.begin());
+    }
+  }
+
+  rmm::device_uvector<uint8_t> next(num_local_vertices, handle.get_stream());
+  while (true) {
+    if (GraphViewType::is_multi_gpu) {
+      copy_to_adj_matrix_row(
+        handle, push_graph_view, reached.begin(), adj_matrix_row_reached.begin());
+      copy_to_adj_matrix_col(
+        handle, push_graph_view, reached.begin(), adj_matrix_col_reached.begin());
+    }
+
+    if (forward) {
+      auto next_first = GraphViewType::is_multi_gpu ? adj_matrix_col_next.data() : next.data();
+      thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   next_first,
+                   next_first + (GraphViewType::is_multi_gpu ? adj_matrix_col_next.size()
+                                                             : next.size()),
+                   uint8_t{0});
+    }
+
+    for (size_t i = 0; i < push_graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      matrix_partition_device_t<GraphViewType> matrix_partition(push_graph_view, i);
+
+      rmm::device_uvector<uint8_t> major_next(
+        (GraphViewType::is_multi_gpu && !forward) ? matrix_partition.get_major_size()
+                                                  : vertex_t{0},
+        handle.get_stream());
+
+      if (matrix_partition.get_major_size() > 0) {
+        auto row_value_start_offset = matrix_partition.get_major_value_start_offset();
+        raft::grid_1d_thread_t update_grid(matrix_partition.get_major_size(),
+                                           strongly_connected_components_block_size,
+                                           handle.get_device_properties().maxGridSize[0]);
+        if (forward) {
+          for_all_major_push_forward_reachability<<<update_grid.num_blocks,
+                                                    update_grid.block_size,
+                                                    0,
+                                                    handle.get_stream()>>>(
+            matrix_partition,
+            (GraphViewType::is_multi_gpu ? adj_matrix_row_colors.data() : colors.data()) +
+              row_value_start_offset,
+            (GraphViewType::is_multi_gpu ? adj_matrix_row_reached.data() : reached.data()) +
+              row_value_start_offset,
+            GraphViewType::is_multi_gpu ? adj_matrix_col_colors.data() : colors.data(),
+            GraphViewType::is_multi_gpu ? adj_matrix_col_actives.data() : actives.data(),
+            GraphViewType::is_multi_gpu ? adj_matrix_col_reached.data() : reached.data(),
+            GraphViewType::is_multi_gpu ? adj_matrix_col_next.data() : next.data());
+        } else {
+          for_all_major_pull_backward_reachability<<<update_grid.num_blocks,
+                                                     update_grid.block_size,
+                                                     0,
+                                                     handle.get_stream()>>>(
+            matrix_partition,
+            (GraphViewType::is_multi_gpu ? adj_matrix_row_colors.data() : colors.data()) +
+              row_value_start_offset,
+            (GraphViewType::is_multi_gpu ? adj_matrix_row_actives.data() : actives.data()) +
+              row_value_start_offset,
+            (GraphViewType::is_multi_gpu ? adj_matrix_row_reached.data() : reached.data()) +
+              row_value_start_offset,
+            GraphViewType::is_multi_gpu ? adj_matrix_col_colors.data() : colors.data(),
+            GraphViewType::is_multi_gpu ? adj_matrix_col_reached.data() : reached.data(),
+            GraphViewType::is_multi_gpu ? major_next.data() : next.data());
+        }
+      }
+
+      if (GraphViewType::is_multi_gpu && !forward) {
+        auto &col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+
+        device_reduce(col_comm,
+                      major_next.begin(),
+                      next.begin(),
+                      major_next.size(),
+                      raft::comms::op_t::MAX,
+                      static_cast<int>(i),
+                      handle.get_stream());
+      }
+    }
+
+    if (GraphViewType::is_multi_gpu && forward) {
+      reduce_adj_matrix_col_values(handle,
+                                   push_graph_view,
+                                   adj_matrix_col_next.data(),
+                                   next.data(),
+                                   raft::comms::op_t::MAX);
+    }
+
+    auto num_newly_reached = thrust::transform_reduce(
+      rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+      thrust::make_counting_iterator(vertex_t{0}),
+      thrust::make_counting_iterator(num_local_vertices),
+      [reached = reached.data(), next = next.data()] __device__(auto v_offset) {
+        if (next[v_offset] && !reached[v_offset]) {
+          reached[v_offset] = uint8_t{1};
+          return size_t{1};
+        }
+        return size_t{0};
+      },
+      size_t{0},
+      thrust::plus<size_t>());
+    if (GraphViewType::is_multi_gpu) {
+      num_newly_reached =
+        host_scalar_allreduce(handle.get_comms(), num_newly_reached, handle.get_stream());
+    }
+    if (num_newly_reached == 0) { break; }
+  }
+}
+
+template <typename GraphViewType>
+void strongly_connected_components(raft::handle_t const &handle,
+                                   GraphViewType const &push_graph_view,
+                                   typename GraphViewType::vertex_type *components,
+                                   bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  auto const num_local_vertices = push_graph_view.get_number_of_local_vertices();
+  auto const local_first        = push_graph_view.get_local_vertex_first();
+
+  // 1. check input arguments
+
+  if (do_expensive_check) {
+    // nothing to do
+  }
+
+  rmm::device_uvector<vertex_t> vertex_partition_lasts(0, handle.get_stream());
+  if (GraphViewType::is_multi_gpu) {
+    auto const comm_size = handle.get_comms().get_size();
+
+    std::vector<vertex_t> h_vertex_partition_lasts(comm_size);
+    for (int i = 0; i < comm_size; ++i) {
+      h_vertex_partition_lasts[i] = push_graph_view.get_vertex_partition_last(i);
+    }
+    vertex_partition_lasts.resize(h_vertex_partition_lasts.size(), handle.get_stream());
+    raft::update_device(vertex_partition_lasts.data(),
+                        h_vertex_partition_lasts.data(),
+                        h_vertex_partition_lasts.size(),
+                        handle.get_stream());
+  }
+
+  // 2. initialize (every vertex is active and in a single color class)
+
+  rmm::device_uvector<vertex_t> colors(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<uint8_t> actives(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<uint8_t> parts(num_local_vertices, handle.get_stream());
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               colors.begin(),
+               colors.end(),
+               vertex_t{0});
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               actives.begin(),
+               actives.end(),
+               uint8_t{1});
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               parts.begin(),
+               parts.end(),
+               scc_part_unreached);
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               components,
+               components + num_local_vertices,
+               std::numeric_limits<vertex_t>::max());
+
+  // 3. trim & forward-backward sweeps (every color class is swept at once from its own pivot)
+
+  rmm::device_uvector<uint8_t> forward_reached(num_local_vertices, handle.get_stream());
+  rmm::device_uvector<uint8_t> backward_reached(num_local_vertices, handle.get_stream());
+  bool first_sweep{true};
+  while (true) {
+    trim(handle, push_graph_view, colors, actives, components, vertex_partition_lasts);
+
+    auto num_actives = static_cast<size_t>(
+      thrust::count(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                    actives.begin(),
+                    actives.end(),
+                    uint8_t{1}));
+    if (GraphViewType::is_multi_gpu) {
+      num_actives = host_scalar_allreduce(handle.get_comms(), num_actives, handle.get_stream());
+    }
+    if (num_actives == 0) { break; }
+
+    // trimming may have removed the pivots
+    update_colors(handle, push_graph_view, actives, parts, colors, vertex_partition_lasts);
+
+    auto is_pivot = [actives = actives.data(), colors = colors.data(), local_first] __device__(
+                      auto v_offset) {
+      return (actives[v_offset] && (colors[v_offset] == local_first + v_offset)) ? uint8_t{1}
+                                                                                 : uint8_t{0};
+    };
+
+    if (first_sweep) {
+      // there is a single color class (of every active vertex) in the first sweep, and every path
+      // from an active vertex to another active vertex visits only active vertices after trimming
+      // (a trimmed vertex is either unreachable from or cannot reach any active vertex), so the
+      // forward sweep can run on the entire graph
+      auto pivot = thrust::transform_reduce(
+        rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+        thrust::make_counting_iterator(vertex_t{0}),
+        thrust::make_counting_iterator(num_local_vertices),
+        [actives = actives.data(), local_first] __device__(auto v_offset) {
+          return actives[v_offset] ? local_first + v_offset : std::numeric_limits<vertex_t>::max();
+        },
+        std::numeric_limits<vertex_t>::max(),
+        thrust::minimum<vertex_t>());
+      if (GraphViewType::is_multi_gpu) {
+        pivot = host_scalar_allreduce(
+          handle.get_comms(), pivot, raft::comms::op_t::MIN, handle.get_stream());
+      }
+
+      rmm::device_uvector<vertex_t> distances(num_local_vertices, handle.get_stream());
+      bfs(handle,
+          push_graph_view,
+          distances.data(),
+          static_cast<vertex_t *>(nullptr),
+          pivot,
+          false,
+          std::numeric_limits<vertex_t>::max(),
+          false);
+      thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        distances.begin(),
+                        distances.end(),
+                        actives.begin(),
+                        forward_reached.begin(),
+                        [] __device__(auto d, auto active) {
+                          return (active && (d != std::numeric_limits<vertex_t>::max()))
+                                   ? uint8_t{1}
+                                   : uint8_t{0};
+                        });
+      first_sweep = false;
+    } else {
+      thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        thrust::make_counting_iterator(vertex_t{0}),
+                        thrust::make_counting_iterator(num_local_vertices),
+                        forward_reached.begin(),
+                        is_pivot);
+      reach<true>(handle, push_graph_view, colors, actives, forward_reached);
+    }
+
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      thrust::make_counting_iterator(vertex_t{0}),
+                      thrust::make_counting_iterator(num_local_vertices),
+                      backward_reached.begin(),
+                      is_pivot);
+    reach<false>(handle, push_graph_view, colors, actives, backward_reached);
+
+    // the vertices reached in both directions form the strongly connected component of the pivot
+    // (the pivot has the smallest vertex ID in the component)
+    thrust::for_each(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     thrust::make_counting_iterator(vertex_t{0}),
+                     thrust::make_counting_iterator(num_local_vertices),
+                     [actives          = actives.data(),
+                      colors           = colors.data(),
+                      parts            = parts.data(),
+                      forward_reached  = forward_reached.data(),
+                      backward_reached = backward_reached.data(),
+                      components] __device__(auto v_offset) {
+                       if (actives[v_offset]) {
+                         if (forward_reached[v_offset] && backward_reached[v_offset]) {
+                           actives[v_offset]    = uint8_t{0};
+                           components[v_offset] = colors[v_offset];
+                         } else if (forward_reached[v_offset]) {
+                           parts[v_offset] = scc_part_forward_only;
+                         } else if (backward_reached[v_offset]) {
+                           parts[v_offset] = scc_part_backward_only;
+                         }
+                       }
+                     });
+
+    // split the color classes (no strongly connected component spans more than one part)
+    update_colors(handle, push_graph_view, actives, parts, colors, vertex_partition_lasts);
+    thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 parts.begin(),
+                 parts.end(),
+                 scc_part_unreached);
+  }
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void strongly_connected_components(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t *components,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS((components != nullptr) || (graph_view.get_number_of_local_vertices() == 0),
+                  "Invalid input argument: components should not be nullptr.");
+
+  detail::strongly_connected_components(handle, graph_view, components, do_expensive_check);
+}
+
+// explicit instantiation
+
+#define INSTANTIATE_STRONGLY_CONNECTED_COMPONENTS(vertex_t, edge_t, weight_t, multi_gpu) \
+  template void strongly_connected_components(                                          \
+    raft::handle_t const &handle,                                                       \
+    graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,       \
+    vertex_t *components,                                                               \
+    bool do_expensive_check);
+
+INSTANTIATE_STRONGLY_CONNECTED_COMPONENTS(int32_t, int32_t, float, true)
+INSTANTIATE_STRONGLY_CONNECTED_COMPONENTS(int32_t, int32_t, double, true)
+INSTANTIATE_STRONGLY_CONNECTED_COMPONENTS(int32_t, int64_t, float, true)
+INSTANTIATE_STRONGLY_CONNECTED_COMPONENTS(int32_t, int64_t, double, true)
+INSTANTIATE_STRONGLY_CONNECTED_COMPONENTS(int64_t, int64_t, float, true)
+INSTANTIATE_STRONGLY_CONNECTED_COMPONENTS(int64_t, int64_t, double, true)
+INSTANTIATE_STRONGLY_CONNECTED_COMPONENTS(int32_t, int32_t, float, false)
+INSTANTIATE_STRONGLY_CONNECTED_COMPONENTS(int32_t, int32_t, double, false)
+INSTANTIATE_STRONGLY_CONNECTED_COMPONENTS(int32_t, int64_t, float, false)
+INSTANTIATE_STRONGLY_CONNECTED_COMPONENTS(int32_t, int64_t, double, false)
+INSTANTIATE_STRONGLY_CONNECTED_COMPONENTS(int64_t, int64_t, float, false)
+INSTANTIATE_STRONGLY_CONNECTED_COMPONENTS(int64_t, int64_t, double, false)
+
+}  // namespace experimental
+}  // namespace cugraph
@@ -0,0 +1,428 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithms.hpp>
+#include <experimental/graph_view.hpp>
+#include <matrix_partition_device.cuh>
+#include <patterns/copy_to_adj_matrix_row_col.cuh>
+#include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+#include <utilities/shuffle_comm.cuh>
+#include "neighbor_intersection.cuh"
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
+
+#include <tuple>
+
+namespace cugraph {
+namespace experimental {
+namespace detail {
+
+// degree ordering: u precedes v if (degree(u), u) < (degree(v), v)
+template <typename vertex_t, typename edge_t>
+__device__ bool precedes(vertex_t u, edge_t u_degree, vertex_t v, edge_t v_degree)
+{
+  return (u_degree < v_degree) || ((u_degree == v_degree) && (u < v));
+}
+
+// flags the (major, minor) pairs to keep in the degree ordered directed graph (DODG), every
+// undirected edge is kept once (oriented from the preceding vertex to the following vertex) and
+// self-loops are dropped
+template <typename GraphViewType>
+struct is_dodg_edge_t {
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  matrix_partition_device_t<GraphViewType> matrix_partition;
+  edge_t const *major_degrees{nullptr};  // adjacency matrix row degrees of this partition
+  edge_t const *minor_degrees{nullptr};  // adjacency matrix col degrees
+
+  __device__ bool operator()(thrust::tuple<vertex_t, vertex_t> e) const
+  {
+    auto major = thrust::get<0>(e);
+    auto minor = thrust::get<1>(e);
+    return precedes(major,
+                    major_degrees[matrix_partition.get_major_offset_from_major_nocheck(major)],
+                    minor,
+                    minor_degrees[matrix_partition.get_minor_offset_from_minor_nocheck(minor)]);
+  }
+};
+
+// every match (w) of the intersection of N+(u) and N+(v) for a DODG edge (u, v) is a triangle
+// counted once, increment the (u, w) edge counter (the (u, v) edge counter is incremented by the
+// intersection size)
+template <typename vertex_t, typename edge_t>
+struct count_triangle_edge_t {
+  neighbor_lists_t<vertex_t, edge_t> first_lists{};
+  edge_t *edge_triangle_counts{nullptr};
+
+  __device__ void operator()(size_t pair_id, edge_t first_list_index) const
+  {
+    atomicAdd(edge_triangle_counts + first_lists.offset(pair_id) + first_list_index, edge_t{1});
+  }
+};
+
+template <typename vertex_t, typename edge_t>
+struct add_vertex_triangle_count_t {
+  edge_t *vertex_triangle_counts{nullptr};
+  vertex_t local_first{};
+  edge_t divisor{1};
+
+  __device__ void operator()(thrust::tuple<vertex_t, edge_t> t) const
+  {
+    vertex_triangle_counts[thrust::get<0>(t) - local_first] += thrust::get<1>(t) / divisor;
+  }
+};
+
+template <typename vertex_t, typename edge_t>
+std::tuple<rmm::device_uvector<vertex_t>, rmm::device_uvector<edge_t>> reduce_by_vertex(
+  raft::handle_t const &handle,
+  rmm::device_uvector<vertex_t> &&vertices,
+  rmm::device_uvector<edge_t> &&values)
+{
+  auto stream = handle.get_stream();
+
+  thrust::sort_by_key(
+    rmm::exec_policy(stream)->on(stream), vertices.begin(), vertices.end(), values.begin());
+  rmm::device_uvector<vertex_t> unique_vertices(vertices.size(), stream);
+  rmm::device_uvector<edge_t> value_sums(values.size(), stream);
+  auto num_uniques = static_cast<size_t>(
+    thrust::distance(unique_vertices.begin(),
+                     thrust::get<0>(thrust::reduce_by_key(rmm::exec_policy(stream)->on(stream),
+                                                          vertices.begin(),
+                                                          vertices.end(),
+                                                          values.begin(),
+                                                          unique_vertices.begin(),
+                                                          value_sums.begin()))));
+  unique_vertices.resize(num_uniques, stream);
+  value_sums.resize(num_uniques, stream);
+  unique_vertices.shrink_to_fit(stream);
+  value_sums.shrink_to_fit(stream);
+
+  return std::make_tuple(std::move(unique_vertices), std::move(value_sums));
+}
+
+// 1. Build the degree ordered directed graph (DODG, each undirected edge is oriented from the
+// vertex with the lower (degree, vertex ID) to the vertex with the higher (degree, vertex ID),
+// this bounds the out-degrees by O(sqrt(E))) on the 2D partitioned local edges, and gather the
+// DODG out-neighbor lists (N+) of the local vertices on the owning GPUs.
+// 2. For every DODG edge (u, v), intersect N+(u) and N+(v) (N+(v) is fetched from the owner of v
+// in multi-GPU), every triangle is found exactly once (at the edge between its two lowest ranked
+// vertices).
+// 3. Per-vertex counts: a triangle (u, v, w) found at (u, v) increments the (u, v) and (u, w) DODG
+// edge counters, u's count is half the sum of its out-edge counters and v's (and w's) count is the
+// sum of its in-edge counters.
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+uint64_t triangle_count(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  edge_t *vertex_triangle_counts)
+{
+  using graph_view_type = graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu>;
+
+  auto stream = handle.get_stream();
+
+  auto const local_first = graph_view.get_local_vertex_first();
+  auto const local_size  = graph_view.get_number_of_local_vertices();
+
+  rmm::device_uvector<vertex_t> d_vertex_partition_lasts(0, stream);
+  vertex_to_gpu_id_t<vertex_t> vertex_to_gpu_id{};
+  if (multi_gpu) {
+    d_vertex_partition_lasts = vertex_partition_lasts(handle, graph_view);
+    vertex_to_gpu_id =
+      vertex_to_gpu_id_t<vertex_t>{d_vertex_partition_lasts.data(), handle.get_comms().get_size()};
+  }
+
+  // 1. build DODG
+
+  rmm::device_uvector<edge_t> offsets_v(0, stream);
+  rmm::device_uvector<vertex_t> indices_v(0, stream);
+  {
+    auto degrees = graph_view.compute_out_degrees(handle);
+    rmm::device_uvector<edge_t> major_degrees(
+      graph_view.get_number_of_local_adj_matrix_partition_rows(), stream);
+    rmm::device_uvector<edge_t> minor_degrees(
+      graph_view.get_number_of_local_adj_matrix_partition_cols(), stream);
+    copy_to_adj_matrix_row(handle, graph_view, degrees.begin(), major_degrees.begin());
+    copy_to_adj_matrix_col(handle, graph_view, degrees.begin(), minor_degrees.begin());
+    degrees.release();
+
+    rmm::device_uvector<vertex_t> majors_v(0, stream);
+    rmm::device_uvector<vertex_t> minors_v(0, stream);
+    std::tie(majors_v, minors_v) = decompress_local_edges(handle, graph_view);
+
+    rmm::device_uvector<bool> dodg_edge_flags(majors_v.size(), stream);
+    size_t edge_displacement{0};
+    for (size_t i = 0; i < graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      matrix_partition_device_t<graph_view_type> matrix_partition(graph_view, i);
+      auto num_partition_edges = graph_view.get_number_of_local_adj_matrix_partition_edges(i);
+      auto edge_first          = thrust::make_zip_iterator(thrust::make_tuple(
+        majors_v.begin() + edge_displacement, minors_v.begin() + edge_displacement));
+      thrust::transform(
+        rmm::exec_policy(stream)->on(stream),
+        edge_first,
+        edge_first + num_partition_edges,
+        dodg_edge_flags.begin() + edge_displacement,
+        is_dodg_edge_t<graph_view_type>{
+          matrix_partition,
+          major_degrees.data() + matrix_partition.get_major_value_start_offset(),
+          minor_degrees.data()});
+      edge_displacement += num_partition_edges;
+    }
+    auto edge_first =
+      thrust::make_zip_iterator(thrust::make_tuple(majors_v.begin(), minors_v.begin()));
+    auto num_dodg_edges = static_cast<size_t>(
+      thrust::distance(edge_first,
+                       thrust::remove_if(rmm::exec_policy(stream)->on(stream),
+                                         edge_first,
+                                         edge_first + majors_v.size(),
+                                         dodg_edge_flags.begin(),
+                                         thrust::logical_not<bool>())));
+    dodg_edge_flags.release();
+    majors_v.resize(num_dodg_edges, stream);
+    minors_v.resize(num_dodg_edges, stream);
+    majors_v.shrink_to_fit(stream);
+    minors_v.shrink_to_fit(stream);
+
+    if (multi_gpu) {
+      std::tie(majors_v, minors_v) = shuffle_edges_to_row_owners(
+        handle, vertex_to_gpu_id, std::move(majors_v), std::move(minors_v));
+    }
+
+    // multi-edges are removed to count each triangle once
+    std::tie(offsets_v, indices_v) = compress_edgelist<edge_t>(
+      handle, std::move(majors_v), std::move(minors_v), local_first, local_size, true);
+  }
+
+  // 2. intersect N+(u) and N+(v) for every DODG edge (u, v)
+
+  auto num_dodg_edges = indices_v.size();
+
+  rmm::device_uvector<vertex_t> firsts_v(num_dodg_edges, stream);  // u - local_first
+  thrust::upper_bound(rmm::exec_policy(stream)->on(stream),
+                      offsets_v.begin() + 1,
+                      offsets_v.end(),
+                      thrust::make_counting_iterator(edge_t{0}),
+                      thrust::make_counting_iterator(static_cast<edge_t>(num_dodg_edges)),
+                      firsts_v.begin());
+
+  rmm::device_uvector<vertex_t> seconds_v(num_dodg_edges, stream);
+  thrust::copy(
+    rmm::exec_policy(stream)->on(stream), indices_v.begin(), indices_v.end(), seconds_v.begin());
+
+  rmm::device_uvector<edge_t> remote_offsets_v(0, stream);
+  rmm::device_uvector<vertex_t> remote_indices_v(0, stream);
+  if (multi_gpu) {
+    std::tie(remote_offsets_v, remote_indices_v) = gather_neighbor_lists(handle,
+                                                                         vertex_to_gpu_id,
+                                                                         local_first,
+                                                                         offsets_v,
+                                                                         indices_v,
+                                                                         seconds_v.data(),
+                                                                         seconds_v.size());
+  }
+
+  neighbor_lists_t<vertex_t, edge_t> first_lists{
+    offsets_v.data(), indices_v.data(), firsts_v.data()};
+  neighbor_lists_t<vertex_t, edge_t> second_lists{
+    multi_gpu ? remote_offsets_v.data() : offsets_v.data(),
+    multi_gpu ? remote_indices_v.data() : indices_v.data(),
+    seconds_v.data()};
+
+  rmm::device_uvector<edge_t> intersection_sizes_v(num_dodg_edges, stream);
+  rmm::device_uvector<edge_t> edge_triangle_counts_v(
+    vertex_triangle_counts != nullptr ? num_dodg_edges : size_t{0}, stream);
+  if (vertex_triangle_counts != nullptr) {
+    thrust::fill(rmm::exec_policy(stream)->on(stream),
+                 edge_triangle_counts_v.begin(),
+                 edge_triangle_counts_v.end(),
+                 edge_t{0});
+    compute_intersection_sizes(
+      handle,
+      first_lists,
+      second_lists,
+      num_dodg_edges,
+      intersection_sizes_v.data(),
+      count_triangle_edge_t<vertex_t, edge_t>{first_lists, edge_triangle_counts_v.data()});
+  } else {
+    compute_intersection_sizes(
+      handle, first_lists, second_lists, num_dodg_edges, intersection_sizes_v.data());
+  }
+
+  auto num_triangles = thrust::transform_reduce(
+    rmm::exec_policy(stream)->on(stream),
+    intersection_sizes_v.begin(),
+    intersection_sizes_v.end(),
+    [] __device__(auto size) { return static_cast<uint64_t>(size); },
+    uint64_t{0},
+    thrust::plus<uint64_t>());
+  if (multi_gpu) {
+    num_triangles = host_scalar_allreduce(handle.get_comms(), num_triangles, stream);
+  }
+
+  // 3. per-vertex triangle counts
+
+  if (vertex_triangle_counts != nullptr) {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      edge_triangle_counts_v.begin(),
+                      edge_triangle_counts_v.end(),
+                      intersection_sizes_v.begin(),
+                      edge_triangle_counts_v.begin(),
+                      thrust::plus<edge_t>());
+    intersection_sizes_v.release();
+    remote_offsets_v.release();
+    remote_indices_v.release();
+
+    thrust::fill(rmm::exec_policy(stream)->on(stream),
+                 vertex_triangle_counts,
+                 vertex_triangle_counts + local_size,
+                 edge_t{0});
+
+    {
+      // firsts_v is sorted
+      rmm::device_uvector<vertex_t> unique_firsts_v(num_dodg_edges, stream);
+      rmm::device_uvector<edge_t> out_edge_count_sums_v(num_dodg_edges, stream);
+      auto num_unique_firsts = static_cast<size_t>(thrust::distance(
+        unique_firsts_v.begin(),
+        thrust::get<0>(thrust::reduce_by_key(rmm::exec_policy(stream)->on(stream),
+                                             firsts_v.begin(),
+                                             firsts_v.end(),
+                                             edge_triangle_counts_v.begin(),
+                                             unique_firsts_v.begin(),
+                                             out_edge_count_sums_v.begin()))));
+      auto pair_first = thrust::make_zip_iterator(
+        thrust::make_tuple(unique_firsts_v.begin(), out_edge_count_sums_v.begin()));
+      thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                       pair_first,
+                       pair_first + num_unique_firsts,
+                       add_vertex_triangle_count_t<vertex_t, edge_t>{
+                         vertex_triangle_counts, vertex_t{0}, edge_t{2}});
+    }
+    firsts_v.release();
+    seconds_v.release();
+
+    rmm::device_uvector<vertex_t> in_vertices_v(0, stream);
+    rmm::device_uvector<edge_t> in_edge_count_sums_v(0, stream);
+    std::tie(in_vertices_v, in_edge_count_sums_v) =
+      reduce_by_vertex(handle, std::move(indices_v), std::move(edge_triangle_counts_v));
+    if (multi_gpu) {
+      auto pair_first = thrust::make_zip_iterator(
+        thrust::make_tuple(in_vertices_v.begin(), in_edge_count_sums_v.begin()));
+      std::forward_as_tuple(std::tie(in_vertices_v, in_edge_count_sums_v), std::ignore) =
+        groupby_gpuid_and_shuffle_values(
+          handle.get_comms(),
+          pair_first,
+          pair_first + in_vertices_v.size(),
+          first_element_to_gpu_id_t<vertex_t, thrust::tuple<vertex_t, edge_t>>{vertex_to_gpu_id},
+          stream);
+      std::tie(in_vertices_v, in_edge_count_sums_v) =
+        reduce_by_vertex(handle, std::move(in_vertices_v), std::move(in_edge_count_sums_v));
+    }
+    auto pair_first = thrust::make_zip_iterator(
+      thrust::make_tuple(in_vertices_v.begin(), in_edge_count_sums_v.begin()));
+    thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                     pair_first,
+                     pair_first + in_vertices_v.size(),
+                     add_vertex_triangle_count_t<vertex_t, edge_t>{
+                       vertex_triangle_counts, local_first, edge_t{1}});
+  }
+
+  return num_triangles;
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+uint64_t triangle_count(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  edge_t *vertex_triangle_counts)
+{
+  CUGRAPH_EXPECTS(graph_view.is_symmetric(),
+                  "Invalid input argument: triangle_count requires a symmetric graph.");
+
+  return detail::triangle_count(handle, graph_view, vertex_triangle_counts);
+}
+
+// explicit instantiation
+
+template uint64_t triangle_count(raft::handle_t const &handle,
+                                 graph_view_t<int32_t, int32_t, float, false, true> const &,
+                                 int32_t *);
+
+template uint64_t triangle_count(raft::handle_t const &handle,
+                                 graph_view_t<int32_t, int32_t, double, false, true> const &,
+                                 int32_t *);
+
+template uint64_t triangle_count(raft::handle_t const &handle,
+                                 graph_view_t<int32_t, int64_t, float, false, true> const &,
+                                 int64_t *);
+
+template uint64_t triangle_count(raft::handle_t const &handle,
+                                 graph_view_t<int32_t, int64_t, double, false, true> const &,
+                                 int64_t *);
+
+template uint64_t triangle_count(raft::handle_t const &handle,
+                                 graph_view_t<int64_t, int64_t, float, false, true> const &,
+                                 int64_t *);
+
+template uint64_t triangle_count(raft::handle_t const &handle,
+                                 graph_view_t<int64_t, int64_t, double, false, true> const &,
+                                 int64_t *);
+
+template uint64_t triangle_count(raft::handle_t const &handle,
+                                 graph_view_t<int32_t, int32_t, float, false, false> const &,
+                                 int32_t *);
+
+template uint64_t triangle_count(raft::handle_t const &handle,
+                                 graph_view_t<int32_t, int32_t, double, false, false> const &,
+                                 int32_t *);
+
+template uint64_t triangle_count(raft::handle_t const &handle,
+                                 graph_view_t<int32_t, int64_t, float, false, false> const &,
+                                 int64_t *);
+
+template uint64_t triangle_count(raft::handle_t const &handle,
+                                 graph_view_t<int32_t, int64_t, double, false, false> const &,
+                                 int64_t *);
+
+template uint64_t triangle_count(raft::handle_t const &handle,
+                                 graph_view_t<int64_t, int64_t, float, false, false> const &,
+                                 int64_t *);
+
+template uint64_t triangle_count(raft::handle_t const &handle,
+                                 graph_view_t<int64_t, int64_t, double, false, false> const &,
+                                 int64_t *);
+
+}  // namespace experimental
+}  // namespace cugraph
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <experimental/detail/graph_utils.cuh>
+#include <experimental/graph.hpp>
+#include <patterns/copy_to_adj_matrix_row_col.cuh>
+#include <patterns/copy_v_transform_reduce_in_out_nbr.cuh>
+#include <patterns/count_if_v.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <cuco/detail/hash_functions.cuh>
+
+#include <tuple>
+
+namespace cugraph {
+namespace experimental {
+
+namespace detail {
+
+// Jones-Plassmann priorities (random but deterministic, ties are broken by vertex IDs)
+template <typename vertex_t>
+__device__ bool has_higher_coloring_priority(vertex_t lhs, vertex_t rhs)
+{
+  cuco::detail::MurmurHash3_32<vertex_t> hash_func{};
+  auto lhs_hash = hash_func(lhs);
+  auto rhs_hash = hash_func(rhs);
+  return (lhs_hash > rhs_hash) || ((lhs_hash == rhs_hash) && (lhs > rhs));
+}
+
+}  // namespace detail
+
+/**
+ * @brief Compute a distance-1 vertex coloring (Jones-Plassmann).
+ *
+ * In every round, an uncolored vertex takes the round number as its color if it has the highest
+ * (hashed) priority among its uncolored neighbors, so every color class is an independent set.
+ * The vertices in a color class can be updated simultaneously without neighbor conflicts (e.g.
+ * Louvain vertex moves, MIS, matching).
+ *
+ * @tparam GraphViewType Type of the passed non-owning graph object. The graph should be symmetric
+ * (only out-going edges are checked for conflicts).
+ * @param handle RAFT handle object to encapsulate resources (e.g. CUDA stream, communicator, and
+ * handles to various CUDA libraries) to run graph algorithms.
+ * @param graph_view Non-owning graph object.
+ * @return std::tuple<rmm::device_uvector<vertex_t>, vertex_t> Tuple of the colors of the local
+ * vertices and the number of colors (aggregated over the entire set of GPUs in multi-GPU). Colors
+ * are in [0, number of colors).
+ */
+template <typename GraphViewType>
+std::tuple<rmm::device_uvector<typename GraphViewType::vertex_type>,
+           typename GraphViewType::vertex_type>
+vertex_coloring(raft::handle_t const &handle, GraphViewType const &graph_view)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto constexpr invalid_color = invalid_vertex_id<vertex_t>::value;
+
+  rmm::device_uvector<vertex_t> colors(graph_view.get_number_of_local_vertices(),
+                                       handle.get_stream());
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               colors.begin(),
+               colors.end(),
+               invalid_color);
+
+  rmm::device_uvector<vertex_t> adj_matrix_row_colors(
+    GraphViewType::is_multi_gpu ? graph_view.get_number_of_local_adj_matrix_partition_rows()
+                                : vertex_t{0},
+    handle.get_stream());
+  rmm::device_uvector<vertex_t> adj_matrix_col_colors(
+    GraphViewType::is_multi_gpu ? graph_view.get_number_of_local_adj_matrix_partition_cols()
+                                : vertex_t{0},
+    handle.get_stream());
+  rmm::device_uvector<vertex_t> num_higher_priority_uncolored_nbrs(colors.size(),
+                                                                   handle.get_stream());
+
+  vertex_t color{0};
+  while (true) {
+    auto num_uncolored_vertices =
+      count_if_v(handle, graph_view, colors.begin(), [invalid_color] __device__(auto c) {
+        return c == invalid_color;
+      });
+    if (num_uncolored_vertices == 0) { break; }
+
+    if (GraphViewType::is_multi_gpu) {
+      copy_to_adj_matrix_row(handle, graph_view, colors.begin(), adj_matrix_row_colors.begin());
+      copy_to_adj_matrix_col(handle, graph_view, colors.begin(), adj_matrix_col_colors.begin());
+    }
+
+    copy_v_transform_reduce_out_nbr(
+      handle,
+      graph_view,
+      GraphViewType::is_multi_gpu ? adj_matrix_row_colors.begin() : colors.begin(),
+      GraphViewType::is_multi_gpu ? adj_matrix_col_colors.begin() : colors.begin(),
+      [invalid_color] __device__(
+        vertex_t src, vertex_t dst, weight_t w, vertex_t src_color, vertex_t dst_color) {
+        return ((src_color == invalid_color) && (dst_color == invalid_color) && (src != dst) &&
+                detail::has_higher_coloring_priority(dst, src))
+                 ? vertex_t{1}
+                 : vertex_t{0};
+      },
+      vertex_t{0},
+      num_higher_priority_uncolored_nbrs.begin());
+
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      colors.begin(),
+                      colors.end(),
+                      num_higher_priority_uncolored_nbrs.begin(),
+                      colors.begin(),
+                      [invalid_color, color] __device__(auto c, auto num_nbrs) {
+                        return ((c == invalid_color) && (num_nbrs == vertex_t{0})) ? color : c;
+                      });
+
+    ++color;
+  }
+
+  return std::make_tuple(std::move(colors), color);
+}
+
+}  // namespace experimental
+}  // namespace cugraph
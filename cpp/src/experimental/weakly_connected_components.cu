@@ -0,0 +1,597 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithms.hpp>
+#include <experimental/detail/graph_utils.cuh>
+#include <experimental/graph_view.hpp>
+#include <matrix_partition_device.cuh>
+#include <partition_manager.hpp>
+#include <patterns/copy_to_adj_matrix_row_col.cuh>
+#include <utilities/collect_comm.cuh>
+#include <utilities/device_comm.cuh>
+#include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+#include <utilities/shuffle_comm.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/extrema.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+namespace detail {
+
+// FIXME: block size requires tuning
+int32_t constexpr weakly_connected_components_block_size = 512;
+
+// number of the neighbor sampling rounds (each round links every vertex with one of its neighbors)
+size_t constexpr weakly_connected_components_num_neighbor_samples = 2;
+
+// number of the vertices (in total) sampled to find the largest intermediate component
+size_t constexpr weakly_connected_components_num_label_samples = 1024;
+
+__device__ inline void atomic_min(int32_t *addr, int32_t val) { atomicMin(addr, val); }
+
+// vertex IDs are non-negative, so the unsigned comparison preserves the order
+__device__ inline void atomic_min(int64_t *addr, int64_t val)
+{
+  atomicMin(reinterpret_cast<unsigned long long int *>(addr),
+            static_cast<unsigned long long int>(val));
+}
+
+// Each thread takes one major vertex (skipped if its label is skip_label) and finds hooking
+// candidates over the local edges in [edge_offset_first, edge_offset_last) of the major vertex; a
+// vertex whose label is larger than its neighbor's label takes the neighbor's label as a candidate
+// (for both the major and the minor sides).
+template <typename GraphViewType>
+__global__ void for_all_major_find_hook_candidates(
+  matrix_partition_device_t<GraphViewType> matrix_partition,
+  typename GraphViewType::vertex_type const *row_label_first,
+  typename GraphViewType::vertex_type const *col_label_first,
+  typename GraphViewType::vertex_type *major_candidate_first,
+  typename GraphViewType::vertex_type *minor_candidate_first,
+  typename GraphViewType::edge_type edge_offset_first,
+  typename GraphViewType::edge_type edge_offset_last,
+  typename GraphViewType::vertex_type skip_label)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+  using weight_t = typename GraphViewType::weight_type;
+
+  auto const invalid_label = std::numeric_limits<vertex_t>::max();
+  auto idx                 = static_cast<size_t>(threadIdx.x + blockIdx.x * blockDim.x);
+
+  // FIXME: thread per major vertex suffers from load imbalance on high degree vertices; the hot
+  // path is the neighbor sampling rounds (one edge per vertex) and the final round skips the
+  // (typically high degree) vertices in the largest component.
+  while (idx < static_cast<size_t>(matrix_partition.get_major_size())) {
+    auto major_label = row_label_first[idx];
+    if (major_label != skip_label) {
+      minor_index_iterator_t<vertex_t, edge_t> indices{};
+      weight_t const *weights{nullptr};
+      edge_t local_degree{};
+      thrust::tie(indices, weights, local_degree) =
+        matrix_partition.get_local_edges(static_cast<vertex_t>(idx));
+      auto min_label = invalid_label;
+      for (auto i = edge_offset_first; i < thrust::min(local_degree, edge_offset_last); ++i) {
+        auto minor_offset = matrix_partition.get_minor_offset_from_minor_nocheck(indices[i]);
+        auto minor_label  = col_label_first[minor_offset];
+        if (minor_label < major_label) {
+          min_label = thrust::min(min_label, minor_label);
+        } else if (minor_label > major_label) {
+          atomic_min(minor_candidate_first + minor_offset, major_label);
+        }
+      }
+      if (min_label < major_label) { atomic_min(major_candidate_first + idx, min_label); }
+    }
+    idx += gridDim.x * blockDim.x;
+  }
+}
+
+// link the roots of the components connected by the edges in [edge_offset_first, edge_offset_last)
+// of every major vertex whose label is not skip_label; components should store root labels on
+// entry, return the (global) number of the vertices with a hooking candidate
+template <typename GraphViewType>
+size_t hook(raft::handle_t const &handle,
+            GraphViewType const &push_graph_view,
+            typename GraphViewType::vertex_type *components,
+            typename GraphViewType::edge_type edge_offset_first,
+            typename GraphViewType::edge_type edge_offset_last,
+            typename GraphViewType::vertex_type skip_label,
+            rmm::device_uvector<typename GraphViewType::vertex_type> const &vertex_partition_lasts)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto const invalid_label      = std::numeric_limits<vertex_t>::max();
+  auto const num_local_vertices = push_graph_view.get_number_of_local_vertices();
+
+  rmm::device_uvector<vertex_t> adj_matrix_row_components(
+    GraphViewType::is_multi_gpu ? push_graph_view.get_number_of_local_adj_matrix_partition_rows()
+                                : vertex_t{0},
+    handle.get_stream());
+  rmm::device_uvector<vertex_t> adj_matrix_col_components(
+    GraphViewType::is_multi_gpu ? push_graph_view.get_number_of_local_adj_matrix_partition_cols()
+                                : vertex_t{0},
+    handle.get_stream());
+  rmm::device_uvector<vertex_t> adj_matrix_col_candidates(adj_matrix_col_components.size(),
+                                                          handle.get_stream());
+  if (GraphViewType::is_multi_gpu) {
+    copy_to_adj_matrix_row(
+      handle, push_graph_view, components, adj_matrix_row_components.begin());
+    copy_to_adj_matrix_col(
+      handle, push_graph_view, components, adj_matrix_col_components.begin());
+    thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 adj_matrix_col_candidates.begin(),
+                 adj_matrix_col_candidates.end(),
+                 invalid_label);
+  }
+
+  rmm::device_uvector<vertex_t> candidates(num_local_vertices, handle.get_stream());
+  thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               candidates.begin(),
+               candidates.end(),
+               invalid_label);
+
+  // 1. find the hooking candidates
+
+  for (size_t i = 0; i < push_graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+    matrix_partition_device_t<GraphViewType> matrix_partition(push_graph_view, i);
+
+    rmm::device_uvector<vertex_t> major_candidates(
+      GraphViewType::is_multi_gpu ? matrix_partition.get_major_size() : vertex_t{0},
+      handle.get_stream());
+    if (GraphViewType::is_multi_gpu) {
+      thrust::fill(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   major_candidates.begin(),
+                   major_candidates.end(),
+                   invalid_label);
+    }
+
+    if (matrix_partition.get_major_size() > 0) {
+      raft::grid_1d_thread_t update_grid(matrix_partition.get_major_size(),
+                                         weakly_connected_components_block_size,
+                                         handle.get_device_properties().maxGridSize[0]);
+      for_all_major_find_hook_candidates<<<update_grid.num_blocks,
+                                           update_grid.block_size,
+                                           0,
+                                           handle.get_stream()>>>(
+        matrix_partition,
+        (GraphViewType::is_multi_gpu ? adj_matrix_row_components.data() : components) +
+          matrix_partition.get_major_value_start_offset(),
+        GraphViewType::is_multi_gpu ? adj_matrix_col_components.data() : components,
+        GraphViewType::is_multi_gpu ? major_candidates.data() : candidates.data(),
+        GraphViewType::is_multi_gpu ? adj_matrix_col_candidates.data() : candidates.data(),
+        edge_offset_first,
+        edge_offset_last,
+        skip_label);
+    }
+
+    if (GraphViewType::is_multi_gpu) {
+      auto &col_comm = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+
+      // candidates is not yet updated by any other reduction, so reduce directly to candidates
+      device_reduce(col_comm,
+                    major_candidates.begin(),
+                    candidates.begin(),
+                    major_candidates.size(),
+                    raft::comms::op_t::MIN,
+                    static_cast<int>(i),
+                    handle.get_stream());
+    }
+  }
+
+  if (GraphViewType::is_multi_gpu) {
+    auto &row_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().row_name());
+    auto const row_comm_size = row_comm.get_size();
+    auto &col_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
+    auto const col_comm_rank = col_comm.get_rank();
+
+    rmm::device_uvector<vertex_t> minor_candidates(num_local_vertices, handle.get_stream());
+    for (int i = 0; i < row_comm_size; ++i) {
+      auto offset = (push_graph_view.get_vertex_partition_first(col_comm_rank * row_comm_size + i) -
+                     push_graph_view.get_vertex_partition_first(col_comm_rank * row_comm_size));
+      device_reduce(row_comm,
+                    adj_matrix_col_candidates.begin() + offset,
+                    minor_candidates.begin(),
+                    static_cast<size_t>(
+                      push_graph_view.get_vertex_partition_size(col_comm_rank * row_comm_size + i)),
+                    raft::comms::op_t::MIN,
+                    i,
+                    handle.get_stream());
+    }
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      candidates.begin(),
+                      candidates.end(),
+                      minor_candidates.begin(),
+                      candidates.begin(),
+                      thrust::minimum<vertex_t>());
+  }
+
+  // 2. hook (the root of a vertex with a candidate to the candidate, the smallest candidate wins)
+
+  auto pair_first = thrust::make_zip_iterator(thrust::make_tuple(components, candidates.begin()));
+  auto has_candidate = [] __device__(auto pair) {
+    return thrust::get<1>(pair) < thrust::get<0>(pair);
+  };
+  auto num_pairs     = static_cast<size_t>(
+    thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     pair_first,
+                     pair_first + num_local_vertices,
+                     has_candidate));
+  rmm::device_uvector<vertex_t> roots(num_pairs, handle.get_stream());
+  rmm::device_uvector<vertex_t> new_parents(num_pairs, handle.get_stream());
+  thrust::copy_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                  pair_first,
+                  pair_first + num_local_vertices,
+                  thrust::make_zip_iterator(thrust::make_tuple(roots.begin(), new_parents.begin())),
+                  has_candidate);
+
+  if (GraphViewType::is_multi_gpu) {
+    auto &comm = handle.get_comms();
+
+    rmm::device_uvector<vertex_t> rx_roots(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> rx_new_parents(0, handle.get_stream());
+    std::tie(rx_roots, rx_new_parents, std::ignore) = groupby_gpuid_and_shuffle_kv_pairs(
+      comm,
+      roots.begin(),
+      roots.end(),
+      new_parents.begin(),
+      vertex_to_gpu_id_t<vertex_t>{vertex_partition_lasts.data(), comm.get_size()},
+      handle.get_stream());
+    roots       = std::move(rx_roots);
+    new_parents = std::move(rx_new_parents);
+  }
+
+  thrust::for_each(
+    rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+    thrust::make_zip_iterator(thrust::make_tuple(roots.begin(), new_parents.begin())),
+    thrust::make_zip_iterator(thrust::make_tuple(roots.end(), new_parents.end())),
+    [components, local_first = push_graph_view.get_local_vertex_first()] __device__(auto pair) {
+      atomic_min(components + (thrust::get<0>(pair) - local_first), thrust::get<1>(pair));
+    });
+
+  if (GraphViewType::is_multi_gpu) {
+    num_pairs = host_scalar_allreduce(handle.get_comms(), num_pairs, handle.get_stream());
+  }
+
+  return num_pairs;
+}
+
+// pointer jumping until every vertex points to the root of its tree
+template <typename GraphViewType>
+void compress(raft::handle_t const &handle,
+              GraphViewType const &push_graph_view,
+              typename GraphViewType::vertex_type *components,
+              rmm::device_uvector<typename GraphViewType::vertex_type> const
+                &vertex_partition_lasts)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto const num_local_vertices = push_graph_view.get_number_of_local_vertices();
+  auto const local_first        = push_graph_view.get_local_vertex_first();
+
+  while (true) {
+    rmm::device_uvector<vertex_t> grandparents(0, handle.get_stream());
+    if (GraphViewType::is_multi_gpu) {
+      auto &comm = handle.get_comms();
+
+      // FIXME: this rebuilds the (local vertex, parent) map in every iteration, we may restrict the
+      // lookups to the vertices whose parents are not roots
+      grandparents = collect_values_for_keys(
+        comm,
+        thrust::make_counting_iterator(local_first),
+        thrust::make_counting_iterator(push_graph_view.get_local_vertex_last()),
+        components,
+        components,
+        components + num_local_vertices,
+        vertex_to_gpu_id_t<vertex_t>{vertex_partition_lasts.data(), comm.get_size()},
+        handle.get_stream());
+    } else {
+      grandparents.resize(num_local_vertices, handle.get_stream());
+      thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                        components,
+                        components + num_local_vertices,
+                        grandparents.begin(),
+                        [components] __device__(auto parent) { return components[parent]; });
+    }
+
+    auto pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(components, grandparents.begin()));
+    auto num_updates = static_cast<size_t>(
+      thrust::count_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                       pair_first,
+                       pair_first + num_local_vertices,
+                       [] __device__(auto pair) {
+                         return thrust::get<0>(pair) != thrust::get<1>(pair);
+                       }));
+    if (GraphViewType::is_multi_gpu) {
+      num_updates = host_scalar_allreduce(handle.get_comms(), num_updates, handle.get_stream());
+    }
+    if (num_updates == 0) { break; }
+
+    thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                 grandparents.begin(),
+                 grandparents.end(),
+                 components);
+  }
+}
+
+// find the most frequent label among the sampled vertices (every GPU returns the same label)
+template <typename GraphViewType>
+typename GraphViewType::vertex_type find_largest_component_label(
+  raft::handle_t const &handle,
+  GraphViewType const &push_graph_view,
+  typename GraphViewType::vertex_type const *components)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+
+  auto const num_local_vertices = push_graph_view.get_number_of_local_vertices();
+  auto const comm_size = GraphViewType::is_multi_gpu ? handle.get_comms().get_size() : int{1};
+
+  auto num_local_samples = std::min(
+    static_cast<size_t>(num_local_vertices),
+    (weakly_connected_components_num_label_samples + static_cast<size_t>(comm_size) - 1) /
+      static_cast<size_t>(comm_size));
+  rmm::device_uvector<vertex_t> sampled_labels(num_local_samples, handle.get_stream());
+  if (num_local_samples > 0) {
+    auto stride = static_cast<size_t>(num_local_vertices) / num_local_samples;
+    thrust::transform(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(num_local_samples),
+                      sampled_labels.begin(),
+                      [components, stride] __device__(auto i) { return components[i * stride]; });
+  }
+
+  if (GraphViewType::is_multi_gpu) {
+    auto &comm = handle.get_comms();
+
+    auto rx_counts = host_scalar_allgather(comm, num_local_samples, handle.get_stream());
+    std::vector<size_t> displacements(rx_counts.size(), size_t{0});
+    std::partial_sum(rx_counts.begin(), rx_counts.end() - 1, displacements.begin() + 1);
+    rmm::device_uvector<vertex_t> rx_sampled_labels(displacements.back() + rx_counts.back(),
+                                                    handle.get_stream());
+    device_allgatherv(comm,
+                      sampled_labels.data(),
+                      rx_sampled_labels.data(),
+                      rx_counts,
+                      displacements,
+                      handle.get_stream());
+    sampled_labels = std::move(rx_sampled_labels);
+  }
+
+  if (sampled_labels.size() == 0) { return std::numeric_limits<vertex_t>::max(); }
+
+  thrust::sort(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               sampled_labels.begin(),
+               sampled_labels.end());
+  rmm::device_uvector<vertex_t> unique_labels(sampled_labels.size(), handle.get_stream());
+  rmm::device_uvector<size_t> label_counts(unique_labels.size(), handle.get_stream());
+  auto num_unique_labels = static_cast<size_t>(thrust::distance(
+    unique_labels.begin(),
+    thrust::get<0>(
+      thrust::reduce_by_key(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                            sampled_labels.begin(),
+                            sampled_labels.end(),
+                            thrust::make_constant_iterator(size_t{1}),
+                            unique_labels.begin(),
+                            label_counts.begin()))));
+  auto max_it = thrust::max_element(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                                    label_counts.begin(),
+                                    label_counts.begin() + num_unique_labels);
+
+  vertex_t largest_label{};
+  raft::update_host(&largest_label,
+                    unique_labels.data() + thrust::distance(label_counts.begin(), max_it),
+                    size_t{1},
+                    handle.get_stream());
+  CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+  return largest_label;
+}
+
+template <typename GraphViewType>
+void weakly_connected_components(raft::handle_t const &handle,
+                                 GraphViewType const &push_graph_view,
+                                 typename GraphViewType::vertex_type *components,
+                                 bool do_expensive_check)
+{
+  using vertex_t = typename GraphViewType::vertex_type;
+  using edge_t   = typename GraphViewType::edge_type;
+
+  static_assert(std::is_integral<vertex_t>::value,
+                "GraphViewType::vertex_type should be integral.");
+  static_assert(!GraphViewType::is_adj_matrix_transposed,
+                "GraphViewType should support the push model.");
+
+  // 1. check input arguments
+
+  CUGRAPH_EXPECTS(
+    push_graph_view.is_symmetric(),
+    "Invalid input argument: weakly_connected_components requires a symmetric graph.");
+
+  if (do_expensive_check) {
+    // FIXME: check whether the graph is really symmetric (the graph property is not verified)
+  }
+
+  rmm::device_uvector<vertex_t> vertex_partition_lasts(0, handle.get_stream());
+  if (GraphViewType::is_multi_gpu) {
+    auto const comm_size = handle.get_comms().get_size();
+
+    std::vector<vertex_t> h_vertex_partition_lasts(comm_size);
+    for (int i = 0; i < comm_size; ++i) {
+      h_vertex_partition_lasts[i] = push_graph_view.get_vertex_partition_last(i);
+    }
+    vertex_partition_lasts.resize(h_vertex_partition_lasts.size(), handle.get_stream());
+    raft::update_device(vertex_partition_lasts.data(),
+                        h_vertex_partition_lasts.data(),
+                        h_vertex_partition_lasts.size(),
+                        handle.get_stream());
+  }
+
+  // 2. initialize (every vertex is the root of its own tree)
+
+  thrust::sequence(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                   components,
+                   components + push_graph_view.get_number_of_local_vertices(),
+                   push_graph_view.get_local_vertex_first());
+
+  // 3. neighbor sampling rounds (link every vertex with its i'th local neighbor)
+
+  auto const no_skip_label = std::numeric_limits<vertex_t>::max();
+  for (size_t i = 0; i < weakly_connected_components_num_neighbor_samples; ++i) {
+    hook(handle,
+         push_graph_view,
+         components,
+         static_cast<edge_t>(i),
+         static_cast<edge_t>(i + 1),
+         no_skip_label,
+         vertex_partition_lasts);
+    compress(handle, push_graph_view, components, vertex_partition_lasts);
+  }
+
+  // 4. link over every edge skipping the vertices in the (likely) largest component, this is valid
+  // as the graph is symmetric (an edge between a vertex in the largest component and a vertex
+  // outside is visited from the vertex outside); the sampled edges are revisited as some links in
+  // the sampling rounds may have been lost to a smaller candidate
+
+  auto skip_label = find_largest_component_label(handle, push_graph_view, components);
+  while (true) {
+    auto num_hooks = hook(handle,
+                          push_graph_view,
+                          components,
+                          edge_t{0},
+                          std::numeric_limits<edge_t>::max(),
+                          skip_label,
+                          vertex_partition_lasts);
+    if (num_hooks == 0) { break; }
+    compress(handle, push_graph_view, components, vertex_partition_lasts);
+  }
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool multi_gpu>
+void weakly_connected_components(
+  raft::handle_t const &handle,
+  graph_view_t<vertex_t, edge_t, weight_t, false, multi_gpu> const &graph_view,
+  vertex_t *components,
+  bool do_expensive_check)
+{
+  CUGRAPH_EXPECTS((components != nullptr) || (graph_view.get_number_of_local_vertices() == 0),
+                  "Invalid input argument: components should not be nullptr.");
+
+  detail::weakly_connected_components(handle, graph_view, components, do_expensive_check);
+}
+
+// explicit instantiation
+
+template void weakly_connected_components(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, float, false, true> const &graph_view,
+  int32_t *components,
+  bool do_expensive_check);
+
+template void weakly_connected_components(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, double, false, true> const &graph_view,
+  int32_t *components,
+  bool do_expensive_check);
+
+template void weakly_connected_components(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, float, false, true> const &graph_view,
+  int32_t *components,
+  bool do_expensive_check);
+
+template void weakly_connected_components(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, double, false, true> const &graph_view,
+  int32_t *components,
+  bool do_expensive_check);
+
+template void weakly_connected_components(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, float, false, true> const &graph_view,
+  int64_t *components,
+  bool do_expensive_check);
+
+template void weakly_connected_components(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, double, false, true> const &graph_view,
+  int64_t *components,
+  bool do_expensive_check);
+
+template void weakly_connected_components(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, float, false, false> const &graph_view,
+  int32_t *components,
+  bool do_expensive_check);
+
+template void weakly_connected_components(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int32_t, double, false, false> const &graph_view,
+  int32_t *components,
+  bool do_expensive_check);
+
+template void weakly_connected_components(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, float, false, false> const &graph_view,
+  int32_t *components,
+  bool do_expensive_check);
+
+template void weakly_connected_components(
+  raft::handle_t const &handle,
+  graph_view_t<int32_t, int64_t, double, false, false> const &graph_view,
+  int32_t *components,
+  bool do_expensive_check);
+
+template void weakly_connected_components(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, float, false, false> const &graph_view,
+  int64_t *components,
+  bool do_expensive_check);
+
+template void weakly_connected_components(
+  raft::handle_t const &handle,
+  graph_view_t<int64_t, int64_t, double, false, false> const &graph_view,
+  int64_t *components,
+  bool do_expensive_check);
+
+}  // namespace experimental
+}  // namespace cugraph
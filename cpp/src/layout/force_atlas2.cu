@@ -16,6 +16,9 @@
 
 #include "barnes_hut.hpp"
 #include "exact_fa2.hpp"
+#include "mg_barnes_hut.hpp"
+
+#include <limits>
 
 namespace cugraph {
 
@@ -77,6 +80,128 @@ void force_atlas2(GraphCOOView<vertex_t, edge_t, weight_t> &graph,
   }
 }
 
+template <typename graph_view_t>
+void force_atlas2(raft::handle_t const &handle,
+                  graph_view_t const &graph_view,
+                  float *pos,
+                  const int max_iter,
+                  float const *x_start,
+                  float const *y_start,
+                  bool outbound_attraction_distribution,
+                  bool lin_log_mode,
+                  bool prevent_overlapping,
+                  const float edge_weight_influence,
+                  const float jitter_tolerance,
+                  const float barnes_hut_theta,
+                  const float scaling_ratio,
+                  bool strong_gravity_mode,
+                  const float gravity,
+                  bool verbose)
+{
+  static_assert(!graph_view_t::is_adj_matrix_transposed,
+                "Invalid input argument: graph_view_t::is_adj_matrix_transposed should be false.");
+  CUGRAPH_EXPECTS(graph_view.get_number_of_local_vertices() == 0 || pos != nullptr,
+                  "Invalid input argument: pos array should be of size 2 * (# local vertices)");
+  CUGRAPH_EXPECTS(graph_view.get_number_of_vertices() != 0, "Invalid input: Graph is empty");
+  // the Barnes Hut kernels use int vertex offsets and the quadtree has up to 2 * (# bodies) nodes
+  CUGRAPH_EXPECTS(
+    graph_view.get_number_of_local_vertices() < std::numeric_limits<int>::max() / 4,
+    "Invalid input argument: the number of local vertices is too large for ForceAtlas2.");
+
+  detail::mg_barnes_hut_t<graph_view_t> layout(handle,
+                                               graph_view,
+                                               x_start,
+                                               y_start,
+                                               outbound_attraction_distribution,
+                                               lin_log_mode,
+                                               prevent_overlapping,
+                                               edge_weight_influence,
+                                               jitter_tolerance,
+                                               barnes_hut_theta,
+                                               scaling_ratio,
+                                               strong_gravity_mode,
+                                               gravity,
+                                               verbose);
+  layout.run(max_iter);
+
+  // Copy nodes positions into final output pos
+  thrust::copy(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+               layout.positions(),
+               layout.positions() + graph_view.get_number_of_local_vertices() * 2,
+               pos);
+}
+
+template <typename graph_view_t>
+force_atlas2_layout_t<graph_view_t>::force_atlas2_layout_t(
+  raft::handle_t const &handle,
+  graph_view_t const &graph_view,
+  float const *x_start,
+  float const *y_start,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  bool prevent_overlapping,
+  const float edge_weight_influence,
+  const float jitter_tolerance,
+  const float barnes_hut_theta,
+  const float scaling_ratio,
+  bool strong_gravity_mode,
+  const float gravity,
+  bool verbose)
+{
+  static_assert(!graph_view_t::is_adj_matrix_transposed,
+                "Invalid input argument: graph_view_t::is_adj_matrix_transposed should be false.");
+  CUGRAPH_EXPECTS(graph_view.get_number_of_vertices() != 0, "Invalid input: Graph is empty");
+  CUGRAPH_EXPECTS(
+    graph_view.get_number_of_local_vertices() < std::numeric_limits<int>::max() / 4,
+    "Invalid input argument: the number of local vertices is too large for ForceAtlas2.");
+
+  impl_ = std::make_unique<detail::mg_barnes_hut_t<graph_view_t>>(handle,
+                                                                  graph_view,
+                                                                  x_start,
+                                                                  y_start,
+                                                                  outbound_attraction_distribution,
+                                                                  lin_log_mode,
+                                                                  prevent_overlapping,
+                                                                  edge_weight_influence,
+                                                                  jitter_tolerance,
+                                                                  barnes_hut_theta,
+                                                                  scaling_ratio,
+                                                                  strong_gravity_mode,
+                                                                  gravity,
+                                                                  verbose);
+}
+
+template <typename graph_view_t>
+force_atlas2_layout_t<graph_view_t>::~force_atlas2_layout_t() = default;
+
+template <typename graph_view_t>
+void force_atlas2_layout_t<graph_view_t>::run(int num_iterations,
+                                               internals::GraphBasedDimRedCallback *callback)
+{
+  CUGRAPH_EXPECTS(num_iterations >= 0,
+                  "Invalid input argument: num_iterations should be non-negative.");
+  impl_->run(num_iterations, callback);
+}
+
+template <typename graph_view_t>
+void force_atlas2_layout_t<graph_view_t>::set_positions(float const *x_start,
+                                                         float const *y_start)
+{
+  impl_->set_positions(x_start, y_start);
+}
+
+template <typename graph_view_t>
+float const *force_atlas2_layout_t<graph_view_t>::positions() const
+{
+  return impl_->positions();
+}
+
+template <typename graph_view_t>
+int force_atlas2_layout_t<graph_view_t>::get_number_of_iterations() const
+{
+  return impl_->get_number_of_iterations();
+}
+
 template void force_atlas2<int, int, float>(GraphCOOView<int, int, float> &graph,
                                             float *pos,
                                             const int max_iter,
@@ -113,4 +238,245 @@ template void force_atlas2<int, int, double>(GraphCOOView<int, int, double> &gra
                                              bool verbose,
                                              internals::GraphBasedDimRedCallback *callback);
 
+template void force_atlas2(
+  raft::handle_t const &handle,
+  experimental::graph_view_t<int32_t, int32_t, float, false, false> const &graph_view,
+  float *pos,
+  const int max_iter,
+  float const *x_start,
+  float const *y_start,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  bool prevent_overlapping,
+  const float edge_weight_influence,
+  const float jitter_tolerance,
+  const float barnes_hut_theta,
+  const float scaling_ratio,
+  bool strong_gravity_mode,
+  const float gravity,
+  bool verbose);
+
+template void force_atlas2(
+  raft::handle_t const &handle,
+  experimental::graph_view_t<int32_t, int32_t, double, false, false> const &graph_view,
+  float *pos,
+  const int max_iter,
+  float const *x_start,
+  float const *y_start,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  bool prevent_overlapping,
+  const float edge_weight_influence,
+  const float jitter_tolerance,
+  const float barnes_hut_theta,
+  const float scaling_ratio,
+  bool strong_gravity_mode,
+  const float gravity,
+  bool verbose);
+
+template void force_atlas2(
+  raft::handle_t const &handle,
+  experimental::graph_view_t<int32_t, int64_t, float, false, false> const &graph_view,
+  float *pos,
+  const int max_iter,
+  float const *x_start,
+  float const *y_start,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  bool prevent_overlapping,
+  const float edge_weight_influence,
+  const float jitter_tolerance,
+  const float barnes_hut_theta,
+  const float scaling_ratio,
+  bool strong_gravity_mode,
+  const float gravity,
+  bool verbose);
+
+template void force_atlas2(
+  raft::handle_t const &handle,
+  experimental::graph_view_t<int32_t, int64_t, double, false, false> const &graph_view,
+  float *pos,
+  const int max_iter,
+  float const *x_start,
+  float const *y_start,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  bool prevent_overlapping,
+  const float edge_weight_influence,
+  const float jitter_tolerance,
+  const float barnes_hut_theta,
+  const float scaling_ratio,
+  bool strong_gravity_mode,
+  const float gravity,
+  bool verbose);
+
+template void force_atlas2(
+  raft::handle_t const &handle,
+  experimental::graph_view_t<int64_t, int64_t, float, false, false> const &graph_view,
+  float *pos,
+  const int max_iter,
+  float const *x_start,
+  float const *y_start,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  bool prevent_overlapping,
+  const float edge_weight_influence,
+  const float jitter_tolerance,
+  const float barnes_hut_theta,
+  const float scaling_ratio,
+  bool strong_gravity_mode,
+  const float gravity,
+  bool verbose);
+
+template void force_atlas2(
+  raft::handle_t const &handle,
+  experimental::graph_view_t<int64_t, int64_t, double, false, false> const &graph_view,
+  float *pos,
+  const int max_iter,
+  float const *x_start,
+  float const *y_start,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  bool prevent_overlapping,
+  const float edge_weight_influence,
+  const float jitter_tolerance,
+  const float barnes_hut_theta,
+  const float scaling_ratio,
+  bool strong_gravity_mode,
+  const float gravity,
+  bool verbose);
+
+template void force_atlas2(
+  raft::handle_t const &handle,
+  experimental::graph_view_t<int32_t, int32_t, float, false, true> const &graph_view,
+  float *pos,
+  const int max_iter,
+  float const *x_start,
+  float const *y_start,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  bool prevent_overlapping,
+  const float edge_weight_influence,
+  const float jitter_tolerance,
+  const float barnes_hut_theta,
+  const float scaling_ratio,
+  bool strong_gravity_mode,
+  const float gravity,
+  bool verbose);
+
+template void force_atlas2(
+  raft::handle_t const &handle,
+  experimental::graph_view_t<int32_t, int32_t, double, false, true> const &graph_view,
+  float *pos,
+  const int max_iter,
+  float const *x_start,
+  float const *y_start,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  bool prevent_overlapping,
+  const float edge_weight_influence,
+  const float jitter_tolerance,
+  const float barnes_hut_theta,
+  const float scaling_ratio,
+  bool strong_gravity_mode,
+  const float gravity,
+  bool verbose);
+
+template void force_atlas2(
+  raft::handle_t const &handle,
+  experimental::graph_view_t<int32_t, int64_t, float, false, true> const &graph_view,
+  float *pos,
+  const int max_iter,
+  float const *x_start,
+  float const *y_start,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  bool prevent_overlapping,
+  const float edge_weight_influence,
+  const float jitter_tolerance,
+  const float barnes_hut_theta,
+  const float scaling_ratio,
+  bool strong_gravity_mode,
+  const float gravity,
+  bool verbose);
+
+template void force_atlas2(
+  raft::handle_t const &handle,
+  experimental::graph_view_t<int32_t, int64_t, double, false, true> const &graph_view,
+  float *pos,
+  const int max_iter,
+  float const *x_start,
+  float const *y_start,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  bool prevent_overlapping,
+  const float edge_weight_influence,
+  const float jitter_tolerance,
+  const float barnes_hut_theta,
+  const float scaling_ratio,
+  bool strong_gravity_mode,
+  const float gravity,
+  bool verbose);
+
+template void force_atlas2(
+  raft::handle_t const &handle,
+  experimental::graph_view_t<int64_t, int64_t, float, false, true> const &graph_view,
+  float *pos,
+  const int max_iter,
+  float const *x_start,
+  float const *y_start,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  bool prevent_overlapping,
+  const float edge_weight_influence,
+  const float jitter_tolerance,
+  const float barnes_hut_theta,
+  const float scaling_ratio,
+  bool strong_gravity_mode,
+  const float gravity,
+  bool verbose);
+
+template void force_atlas2(
+  raft::handle_t const &handle,
+  experimental::graph_view_t<int64_t, int64_t, double, false, true> const &graph_view,
+  float *pos,
+  const int max_iter,
+  float const *x_start,
+  float const *y_start,
+  bool outbound_attraction_distribution,
+  bool lin_log_mode,
+  bool prevent_overlapping,
+  const float edge_weight_influence,
+  const float jitter_tolerance,
+  const float barnes_hut_theta,
+  const float scaling_ratio,
+  bool strong_gravity_mode,
+  const float gravity,
+  bool verbose);
+
+template class force_atlas2_layout_t<
+  experimental::graph_view_t<int32_t, int32_t, float, false, false>>;
+template class force_atlas2_layout_t<
+  experimental::graph_view_t<int32_t, int32_t, double, false, false>>;
+template class force_atlas2_layout_t<
+  experimental::graph_view_t<int32_t, int64_t, float, false, false>>;
+template class force_atlas2_layout_t<
+  experimental::graph_view_t<int32_t, int64_t, double, false, false>>;
+template class force_atlas2_layout_t<
+  experimental::graph_view_t<int64_t, int64_t, float, false, false>>;
+template class force_atlas2_layout_t<
+  experimental::graph_view_t<int64_t, int64_t, double, false, false>>;
+template class force_atlas2_layout_t<
+  experimental::graph_view_t<int32_t, int32_t, float, false, true>>;
+template class force_atlas2_layout_t<
+  experimental::graph_view_t<int32_t, int32_t, double, false, true>>;
+template class force_atlas2_layout_t<
+  experimental::graph_view_t<int32_t, int64_t, float, false, true>>;
+template class force_atlas2_layout_t<
+  experimental::graph_view_t<int32_t, int64_t, double, false, true>>;
+template class force_atlas2_layout_t<
+  experimental::graph_view_t<int64_t, int64_t, float, false, true>>;
+template class force_atlas2_layout_t<
+  experimental::graph_view_t<int64_t, int64_t, double, false, true>>;
+
 }  // namespace cugraph
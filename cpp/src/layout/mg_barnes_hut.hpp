@@ -0,0 +1,911 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <experimental/graph_view.hpp>
+#include <internals.hpp>
+#include <patterns/copy_to_adj_matrix_row_col.cuh>
+#include <patterns/copy_v_transform_reduce_in_out_nbr.cuh>
+#include <utilities/dataframe_buffer.cuh>
+#include <utilities/device_comm.cuh>
+#include <utilities/error.hpp>
+#include <utilities/host_scalar_comm.cuh>
+#include <utilities/shuffle_comm.cuh>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/execution_policy.h>
+#include <thrust/extrema.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <numeric>
+#include <vector>
+
+#include "bh_kernels.hpp"
+#include "fa2_kernels.hpp"
+#include "utilities/graph_utils.cuh"
+#include "utils.hpp"
+
+namespace cugraph {
+namespace detail {
+
+// number of x coordinates each GPU samples to place the spatial slab boundaries
+static constexpr size_t fa2_num_slab_boundary_samples_per_gpu{1024};
+// each GPU summarizes its slab into (up to) this many pseudo-particles per dimension
+static constexpr int fa2_num_pseudo_particle_cells_per_dim{64};
+
+// Barnes-Hut repulsion of a set of bodies; the buffers are kept across calls (and grow only if the
+// number of bodies exceeds the current capacity)
+class bh_repulsion_t {
+ public:
+  bh_repulsion_t(cudaStream_t stream)
+    : stream_(stream),
+      limiter_(1, stream),
+      maxdepth_(1, stream),
+      bottom_(1, stream),
+      radius_(1, stream),
+      radius_squared_(1, stream),
+      start_(0, stream),
+      child_(0, stream),
+      mass_(0, stream),
+      count_(0, stream),
+      sort_(0, stream),
+      pos_(0, stream),
+      rep_forces_(0, stream),
+      max_x_(0, stream),
+      max_y_(0, stream),
+      min_x_(0, stream),
+      min_y_(0, stream)
+  {
+    blocks_ = getMultiProcessorCount();
+
+    max_x_.resize(blocks_ * FACTOR1, stream_);
+    max_y_.resize(blocks_ * FACTOR1, stream_);
+    min_x_.resize(blocks_ * FACTOR1, stream_);
+    min_y_.resize(blocks_ * FACTOR1, stream_);
+
+    InitializationKernel<<<1, 1, 0, stream_>>>(limiter_.data(), maxdepth_.data(), radius_.data());
+    CHECK_CUDA(stream_);
+
+    cudaFuncSetCacheConfig(BoundingBoxKernel, cudaFuncCachePreferShared);
+    cudaFuncSetCacheConfig(TreeBuildingKernel, cudaFuncCachePreferL1);
+    cudaFuncSetCacheConfig(ClearKernel1, cudaFuncCachePreferL1);
+    cudaFuncSetCacheConfig(ClearKernel2, cudaFuncCachePreferL1);
+    cudaFuncSetCacheConfig(SummarizationKernel, cudaFuncCachePreferShared);
+    cudaFuncSetCacheConfig(SortKernel, cudaFuncCachePreferL1);
+    cudaFuncSetCacheConfig(RepulsionKernel, cudaFuncCachePreferL1);
+  }
+
+  // bodies should be stored in [0, num_bodies) of x_positions(), y_positions(), and masses()
+  void resize(int num_bodies)
+  {
+    // We use the same array for nodes and cells.
+    int nnodes = std::max(num_bodies * 2, 1024 * blocks_);
+    while ((nnodes & (32 - 1)) != 0) nnodes++;
+    nnodes--;
+
+    if (nnodes > nnodes_) {
+      nnodes_ = nnodes;
+      start_.resize(nnodes_ + 1, stream_);
+      child_.resize((nnodes_ + 1) * 4, stream_);
+      mass_.resize(nnodes_ + 1, stream_);
+      count_.resize(nnodes_ + 1, stream_);
+      sort_.resize(nnodes_ + 1, stream_);
+      pos_.resize((nnodes_ + 1) * 2, stream_);
+      rep_forces_.resize((nnodes_ + 1) * 2, stream_);
+      thrust::fill(rmm::exec_policy(stream_)->on(stream_), start_.begin(), start_.end(), int{0});
+      thrust::fill(rmm::exec_policy(stream_)->on(stream_), child_.begin(), child_.end(), int{0});
+      thrust::fill(rmm::exec_policy(stream_)->on(stream_), count_.begin(), count_.end(), int{0});
+      thrust::fill(rmm::exec_policy(stream_)->on(stream_), sort_.begin(), sort_.end(), int{0});
+    }
+    num_bodies_ = num_bodies;
+  }
+
+  float *x_positions() { return pos_.data(); }
+  float *y_positions() { return pos_.data() + nnodes_ + 1; }
+  int *masses() { return mass_.data(); }
+
+  float const *x_repulsions() const { return rep_forces_.data(); }
+  float const *y_repulsions() const { return rep_forces_.data() + nnodes_ + 1; }
+
+  // computes the repulsion forces of the bodies (x_repulsions() and y_repulsions())
+  void compute(float scaling_ratio, float theta)
+  {
+    // A tiny jitter to promote numerical stability
+    const float epssq         = 0.0025;
+    const int FOUR_NNODES     = 4 * nnodes_;
+    const int FOUR_N          = 4 * num_bodies_;
+    const float theta_squared = theta * theta;
+    const int NNODES          = nnodes_;
+
+    auto posx = x_positions();
+    auto posy = y_positions();
+
+    thrust::fill(
+      rmm::exec_policy(stream_)->on(stream_), rep_forces_.begin(), rep_forces_.end(), float{0.0});
+
+    if (num_bodies_ == 0) { return; }
+
+    ResetKernel<<<1, 1, 0, stream_>>>(
+      radius_squared_.data(), bottom_.data(), NNODES, radius_.data());
+    CHECK_CUDA(stream_);
+
+    // Compute bounding box arround all bodies
+    BoundingBoxKernel<<<blocks_ * FACTOR1, THREADS1, 0, stream_>>>(start_.data(),
+                                                                   child_.data(),
+                                                                   mass_.data(),
+                                                                   posx,
+                                                                   posy,
+                                                                   max_x_.data(),
+                                                                   max_y_.data(),
+                                                                   min_x_.data(),
+                                                                   min_y_.data(),
+                                                                   FOUR_NNODES,
+                                                                   NNODES,
+                                                                   num_bodies_,
+                                                                   limiter_.data(),
+                                                                   radius_.data());
+    CHECK_CUDA(stream_);
+
+    ClearKernel1<<<blocks_, 1024, 0, stream_>>>(child_.data(), FOUR_NNODES, FOUR_N);
+    CHECK_CUDA(stream_);
+
+    // Build quadtree
+    TreeBuildingKernel<<<blocks_ * FACTOR2, THREADS2, 0, stream_>>>(child_.data(),
+                                                                    posx,
+                                                                    posy,
+                                                                    NNODES,
+                                                                    num_bodies_,
+                                                                    maxdepth_.data(),
+                                                                    bottom_.data(),
+                                                                    radius_.data());
+    CHECK_CUDA(stream_);
+
+    ClearKernel2<<<blocks_, 1024, 0, stream_>>>(
+      start_.data(), mass_.data(), NNODES, bottom_.data());
+    CHECK_CUDA(stream_);
+
+    // Summarizes mass and position for each cell, bottom up approach
+    SummarizationKernel<<<blocks_ * FACTOR3, THREADS3, 0, stream_>>>(count_.data(),
+                                                                     child_.data(),
+                                                                     mass_.data(),
+                                                                     posx,
+                                                                     posy,
+                                                                     NNODES,
+                                                                     num_bodies_,
+                                                                     bottom_.data());
+    CHECK_CUDA(stream_);
+
+    // Group closed bodies together, used to speed up Repulsion kernel
+    SortKernel<<<blocks_ * FACTOR4, THREADS4, 0, stream_>>>(sort_.data(),
+                                                            count_.data(),
+                                                            start_.data(),
+                                                            child_.data(),
+                                                            NNODES,
+                                                            num_bodies_,
+                                                            bottom_.data());
+    CHECK_CUDA(stream_);
+
+    // Force computation O(n . log(n))
+    RepulsionKernel<<<blocks_ * FACTOR5, THREADS5, 0, stream_>>>(scaling_ratio,
+                                                                 theta,
+                                                                 epssq,
+                                                                 sort_.data(),
+                                                                 child_.data(),
+                                                                 mass_.data(),
+                                                                 posx,
+                                                                 posy,
+                                                                 rep_forces_.data(),
+                                                                 rep_forces_.data() + nnodes_ + 1,
+                                                                 theta_squared,
+                                                                 NNODES,
+                                                                 FOUR_NNODES,
+                                                                 num_bodies_,
+                                                                 radius_squared_.data(),
+                                                                 maxdepth_.data());
+    CHECK_CUDA(stream_);
+  }
+
+ private:
+  cudaStream_t stream_{};
+  int blocks_{0};
+  int nnodes_{-1};
+  int num_bodies_{0};
+
+  rmm::device_uvector<unsigned> limiter_;
+  rmm::device_uvector<int> maxdepth_;
+  rmm::device_uvector<int> bottom_;
+  rmm::device_uvector<float> radius_;
+  rmm::device_uvector<float> radius_squared_;
+
+  rmm::device_uvector<int> start_;
+  rmm::device_uvector<int> child_;
+  rmm::device_uvector<int> mass_;
+  rmm::device_uvector<int> count_;
+  rmm::device_uvector<int> sort_;
+  rmm::device_uvector<float> pos_;
+  rmm::device_uvector<float> rep_forces_;
+
+  rmm::device_uvector<float> max_x_;
+  rmm::device_uvector<float> max_y_;
+  rmm::device_uvector<float> min_x_;
+  rmm::device_uvector<float> min_y_;
+};
+
+struct slab_id_t {
+  float const *boundaries{nullptr};  // sorted, (number of slabs - 1) boundaries
+  int num_boundaries{0};
+
+  __device__ int operator()(thrust::tuple<int, float, float, int> body) const
+  {
+    return static_cast<int>(thrust::distance(
+      boundaries,
+      thrust::upper_bound(
+        thrust::seq, boundaries, boundaries + num_boundaries, thrust::get<1>(body))));
+  }
+};
+
+// accumulates mass and mass-weighted positions of the bodies in every cell of a uniform grid
+struct accumulate_pseudo_particle_t {
+  float x_min{0.0};
+  float y_min{0.0};
+  float inv_cell_width{0.0};
+  float inv_cell_height{0.0};
+  int cells_per_dim{0};
+  int *cell_masses{nullptr};
+  float *cell_x_moments{nullptr};
+  float *cell_y_moments{nullptr};
+
+  __device__ void operator()(thrust::tuple<float, float, int> body) const
+  {
+    auto x    = thrust::get<0>(body);
+    auto y    = thrust::get<1>(body);
+    auto mass = thrust::get<2>(body);
+    auto cx   = min(static_cast<int>((x - x_min) * inv_cell_width), cells_per_dim - 1);
+    auto cy   = min(static_cast<int>((y - y_min) * inv_cell_height), cells_per_dim - 1);
+    auto cell = cx * cells_per_dim + cy;
+    atomicAdd(cell_masses + cell, mass);
+    atomicAdd(cell_x_moments + cell, x * mass);
+    atomicAdd(cell_y_moments + cell, y * mass);
+  }
+};
+
+// slab boundaries (x coordinates) splitting the bodies evenly across the GPUs, computed from a
+// sample of every GPU's x coordinates
+inline rmm::device_uvector<float> compute_slab_boundaries(raft::handle_t const &handle,
+                                                          float const *x_positions,
+                                                          size_t num_positions)
+{
+  auto &comm           = handle.get_comms();
+  auto const comm_size = comm.get_size();
+  auto stream          = handle.get_stream();
+
+  rmm::device_uvector<float> sorted_x_v(num_positions, stream);
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               x_positions,
+               x_positions + num_positions,
+               sorted_x_v.begin());
+  thrust::sort(rmm::exec_policy(stream)->on(stream), sorted_x_v.begin(), sorted_x_v.end());
+
+  auto num_samples = std::min(num_positions, fa2_num_slab_boundary_samples_per_gpu);
+  rmm::device_uvector<float> samples_v(num_samples, stream);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator(size_t{0}),
+                    thrust::make_counting_iterator(num_samples),
+                    samples_v.begin(),
+                    [sorted_x = sorted_x_v.data(), num_positions, num_samples] __device__(auto i) {
+                      return sorted_x[((2 * i + 1) * num_positions) / (2 * num_samples)];
+                    });
+
+  auto rx_counts = experimental::host_scalar_allgather(comm, num_samples, stream);
+  std::vector<size_t> displacements(rx_counts.size(), size_t{0});
+  std::partial_sum(rx_counts.begin(), rx_counts.end() - 1, displacements.begin() + 1);
+  rmm::device_uvector<float> all_samples_v(displacements.back() + rx_counts.back(), stream);
+  experimental::device_allgatherv(
+    comm, samples_v.begin(), all_samples_v.begin(), rx_counts, displacements, stream);
+
+  std::vector<float> h_samples(all_samples_v.size());
+  raft::update_host(h_samples.data(), all_samples_v.data(), all_samples_v.size(), stream);
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  std::sort(h_samples.begin(), h_samples.end());
+
+  std::vector<float> h_boundaries(comm_size - 1, 0.0f);
+  for (int i = 0; i < comm_size - 1; ++i) {
+    h_boundaries[i] =
+      h_samples.size() > 0 ? h_samples[((i + 1) * h_samples.size()) / comm_size] : 0.0f;
+  }
+  rmm::device_uvector<float> boundaries_v(h_boundaries.size(), stream);
+  raft::update_device(boundaries_v.data(), h_boundaries.data(), h_boundaries.size(), stream);
+
+  return boundaries_v;
+}
+
+// Summarizes the bodies in [0, num_bodies) into pseudo-particles (one per non-empty cell of a
+// fa2_num_pseudo_particle_cells_per_dim x fa2_num_pseudo_particle_cells_per_dim grid covering the
+// bodies) and gathers every other GPU's pseudo-particles in [num_bodies, returned value) of the
+// body arrays.
+inline int gather_remote_pseudo_particles(raft::handle_t const &handle,
+                                          bh_repulsion_t &repulsion,
+                                          int num_bodies)
+{
+  auto &comm           = handle.get_comms();
+  auto const comm_rank = comm.get_rank();
+  auto stream          = handle.get_stream();
+
+  auto x_positions = repulsion.x_positions();
+  auto y_positions = repulsion.y_positions();
+  auto masses      = repulsion.masses();
+
+  auto constexpr cells_per_dim = fa2_num_pseudo_particle_cells_per_dim;
+  rmm::device_uvector<int> cell_masses_v(0, stream);
+  rmm::device_uvector<float> cell_xs_v(0, stream);
+  rmm::device_uvector<float> cell_ys_v(0, stream);
+  if (num_bodies > 0) {
+    auto x_minmax = thrust::minmax_element(
+      rmm::exec_policy(stream)->on(stream), x_positions, x_positions + num_bodies);
+    auto y_minmax = thrust::minmax_element(
+      rmm::exec_policy(stream)->on(stream), y_positions, y_positions + num_bodies);
+    float h_bbox[4];
+    raft::update_host(h_bbox, x_minmax.first, 1, stream);
+    raft::update_host(h_bbox + 1, x_minmax.second, 1, stream);
+    raft::update_host(h_bbox + 2, y_minmax.first, 1, stream);
+    raft::update_host(h_bbox + 3, y_minmax.second, 1, stream);
+    CUDA_TRY(cudaStreamSynchronize(stream));
+
+    cell_masses_v.resize(cells_per_dim * cells_per_dim, stream);
+    cell_xs_v.resize(cell_masses_v.size(), stream);
+    cell_ys_v.resize(cell_masses_v.size(), stream);
+    thrust::fill(
+      rmm::exec_policy(stream)->on(stream), cell_masses_v.begin(), cell_masses_v.end(), int{0});
+    thrust::fill(
+      rmm::exec_policy(stream)->on(stream), cell_xs_v.begin(), cell_xs_v.end(), float{0.0});
+    thrust::fill(
+      rmm::exec_policy(stream)->on(stream), cell_ys_v.begin(), cell_ys_v.end(), float{0.0});
+
+    auto body_first =
+      thrust::make_zip_iterator(thrust::make_tuple(x_positions, y_positions, masses));
+    thrust::for_each(
+      rmm::exec_policy(stream)->on(stream),
+      body_first,
+      body_first + num_bodies,
+      accumulate_pseudo_particle_t{h_bbox[0],
+                                   h_bbox[2],
+                                   cells_per_dim / std::max(h_bbox[1] - h_bbox[0], FLT_EPSILON),
+                                   cells_per_dim / std::max(h_bbox[3] - h_bbox[2], FLT_EPSILON),
+                                   cells_per_dim,
+                                   cell_masses_v.data(),
+                                   cell_xs_v.data(),
+                                   cell_ys_v.data()});
+
+    auto cell_first = thrust::make_zip_iterator(
+      thrust::make_tuple(cell_masses_v.begin(), cell_xs_v.begin(), cell_ys_v.begin()));
+    auto num_cells = static_cast<size_t>(thrust::distance(
+      cell_first,
+      thrust::remove_if(rmm::exec_policy(stream)->on(stream),
+                        cell_first,
+                        cell_first + cell_masses_v.size(),
+                        [] __device__(auto cell) { return thrust::get<0>(cell) == 0; })));
+    cell_masses_v.resize(num_cells, stream);
+    cell_xs_v.resize(num_cells, stream);
+    cell_ys_v.resize(num_cells, stream);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      cell_first,
+                      cell_first + num_cells,
+                      thrust::make_zip_iterator(
+                        thrust::make_tuple(cell_xs_v.begin(), cell_ys_v.begin())),
+                      [] __device__(auto cell) {
+                        auto mass = static_cast<float>(thrust::get<0>(cell));
+                        return thrust::make_tuple(thrust::get<1>(cell) / mass,
+                                                  thrust::get<2>(cell) / mass);
+                      });
+  }
+
+  auto rx_counts = experimental::host_scalar_allgather(comm, cell_masses_v.size(), stream);
+  std::vector<size_t> displacements(rx_counts.size(), size_t{0});
+  std::partial_sum(rx_counts.begin(), rx_counts.end() - 1, displacements.begin() + 1);
+  auto num_pseudo_particles = displacements.back() + rx_counts.back();
+
+  rmm::device_uvector<int> all_masses_v(num_pseudo_particles, stream);
+  rmm::device_uvector<float> all_xs_v(num_pseudo_particles, stream);
+  rmm::device_uvector<float> all_ys_v(num_pseudo_particles, stream);
+  experimental::device_allgatherv(
+    comm, cell_masses_v.begin(), all_masses_v.begin(), rx_counts, displacements, stream);
+  experimental::device_allgatherv(
+    comm, cell_xs_v.begin(), all_xs_v.begin(), rx_counts, displacements, stream);
+  experimental::device_allgatherv(
+    comm, cell_ys_v.begin(), all_ys_v.begin(), rx_counts, displacements, stream);
+
+  // drop this GPU's pseudo-particles (this GPU's bodies are included as is)
+  auto pseudo_first = thrust::make_zip_iterator(
+    thrust::make_tuple(all_masses_v.begin(), all_xs_v.begin(), all_ys_v.begin()));
+  auto num_remote_pseudo_particles = num_pseudo_particles - rx_counts[comm_rank];
+
+  // bodies are copied to the repulsion buffers after resizing (resizing may re-allocate)
+  rmm::device_uvector<int> body_masses_v(num_bodies, stream);
+  rmm::device_uvector<float> body_xs_v(num_bodies, stream);
+  rmm::device_uvector<float> body_ys_v(num_bodies, stream);
+  auto body_first = thrust::make_zip_iterator(thrust::make_tuple(masses, x_positions, y_positions));
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               body_first,
+               body_first + num_bodies,
+               thrust::make_zip_iterator(
+                 thrust::make_tuple(body_masses_v.begin(), body_xs_v.begin(), body_ys_v.begin())));
+
+  auto num_total_bodies = num_bodies + static_cast<int>(num_remote_pseudo_particles);
+  repulsion.resize(num_total_bodies);
+
+  auto dst_first = thrust::make_zip_iterator(
+    thrust::make_tuple(repulsion.masses(), repulsion.x_positions(), repulsion.y_positions()));
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               thrust::make_zip_iterator(
+                 thrust::make_tuple(body_masses_v.begin(), body_xs_v.begin(), body_ys_v.begin())),
+               thrust::make_zip_iterator(
+                 thrust::make_tuple(body_masses_v.end(), body_xs_v.end(), body_ys_v.end())),
+               dst_first);
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               pseudo_first,
+               pseudo_first + displacements[comm_rank],
+               dst_first + num_bodies);
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               pseudo_first + displacements[comm_rank] + rx_counts[comm_rank],
+               pseudo_first + num_pseudo_particles,
+               dst_first + num_bodies + displacements[comm_rank]);
+
+  return num_total_bodies;
+}
+
+template <typename edge_t>
+struct degree_to_mass_t {
+  // FA2 requires degree + 1
+  __device__ int operator()(edge_t degree) const { return static_cast<int>(degree) + 1; }
+};
+
+/**
+ * Barnes-Hut ForceAtlas2 on an experimental::graph_view_t.
+ *
+ * Attraction is computed over the (2D partitioned) local edges using
+ * copy_v_transform_reduce_out_nbr. For repulsion, every GPU owns a spatial slab (a range of x
+ * coordinates, the boundaries are re-computed every iteration to balance the number of bodies per
+ * slab). The vertices are shuffled to the slab owners, every slab owner summarizes its slab into
+ * pseudo-particles, and the pseudo-particles are exchanged. Each GPU builds a quadtree on its
+ * slab's vertices and the other slabs' pseudo-particles, and the repulsion forces are shuffled
+ * back to the vertex owners.
+ *
+ * The layout state (positions, previous forces, global speed, and the Barnes-Hut buffers) is
+ * kept across run() calls, so a layout can be refined in chunks of iterations.
+ */
+template <typename graph_view_type>
+class mg_barnes_hut_t {
+ public:
+  using graph_view_t = graph_view_type;
+  using vertex_t     = typename graph_view_t::vertex_type;
+  using edge_t       = typename graph_view_t::edge_type;
+  using weight_t     = typename graph_view_t::weight_type;
+
+  mg_barnes_hut_t(raft::handle_t const &handle,
+                  graph_view_t const &graph_view,
+                  float const *x_start,
+                  float const *y_start,
+                  bool outbound_attraction_distribution,
+                  bool lin_log_mode,
+                  bool prevent_overlapping,
+                  const float edge_weight_influence,
+                  const float jitter_tolerance,
+                  const float theta,
+                  const float scaling_ratio,
+                  bool strong_gravity_mode,
+                  const float gravity,
+                  bool verbose)
+    : handle_(handle),
+      graph_view_(graph_view),
+      outbound_attraction_distribution_(outbound_attraction_distribution),
+      lin_log_mode_(lin_log_mode),
+      prevent_overlapping_(prevent_overlapping),
+      edge_weight_influence_(edge_weight_influence),
+      jitter_tolerance_(jitter_tolerance),
+      theta_(theta),
+      scaling_ratio_(scaling_ratio),
+      strong_gravity_mode_(strong_gravity_mode),
+      gravity_(gravity),
+      verbose_(verbose),
+      local_n_(static_cast<int>(graph_view.get_number_of_local_vertices())),
+      pos_v_(local_n_ * 2, handle.get_stream()),
+      mass_v_(local_n_, handle.get_stream()),
+      attract_v_(local_n_ * 2, handle.get_stream()),
+      rep_forces_v_(local_n_ * 2, handle.get_stream()),
+      old_forces_v_(local_n_ * 2, handle.get_stream()),
+      swinging_v_(local_n_, handle.get_stream()),
+      traction_v_(local_n_, handle.get_stream()),
+      adj_matrix_row_xs_v_(0, handle.get_stream()),
+      adj_matrix_row_ys_v_(0, handle.get_stream()),
+      adj_matrix_row_masses_v_(0, handle.get_stream()),
+      adj_matrix_col_xs_v_(0, handle.get_stream()),
+      adj_matrix_col_ys_v_(0, handle.get_stream()),
+      repulsion_(handle.get_stream())
+  {
+    auto stream = handle_.get_stream();
+
+    set_positions(x_start, y_start);
+
+    auto out_degrees = graph_view_.compute_out_degrees(handle_);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      out_degrees.begin(),
+                      out_degrees.end(),
+                      mass_v_.begin(),
+                      degree_to_mass_t<edge_t>{});
+    out_degrees.resize(0, stream);
+    out_degrees.shrink_to_fit(stream);
+
+    // If outboundAttractionDistribution active, compensate.
+    if (outbound_attraction_distribution_) {
+      auto sum = thrust::reduce(
+        rmm::exec_policy(stream)->on(stream), mass_v_.begin(), mass_v_.end(), size_t{0});
+      if (graph_view_t::is_multi_gpu) {
+        sum = experimental::host_scalar_allreduce(handle_.get_comms(), sum, stream);
+      }
+      outbound_att_compensation_ = sum / static_cast<float>(graph_view_.get_number_of_vertices());
+    }
+
+    if (graph_view_t::is_multi_gpu) {
+      adj_matrix_row_xs_v_.resize(graph_view_.get_number_of_local_adj_matrix_partition_rows(),
+                                  stream);
+      adj_matrix_row_ys_v_.resize(adj_matrix_row_xs_v_.size(), stream);
+      adj_matrix_row_masses_v_.resize(adj_matrix_row_xs_v_.size(), stream);
+      adj_matrix_col_xs_v_.resize(graph_view_.get_number_of_local_adj_matrix_partition_cols(),
+                                  stream);
+      adj_matrix_col_ys_v_.resize(adj_matrix_col_xs_v_.size(), stream);
+      experimental::copy_to_adj_matrix_row(
+        handle_, graph_view_, mass_v_.begin(), adj_matrix_row_masses_v_.begin());
+    }
+  }
+
+  // (re-)starts the layout from the given positions (or random positions if nullptr) of the local
+  // vertices, global speed is reset as well
+  void set_positions(float const *x_start, float const *y_start)
+  {
+    auto stream = handle_.get_stream();
+
+    if (x_start && y_start) {
+      thrust::copy(
+        rmm::exec_policy(stream)->on(stream), x_start, x_start + local_n_, x_positions());
+      thrust::copy(
+        rmm::exec_policy(stream)->on(stream), y_start, y_start + local_n_, y_positions());
+    } else {
+      // Initialize positions with random values (independent of the number of GPUs)
+      auto const n           = graph_view_.get_number_of_vertices();
+      auto const local_first = graph_view_.get_local_vertex_first();
+      random_vector(x_positions(), local_n_, static_cast<int>(local_first), stream);
+      random_vector(y_positions(), local_n_, static_cast<int>(n + local_first), stream);
+    }
+
+    thrust::fill(rmm::exec_policy(stream)->on(stream),
+                 old_forces_v_.begin(),
+                 old_forces_v_.end(),
+                 float{0.0});
+    speed_            = 1.f;
+    speed_efficiency_ = 1.f;
+    jt_               = 0.f;
+  }
+
+  // runs num_iterations more iterations from the current state, callback->on_epoch_end() is
+  // called with positions() after every iteration
+  void run(int num_iterations, internals::GraphBasedDimRedCallback *callback = nullptr)
+  {
+    if (callback) callback->setup<float>(local_n_, 2);
+    for (int i = 0; i < num_iterations; ++i) {
+      iterate();
+      if (callback) callback->on_epoch_end(pos_v_.data());
+    }
+  }
+
+  // device array (2, number of local vertices) of the local vertices' x-axis and y-axis positions
+  float const *positions() const { return pos_v_.data(); }
+
+  int get_number_of_iterations() const { return num_iterations_; }
+
+  void iterate()
+  {
+    auto stream = handle_.get_stream();
+
+    auto x_v = x_positions();
+    auto y_v = y_positions();
+
+    // 1. attraction (with the source vertex's mass for outbound attraction distribution)
+
+    auto row_first = thrust::make_zip_iterator(
+      thrust::make_tuple(x_v, y_v, static_cast<int const *>(mass_v_.data())));
+    auto col_first = thrust::make_zip_iterator(thrust::make_tuple(x_v, y_v));
+    if (graph_view_t::is_multi_gpu) {
+      experimental::copy_to_adj_matrix_row(
+        handle_,
+        graph_view_,
+        col_first,
+        thrust::make_zip_iterator(
+          thrust::make_tuple(adj_matrix_row_xs_v_.data(), adj_matrix_row_ys_v_.data())));
+      experimental::copy_to_adj_matrix_col(
+        handle_,
+        graph_view_,
+        col_first,
+        thrust::make_zip_iterator(
+          thrust::make_tuple(adj_matrix_col_xs_v_.data(), adj_matrix_col_ys_v_.data())));
+      row_first = thrust::make_zip_iterator(
+        thrust::make_tuple(adj_matrix_row_xs_v_.data(),
+                           adj_matrix_row_ys_v_.data(),
+                           static_cast<int const *>(adj_matrix_row_masses_v_.data())));
+      col_first = thrust::make_zip_iterator(
+        thrust::make_tuple(adj_matrix_col_xs_v_.data(), adj_matrix_col_ys_v_.data()));
+    }
+
+    experimental::copy_v_transform_reduce_out_nbr(
+      handle_,
+      graph_view_,
+      row_first,
+      col_first,
+      [outbound_attraction_distribution = outbound_attraction_distribution_,
+       lin_log_mode                     = lin_log_mode_,
+       edge_weight_influence            = edge_weight_influence_,
+       coef = outbound_att_compensation_] __device__(auto, auto, weight_t w, auto src, auto dst) {
+        float x_dist = thrust::get<0>(src) - thrust::get<0>(dst);
+        float y_dist = thrust::get<1>(src) - thrust::get<1>(dst);
+        float factor = -coef * pow(static_cast<float>(w), edge_weight_influence);
+
+        if (lin_log_mode) {
+          float distance = pow(x_dist, 2) + pow(y_dist, 2);
+          distance += FLT_EPSILON;
+          distance = sqrt(distance);
+          factor *= log(1 + distance) / distance;
+        }
+        if (outbound_attraction_distribution) factor /= thrust::get<2>(src);
+
+        return thrust::make_tuple(x_dist * factor, y_dist * factor);
+      },
+      thrust::make_tuple(float{0.0}, float{0.0}),
+      thrust::make_zip_iterator(
+        thrust::make_tuple(attract_v_.begin(), attract_v_.begin() + local_n_)));
+
+    apply_gravity<vertex_t>(x_v,
+                            y_v,
+                            attract_v_.data(),
+                            attract_v_.data() + local_n_,
+                            mass_v_.data(),
+                            gravity_,
+                            strong_gravity_mode_,
+                            scaling_ratio_,
+                            static_cast<vertex_t>(local_n_),
+                            stream);
+
+    // 2. repulsion
+
+    if (graph_view_t::is_multi_gpu) {
+      auto &comm           = handle_.get_comms();
+      auto const comm_size = comm.get_size();
+
+      auto boundaries_v = compute_slab_boundaries(handle_, x_v, local_n_);
+
+      rmm::device_uvector<int> tx_offsets_v(local_n_, stream);
+      rmm::device_uvector<float> tx_xs_v(local_n_, stream);
+      rmm::device_uvector<float> tx_ys_v(local_n_, stream);
+      rmm::device_uvector<int> tx_masses_v(local_n_, stream);
+      thrust::sequence(
+        rmm::exec_policy(stream)->on(stream), tx_offsets_v.begin(), tx_offsets_v.end(), int{0});
+      thrust::copy(rmm::exec_policy(stream)->on(stream), x_v, x_v + local_n_, tx_xs_v.begin());
+      thrust::copy(rmm::exec_policy(stream)->on(stream), y_v, y_v + local_n_, tx_ys_v.begin());
+      thrust::copy(
+        rmm::exec_policy(stream)->on(stream), mass_v_.begin(), mass_v_.end(), tx_masses_v.begin());
+
+      auto tx_first = thrust::make_zip_iterator(thrust::make_tuple(
+        tx_offsets_v.begin(), tx_xs_v.begin(), tx_ys_v.begin(), tx_masses_v.begin()));
+      auto rx_bodies =
+        experimental::allocate_dataframe_buffer<thrust::tuple<int, float, float, int>>(0, stream);
+      std::vector<size_t> rx_counts{};
+      std::tie(rx_bodies, rx_counts) = experimental::groupby_gpuid_and_shuffle_values(
+        comm,
+        tx_first,
+        tx_first + local_n_,
+        slab_id_t{boundaries_v.data(), comm_size - 1},
+        stream);
+
+      auto num_slab_bodies = static_cast<int>(std::get<0>(rx_bodies).size());
+      repulsion_.resize(num_slab_bodies);
+      auto rx_body_first = thrust::make_zip_iterator(thrust::make_tuple(
+        std::get<1>(rx_bodies).begin(),
+        std::get<2>(rx_bodies).begin(),
+        std::get<3>(rx_bodies).begin()));
+      thrust::copy(rmm::exec_policy(stream)->on(stream),
+                   rx_body_first,
+                   rx_body_first + num_slab_bodies,
+                   thrust::make_zip_iterator(thrust::make_tuple(
+                     repulsion_.x_positions(), repulsion_.y_positions(), repulsion_.masses())));
+
+      gather_remote_pseudo_particles(handle_, repulsion_, num_slab_bodies);
+
+      repulsion_.compute(scaling_ratio_, theta_);
+
+      // send the repulsion forces (of the slab bodies, the pseudo-particles are ignored) back to
+      // the vertex owners
+
+      thrust::copy(rmm::exec_policy(stream)->on(stream),
+                   repulsion_.x_repulsions(),
+                   repulsion_.x_repulsions() + num_slab_bodies,
+                   std::get<1>(rx_bodies).begin());
+      thrust::copy(rmm::exec_policy(stream)->on(stream),
+                   repulsion_.y_repulsions(),
+                   repulsion_.y_repulsions() + num_slab_bodies,
+                   std::get<2>(rx_bodies).begin());
+      auto tx_force_first = thrust::make_zip_iterator(thrust::make_tuple(
+        std::get<0>(rx_bodies).begin(),
+        std::get<1>(rx_bodies).begin(),
+        std::get<2>(rx_bodies).begin()));
+      auto rx_forces =
+        experimental::allocate_dataframe_buffer<thrust::tuple<int, float, float>>(0, stream);
+      std::tie(rx_forces, std::ignore) =
+        experimental::shuffle_values(comm, tx_force_first, rx_counts, stream);
+
+      auto rx_force_first = thrust::make_zip_iterator(
+        thrust::make_tuple(std::get<1>(rx_forces).begin(), std::get<2>(rx_forces).begin()));
+      thrust::scatter(rmm::exec_policy(stream)->on(stream),
+                      rx_force_first,
+                      rx_force_first + std::get<0>(rx_forces).size(),
+                      std::get<0>(rx_forces).begin(),
+                      thrust::make_zip_iterator(thrust::make_tuple(
+                        rep_forces_v_.begin(), rep_forces_v_.begin() + local_n_)));
+    } else {
+      repulsion_.resize(local_n_);
+      auto body_first =
+        thrust::make_zip_iterator(thrust::make_tuple(x_v, y_v, mass_v_.data()));
+      thrust::copy(rmm::exec_policy(stream)->on(stream),
+                   body_first,
+                   body_first + local_n_,
+                   thrust::make_zip_iterator(thrust::make_tuple(
+                     repulsion_.x_positions(), repulsion_.y_positions(), repulsion_.masses())));
+
+      repulsion_.compute(scaling_ratio_, theta_);
+
+      thrust::copy(rmm::exec_policy(stream)->on(stream),
+                   repulsion_.x_repulsions(),
+                   repulsion_.x_repulsions() + local_n_,
+                   rep_forces_v_.begin());
+      thrust::copy(rmm::exec_policy(stream)->on(stream),
+                   repulsion_.y_repulsions(),
+                   repulsion_.y_repulsions() + local_n_,
+                   rep_forces_v_.begin() + local_n_);
+    }
+
+    // 3. speed and position updates
+
+    compute_local_speed(rep_forces_v_.data(),
+                        rep_forces_v_.data() + local_n_,
+                        attract_v_.data(),
+                        attract_v_.data() + local_n_,
+                        old_forces_v_.data(),
+                        old_forces_v_.data() + local_n_,
+                        mass_v_.data(),
+                        swinging_v_.data(),
+                        traction_v_.data(),
+                        static_cast<vertex_t>(local_n_),
+                        stream);
+
+    // Compute global swinging and traction values
+    float s = thrust::reduce(
+      rmm::exec_policy(stream)->on(stream), swinging_v_.begin(), swinging_v_.end(), float{0.0});
+    float t = thrust::reduce(
+      rmm::exec_policy(stream)->on(stream), traction_v_.begin(), traction_v_.end(), float{0.0});
+    if (graph_view_t::is_multi_gpu) {
+      s = experimental::host_scalar_allreduce(handle_.get_comms(), s, stream);
+      t = experimental::host_scalar_allreduce(handle_.get_comms(), t, stream);
+    }
+
+    // Compute global speed based on gloab and local swinging and traction.
+    adapt_speed<vertex_t>(jitter_tolerance_,
+                          &jt_,
+                          &speed_,
+                          &speed_efficiency_,
+                          s,
+                          t,
+                          graph_view_.get_number_of_vertices());
+
+    // Update positions
+    apply_forces<vertex_t>(x_v,
+                           y_v,
+                           rep_forces_v_.data(),
+                           rep_forces_v_.data() + local_n_,
+                           attract_v_.data(),
+                           attract_v_.data() + local_n_,
+                           old_forces_v_.data(),
+                           old_forces_v_.data() + local_n_,
+                           swinging_v_.data(),
+                           speed_,
+                           static_cast<vertex_t>(local_n_),
+                           stream);
+
+    ++num_iterations_;
+
+    if (verbose_ && (!graph_view_t::is_multi_gpu || (handle_.get_comms().get_rank() == 0))) {
+      printf("iteration %i, speed: %f, speed_efficiency: %f, ",
+             num_iterations_,
+             speed_,
+             speed_efficiency_);
+      printf("jt: %f, ", jt_);
+      printf("swinging: %f, traction: %f\n", s, t);
+    }
+  }
+
+ private:
+  float *x_positions() { return pos_v_.data(); }
+  float *y_positions() { return pos_v_.data() + local_n_; }
+
+  raft::handle_t const &handle_;
+  graph_view_t graph_view_;
+
+  bool outbound_attraction_distribution_{true};
+  bool lin_log_mode_{false};
+  bool prevent_overlapping_{false};
+  float edge_weight_influence_{1.0};
+  float jitter_tolerance_{1.0};
+  float theta_{0.5};
+  float scaling_ratio_{2.0};
+  bool strong_gravity_mode_{false};
+  float gravity_{1.0};
+  bool verbose_{false};
+
+  int local_n_{0};
+
+  // local vertex states (x positions in [0, local_n_) and y positions in [local_n_, 2 * local_n_)
+  // for pos_v_ and the forces)
+  rmm::device_uvector<float> pos_v_;
+  rmm::device_uvector<int> mass_v_;
+  rmm::device_uvector<float> attract_v_;
+  rmm::device_uvector<float> rep_forces_v_;
+  rmm::device_uvector<float> old_forces_v_;
+  rmm::device_uvector<float> swinging_v_;
+  rmm::device_uvector<float> traction_v_;
+
+  // multi-GPU only
+  rmm::device_uvector<float> adj_matrix_row_xs_v_;
+  rmm::device_uvector<float> adj_matrix_row_ys_v_;
+  rmm::device_uvector<int> adj_matrix_row_masses_v_;
+  rmm::device_uvector<float> adj_matrix_col_xs_v_;
+  rmm::device_uvector<float> adj_matrix_col_ys_v_;
+
+  bh_repulsion_t repulsion_;
+
+  // Scalars used to adapt global speed.
+  float speed_{1.f};
+  float speed_efficiency_{1.f};
+  float outbound_att_compensation_{1.f};
+  float jt_{0.f};
+
+  int num_iterations_{0};
+};
+
+}  // namespace detail
+}  // namespace cugraph
@@ -13,14 +13,25 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
 #include <iostream>
 #include <limits>
+#include <memory>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <graph.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/count.h>
+#include <thrust/extrema.h>
 #include <thrust/for_each.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/logical.h>
 #include <thrust/random.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
 
 #include <utilities/error.hpp>
 
@@ -201,6 +212,422 @@ weight_t hungarian_sparse(raft::handle_t const &handle,
   return min_cost;
 }
 
+// Upper bound on the number of cost matrix elements handed to a single LinearAssignmentProblem
+// instance in the batched solver, this bounds the size of the (pooled) solver workspace.
+constexpr size_t batched_hungarian_max_elements_per_solve{size_t{1} << 26};
+
+template <typename weight_t>
+struct strided_cost_t {
+  weight_t const *costs;
+  size_t num_elements;
+  size_t stride;
+
+  __device__ weight_t operator()(size_t i) const
+  {
+    return costs[(i / num_elements) * stride + (i % num_elements)];
+  }
+};
+
+template <typename index_t>
+struct problem_index_t {
+  index_t size;
+
+  __device__ size_t operator()(size_t i) const { return i / static_cast<size_t>(size); }
+};
+
+template <typename index_t, typename weight_t>
+struct assigned_cost_t {
+  weight_t const *costs;
+  index_t const *assignments;
+  index_t size;
+  size_t stride;
+
+  __device__ weight_t operator()(size_t i) const
+  {
+    auto problem = i / static_cast<size_t>(size);
+    auto row     = i % static_cast<size_t>(size);
+    return costs[problem * stride + row * size + assignments[i]];
+  }
+};
+
+template <typename index_t, typename weight_t>
+void batched_hungarian(raft::handle_t const &handle,
+                       weight_t const *d_costs,
+                       index_t num_problems,
+                       index_t size,
+                       size_t stride,
+                       index_t *d_assignments,
+                       weight_t *d_min_costs,
+                       cudaStream_t stream)
+{
+  CUGRAPH_EXPECTS(num_problems >= 0, "Invalid input argument: num_problems should be non-negative");
+  CUGRAPH_EXPECTS(size > 0, "Invalid input argument: size should be positive");
+
+  size_t num_elements = static_cast<size_t>(size) * static_cast<size_t>(size);
+  CUGRAPH_EXPECTS(stride >= num_elements,
+                  "Invalid input argument: stride should be at least size * size");
+
+  if (num_problems == 0) { return; }
+
+  CUGRAPH_EXPECTS((d_costs != nullptr) && (d_assignments != nullptr) && (d_min_costs != nullptr),
+                  "Invalid input argument: costs, assignments and min_costs should not be NULL");
+
+  //
+  //  Problems are solved in chunks of up to max_batch_size problems, every chunk of the same size
+  //  reuses the same solver instance (and workspace), so there are at most two solver instances
+  //  (one for full chunks and one for the last, partial chunk).  If the problems are not packed
+  //  back to back, each chunk is gathered into a contiguous workspace first.
+  //
+  auto max_batch_size = static_cast<index_t>(std::min(
+    static_cast<size_t>(num_problems),
+    std::max(batched_hungarian_max_elements_per_solve / num_elements, size_t{1})));
+
+  rmm::device_vector<weight_t> packed_costs_v(stride != num_elements ? max_batch_size * num_elements
+                                                                     : size_t{0});
+  rmm::device_vector<index_t> col_assignments_v(static_cast<size_t>(max_batch_size) * size);
+
+  std::unique_ptr<raft::lap::LinearAssignmentProblem<index_t, weight_t>> full_batch_lpx{};
+  std::unique_ptr<raft::lap::LinearAssignmentProblem<index_t, weight_t>> partial_batch_lpx{};
+
+  for (index_t first = 0; first < num_problems; first += max_batch_size) {
+    auto batch_size          = std::min(max_batch_size, num_problems - first);
+    weight_t const *d_batch  = d_costs + static_cast<size_t>(first) * stride;
+    index_t *d_batch_assigns = d_assignments + static_cast<size_t>(first) * size;
+
+    if (stride != num_elements) {
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        thrust::make_counting_iterator(size_t{0}),
+                        thrust::make_counting_iterator(batch_size * num_elements),
+                        packed_costs_v.begin(),
+                        strided_cost_t<weight_t>{d_batch, num_elements, stride});
+      d_batch = packed_costs_v.data().get();
+    }
+
+    auto &lpx = (batch_size == max_batch_size) ? full_batch_lpx : partial_batch_lpx;
+    if (!lpx) {
+      lpx = std::make_unique<raft::lap::LinearAssignmentProblem<index_t, weight_t>>(
+        handle, size, batch_size);
+    }
+
+    lpx->solve(d_batch, d_batch_assigns, col_assignments_v.data().get());
+  }
+
+  //
+  //  Compute the objective values on device from the (original) costs rather than copying
+  //  per-problem objective values back to the host one at a time
+  //
+  thrust::reduce_by_key(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_transform_iterator(thrust::make_counting_iterator(size_t{0}),
+                                    problem_index_t<index_t>{size}),
+    thrust::make_transform_iterator(
+      thrust::make_counting_iterator(static_cast<size_t>(num_problems) * size),
+      problem_index_t<index_t>{size}),
+    thrust::make_transform_iterator(
+      thrust::make_counting_iterator(size_t{0}),
+      assigned_cost_t<index_t, weight_t>{d_costs, d_assignments, size, stride}),
+    thrust::make_discard_iterator(),
+    d_min_costs);
+}
+
+// Order preserving map from double precision values to unsigned integers, so bids can be
+// compared with an integer atomicMax
+__device__ inline unsigned long long int ordered_bid_key(double bid)
+{
+  auto bits = static_cast<unsigned long long int>(__double_as_longlong(bid));
+  return (bits & (1ull << 63)) ? ~bits : (bits | (1ull << 63));
+}
+
+// Epsilon is divided by this factor from one epsilon scaling phase to the next
+constexpr double auction_epsilon_scaling_factor{4.0};
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+weight_t auction_sparse(raft::handle_t const &handle,
+                        GraphCOOView<vertex_t, edge_t, weight_t> const &graph,
+                        vertex_t num_workers,
+                        vertex_t const *workers,
+                        vertex_t *assignment,
+                        double epsilon,
+                        cudaStream_t stream)
+{
+  CUGRAPH_EXPECTS(assignment != nullptr, "Invalid input argument: assignment pointer is NULL");
+  CUGRAPH_EXPECTS(graph.edge_data != nullptr,
+                  "Invalid input argument: graph must have edge data (costs)");
+  CUGRAPH_EXPECTS(epsilon >= 0.0, "Invalid input argument: epsilon should be non-negative");
+
+  vertex_t num_tasks = graph.number_of_vertices - num_workers;
+  CUGRAPH_EXPECTS(num_workers <= num_tasks,
+                  "Invalid input argument: there are more workers than tasks, no feasible "
+                  "assignment exists");
+
+  if (num_workers == 0) { return weight_t{0}; }
+
+  //
+  //  Renumber vertices internally.  Workers become [0, num_workers), tasks become
+  //  [0, num_tasks)
+  //
+  rmm::device_vector<vertex_t> worker_ids_v(graph.number_of_vertices, vertex_t{-1});
+  rmm::device_vector<vertex_t> task_ids_v(graph.number_of_vertices);
+  rmm::device_vector<vertex_t> tasks_v(num_tasks);
+
+  vertex_t *d_worker_ids = worker_ids_v.data().get();
+  vertex_t *d_task_ids   = task_ids_v.data().get();
+  vertex_t *d_tasks      = tasks_v.data().get();
+
+  thrust::sequence(rmm::exec_policy(stream)->on(stream), task_ids_v.begin(), task_ids_v.end());
+  thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                   thrust::make_counting_iterator<vertex_t>(0),
+                   thrust::make_counting_iterator<vertex_t>(num_workers),
+                   [d_worker_ids, d_task_ids, workers] __device__(vertex_t v) {
+                     d_worker_ids[workers[v]] = v;
+                     d_task_ids[workers[v]]   = -1;
+                   });
+  thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                  task_ids_v.begin(),
+                  task_ids_v.end(),
+                  tasks_v.begin(),
+                  [] __device__(vertex_t v) { return v >= 0; });
+  thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                   thrust::make_counting_iterator<vertex_t>(0),
+                   thrust::make_counting_iterator<vertex_t>(num_tasks),
+                   [d_task_ids, d_tasks] __device__(vertex_t v) { d_task_ids[d_tasks[v]] = v; });
+
+  //
+  //  Keep the worker -> task edges only and build a CSR (rows are workers) on them, the cost
+  //  matrix is never densified
+  //
+  rmm::device_vector<vertex_t> rows_v(graph.number_of_edges);
+  rmm::device_vector<vertex_t> cols_v(graph.number_of_edges);
+  rmm::device_vector<weight_t> costs_v(graph.edge_data, graph.edge_data + graph.number_of_edges);
+
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    graph.src_indices,
+                    graph.src_indices + graph.number_of_edges,
+                    rows_v.begin(),
+                    [d_worker_ids] __device__(vertex_t v) { return d_worker_ids[v]; });
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    graph.dst_indices,
+                    graph.dst_indices + graph.number_of_edges,
+                    cols_v.begin(),
+                    [d_task_ids] __device__(vertex_t v) { return d_task_ids[v]; });
+
+  auto edge_first = thrust::make_zip_iterator(
+    thrust::make_tuple(rows_v.begin(), cols_v.begin(), costs_v.begin()));
+  auto num_edges = static_cast<edge_t>(thrust::distance(
+    edge_first,
+    thrust::remove_if(rmm::exec_policy(stream)->on(stream),
+                      edge_first,
+                      edge_first + graph.number_of_edges,
+                      [] __device__(auto e) {
+                        return (thrust::get<0>(e) < 0) || (thrust::get<1>(e) < 0);
+                      })));
+  rows_v.resize(num_edges);
+  cols_v.resize(num_edges);
+  costs_v.resize(num_edges);
+
+  CUGRAPH_EXPECTS(num_edges > 0, "Invalid input argument: no feasible assignment exists");
+
+  thrust::sort_by_key(rmm::exec_policy(stream)->on(stream),
+                      rows_v.begin(),
+                      rows_v.end(),
+                      thrust::make_zip_iterator(
+                        thrust::make_tuple(cols_v.begin(), costs_v.begin())));
+
+  rmm::device_vector<edge_t> offsets_v(num_workers + 1);
+  thrust::lower_bound(rmm::exec_policy(stream)->on(stream),
+                      rows_v.begin(),
+                      rows_v.end(),
+                      thrust::make_counting_iterator<vertex_t>(0),
+                      thrust::make_counting_iterator<vertex_t>(num_workers + 1),
+                      offsets_v.begin());
+
+  edge_t const *d_offsets = offsets_v.data().get();
+  vertex_t const *d_cols  = cols_v.data().get();
+  weight_t const *d_costs = costs_v.data().get();
+
+  CUGRAPH_EXPECTS(thrust::none_of(rmm::exec_policy(stream)->on(stream),
+                                  thrust::make_counting_iterator<vertex_t>(0),
+                                  thrust::make_counting_iterator<vertex_t>(num_workers),
+                                  [d_offsets] __device__(vertex_t v) {
+                                    return d_offsets[v] == d_offsets[v + 1];
+                                  }),
+                  "Invalid input argument: a worker has no task, no feasible assignment exists");
+
+  auto cost_range = thrust::minmax_element(
+    rmm::exec_policy(stream)->on(stream), costs_v.begin(), costs_v.end());
+  double cost_span = static_cast<double>(static_cast<weight_t>(*cost_range.second)) -
+                     static_cast<double>(static_cast<weight_t>(*cost_range.first));
+
+  //
+  //  Forward auction with epsilon scaling (Bertsekas).  Workers bid for tasks, the price of a
+  //  task goes up by (at least) epsilon with every accepted bid.  The final assignment is within
+  //  num_workers * final_epsilon of the optimal, so 1 / (num_workers + 1) guarantees an optimal
+  //  assignment for integer costs.
+  //
+  double final_epsilon = epsilon > 0.0 ? epsilon : 1.0 / (static_cast<double>(num_workers) + 1.0);
+  double phase_epsilon = std::max(cost_span / auction_epsilon_scaling_factor, final_epsilon);
+
+  auto constexpr invalid_id = std::numeric_limits<vertex_t>::max();
+
+  rmm::device_vector<double> prices_v(num_tasks, 0.0);
+  rmm::device_vector<vertex_t> worker_to_task_v(num_workers);
+  rmm::device_vector<vertex_t> task_to_worker_v(num_tasks);
+  rmm::device_vector<vertex_t> bid_tasks_v(num_workers);
+  rmm::device_vector<double> bid_values_v(num_workers);
+  rmm::device_vector<weight_t> bid_costs_v(num_workers);
+  rmm::device_vector<weight_t> assigned_costs_v(num_workers);
+  rmm::device_vector<unsigned long long int> best_bids_v(num_tasks, 0ull);
+  rmm::device_vector<vertex_t> winners_v(num_tasks, invalid_id);
+  rmm::device_vector<int> infeasible_v(1, 0);
+
+  double *d_prices                    = prices_v.data().get();
+  vertex_t *d_worker_to_task          = worker_to_task_v.data().get();
+  vertex_t *d_task_to_worker          = task_to_worker_v.data().get();
+  vertex_t *d_bid_tasks               = bid_tasks_v.data().get();
+  double *d_bid_values                = bid_values_v.data().get();
+  weight_t *d_bid_costs               = bid_costs_v.data().get();
+  weight_t *d_assigned_costs          = assigned_costs_v.data().get();
+  unsigned long long int *d_best_bids = best_bids_v.data().get();
+  vertex_t *d_winners                 = winners_v.data().get();
+  int *d_infeasible                   = infeasible_v.data().get();
+
+  while (true) {
+    thrust::fill(rmm::exec_policy(stream)->on(stream),
+                 worker_to_task_v.begin(),
+                 worker_to_task_v.end(),
+                 vertex_t{-1});
+    thrust::fill(rmm::exec_policy(stream)->on(stream),
+                 task_to_worker_v.begin(),
+                 task_to_worker_v.end(),
+                 vertex_t{-1});
+
+    //
+    //  In a feasible problem, no task price rises above this (loose) bound within a phase, a
+    //  price exceeding it means that some workers can never be assigned
+    //
+    auto price_range = thrust::minmax_element(
+      rmm::exec_policy(stream)->on(stream), prices_v.begin(), prices_v.end());
+    double max_price   = *price_range.second;
+    double min_price   = *price_range.first;
+    double price_bound = max_price + (max_price - min_price) +
+                         4.0 * (static_cast<double>(num_workers) + 1.0) *
+                           (cost_span + phase_epsilon);
+    double eps = phase_epsilon;
+
+    vertex_t num_unassigned{num_workers};
+    while (num_unassigned > 0) {
+      // 1. every unassigned worker bids for its most profitable task
+      thrust::for_each(
+        rmm::exec_policy(stream)->on(stream),
+        thrust::make_counting_iterator<vertex_t>(0),
+        thrust::make_counting_iterator<vertex_t>(num_workers),
+        [d_offsets,
+         d_cols,
+         d_costs,
+         d_prices,
+         d_worker_to_task,
+         d_bid_tasks,
+         d_bid_values,
+         d_bid_costs,
+         d_best_bids,
+         cost_span,
+         eps] __device__(vertex_t w) {
+          if (d_worker_to_task[w] >= 0) {
+            d_bid_tasks[w] = -1;
+            return;
+          }
+          auto best_value   = -std::numeric_limits<double>::max();
+          auto second_value = -std::numeric_limits<double>::max();
+          vertex_t best_task{-1};
+          weight_t best_cost{0};
+          for (edge_t e = d_offsets[w]; e < d_offsets[w + 1]; ++e) {
+            auto value = -static_cast<double>(d_costs[e]) - d_prices[d_cols[e]];
+            if (value > best_value) {
+              second_value = best_value;
+              best_value   = value;
+              best_task    = d_cols[e];
+              best_cost    = d_costs[e];
+            } else if (value > second_value) {
+              second_value = value;
+            }
+          }
+          auto increment = (second_value > -std::numeric_limits<double>::max())
+                             ? (best_value - second_value)
+                             : cost_span;
+          auto bid        = d_prices[best_task] + increment + eps;
+          d_bid_tasks[w]  = best_task;
+          d_bid_values[w] = bid;
+          d_bid_costs[w]  = best_cost;
+          atomicMax(d_best_bids + best_task, ordered_bid_key(bid));
+        });
+
+      // 2. the highest bidder (lowest worker id on ties) wins each task
+      thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<vertex_t>(0),
+                       thrust::make_counting_iterator<vertex_t>(num_workers),
+                       [d_bid_tasks, d_bid_values, d_best_bids, d_winners] __device__(vertex_t w) {
+                         auto t = d_bid_tasks[w];
+                         if ((t >= 0) && (ordered_bid_key(d_bid_values[w]) == d_best_bids[t])) {
+                           atomicMin(d_winners + t, w);
+                         }
+                       });
+
+      // 3. assign the tasks to the winners and raise the prices, previous owners are unassigned
+      thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<vertex_t>(0),
+                       thrust::make_counting_iterator<vertex_t>(num_tasks),
+                       [d_worker_to_task,
+                        d_task_to_worker,
+                        d_bid_values,
+                        d_bid_costs,
+                        d_assigned_costs,
+                        d_prices,
+                        d_best_bids,
+                        d_winners,
+                        d_infeasible,
+                        price_bound,
+                        invalid_id] __device__(vertex_t t) {
+                         auto w = d_winners[t];
+                         if (w == invalid_id) { return; }
+                         auto previous = d_task_to_worker[t];
+                         if (previous >= 0) { d_worker_to_task[previous] = -1; }
+                         d_task_to_worker[t] = w;
+                         d_worker_to_task[w] = t;
+                         d_assigned_costs[w] = d_bid_costs[w];
+                         d_prices[t]         = d_bid_values[w];
+                         if (d_bid_values[w] > price_bound) { *d_infeasible = 1; }
+                         d_best_bids[t] = 0ull;
+                         d_winners[t]   = invalid_id;
+                       });
+
+      CUGRAPH_EXPECTS(infeasible_v[0] == 0,
+                      "Invalid input argument: no feasible assignment exists");
+
+      num_unassigned = static_cast<vertex_t>(thrust::count(rmm::exec_policy(stream)->on(stream),
+                                                           worker_to_task_v.begin(),
+                                                           worker_to_task_v.end(),
+                                                           vertex_t{-1}));
+    }
+
+    if (phase_epsilon <= final_epsilon) { break; }
+    phase_epsilon = std::max(phase_epsilon / auction_epsilon_scaling_factor, final_epsilon);
+  }
+
+  //
+  //  Translate the assignment back to the original vertex ids
+  //
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    worker_to_task_v.begin(),
+                    worker_to_task_v.end(),
+                    assignment,
+                    [d_tasks] __device__(vertex_t t) { return d_tasks[t]; });
+
+  return thrust::reduce(rmm::exec_policy(stream)->on(stream),
+                        assigned_costs_v.begin(),
+                        assigned_costs_v.end(),
+                        weight_t{0});
+}
+
 }  // namespace detail
 
 template <typename vertex_t, typename edge_t, typename weight_t>
@@ -232,6 +659,43 @@ template double hungarian<int32_t, int32_t, double>(raft::handle_t const &,
                                                     int32_t const *,
                                                     int32_t *);
 
+namespace sparse {
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+weight_t hungarian(raft::handle_t const &handle,
+                   GraphCOOView<vertex_t, edge_t, weight_t> const &graph,
+                   vertex_t num_workers,
+                   vertex_t const *workers,
+                   vertex_t *assignment,
+                   double epsilon)
+{
+  cudaStream_t stream{0};
+
+  return detail::auction_sparse(handle, graph, num_workers, workers, assignment, epsilon, stream);
+}
+
+template int32_t hungarian<int32_t, int32_t, int32_t>(
+  raft::handle_t const &,
+  GraphCOOView<int32_t, int32_t, int32_t> const &,
+  int32_t,
+  int32_t const *,
+  int32_t *,
+  double);
+template float hungarian<int32_t, int32_t, float>(raft::handle_t const &,
+                                                  GraphCOOView<int32_t, int32_t, float> const &,
+                                                  int32_t,
+                                                  int32_t const *,
+                                                  int32_t *,
+                                                  double);
+template double hungarian<int32_t, int32_t, double>(raft::handle_t const &,
+                                                    GraphCOOView<int32_t, int32_t, double> const &,
+                                                    int32_t,
+                                                    int32_t const *,
+                                                    int32_t *,
+                                                    double);
+
+}  // namespace sparse
+
 namespace dense {
 
 template <typename index_t, typename weight_t>
@@ -253,6 +717,28 @@ template float hungarian<int32_t, float>(
 template double hungarian<int32_t, double>(
   raft::handle_t const &, double const *, int32_t, int32_t, int32_t *);
 
+template <typename index_t, typename weight_t>
+void batched_hungarian(raft::handle_t const &handle,
+                       weight_t const *costs,
+                       index_t num_problems,
+                       index_t size,
+                       size_t stride,
+                       index_t *assignments,
+                       weight_t *min_costs)
+{
+  cudaStream_t stream{0};
+
+  detail::batched_hungarian(
+    handle, costs, num_problems, size, stride, assignments, min_costs, stream);
+}
+
+template void batched_hungarian<int32_t, int32_t>(
+  raft::handle_t const &, int32_t const *, int32_t, int32_t, size_t, int32_t *, int32_t *);
+template void batched_hungarian<int32_t, float>(
+  raft::handle_t const &, float const *, int32_t, int32_t, size_t, int32_t *, float *);
+template void batched_hungarian<int32_t, double>(
+  raft::handle_t const &, double const *, int32_t, int32_t, size_t, int32_t *, double *);
+
 }  // namespace dense
 
 }  // namespace cugraph
@@ -14,25 +14,22 @@
  * limitations under the License.
  */
 
-/**
- * ---------------------------------------------------------------------------*
- * @brief wrapper calling gunrock's HITS analytic
- * --------------------------------------------------------------------------*/
-
 #include <algorithms.hpp>
+#include <experimental/graph_view.hpp>
 #include <graph.hpp>
 
 #include <utilities/error.hpp>
 
-#include <gunrock/gunrock.h>
+#include <raft/handle.hpp>
+
+#include <vector>
 
 namespace cugraph {
 
+// FIXME: this legacy API no longer calls gunrock, the namespace is kept for the existing Python
+// binding and should be removed once the binding moves to experimental::hits()
 namespace gunrock {
 
-const int HOST{1};    // gunrock should expose the device constant at the API level.
-const int DEVICE{2};  // gunrock should expose the device constant at the API level.
-
 template <typename vertex_t, typename edge_t, typename weight_t>
 void hits(cugraph::GraphCSRView<vertex_t, edge_t, weight_t> const &graph,
           int max_iter,
@@ -45,20 +42,35 @@ void hits(cugraph::GraphCSRView<vertex_t, edge_t, weight_t> const &graph,
   CUGRAPH_EXPECTS(hubs != nullptr, "Invalid input argument: hubs array should be of size V");
   CUGRAPH_EXPECTS(authorities != nullptr,
                   "Invalid input argument: authorities array should be of size V");
+  CUGRAPH_EXPECTS(max_iter > 0, "Invalid input argument: max_iter should be positive.");
+
+  raft::handle_t handle{};
+
+  // The CSR of the input graph is the CSC of the reversed graph, so the input arrays are used as
+  // they are (no format conversion) as a pull model graph view of the reversed graph. Hub values in
+  // the reversed graph are authority values in the input graph and vice versa.
+  experimental::graph_view_t<vertex_t, edge_t, weight_t, true, false> reversed_graph_view(
+    handle,
+    graph.offsets,
+    graph.indices,
+    static_cast<weight_t const *>(nullptr) /* edge weights are not used */,
+    std::vector<vertex_t>{},
+    graph.number_of_vertices,
+    graph.number_of_edges,
+    experimental::graph_properties_t{false, false, false},
+    false);
 
   //
-  //  NOTE:  gunrock doesn't support passing a starting value
+  //  NOTE:  starting_value is not supported (yet)
   //
-  ::hits(graph.number_of_vertices,
-         graph.number_of_edges,
-         graph.offsets,
-         graph.indices,
-         max_iter,
-         tolerance,
-         HITS_NORMALIZATION_METHOD_1,
-         hubs,
-         authorities,
-         DEVICE);
+  experimental::hits(handle,
+                     reversed_graph_view,
+                     authorities,
+                     hubs,
+                     tolerance,
+                     static_cast<size_t>(max_iter),
+                     false,
+                     normalized);
 }
 
 template void hits(cugraph::GraphCSRView<int32_t, int32_t, float> const &,
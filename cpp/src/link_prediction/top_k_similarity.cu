@@ -0,0 +1,467 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** ---------------------------------------------------------------------------*
+ * @brief Top-K Jaccard/Overlap similarity over the two hop neighbor pairs
+ *
+ * @file top_k_similarity.cu
+ * ---------------------------------------------------------------------------**/
+
+#include <algorithms.hpp>
+#include <graph.hpp>
+#include <utilities/error.hpp>
+#include "utilities/heap.cuh"
+
+#include <raft/cudart_utils.h>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+
+namespace cugraph {
+namespace detail {
+
+template <typename VT, typename WT>
+struct scored_vertex_t {
+  WT score;
+  VT vertex;
+};
+
+// a is worse than b (lower score, ties broken by larger vertex ID), the top of a heap using this
+// comparison is the worst of the top-K candidates
+template <typename VT, typename WT>
+struct worse_candidate_t {
+  __host__ __device__ bool operator()(scored_vertex_t<VT, WT> const &a,
+                                      scored_vertex_t<VT, WT> const &b) const
+  {
+    return (a.score < b.score) || ((a.score == b.score) && (a.vertex > b.vertex));
+  }
+};
+
+// (first, score, second) ordered by first, score (descending), and second
+template <typename VT, typename WT>
+struct candidate_less_t {
+  __device__ bool operator()(thrust::tuple<VT, WT, VT> const &a,
+                             thrust::tuple<VT, WT, VT> const &b) const
+  {
+    if (thrust::get<0>(a) != thrust::get<0>(b)) { return thrust::get<0>(a) < thrust::get<0>(b); }
+    if (thrust::get<1>(a) != thrust::get<1>(b)) { return thrust::get<1>(a) > thrust::get<1>(b); }
+    return thrust::get<2>(a) < thrust::get<2>(b);
+  }
+};
+
+// Volume of neighboors
+template <typename VT, typename ET, typename WT>
+struct vertex_volume_t {
+  ET const *offsets{nullptr};
+  VT const *indices{nullptr};
+  WT const *weights{nullptr};
+
+  __device__ WT operator()(VT v) const
+  {
+    if (weights == nullptr) { return static_cast<WT>(offsets[v + 1] - offsets[v]); }
+    WT sum{0.0};
+    for (auto e = offsets[v]; e < offsets[v + 1]; ++e) { sum += weights[indices[e]]; }
+    return sum;
+  }
+};
+
+// number of two hop paths starting with an edge (the degree of the edge destination)
+template <typename VT, typename ET>
+struct wedge_count_t {
+  ET const *offsets{nullptr};
+
+  __device__ size_t operator()(VT dst) const
+  {
+    return static_cast<size_t>(offsets[dst + 1] - offsets[dst]);
+  }
+};
+
+// i-th two hop path (u, w, x) => (u, x)
+template <typename VT, typename ET>
+struct expand_wedge_t {
+  ET const *offsets{nullptr};
+  VT const *indices{nullptr};
+  size_t const *wedge_offsets{nullptr};  // size = # edges + 1
+  VT num_vertices{0};
+  ET num_edges{0};
+
+  __device__ thrust::tuple<VT, VT> operator()(size_t i) const
+  {
+    auto e = static_cast<ET>(thrust::distance(
+      wedge_offsets + 1,
+      thrust::upper_bound(thrust::seq, wedge_offsets + 1, wedge_offsets + num_edges + 1, i)));
+    auto u = static_cast<VT>(thrust::distance(
+      offsets + 1, thrust::upper_bound(thrust::seq, offsets + 1, offsets + num_vertices + 1, e)));
+    auto w = indices[e];
+    return thrust::make_tuple(u, indices[offsets[w] + static_cast<ET>(i - wedge_offsets[e])]);
+  }
+};
+
+template <typename VT>
+struct is_self_pair_t {
+  __device__ bool operator()(thrust::tuple<VT, VT> pair) const
+  {
+    return thrust::get<0>(pair) == thrust::get<1>(pair);
+  }
+};
+
+// Jaccard (or overlap) similarity of a vertex pair, column indices are sorted within each row
+template <bool overlap, typename VT, typename ET, typename WT>
+struct pair_similarity_t {
+  ET const *offsets{nullptr};
+  VT const *indices{nullptr};
+  WT const *weights{nullptr};
+  WT const *volumes{nullptr};
+
+  __device__ WT operator()(thrust::tuple<VT, VT> pair) const
+  {
+    auto row = thrust::get<0>(pair);
+    auto col = thrust::get<1>(pair);
+
+    // find which row has least elements (and call it reference row)
+    auto Ni  = offsets[row + 1] - offsets[row];
+    auto Nj  = offsets[col + 1] - offsets[col];
+    auto ref = (Ni < Nj) ? row : col;
+    auto cur = (Ni < Nj) ? col : row;
+
+    WT intersection{0.0};
+    for (auto i = offsets[ref]; i < offsets[ref + 1]; ++i) {
+      auto ref_col = indices[i];
+      if (thrust::binary_search(
+            thrust::seq, indices + offsets[cur], indices + offsets[cur + 1], ref_col)) {
+        intersection += (weights != nullptr) ? weights[ref_col] : WT{1.0};
+      }
+    }
+
+    auto denominator = overlap ? min(volumes[row], volumes[col])
+                               : volumes[row] + volumes[col] - intersection;
+    return denominator > WT{0.0} ? intersection / denominator : WT{0.0};
+  }
+};
+
+template <typename VT, typename WT>
+struct within_top_k_t {
+  VT const *firsts{nullptr};  // sorted
+  size_t num_candidates{0};
+  VT k{0};
+
+  __device__ bool operator()(size_t i) const
+  {
+    auto segment_first = static_cast<size_t>(thrust::distance(
+      firsts, thrust::lower_bound(thrust::seq, firsts, firsts + num_candidates, firsts[i])));
+    return (i - segment_first) < static_cast<size_t>(k);
+  }
+};
+
+template <typename VT>
+struct is_segment_head_t {
+  VT const *firsts{nullptr};
+
+  __device__ bool operator()(size_t i) const { return (i == 0) || (firsts[i] != firsts[i - 1]); }
+};
+
+// merges a batch's (at most k) candidates of a vertex into the vertex's heap
+template <typename VT, typename WT>
+struct update_heaps_t {
+  VT const *firsts{nullptr};
+  WT const *scores{nullptr};
+  VT const *seconds{nullptr};
+  size_t const *segment_heads{nullptr};
+  size_t num_segments{0};
+  size_t num_candidates{0};
+  scored_vertex_t<VT, WT> *heaps{nullptr};
+  VT *heap_sizes{nullptr};
+  VT k{0};
+
+  __device__ void operator()(size_t s) const
+  {
+    auto first = segment_heads[s];
+    auto last  = (s + 1 < num_segments) ? segment_heads[s + 1] : num_candidates;
+    auto u     = firsts[first];
+    auto heap  = heaps + static_cast<size_t>(u) * static_cast<size_t>(k);
+    auto size  = heap_sizes[u];
+
+    worse_candidate_t<VT, WT> compare{};
+    for (auto i = first; i < last; ++i) {
+      scored_vertex_t<VT, WT> candidate{scores[i], seconds[i]};
+
+      // a pair can appear in multiple batches (with the same score)
+      bool found{false};
+      for (VT j = 0; j < size; ++j) {
+        if (heap[j].vertex == candidate.vertex) {
+          found = true;
+          break;
+        }
+      }
+      if (found) { continue; }
+
+      if (size < k) {
+        heap::heap_push(heap, size, candidate, compare);
+        ++size;
+      } else if (compare(heap[0], candidate)) {
+        heap::heap_replace_top(heap, size, candidate, compare);
+      } else {
+        break;  // candidates are sorted by score (descending)
+      }
+    }
+    heap_sizes[u] = size;
+  }
+};
+
+template <typename VT, typename ET, typename WT>
+struct extract_heap_t {
+  scored_vertex_t<VT, WT> *heaps{nullptr};
+  VT const *heap_sizes{nullptr};
+  ET const *output_offsets{nullptr};
+  VT k{0};
+  VT *srcs{nullptr};
+  VT *dsts{nullptr};
+  WT *scores{nullptr};
+
+  __device__ void operator()(VT u) const
+  {
+    auto heap   = heaps + static_cast<size_t>(u) * static_cast<size_t>(k);
+    auto offset = output_offsets[u];
+
+    worse_candidate_t<VT, WT> compare{};
+    for (auto size = heap_sizes[u]; size > 0; --size) {
+      // pop the worst first to order the output by score (descending)
+      auto top                  = heap::heap_pop(heap, size, compare);
+      srcs[offset + size - 1]   = u;
+      dsts[offset + size - 1]   = top.vertex;
+      scores[offset + size - 1] = top.score;
+    }
+  }
+};
+
+template <bool overlap, typename VT, typename ET, typename WT>
+std::unique_ptr<GraphCOO<VT, ET, WT>> top_k_similarity(GraphCSRView<VT, ET, WT> const &graph,
+                                                       WT const *weights,
+                                                       VT k,
+                                                       size_t max_pairs_per_batch)
+{
+  CUGRAPH_EXPECTS(k > 0, "Invalid input argument: k should be positive.");
+  CUGRAPH_EXPECTS(max_pairs_per_batch > 0,
+                  "Invalid input argument: max_pairs_per_batch should be positive.");
+
+  cudaStream_t stream{nullptr};
+
+  auto const num_vertices = graph.number_of_vertices;
+  auto const num_edges    = graph.number_of_edges;
+
+  rmm::device_uvector<WT> volumes_v(num_vertices, stream);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator(VT{0}),
+                    thrust::make_counting_iterator(num_vertices),
+                    volumes_v.begin(),
+                    vertex_volume_t<VT, ET, WT>{graph.offsets, graph.indices, weights});
+
+  // Find the number of two hop paths of each edge, and take the inclusive sum
+  rmm::device_uvector<size_t> wedge_offsets_v(num_edges + 1, stream);
+  size_t zero{0};
+  wedge_offsets_v.set_element_async(0, zero, stream);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    graph.indices,
+                    graph.indices + num_edges,
+                    wedge_offsets_v.begin() + 1,
+                    wedge_count_t<VT, ET>{graph.offsets});
+  thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         wedge_offsets_v.begin() + 1,
+                         wedge_offsets_v.end(),
+                         wedge_offsets_v.begin() + 1);
+  size_t num_wedges{};
+  raft::update_host(&num_wedges, wedge_offsets_v.data() + num_edges, 1, stream);
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  rmm::device_uvector<scored_vertex_t<VT, WT>> heaps_v(
+    static_cast<size_t>(num_vertices) * static_cast<size_t>(k), stream);
+  rmm::device_uvector<VT> heap_sizes_v(num_vertices, stream);
+  thrust::fill(
+    rmm::exec_policy(stream)->on(stream), heap_sizes_v.begin(), heap_sizes_v.end(), VT{0});
+
+  auto batch_size = std::min(max_pairs_per_batch, num_wedges);
+  rmm::device_uvector<VT> firsts_v(batch_size, stream);
+  rmm::device_uvector<VT> seconds_v(batch_size, stream);
+  rmm::device_uvector<WT> scores_v(batch_size, stream);
+  rmm::device_uvector<bool> keep_flags_v(batch_size, stream);
+  rmm::device_uvector<size_t> segment_heads_v(batch_size, stream);
+
+  // Process the two hop paths in batches (the two hop paths of a hub vertex can span multiple
+  // batches), only the best k candidates of each vertex are kept across the batches
+  for (size_t batch_first = 0; batch_first < num_wedges; batch_first += batch_size) {
+    auto batch_last = std::min(batch_first + batch_size, num_wedges);
+
+    auto pair_first =
+      thrust::make_zip_iterator(thrust::make_tuple(firsts_v.begin(), seconds_v.begin()));
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator(batch_first),
+                      thrust::make_counting_iterator(batch_last),
+                      pair_first,
+                      expand_wedge_t<VT, ET>{graph.offsets,
+                                             graph.indices,
+                                             wedge_offsets_v.data(),
+                                             num_vertices,
+                                             num_edges});
+
+    // Remove self pairings and duplicates
+    auto num_pairs = static_cast<size_t>(thrust::distance(
+      pair_first,
+      thrust::remove_if(rmm::exec_policy(stream)->on(stream),
+                        pair_first,
+                        pair_first + (batch_last - batch_first),
+                        is_self_pair_t<VT>{})));
+    thrust::sort(rmm::exec_policy(stream)->on(stream), pair_first, pair_first + num_pairs);
+    num_pairs = static_cast<size_t>(thrust::distance(
+      pair_first,
+      thrust::unique(rmm::exec_policy(stream)->on(stream), pair_first, pair_first + num_pairs)));
+
+    thrust::transform(
+      rmm::exec_policy(stream)->on(stream),
+      pair_first,
+      pair_first + num_pairs,
+      scores_v.begin(),
+      pair_similarity_t<overlap, VT, ET, WT>{
+        graph.offsets, graph.indices, weights, volumes_v.data()});
+
+    // Keep (at most) the best k candidates of each vertex in this batch
+    auto candidate_first = thrust::make_zip_iterator(
+      thrust::make_tuple(firsts_v.begin(), scores_v.begin(), seconds_v.begin()));
+    thrust::sort(rmm::exec_policy(stream)->on(stream),
+                 candidate_first,
+                 candidate_first + num_pairs,
+                 candidate_less_t<VT, WT>{});
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator(size_t{0}),
+                      thrust::make_counting_iterator(num_pairs),
+                      keep_flags_v.begin(),
+                      within_top_k_t<VT, WT>{firsts_v.data(), num_pairs, k});
+    auto num_candidates = static_cast<size_t>(thrust::distance(
+      candidate_first,
+      thrust::remove_if(rmm::exec_policy(stream)->on(stream),
+                        candidate_first,
+                        candidate_first + num_pairs,
+                        keep_flags_v.begin(),
+                        thrust::logical_not<bool>())));
+
+    auto num_segments = static_cast<size_t>(
+      thrust::distance(segment_heads_v.begin(),
+                       thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                       thrust::make_counting_iterator(size_t{0}),
+                                       thrust::make_counting_iterator(num_candidates),
+                                       segment_heads_v.begin(),
+                                       is_segment_head_t<VT>{firsts_v.data()})));
+
+    thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator(size_t{0}),
+                     thrust::make_counting_iterator(num_segments),
+                     update_heaps_t<VT, WT>{firsts_v.data(),
+                                            scores_v.data(),
+                                            seconds_v.data(),
+                                            segment_heads_v.data(),
+                                            num_segments,
+                                            num_candidates,
+                                            heaps_v.data(),
+                                            heap_sizes_v.data(),
+                                            k});
+  }
+
+  firsts_v.release();
+  seconds_v.release();
+  scores_v.release();
+  keep_flags_v.release();
+  segment_heads_v.release();
+  wedge_offsets_v.release();
+
+  // Get things ready to return
+  rmm::device_uvector<ET> output_offsets_v(num_vertices + 1, stream);
+  ET output_zero{0};
+  output_offsets_v.set_element_async(0, output_zero, stream);
+  thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         heap_sizes_v.begin(),
+                         heap_sizes_v.end(),
+                         output_offsets_v.begin() + 1);
+  ET output_size{};
+  raft::update_host(&output_size, output_offsets_v.data() + num_vertices, 1, stream);
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  auto result = std::make_unique<GraphCOO<VT, ET, WT>>(num_vertices, output_size, true);
+
+  thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                   thrust::make_counting_iterator(VT{0}),
+                   thrust::make_counting_iterator(num_vertices),
+                   extract_heap_t<VT, ET, WT>{heaps_v.data(),
+                                              heap_sizes_v.data(),
+                                              output_offsets_v.data(),
+                                              k,
+                                              result->src_indices(),
+                                              result->dst_indices(),
+                                              result->edge_data()});
+
+  return result;
+}
+
+}  // namespace detail
+
+template <typename VT, typename ET, typename WT>
+std::unique_ptr<GraphCOO<VT, ET, WT>> jaccard_top_k(GraphCSRView<VT, ET, WT> const &graph,
+                                                    WT const *weights,
+                                                    VT k,
+                                                    size_t max_pairs_per_batch)
+{
+  return detail::top_k_similarity<false>(graph, weights, k, max_pairs_per_batch);
+}
+
+template <typename VT, typename ET, typename WT>
+std::unique_ptr<GraphCOO<VT, ET, WT>> overlap_top_k(GraphCSRView<VT, ET, WT> const &graph,
+                                                    WT const *weights,
+                                                    VT k,
+                                                    size_t max_pairs_per_batch)
+{
+  return detail::top_k_similarity<true>(graph, weights, k, max_pairs_per_batch);
+}
+
+template std::unique_ptr<GraphCOO<int32_t, int32_t, float>> jaccard_top_k(
+  GraphCSRView<int32_t, int32_t, float> const &, float const *, int32_t, size_t);
+template std::unique_ptr<GraphCOO<int32_t, int32_t, double>> jaccard_top_k(
+  GraphCSRView<int32_t, int32_t, double> const &, double const *, int32_t, size_t);
+template std::unique_ptr<GraphCOO<int64_t, int64_t, float>> jaccard_top_k(
+  GraphCSRView<int64_t, int64_t, float> const &, float const *, int64_t, size_t);
+template std::unique_ptr<GraphCOO<int64_t, int64_t, double>> jaccard_top_k(
+  GraphCSRView<int64_t, int64_t, double> const &, double const *, int64_t, size_t);
+template std::unique_ptr<GraphCOO<int32_t, int32_t, float>> overlap_top_k(
+  GraphCSRView<int32_t, int32_t, float> const &, float const *, int32_t, size_t);
+template std::unique_ptr<GraphCOO<int32_t, int32_t, double>> overlap_top_k(
+  GraphCSRView<int32_t, int32_t, double> const &, double const *, int32_t, size_t);
+template std::unique_ptr<GraphCOO<int64_t, int64_t, float>> overlap_top_k(
+  GraphCSRView<int64_t, int64_t, float> const &, float const *, int64_t, size_t);
+template std::unique_ptr<GraphCOO<int64_t, int64_t, double>> overlap_top_k(
+  GraphCSRView<int64_t, int64_t, double> const &, double const *, int64_t, size_t);
+
+}  // namespace cugraph
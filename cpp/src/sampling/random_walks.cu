@@ -30,7 +30,9 @@ template std::
                graph_view_t<int32_t, int32_t, float, false, false> const& gview,
                int32_t const* ptr_d_start,
                int32_t num_paths,
-               int32_t max_depth);
+               int32_t max_depth,
+               bool use_padding,
+               random_walk_sampling_params_t const& sampling_params);
 
 template std::
   tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<float>, rmm::device_uvector<int64_t>>
@@ -38,7 +40,9 @@ template std::
                graph_view_t<int32_t, int64_t, float, false, false> const& gview,
                int32_t const* ptr_d_start,
                int64_t num_paths,
-               int64_t max_depth);
+               int64_t max_depth,
+               bool use_padding,
+               random_walk_sampling_params_t const& sampling_params);
 
 template std::
   tuple<rmm::device_uvector<int64_t>, rmm::device_uvector<float>, rmm::device_uvector<int64_t>>
@@ -46,7 +50,9 @@ template std::
                graph_view_t<int64_t, int64_t, float, false, false> const& gview,
                int64_t const* ptr_d_start,
                int64_t num_paths,
-               int64_t max_depth);
+               int64_t max_depth,
+               bool use_padding,
+               random_walk_sampling_params_t const& sampling_params);
 //}
 //
 // SG FP64{
@@ -56,7 +62,9 @@ template std::
                graph_view_t<int32_t, int32_t, double, false, false> const& gview,
                int32_t const* ptr_d_start,
                int32_t num_paths,
-               int32_t max_depth);
+               int32_t max_depth,
+               bool use_padding,
+               random_walk_sampling_params_t const& sampling_params);
 
 template std::
   tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<double>, rmm::device_uvector<int64_t>>
@@ -64,7 +72,9 @@ template std::
                graph_view_t<int32_t, int64_t, double, false, false> const& gview,
                int32_t const* ptr_d_start,
                int64_t num_paths,
-               int64_t max_depth);
+               int64_t max_depth,
+               bool use_padding,
+               random_walk_sampling_params_t const& sampling_params);
 
 template std::
   tuple<rmm::device_uvector<int64_t>, rmm::device_uvector<double>, rmm::device_uvector<int64_t>>
@@ -72,7 +82,72 @@ template std::
                graph_view_t<int64_t, int64_t, double, false, false> const& gview,
                int64_t const* ptr_d_start,
                int64_t num_paths,
-               int64_t max_depth);
+               int64_t max_depth,
+               bool use_padding,
+               random_walk_sampling_params_t const& sampling_params);
+//}
+// MG FP32{
+template std::
+  tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<float>, rmm::device_uvector<int32_t>>
+  random_walks(raft::handle_t const& handle,
+               graph_view_t<int32_t, int32_t, float, false, true> const& gview,
+               int32_t const* ptr_d_start,
+               int32_t num_paths,
+               int32_t max_depth,
+               bool use_padding,
+               random_walk_sampling_params_t const& sampling_params);
+
+template std::
+  tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<float>, rmm::device_uvector<int64_t>>
+  random_walks(raft::handle_t const& handle,
+               graph_view_t<int32_t, int64_t, float, false, true> const& gview,
+               int32_t const* ptr_d_start,
+               int64_t num_paths,
+               int64_t max_depth,
+               bool use_padding,
+               random_walk_sampling_params_t const& sampling_params);
+
+template std::
+  tuple<rmm::device_uvector<int64_t>, rmm::device_uvector<float>, rmm::device_uvector<int64_t>>
+  random_walks(raft::handle_t const& handle,
+               graph_view_t<int64_t, int64_t, float, false, true> const& gview,
+               int64_t const* ptr_d_start,
+               int64_t num_paths,
+               int64_t max_depth,
+               bool use_padding,
+               random_walk_sampling_params_t const& sampling_params);
+//}
+//
+// MG FP64{
+template std::
+  tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<double>, rmm::device_uvector<int32_t>>
+  random_walks(raft::handle_t const& handle,
+               graph_view_t<int32_t, int32_t, double, false, true> const& gview,
+               int32_t const* ptr_d_start,
+               int32_t num_paths,
+               int32_t max_depth,
+               bool use_padding,
+               random_walk_sampling_params_t const& sampling_params);
+
+template std::
+  tuple<rmm::device_uvector<int32_t>, rmm::device_uvector<double>, rmm::device_uvector<int64_t>>
+  random_walks(raft::handle_t const& handle,
+               graph_view_t<int32_t, int64_t, double, false, true> const& gview,
+               int32_t const* ptr_d_start,
+               int64_t num_paths,
+               int64_t max_depth,
+               bool use_padding,
+               random_walk_sampling_params_t const& sampling_params);
+
+template std::
+  tuple<rmm::device_uvector<int64_t>, rmm::device_uvector<double>, rmm::device_uvector<int64_t>>
+  random_walks(raft::handle_t const& handle,
+               graph_view_t<int64_t, int64_t, double, false, true> const& gview,
+               int64_t const* ptr_d_start,
+               int64_t num_paths,
+               int64_t max_depth,
+               bool use_padding,
+               random_walk_sampling_params_t const& sampling_params);
 //}
 }  // namespace experimental
 }  // namespace cugraph
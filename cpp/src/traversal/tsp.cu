@@ -14,10 +14,13 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <numeric>
 #include <raft/spatial/knn/knn.hpp>
 
+#include <utilities/device_comm.cuh>
 #include <utilities/high_res_timer.hpp>
+#include <utilities/host_scalar_comm.cuh>
 
 #include "tsp.hpp"
 #include "tsp_solver.hpp"
@@ -25,6 +28,43 @@
 namespace cugraph {
 namespace detail {
 
+namespace {
+
+// restarts are evenly split across the GPUs (if a communicator is set in the handle)
+std::tuple<int, int> local_restart_range(raft::handle_t const &handle, int restarts)
+{
+  auto comm_size = handle.comms_initialized() ? handle.get_comms().get_size() : 1;
+  auto comm_rank = handle.comms_initialized() ? handle.get_comms().get_rank() : 0;
+  auto quotient  = restarts / comm_size;
+  auto remainder = restarts % comm_size;
+  return std::make_tuple(comm_rank * quotient + std::min(comm_rank, remainder),
+                         quotient + (comm_rank < remainder ? 1 : 0));
+}
+
+// the work arrays scale as O(nodes * restart_batch), limit the restart batch size to use no more
+// than half of the free device memory
+int compute_restart_batch(raft::handle_t const &handle,
+                          int nodes,
+                          int restarts,
+                          bool neighbor_list_search)
+{
+  int constexpr max_restart_batch{8192};
+  auto warp_size         = handle.get_device_properties().warpSize;
+  auto bytes_per_climber = sizeof(int) * (static_cast<size_t>(4 * nodes + 3 + warp_size - 1) /
+                                            warp_size * warp_size +
+                                          (neighbor_list_search ? 2 * nodes + 1 : 0));
+  size_t free_size{};
+  size_t total_size{};
+  CUDA_TRY(cudaMemGetInfo(&free_size, &total_size));
+  auto memory_bound = std::max(free_size / 2 / bytes_per_climber, size_t{1});
+  return static_cast<int>(
+    std::min({static_cast<size_t>(max_restart_batch),
+              static_cast<size_t>(std::max(restarts, 1)),
+              memory_bound}));
+}
+
+}  // namespace
+
 TSP::TSP(raft::handle_t const &handle,
          int const *vtx_ptr,
          float const *x_pos,
@@ -35,27 +75,32 @@ TSP::TSP(raft::handle_t const &handle,
          int k,
          int nstart,
          bool verbose,
+         bool neighbor_list_search,
          int *route)
   : handle_(handle),
     vtx_ptr_(vtx_ptr),
     x_pos_(x_pos),
     y_pos_(y_pos),
     nodes_(nodes),
-    restarts_(restarts),
+    restarts_(std::get<1>(local_restart_range(handle, restarts))),
     beam_search_(beam_search),
     k_(k),
     nstart_(nstart),
     verbose_(verbose),
+    neighbor_list_search_(neighbor_list_search),
+    restart_first_(std::get<0>(local_restart_range(handle, restarts))),
     route_(route),
     stream_(handle_.get_stream()),
     max_blocks_(handle_.get_device_properties().maxGridSize[0]),
     max_threads_(handle_.get_device_properties().maxThreadsPerBlock),
     warp_size_(handle_.get_device_properties().warpSize),
     sm_count_(handle_.get_device_properties().multiProcessorCount),
-    restart_batch_(8192),
+    restart_batch_(compute_restart_batch(
+      handle, nodes, std::get<1>(local_restart_range(handle, restarts)), neighbor_list_search)),
     neighbors_vec_((k_ + 1) * nodes_, stream_),
     work_vec_(restart_batch_ * ((4 * nodes_ + 3 + warp_size_ - 1) / warp_size_ * warp_size_),
               stream_),
+    city_work_vec_(neighbor_list_search ? restart_batch_ * (2 * nodes_ + 1) : 0, stream_),
     best_x_pos_vec_(1, stream_),
     best_y_pos_vec_(1, stream_),
     best_route_vec_(1, stream_)
@@ -72,6 +117,8 @@ void TSP::setup()
   // buffer. We allocate a work buffer that will store the computed distances, px, py and the route.
   // We align it on the warp size.
   work_ = work_vec_.data();
+  // city indices and route positions per climber (only for neighbor list restricted 2-opt)
+  city_work_ = neighbor_list_search_ ? city_work_vec_.data() : nullptr;
 
   results_.best_x_pos = best_x_pos_vec_.data();
   results_.best_y_pos = best_y_pos_vec_.data();
@@ -86,15 +133,15 @@ void TSP::reset_batch()
   best_cost_scalar_.set_value(max, stream_);
 }
 
-void TSP::get_initial_solution(int const batch)
+void TSP::get_initial_solution(int const restart_first)
 {
   if (!beam_search_) {
     random_init<<<restart_batch_, best_thread_num_>>>(
-      work_, x_pos_, y_pos_, vtx_ptr_, nstart_, nodes_, batch, restart_batch_);
+      work_, city_work_, x_pos_, y_pos_, vtx_ptr_, nstart_, nodes_, restart_first);
     CHECK_CUDA(stream_);
   } else {
     knn_init<<<restart_batch_, best_thread_num_>>>(
-      work_, x_pos_, y_pos_, vtx_ptr_, neighbors_, nstart_, nodes_, k_, batch, restart_batch_);
+      work_, city_work_, x_pos_, y_pos_, vtx_ptr_, neighbors_, nstart_, nodes_, k_, restart_first);
     CHECK_CUDA(stream_);
   }
 }
@@ -104,6 +151,7 @@ float TSP::compute()
   float final_cost        = 0.f;
   int num_restart_batches = (restarts_ + restart_batch_ - 1) / restart_batch_;
   int restart_resid       = restarts_ - (num_restart_batches - 1) * restart_batch_;
+  int full_restart_batch  = restart_batch_;
   int global_best         = std::numeric_limits<int>::max();
   int best                = 0;
 
@@ -130,11 +178,12 @@ float TSP::compute()
 
   // Tell the cache how we want it to behave
   cudaFuncSetCacheConfig(search_solution, cudaFuncCachePreferEqual);
+  cudaFuncSetCacheConfig(search_solution_neighbor_list, cudaFuncCachePreferEqual);
   best_thread_num_ = best_thread_count(nodes_, max_threads_, sm_count_, warp_size_);
 
   if (verbose_) std::cout << "Calculated best thread number = " << best_thread_num_ << "\n";
 
-  if (beam_search_) {
+  if (beam_search_ || neighbor_list_search_) {
     auto timer = create_timer("knn");
     knn();
   }
@@ -145,16 +194,23 @@ float TSP::compute()
 
     {
       auto timer = create_timer("initial_sol");
-      get_initial_solution(batch);
+      get_initial_solution(restart_first_ + batch * full_restart_batch);
     }
 
     {
       auto timer = create_timer("search_sol");
-      search_solution<<<restart_batch_,
-                        best_thread_num_,
-                        sizeof(int) * best_thread_num_,
-                        stream_>>>(
-        results_, mylock_, vtx_ptr_, beam_search_, k_, nodes_, x_pos_, y_pos_, work_, nstart_);
+      if (neighbor_list_search_) {
+        search_solution_neighbor_list<<<restart_batch_,
+                                        best_thread_num_,
+                                        sizeof(int) * best_thread_num_,
+                                        stream_>>>(work_, city_work_, neighbors_, k_, nodes_);
+      } else {
+        search_solution<<<restart_batch_,
+                          best_thread_num_,
+                          sizeof(int) * best_thread_num_,
+                          stream_>>>(
+          results_, mylock_, vtx_ptr_, beam_search_, k_, nodes_, x_pos_, y_pos_, work_, nstart_);
+      }
       CHECK_CUDA(stream_);
     }
 
@@ -188,9 +244,28 @@ float TSP::compute()
     }
   }
 
-  for (auto i = 0; i < nodes_; ++i) {
-    if (verbose_) { std::cout << h_route[i] << ": " << h_x_pos[i] << " " << h_y_pos[i] << "\n"; }
-    final_cost += euclidean_dist(h_x_pos.data(), h_y_pos.data(), i, i + 1);
+  if (global_best < std::numeric_limits<int>::max()) {  // this GPU ran at least one restart
+    for (auto i = 0; i < nodes_; ++i) {
+      if (verbose_) {
+        std::cout << h_route[i] << ": " << h_x_pos[i] << " " << h_y_pos[i] << "\n";
+      }
+      final_cost += euclidean_dist(h_x_pos.data(), h_y_pos.data(), i, i + 1);
+    }
+  }
+
+  // keep the global best tour (the lowest rank GPU wins ties)
+  if (handle_.comms_initialized()) {
+    auto &comm      = handle_.get_comms();
+    auto local_best = global_best;
+    global_best =
+      experimental::host_scalar_allreduce(comm, local_best, raft::comms::op_t::MIN, stream_);
+    auto root = experimental::host_scalar_allreduce(
+      comm,
+      local_best == global_best ? comm.get_rank() : comm.get_size(),
+      raft::comms::op_t::MIN,
+      stream_);
+    experimental::device_bcast(comm, route_, route_, nodes_, root, stream_);
+    final_cost = experimental::host_scalar_bcast(comm, final_cost, root, stream_);
   }
 
   if (verbose_) {
@@ -252,16 +327,29 @@ float traveling_salesperson(raft::handle_t const &handle,
                             int k,
                             int nstart,
                             bool verbose,
-                            int *route)
+                            int *route,
+                            bool neighbor_list_search)
 {
   RAFT_EXPECTS(route != nullptr, "route should equal the number of nodes");
   RAFT_EXPECTS(nodes > 0, "nodes should be strictly positive");
   RAFT_EXPECTS(restarts > 0, "restarts should be strictly positive");
   RAFT_EXPECTS(nstart >= 0 && nstart < nodes, "nstart should be between 0 and nodes - 1");
   RAFT_EXPECTS(k > 0, "k should be strictly positive");
-
-  cugraph::detail::TSP tsp(
-    handle, vtx_ptr, x_pos, y_pos, nodes, restarts, beam_search, k, nstart, verbose, route);
+  RAFT_EXPECTS(!neighbor_list_search || k < nodes,
+               "k should be smaller than nodes for neighbor list search");
+
+  cugraph::detail::TSP tsp(handle,
+                           vtx_ptr,
+                           x_pos,
+                           y_pos,
+                           nodes,
+                           restarts,
+                           beam_search,
+                           k,
+                           nstart,
+                           verbose,
+                           neighbor_list_search,
+                           route);
   return tsp.compute();
 }
 
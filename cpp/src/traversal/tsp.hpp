@@ -47,11 +47,12 @@ class TSP {
       int k,
       int nstart,
       bool verbose,
+      bool neighbor_list_search,
       int *route);
 
   void setup();
   void reset_batch();
-  void get_initial_solution(int const batch);
+  void get_initial_solution(int const restart_first);
   float compute();
   void knn();
   ~TSP(){};
@@ -79,6 +80,9 @@ class TSP {
   int k_;
   int nstart_;
   bool verbose_;
+  bool neighbor_list_search_;
+  // restarts assigned to this GPU are [restart_first_, restart_first_ + restarts_)
+  int restart_first_;
 
   // Scalars
   rmm::device_scalar<int> mylock_scalar_;
@@ -90,12 +94,14 @@ class TSP {
   // Vectors
   rmm::device_uvector<int64_t> neighbors_vec_;
   rmm::device_uvector<int> work_vec_;
+  rmm::device_uvector<int> city_work_vec_;
   rmm::device_uvector<float *> best_x_pos_vec_;
   rmm::device_uvector<float *> best_y_pos_vec_;
   rmm::device_uvector<int *> best_route_vec_;
 
   int64_t *neighbors_;
   int *work_;
+  int *city_work_;
   int *work_route_;
   TSPResults results_;
 };
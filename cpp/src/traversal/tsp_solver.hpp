@@ -29,25 +29,29 @@
 namespace cugraph {
 namespace detail {
 
+// city_work (if not nullptr) stores the city indices (positions in posx and posy) in the route and
+// the route positions of the cities (used by neighbor list restricted 2-opt)
 __global__ void random_init(int *work,
+                            int *city_work,
                             float const *posx,
                             float const *posy,
                             int const *vtx_ptr,
                             int const nstart,
                             int const nodes,
-                            int const batch,
-                            int const restart_batch)
+                            int const restart_first)
 {
   int *buf  = &work[blockIdx.x * ((4 * nodes + 3 + 31) / 32 * 32)];
   float *px = (float *)(&buf[nodes]);
   float *py = &px[nodes + 1];
   int *path = (int *)(&py[nodes + 1]);
+  int *city = city_work != nullptr ? &city_work[blockIdx.x * (2 * nodes + 1)] : nullptr;
 
   // Fill values
   for (int i = threadIdx.x; i <= nodes; i += blockDim.x) {
     px[i]   = posx[i];
     py[i]   = posy[i];
     path[i] = vtx_ptr[i];
+    if (city != nullptr) { city[i] = i; }
   }
 
   __syncthreads();
@@ -57,24 +61,28 @@ __global__ void random_init(int *work,
     raft::swapVals(px[0], px[nstart]);
     raft::swapVals(py[0], py[nstart]);
     raft::swapVals(path[0], path[nstart]);
+    if (city != nullptr) { raft::swapVals(city[0], city[nstart]); }
 
     curandState rndstate;
-    curand_init(blockIdx.x + (restart_batch * batch), 0, 0, &rndstate);
+    curand_init(blockIdx.x + restart_first, 0, 0, &rndstate);
     for (int i = 1; i < nodes; i++) {
       int j = curand(&rndstate) % (nodes - 1 - i) + i;
       if (i == j) continue;
       raft::swapVals(px[i], px[j]);
       raft::swapVals(py[i], py[j]);
       raft::swapVals(path[i], path[j]);
+      if (city != nullptr) { raft::swapVals(city[i], city[j]); }
     }
     // close the loop now, avoid special cases later
     px[nodes]   = px[0];
     py[nodes]   = py[0];
     path[nodes] = path[0];
+    if (city != nullptr) { city[nodes] = city[0]; }
   }
 }
 
 __global__ void knn_init(int *work,
+                         int *city_work,
                          float const *posx,
                          float const *posy,
                          int const *vtx_ptr,
@@ -82,13 +90,13 @@ __global__ void knn_init(int *work,
                          int const nstart,
                          int const nodes,
                          int const K,
-                         int const batch,
-                         int const restart_batch)
+                         int const restart_first)
 {
   int *buf  = &work[blockIdx.x * ((4 * nodes + 3 + 31) / 32 * 32)];
   float *px = (float *)(&buf[nodes]);
   float *py = &px[nodes + 1];
   int *path = (int *)(&py[nodes + 1]);
+  int *city = city_work != nullptr ? &city_work[blockIdx.x * (2 * nodes + 1)] : nullptr;
 
   for (int i = threadIdx.x; i < nodes; i += blockDim.x) buf[i] = 0;
 
@@ -96,12 +104,13 @@ __global__ void knn_init(int *work,
 
   if (threadIdx.x == 0) {
     curandState rndstate;
-    curand_init(blockIdx.x + (restart_batch * batch), 0, 0, &rndstate);
+    curand_init(blockIdx.x + restart_first, 0, 0, &rndstate);
     int progress = 0;
 
-    px[0]     = posx[nstart];
-    py[0]     = posy[nstart];
-    path[0]   = vtx_ptr[nstart];
+    px[0]   = posx[nstart];
+    py[0]   = posy[nstart];
+    path[0] = vtx_ptr[nstart];
+    if (city != nullptr) { city[0] = nstart; }
     int head  = nstart;
     int v     = 0;
     buf[head] = 1;
@@ -139,11 +148,13 @@ __global__ void knn_init(int *work,
         px[progress]   = posx[head];
         py[progress]   = posy[head];
         path[progress] = vtx_ptr[head];
+        if (city != nullptr) { city[progress] = head; }
       }
     }
     px[nodes]   = px[nstart];
     py[nodes]   = py[nstart];
     path[nodes] = path[nstart];
+    if (city != nullptr) { city[nodes] = city[0]; }
   }
 }
 
@@ -202,6 +213,144 @@ __device__ void two_opt_search(
   }
 }
 
+// 2-opt restricted to the moves adding an edge between a city and one of its K nearest neighbors,
+// this bounds the work per iteration to O(nodes * K) (instead of O(nodes^2)) for large instances
+__device__ void neighbor_list_two_opt_search(int *buf,
+                                             float *px,
+                                             float *py,
+                                             int const *city,
+                                             int const *pos,
+                                             int64_t const *neighbors,
+                                             int const K,
+                                             int *minchange,
+                                             int *mini,
+                                             int *minj,
+                                             int const nodes)
+{
+  for (int i = threadIdx.x; i < nodes; i += blockDim.x) {
+    for (int nj = 0; nj < K; ++nj) {
+      // offset + 1 filters the points as their own nearest neighbors (see knn_init).
+      auto nbr = neighbors[(K + 1) * city[i] + nj + 1];
+      if (nbr < 0 || nbr >= nodes) continue;
+      int j     = pos[nbr];
+      int lower = i < j ? i : j;
+      int upper = i < j ? j : i;
+      if ((upper < lower + 2) || ((lower == 0) && (upper == nodes - 1))) continue;
+      // replace edges (lower, lower + 1) and (upper, upper + 1) with (lower, upper) and
+      // (lower + 1, upper + 1)
+      int delta = buf[lower] + buf[upper] +
+                  __float2int_rn(euclidean_dist(px, py, lower, upper)) +
+                  __float2int_rn(euclidean_dist(px, py, lower + 1, upper + 1));
+      if (delta < minchange[0]) {
+        minchange[0] = delta;
+        mini[0]      = lower;
+        minj[0]      = upper;
+      }
+    }
+  }
+}
+
+// pick up to kswaps compatible moves among the per-thread best moves (minchange, mini, minj) and
+// apply them, returns the best change
+__device__ int apply_best_swaps(float *px,
+                                float *py,
+                                int *path,
+                                int *city,
+                                int *shbuf,
+                                int *best_change,
+                                int *best_i,
+                                int *best_j,
+                                int minchange,
+                                int mini,
+                                int minj)
+{
+  int kswaps_active = kswaps;
+
+  shbuf[threadIdx.x] = minchange;
+
+  int j = blockDim.x;  // warp reduction to find best thread results
+  do {
+    int k = (j + 1) / 2;
+    if ((threadIdx.x + k) < j) {
+      shbuf[threadIdx.x] = min(shbuf[threadIdx.x + k], shbuf[threadIdx.x]);
+    }
+    j = k;
+    __syncthreads();
+  } while (j > 1);  // thread winner for this k is in shbuf[0]
+
+  if (threadIdx.x == 0) {
+    best_change[0] = shbuf[0];  // sort best result in shared
+  }
+  __syncthreads();
+
+  if (minchange == shbuf[0]) {  // My thread is as good as the winner
+    shbuf[1] = threadIdx.x;     // store thread ID in shbuf[1]
+  }
+  __syncthreads();
+
+  if (threadIdx.x == shbuf[1]) {  // move from thread local to shared
+    best_i[0] = mini;             // shared best indices for compatibility checks
+    best_j[0] = minj;
+  }
+  __syncthreads();
+
+  // look for more compatible swaps
+  for (int kmin = 1; kmin < kswaps_active; kmin++) {
+    // disallow swaps that conflict with ones already picked
+    for (int kchk = kmin - 1; kchk >= 0; --kchk) {
+      if ((mini < (best_j[kchk] + 1)) && (minj > (best_i[kchk] - 1))) {
+        minchange = shbuf[threadIdx.x] = 0;
+      }
+      __syncthreads();
+    }
+    shbuf[threadIdx.x] = minchange;
+
+    j = blockDim.x;
+    do {
+      int k = (j + 1) / 2;
+      if ((threadIdx.x + k) < j) {
+        shbuf[threadIdx.x] = min(shbuf[threadIdx.x + k], shbuf[threadIdx.x]);
+      }
+      j = k;
+      __syncthreads();
+    } while (j > 1);  // thread winner for this k is in shbuf[0]
+
+    if (threadIdx.x == 0) {
+      best_change[kmin] = shbuf[0];  // store best result in shared
+    }
+    __syncthreads();
+
+    if (minchange == shbuf[0]) {  // My thread is as good as the winner
+      shbuf[1] = threadIdx.x;     // store thread ID in shbuf[1]
+      __threadfence_block();
+    }
+    __syncthreads();
+
+    if (threadIdx.x == shbuf[1]) {  // move from thread local to shared
+      best_i[kmin] = mini;          // store swap targets
+      best_j[kmin] = minj;
+      __threadfence_block();
+    }
+    __syncthreads();
+    // look for the best compatible move
+  }  // end loop over kmin
+  for (int kmin = 0; kmin < kswaps_active; kmin++) {
+    int sum = best_i[kmin] + best_j[kmin] + 1;  // = mini + minj +1
+    // this is a reversal of all nodes included in the range [ i+1, j ]
+    for (int i = threadIdx.x; (i + i) < sum; i += blockDim.x) {
+      if (best_i[kmin] < i) {
+        int j = sum - i;
+        raft::swapVals(px[i], px[j]);
+        raft::swapVals(py[i], py[j]);
+        raft::swapVals(path[i], path[j]);
+        if (city != nullptr) { raft::swapVals(city[i], city[j]); }
+      }
+    }
+    __syncthreads();
+  }
+  return best_change[0];
+}
+
 __global__ __launch_bounds__(2048, 2) void search_solution(TSPResults results,
                                                            int *mylock,
                                                            int const *vtx_ptr,
@@ -226,8 +375,7 @@ __global__ __launch_bounds__(2048, 2) void search_solution(TSPResults results,
   int minchange;
   int mini;
   int minj;
-  int kswaps_active = kswaps;
-  int myswaps       = 0;
+  int myswaps = 0;
 
   // Hill climbing, iteratively improve from the starting guess
   do {
@@ -253,89 +401,64 @@ __global__ __launch_bounds__(2048, 2) void search_solution(TSPResults results,
     two_opt_search(buf, px, py, shbuf, &minchange, &mini, &minj, nodes);
     __syncthreads();
 
-    shbuf[threadIdx.x] = minchange;
+    minchange = apply_best_swaps(
+      px, py, path, nullptr, shbuf, best_change, best_i, best_j, minchange, mini, minj);
+    myswaps += 1;
+  } while (minchange < 0 && myswaps < 2 * nodes);
+}
 
-    int j = blockDim.x;  // warp reduction to find best thread results
-    do {
-      int k = (j + 1) / 2;
-      if ((threadIdx.x + k) < j) {
-        shbuf[threadIdx.x] = min(shbuf[threadIdx.x + k], shbuf[threadIdx.x]);
-      }
-      j = k;
-      __syncthreads();
-    } while (j > 1);  // thread winner for this k is in shbuf[0]
+__global__ __launch_bounds__(2048, 2) void search_solution_neighbor_list(int *work,
+                                                                         int *city_work,
+                                                                         int64_t const *neighbors,
+                                                                         int const K,
+                                                                         int nodes)
+{
+  int *buf  = &work[blockIdx.x * ((4 * nodes + 3 + 31) / 32 * 32)];
+  float *px = (float *)(&buf[nodes]);
+  float *py = &px[nodes + 1];
+  int *path = (int *)(&py[nodes + 1]);
+  int *city = &city_work[blockIdx.x * (2 * nodes + 1)];
+  int *pos  = &city[nodes + 1];
 
-    if (threadIdx.x == 0) {
-      best_change[0] = shbuf[0];  // sort best result in shared
-    }
-    __syncthreads();
+  __shared__ int shbuf[tilesize];
+  __shared__ int best_change[kswaps];
+  __shared__ int best_i[kswaps];
+  __shared__ int best_j[kswaps];
 
-    if (minchange == shbuf[0]) {  // My thread is as good as the winner
-      shbuf[1] = threadIdx.x;     // store thread ID in shbuf[1]
+  int minchange;
+  int mini;
+  int minj;
+  int myswaps = 0;
+
+  // Hill climbing, iteratively improve from the starting guess
+  do {
+    if (threadIdx.x == 0) {
+      for (int k = 0; k < kswaps; k++) {
+        best_change[k] = 0;
+        best_i[k]      = 0;
+        best_j[k]      = 0;
+      }
     }
     __syncthreads();
-
-    if (threadIdx.x == shbuf[1]) {  // move from thread local to shared
-      best_i[0] = mini;             // shared best indices for compatibility checks
-      best_j[0] = minj;
+    for (int i = threadIdx.x; i < nodes; i += blockDim.x) {
+      buf[i]       = -__float2int_rn(euclidean_dist(px, py, i, i + 1));
+      pos[city[i]] = i;
     }
     __syncthreads();
 
-    // look for more compatible swaps
-    for (int kmin = 1; kmin < kswaps_active; kmin++) {
-      // disallow swaps that conflict with ones already picked
-      for (int kchk = kmin - 1; kchk >= 0; --kchk) {
-        if ((mini < (best_j[kchk] + 1)) && (minj > (best_i[kchk] - 1))) {
-          minchange = shbuf[threadIdx.x] = 0;
-        }
-        __syncthreads();
-      }
-      shbuf[threadIdx.x] = minchange;
-
-      j = blockDim.x;
-      do {
-        int k = (j + 1) / 2;
-        if ((threadIdx.x + k) < j) {
-          shbuf[threadIdx.x] = min(shbuf[threadIdx.x + k], shbuf[threadIdx.x]);
-        }
-        j = k;
-        __syncthreads();
-      } while (j > 1);  // thread winner for this k is in shbuf[0]
-
-      if (threadIdx.x == 0) {
-        best_change[kmin] = shbuf[0];  // store best result in shared
-      }
-      __syncthreads();
+    // Reset
+    minchange = 0;
+    mini      = 0;
+    minj      = 0;
 
-      if (minchange == shbuf[0]) {  // My thread is as good as the winner
-        shbuf[1] = threadIdx.x;     // store thread ID in shbuf[1]
-        __threadfence_block();
-      }
-      __syncthreads();
+    // Find best indices
+    neighbor_list_two_opt_search(
+      buf, px, py, city, pos, neighbors, K, &minchange, &mini, &minj, nodes);
+    __syncthreads();
 
-      if (threadIdx.x == shbuf[1]) {  // move from thread local to shared
-        best_i[kmin] = mini;          // store swap targets
-        best_j[kmin] = minj;
-        __threadfence_block();
-      }
-      __syncthreads();
-      // look for the best compatible move
-    }  // end loop over kmin
-    minchange = best_change[0];
+    minchange = apply_best_swaps(
+      px, py, path, city, shbuf, best_change, best_i, best_j, minchange, mini, minj);
     myswaps += 1;
-    for (int kmin = 0; kmin < kswaps_active; kmin++) {
-      int sum = best_i[kmin] + best_j[kmin] + 1;  // = mini + minj +1
-      // this is a reversal of all nodes included in the range [ i+1, j ]
-      for (int i = threadIdx.x; (i + i) < sum; i += blockDim.x) {
-        if (best_i[kmin] < i) {
-          int j = sum - i;
-          raft::swapVals(px[i], px[j]);
-          raft::swapVals(py[i], py[j]);
-          raft::swapVals(path[i], path[j]);
-        }
-      }
-      __syncthreads();
-    }
   } while (minchange < 0 && myswaps < 2 * nodes);
 }
 
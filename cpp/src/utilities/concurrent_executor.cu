@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/concurrent_executor.hpp>
+#include <utilities/error.hpp>
+
+#include <algorithm>
+
+namespace cugraph {
+namespace experimental {
+
+namespace detail {
+
+concurrent_call_t::concurrent_call_t(int device, cudaStream_t stream, size_t workspace_chunk_size)
+{
+  // the call runs on its own host thread, which starts with the default device
+  CUDA_TRY(cudaSetDevice(device));
+  handle_ptr_ = std::make_unique<raft::handle_t>();
+  handle_ptr_->set_stream(stream);
+  arena_ptr_ = std::make_unique<workspace_arena_t>(workspace_chunk_size);
+  scope_ptr_ = std::make_unique<workspace_scope_t>(*handle_ptr_, *arena_ptr_);
+}
+
+concurrent_call_t::~concurrent_call_t()
+{
+  // no device memory from the arena should be in use once the call (and its stream) is complete
+  handle_ptr_->get_stream_view().synchronize_no_throw();
+  scope_ptr_.reset();
+  arena_ptr_.reset();
+  handle_ptr_.reset();
+}
+
+}  // namespace detail
+
+concurrent_executor_t::concurrent_executor_t(raft::handle_t const& handle,
+                                             size_t num_streams,
+                                             size_t workspace_chunk_size)
+  : handle_(handle), workspace_chunk_size_(workspace_chunk_size)
+{
+  CUGRAPH_EXPECTS(!handle.comms_initialized(),
+                  "Invalid input argument: concurrent execution supports single-GPU only.");
+  CUGRAPH_EXPECTS(num_streams > 0, "Invalid input argument: num_streams should be positive.");
+
+  CUDA_TRY(cudaGetDevice(&device_));
+  streams_.resize(num_streams);
+  for (auto& stream : streams_) {
+    CUDA_TRY(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+  }
+  CUDA_TRY(cudaEventCreateWithFlags(&event_, cudaEventDisableTiming));
+}
+
+concurrent_executor_t::~concurrent_executor_t()
+{
+  wait();
+  cudaEventDestroy(event_);
+  std::for_each(
+    streams_.begin(), streams_.end(), [](cudaStream_t stream) { cudaStreamDestroy(stream); });
+}
+
+void concurrent_executor_t::wait() const
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this]() { return num_pending_calls_ == 0; });
+}
+
+cudaStream_t concurrent_executor_t::acquire_stream()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto stream      = streams_[next_stream_idx_];
+  next_stream_idx_ = (next_stream_idx_ + 1) % streams_.size();
+  // cudaStreamWaitEvent uses the event's most recent record, so sharing one event is safe while
+  // the mutex is held
+  CUDA_TRY(cudaEventRecord(event_, handle_.get_stream()));
+  CUDA_TRY(cudaStreamWaitEvent(stream, event_, 0));
+  ++num_pending_calls_;
+  return stream;
+}
+
+void concurrent_executor_t::release_call() const
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    --num_pending_calls_;
+  }
+  cv_.notify_all();
+}
+
+}  // namespace experimental
+}  // namespace cugraph
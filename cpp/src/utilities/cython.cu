@@ -37,7 +37,9 @@
 #include <thrust/reduce.h>
 #include <thrust/scatter.h>
 
+#include <memory>
 #include <numeric>
+#include <typeindex>
 #include <vector>
 
 namespace cugraph {
@@ -188,8 +190,36 @@ create_graph(raft::handle_t const& handle, graph_container_t const& graph_contai
     graph_container.do_expensive_check);
 }
 
+// returns the graph_t instance cached in graph_container (building and caching a new graph_t
+// instance if there is no cached instance of the requested type)
+template <typename vertex_t, typename edge_t, typename weight_t, bool transposed, bool multi_gpu>
+std::shared_ptr<experimental::graph_t<vertex_t, edge_t, weight_t, transposed, multi_gpu>> get_graph(
+  raft::handle_t const& handle, graph_container_t const& graph_container)
+{
+  using graph_type = experimental::graph_t<vertex_t, edge_t, weight_t, transposed, multi_gpu>;
+
+  auto& cached_graph = graph_container.cached_graphs[transposed ? 1 : 0];
+  if (!cached_graph.graph_ptr ||
+      (cached_graph.graph_type_id != std::type_index(typeid(graph_type))) ||
+      (cached_graph.handle_ptr != &handle)) {
+    std::shared_ptr<graph_type> graph =
+      create_graph<vertex_t, edge_t, weight_t, transposed, multi_gpu>(handle, graph_container);
+    cached_graph.graph_ptr     = graph;
+    cached_graph.graph_type_id = std::type_index(typeid(graph_type));
+    cached_graph.handle_ptr    = &handle;
+    return graph;
+  }
+
+  return std::static_pointer_cast<graph_type>(cached_graph.graph_ptr);
+}
+
 }  // namespace detail
 
+std::shared_ptr<graph_container_t> create_graph_container()
+{
+  return std::make_shared<graph_container_t>();
+}
+
 // Populates a graph_container_t with a pointer to a new graph object and sets
 // the meta-data accordingly.  The graph container owns the pointer and it is
 // assumed it will delete it on destruction.
@@ -380,7 +410,7 @@ return_t call_function(raft::handle_t const& handle,
                        function_t function)
 {
   auto graph =
-    create_graph<vertex_t, edge_t, weight_t, transposed, is_multi_gpu>(handle, graph_container);
+    get_graph<vertex_t, edge_t, weight_t, transposed, is_multi_gpu>(handle, graph_container);
 
   return function(handle, graph->view());
 }
@@ -560,7 +590,7 @@ void call_pagerank(raft::handle_t const& handle,
   if (graph_container.is_multi_gpu) {
     if (graph_container.edgeType == numberTypeEnum::int32Type) {
       auto graph =
-        detail::create_graph<int32_t, int32_t, weight_t, true, true>(handle, graph_container);
+        detail::get_graph<int32_t, int32_t, weight_t, true, true>(handle, graph_container);
       cugraph::experimental::pagerank(handle,
                                       graph->view(),
                                       static_cast<weight_t*>(nullptr),
@@ -575,7 +605,7 @@ void call_pagerank(raft::handle_t const& handle,
                                       true);
     } else if (graph_container.edgeType == numberTypeEnum::int64Type) {
       auto graph =
-        detail::create_graph<vertex_t, int64_t, weight_t, true, true>(handle, graph_container);
+        detail::get_graph<vertex_t, int64_t, weight_t, true, true>(handle, graph_container);
       cugraph::experimental::pagerank(handle,
                                       graph->view(),
                                       static_cast<weight_t*>(nullptr),
@@ -592,7 +622,7 @@ void call_pagerank(raft::handle_t const& handle,
   } else {
     if (graph_container.edgeType == numberTypeEnum::int32Type) {
       auto graph =
-        detail::create_graph<int32_t, int32_t, weight_t, true, false>(handle, graph_container);
+        detail::get_graph<int32_t, int32_t, weight_t, true, false>(handle, graph_container);
       cugraph::experimental::pagerank(handle,
                                       graph->view(),
                                       static_cast<weight_t*>(nullptr),
@@ -607,7 +637,7 @@ void call_pagerank(raft::handle_t const& handle,
                                       true);
     } else if (graph_container.edgeType == numberTypeEnum::int64Type) {
       auto graph =
-        detail::create_graph<vertex_t, int64_t, weight_t, true, false>(handle, graph_container);
+        detail::get_graph<vertex_t, int64_t, weight_t, true, false>(handle, graph_container);
       cugraph::experimental::pagerank(handle,
                                       graph->view(),
                                       static_cast<weight_t*>(nullptr),
@@ -650,7 +680,7 @@ void call_katz_centrality(raft::handle_t const& handle,
   } else if (graph_container.graph_type == graphTypeEnum::graph_t) {
     if (graph_container.edgeType == numberTypeEnum::int32Type) {
       auto graph =
-        detail::create_graph<int32_t, int32_t, weight_t, true, true>(handle, graph_container);
+        detail::get_graph<int32_t, int32_t, weight_t, true, true>(handle, graph_container);
       cugraph::experimental::katz_centrality(handle,
                                              graph->view(),
                                              static_cast<weight_t*>(nullptr),
@@ -664,7 +694,7 @@ void call_katz_centrality(raft::handle_t const& handle,
                                              false);
     } else if (graph_container.edgeType == numberTypeEnum::int64Type) {
       auto graph =
-        detail::create_graph<vertex_t, int64_t, weight_t, true, true>(handle, graph_container);
+        detail::get_graph<vertex_t, int64_t, weight_t, true, true>(handle, graph_container);
       cugraph::experimental::katz_centrality(handle,
                                              graph->view(),
                                              static_cast<weight_t*>(nullptr),
@@ -716,7 +746,7 @@ void call_bfs(raft::handle_t const& handle,
   } else if (graph_container.graph_type == graphTypeEnum::graph_t) {
     if (graph_container.edgeType == numberTypeEnum::int32Type) {
       auto graph =
-        detail::create_graph<int32_t, int32_t, weight_t, false, true>(handle, graph_container);
+        detail::get_graph<int32_t, int32_t, weight_t, false, true>(handle, graph_container);
       cugraph::experimental::bfs(handle,
                                  graph->view(),
                                  reinterpret_cast<int32_t*>(distances),
@@ -724,7 +754,7 @@ void call_bfs(raft::handle_t const& handle,
                                  static_cast<int32_t>(start_vertex));
     } else if (graph_container.edgeType == numberTypeEnum::int64Type) {
       auto graph =
-        detail::create_graph<vertex_t, int64_t, weight_t, false, true>(handle, graph_container);
+        detail::get_graph<vertex_t, int64_t, weight_t, false, true>(handle, graph_container);
       cugraph::experimental::bfs(handle,
                                  graph->view(),
                                  reinterpret_cast<vertex_t*>(distances),
@@ -748,7 +778,7 @@ std::unique_ptr<cy_multi_edgelists_t> call_egonet(raft::handle_t const& handle,
 {
   if (graph_container.edgeType == numberTypeEnum::int32Type) {
     auto graph =
-      detail::create_graph<int32_t, int32_t, weight_t, false, false>(handle, graph_container);
+      detail::get_graph<int32_t, int32_t, weight_t, false, false>(handle, graph_container);
     auto g = cugraph::experimental::extract_ego(handle,
                                                 graph->view(),
                                                 reinterpret_cast<int32_t*>(source_vertex),
@@ -765,7 +795,7 @@ std::unique_ptr<cy_multi_edgelists_t> call_egonet(raft::handle_t const& handle,
     return std::make_unique<cy_multi_edgelists_t>(std::move(coo_contents));
   } else if (graph_container.edgeType == numberTypeEnum::int64Type) {
     auto graph =
-      detail::create_graph<vertex_t, int64_t, weight_t, false, false>(handle, graph_container);
+      detail::get_graph<vertex_t, int64_t, weight_t, false, false>(handle, graph_container);
     auto g = cugraph::experimental::extract_ego(handle,
                                                 graph->view(),
                                                 reinterpret_cast<vertex_t*>(source_vertex),
@@ -801,7 +831,7 @@ call_random_walks(raft::handle_t const& handle,
     using weight_t = float;
 
     auto graph =
-      detail::create_graph<vertex_t, edge_t, weight_t, false, false>(handle, graph_container);
+      detail::get_graph<vertex_t, edge_t, weight_t, false, false>(handle, graph_container);
 
     auto triplet = cugraph::experimental::random_walks(
       handle, graph->view(), ptr_start_set, num_paths, max_depth);
@@ -820,7 +850,7 @@ call_random_walks(raft::handle_t const& handle,
     using weight_t = double;
 
     auto graph =
-      detail::create_graph<vertex_t, edge_t, weight_t, false, false>(handle, graph_container);
+      detail::get_graph<vertex_t, edge_t, weight_t, false, false>(handle, graph_container);
 
     auto triplet = cugraph::experimental::random_walks(
       handle, graph->view(), ptr_start_set, num_paths, max_depth);
@@ -868,7 +898,7 @@ void call_sssp(raft::handle_t const& handle,
   } else if (graph_container.graph_type == graphTypeEnum::graph_t) {
     if (graph_container.edgeType == numberTypeEnum::int32Type) {
       auto graph =
-        detail::create_graph<int32_t, int32_t, weight_t, false, true>(handle, graph_container);
+        detail::get_graph<int32_t, int32_t, weight_t, false, true>(handle, graph_container);
       cugraph::experimental::sssp(handle,
                                   graph->view(),
                                   reinterpret_cast<weight_t*>(distances),
@@ -876,7 +906,7 @@ void call_sssp(raft::handle_t const& handle,
                                   static_cast<int32_t>(source_vertex));
     } else if (graph_container.edgeType == numberTypeEnum::int64Type) {
       auto graph =
-        detail::create_graph<vertex_t, int64_t, weight_t, false, true>(handle, graph_container);
+        detail::get_graph<vertex_t, int64_t, weight_t, false, true>(handle, graph_container);
       cugraph::experimental::sssp(handle,
                                   graph->view(),
                                   reinterpret_cast<weight_t*>(distances),
@@ -909,6 +939,10 @@ std::unique_ptr<major_minor_weights_t<vertex_t, edge_t, weight_t>> call_shuffle(
   std::unique_ptr<major_minor_weights_t<vertex_t, edge_t, weight_t>> ptr_ret =
     std::make_unique<major_minor_weights_t<vertex_t, edge_t, weight_t>>(handle);
 
+  // edges are grouped and shuffled in chunks to bound the temporary memory requirement of sorting
+  // and to overlap sorting with communication
+  size_t constexpr shuffle_chunk_size = size_t{1} << 24;  // FIXME: requires tuning
+
   if (edgelist_weights != nullptr) {
     auto zip_edge = thrust::make_zip_iterator(
       thrust::make_tuple(edgelist_major_vertices, edgelist_minor_vertices, edgelist_weights));
@@ -916,7 +950,7 @@ std::unique_ptr<major_minor_weights_t<vertex_t, edge_t, weight_t>> call_shuffle(
     std::forward_as_tuple(
       std::tie(ptr_ret->get_major(), ptr_ret->get_minor(), ptr_ret->get_weights()),
       std::ignore) =
-      cugraph::experimental::groupby_gpuid_and_shuffle_values(
+      cugraph::experimental::chunked_groupby_gpuid_and_shuffle_values(
         comm,  // handle.get_comms(),
         zip_edge,
         zip_edge + num_edgelist_edges,
@@ -925,6 +959,7 @@ std::unique_ptr<major_minor_weights_t<vertex_t, edge_t, weight_t>> call_shuffle(
              comm.get_size(), row_comm.get_size(), col_comm.get_size()}] __device__(auto val) {
           return key_func(thrust::get<0>(val), thrust::get<1>(val));
         },
+        shuffle_chunk_size,
         handle.get_stream());
   } else {
     auto zip_edge = thrust::make_zip_iterator(
@@ -932,7 +967,7 @@ std::unique_ptr<major_minor_weights_t<vertex_t, edge_t, weight_t>> call_shuffle(
 
     std::forward_as_tuple(std::tie(ptr_ret->get_major(), ptr_ret->get_minor()),
                           std::ignore) =
-      cugraph::experimental::groupby_gpuid_and_shuffle_values(
+      cugraph::experimental::chunked_groupby_gpuid_and_shuffle_values(
         comm,  // handle.get_comms(),
         zip_edge,
         zip_edge + num_edgelist_edges,
@@ -941,6 +976,7 @@ std::unique_ptr<major_minor_weights_t<vertex_t, edge_t, weight_t>> call_shuffle(
              comm.get_size(), row_comm.get_size(), col_comm.get_size()}] __device__(auto val) {
           return key_func(thrust::get<0>(val), thrust::get<1>(val));
         },
+        shuffle_chunk_size,
         handle.get_stream());
   }
 
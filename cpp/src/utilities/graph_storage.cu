@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/error.hpp>
+#include <utilities/graph_storage.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/managed_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <utility>
+
+namespace cugraph {
+namespace experimental {
+
+namespace {
+
+// mapped pinned host memory, the device pointer of a mapped allocation equals the host pointer
+// with unified addressing
+class pinned_host_memory_resource_t : public rmm::mr::device_memory_resource {
+ public:
+  bool supports_streams() const noexcept override { return false; }
+  bool supports_get_mem_info() const noexcept override { return false; }
+
+ private:
+  void* do_allocate(size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    void* ptr{nullptr};
+    if (bytes > 0) {
+      CUDA_TRY(cudaHostAlloc(&ptr, bytes, cudaHostAllocMapped | cudaHostAllocPortable));
+    }
+    return ptr;
+  }
+
+  void do_deallocate(void* p, size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    if (p != nullptr) { CUDA_TRY(cudaFreeHost(p)); }
+  }
+
+  std::pair<size_t, size_t> do_get_mem_info(rmm::cuda_stream_view stream) const override
+  {
+    return std::make_pair(size_t{0}, size_t{0});
+  }
+};
+
+}  // namespace
+
+namespace detail {
+
+rmm::mr::device_memory_resource* get_graph_storage_resource(graph_storage_t storage)
+{
+  static rmm::mr::managed_memory_resource managed_mr{};
+  static pinned_host_memory_resource_t pinned_host_mr{};
+
+  switch (storage) {
+    case graph_storage_t::managed: return &managed_mr;
+    case graph_storage_t::pinned_host: return &pinned_host_mr;
+    default: return rmm::mr::get_current_device_resource();
+  }
+}
+
+bool is_managed_memory(void const* ptr)
+{
+  if (ptr == nullptr) { return false; }
+  cudaPointerAttributes attributes{};
+  if (cudaPointerGetAttributes(&attributes, ptr) != cudaSuccess) {
+    cudaGetLastError();  // clear the error (unregistered host memory)
+    return false;
+  }
+  return attributes.type == cudaMemoryTypeManaged;
+}
+
+void advise_read_mostly(void const* ptr, size_t bytes)
+{
+  if ((bytes == 0) || !is_managed_memory(ptr)) { return; }
+  int device{};
+  CUDA_TRY(cudaGetDevice(&device));
+  CUDA_TRY(cudaMemAdvise(ptr, bytes, cudaMemAdviseSetReadMostly, device));
+  CUDA_TRY(cudaMemAdvise(ptr, bytes, cudaMemAdviseSetAccessedBy, device));
+}
+
+void prefetch_to_device(void const* ptr, size_t bytes, cudaStream_t stream)
+{
+  if ((bytes == 0) || !is_managed_memory(ptr)) { return; }
+  int device{};
+  CUDA_TRY(cudaGetDevice(&device));
+  CUDA_TRY(cudaMemPrefetchAsync(ptr, bytes, device, stream));
+}
+
+}  // namespace detail
+
+}  // namespace experimental
+}  // namespace cugraph
@@ -22,6 +22,10 @@
 #ifndef HEAP_H
 #define HEAP_H
 
+#include <thrust/swap.h>
+
+#include <type_traits>
+
 namespace cugraph {
 namespace detail {
 
@@ -214,6 +218,92 @@ inline ArrayT __host__ __device__ heap_pop(ArrayT *array, IndexT size, CompareT
 
   return array[size];
 }
+
+/**
+ * @brief Push an element onto the heap.  Note that the caller
+ *        should increment the size - the array must have room
+ *        for size + 1 elements.
+ *
+ *   ArrayT is a templated type of the array elements
+ *   IndexT is a templated integer type of the index
+ *   CompareT is a templated compare function
+ *
+ * @param[in, out]   array   - the existing heap
+ * @param[in]        size    - the number of elements in the existing heap
+ * @param[in]        value   - the element to push
+ * @param[in]        compare - the comparison function to use
+ */
+template <typename ArrayT, typename IndexT, typename CompareT>
+inline void __host__ __device__ heap_push(ArrayT *array,
+                                          IndexT size,
+                                          ArrayT value,
+                                          CompareT compare)
+{
+  static_assert(std::is_integral<IndexT>::value, "Index must be of an integral type");
+
+  //
+  //  Add the element at the end and sift it up to the proper location.
+  //
+  array[size] = value;
+  for (IndexT i = size; i > 0;) {
+    IndexT p = detail::parent(i);
+
+    if (compare(array[i], array[p])) {
+      thrust::swap(array[i], array[p]);
+      i = p;
+    } else {
+      i = 0;
+    }
+  }
+}
+
+/**
+ * @brief Replace the top element of the heap (the heap size is
+ *        unchanged).  This is equivalent to (but cheaper than)
+ *        heap_pop followed by heap_push.
+ *
+ *   ArrayT is a templated type of the array elements
+ *   IndexT is a templated integer type of the index
+ *   CompareT is a templated compare function
+ *
+ * @param[in, out]   array   - the existing heap
+ * @param[in]        size    - the number of elements in the existing heap
+ * @param[in]        value   - the element replacing the top of the heap
+ * @param[in]        compare - the comparison function to use
+ */
+template <typename ArrayT, typename IndexT, typename CompareT>
+inline void __host__ __device__ heap_replace_top(ArrayT *array,
+                                                 IndexT size,
+                                                 ArrayT value,
+                                                 CompareT compare)
+{
+  static_assert(std::is_integral<IndexT>::value, "Index must be of an integral type");
+
+  array[0] = value;
+
+  //
+  //  Now top element might no longer be the smallest (largest), so we
+  //  need to sift it down to the proper location.
+  //
+  for (IndexT i = 0; i < size;) {
+    IndexT lc      = detail::left_child(i);
+    IndexT rc      = detail::right_child(i);
+    IndexT smaller = i;
+
+    if (rc < size) {
+      smaller = (compare(array[lc], array[rc])) ? lc : rc;
+    } else if (lc < size) {
+      smaller = lc;
+    }
+
+    if ((smaller != i) && (compare(array[smaller], array[i]))) {
+      thrust::swap(array[i], array[smaller]);
+      i = smaller;
+    } else {
+      i = size;
+    }
+  }
+}
 }  // namespace heap
 
 }  // namespace detail
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/error.hpp>
+#include <utilities/profiling.hpp>
+
+#include <raft/handle.hpp>
+
+#ifdef NVTX_ENABLED
+#include <nvtx3/nvToolsExt.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+
+namespace {
+
+// closed ranges with events not yet read back are harvested (without blocking) once there are more
+// than this number of them, so a long run without report requests does not accumulate events
+size_t constexpr max_pending_ranges{4096};
+
+struct pending_range_t {
+  std::string path{};
+  cudaEvent_t start{};
+  cudaEvent_t stop{};
+};
+
+struct range_accumulator_t {
+  size_t num_calls{0};
+  double gpu_time_ms{0.0};
+};
+
+struct profiling_state_t {
+  profiling_state_t()
+  {
+    auto profiling_env = std::getenv("CUGRAPH_PROFILING");
+    enabled            = (profiling_env != nullptr) && (std::atoi(profiling_env) != 0);
+  }
+
+  std::atomic<bool> enabled{false};
+  std::mutex mutex{};
+  std::vector<pending_range_t> pending_ranges{};
+  std::map<std::string, range_accumulator_t> ranges{};
+  std::map<std::string, profile_counter_record_t> counters{};
+};
+
+profiling_state_t& get_profiling_state()
+{
+  static profiling_state_t state{};
+  return state;
+}
+
+// paths of the open ranges of this host thread (innermost last)
+std::vector<std::string>& get_range_stack()
+{
+  thread_local std::vector<std::string> stack{};
+  return stack;
+}
+
+// should be called with state.mutex locked, blocks only if wait is true
+void harvest_pending_ranges(profiling_state_t& state, bool wait)
+{
+  auto last = std::partition(
+    state.pending_ranges.begin(), state.pending_ranges.end(), [wait](auto const& range) {
+      return !wait && (cudaEventQuery(range.stop) == cudaErrorNotReady);
+    });
+  for (auto it = last; it != state.pending_ranges.end(); ++it) {
+    float elapsed{0.0};
+    if ((cudaEventSynchronize(it->stop) == cudaSuccess) &&
+        (cudaEventElapsedTime(&elapsed, it->start, it->stop) == cudaSuccess)) {
+      auto& accumulator = state.ranges[it->path];
+      ++accumulator.num_calls;
+      accumulator.gpu_time_ms += static_cast<double>(elapsed);
+    }
+    cudaEventDestroy(it->start);
+    cudaEventDestroy(it->stop);
+  }
+  state.pending_ranges.erase(last, state.pending_ranges.end());
+}
+
+void append_json_string(std::ostringstream& oss, std::string const& str)
+{
+  oss << '"';
+  for (auto c : str) {
+    if ((c == '"') || (c == '\\')) { oss << '\\'; }
+    oss << c;
+  }
+  oss << '"';
+}
+
+}  // namespace
+
+void set_profiling(bool enable) { get_profiling_state().enabled = enable; }
+
+bool is_profiling_enabled() { return get_profiling_state().enabled; }
+
+std::string profiling_report_t::to_json() const
+{
+  std::ostringstream oss{};
+  oss.precision(17);
+  oss << "{\"ranges\": [";
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    oss << (i > 0 ? ", " : "") << "{\"path\": ";
+    append_json_string(oss, ranges[i].path);
+    oss << ", \"num_calls\": " << ranges[i].num_calls
+        << ", \"gpu_time_ms\": " << ranges[i].gpu_time_ms << "}";
+  }
+  oss << "], \"counters\": [";
+  for (size_t i = 0; i < counters.size(); ++i) {
+    oss << (i > 0 ? ", " : "") << "{\"path\": ";
+    append_json_string(oss, counters[i].path);
+    oss << ", \"num_updates\": " << counters[i].num_updates << ", \"sum\": " << counters[i].sum
+        << ", \"max\": " << counters[i].max << "}";
+  }
+  oss << "]}";
+  return oss.str();
+}
+
+profiling_report_t get_profiling_report()
+{
+  auto& state = get_profiling_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  harvest_pending_ranges(state, true);
+
+  profiling_report_t ret{};
+  ret.ranges.reserve(state.ranges.size());
+  for (auto const& pair : state.ranges) {
+    ret.ranges.push_back(
+      profile_range_record_t{pair.first, pair.second.num_calls, pair.second.gpu_time_ms});
+  }
+  ret.counters.reserve(state.counters.size());
+  for (auto const& pair : state.counters) {
+    ret.counters.push_back(pair.second);
+  }
+  return ret;
+}
+
+void clear_profiling_report()
+{
+  auto& state = get_profiling_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  harvest_pending_ranges(state, true);
+  state.ranges.clear();
+  state.counters.clear();
+}
+
+namespace detail {
+
+profile_range_t::profile_range_t(raft::handle_t const& handle, char const* name)
+  : stream_(handle.get_stream()), timing_(is_profiling_enabled())
+{
+#ifdef NVTX_ENABLED
+  nvtxRangePushA(name);
+#endif
+  if (timing_) {
+    auto& stack = get_range_stack();
+    stack.push_back(stack.empty() ? std::string(name) : stack.back() + "/" + name);
+    CUDA_TRY(cudaEventCreate(&start_));
+    CUDA_TRY(cudaEventRecord(start_, stream_));
+  }
+}
+
+profile_range_t::~profile_range_t()
+{
+  if (timing_) {
+    auto& stack = get_range_stack();
+    cudaEvent_t stop{};
+    if ((cudaEventCreate(&stop) == cudaSuccess) &&
+        (cudaEventRecord(stop, stream_) == cudaSuccess)) {
+      auto& state = get_profiling_state();
+      std::lock_guard<std::mutex> lock(state.mutex);
+      state.pending_ranges.push_back(pending_range_t{stack.back(), start_, stop});
+      if (state.pending_ranges.size() > max_pending_ranges) {
+        harvest_pending_ranges(state, false);
+      }
+    } else {
+      cudaEventDestroy(start_);
+    }
+    stack.pop_back();
+  }
+#ifdef NVTX_ENABLED
+  nvtxRangePop();
+#endif
+}
+
+void add_profile_counter(char const* name, int64_t value)
+{
+  auto& state = get_profiling_state();
+  if (!state.enabled) { return; }
+
+  auto const& stack = get_range_stack();
+  auto path         = stack.empty() ? std::string(name) : stack.back() + "/" + name;
+  std::lock_guard<std::mutex> lock(state.mutex);
+  auto& counter = state.counters[path];
+  if (counter.num_updates == 0) {
+    counter.path = path;
+    counter.max  = value;
+  }
+  ++counter.num_updates;
+  counter.sum += value;
+  counter.max = std::max(counter.max, value);
+}
+
+}  // namespace detail
+
+}  // namespace experimental
+}  // namespace cugraph
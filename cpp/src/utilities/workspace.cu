@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/error.hpp>
+#include <utilities/profiling.hpp>
+#include <utilities/workspace.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace cugraph {
+namespace experimental {
+
+namespace {
+
+struct workspace_bindings_t {
+  std::mutex mutex{};
+  std::map<raft::handle_t const*, std::vector<workspace_arena_t*>> arenas{};
+};
+
+workspace_bindings_t& get_workspace_bindings()
+{
+  static workspace_bindings_t bindings{};
+  return bindings;
+}
+
+workspace_arena_t* get_bound_arena(raft::handle_t const& handle)
+{
+  auto& bindings = get_workspace_bindings();
+  std::lock_guard<std::mutex> lock(bindings.mutex);
+  auto it = bindings.arenas.find(&handle);
+  return it != bindings.arenas.end() ? it->second.back() : nullptr;
+}
+
+}  // namespace
+
+workspace_arena_t::workspace_arena_t(size_t chunk_size, rmm::mr::device_memory_resource* upstream)
+  : chunk_size_(std::max(chunk_size, alignment)), upstream_(upstream)
+{
+  CUGRAPH_EXPECTS(upstream_ != nullptr, "Invalid input argument: upstream should not be nullptr.");
+}
+
+workspace_arena_t::~workspace_arena_t() { release(); }
+
+size_t workspace_arena_t::get_used_bytes() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return used_bytes();
+}
+
+size_t workspace_arena_t::get_peak_bytes() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return peak_bytes_;
+}
+
+size_t workspace_arena_t::get_capacity_bytes() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t ret{0};
+  for (auto const& chunk : chunks_) {
+    ret += chunk.size;
+  }
+  return ret;
+}
+
+void workspace_arena_t::reset_peak_bytes()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  peak_bytes_ = used_bytes();
+}
+
+workspace_arena_t::mark_t workspace_arena_t::get_mark() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return mark_t{chunk_idx_, offset_};
+}
+
+void workspace_arena_t::rewind(mark_t mark)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  chunk_idx_ = mark.chunk_idx;
+  offset_    = mark.offset;
+}
+
+void workspace_arena_t::release()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto const& chunk : chunks_) {
+    upstream_->deallocate(chunk.ptr, chunk.size, chunk.stream);
+  }
+  chunks_.clear();
+  chunk_idx_ = 0;
+  offset_    = 0;
+}
+
+void* workspace_arena_t::do_allocate(size_t bytes, rmm::cuda_stream_view stream)
+{
+  auto aligned_bytes = ((bytes + alignment - 1) / alignment) * alignment;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if ((chunk_idx_ >= chunks_.size()) || (offset_ + aligned_bytes > chunks_[chunk_idx_].size)) {
+    if ((chunk_idx_ + 1 < chunks_.size()) && (aligned_bytes <= chunks_[chunk_idx_ + 1].size)) {
+      ++chunk_idx_;
+    } else {
+      // chunks after the bump pointer too small for this allocation are kept for later use
+      auto size = std::max(chunk_size_, aligned_bytes);
+      chunk_t chunk{upstream_->allocate(size, stream), size, stream};
+      if (chunks_.empty()) {
+        chunks_.push_back(chunk);
+      } else {
+        chunks_.insert(chunks_.begin() + (chunk_idx_ + 1), chunk);
+        ++chunk_idx_;
+      }
+    }
+    offset_ = 0;
+  }
+
+  auto ret = static_cast<void*>(static_cast<uint8_t*>(chunks_[chunk_idx_].ptr) + offset_);
+  offset_ += aligned_bytes;
+  peak_bytes_ = std::max(peak_bytes_, used_bytes());
+  return ret;
+}
+
+void workspace_arena_t::do_deallocate(void* p, size_t bytes, rmm::cuda_stream_view stream)
+{
+  auto aligned_bytes = ((bytes + alignment - 1) / alignment) * alignment;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if ((chunk_idx_ < chunks_.size()) && (offset_ >= aligned_bytes) &&
+      (static_cast<uint8_t*>(chunks_[chunk_idx_].ptr) + (offset_ - aligned_bytes) ==
+       static_cast<uint8_t*>(p))) {
+    offset_ -= aligned_bytes;  // the most recent allocation
+  }
+}
+
+size_t workspace_arena_t::used_bytes() const
+{
+  size_t ret{offset_};
+  for (size_t i = 0; i < std::min(chunk_idx_, chunks_.size()); ++i) {
+    ret += chunks_[i].size;
+  }
+  return ret;
+}
+
+workspace_scope_t::workspace_scope_t(raft::handle_t const& handle, workspace_arena_t& arena)
+  : handle_ptr_(&handle), arena_ptr_(&arena), mark_(arena.get_mark())
+{
+  auto& bindings = get_workspace_bindings();
+  std::lock_guard<std::mutex> lock(bindings.mutex);
+  bindings.arenas[handle_ptr_].push_back(arena_ptr_);
+}
+
+workspace_scope_t::~workspace_scope_t()
+{
+  {
+    auto& bindings = get_workspace_bindings();
+    std::lock_guard<std::mutex> lock(bindings.mutex);
+    auto it = bindings.arenas.find(handle_ptr_);
+    it->second.pop_back();
+    if (it->second.empty()) { bindings.arenas.erase(it); }
+  }
+  detail::add_profile_counter("workspace_peak_bytes",
+                              static_cast<int64_t>(arena_ptr_->get_peak_bytes()));
+  arena_ptr_->rewind(mark_);
+}
+
+namespace detail {
+
+rmm::mr::device_memory_resource* get_workspace_resource(raft::handle_t const& handle)
+{
+  auto arena_ptr = get_bound_arena(handle);
+  return arena_ptr != nullptr ? static_cast<rmm::mr::device_memory_resource*>(arena_ptr)
+                              : rmm::mr::get_current_device_resource();
+}
+
+workspace_phase_t::workspace_phase_t(raft::handle_t const& handle)
+  : arena_ptr_(get_bound_arena(handle))
+{
+  if (arena_ptr_ != nullptr) { mark_ = arena_ptr_->get_mark(); }
+}
+
+workspace_phase_t::~workspace_phase_t()
+{
+  if (arena_ptr_ != nullptr) { arena_ptr_->rewind(mark_); }
+}
+
+}  // namespace detail
+
+}  // namespace experimental
+}  // namespace cugraph
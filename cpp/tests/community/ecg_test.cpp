@@ -9,8 +9,10 @@
  *
  */
 #include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
 
 #include <algorithms.hpp>
+#include <experimental/graph.hpp>
 #include <graph.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
@@ -158,4 +160,64 @@ TEST(ecg, dolphin)
   }
 }
 
+TEST(ecg, dolphin_experimental)
+{
+  raft::handle_t handle;
+
+  auto stream = handle.get_stream();
+
+  cugraph::experimental::graph_t<int32_t, int32_t, float, false, false> graph(handle);
+  std::tie(graph, std::ignore) =
+    cugraph::test::read_graph_from_matrix_market_file<int32_t, int32_t, float, false, false>(
+      handle,
+      cugraph::test::get_rapids_dataset_root_dir() + "/test/datasets/dolphins.mtx",
+      true,
+      false);
+  auto graph_view = graph.view();
+
+  int num_verts = graph_view.get_number_of_vertices();
+  int num_edges = graph_view.get_number_of_edges();
+
+  std::vector<int> cluster_id(num_verts, -1);
+  rmm::device_uvector<int> result_v(num_verts, stream);
+
+  // "FIXME": remove this check once we drop support for Pascal
+  //
+  // Calling ecg on Pascal will throw an exception, we'll check that
+  // this is the behavior while we still support Pascal (device_prop.major < 7)
+  //
+  if (handle.get_device_properties().major < 7) {
+    EXPECT_THROW(cugraph::ecg(handle, graph_view, 0.05f, 16, result_v.data()),
+                 cugraph::logic_error);
+  } else {
+    cugraph::ecg(handle, graph_view, 0.05f, 16, result_v.data());
+
+    raft::update_host(cluster_id.data(), result_v.data(), num_verts, stream);
+
+    CUDA_TRY(cudaDeviceSynchronize());
+
+    int max = *max_element(cluster_id.begin(), cluster_id.end());
+    int min = *min_element(cluster_id.begin(), cluster_id.end());
+
+    ASSERT_EQ((min >= 0), 1);
+
+    // compute the modularity with the input (unit) weights
+    cugraph::GraphCSRView<int, int, float> graph_csr(
+      const_cast<int*>(graph_view.offsets()),
+      const_cast<int*>(graph_view.indices()),
+      const_cast<float*>(graph_view.weights()),
+      num_verts,
+      num_edges);
+
+    float modularity{0.0};
+
+    cugraph::ext_raft::analyzeClustering_modularity(
+      graph_csr, max + 1, result_v.data(), &modularity);
+
+    float random_modularity{0.95 * 0.4962422251701355};
+
+    ASSERT_GT(modularity, random_modularity);
+  }
+}
+
 CUGRAPH_TEST_PROGRAM_MAIN()
@@ -10,7 +10,10 @@
  */
 #include <gtest/gtest.h>
 
+#include <utilities/test_utilities.hpp>
+
 #include <algorithms.hpp>
+#include <experimental/graph.hpp>
 #include <graph.hpp>
 
 #include <thrust/extrema.h>
@@ -85,3 +88,45 @@ TEST(leiden_karate, success)
     ASSERT_GE(modularity, 0.41116042 * 0.99);
   }
 }
+
+TEST(leiden_karate_experimental, success)
+{
+  raft::handle_t handle;
+
+  auto stream = handle.get_stream();
+
+  cugraph::experimental::graph_t<int32_t, int32_t, float, false, false> graph(handle);
+  std::tie(graph, std::ignore) =
+    cugraph::test::read_graph_from_matrix_market_file<int32_t, int32_t, float, false, false>(
+      handle,
+      cugraph::test::get_rapids_dataset_root_dir() + "/test/datasets/karate.mtx",
+      true,
+      false);
+  auto graph_view = graph.view();
+
+  std::vector<int32_t> cluster_id(graph_view.get_number_of_vertices(), -1);
+  rmm::device_uvector<int32_t> result_v(graph_view.get_number_of_vertices(), stream);
+
+  float modularity{0.0};
+  size_t num_level = 40;
+
+  // "FIXME": remove this check once we drop support for Pascal
+  //
+  // Calling leiden on Pascal will throw an exception, we'll check that
+  // this is the behavior while we still support Pascal (device_prop.major < 7)
+  //
+  if (handle.get_device_properties().major < 7) {
+    EXPECT_THROW(cugraph::leiden(handle, graph_view, result_v.data()), cugraph::logic_error);
+  } else {
+    std::tie(num_level, modularity) = cugraph::leiden(handle, graph_view, result_v.data());
+
+    raft::update_host(cluster_id.data(), result_v.data(), cluster_id.size(), stream);
+
+    CUDA_TRY(cudaDeviceSynchronize());
+
+    int min = *min_element(cluster_id.begin(), cluster_id.end());
+
+    ASSERT_GE(min, 0);
+    ASSERT_GE(modularity, 0.41116042 * 0.99);
+  }
+}
@@ -130,6 +130,101 @@ class Tests_Louvain : public ::testing::TestWithParam<Louvain_Usecase> {
     }
   }
 
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_vertex_coloring_test(Louvain_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, false> graph(handle);
+    std::tie(graph, std::ignore) =
+      cugraph::test::read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, false>(
+        handle, configuration.graph_file_full_path_, configuration.test_weighted_, false);
+
+    auto graph_view = graph.view();
+
+    cudaDeviceProp device_prop;
+    CUDA_CHECK(cudaGetDeviceProperties(&device_prop, 0));
+
+    rmm::device_uvector<vertex_t> clustering_v(graph_view.get_number_of_local_vertices(),
+                                               handle.get_stream());
+
+    if (device_prop.major < 7) {
+      EXPECT_THROW(cugraph::louvain(
+                     handle, graph_view, clustering_v.data(), size_t{100}, weight_t{1}, true),
+                   cugraph::logic_error);
+    } else {
+      size_t level;
+      weight_t modularity;
+
+      std::tie(level, modularity) = cugraph::louvain(
+        handle, graph_view, clustering_v.data(), size_t{100}, weight_t{1}, true);
+
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+      // expect modularity comparable to (or better than) moving every vertex at once
+      ASSERT_GE(static_cast<float>(modularity), configuration.expected_modularity_ * 0.99);
+    }
+  }
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_memory_bounded_test(Louvain_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, false> graph(handle);
+    std::tie(graph, std::ignore) =
+      cugraph::test::read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, false>(
+        handle, configuration.graph_file_full_path_, configuration.test_weighted_, false);
+
+    auto graph_view = graph.view();
+
+    cudaDeviceProp device_prop;
+    CUDA_CHECK(cudaGetDeviceProperties(&device_prop, 0));
+
+    rmm::device_uvector<vertex_t> clustering_v(graph_view.get_number_of_local_vertices(),
+                                               handle.get_stream());
+
+    if (device_prop.major < 7) {
+      EXPECT_THROW(cugraph::louvain(handle,
+                                    graph_view,
+                                    clustering_v.data(),
+                                    size_t{100},
+                                    weight_t{1},
+                                    false,
+                                    true),
+                   cugraph::logic_error);
+    } else {
+      size_t level;
+      weight_t modularity;
+
+      std::tie(level, modularity) = cugraph::louvain(
+        handle, graph_view, clustering_v.data(), size_t{100}, weight_t{1}, false, true);
+
+      rmm::device_uvector<vertex_t> reference_clustering_v(clustering_v.size(),
+                                                           handle.get_stream());
+      size_t reference_level;
+      weight_t reference_modularity;
+
+      std::tie(reference_level, reference_modularity) = cugraph::louvain(
+        handle, graph_view, reference_clustering_v.data(), size_t{100}, weight_t{1});
+
+      std::vector<vertex_t> h_clustering(clustering_v.size());
+      std::vector<vertex_t> h_reference_clustering(reference_clustering_v.size());
+      raft::update_host(
+        h_clustering.data(), clustering_v.data(), clustering_v.size(), handle.get_stream());
+      raft::update_host(h_reference_clustering.data(),
+                        reference_clustering_v.data(),
+                        reference_clustering_v.size(),
+                        handle.get_stream());
+      CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+      // composing the levels on the fly should not change the result
+      ASSERT_EQ(level, reference_level);
+      ASSERT_FLOAT_EQ(static_cast<float>(modularity), static_cast<float>(reference_modularity));
+      ASSERT_EQ(h_clustering, h_reference_clustering);
+    }
+  }
+
   template <typename graph_t>
   void louvain(graph_t const& graph_view,
                typename graph_t::vertex_type num_vertices,
@@ -312,6 +407,16 @@ TEST_P(Tests_Louvain, CheckInt32Int32FloatFloat)
   run_current_test<int32_t, int32_t, float, float>(GetParam());
 }
 
+TEST_P(Tests_Louvain, CheckInt32Int32FloatFloatVertexColoring)
+{
+  run_vertex_coloring_test<int32_t, int32_t, float, float>(GetParam());
+}
+
+TEST_P(Tests_Louvain, CheckInt32Int32FloatFloatMemoryBounded)
+{
+  run_memory_bounded_test<int32_t, int32_t, float, float>(GetParam());
+}
+
 // FIXME: Expand testing once we evaluate RMM memory use
 INSTANTIATE_TEST_CASE_P(
   simple_test,
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+typedef struct BatchedKatzCentrality_Usecase_t {
+  std::string graph_file_full_path{};
+  size_t num_variants{0};
+  bool test_weighted{false};
+
+  BatchedKatzCentrality_Usecase_t(std::string const& graph_file_path,
+                                  size_t num_variants,
+                                  bool test_weighted)
+    : num_variants(num_variants), test_weighted(test_weighted)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} BatchedKatzCentrality_Usecase;
+
+class Tests_BatchedKatzCentrality
+  : public ::testing::TestWithParam<BatchedKatzCentrality_Usecase> {
+ public:
+  Tests_BatchedKatzCentrality() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(BatchedKatzCentrality_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, true, false> graph(handle);
+    std::tie(graph, std::ignore) = cugraph::test::
+      read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, true, false>(
+        handle, configuration.graph_file_full_path, configuration.test_weighted, false);
+    auto graph_view = graph.view();
+
+    auto num_vertices = graph_view.get_number_of_vertices();
+    auto num_columns  = configuration.num_variants;
+
+    auto degrees = graph_view.compute_in_degrees(handle);
+    std::vector<edge_t> h_degrees(degrees.size());
+    raft::update_host(h_degrees.data(), degrees.data(), degrees.size(), handle.get_stream());
+    handle.get_stream_view().synchronize();
+    auto max_it = std::max_element(h_degrees.begin(), h_degrees.end());
+
+    // sweep alpha up to the value used in the (non-batched) Katz Centrality tests
+    std::vector<result_t> h_alphas(num_columns);
+    std::vector<result_t> h_betas(num_columns);
+    for (size_t i = 0; i < num_columns; ++i) {
+      h_alphas[i] = (result_t{1.0} / static_cast<result_t>(*max_it + 1)) *
+                    (static_cast<result_t>(i + 1) / static_cast<result_t>(num_columns));
+      h_betas[i]  = result_t{1.0} + static_cast<result_t>(i % 3) * result_t{0.5};
+    }
+
+    rmm::device_uvector<result_t> d_alphas(h_alphas.size(), handle.get_stream());
+    rmm::device_uvector<result_t> d_betas(h_betas.size(), handle.get_stream());
+    raft::update_device(d_alphas.data(), h_alphas.data(), h_alphas.size(), handle.get_stream());
+    raft::update_device(d_betas.data(), h_betas.data(), h_betas.size(), handle.get_stream());
+
+    result_t constexpr epsilon{1e-6};
+
+    rmm::device_uvector<result_t> d_katz_centralities(
+      static_cast<size_t>(num_vertices) * num_columns, handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    cugraph::experimental::batched_katz_centrality(handle,
+                                                   graph_view,
+                                                   num_columns,
+                                                   d_alphas.data(),
+                                                   d_betas.data(),
+                                                   d_katz_centralities.data(),
+                                                   epsilon,
+                                                   std::numeric_limits<size_t>::max(),
+                                                   false,
+                                                   true,
+                                                   true);
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    std::vector<result_t> h_cugraph_katz_centralities(d_katz_centralities.size());
+    raft::update_host(h_cugraph_katz_centralities.data(),
+                      d_katz_centralities.data(),
+                      d_katz_centralities.size(),
+                      handle.get_stream());
+    handle.get_stream_view().synchronize();
+
+    auto threshold_ratio = 1e-3;
+    auto threshold_magnitude =
+      (1.0 / static_cast<result_t>(num_vertices)) *
+      threshold_ratio;  // skip comparison for low Katz Centrality verties (lowly ranked vertices)
+    auto nearly_equal = [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+      return std::abs(lhs - rhs) <
+             std::max(std::max(lhs, rhs) * threshold_ratio, threshold_magnitude);
+    };
+
+    // compare every column with the Katz Centrality scores computed one variant at a time
+
+    rmm::device_uvector<result_t> d_reference_katz_centralities(num_vertices, handle.get_stream());
+    std::vector<result_t> h_reference_katz_centralities(num_vertices);
+    for (size_t i = 0; i < num_columns; ++i) {
+      cugraph::experimental::katz_centrality(handle,
+                                             graph_view,
+                                             static_cast<result_t*>(nullptr),
+                                             d_reference_katz_centralities.data(),
+                                             h_alphas[i],
+                                             h_betas[i],
+                                             epsilon,
+                                             std::numeric_limits<size_t>::max(),
+                                             false,
+                                             true,
+                                             false);
+      raft::update_host(h_reference_katz_centralities.data(),
+                        d_reference_katz_centralities.data(),
+                        d_reference_katz_centralities.size(),
+                        handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      for (vertex_t v = 0; v < num_vertices; ++v) {
+        ASSERT_TRUE(
+          nearly_equal(h_reference_katz_centralities[v],
+                       h_cugraph_katz_centralities[static_cast<size_t>(v) * num_columns + i]))
+          << "Batched Katz Centrality values do not match with the reference values (variant "
+          << i << ", vertex " << v << ").";
+      }
+    }
+  }
+};
+
+// FIXME: add tests for type combinations
+TEST_P(Tests_BatchedKatzCentrality, CheckInt32Int32FloatFloat)
+{
+  run_current_test<int32_t, int32_t, float, float>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_BatchedKatzCentrality,
+  ::testing::Values(BatchedKatzCentrality_Usecase("test/datasets/karate.mtx", 1, false),
+                    BatchedKatzCentrality_Usecase("test/datasets/karate.mtx", 16, true),
+                    BatchedKatzCentrality_Usecase("test/datasets/web-Google.mtx", 8, false),
+                    BatchedKatzCentrality_Usecase("test/datasets/web-Google.mtx", 40, true),
+                    BatchedKatzCentrality_Usecase("test/datasets/ljournal-2008.mtx", 8, false)));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+typedef struct BatchedPersonalizedPageRank_Usecase_t {
+  std::string graph_file_full_path{};
+  size_t num_personalization_vectors{0};
+  double personalization_ratio{0.0};
+  bool test_weighted{false};
+
+  BatchedPersonalizedPageRank_Usecase_t(std::string const& graph_file_path,
+                                        size_t num_personalization_vectors,
+                                        double personalization_ratio,
+                                        bool test_weighted)
+    : num_personalization_vectors(num_personalization_vectors),
+      personalization_ratio(personalization_ratio),
+      test_weighted(test_weighted)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} BatchedPersonalizedPageRank_Usecase;
+
+class Tests_BatchedPersonalizedPageRank
+  : public ::testing::TestWithParam<BatchedPersonalizedPageRank_Usecase> {
+ public:
+  Tests_BatchedPersonalizedPageRank() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(BatchedPersonalizedPageRank_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, true, false> graph(handle);
+    std::tie(graph, std::ignore) = cugraph::test::
+      read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, true, false>(
+        handle, configuration.graph_file_full_path, configuration.test_weighted, false);
+    auto graph_view = graph.view();
+
+    auto num_vertices = graph_view.get_number_of_vertices();
+    auto num_columns  = configuration.num_personalization_vectors;
+
+    std::vector<edge_t> h_personalization_offsets(num_columns + 1, edge_t{0});
+    std::vector<vertex_t> h_personalization_vertices{};
+    std::vector<result_t> h_personalization_values{};
+    std::default_random_engine generator{};
+    std::uniform_real_distribution<double> distribution{0.0, 1.0};
+    for (size_t i = 0; i < num_columns; ++i) {
+      for (vertex_t v = 0; v < num_vertices; ++v) {
+        if (distribution(generator) < configuration.personalization_ratio) {
+          h_personalization_vertices.push_back(v);
+          h_personalization_values.push_back(static_cast<result_t>(distribution(generator)));
+        }
+      }
+      if (static_cast<edge_t>(h_personalization_vertices.size()) == h_personalization_offsets[i]) {
+        h_personalization_vertices.push_back(static_cast<vertex_t>(i % num_vertices));
+        h_personalization_values.push_back(result_t{1.0});
+      }
+      h_personalization_offsets[i + 1] = static_cast<edge_t>(h_personalization_vertices.size());
+    }
+
+    rmm::device_uvector<edge_t> d_personalization_offsets(h_personalization_offsets.size(),
+                                                          handle.get_stream());
+    rmm::device_uvector<vertex_t> d_personalization_vertices(h_personalization_vertices.size(),
+                                                             handle.get_stream());
+    rmm::device_uvector<result_t> d_personalization_values(h_personalization_values.size(),
+                                                           handle.get_stream());
+    raft::update_device(d_personalization_offsets.data(),
+                        h_personalization_offsets.data(),
+                        h_personalization_offsets.size(),
+                        handle.get_stream());
+    raft::update_device(d_personalization_vertices.data(),
+                        h_personalization_vertices.data(),
+                        h_personalization_vertices.size(),
+                        handle.get_stream());
+    raft::update_device(d_personalization_values.data(),
+                        h_personalization_values.data(),
+                        h_personalization_values.size(),
+                        handle.get_stream());
+
+    result_t constexpr alpha{0.85};
+    result_t constexpr epsilon{1e-6};
+
+    rmm::device_uvector<result_t> d_pageranks(static_cast<size_t>(num_vertices) * num_columns,
+                                              handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    cugraph::experimental::batched_personalized_pagerank(handle,
+                                                         graph_view,
+                                                         static_cast<weight_t*>(nullptr),
+                                                         num_columns,
+                                                         d_personalization_offsets.data(),
+                                                         d_personalization_vertices.data(),
+                                                         d_personalization_values.data(),
+                                                         d_pageranks.data(),
+                                                         alpha,
+                                                         epsilon,
+                                                         std::numeric_limits<size_t>::max(),
+                                                         false,
+                                                         true);
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    std::vector<result_t> h_cugraph_pageranks(d_pageranks.size());
+    raft::update_host(
+      h_cugraph_pageranks.data(), d_pageranks.data(), d_pageranks.size(), handle.get_stream());
+    handle.get_stream_view().synchronize();
+
+    auto threshold_ratio = 1e-3;
+    auto threshold_magnitude =
+      (1.0 / static_cast<result_t>(num_vertices)) *
+      threshold_ratio;  // skip comparison for low PageRank verties (lowly ranked vertices)
+    auto nearly_equal = [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+      return std::abs(lhs - rhs) <
+             std::max(std::max(lhs, rhs) * threshold_ratio, threshold_magnitude);
+    };
+
+    // compare every column with the personalized PageRank scores computed one vector at a time
+
+    rmm::device_uvector<result_t> d_reference_pageranks(num_vertices, handle.get_stream());
+    std::vector<result_t> h_reference_pageranks(num_vertices);
+    for (size_t i = 0; i < num_columns; ++i) {
+      cugraph::experimental::pagerank(
+        handle,
+        graph_view,
+        static_cast<weight_t*>(nullptr),
+        d_personalization_vertices.data() + h_personalization_offsets[i],
+        d_personalization_values.data() + h_personalization_offsets[i],
+        static_cast<vertex_t>(h_personalization_offsets[i + 1] - h_personalization_offsets[i]),
+        d_reference_pageranks.data(),
+        alpha,
+        epsilon,
+        std::numeric_limits<size_t>::max(),
+        false,
+        false);
+      raft::update_host(h_reference_pageranks.data(),
+                        d_reference_pageranks.data(),
+                        d_reference_pageranks.size(),
+                        handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      for (vertex_t v = 0; v < num_vertices; ++v) {
+        ASSERT_TRUE(nearly_equal(h_reference_pageranks[v],
+                                 h_cugraph_pageranks[static_cast<size_t>(v) * num_columns + i]))
+          << "Batched personalized PageRank values do not match with the reference values "
+             "(personalization vector "
+          << i << ", vertex " << v << ").";
+      }
+    }
+  }
+};
+
+// FIXME: add tests for type combinations
+TEST_P(Tests_BatchedPersonalizedPageRank, CheckInt32Int32FloatFloat)
+{
+  run_current_test<int32_t, int32_t, float, float>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_BatchedPersonalizedPageRank,
+  ::testing::Values(
+    BatchedPersonalizedPageRank_Usecase("test/datasets/karate.mtx", 1, 0.2, false),
+    BatchedPersonalizedPageRank_Usecase("test/datasets/karate.mtx", 16, 0.2, true),
+    BatchedPersonalizedPageRank_Usecase("test/datasets/web-Google.mtx", 8, 0.0001, false),
+    BatchedPersonalizedPageRank_Usecase("test/datasets/web-Google.mtx", 40, 0.0001, true),
+    BatchedPersonalizedPageRank_Usecase("test/datasets/ljournal-2008.mtx", 8, 0.0001, false),
+    BatchedPersonalizedPageRank_Usecase("test/datasets/ljournal-2008.mtx", 8, 0.0001, true)));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,470 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <tuple>
+#include <vector>
+
+// Brandes's algorithm (accumulating both vertex & edge dependencies), exact if sources is empty;
+// shortest paths are unweighted if weights is nullptr (and Dijkstra's algorithm visits the vertices
+// in the breadth-first order)
+template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+void betweenness_centrality_reference(edge_t const* offsets,
+                                      vertex_t const* indices,
+                                      weight_t const* weights,
+                                      vertex_t num_vertices,
+                                      std::vector<vertex_t> const& sources,
+                                      bool endpoints,
+                                      result_t* vertex_centralities,
+                                      result_t* edge_centralities)
+{
+  auto const unreached = std::numeric_limits<weight_t>::max();
+
+  std::fill(vertex_centralities, vertex_centralities + num_vertices, result_t{0.0});
+  std::fill(edge_centralities, edge_centralities + offsets[num_vertices], result_t{0.0});
+
+  std::vector<weight_t> distances(num_vertices);
+  std::vector<double> sigmas(num_vertices);
+  std::vector<double> deltas(num_vertices);
+  for (size_t i = 0; i < (sources.size() > 0 ? sources.size() : size_t(num_vertices)); ++i) {
+    auto s = sources.size() > 0 ? sources[i] : static_cast<vertex_t>(i);
+    std::fill(distances.begin(), distances.end(), unreached);
+    std::fill(sigmas.begin(), sigmas.end(), 0.0);
+    std::fill(deltas.begin(), deltas.end(), 0.0);
+
+    using queue_item_t = std::tuple<weight_t, vertex_t>;
+    std::vector<vertex_t> visited{};
+    std::priority_queue<queue_item_t, std::vector<queue_item_t>, std::greater<queue_item_t>>
+      queue{};
+    distances[s] = weight_t{0.0};
+    queue.push(std::make_tuple(weight_t{0.0}, s));
+    while (!queue.empty()) {
+      auto u = std::get<1>(queue.top());
+      auto d = std::get<0>(queue.top());
+      queue.pop();
+      if (d > distances[u]) { continue; }
+      visited.push_back(u);
+      for (auto j = offsets[u]; j < offsets[u + 1]; ++j) {
+        auto w = indices[j];
+        auto new_d = distances[u] + (weights != nullptr ? weights[j] : weight_t{1.0});
+        if (new_d < distances[w]) {
+          distances[w] = new_d;
+          queue.push(std::make_tuple(new_d, w));
+        }
+      }
+    }
+
+    auto is_dag_edge = [indices, weights, &distances](vertex_t u, edge_t j) {
+      return distances[u] + (weights != nullptr ? weights[j] : weight_t{1.0}) ==
+             distances[indices[j]];
+    };
+
+    sigmas[s] = 1.0;
+    for (auto u : visited) {
+      for (auto j = offsets[u]; j < offsets[u + 1]; ++j) {
+        if (is_dag_edge(u, j)) { sigmas[indices[j]] += sigmas[u]; }
+      }
+    }
+
+    for (auto it = visited.rbegin(); it != visited.rend(); ++it) {
+      auto u = *it;
+      for (auto j = offsets[u]; j < offsets[u + 1]; ++j) {
+        auto w = indices[j];
+        if (is_dag_edge(u, j)) {
+          auto dependency = sigmas[u] / sigmas[w] * (1.0 + deltas[w]);
+          deltas[u] += dependency;
+          edge_centralities[j] += static_cast<result_t>(dependency);
+        }
+      }
+      if (u != s) {
+        vertex_centralities[u] += static_cast<result_t>(deltas[u] + (endpoints ? 1.0 : 0.0));
+      } else if (endpoints) {
+        vertex_centralities[u] += static_cast<result_t>(deltas[u]);
+      }
+    }
+  }
+}
+
+// same as the single-GPU betweenness_centrality (normalized) rescaling
+template <typename result_t>
+void rescale_reference(std::vector<result_t>& vertex_centralities,
+                       std::vector<result_t>& edge_centralities,
+                       size_t num_vertices,
+                       size_t num_sources,
+                       bool endpoints)
+{
+  auto n = static_cast<result_t>(num_vertices);
+  if (num_vertices > 2) {
+    auto factor = (endpoints ? n * (n - 1) : (n - 1) * (n - 2)) / (n / num_sources);
+    for (auto& c : vertex_centralities) { c /= factor; }
+  }
+  if (num_vertices > 1) {
+    for (auto& c : edge_centralities) { c /= n * (n - 1); }
+  }
+}
+
+typedef struct BetweennessCentrality_Usecase_t {
+  std::string graph_file_full_path{};
+  size_t num_sources{0};  // 0: every vertex is a source
+  bool endpoints{false};
+  bool test_weighted{false};
+
+  BetweennessCentrality_Usecase_t(std::string const& graph_file_path,
+                                  size_t num_sources,
+                                  bool endpoints,
+                                  bool test_weighted = false)
+    : num_sources(num_sources), endpoints(endpoints), test_weighted(test_weighted)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} BetweennessCentrality_Usecase;
+
+class Tests_BetweennessCentrality
+  : public ::testing::TestWithParam<BetweennessCentrality_Usecase> {
+ public:
+  Tests_BetweennessCentrality() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(BetweennessCentrality_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, false> graph(handle);
+    std::tie(graph, std::ignore) = cugraph::test::
+      read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, false>(
+        handle, configuration.graph_file_full_path, configuration.test_weighted, false);
+    auto graph_view = graph.view();
+
+    auto num_vertices = graph_view.get_number_of_vertices();
+    auto num_edges    = graph_view.get_number_of_edges();
+
+    std::vector<edge_t> h_offsets(num_vertices + 1);
+    std::vector<vertex_t> h_indices(num_edges);
+    raft::update_host(
+      h_offsets.data(), graph_view.offsets(), num_vertices + 1, handle.get_stream());
+    raft::update_host(h_indices.data(), graph_view.indices(), num_edges, handle.get_stream());
+    std::vector<weight_t> h_weights(configuration.test_weighted ? num_edges : edge_t{0});
+    if (configuration.test_weighted) {
+      raft::update_host(h_weights.data(), graph_view.weights(), num_edges, handle.get_stream());
+    }
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    // sample every (num_vertices / num_sources)'th vertex
+    std::vector<vertex_t> h_sources(std::min(configuration.num_sources, size_t(num_vertices)));
+    for (size_t i = 0; i < h_sources.size(); ++i) {
+      h_sources[i] = static_cast<vertex_t>(i * (num_vertices / h_sources.size()));
+    }
+    rmm::device_uvector<vertex_t> d_sources(h_sources.size(), handle.get_stream());
+    raft::update_device(d_sources.data(), h_sources.data(), h_sources.size(), handle.get_stream());
+
+    std::vector<result_t> h_reference_vertex_centralities(num_vertices);
+    std::vector<result_t> h_reference_edge_centralities(num_edges);
+    betweenness_centrality_reference(h_offsets.data(),
+                                     h_indices.data(),
+                                     configuration.test_weighted ? h_weights.data()
+                                                                 : static_cast<weight_t*>(nullptr),
+                                     num_vertices,
+                                     h_sources,
+                                     configuration.endpoints,
+                                     h_reference_vertex_centralities.data(),
+                                     h_reference_edge_centralities.data());
+    rescale_reference(h_reference_vertex_centralities,
+                      h_reference_edge_centralities,
+                      num_vertices,
+                      h_sources.size() > 0 ? h_sources.size() : size_t(num_vertices),
+                      configuration.endpoints);
+
+    rmm::device_uvector<result_t> d_vertex_centralities(num_vertices, handle.get_stream());
+    rmm::device_uvector<result_t> d_edge_centralities(num_edges, handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    cugraph::experimental::betweenness_centrality(handle,
+                                                  graph_view,
+                                                  d_sources.data(),
+                                                  d_sources.size(),
+                                                  d_vertex_centralities.data(),
+                                                  true,
+                                                  configuration.endpoints,
+                                                  configuration.test_weighted);
+    cugraph::experimental::edge_betweenness_centrality(handle,
+                                                       graph_view,
+                                                       d_sources.data(),
+                                                       d_sources.size(),
+                                                       d_edge_centralities.data(),
+                                                       true,
+                                                       configuration.test_weighted);
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    std::vector<result_t> h_cugraph_vertex_centralities(num_vertices);
+    std::vector<result_t> h_cugraph_edge_centralities(num_edges);
+    raft::update_host(h_cugraph_vertex_centralities.data(),
+                      d_vertex_centralities.data(),
+                      d_vertex_centralities.size(),
+                      handle.get_stream());
+    raft::update_host(h_cugraph_edge_centralities.data(),
+                      d_edge_centralities.data(),
+                      d_edge_centralities.size(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    auto threshold_ratio = 1e-3;
+    auto threshold_magnitude =
+      1e-6;  // skip comparison for low betweenness vertices (lowly ranked vertices)
+    auto nearly_equal = [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+      return std::abs(lhs - rhs) <
+             std::max(std::max(lhs, rhs) * threshold_ratio, threshold_magnitude);
+    };
+
+    ASSERT_TRUE(std::equal(h_reference_vertex_centralities.begin(),
+                           h_reference_vertex_centralities.end(),
+                           h_cugraph_vertex_centralities.begin(),
+                           nearly_equal))
+      << "Betweenness centrality values do not match with the reference values.";
+    ASSERT_TRUE(std::equal(h_reference_edge_centralities.begin(),
+                           h_reference_edge_centralities.end(),
+                           h_cugraph_edge_centralities.begin(),
+                           nearly_equal))
+      << "Edge betweenness centrality values do not match with the reference values.";
+  }
+};
+
+TEST_P(Tests_BetweennessCentrality, CheckInt32Int32FloatFloat)
+{
+  run_current_test<int32_t, int32_t, float, float>(GetParam());
+}
+
+TEST_P(Tests_BetweennessCentrality, CheckInt64Int64DoubleDouble)
+{
+  run_current_test<int64_t, int64_t, double, double>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_BetweennessCentrality,
+  ::testing::Values(
+    BetweennessCentrality_Usecase("test/datasets/karate.mtx", 0, false),
+    BetweennessCentrality_Usecase("test/datasets/karate.mtx", 0, true),
+    BetweennessCentrality_Usecase("test/datasets/dolphins.mtx", 10, false),
+    BetweennessCentrality_Usecase("test/datasets/netscience.mtx", 100, true),
+    BetweennessCentrality_Usecase("test/datasets/karate.mtx", 0, false, true),
+    BetweennessCentrality_Usecase("test/datasets/karate.mtx", 0, true, true),
+    BetweennessCentrality_Usecase("test/datasets/netscience.mtx", 100, false, true)));
+
+// sums the (unweighted) distances from every vertex to every other vertex reached (and counts the
+// number of reaching vertices) with a BFS from every vertex
+template <typename vertex_t, typename edge_t, typename result_t>
+void closeness_centrality_reference(edge_t const* offsets,
+                                    vertex_t const* indices,
+                                    vertex_t num_vertices,
+                                    bool wf_improved,
+                                    result_t* centralities)
+{
+  auto const unreached = std::numeric_limits<vertex_t>::max();
+
+  std::vector<double> distance_sums(num_vertices, 0.0);
+  std::vector<double> reached_counts(num_vertices, 0.0);
+  std::vector<vertex_t> distances(num_vertices);
+  for (vertex_t s = 0; s < num_vertices; ++s) {
+    std::fill(distances.begin(), distances.end(), unreached);
+    std::queue<vertex_t> queue{};
+    distances[s] = vertex_t{0};
+    queue.push(s);
+    while (!queue.empty()) {
+      auto u = queue.front();
+      queue.pop();
+      for (auto j = offsets[u]; j < offsets[u + 1]; ++j) {
+        auto w = indices[j];
+        if (distances[w] == unreached) {
+          distances[w] = distances[u] + 1;
+          distance_sums[w] += static_cast<double>(distances[w]);
+          reached_counts[w] += 1.0;
+          queue.push(w);
+        }
+      }
+    }
+  }
+
+  for (vertex_t v = 0; v < num_vertices; ++v) {
+    centralities[v] = result_t{0.0};
+    if (distance_sums[v] > 0.0) {
+      auto closeness = reached_counts[v] / distance_sums[v];
+      if (wf_improved) { closeness *= reached_counts[v] / static_cast<double>(num_vertices - 1); }
+      centralities[v] = static_cast<result_t>(closeness);
+    }
+  }
+}
+
+typedef struct ApproximateCentrality_Usecase_t {
+  std::string graph_file_full_path{};
+  double epsilon{0.0};
+  double delta{0.0};
+
+  ApproximateCentrality_Usecase_t(std::string const& graph_file_path, double epsilon, double delta)
+    : epsilon(epsilon), delta(delta)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} ApproximateCentrality_Usecase;
+
+class Tests_ApproximateCentrality
+  : public ::testing::TestWithParam<ApproximateCentrality_Usecase> {
+ public:
+  Tests_ApproximateCentrality() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(ApproximateCentrality_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, false> graph(handle);
+    std::tie(graph, std::ignore) = cugraph::test::
+      read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, false>(
+        handle, configuration.graph_file_full_path, false, false);
+    auto graph_view = graph.view();
+
+    auto num_vertices = graph_view.get_number_of_vertices();
+    auto num_edges    = graph_view.get_number_of_edges();
+
+    std::vector<edge_t> h_offsets(num_vertices + 1);
+    std::vector<vertex_t> h_indices(num_edges);
+    raft::update_host(
+      h_offsets.data(), graph_view.offsets(), num_vertices + 1, handle.get_stream());
+    raft::update_host(h_indices.data(), graph_view.indices(), num_edges, handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    std::vector<result_t> h_reference_betweenness(num_vertices);
+    std::vector<result_t> h_reference_edge_betweenness(num_edges);
+    betweenness_centrality_reference(h_offsets.data(),
+                                     h_indices.data(),
+                                     static_cast<weight_t*>(nullptr),
+                                     num_vertices,
+                                     std::vector<vertex_t>{},
+                                     false,
+                                     h_reference_betweenness.data(),
+                                     h_reference_edge_betweenness.data());
+    rescale_reference(h_reference_betweenness,
+                      h_reference_edge_betweenness,
+                      num_vertices,
+                      size_t(num_vertices),
+                      false);
+
+    std::vector<result_t> h_reference_closeness(num_vertices);
+    closeness_centrality_reference(
+      h_offsets.data(), h_indices.data(), num_vertices, true, h_reference_closeness.data());
+
+    rmm::device_uvector<result_t> d_betweenness(num_vertices, handle.get_stream());
+    rmm::device_uvector<result_t> d_closeness(num_vertices, handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    auto num_betweenness_sources =
+      cugraph::experimental::approximate_betweenness_centrality(handle,
+                                                                graph_view,
+                                                                d_betweenness.data(),
+                                                                configuration.epsilon,
+                                                                configuration.delta,
+                                                                uint64_t{0});
+    cugraph::experimental::closeness_centrality(
+      handle, graph_view, static_cast<vertex_t const*>(nullptr), size_t{0}, d_closeness.data());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    ASSERT_TRUE((num_betweenness_sources > 0) &&
+                (num_betweenness_sources <= static_cast<size_t>(num_vertices)))
+      << "The number of sampled sources is out of range.";
+
+    std::vector<result_t> h_cugraph_betweenness(num_vertices);
+    std::vector<result_t> h_cugraph_closeness(num_vertices);
+    raft::update_host(h_cugraph_betweenness.data(),
+                      d_betweenness.data(),
+                      d_betweenness.size(),
+                      handle.get_stream());
+    raft::update_host(
+      h_cugraph_closeness.data(), d_closeness.data(), d_closeness.size(), handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    // the sampling is deterministic for a fixed seed, so the (probabilistic) error bound either
+    // holds or fails consistently
+    auto epsilon = configuration.epsilon;
+    ASSERT_TRUE(std::equal(h_reference_betweenness.begin(),
+                           h_reference_betweenness.end(),
+                           h_cugraph_betweenness.begin(),
+                           [epsilon](auto lhs, auto rhs) {
+                             return std::abs(lhs - rhs) <= epsilon;
+                           }))
+      << "Approximate betweenness centrality values exceed the error bound.";
+
+    auto threshold_ratio = 1e-3;
+    ASSERT_TRUE(std::equal(h_reference_closeness.begin(),
+                           h_reference_closeness.end(),
+                           h_cugraph_closeness.begin(),
+                           [threshold_ratio](auto lhs, auto rhs) {
+                             return std::abs(lhs - rhs) <= std::max(lhs, rhs) * threshold_ratio;
+                           }))
+      << "Closeness centrality values do not match with the reference values.";
+  }
+};
+
+TEST_P(Tests_ApproximateCentrality, CheckInt32Int32FloatFloat)
+{
+  run_current_test<int32_t, int32_t, float, float>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_ApproximateCentrality,
+  ::testing::Values(ApproximateCentrality_Usecase("test/datasets/karate.mtx", 0.05, 0.1),
+                    ApproximateCentrality_Usecase("test/datasets/netscience.mtx", 0.1, 0.1),
+                    ApproximateCentrality_Usecase("test/datasets/netscience.mtx", 0.2, 0.1)));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
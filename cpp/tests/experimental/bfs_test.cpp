@@ -84,10 +84,16 @@ typedef struct BFS_Usecase_t {
   cugraph::test::input_graph_specifier_t input_graph_specifier{};
 
   size_t source{0};
+  bool direction_optimizing{false};
   bool check_correctness{false};
 
-  BFS_Usecase_t(std::string const& graph_file_path, size_t source, bool check_correctness = true)
-    : source(source), check_correctness(check_correctness)
+  BFS_Usecase_t(std::string const& graph_file_path,
+                size_t source,
+                bool direction_optimizing = false,
+                bool check_correctness    = true)
+    : source(source),
+      direction_optimizing(direction_optimizing),
+      check_correctness(check_correctness)
   {
     std::string graph_file_full_path{};
     if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
@@ -101,8 +107,11 @@ typedef struct BFS_Usecase_t {
 
   BFS_Usecase_t(cugraph::test::rmat_params_t rmat_params,
                 size_t source,
-                bool check_correctness = true)
-    : source(source), check_correctness(check_correctness)
+                bool direction_optimizing = false,
+                bool check_correctness    = true)
+    : source(source),
+      direction_optimizing(direction_optimizing),
+      check_correctness(check_correctness)
   {
     input_graph_specifier.tag         = cugraph::test::input_graph_specifier_t::RMAT_PARAMS;
     input_graph_specifier.rmat_params = rmat_params;
@@ -176,7 +185,7 @@ class Tests_BFS : public ::testing::TestWithParam<BFS_Usecase> {
                                d_distances.data(),
                                d_predecessors.data(),
                                static_cast<vertex_t>(configuration.source),
-                               false,
+                               configuration.direction_optimizing,
                                std::numeric_limits<vertex_t>::max());
 
     CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
@@ -307,9 +316,17 @@ INSTANTIATE_TEST_CASE_P(
     BFS_Usecase("test/datasets/wiki2003.mtx", 1000),
     BFS_Usecase("test/datasets/wiki-Talk.mtx", 1000),
     BFS_Usecase(cugraph::test::rmat_params_t{10, 16, 0.57, 0.19, 0.19, 0, false, false}, 0),
+    // direction optimizing BFS (requires symmetric input graphs)
+    BFS_Usecase("test/datasets/karate.mtx", 0, true),
+    BFS_Usecase("test/datasets/polbooks.mtx", 0, true),
+    BFS_Usecase("test/datasets/netscience.mtx", 100, true),
+    BFS_Usecase(cugraph::test::rmat_params_t{10, 16, 0.57, 0.19, 0.19, 0, true, false}, 0, true),
     // disable correctness checks for large graphs
     BFS_Usecase(cugraph::test::rmat_params_t{20, 32, 0.57, 0.19, 0.19, 0, false, false},
                 0,
-                false)));
+                false,
+                false),
+    BFS_Usecase(
+      cugraph::test::rmat_params_t{20, 32, 0.57, 0.19, 0.19, 0, true, false}, 0, true, false)));
 
 CUGRAPH_TEST_PROGRAM_MAIN()
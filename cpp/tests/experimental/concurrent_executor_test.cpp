@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+#include <utilities/concurrent_executor.hpp>
+#include <utilities/error.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <typename T>
+std::vector<T> to_host(raft::handle_t const& handle, rmm::device_uvector<T> const& d_values)
+{
+  std::vector<T> h_values(d_values.size());
+  raft::update_host(h_values.data(), d_values.data(), d_values.size(), handle.get_stream());
+  handle.get_stream_view().synchronize();
+  return h_values;
+}
+
+}  // namespace
+
+class Tests_ConcurrentExecutor : public ::testing::Test {
+ public:
+  Tests_ConcurrentExecutor() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+// BFS from multiple sources and WCC running concurrently on the same graph (and racing to compute
+// the cached graph properties) should match the serial results
+TEST_F(Tests_ConcurrentExecutor, BFSAndWCC)
+{
+  using vertex_t = int32_t;
+  using edge_t   = int32_t;
+  using weight_t = float;
+
+  raft::handle_t handle{};
+
+  cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, false> graph(handle);
+  std::tie(graph, std::ignore) = cugraph::test::
+    read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, false>(
+      handle, cugraph::test::get_rapids_dataset_root_dir() + "/karate.mtx", false, false);
+  auto graph_view = graph.view();
+
+  auto const num_vertices = graph_view.get_number_of_vertices();
+  std::vector<vertex_t> sources{0, 1, 2, 5, 8, 13, 21, 33};
+
+  auto run_bfs = [&graph_view, num_vertices](raft::handle_t const& call_handle, vertex_t source) {
+    rmm::device_uvector<vertex_t> d_distances(num_vertices, call_handle.get_stream());
+    rmm::device_uvector<vertex_t> d_predecessors(num_vertices, call_handle.get_stream());
+    cugraph::experimental::bfs(call_handle,
+                               graph_view,
+                               d_distances.data(),
+                               d_predecessors.data(),
+                               source,
+                               true,
+                               std::numeric_limits<vertex_t>::max());
+    return to_host(call_handle, d_distances);
+  };
+  auto run_wcc = [&graph_view, num_vertices](raft::handle_t const& call_handle) {
+    rmm::device_uvector<vertex_t> d_components(num_vertices, call_handle.get_stream());
+    cugraph::experimental::weakly_connected_components(
+      call_handle, graph_view, d_components.data());
+    return to_host(call_handle, d_components);
+  };
+
+  std::vector<std::vector<vertex_t>> concurrent_distances{};
+  std::vector<vertex_t> concurrent_components{};
+  {
+    cugraph::experimental::concurrent_executor_t executor(handle, 4);
+
+    std::vector<std::future<std::vector<vertex_t>>> bfs_futures{};
+    for (auto source : sources) {
+      bfs_futures.push_back(executor.submit(
+        [&run_bfs, source](raft::handle_t const& call_handle) {
+          return run_bfs(call_handle, source);
+        }));
+    }
+    auto wcc_future = executor.submit(run_wcc);
+
+    for (auto& future : bfs_futures) {
+      concurrent_distances.push_back(future.get());
+    }
+    concurrent_components = wcc_future.get();
+  }
+
+  for (size_t i = 0; i < sources.size(); ++i) {
+    ASSERT_EQ(concurrent_distances[i], run_bfs(handle, sources[i]))
+      << "Concurrent BFS distances (source = " << sources[i]
+      << ") do not match with the serial values.";
+  }
+  ASSERT_EQ(concurrent_components, run_wcc(handle))
+    << "Concurrent WCC components do not match with the serial values.";
+}
+
+TEST_F(Tests_ConcurrentExecutor, PageRank)
+{
+  using vertex_t = int32_t;
+  using edge_t   = int32_t;
+  using weight_t = float;
+  using result_t = float;
+
+  raft::handle_t handle{};
+
+  cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, true, false> graph(handle);
+  std::tie(graph, std::ignore) =
+    cugraph::test::read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, true, false>(
+      handle, cugraph::test::get_rapids_dataset_root_dir() + "/karate.mtx", true, false);
+  auto graph_view = graph.view();
+
+  auto run_pagerank = [&graph_view](raft::handle_t const& call_handle, result_t alpha) {
+    rmm::device_uvector<result_t> d_pageranks(graph_view.get_number_of_vertices(),
+                                              call_handle.get_stream());
+    cugraph::experimental::pagerank(call_handle,
+                                    graph_view,
+                                    static_cast<weight_t const*>(nullptr),
+                                    static_cast<vertex_t const*>(nullptr),
+                                    static_cast<result_t const*>(nullptr),
+                                    vertex_t{0},
+                                    d_pageranks.data(),
+                                    alpha,
+                                    result_t{1e-6},
+                                    std::numeric_limits<size_t>::max(),
+                                    false,
+                                    false);
+    return to_host(call_handle, d_pageranks);
+  };
+
+  std::vector<result_t> alphas{0.5, 0.75, 0.85, 0.9};
+  std::vector<std::vector<result_t>> concurrent_pageranks{};
+  {
+    cugraph::experimental::concurrent_executor_t executor(handle, alphas.size());
+
+    std::vector<std::future<std::vector<result_t>>> futures{};
+    for (auto alpha : alphas) {
+      futures.push_back(
+        executor.submit([&run_pagerank, alpha](raft::handle_t const& call_handle) {
+          return run_pagerank(call_handle, alpha);
+        }));
+    }
+    for (auto& future : futures) {
+      concurrent_pageranks.push_back(future.get());
+    }
+  }
+
+  auto threshold_ratio     = 1e-3;
+  auto threshold_magnitude = 1e-6;
+  for (size_t i = 0; i < alphas.size(); ++i) {
+    auto serial_pageranks = run_pagerank(handle, alphas[i]);
+    ASSERT_EQ(concurrent_pageranks[i].size(), serial_pageranks.size());
+    for (size_t j = 0; j < serial_pageranks.size(); ++j) {
+      ASSERT_TRUE(std::abs(concurrent_pageranks[i][j] - serial_pageranks[j]) <=
+                  std::max(std::abs(serial_pageranks[j]) * threshold_ratio, threshold_magnitude))
+        << "Concurrent PageRank values (alpha = " << alphas[i]
+        << ") do not match with the serial values.";
+    }
+  }
+}
+
+TEST_F(Tests_ConcurrentExecutor, ExceptionPropagation)
+{
+  raft::handle_t handle{};
+
+  cugraph::experimental::concurrent_executor_t executor(handle, 2);
+
+  auto future = executor.submit(
+    [](raft::handle_t const&) -> int { CUGRAPH_FAIL("failure in a submitted call."); });
+  ASSERT_THROW(future.get(), cugraph::logic_error);
+
+  // the failed call should not leave the executor waiting
+  executor.wait();
+  ASSERT_EQ(executor.submit([](raft::handle_t const&) { return 1; }).get(), 1);
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+// sequential bucket-based peeling (Batagelj & Zaversnik)
+template <typename vertex_t, typename edge_t>
+void core_number_reference(edge_t const* offsets,
+                           vertex_t const* indices,
+                           vertex_t num_vertices,
+                           edge_t* core_numbers)
+{
+  std::vector<edge_t> degrees(num_vertices);
+  edge_t max_degree{0};
+  for (vertex_t v = 0; v < num_vertices; ++v) {
+    degrees[v] = offsets[v + 1] - offsets[v];
+    max_degree = std::max(max_degree, degrees[v]);
+  }
+
+  std::vector<std::vector<vertex_t>> buckets(max_degree + 1);
+  for (vertex_t v = 0; v < num_vertices; ++v) { buckets[degrees[v]].push_back(v); }
+
+  std::vector<bool> peeled(num_vertices, false);
+  for (edge_t k = 0; k <= max_degree; ++k) {
+    while (!buckets[k].empty()) {
+      auto u = buckets[k].back();
+      buckets[k].pop_back();
+      if (peeled[u] || (degrees[u] != k)) { continue; }  // stale entry
+      peeled[u]       = true;
+      core_numbers[u] = k;
+      for (auto i = offsets[u]; i < offsets[u + 1]; ++i) {
+        auto v = indices[i];
+        if (!peeled[v] && (degrees[v] > k)) { buckets[--degrees[v]].push_back(v); }
+      }
+    }
+  }
+}
+
+typedef struct CoreNumber_Usecase_t {
+  std::string graph_file_full_path{};
+
+  CoreNumber_Usecase_t(std::string const& graph_file_path)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} CoreNumber_Usecase;
+
+class Tests_CoreNumber : public ::testing::TestWithParam<CoreNumber_Usecase> {
+ public:
+  Tests_CoreNumber() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(CoreNumber_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, false> graph(handle);
+    std::tie(graph, std::ignore) = cugraph::test::
+      read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, false>(
+        handle, configuration.graph_file_full_path, false, false);
+    auto graph_view = graph.view();
+
+    std::vector<edge_t> h_offsets(graph_view.get_number_of_vertices() + 1);
+    std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+    raft::update_host(h_offsets.data(),
+                      graph_view.offsets(),
+                      graph_view.get_number_of_vertices() + 1,
+                      handle.get_stream());
+    raft::update_host(h_indices.data(),
+                      graph_view.indices(),
+                      graph_view.get_number_of_edges(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    std::vector<edge_t> h_reference_core_numbers(graph_view.get_number_of_vertices());
+    core_number_reference(h_offsets.data(),
+                          h_indices.data(),
+                          graph_view.get_number_of_vertices(),
+                          h_reference_core_numbers.data());
+
+    rmm::device_uvector<edge_t> d_core_numbers(graph_view.get_number_of_vertices(),
+                                               handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    cugraph::experimental::core_number(handle, graph_view, d_core_numbers.data());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    std::vector<edge_t> h_cugraph_core_numbers(graph_view.get_number_of_vertices());
+    raft::update_host(h_cugraph_core_numbers.data(),
+                      d_core_numbers.data(),
+                      d_core_numbers.size(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    ASSERT_TRUE(std::equal(h_reference_core_numbers.begin(),
+                           h_reference_core_numbers.end(),
+                           h_cugraph_core_numbers.begin()))
+      << "Core numbers do not match with the reference values.";
+
+    // the k-core for the largest k with at least one vertex (the main core)
+
+    auto k = *std::max_element(h_reference_core_numbers.begin(), h_reference_core_numbers.end());
+
+    std::vector<vertex_t> h_reference_k_core_srcs{};
+    std::vector<vertex_t> h_reference_k_core_dsts{};
+    for (vertex_t u = 0; u < graph_view.get_number_of_vertices(); ++u) {
+      if (h_reference_core_numbers[u] < k) { continue; }
+      for (auto i = h_offsets[u]; i < h_offsets[u + 1]; ++i) {
+        if (h_reference_core_numbers[h_indices[i]] >= k) {
+          h_reference_k_core_srcs.push_back(u);
+          h_reference_k_core_dsts.push_back(h_indices[i]);
+        }
+      }
+    }
+
+    rmm::device_uvector<vertex_t> d_k_core_srcs(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_k_core_dsts(0, handle.get_stream());
+    std::tie(d_k_core_srcs, d_k_core_dsts, std::ignore) =
+      cugraph::experimental::k_core(handle, graph_view, k, d_core_numbers.data());
+
+    ASSERT_EQ(d_k_core_srcs.size(), h_reference_k_core_srcs.size())
+      << "The k-core edge count does not match with the reference value.";
+
+    std::vector<vertex_t> h_cugraph_k_core_srcs(d_k_core_srcs.size());
+    std::vector<vertex_t> h_cugraph_k_core_dsts(d_k_core_dsts.size());
+    raft::update_host(h_cugraph_k_core_srcs.data(),
+                      d_k_core_srcs.data(),
+                      d_k_core_srcs.size(),
+                      handle.get_stream());
+    raft::update_host(h_cugraph_k_core_dsts.data(),
+                      d_k_core_dsts.data(),
+                      d_k_core_dsts.size(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    // both edge lists are in the CSR order (remove_if is stable)
+    ASSERT_TRUE(std::equal(h_reference_k_core_srcs.begin(),
+                           h_reference_k_core_srcs.end(),
+                           h_cugraph_k_core_srcs.begin()) &&
+                std::equal(h_reference_k_core_dsts.begin(),
+                           h_reference_k_core_dsts.end(),
+                           h_cugraph_k_core_dsts.begin()))
+      << "K-core edges do not match with the reference values.";
+  }
+};
+
+TEST_P(Tests_CoreNumber, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam());
+}
+
+TEST_P(Tests_CoreNumber, CheckInt64Int64Float)
+{
+  run_current_test<int64_t, int64_t, float>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(simple_test,
+                        Tests_CoreNumber,
+                        ::testing::Values(CoreNumber_Usecase("test/datasets/karate.mtx"),
+                                          CoreNumber_Usecase("test/datasets/dolphins.mtx"),
+                                          CoreNumber_Usecase("test/datasets/netscience.mtx")));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -142,6 +142,52 @@ class Tests_Degree : public ::testing::TestWithParam<Degree_Usecase> {
                            h_reference_out_degrees.end(),
                            h_cugraph_out_degrees.begin()))
       << "Out-degree values do not match with the reference values.";
+
+    // cached degrees (shared by the views of the same graph)
+
+    auto d_cached_in_degrees  = graph_view.get_in_degrees(handle);
+    auto d_cached_out_degrees = graph_view.get_out_degrees(handle);
+    ASSERT_EQ(graph.view().get_in_degrees(handle), d_cached_in_degrees)
+      << "Views of the same graph should share the cached in-degrees.";
+    ASSERT_EQ(graph_view.get_out_degrees(handle), d_cached_out_degrees)
+      << "Repeated calls should return the cached out-degrees.";
+
+    raft::update_host(h_cugraph_in_degrees.data(),
+                      d_cached_in_degrees,
+                      h_cugraph_in_degrees.size(),
+                      handle.get_stream());
+    raft::update_host(h_cugraph_out_degrees.data(),
+                      d_cached_out_degrees,
+                      h_cugraph_out_degrees.size(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    ASSERT_TRUE(std::equal(
+      h_reference_in_degrees.begin(), h_reference_in_degrees.end(), h_cugraph_in_degrees.begin()))
+      << "Cached in-degree values do not match with the reference values.";
+    ASSERT_TRUE(std::equal(h_reference_out_degrees.begin(),
+                           h_reference_out_degrees.end(),
+                           h_cugraph_out_degrees.begin()))
+      << "Cached out-degree values do not match with the reference values.";
+    ASSERT_EQ(graph_view.get_max_in_degree(handle),
+              *std::max_element(h_reference_in_degrees.begin(), h_reference_in_degrees.end()))
+      << "Cached max in-degree does not match with the reference value.";
+
+    // the transposed storage copy stores the same graph
+
+    auto transposed_graph_view = graph_view.get_transposed_storage_view(handle);
+    ASSERT_EQ(transposed_graph_view.get_number_of_edges(), graph_view.get_number_of_edges());
+
+    auto d_transposed_in_degrees = transposed_graph_view.compute_in_degrees(handle);
+    raft::update_host(h_cugraph_in_degrees.data(),
+                      d_transposed_in_degrees.data(),
+                      d_transposed_in_degrees.size(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    ASSERT_TRUE(std::equal(
+      h_reference_in_degrees.begin(), h_reference_in_degrees.end(), h_cugraph_in_degrees.begin()))
+      << "In-degree values of the transposed storage copy do not match with the reference values.";
   }
 };
 
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <experimental/dynamic_graph.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+typedef struct DynamicGraph_Usecase_t {
+  std::string graph_file_full_path{};
+
+  DynamicGraph_Usecase_t(std::string const& graph_file_path)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} DynamicGraph_Usecase;
+
+class Tests_DynamicGraph : public ::testing::TestWithParam<DynamicGraph_Usecase> {
+ public:
+  Tests_DynamicGraph() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  std::vector<edge_t> get_out_degrees(
+    raft::handle_t const& handle,
+    cugraph::experimental::graph_view_t<vertex_t, edge_t, float, false, false> const& graph_view)
+  {
+    auto d_degrees = graph_view.compute_out_degrees(handle);
+    std::vector<edge_t> h_degrees(d_degrees.size());
+    raft::update_host(h_degrees.data(), d_degrees.data(), d_degrees.size(), handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+    return h_degrees;
+  }
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(DynamicGraph_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, float, false, false> graph(handle);
+    std::tie(graph, std::ignore) =
+      cugraph::test::read_graph_from_matrix_market_file<vertex_t, edge_t, float, false, false>(
+        handle, configuration.graph_file_full_path, true, false);
+    auto graph_view         = graph.view();
+    auto number_of_vertices = graph_view.get_number_of_vertices();
+    auto number_of_edges    = graph_view.get_number_of_edges();
+
+    std::vector<edge_t> h_offsets(number_of_vertices + 1);
+    std::vector<vertex_t> h_indices(number_of_edges);
+    raft::update_host(
+      h_offsets.data(), graph_view.offsets(), number_of_vertices + 1, handle.get_stream());
+    raft::update_host(h_indices.data(), graph_view.indices(), number_of_edges, handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    std::vector<edge_t> h_reference_degrees(number_of_vertices);
+    for (vertex_t i = 0; i < number_of_vertices; ++i) {
+      h_reference_degrees[i] = h_offsets[i + 1] - h_offsets[i];
+    }
+
+    // delete every other out-edge of the first vertex with a non-zero out-degree and insert edges
+    // from the vertex to every vertex
+
+    auto v = static_cast<vertex_t>(std::distance(
+      h_reference_degrees.begin(),
+      std::find_if(h_reference_degrees.begin(), h_reference_degrees.end(), [](auto d) {
+        return d > 0;
+      })));
+    ASSERT_TRUE(v < number_of_vertices);
+
+    std::vector<vertex_t> h_delete_srcs{};
+    std::vector<vertex_t> h_delete_dsts{};
+    for (auto j = h_offsets[v]; j < h_offsets[v + 1]; j += 2) {
+      h_delete_srcs.push_back(v);
+      h_delete_dsts.push_back(h_indices[j]);
+    }
+    std::vector<vertex_t> h_insert_srcs(number_of_vertices, v);
+    std::vector<vertex_t> h_insert_dsts(number_of_vertices);
+    std::iota(h_insert_dsts.begin(), h_insert_dsts.end(), vertex_t{0});
+    std::vector<float> h_insert_weights(number_of_vertices, float{1.0});
+
+    rmm::device_uvector<vertex_t> d_delete_srcs(h_delete_srcs.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_delete_dsts(h_delete_dsts.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_insert_srcs(h_insert_srcs.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_insert_dsts(h_insert_dsts.size(), handle.get_stream());
+    rmm::device_uvector<float> d_insert_weights(h_insert_weights.size(), handle.get_stream());
+    raft::update_device(
+      d_delete_srcs.data(), h_delete_srcs.data(), h_delete_srcs.size(), handle.get_stream());
+    raft::update_device(
+      d_delete_dsts.data(), h_delete_dsts.data(), h_delete_dsts.size(), handle.get_stream());
+    raft::update_device(
+      d_insert_srcs.data(), h_insert_srcs.data(), h_insert_srcs.size(), handle.get_stream());
+    raft::update_device(
+      d_insert_dsts.data(), h_insert_dsts.data(), h_insert_dsts.size(), handle.get_stream());
+    raft::update_device(d_insert_weights.data(),
+                        h_insert_weights.data(),
+                        h_insert_weights.size(),
+                        handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    cugraph::experimental::dynamic_graph_t<vertex_t, edge_t, float, false, false> dynamic_graph(
+      handle, std::move(graph), 1.0 /* compact only if there are pending insertions */);
+
+    dynamic_graph.delete_edges(cugraph::experimental::edgelist_t<vertex_t, edge_t, float>{
+                                 d_delete_srcs.data(),
+                                 d_delete_dsts.data(),
+                                 nullptr,
+                                 static_cast<edge_t>(d_delete_srcs.size())},
+                               true);
+    ASSERT_EQ(dynamic_graph.get_number_of_local_deleted_edges(),
+              static_cast<edge_t>(h_delete_srcs.size()));
+
+    // deletions are visible without compaction
+
+    h_reference_degrees[v] -= static_cast<edge_t>(h_delete_srcs.size());
+    auto h_cugraph_degrees = get_out_degrees(handle, dynamic_graph.snapshot(true));
+    ASSERT_TRUE(std::equal(
+      h_reference_degrees.begin(), h_reference_degrees.end(), h_cugraph_degrees.begin()))
+      << "Out-degrees after deletions do not match with the reference values.";
+
+    // insertions are visible after compaction
+
+    dynamic_graph.insert_edges(cugraph::experimental::edgelist_t<vertex_t, edge_t, float>{
+                                 d_insert_srcs.data(),
+                                 d_insert_dsts.data(),
+                                 d_insert_weights.data(),
+                                 static_cast<edge_t>(d_insert_srcs.size())},
+                               false);
+    ASSERT_EQ(dynamic_graph.get_number_of_local_pending_insertions(),
+              static_cast<edge_t>(number_of_vertices));
+
+    h_reference_degrees[v] += static_cast<edge_t>(number_of_vertices);
+    // the inserted edges break symmetry (and add multi-edges), skip the expensive checks on the
+    // graph properties
+    auto snapshot_view = dynamic_graph.snapshot(false);
+    ASSERT_FALSE(snapshot_view.has_edge_mask());
+    ASSERT_EQ(dynamic_graph.get_number_of_local_pending_insertions(), edge_t{0});
+    ASSERT_EQ(snapshot_view.get_number_of_edges(),
+              number_of_edges - static_cast<edge_t>(h_delete_srcs.size()) +
+                static_cast<edge_t>(number_of_vertices));
+    h_cugraph_degrees = get_out_degrees(handle, snapshot_view);
+    ASSERT_TRUE(std::equal(
+      h_reference_degrees.begin(), h_reference_degrees.end(), h_cugraph_degrees.begin()))
+      << "Out-degrees after insertions do not match with the reference values.";
+  }
+};
+
+// FIXME: add tests for type combinations
+
+TEST_P(Tests_DynamicGraph, CheckInt32Int32) { run_current_test<int32_t, int32_t>(GetParam()); }
+
+INSTANTIATE_TEST_CASE_P(simple_test,
+                        Tests_DynamicGraph,
+                        ::testing::Values(DynamicGraph_Usecase("test/datasets/karate.mtx"),
+                                          DynamicGraph_Usecase("test/datasets/web-Google.mtx")));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
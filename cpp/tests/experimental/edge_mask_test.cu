@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <experimental/edge_mask.cuh>
+#include <experimental/edge_property.cuh>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+#include <patterns/count_if_e.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/sequence.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+typedef struct EdgeMask_Usecase_t {
+  std::string graph_file_full_path{};
+
+  EdgeMask_Usecase_t(std::string const& graph_file_path)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} EdgeMask_Usecase;
+
+class Tests_EdgeMask : public ::testing::TestWithParam<EdgeMask_Usecase> {
+ public:
+  Tests_EdgeMask() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(EdgeMask_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, store_transposed, false> graph(
+      handle);
+    std::tie(graph, std::ignore) = cugraph::test::
+      read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle, configuration.graph_file_full_path, false, false);
+    auto graph_view = graph.view();
+
+    std::vector<edge_t> h_offsets(graph_view.get_number_of_vertices() + 1);
+    std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+    raft::update_host(h_offsets.data(),
+                      graph_view.offsets(),
+                      graph_view.get_number_of_vertices() + 1,
+                      handle.get_stream());
+    raft::update_host(h_indices.data(),
+                      graph_view.indices(),
+                      graph_view.get_number_of_edges(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    // the property value of an edge is its position in the compressed sparse storage, keep the
+    // edges with even positions
+
+    auto num_edges = graph_view.get_number_of_edges();
+    cugraph::experimental::edge_property_t<decltype(graph_view), int32_t> edge_property(
+      handle, graph_view);
+    thrust::sequence(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
+                     edge_property.mutable_value_first(0),
+                     edge_property.mutable_value_first(0) + num_edges,
+                     int32_t{0});
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    cugraph::experimental::edge_mask_t<decltype(graph_view)> edge_mask(handle, graph_view);
+    cugraph::experimental::mask_edges_by_edge_property(
+      handle,
+      graph_view,
+      edge_property.view(),
+      [] __device__(auto edge_value) { return edge_value % 2 == 0; },
+      edge_mask);
+    auto masked_graph_view = graph_view.with_edge_mask(edge_mask.get_masks());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    std::vector<edge_t> h_reference_in_degrees(graph_view.get_number_of_vertices(), edge_t{0});
+    std::vector<edge_t> h_reference_out_degrees(graph_view.get_number_of_vertices(), edge_t{0});
+    edge_t reference_count{0};
+    for (vertex_t i = 0; i < graph_view.get_number_of_vertices(); ++i) {
+      for (auto j = h_offsets[i]; j < h_offsets[i + 1]; ++j) {
+        if (j % 2 == 0) {
+          auto src = store_transposed ? h_indices[j] : i;
+          auto dst = store_transposed ? i : h_indices[j];
+          ++h_reference_out_degrees[src];
+          ++h_reference_in_degrees[dst];
+          ++reference_count;
+        }
+      }
+    }
+
+    ASSERT_TRUE(masked_graph_view.has_edge_mask());
+    ASSERT_EQ(cugraph::experimental::count_local_active_edges(handle, graph_view, edge_mask),
+              reference_count)
+      << "count_local_active_edges returned a wrong count.";
+
+    auto count = cugraph::experimental::count_if_e(
+      handle,
+      masked_graph_view,
+      thrust::make_constant_iterator(0) /* dummy */,
+      thrust::make_constant_iterator(0) /* dummy */,
+      [] __device__(auto, auto, auto, auto, auto) { return true; });
+    ASSERT_EQ(count, reference_count) << "count_if_e should skip masked out edges.";
+
+    auto d_in_degrees  = masked_graph_view.compute_in_degrees(handle);
+    auto d_out_degrees = masked_graph_view.compute_out_degrees(handle);
+    std::vector<edge_t> h_cugraph_in_degrees(d_in_degrees.size());
+    std::vector<edge_t> h_cugraph_out_degrees(d_out_degrees.size());
+    raft::update_host(
+      h_cugraph_in_degrees.data(), d_in_degrees.data(), d_in_degrees.size(), handle.get_stream());
+    raft::update_host(h_cugraph_out_degrees.data(),
+                      d_out_degrees.data(),
+                      d_out_degrees.size(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    ASSERT_TRUE(std::equal(h_reference_in_degrees.begin(),
+                           h_reference_in_degrees.end(),
+                           h_cugraph_in_degrees.begin()))
+      << "In-degrees of the masked graph do not match with the reference values.";
+    ASSERT_TRUE(std::equal(h_reference_out_degrees.begin(),
+                           h_reference_out_degrees.end(),
+                           h_cugraph_out_degrees.begin()))
+      << "Out-degrees of the masked graph do not match with the reference values.";
+  }
+};
+
+// FIXME: add tests for type combinations
+
+TEST_P(Tests_EdgeMask, CheckInt32Int32FloatTransposed)
+{
+  run_current_test<int32_t, int32_t, float, true>(GetParam());
+}
+
+TEST_P(Tests_EdgeMask, CheckInt32Int32FloatUntransposed)
+{
+  run_current_test<int32_t, int32_t, float, false>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(simple_test,
+                        Tests_EdgeMask,
+                        ::testing::Values(EdgeMask_Usecase("test/datasets/karate.mtx"),
+                                          EdgeMask_Usecase("test/datasets/web-Google.mtx")));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
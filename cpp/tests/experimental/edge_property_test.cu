@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <experimental/edge_property.cuh>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+#include <patterns/count_if_e.cuh>
+#include <patterns/transform_reduce_e.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/iterator/constant_iterator.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+typedef struct EdgeProperty_Usecase_t {
+  std::string graph_file_full_path{};
+
+  EdgeProperty_Usecase_t(std::string const& graph_file_path)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} EdgeProperty_Usecase;
+
+class Tests_EdgeProperty : public ::testing::TestWithParam<EdgeProperty_Usecase> {
+ public:
+  Tests_EdgeProperty() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(EdgeProperty_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, store_transposed, false> graph(
+      handle);
+    std::tie(graph, std::ignore) = cugraph::test::
+      read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle, configuration.graph_file_full_path, false, false);
+    auto graph_view = graph.view();
+
+    std::vector<edge_t> h_offsets(graph_view.get_number_of_vertices() + 1);
+    std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+    raft::update_host(h_offsets.data(),
+                      graph_view.offsets(),
+                      graph_view.get_number_of_vertices() + 1,
+                      handle.get_stream());
+    raft::update_host(h_indices.data(),
+                      graph_view.indices(),
+                      graph_view.get_number_of_edges(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    // an edge list in the reverse storage order, the property value of an edge is its position in
+    // the compressed sparse storage
+
+    auto num_edges = graph_view.get_number_of_edges();
+    std::vector<vertex_t> h_rows(num_edges);
+    std::vector<vertex_t> h_cols(num_edges);
+    std::vector<int32_t> h_values(num_edges);
+    for (vertex_t i = 0; i < graph_view.get_number_of_vertices(); ++i) {
+      for (auto j = h_offsets[i]; j < h_offsets[i + 1]; ++j) {
+        auto pos      = num_edges - 1 - j;
+        h_rows[pos]   = store_transposed ? h_indices[j] : i;
+        h_cols[pos]   = store_transposed ? i : h_indices[j];
+        h_values[pos] = static_cast<int32_t>(j);
+      }
+    }
+
+    rmm::device_uvector<vertex_t> d_rows(num_edges, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_cols(num_edges, handle.get_stream());
+    rmm::device_uvector<int32_t> d_values(num_edges, handle.get_stream());
+    raft::update_device(d_rows.data(), h_rows.data(), num_edges, handle.get_stream());
+    raft::update_device(d_cols.data(), h_cols.data(), num_edges, handle.get_stream());
+    raft::update_device(d_values.data(), h_values.data(), num_edges, handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    cugraph::experimental::edge_property_t<decltype(graph_view), int32_t> edge_property(
+      handle, graph_view, int32_t{-1});
+    cugraph::experimental::fill_edge_property_from_edgelist(handle,
+                                                            graph_view,
+                                                            d_rows.data(),
+                                                            d_cols.data(),
+                                                            d_values.data(),
+                                                            num_edges,
+                                                            edge_property,
+                                                            true);
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    std::vector<int32_t> h_cugraph_values(num_edges);
+    raft::update_host(
+      h_cugraph_values.data(), edge_property.value_first(0), num_edges, handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    std::vector<int32_t> h_reference_values(num_edges);
+    std::iota(h_reference_values.begin(), h_reference_values.end(), int32_t{0});
+    ASSERT_TRUE(std::equal(
+      h_reference_values.begin(), h_reference_values.end(), h_cugraph_values.begin()))
+      << "Edge property values do not match with the reference values.";
+
+    // the patterns should pass the property value of every edge to the edge operator
+
+    auto threshold = static_cast<int32_t>(num_edges / 3);
+    auto count     = cugraph::experimental::count_if_e(
+      handle,
+      graph_view,
+      thrust::make_constant_iterator(0) /* dummy */,
+      thrust::make_constant_iterator(0) /* dummy */,
+      edge_property.view(),
+      [threshold] __device__(auto, auto, auto, auto, auto edge_value) {
+        return edge_value < threshold;
+      });
+    ASSERT_EQ(count, static_cast<edge_t>(threshold))
+      << "count_if_e with an edge property returned a wrong count.";
+
+    auto sum = cugraph::experimental::transform_reduce_e(
+      handle,
+      graph_view,
+      thrust::make_constant_iterator(0) /* dummy */,
+      thrust::make_constant_iterator(0) /* dummy */,
+      edge_property.view(),
+      [] __device__(auto, auto, auto, auto, auto edge_value) {
+        return static_cast<int64_t>(edge_value);
+      },
+      int64_t{0});
+    ASSERT_EQ(sum, static_cast<int64_t>(num_edges) * (num_edges - 1) / 2)
+      << "transform_reduce_e with an edge property returned a wrong sum.";
+  }
+};
+
+// FIXME: add tests for type combinations
+
+TEST_P(Tests_EdgeProperty, CheckInt32Int32FloatTransposed)
+{
+  run_current_test<int32_t, int32_t, float, true>(GetParam());
+}
+
+TEST_P(Tests_EdgeProperty, CheckInt32Int32FloatUntransposed)
+{
+  run_current_test<int32_t, int32_t, float, false>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(simple_test,
+                        Tests_EdgeProperty,
+                        ::testing::Values(EdgeProperty_Usecase("test/datasets/karate.mtx"),
+                                          EdgeProperty_Usecase("test/datasets/web-Google.mtx")));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <experimental/graph_functions.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <tuple>
+#include <vector>
+
+typedef struct EdgelistFileReader_Usecase_t {
+  std::string graph_file_full_path{};
+  size_t num_byte_ranges{1};
+
+  EdgelistFileReader_Usecase_t(std::string const& graph_file_path, size_t num_byte_ranges)
+    : num_byte_ranges(num_byte_ranges)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} EdgelistFileReader_Usecase;
+
+class Tests_EdgelistFileReader : public ::testing::TestWithParam<EdgelistFileReader_Usecase> {
+ public:
+  Tests_EdgelistFileReader() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // compare the edge list parsed on device with the edge list parsed on host (with fscanf)
+  void run_current_test(EdgelistFileReader_Usecase const& configuration)
+  {
+    using vertex_t = int32_t;
+    using weight_t = float;
+
+    raft::handle_t handle{};
+
+    // 1. read the reference edge list on host
+
+    FILE* fpin = fopen(configuration.graph_file_full_path.c_str(), "r");
+    ASSERT_NE(fpin, nullptr) << "fopen (" << configuration.graph_file_full_path << ") failure.";
+
+    MM_typecode mc{};
+    vertex_t m{};
+    vertex_t k{};
+    vertex_t nnz{};
+    ASSERT_EQ(cugraph::test::mm_properties<vertex_t>(fpin, 1, &mc, &m, &k, &nnz), 0)
+      << "could not read Matrix Market file properties.";
+
+    std::vector<vertex_t> h_reference_rows(nnz);
+    std::vector<vertex_t> h_reference_cols(nnz);
+    std::vector<weight_t> h_reference_weights(nnz);
+    ASSERT_EQ((cugraph::test::mm_to_coo<vertex_t, weight_t>(fpin,
+                                                             1,
+                                                             nnz,
+                                                             h_reference_rows.data(),
+                                                             h_reference_cols.data(),
+                                                             h_reference_weights.data(),
+                                                             static_cast<weight_t*>(nullptr))),
+              0)
+      << "could not read matrix data.";
+    ASSERT_EQ(fseek(fpin, 0, SEEK_END), 0) << "fseek failure.";
+    auto file_size = static_cast<size_t>(ftell(fpin));
+    ASSERT_EQ(fclose(fpin), 0) << "fclose failure.";
+
+    // 2. read the entire file on device
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    rmm::device_uvector<vertex_t> d_rows(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_cols(0, handle.get_stream());
+    rmm::device_uvector<weight_t> d_weights(0, handle.get_stream());
+    vertex_t number_of_vertices{};
+    bool is_symmetric{};
+    std::tie(d_rows, d_cols, d_weights, number_of_vertices, is_symmetric) =
+      cugraph::experimental::read_edgelist_from_matrix_market_file<vertex_t, weight_t>(
+        handle, configuration.graph_file_full_path, true);
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    ASSERT_EQ(number_of_vertices, m);
+    ASSERT_EQ(is_symmetric, static_cast<bool>(mm_is_symmetric(mc)));
+    ASSERT_EQ(d_rows.size(), static_cast<size_t>(nnz));
+
+    std::vector<vertex_t> h_rows(d_rows.size());
+    std::vector<vertex_t> h_cols(d_cols.size());
+    std::vector<weight_t> h_weights(d_weights.size());
+    raft::update_host(h_rows.data(), d_rows.data(), d_rows.size(), handle.get_stream());
+    raft::update_host(h_cols.data(), d_cols.data(), d_cols.size(), handle.get_stream());
+    raft::update_host(h_weights.data(), d_weights.data(), d_weights.size(), handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    ASSERT_TRUE(h_rows == h_reference_rows) << "Rows do not match with the reference values.";
+    ASSERT_TRUE(h_cols == h_reference_cols) << "Columns do not match with the reference values.";
+    auto nearly_equal = [](weight_t lhs, weight_t rhs) {
+      return std::abs(lhs - rhs) <= std::max(std::abs(lhs), std::abs(rhs)) * weight_t{1e-6};
+    };
+    ASSERT_TRUE(std::equal(
+      h_weights.begin(), h_weights.end(), h_reference_weights.begin(), nearly_equal))
+      << "Weights do not match with the reference values.";
+
+    // 3. read the file in disjoint byte ranges, every entry should be read exactly once (and in
+    // the file order)
+
+    auto byte_range_size =
+      (file_size + (configuration.num_byte_ranges - 1)) / configuration.num_byte_ranges;
+    std::vector<vertex_t> h_concatenated_rows{};
+    std::vector<vertex_t> h_concatenated_cols{};
+    for (size_t i = 0; i < configuration.num_byte_ranges; ++i) {
+      std::tie(d_rows, d_cols, d_weights, std::ignore, std::ignore) =
+        cugraph::experimental::read_edgelist_from_matrix_market_file<vertex_t, weight_t>(
+          handle,
+          configuration.graph_file_full_path,
+          false,
+          byte_range_size * i,
+          byte_range_size);
+      ASSERT_EQ(d_weights.size(), size_t{0});
+      auto old_size = h_concatenated_rows.size();
+      h_concatenated_rows.resize(old_size + d_rows.size());
+      h_concatenated_cols.resize(old_size + d_cols.size());
+      raft::update_host(
+        h_concatenated_rows.data() + old_size, d_rows.data(), d_rows.size(), handle.get_stream());
+      raft::update_host(
+        h_concatenated_cols.data() + old_size, d_cols.data(), d_cols.size(), handle.get_stream());
+      CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+    }
+
+    ASSERT_TRUE(h_concatenated_rows == h_reference_rows)
+      << "Rows read in byte ranges do not match with the reference values.";
+    ASSERT_TRUE(h_concatenated_cols == h_reference_cols)
+      << "Columns read in byte ranges do not match with the reference values.";
+  }
+};
+
+TEST_P(Tests_EdgelistFileReader, CheckInt32Float) { run_current_test(GetParam()); }
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_EdgelistFileReader,
+  ::testing::Values(EdgelistFileReader_Usecase("test/datasets/karate.mtx", 1),
+                    EdgelistFileReader_Usecase("test/datasets/karate.mtx", 7),
+                    EdgelistFileReader_Usecase("test/datasets/netscience.mtx", 3),
+                    EdgelistFileReader_Usecase("test/datasets/web-Google.mtx", 16)));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
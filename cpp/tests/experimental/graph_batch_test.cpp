@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_batch.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
+
+typedef struct GraphBatch_Usecase_t {
+  std::vector<std::string> graph_file_full_paths{};
+  bool test_weighted{false};
+
+  GraphBatch_Usecase_t(std::vector<std::string> const& graph_file_paths, bool test_weighted)
+    : test_weighted(test_weighted)
+  {
+    for (auto const& graph_file_path : graph_file_paths) {
+      if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+        graph_file_full_paths.push_back(cugraph::test::get_rapids_dataset_root_dir() + "/" +
+                                        graph_file_path);
+      } else {
+        graph_file_full_paths.push_back(graph_file_path);
+      }
+    }
+  };
+} GraphBatch_Usecase;
+
+template <typename vertex_t, typename weight_t>
+struct host_edgelist_t {
+  std::vector<vertex_t> srcs{};
+  std::vector<vertex_t> dsts{};
+  std::vector<weight_t> weights{};
+  vertex_t number_of_vertices{0};
+  bool is_symmetric{false};
+};
+
+class Tests_GraphBatch : public ::testing::TestWithParam<GraphBatch_Usecase> {
+ public:
+  Tests_GraphBatch() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  static cugraph::experimental::graph_batch_t<vertex_t, edge_t, weight_t, store_transposed>
+  create_graph_batch(raft::handle_t const& handle,
+                     std::vector<host_edgelist_t<vertex_t, weight_t>> const& edgelists,
+                     bool test_weighted)
+  {
+    std::vector<vertex_t> h_srcs{};
+    std::vector<vertex_t> h_dsts{};
+    std::vector<weight_t> h_weights{};
+    std::vector<edge_t> h_edge_offsets{0};
+    std::vector<vertex_t> h_vertex_offsets{0};
+    for (auto const& edgelist : edgelists) {
+      h_srcs.insert(h_srcs.end(), edgelist.srcs.begin(), edgelist.srcs.end());
+      h_dsts.insert(h_dsts.end(), edgelist.dsts.begin(), edgelist.dsts.end());
+      h_weights.insert(h_weights.end(), edgelist.weights.begin(), edgelist.weights.end());
+      h_edge_offsets.push_back(static_cast<edge_t>(h_srcs.size()));
+      h_vertex_offsets.push_back(h_vertex_offsets.back() + edgelist.number_of_vertices);
+    }
+
+    rmm::device_uvector<vertex_t> d_srcs(h_srcs.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_dsts(h_dsts.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> d_weights(h_weights.size(), handle.get_stream());
+    rmm::device_uvector<edge_t> d_edge_offsets(h_edge_offsets.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_vertex_offsets(h_vertex_offsets.size(), handle.get_stream());
+    raft::update_device(d_srcs.data(), h_srcs.data(), h_srcs.size(), handle.get_stream());
+    raft::update_device(d_dsts.data(), h_dsts.data(), h_dsts.size(), handle.get_stream());
+    raft::update_device(d_weights.data(), h_weights.data(), h_weights.size(), handle.get_stream());
+    raft::update_device(
+      d_edge_offsets.data(), h_edge_offsets.data(), h_edge_offsets.size(), handle.get_stream());
+    raft::update_device(d_vertex_offsets.data(),
+                        h_vertex_offsets.data(),
+                        h_vertex_offsets.size(),
+                        handle.get_stream());
+
+    return cugraph::experimental::graph_batch_t<vertex_t, edge_t, weight_t, store_transposed>(
+      handle,
+      cugraph::experimental::edgelist_t<vertex_t, edge_t, weight_t>{
+        d_srcs.data(),
+        d_dsts.data(),
+        test_weighted ? d_weights.data() : nullptr,
+        static_cast<edge_t>(h_srcs.size())},
+      d_edge_offsets.data(),
+      d_vertex_offsets.data(),
+      edgelists.size(),
+      cugraph::experimental::graph_properties_t{true, false, test_weighted, false},
+      true);
+  }
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  static cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, store_transposed, false>
+  create_graph(raft::handle_t const& handle,
+               host_edgelist_t<vertex_t, weight_t> const& edgelist,
+               bool test_weighted)
+  {
+    rmm::device_uvector<vertex_t> d_srcs(edgelist.srcs.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_dsts(edgelist.dsts.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> d_weights(edgelist.weights.size(), handle.get_stream());
+    raft::update_device(
+      d_srcs.data(), edgelist.srcs.data(), edgelist.srcs.size(), handle.get_stream());
+    raft::update_device(
+      d_dsts.data(), edgelist.dsts.data(), edgelist.dsts.size(), handle.get_stream());
+    raft::update_device(
+      d_weights.data(), edgelist.weights.data(), edgelist.weights.size(), handle.get_stream());
+
+    return cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, store_transposed, false>(
+      handle,
+      cugraph::experimental::edgelist_t<vertex_t, edge_t, weight_t>{
+        d_srcs.data(),
+        d_dsts.data(),
+        test_weighted ? d_weights.data() : nullptr,
+        static_cast<edge_t>(edgelist.srcs.size())},
+      edgelist.number_of_vertices,
+      cugraph::experimental::graph_properties_t{
+        edgelist.is_symmetric, false, test_weighted, false},
+      false,
+      true);
+  }
+
+  // compare the batched algorithm results with the results of the algorithms run on every graph
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(GraphBatch_Usecase const& configuration)
+  {
+    using result_t = weight_t;
+
+    raft::handle_t handle{};
+
+    std::vector<host_edgelist_t<vertex_t, weight_t>> edgelists{};
+    std::vector<vertex_t> h_vertex_offsets{0};
+    for (auto const& graph_file_full_path : configuration.graph_file_full_paths) {
+      rmm::device_uvector<vertex_t> d_rows(0, handle.get_stream());
+      rmm::device_uvector<vertex_t> d_cols(0, handle.get_stream());
+      rmm::device_uvector<weight_t> d_weights(0, handle.get_stream());
+      host_edgelist_t<vertex_t, weight_t> edgelist{};
+      std::tie(d_rows, d_cols, d_weights, edgelist.number_of_vertices, edgelist.is_symmetric) =
+        cugraph::test::read_edgelist_from_matrix_market_file<vertex_t, weight_t>(
+          handle, graph_file_full_path, configuration.test_weighted);
+      ASSERT_TRUE(edgelist.is_symmetric) << "This test requires symmetric input graphs.";
+      edgelist.srcs.resize(d_rows.size());
+      edgelist.dsts.resize(d_cols.size());
+      edgelist.weights.resize(d_weights.size());
+      raft::update_host(edgelist.srcs.data(), d_rows.data(), d_rows.size(), handle.get_stream());
+      raft::update_host(edgelist.dsts.data(), d_cols.data(), d_cols.size(), handle.get_stream());
+      raft::update_host(
+        edgelist.weights.data(), d_weights.data(), d_weights.size(), handle.get_stream());
+      CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+      h_vertex_offsets.push_back(h_vertex_offsets.back() + edgelist.number_of_vertices);
+      edgelists.push_back(std::move(edgelist));
+    }
+    auto num_graphs   = edgelists.size();
+    auto num_vertices = h_vertex_offsets.back();
+
+    // 1. weakly connected components
+
+    {
+      auto graph_batch = create_graph_batch<vertex_t, edge_t, weight_t, false>(
+        handle, edgelists, configuration.test_weighted);
+      ASSERT_EQ(graph_batch.get_number_of_graphs(), num_graphs);
+      ASSERT_EQ(graph_batch.view().get_number_of_vertices(), num_vertices);
+
+      rmm::device_uvector<vertex_t> d_components(num_vertices, handle.get_stream());
+      cugraph::experimental::batched_weakly_connected_components(
+        handle, graph_batch, d_components.data(), true);
+      std::vector<vertex_t> h_components(num_vertices);
+      raft::update_host(
+        h_components.data(), d_components.data(), d_components.size(), handle.get_stream());
+
+      rmm::device_uvector<weight_t> d_modularities(num_graphs, handle.get_stream());
+      rmm::device_uvector<vertex_t> d_clustering(num_vertices, handle.get_stream());
+      cugraph::experimental::batched_louvain(
+        handle, graph_batch, d_clustering.data(), d_modularities.data());
+      std::vector<vertex_t> h_clustering(num_vertices);
+      std::vector<weight_t> h_modularities(num_graphs);
+      raft::update_host(
+        h_clustering.data(), d_clustering.data(), d_clustering.size(), handle.get_stream());
+      raft::update_host(
+        h_modularities.data(), d_modularities.data(), d_modularities.size(), handle.get_stream());
+      CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+      for (size_t i = 0; i < num_graphs; ++i) {
+        auto graph = create_graph<vertex_t, edge_t, weight_t, false>(
+          handle, edgelists[i], configuration.test_weighted);
+        rmm::device_uvector<vertex_t> d_reference_components(edgelists[i].number_of_vertices,
+                                                             handle.get_stream());
+        cugraph::experimental::weakly_connected_components(
+          handle, graph.view(), d_reference_components.data());
+        std::vector<vertex_t> h_reference_components(d_reference_components.size());
+        raft::update_host(h_reference_components.data(),
+                          d_reference_components.data(),
+                          d_reference_components.size(),
+                          handle.get_stream());
+        CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+        ASSERT_TRUE(std::equal(h_reference_components.begin(),
+                               h_reference_components.end(),
+                               h_components.begin() + h_vertex_offsets[i]))
+          << "Batched weakly connected components of graph " << i
+          << " do not match with the reference values.";
+
+        // clusters are labeled with their smallest local vertex IDs
+        for (vertex_t v = 0; v < edgelists[i].number_of_vertices; ++v) {
+          auto label = h_clustering[h_vertex_offsets[i] + v];
+          ASSERT_TRUE((label >= 0) && (label <= v) && (h_clustering[h_vertex_offsets[i] + label] ==
+                                                       label))
+            << "Invalid batched Louvain cluster label " << label << " for vertex " << v
+            << " of graph " << i << ".";
+        }
+        ASSERT_TRUE((h_modularities[i] > weight_t{0.0}) && (h_modularities[i] <= weight_t{1.0}))
+          << "Batched Louvain modularity " << h_modularities[i] << " of graph " << i
+          << " is not in (0.0, 1.0].";
+      }
+    }
+
+    // 2. PageRank
+
+    {
+      auto graph_batch = create_graph_batch<vertex_t, edge_t, weight_t, true>(
+        handle, edgelists, configuration.test_weighted);
+
+      result_t constexpr alpha{0.85};
+      result_t constexpr epsilon{1e-6};
+
+      rmm::device_uvector<result_t> d_pageranks(num_vertices, handle.get_stream());
+      cugraph::experimental::batched_pagerank(handle,
+                                              graph_batch,
+                                              d_pageranks.data(),
+                                              alpha,
+                                              epsilon,
+                                              std::numeric_limits<size_t>::max(),
+                                              false,
+                                              true);
+      std::vector<result_t> h_pageranks(num_vertices);
+      raft::update_host(
+        h_pageranks.data(), d_pageranks.data(), d_pageranks.size(), handle.get_stream());
+      CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+      for (size_t i = 0; i < num_graphs; ++i) {
+        auto graph = create_graph<vertex_t, edge_t, weight_t, true>(
+          handle, edgelists[i], configuration.test_weighted);
+        rmm::device_uvector<result_t> d_reference_pageranks(edgelists[i].number_of_vertices,
+                                                            handle.get_stream());
+        cugraph::experimental::pagerank(handle,
+                                        graph.view(),
+                                        static_cast<weight_t const*>(nullptr),
+                                        static_cast<vertex_t const*>(nullptr),
+                                        static_cast<result_t const*>(nullptr),
+                                        vertex_t{0},
+                                        d_reference_pageranks.data(),
+                                        alpha,
+                                        epsilon,
+                                        std::numeric_limits<size_t>::max());
+        std::vector<result_t> h_reference_pageranks(d_reference_pageranks.size());
+        raft::update_host(h_reference_pageranks.data(),
+                          d_reference_pageranks.data(),
+                          d_reference_pageranks.size(),
+                          handle.get_stream());
+        CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+        auto threshold_ratio = 1e-3;
+        auto threshold_magnitude =
+          (epsilon / static_cast<result_t>(edgelists[i].number_of_vertices)) * threshold_ratio;
+        auto nearly_equal = [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+          auto diff = std::abs(lhs - rhs);
+          return (diff < std::max(lhs, rhs) * threshold_ratio) || (diff < threshold_magnitude);
+        };
+        ASSERT_TRUE(std::equal(h_reference_pageranks.begin(),
+                               h_reference_pageranks.end(),
+                               h_pageranks.begin() + h_vertex_offsets[i],
+                               nearly_equal))
+          << "Batched PageRank values of graph " << i << " do not match with the reference values.";
+      }
+    }
+  }
+};
+
+// FIXME: add tests for type combinations
+TEST_P(Tests_GraphBatch, CheckInt32Int32FloatFloat)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_GraphBatch,
+  ::testing::Values(
+    GraphBatch_Usecase(std::vector<std::string>{"test/datasets/karate.mtx"}, false),
+    GraphBatch_Usecase(std::vector<std::string>{"test/datasets/karate.mtx",
+                                                "test/datasets/dolphins.mtx",
+                                                "test/datasets/karate.mtx",
+                                                "test/datasets/netscience.mtx"},
+                       false),
+    GraphBatch_Usecase(std::vector<std::string>{"test/datasets/dolphins.mtx",
+                                                "test/datasets/karate.mtx",
+                                                "test/datasets/polbooks.mtx"},
+                       true)));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
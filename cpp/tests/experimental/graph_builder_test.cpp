@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <experimental/graph.hpp>
+#include <experimental/graph_builder.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+typedef struct GraphBuilder_Usecase_t {
+  std::string graph_file_full_path{};
+  bool test_weighted{false};
+  size_t num_chunks{1};
+  cugraph::experimental::graph_storage_t storage{cugraph::experimental::graph_storage_t::device};
+
+  GraphBuilder_Usecase_t(std::string const& graph_file_path,
+                         bool test_weighted,
+                         size_t num_chunks,
+                         cugraph::experimental::graph_storage_t storage =
+                           cugraph::experimental::graph_storage_t::device)
+    : test_weighted(test_weighted), num_chunks(num_chunks), storage(storage)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} GraphBuilder_Usecase;
+
+class Tests_GraphBuilder : public ::testing::TestWithParam<GraphBuilder_Usecase> {
+ public:
+  Tests_GraphBuilder() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // compare the graph built from edge list chunks with the graph built from the entire edge list
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(GraphBuilder_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    rmm::device_uvector<vertex_t> d_rows(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_cols(0, handle.get_stream());
+    rmm::device_uvector<weight_t> d_weights(0, handle.get_stream());
+    vertex_t number_of_vertices{};
+    bool is_symmetric{};
+    std::tie(d_rows, d_cols, d_weights, number_of_vertices, is_symmetric) =
+      cugraph::test::read_edgelist_from_matrix_market_file<vertex_t, weight_t>(
+        handle, configuration.graph_file_full_path, configuration.test_weighted);
+    edge_t number_of_edges = static_cast<edge_t>(d_rows.size());
+
+    cugraph::experimental::graph_properties_t properties{
+      is_symmetric, false, configuration.test_weighted, true};
+
+    auto reference_graph =
+      cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle,
+        cugraph::experimental::edgelist_t<vertex_t, edge_t, weight_t>{
+          d_rows.data(),
+          d_cols.data(),
+          configuration.test_weighted ? d_weights.data() : nullptr,
+          number_of_edges},
+        number_of_vertices,
+        properties,
+        false,
+        true);
+    auto reference_graph_view = reference_graph.view();
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    auto chunk_size = (static_cast<size_t>(number_of_edges) + (configuration.num_chunks - 1)) /
+                      configuration.num_chunks;
+    auto chunk = [&](size_t i) {
+      auto first = std::min(i * chunk_size, static_cast<size_t>(number_of_edges));
+      auto last  = std::min(first + chunk_size, static_cast<size_t>(number_of_edges));
+      return cugraph::experimental::edgelist_t<vertex_t, edge_t, weight_t>{
+        d_rows.data() + first,
+        d_cols.data() + first,
+        configuration.test_weighted ? d_weights.data() + first : nullptr,
+        static_cast<edge_t>(last - first)};
+    };
+
+    cugraph::experimental::graph_builder_t<vertex_t, edge_t, weight_t, store_transposed, false>
+      builder(handle, number_of_vertices, properties, {}, configuration.storage);
+    for (size_t i = 0; i < configuration.num_chunks; ++i) {
+      builder.count_edges(chunk(i), true);
+    }
+    // edges can be inserted in a different order
+    for (size_t i = 0; i < configuration.num_chunks; ++i) {
+      builder.insert_edges(chunk(configuration.num_chunks - 1 - i), true);
+    }
+    auto graph      = builder.build(false, true);
+    auto graph_view = graph.view();
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    ASSERT_EQ(graph_view.get_number_of_vertices(), number_of_vertices);
+    ASSERT_EQ(graph_view.get_number_of_edges(), number_of_edges);
+    ASSERT_TRUE(graph_view.has_sorted_neighbor_lists());
+
+    std::vector<edge_t> h_reference_offsets(number_of_vertices + 1);
+    std::vector<vertex_t> h_reference_indices(number_of_edges);
+    std::vector<weight_t> h_reference_weights(configuration.test_weighted ? number_of_edges : 0);
+    std::vector<edge_t> h_cugraph_offsets(number_of_vertices + 1);
+    std::vector<vertex_t> h_cugraph_indices(number_of_edges);
+    std::vector<weight_t> h_cugraph_weights(configuration.test_weighted ? number_of_edges : 0);
+
+    raft::update_host(h_reference_offsets.data(),
+                      reference_graph_view.offsets(),
+                      h_reference_offsets.size(),
+                      handle.get_stream());
+    raft::update_host(h_reference_indices.data(),
+                      reference_graph_view.indices(),
+                      h_reference_indices.size(),
+                      handle.get_stream());
+    raft::update_host(h_cugraph_offsets.data(),
+                      graph_view.offsets(),
+                      h_cugraph_offsets.size(),
+                      handle.get_stream());
+    raft::update_host(h_cugraph_indices.data(),
+                      graph_view.indices(),
+                      h_cugraph_indices.size(),
+                      handle.get_stream());
+    if (configuration.test_weighted) {
+      raft::update_host(h_reference_weights.data(),
+                        reference_graph_view.weights(),
+                        h_reference_weights.size(),
+                        handle.get_stream());
+      raft::update_host(h_cugraph_weights.data(),
+                        graph_view.weights(),
+                        h_cugraph_weights.size(),
+                        handle.get_stream());
+    }
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    ASSERT_TRUE(h_reference_offsets == h_cugraph_offsets)
+      << "Graph compressed sparse format offsets do not match with the reference values.";
+    ASSERT_TRUE(h_reference_indices == h_cugraph_indices)
+      << "Graph compressed sparse format indices do not match with the reference values.";
+    if (configuration.test_weighted) {
+      // weights of multi-edges can be permuted within each (major, minor) pair
+      for (vertex_t i = 0; i < number_of_vertices; ++i) {
+        std::vector<std::tuple<vertex_t, weight_t>> reference_pairs{};
+        std::vector<std::tuple<vertex_t, weight_t>> cugraph_pairs{};
+        for (auto j = h_reference_offsets[i]; j < h_reference_offsets[i + 1]; ++j) {
+          reference_pairs.push_back(
+            std::make_tuple(h_reference_indices[j], h_reference_weights[j]));
+          cugraph_pairs.push_back(std::make_tuple(h_cugraph_indices[j], h_cugraph_weights[j]));
+        }
+        std::sort(reference_pairs.begin(), reference_pairs.end());
+        std::sort(cugraph_pairs.begin(), cugraph_pairs.end());
+        ASSERT_TRUE(reference_pairs == cugraph_pairs)
+          << "Graph compressed sparse format weights for vertex " << i
+          << " do not match with the reference values.";
+      }
+    }
+  }
+};
+
+TEST_P(Tests_GraphBuilder, CheckStoreTransposedFalse)
+{
+  run_current_test<int32_t, int32_t, float, false>(GetParam());
+  run_current_test<int32_t, int64_t, float, false>(GetParam());
+  run_current_test<int64_t, int64_t, double, false>(GetParam());
+}
+
+TEST_P(Tests_GraphBuilder, CheckStoreTransposedTrue)
+{
+  run_current_test<int32_t, int32_t, float, true>(GetParam());
+  run_current_test<int64_t, int64_t, double, true>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_GraphBuilder,
+  ::testing::Values(GraphBuilder_Usecase("test/datasets/karate.mtx", false, 1),
+                    GraphBuilder_Usecase("test/datasets/karate.mtx", true, 3),
+                    GraphBuilder_Usecase("test/datasets/web-Google.mtx", false, 7),
+                    GraphBuilder_Usecase("test/datasets/web-Google.mtx", true, 7),
+                    GraphBuilder_Usecase("test/datasets/webbase-1M.mtx", true, 16),
+                    GraphBuilder_Usecase("test/datasets/web-Google.mtx",
+                                         true,
+                                         7,
+                                         cugraph::experimental::graph_storage_t::managed),
+                    GraphBuilder_Usecase("test/datasets/karate.mtx",
+                                         true,
+                                         3,
+                                         cugraph::experimental::graph_storage_t::pinned_host)));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
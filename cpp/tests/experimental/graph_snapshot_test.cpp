@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <experimental/graph.hpp>
+#include <experimental/graph_functions.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <string>
+#include <tuple>
+#include <vector>
+
+typedef struct GraphSnapshot_Usecase_t {
+  std::string graph_file_full_path{};
+  bool test_weighted{false};
+  bool renumber{false};
+
+  GraphSnapshot_Usecase_t(std::string const& graph_file_path, bool test_weighted, bool renumber)
+    : test_weighted(test_weighted), renumber(renumber)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} GraphSnapshot_Usecase;
+
+class Tests_GraphSnapshot : public ::testing::TestWithParam<GraphSnapshot_Usecase> {
+ public:
+  Tests_GraphSnapshot() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // compare the graph read from a snapshot with the graph written to the snapshot
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(GraphSnapshot_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, store_transposed, false> graph(
+      handle);
+    rmm::device_uvector<vertex_t> d_renumber_map_labels(0, handle.get_stream());
+    std::tie(graph, d_renumber_map_labels) = cugraph::test::
+      read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle,
+        configuration.graph_file_full_path,
+        configuration.test_weighted,
+        configuration.renumber);
+    auto graph_view = graph.view();
+
+    auto file_path = std::string("/tmp/cugraph_graph_snapshot_test_") + std::to_string(getpid()) +
+                     ".bin";
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    cugraph::experimental::write_graph_snapshot(
+      handle,
+      graph_view,
+      configuration.renumber ? d_renumber_map_labels.data() : static_cast<vertex_t const*>(nullptr),
+      file_path);
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, store_transposed, false>
+      snapshot_graph(handle);
+    rmm::device_uvector<vertex_t> d_snapshot_renumber_map_labels(0, handle.get_stream());
+    std::tie(snapshot_graph, d_snapshot_renumber_map_labels) = cugraph::experimental::
+      read_graph_snapshot<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle, file_path, true);
+    auto snapshot_graph_view = snapshot_graph.view();
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    std::remove(file_path.c_str());
+
+    ASSERT_EQ(snapshot_graph_view.get_number_of_vertices(), graph_view.get_number_of_vertices());
+    ASSERT_EQ(snapshot_graph_view.get_number_of_edges(), graph_view.get_number_of_edges());
+    ASSERT_EQ(snapshot_graph_view.is_symmetric(), graph_view.is_symmetric());
+    ASSERT_EQ(snapshot_graph_view.is_multigraph(), graph_view.is_multigraph());
+    ASSERT_EQ(snapshot_graph_view.is_weighted(), graph_view.is_weighted());
+    ASSERT_EQ(snapshot_graph_view.has_sorted_neighbor_lists(),
+              graph_view.has_sorted_neighbor_lists());
+    ASSERT_TRUE(snapshot_graph_view.get_local_adj_matrix_partition_segment_offsets(0) ==
+                graph_view.get_local_adj_matrix_partition_segment_offsets(0))
+      << "Segment offsets do not match with the original graph.";
+
+    auto number_of_vertices = graph_view.get_number_of_vertices();
+    auto number_of_edges    = graph_view.get_number_of_edges();
+
+    std::vector<edge_t> h_offsets(number_of_vertices + 1);
+    std::vector<vertex_t> h_indices(number_of_edges);
+    std::vector<weight_t> h_weights(configuration.test_weighted ? number_of_edges : 0);
+    std::vector<vertex_t> h_renumber_map_labels(d_renumber_map_labels.size());
+    std::vector<edge_t> h_snapshot_offsets(number_of_vertices + 1);
+    std::vector<vertex_t> h_snapshot_indices(number_of_edges);
+    std::vector<weight_t> h_snapshot_weights(configuration.test_weighted ? number_of_edges : 0);
+    std::vector<vertex_t> h_snapshot_renumber_map_labels(d_snapshot_renumber_map_labels.size());
+
+    raft::update_host(
+      h_offsets.data(), graph_view.offsets(), h_offsets.size(), handle.get_stream());
+    raft::update_host(
+      h_indices.data(), graph_view.indices(), h_indices.size(), handle.get_stream());
+    raft::update_host(h_renumber_map_labels.data(),
+                      d_renumber_map_labels.data(),
+                      h_renumber_map_labels.size(),
+                      handle.get_stream());
+    raft::update_host(h_snapshot_offsets.data(),
+                      snapshot_graph_view.offsets(),
+                      h_snapshot_offsets.size(),
+                      handle.get_stream());
+    raft::update_host(h_snapshot_indices.data(),
+                      snapshot_graph_view.indices(),
+                      h_snapshot_indices.size(),
+                      handle.get_stream());
+    raft::update_host(h_snapshot_renumber_map_labels.data(),
+                      d_snapshot_renumber_map_labels.data(),
+                      h_snapshot_renumber_map_labels.size(),
+                      handle.get_stream());
+    if (configuration.test_weighted) {
+      raft::update_host(
+        h_weights.data(), graph_view.weights(), h_weights.size(), handle.get_stream());
+      raft::update_host(h_snapshot_weights.data(),
+                        snapshot_graph_view.weights(),
+                        h_snapshot_weights.size(),
+                        handle.get_stream());
+    }
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    ASSERT_TRUE(h_offsets == h_snapshot_offsets)
+      << "Graph compressed sparse format offsets do not match with the original graph.";
+    ASSERT_TRUE(h_indices == h_snapshot_indices)
+      << "Graph compressed sparse format indices do not match with the original graph.";
+    ASSERT_TRUE(h_weights == h_snapshot_weights)
+      << "Graph compressed sparse format weights do not match with the original graph.";
+    if (configuration.renumber) {
+      ASSERT_TRUE(h_renumber_map_labels == h_snapshot_renumber_map_labels)
+        << "Renumber map labels do not match with the original labels.";
+    } else {
+      ASSERT_EQ(h_snapshot_renumber_map_labels.size(), size_t{0})
+        << "Renumber map labels should be empty if not written to the snapshot.";
+    }
+  }
+};
+
+TEST_P(Tests_GraphSnapshot, CheckStoreTransposedFalse)
+{
+  run_current_test<int32_t, int32_t, float, false>(GetParam());
+  run_current_test<int32_t, int64_t, float, false>(GetParam());
+  run_current_test<int64_t, int64_t, double, false>(GetParam());
+}
+
+TEST_P(Tests_GraphSnapshot, CheckStoreTransposedTrue)
+{
+  run_current_test<int32_t, int32_t, float, true>(GetParam());
+  run_current_test<int64_t, int64_t, double, true>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_GraphSnapshot,
+  ::testing::Values(GraphSnapshot_Usecase("test/datasets/karate.mtx", false, false),
+                    GraphSnapshot_Usecase("test/datasets/karate.mtx", true, true),
+                    GraphSnapshot_Usecase("test/datasets/web-Google.mtx", false, true),
+                    GraphSnapshot_Usecase("test/datasets/web-Google.mtx", true, false)));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -89,7 +89,7 @@ class Tests_Graph : public ::testing::TestWithParam<Graph_Usecase> {
   virtual void TearDown() {}
 
   template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
-  void run_current_test(Graph_Usecase const& configuration)
+  void run_current_test(Graph_Usecase const& configuration, bool sort_neighbor_lists = false)
   {
     raft::handle_t handle{};
 
@@ -139,7 +139,8 @@ class Tests_Graph : public ::testing::TestWithParam<Graph_Usecase> {
         handle,
         edgelist,
         number_of_vertices,
-        cugraph::experimental::graph_properties_t{is_symmetric, false, configuration.test_weighted},
+        cugraph::experimental::graph_properties_t{
+          is_symmetric, false, configuration.test_weighted, sort_neighbor_lists},
         false,
         true);
 
@@ -149,6 +150,7 @@ class Tests_Graph : public ::testing::TestWithParam<Graph_Usecase> {
 
     ASSERT_EQ(graph_view.get_number_of_vertices(), number_of_vertices);
     ASSERT_EQ(graph_view.get_number_of_edges(), number_of_edges);
+    ASSERT_EQ(graph_view.has_sorted_neighbor_lists(), sort_neighbor_lists);
 
     std::vector<edge_t> h_cugraph_offsets(graph_view.get_number_of_vertices() + 1);
     std::vector<vertex_t> h_cugraph_indices(graph_view.get_number_of_edges());
@@ -179,6 +181,11 @@ class Tests_Graph : public ::testing::TestWithParam<Graph_Usecase> {
     for (vertex_t i = 0; i < number_of_vertices; ++i) {
       auto start  = h_reference_offsets[i];
       auto degree = h_reference_offsets[i + 1] - start;
+      if (sort_neighbor_lists) {
+        ASSERT_TRUE(std::is_sorted(h_cugraph_indices.begin() + start,
+                                   h_cugraph_indices.begin() + (start + degree)))
+          << "Graph compressed sparse format indices for vertex " << i << " are not sorted.";
+      }
       if (configuration.test_weighted) {
         std::vector<std::tuple<vertex_t, weight_t>> reference_pairs(degree);
         std::vector<std::tuple<vertex_t, weight_t>> cugraph_pairs(degree);
@@ -230,6 +237,15 @@ TEST_P(Tests_Graph, CheckStoreTransposedTrue)
   run_current_test<int64_t, int64_t, double, true>(GetParam());
 }
 
+TEST_P(Tests_Graph, CheckSortedNeighborLists)
+{
+  run_current_test<int32_t, int32_t, float, false>(GetParam(), true);
+  run_current_test<int32_t, int64_t, float, false>(GetParam(), true);
+  run_current_test<int64_t, int64_t, double, false>(GetParam(), true);
+  run_current_test<int32_t, int32_t, float, true>(GetParam(), true);
+  run_current_test<int64_t, int64_t, double, true>(GetParam(), true);
+}
+
 INSTANTIATE_TEST_CASE_P(simple_test,
                         Tests_Graph,
                         ::testing::Values(Graph_Usecase("test/datasets/karate.mtx", false),
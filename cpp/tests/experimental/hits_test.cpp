@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+// offsets & indices of the graph in the CSC format (the incoming edges of every vertex)
+template <typename vertex_t, typename edge_t, typename result_t>
+void hits_reference(edge_t const* offsets,
+                    vertex_t const* indices,
+                    vertex_t num_vertices,
+                    result_t* hubs,
+                    result_t* authorities,
+                    result_t epsilon,
+                    size_t max_iterations,
+                    bool normalize)
+{
+  std::fill(hubs, hubs + num_vertices, result_t{1.0} / static_cast<result_t>(num_vertices));
+  std::vector<result_t> old_hubs(num_vertices);
+  for (size_t iter = 0; iter < max_iterations; ++iter) {
+    std::copy(hubs, hubs + num_vertices, old_hubs.begin());
+    std::fill(authorities, authorities + num_vertices, result_t{0.0});
+    std::fill(hubs, hubs + num_vertices, result_t{0.0});
+    for (vertex_t v = 0; v < num_vertices; ++v) {
+      for (auto i = offsets[v]; i < offsets[v + 1]; ++i) { authorities[v] += old_hubs[indices[i]]; }
+    }
+    for (vertex_t v = 0; v < num_vertices; ++v) {
+      for (auto i = offsets[v]; i < offsets[v + 1]; ++i) { hubs[indices[i]] += authorities[v]; }
+    }
+    auto hub_max       = *std::max_element(hubs, hubs + num_vertices);
+    auto authority_max = *std::max_element(authorities, authorities + num_vertices);
+    if (hub_max > 0.0) {
+      std::for_each(hubs, hubs + num_vertices, [hub_max](auto& val) { val /= hub_max; });
+    }
+    if (authority_max > 0.0) {
+      std::for_each(authorities, authorities + num_vertices, [authority_max](auto& val) {
+        val /= authority_max;
+      });
+    }
+    result_t diff_sum{0.0};
+    for (vertex_t v = 0; v < num_vertices; ++v) { diff_sum += std::abs(hubs[v] - old_hubs[v]); }
+    if (diff_sum < epsilon) { break; }
+  }
+
+  if (normalize) {
+    auto hub_sum       = std::accumulate(hubs, hubs + num_vertices, result_t{0.0});
+    auto authority_sum = std::accumulate(authorities, authorities + num_vertices, result_t{0.0});
+    if (hub_sum > 0.0) {
+      std::for_each(hubs, hubs + num_vertices, [hub_sum](auto& val) { val /= hub_sum; });
+    }
+    if (authority_sum > 0.0) {
+      std::for_each(authorities, authorities + num_vertices, [authority_sum](auto& val) {
+        val /= authority_sum;
+      });
+    }
+  }
+}
+
+typedef struct HITS_Usecase_t {
+  std::string graph_file_full_path{};
+
+  HITS_Usecase_t(std::string const& graph_file_path)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} HITS_Usecase;
+
+class Tests_HITS : public ::testing::TestWithParam<HITS_Usecase> {
+ public:
+  Tests_HITS() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(HITS_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, true, false> graph(handle);
+    std::tie(graph, std::ignore) = cugraph::test::
+      read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, true, false>(
+        handle, configuration.graph_file_full_path, false, false);
+    auto graph_view = graph.view();
+
+    auto num_vertices = graph_view.get_number_of_vertices();
+
+    std::vector<edge_t> h_offsets(num_vertices + 1);
+    std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+    raft::update_host(
+      h_offsets.data(), graph_view.offsets(), num_vertices + 1, handle.get_stream());
+    raft::update_host(h_indices.data(),
+                      graph_view.indices(),
+                      graph_view.get_number_of_edges(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    result_t constexpr epsilon{1e-6};
+    size_t constexpr max_iterations{1000};
+
+    std::vector<result_t> h_reference_hubs(num_vertices);
+    std::vector<result_t> h_reference_authorities(num_vertices);
+    hits_reference(h_offsets.data(),
+                   h_indices.data(),
+                   num_vertices,
+                   h_reference_hubs.data(),
+                   h_reference_authorities.data(),
+                   epsilon,
+                   max_iterations,
+                   true);
+
+    rmm::device_uvector<result_t> d_hubs(num_vertices, handle.get_stream());
+    rmm::device_uvector<result_t> d_authorities(num_vertices, handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    cugraph::experimental::hits(handle,
+                                graph_view,
+                                d_hubs.data(),
+                                d_authorities.data(),
+                                epsilon,
+                                max_iterations,
+                                false,
+                                true,
+                                true);
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    std::vector<result_t> h_cugraph_hubs(num_vertices);
+    std::vector<result_t> h_cugraph_authorities(num_vertices);
+    raft::update_host(h_cugraph_hubs.data(), d_hubs.data(), d_hubs.size(), handle.get_stream());
+    raft::update_host(h_cugraph_authorities.data(),
+                      d_authorities.data(),
+                      d_authorities.size(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    auto threshold_ratio = 1e-3;
+    auto threshold_magnitude =
+      (1.0 / static_cast<result_t>(num_vertices)) *
+      threshold_ratio;  // skip comparison for low scores (lowly ranked vertices)
+    auto nearly_equal = [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+      return std::abs(lhs - rhs) <
+             std::max(std::max(lhs, rhs) * threshold_ratio, threshold_magnitude);
+    };
+
+    ASSERT_TRUE(std::equal(
+      h_reference_hubs.begin(), h_reference_hubs.end(), h_cugraph_hubs.begin(), nearly_equal))
+      << "Hub values do not match with the reference values.";
+    ASSERT_TRUE(std::equal(h_reference_authorities.begin(),
+                           h_reference_authorities.end(),
+                           h_cugraph_authorities.begin(),
+                           nearly_equal))
+      << "Authority values do not match with the reference values.";
+  }
+};
+
+TEST_P(Tests_HITS, CheckInt32Int32FloatFloat)
+{
+  run_current_test<int32_t, int32_t, float, float>(GetParam());
+}
+
+TEST_P(Tests_HITS, CheckInt64Int64FloatFloat)
+{
+  run_current_test<int64_t, int64_t, float, float>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(simple_test,
+                        Tests_HITS,
+                        ::testing::Values(HITS_Usecase("test/datasets/karate.mtx"),
+                                          HITS_Usecase("test/datasets/dolphins.mtx"),
+                                          HITS_Usecase("test/datasets/netscience.mtx")));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+typedef struct IncrementalPageRank_Usecase_t {
+  std::string graph_file_full_path{};
+  double delta_ratio{0.0};  // ratio of the edges inserted (and the edges deleted) by the update
+  bool test_weighted{false};
+
+  IncrementalPageRank_Usecase_t(std::string const& graph_file_path,
+                                double delta_ratio,
+                                bool test_weighted)
+    : delta_ratio(delta_ratio), test_weighted(test_weighted)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} IncrementalPageRank_Usecase;
+
+template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, store_transposed, false> build_graph(
+  raft::handle_t const& handle,
+  std::vector<vertex_t> const& h_rows,
+  std::vector<vertex_t> const& h_cols,
+  std::vector<weight_t> const& h_weights,
+  vertex_t num_vertices,
+  bool test_weighted)
+{
+  rmm::device_uvector<vertex_t> d_vertices(num_vertices, handle.get_stream());
+  rmm::device_uvector<vertex_t> d_rows(h_rows.size(), handle.get_stream());
+  rmm::device_uvector<vertex_t> d_cols(h_cols.size(), handle.get_stream());
+  rmm::device_uvector<weight_t> d_weights(test_weighted ? h_weights.size() : size_t{0},
+                                          handle.get_stream());
+  std::vector<vertex_t> h_vertices(num_vertices);
+  std::iota(h_vertices.begin(), h_vertices.end(), vertex_t{0});
+  raft::update_device(d_vertices.data(), h_vertices.data(), h_vertices.size(), handle.get_stream());
+  raft::update_device(d_rows.data(), h_rows.data(), h_rows.size(), handle.get_stream());
+  raft::update_device(d_cols.data(), h_cols.data(), h_cols.size(), handle.get_stream());
+  if (test_weighted) {
+    raft::update_device(d_weights.data(), h_weights.data(), h_weights.size(), handle.get_stream());
+  }
+
+  cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, store_transposed, false> graph(handle);
+  std::tie(graph, std::ignore) = cugraph::test::
+    generate_graph_from_edgelist<vertex_t, edge_t, weight_t, store_transposed, false>(
+      handle,
+      std::move(d_vertices),
+      std::move(d_rows),
+      std::move(d_cols),
+      std::move(d_weights),
+      false,
+      test_weighted,
+      false);
+  return graph;
+}
+
+class Tests_IncrementalPageRank : public ::testing::TestWithParam<IncrementalPageRank_Usecase> {
+ public:
+  Tests_IncrementalPageRank() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, typename result_t>
+  void run_current_test(IncrementalPageRank_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    rmm::device_uvector<vertex_t> d_rows(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_cols(0, handle.get_stream());
+    rmm::device_uvector<weight_t> d_weights(0, handle.get_stream());
+    vertex_t num_vertices{};
+    std::tie(d_rows, d_cols, d_weights, num_vertices, std::ignore) =
+      cugraph::test::read_edgelist_from_matrix_market_file<vertex_t, weight_t>(
+        handle, configuration.graph_file_full_path, configuration.test_weighted);
+
+    std::vector<vertex_t> h_rows(d_rows.size());
+    std::vector<vertex_t> h_cols(d_cols.size());
+    std::vector<weight_t> h_weights(d_rows.size(), weight_t{1.0});
+    raft::update_host(h_rows.data(), d_rows.data(), d_rows.size(), handle.get_stream());
+    raft::update_host(h_cols.data(), d_cols.data(), d_cols.size(), handle.get_stream());
+    if (configuration.test_weighted) {
+      raft::update_host(h_weights.data(), d_weights.data(), d_weights.size(), handle.get_stream());
+    }
+    handle.get_stream_view().synchronize();
+
+    // the old graph misses the inserted edges and the new graph misses the deleted edges
+
+    std::vector<vertex_t> h_old_rows{};
+    std::vector<vertex_t> h_old_cols{};
+    std::vector<weight_t> h_old_weights{};
+    std::vector<vertex_t> h_new_rows{};
+    std::vector<vertex_t> h_new_cols{};
+    std::vector<weight_t> h_new_weights{};
+    std::vector<vertex_t> h_delta_srcs{};
+    std::vector<vertex_t> h_delta_dsts{};
+    std::vector<weight_t> h_delta_weights{};
+    std::default_random_engine generator{};
+    std::uniform_real_distribution<double> distribution{0.0, 1.0};
+    for (size_t i = 0; i < h_rows.size(); ++i) {
+      auto r = distribution(generator);
+      if (r >= configuration.delta_ratio) {
+        h_old_rows.push_back(h_rows[i]);
+        h_old_cols.push_back(h_cols[i]);
+        h_old_weights.push_back(h_weights[i]);
+      }
+      if ((r < configuration.delta_ratio) || (r >= 2.0 * configuration.delta_ratio)) {
+        h_new_rows.push_back(h_rows[i]);
+        h_new_cols.push_back(h_cols[i]);
+        h_new_weights.push_back(h_weights[i]);
+      }
+      if (r < 2.0 * configuration.delta_ratio) {
+        h_delta_srcs.push_back(h_rows[i]);
+        h_delta_dsts.push_back(h_cols[i]);
+        h_delta_weights.push_back(r < configuration.delta_ratio ? h_weights[i] : -h_weights[i]);
+      }
+    }
+
+    result_t constexpr alpha{0.85};
+    result_t constexpr epsilon{1e-6};
+
+    // compute the previous PageRank scores on the old graph
+
+    auto old_graph = build_graph<vertex_t, edge_t, weight_t, true>(
+      handle, h_old_rows, h_old_cols, h_old_weights, num_vertices, configuration.test_weighted);
+    auto old_graph_view = old_graph.view();
+
+    rmm::device_uvector<result_t> d_pageranks(num_vertices, handle.get_stream());
+    cugraph::experimental::pagerank(handle,
+                                    old_graph_view,
+                                    static_cast<weight_t*>(nullptr),
+                                    static_cast<vertex_t*>(nullptr),
+                                    static_cast<result_t*>(nullptr),
+                                    vertex_t{0},
+                                    d_pageranks.data(),
+                                    alpha,
+                                    epsilon,
+                                    std::numeric_limits<size_t>::max(),
+                                    false,
+                                    false);
+
+    // update the PageRank scores on the new graph
+
+    auto new_graph = build_graph<vertex_t, edge_t, weight_t, false>(
+      handle, h_new_rows, h_new_cols, h_new_weights, num_vertices, configuration.test_weighted);
+    auto new_graph_view = new_graph.view();
+
+    rmm::device_uvector<vertex_t> d_delta_srcs(h_delta_srcs.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_delta_dsts(h_delta_dsts.size(), handle.get_stream());
+    rmm::device_uvector<weight_t> d_delta_weights(h_delta_weights.size(), handle.get_stream());
+    raft::update_device(
+      d_delta_srcs.data(), h_delta_srcs.data(), h_delta_srcs.size(), handle.get_stream());
+    raft::update_device(
+      d_delta_dsts.data(), h_delta_dsts.data(), h_delta_dsts.size(), handle.get_stream());
+    raft::update_device(
+      d_delta_weights.data(), h_delta_weights.data(), h_delta_weights.size(), handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    cugraph::experimental::incremental_pagerank(handle,
+                                                new_graph_view,
+                                                d_delta_srcs.data(),
+                                                d_delta_dsts.data(),
+                                                d_delta_weights.data(),
+                                                static_cast<edge_t>(d_delta_srcs.size()),
+                                                d_pageranks.data(),
+                                                alpha,
+                                                epsilon,
+                                                std::numeric_limits<size_t>::max(),
+                                                true);
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    // compute the reference PageRank scores from scratch on the new graph
+
+    auto reference_graph = build_graph<vertex_t, edge_t, weight_t, true>(
+      handle, h_new_rows, h_new_cols, h_new_weights, num_vertices, configuration.test_weighted);
+    auto reference_graph_view = reference_graph.view();
+
+    rmm::device_uvector<result_t> d_reference_pageranks(num_vertices, handle.get_stream());
+    cugraph::experimental::pagerank(handle,
+                                    reference_graph_view,
+                                    static_cast<weight_t*>(nullptr),
+                                    static_cast<vertex_t*>(nullptr),
+                                    static_cast<result_t*>(nullptr),
+                                    vertex_t{0},
+                                    d_reference_pageranks.data(),
+                                    alpha,
+                                    epsilon,
+                                    std::numeric_limits<size_t>::max(),
+                                    false,
+                                    false);
+
+    std::vector<result_t> h_cugraph_pageranks(num_vertices);
+    std::vector<result_t> h_reference_pageranks(num_vertices);
+    raft::update_host(
+      h_cugraph_pageranks.data(), d_pageranks.data(), d_pageranks.size(), handle.get_stream());
+    raft::update_host(h_reference_pageranks.data(),
+                      d_reference_pageranks.data(),
+                      d_reference_pageranks.size(),
+                      handle.get_stream());
+    handle.get_stream_view().synchronize();
+
+    auto threshold_ratio = 1e-3;
+    auto threshold_magnitude =
+      (1.0 / static_cast<result_t>(num_vertices)) *
+      threshold_ratio;  // skip comparison for low PageRank verties (lowly ranked vertices)
+    auto nearly_equal = [threshold_ratio, threshold_magnitude](auto lhs, auto rhs) {
+      return std::abs(lhs - rhs) <
+             std::max(std::max(lhs, rhs) * threshold_ratio, threshold_magnitude);
+    };
+
+    ASSERT_TRUE(std::equal(h_reference_pageranks.begin(),
+                           h_reference_pageranks.end(),
+                           h_cugraph_pageranks.begin(),
+                           nearly_equal))
+      << "Incremental PageRank values do not match with the reference values.";
+  }
+};
+
+// FIXME: add tests for type combinations
+TEST_P(Tests_IncrementalPageRank, CheckInt32Int32FloatFloat)
+{
+  run_current_test<int32_t, int32_t, float, float>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_IncrementalPageRank,
+  ::testing::Values(IncrementalPageRank_Usecase("test/datasets/karate.mtx", 0.05, false),
+                    IncrementalPageRank_Usecase("test/datasets/karate.mtx", 0.05, true),
+                    IncrementalPageRank_Usecase("test/datasets/web-Google.mtx", 0.005, false),
+                    IncrementalPageRank_Usecase("test/datasets/web-Google.mtx", 0.005, true),
+                    IncrementalPageRank_Usecase("test/datasets/ljournal-2008.mtx", 0.005, false),
+                    IncrementalPageRank_Usecase("test/datasets/ljournal-2008.mtx", 0.005, true)));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -306,6 +306,16 @@ INSTANTIATE_TEST_CASE_P(
     InducedSubgraph_Usecase("test/datasets/karate.mtx", std::vector<size_t>{10, 0, 5}, false),
     InducedSubgraph_Usecase("test/datasets/karate.mtx", std::vector<size_t>{9, 3, 10}, false),
     InducedSubgraph_Usecase("test/datasets/karate.mtx", std::vector<size_t>{5, 12, 13}, true),
+    // many small subgraphs (vertices with high local degrees take the hash based path)
+    InducedSubgraph_Usecase("test/datasets/karate.mtx",
+                            std::vector<size_t>{2, 1, 2, 3, 2, 1, 2, 2},
+                            false),
+    InducedSubgraph_Usecase("test/datasets/karate.mtx",
+                            std::vector<size_t>{2, 2, 1, 2, 3, 2, 2, 1},
+                            true),
+    InducedSubgraph_Usecase("test/datasets/web-Google.mtx",
+                            std::vector<size_t>(256, size_t{2}),
+                            true),
     InducedSubgraph_Usecase("test/datasets/web-Google.mtx",
                             std::vector<size_t>{250, 130, 15},
                             false),
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <set>
+#include <tuple>
+#include <vector>
+
+// peel one edge at a time (recomputing nothing, a peeled edge decrements the supports of the
+// edges sharing a triangle with it)
+template <typename vertex_t, typename edge_t>
+std::vector<std::tuple<vertex_t, vertex_t, edge_t>> truss_decomposition_reference(
+  edge_t const* offsets, vertex_t const* indices, vertex_t num_vertices)
+{
+  std::vector<std::set<vertex_t>> adjacency(num_vertices);
+  for (vertex_t u = 0; u < num_vertices; ++u) {
+    for (auto i = offsets[u]; i < offsets[u + 1]; ++i) {
+      if (indices[i] != u) { adjacency[u].insert(indices[i]); }
+    }
+  }
+
+  std::map<std::tuple<vertex_t, vertex_t>, edge_t> supports{};
+  for (vertex_t u = 0; u < num_vertices; ++u) {
+    for (auto v : adjacency[u]) {
+      if (u < v) {
+        std::vector<vertex_t> common{};
+        std::set_intersection(adjacency[u].begin(),
+                              adjacency[u].end(),
+                              adjacency[v].begin(),
+                              adjacency[v].end(),
+                              std::back_inserter(common));
+        supports[std::make_tuple(u, v)] = static_cast<edge_t>(common.size());
+      }
+    }
+  }
+
+  std::vector<std::tuple<vertex_t, vertex_t, edge_t>> results{};
+  edge_t k{2};
+  while (!supports.empty()) {
+    auto it = std::find_if(
+      supports.begin(), supports.end(), [k](auto const& pair) { return pair.second <= k - 2; });
+    if (it == supports.end()) {
+      ++k;
+      continue;
+    }
+    auto u = std::get<0>(it->first);
+    auto v = std::get<1>(it->first);
+    results.push_back(std::make_tuple(u, v, k));
+    supports.erase(it);
+    adjacency[u].erase(v);
+    adjacency[v].erase(u);
+    std::vector<vertex_t> common{};
+    std::set_intersection(adjacency[u].begin(),
+                          adjacency[u].end(),
+                          adjacency[v].begin(),
+                          adjacency[v].end(),
+                          std::back_inserter(common));
+    for (auto w : common) {
+      --supports[std::make_tuple(std::min(u, w), std::max(u, w))];
+      --supports[std::make_tuple(std::min(v, w), std::max(v, w))];
+    }
+  }
+
+  std::sort(results.begin(), results.end());
+  return results;
+}
+
+typedef struct KTruss_Usecase_t {
+  std::string graph_file_full_path{};
+
+  KTruss_Usecase_t(std::string const& graph_file_path)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} KTruss_Usecase;
+
+class Tests_KTruss : public ::testing::TestWithParam<KTruss_Usecase> {
+ public:
+  Tests_KTruss() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(KTruss_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, false> graph(handle);
+    std::tie(graph, std::ignore) = cugraph::test::
+      read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, false>(
+        handle, configuration.graph_file_full_path, false, false);
+    auto graph_view = graph.view();
+
+    std::vector<edge_t> h_offsets(graph_view.get_number_of_vertices() + 1);
+    std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+    raft::update_host(h_offsets.data(),
+                      graph_view.offsets(),
+                      graph_view.get_number_of_vertices() + 1,
+                      handle.get_stream());
+    raft::update_host(h_indices.data(),
+                      graph_view.indices(),
+                      graph_view.get_number_of_edges(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    auto h_reference_results = truss_decomposition_reference(
+      h_offsets.data(), h_indices.data(), graph_view.get_number_of_vertices());
+
+    rmm::device_uvector<vertex_t> d_srcs(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_dsts(0, handle.get_stream());
+    rmm::device_uvector<edge_t> d_truss_numbers(0, handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    std::tie(d_srcs, d_dsts, d_truss_numbers) =
+      cugraph::experimental::truss_decomposition(handle, graph_view);
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    ASSERT_EQ(d_srcs.size(), h_reference_results.size())
+      << "The number of edges does not match with the reference value.";
+
+    std::vector<vertex_t> h_srcs(d_srcs.size());
+    std::vector<vertex_t> h_dsts(d_dsts.size());
+    std::vector<edge_t> h_truss_numbers(d_truss_numbers.size());
+    raft::update_host(h_srcs.data(), d_srcs.data(), d_srcs.size(), handle.get_stream());
+    raft::update_host(h_dsts.data(), d_dsts.data(), d_dsts.size(), handle.get_stream());
+    raft::update_host(h_truss_numbers.data(),
+                      d_truss_numbers.data(),
+                      d_truss_numbers.size(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    std::vector<std::tuple<vertex_t, vertex_t, edge_t>> h_cugraph_results(h_srcs.size());
+    for (size_t i = 0; i < h_srcs.size(); ++i) {
+      h_cugraph_results[i] = std::make_tuple(h_srcs[i], h_dsts[i], h_truss_numbers[i]);
+    }
+    std::sort(h_cugraph_results.begin(), h_cugraph_results.end());
+
+    ASSERT_TRUE(std::equal(
+      h_reference_results.begin(), h_reference_results.end(), h_cugraph_results.begin()))
+      << "Truss numbers do not match with the reference values.";
+
+    // the k-truss for the largest truss number
+
+    auto k = edge_t{2};
+    for (auto const& t : h_reference_results) { k = std::max(k, std::get<2>(t)); }
+    auto num_reference_k_truss_edges = static_cast<size_t>(
+      std::count_if(h_reference_results.begin(), h_reference_results.end(), [k](auto const& t) {
+        return std::get<2>(t) >= k;
+      }));
+
+    rmm::device_uvector<vertex_t> d_k_truss_srcs(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_k_truss_dsts(0, handle.get_stream());
+    std::tie(d_k_truss_srcs, d_k_truss_dsts) =
+      cugraph::experimental::k_truss(handle, graph_view, k);
+
+    ASSERT_EQ(d_k_truss_srcs.size(), num_reference_k_truss_edges * 2)
+      << "The k-truss edge count does not match with the reference value.";
+  }
+};
+
+TEST_P(Tests_KTruss, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam());
+}
+
+TEST_P(Tests_KTruss, CheckInt64Int64Float)
+{
+  run_current_test<int64_t, int64_t, float>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(simple_test,
+                        Tests_KTruss,
+                        ::testing::Values(KTruss_Usecase("test/datasets/karate.mtx"),
+                                          KTruss_Usecase("test/datasets/dolphins.mtx"),
+                                          KTruss_Usecase("test/datasets/netscience.mtx")));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <patterns/kernel_dispatch.cuh>
+
+#include <raft/handle.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+// check that the launches cover [0, major_range_size) in order without overlaps
+void check_coverage(
+  std::vector<cugraph::experimental::detail::pattern_kernel_launch_t> const& launches,
+  size_t major_range_size)
+{
+  size_t next{0};
+  for (auto const& launch : launches) {
+    ASSERT_EQ(launch.major_range_first, next);
+    ASSERT_TRUE(launch.major_range_last > launch.major_range_first);
+    ASSERT_TRUE(launch.num_blocks > 0);
+    next = launch.major_range_last;
+  }
+  ASSERT_EQ(next, major_range_size);
+}
+
+}  // namespace
+
+class Tests_KernelDispatch : public ::testing::Test {
+ public:
+  Tests_KernelDispatch() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp()
+  {
+    cugraph::experimental::set_pattern_kernel_autotune(false);
+    cugraph::experimental::clear_pattern_kernel_tuning_table();
+  }
+  virtual void TearDown()
+  {
+    cugraph::experimental::set_pattern_kernel_autotune(false);
+    cugraph::experimental::clear_pattern_kernel_tuning_table();
+  }
+};
+
+TEST_F(Tests_KernelDispatch, DefaultMapping)
+{
+  using namespace cugraph::experimental;
+
+  raft::handle_t handle{};
+
+  // high, mid, and low-degree segments (the second one empty)
+  std::vector<int32_t> segment_offsets{0, 10, 10, 1000};
+  auto launches = detail::get_pattern_kernel_launches(handle,
+                                                      pattern_kernel_t::copy_v_transform_reduce_nbr,
+                                                      int32_t{128},
+                                                      int32_t{1000},
+                                                      size_t{20000},
+                                                      segment_offsets,
+                                                      true);
+  check_coverage(launches, 1000);
+  ASSERT_EQ(launches.size(), size_t{2});
+  ASSERT_TRUE(launches[0].mapping == major_mapping_t::block_per_major);
+  ASSERT_TRUE(launches[1].mapping == major_mapping_t::thread_per_major);
+  for (auto const& launch : launches) {
+    ASSERT_EQ(launch.candidate_idx, int32_t{-1}) << "Launches should not be timed by default.";
+  }
+
+  // patterns with only a thread-per-major kernel get one launch for an unsegmented range
+  launches = detail::get_pattern_kernel_launches(handle,
+                                                 pattern_kernel_t::count_if_e,
+                                                 int32_t{128},
+                                                 int32_t{1 << 20},
+                                                 size_t{1 << 24},
+                                                 std::vector<int32_t>{},
+                                                 false);
+  check_coverage(launches, size_t{1} << 20);
+  ASSERT_EQ(launches.size(), size_t{1});
+  ASSERT_TRUE(launches[0].mapping == major_mapping_t::thread_per_major);
+  ASSERT_TRUE(launches[0].num_blocks < (1 << 20) / 128)
+    << "The grid size for reduction patterns should be capped.";
+}
+
+TEST_F(Tests_KernelDispatch, AutotuneRecordSaveLoad)
+{
+  using namespace cugraph::experimental;
+
+  raft::handle_t handle{};
+
+  std::vector<int32_t> segment_offsets{0, 100, 5000, 100000};
+  auto get_launches = [&handle, &segment_offsets]() {
+    return detail::get_pattern_kernel_launches(handle,
+                                               pattern_kernel_t::copy_v_transform_reduce_nbr,
+                                               int32_t{128},
+                                               int32_t{100000},
+                                               size_t{2000000},
+                                               segment_offsets,
+                                               true);
+  };
+
+  // time the (empty) launch windows until every candidate of every segment is measured
+
+  set_pattern_kernel_autotune(true);
+  ASSERT_TRUE(is_pattern_kernel_autotune_enabled());
+  size_t num_timed_calls{0};
+  while (true) {
+    auto launches = get_launches();
+    check_coverage(launches, 100000);
+    bool timed{false};
+    for (auto const& launch : launches) {
+      detail::pattern_kernel_timer_t timer(handle, launch);
+      timer.stop();
+      timed = timed || (launch.candidate_idx >= 0);
+    }
+    if (!timed) { break; }
+    ASSERT_TRUE(++num_timed_calls < 1000) << "Autotuning should terminate.";
+  }
+  ASSERT_TRUE(num_timed_calls > 0);
+  set_pattern_kernel_autotune(false);
+
+  auto tuned_launches = get_launches();
+
+  // the recorded choices should survive a save/clear/load round trip
+
+  auto path = std::string("kernel_dispatch_test_tuning_table.txt");
+  save_pattern_kernel_tuning_table(path);
+  clear_pattern_kernel_tuning_table();
+  load_pattern_kernel_tuning_table(path);
+  std::remove(path.c_str());
+
+  auto loaded_launches = get_launches();
+  ASSERT_EQ(tuned_launches.size(), loaded_launches.size());
+  for (size_t i = 0; i < tuned_launches.size(); ++i) {
+    ASSERT_TRUE(tuned_launches[i].mapping == loaded_launches[i].mapping);
+    ASSERT_EQ(tuned_launches[i].num_blocks, loaded_launches[i].num_blocks);
+    ASSERT_EQ(loaded_launches[i].candidate_idx, int32_t{-1});
+  }
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -38,10 +38,19 @@ typedef struct BFS_Usecase_t {
   cugraph::test::input_graph_specifier_t input_graph_specifier{};
 
   size_t source{0};
+  bool direction_optimizing{false};
   bool check_correctness{false};
+  bool edge_balanced{false};  // supported only for matrix market files
 
-  BFS_Usecase_t(std::string const& graph_file_path, size_t source, bool check_correctness = true)
-    : source(source), check_correctness(check_correctness)
+  BFS_Usecase_t(std::string const& graph_file_path,
+                size_t source,
+                bool direction_optimizing = false,
+                bool check_correctness    = true,
+                bool edge_balanced        = false)
+    : source(source),
+      direction_optimizing(direction_optimizing),
+      check_correctness(check_correctness),
+      edge_balanced(edge_balanced)
   {
     std::string graph_file_full_path{};
     if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
@@ -55,8 +64,11 @@ typedef struct BFS_Usecase_t {
 
   BFS_Usecase_t(cugraph::test::rmat_params_t rmat_params,
                 size_t source,
-                bool check_correctness = true)
-    : source(source), check_correctness(check_correctness)
+                bool direction_optimizing = false,
+                bool check_correctness    = true)
+    : source(source),
+      direction_optimizing(direction_optimizing),
+      check_correctness(check_correctness)
   {
     input_graph_specifier.tag         = cugraph::test::input_graph_specifier_t::RMAT_PARAMS;
     input_graph_specifier.rmat_params = rmat_params;
@@ -81,7 +93,11 @@ read_graph(raft::handle_t const& handle, BFS_Usecase const& configuration, bool
              cugraph::test::input_graph_specifier_t::MATRIX_MARKET_FILE_PATH
            ? cugraph::test::
                read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, multi_gpu>(
-                 handle, configuration.input_graph_specifier.graph_file_full_path, false, renumber)
+                 handle,
+                 configuration.input_graph_specifier.graph_file_full_path,
+                 false,
+                 renumber,
+                 multi_gpu && configuration.edge_balanced)
            : cugraph::test::
                generate_graph_from_rmat_params<vertex_t, edge_t, weight_t, false, multi_gpu>(
                  handle,
@@ -137,6 +153,9 @@ class Tests_MGBFS : public ::testing::TestWithParam<BFS_Usecase> {
 
     auto mg_graph_view = mg_graph.view();
 
+    ASSERT_GE(mg_graph_view.compute_edge_partition_imbalance(handle), 1.0)
+      << "The maximum number of local edges should not be smaller than the mean.";
+
     ASSERT_TRUE(static_cast<vertex_t>(configuration.source) >= 0 &&
                 static_cast<vertex_t>(configuration.source) <
                   mg_graph_view.get_number_of_vertices())
@@ -156,7 +175,7 @@ class Tests_MGBFS : public ::testing::TestWithParam<BFS_Usecase> {
                                d_mg_distances.data(),
                                d_mg_predecessors.data(),
                                static_cast<vertex_t>(configuration.source),
-                               false,
+                               configuration.direction_optimizing,
                                std::numeric_limits<vertex_t>::max(),
                                true);
 
@@ -294,10 +313,17 @@ INSTANTIATE_TEST_CASE_P(
     BFS_Usecase("test/datasets/web-Google.mtx", 0),
     BFS_Usecase("test/datasets/ljournal-2008.mtx", 0),
     BFS_Usecase("test/datasets/webbase-1M.mtx", 0),
+    // hub vertices assigned to GPUs to balance the edge counts
+    BFS_Usecase("test/datasets/karate.mtx", 0, false, true, true),
+    BFS_Usecase("test/datasets/web-Google.mtx", 0, false, true, true),
     BFS_Usecase(cugraph::test::rmat_params_t{10, 16, 0.57, 0.19, 0.19, 0, false, false}, 0),
+    // direction optimizing BFS (requires symmetric input graphs)
+    BFS_Usecase("test/datasets/karate.mtx", 0, true),
+    BFS_Usecase(cugraph::test::rmat_params_t{10, 16, 0.57, 0.19, 0.19, 0, true, false}, 0, true),
     // disable correctness checks for large graphs
     BFS_Usecase(cugraph::test::rmat_params_t{20, 32, 0.57, 0.19, 0.19, 0, false, false},
                 0,
+                false,
                 false)));
 
 CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <experimental/graph.hpp>
+#include <experimental/graph_generator.hpp>
+#include <experimental/graph_view.hpp>
+#include <partition_manager.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+typedef struct GenerateRmatGraph_Usecase_t {
+  size_t scale{0};
+  size_t edge_factor{0};
+  bool scramble_vertex_ids{false};
+  bool generate_weights{false};
+
+  GenerateRmatGraph_Usecase_t(size_t scale,
+                              size_t edge_factor,
+                              bool scramble_vertex_ids,
+                              bool generate_weights)
+    : scale(scale),
+      edge_factor(edge_factor),
+      scramble_vertex_ids(scramble_vertex_ids),
+      generate_weights(generate_weights){};
+} GenerateRmatGraph_Usecase;
+
+class Tests_MGGenerateRmatGraph : public ::testing::TestWithParam<GenerateRmatGraph_Usecase> {
+ public:
+  Tests_MGGenerateRmatGraph() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Check that the GPUs together generate the requested number of edges, every GPU generates only
+  // the edges of its local adjacency matrix partitions (this is checked by the graph constructor
+  // with do_expensive_check = true), and the scrambled vertex IDs form a permutation
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(GenerateRmatGraph_Usecase const& configuration)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+    auto const comm_rank = comm.get_rank();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) { --row_comm_size; }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    if ((comm_size & (comm_size - 1)) != 0) { return; }  // requires a power of two GPUs
+
+    // 2. generate an MG graph
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, store_transposed, true> mg_graph(
+      handle);
+    rmm::device_uvector<vertex_t> d_mg_labels(0, handle.get_stream());
+    std::tie(mg_graph, d_mg_labels) = cugraph::experimental::
+      generate_rmat_graph<vertex_t, edge_t, weight_t, store_transposed, true>(
+        handle,
+        configuration.scale,
+        configuration.edge_factor,
+        0.57,
+        0.19,
+        0.19,
+        uint64_t{0},
+        configuration.scramble_vertex_ids,
+        configuration.generate_weights,
+        true);
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    auto mg_graph_view = mg_graph.view();
+
+    // 3. check the number of edges and vertices
+
+    auto number_of_vertices = vertex_t{1} << configuration.scale;
+    auto number_of_edges    = static_cast<edge_t>(number_of_vertices * configuration.edge_factor);
+
+    ASSERT_EQ(mg_graph_view.get_number_of_vertices(), number_of_vertices);
+    ASSERT_EQ(mg_graph_view.get_number_of_edges(), number_of_edges);
+    ASSERT_EQ(mg_graph_view.is_weighted(), configuration.generate_weights);
+
+    int64_t local_number_of_edges{0};
+    for (size_t i = 0; i < mg_graph_view.get_number_of_local_adj_matrix_partitions(); ++i) {
+      local_number_of_edges += mg_graph_view.get_number_of_local_adj_matrix_partition_edges(i);
+    }
+    int64_t aggregate_number_of_edges{0};
+    MPI_Allreduce(&local_number_of_edges,
+                  &aggregate_number_of_edges,
+                  1,
+                  MPI_INT64_T,
+                  MPI_SUM,
+                  MPI_COMM_WORLD);
+    ASSERT_EQ(aggregate_number_of_edges, static_cast<int64_t>(number_of_edges))
+      << "The GPUs should generate the requested number of edges in total.";
+
+    // 4. check that the scrambled vertex IDs form a permutation of [0, V)
+
+    if (configuration.scramble_vertex_ids) {
+      ASSERT_EQ(d_mg_labels.size(),
+                static_cast<size_t>(mg_graph_view.get_number_of_local_vertices()));
+
+      std::vector<vertex_t> h_mg_labels(d_mg_labels.size());
+      raft::update_host(
+        h_mg_labels.data(), d_mg_labels.data(), d_mg_labels.size(), handle.get_stream());
+      CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+      std::vector<int64_t> h_local_labels(h_mg_labels.begin(), h_mg_labels.end());
+      std::vector<int> rx_counts(comm_rank == 0 ? comm_size : 0);
+      auto tx_count = static_cast<int>(h_local_labels.size());
+      MPI_Gather(&tx_count, 1, MPI_INT, rx_counts.data(), 1, MPI_INT, 0, MPI_COMM_WORLD);
+      std::vector<int> rx_displs(rx_counts.size(), 0);
+      if (comm_rank == 0) {
+        std::partial_sum(rx_counts.begin(), rx_counts.end() - 1, rx_displs.begin() + 1);
+      }
+      std::vector<int64_t> h_aggregate_labels(
+        comm_rank == 0 ? static_cast<size_t>(number_of_vertices) : size_t{0});
+      MPI_Gatherv(h_local_labels.data(),
+                  tx_count,
+                  MPI_INT64_T,
+                  h_aggregate_labels.data(),
+                  rx_counts.data(),
+                  rx_displs.data(),
+                  MPI_INT64_T,
+                  0,
+                  MPI_COMM_WORLD);
+
+      if (comm_rank == 0) {
+        std::sort(h_aggregate_labels.begin(), h_aggregate_labels.end());
+        std::vector<int64_t> h_expected_labels(h_aggregate_labels.size());
+        std::iota(h_expected_labels.begin(), h_expected_labels.end(), int64_t{0});
+        ASSERT_TRUE(h_aggregate_labels == h_expected_labels)
+          << "Scrambled vertex IDs should form a permutation of [0, V).";
+      }
+    } else {
+      ASSERT_EQ(d_mg_labels.size(), size_t{0});
+    }
+  }
+};
+
+TEST_P(Tests_MGGenerateRmatGraph, CheckStoreTransposedFalse)
+{
+  run_current_test<int32_t, int32_t, float, false>(GetParam());
+  run_current_test<int64_t, int64_t, double, false>(GetParam());
+}
+
+TEST_P(Tests_MGGenerateRmatGraph, CheckStoreTransposedTrue)
+{
+  run_current_test<int32_t, int32_t, float, true>(GetParam());
+  run_current_test<int64_t, int64_t, double, true>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(simple_test,
+                        Tests_MGGenerateRmatGraph,
+                        ::testing::Values(GenerateRmatGraph_Usecase(10, 16, false, false),
+                                          GenerateRmatGraph_Usecase(10, 16, true, true),
+                                          GenerateRmatGraph_Usecase(16, 32, true, false),
+                                          GenerateRmatGraph_Usecase(20, 16, false, true)));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_functions.hpp>
+#include <experimental/graph_view.hpp>
+#include <partition_manager.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+typedef struct RandomWalks_Usecase_t {
+  std::string graph_file_full_path{};
+  size_t num_paths{10};
+  size_t max_depth{10};
+
+  RandomWalks_Usecase_t(std::string const& graph_file_path, size_t num_paths, size_t max_depth)
+    : num_paths(num_paths), max_depth(max_depth)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} RandomWalks_Usecase;
+
+class Tests_MGRandomWalks : public ::testing::TestWithParam<RandomWalks_Usecase> {
+ public:
+  Tests_MGRandomWalks() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Check that the paths generated on multiple GPUs are valid paths of the (unrenumbered) graph
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(RandomWalks_Usecase const& configuration)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+    auto const comm_rank = comm.get_rank();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) { --row_comm_size; }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG graph
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, true> mg_graph(handle);
+    rmm::device_uvector<vertex_t> d_mg_renumber_map_labels(0, handle.get_stream());
+    std::tie(mg_graph, d_mg_renumber_map_labels) =
+      cugraph::test::read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, true>(
+        handle, configuration.graph_file_full_path, false, true);
+    auto mg_graph_view = mg_graph.view();
+
+    // 3. run MG random walks (paths started on every GPU, not necessarily from local vertices)
+
+    auto num_paths = static_cast<edge_t>(configuration.num_paths);
+    auto max_depth = static_cast<edge_t>(configuration.max_depth);
+
+    std::vector<vertex_t> h_start(num_paths);
+    for (edge_t i = 0; i < num_paths; ++i) {
+      h_start[i] = static_cast<vertex_t>((comm_rank * num_paths + i) %
+                                         mg_graph_view.get_number_of_vertices());
+    }
+    rmm::device_uvector<vertex_t> d_start(h_start.size(), handle.get_stream());
+    raft::update_device(d_start.data(), h_start.data(), h_start.size(), handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    auto ret_triplet = cugraph::experimental::random_walks(
+      handle, mg_graph_view, d_start.data(), num_paths, max_depth);
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    auto& d_coalesced_v = std::get<0>(ret_triplet);
+    auto& d_coalesced_w = std::get<1>(ret_triplet);
+    auto& d_sizes       = std::get<2>(ret_triplet);
+
+    // 4. check the paths on the SG graph
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, false> sg_graph(handle);
+    std::tie(sg_graph, std::ignore) =
+      cugraph::test::read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, false>(
+        handle, configuration.graph_file_full_path, false, false);
+    auto sg_graph_view = sg_graph.view();
+
+    std::vector<vertex_t> vertex_partition_lasts(comm_size);
+    for (size_t i = 0; i < vertex_partition_lasts.size(); ++i) {
+      vertex_partition_lasts[i] = mg_graph_view.get_vertex_partition_last(i);
+    }
+    cugraph::experimental::renumber_map_t<vertex_t, true> renumber_map(
+      handle,
+      std::move(d_mg_renumber_map_labels),
+      mg_graph_view.get_local_vertex_first(),
+      mg_graph_view.get_local_vertex_last(),
+      vertex_partition_lasts,
+      true);
+    renumber_map.unrenumber_int_vertices(handle, d_coalesced_v.data(), d_coalesced_v.size(), true);
+
+    rmm::device_uvector<vertex_t> d_int_start(d_start.size(), handle.get_stream());
+    raft::copy(d_int_start.data(), d_start.data(), d_start.size(), handle.get_stream());
+    renumber_map.unrenumber_int_vertices(handle, d_start.data(), d_start.size(), true);
+
+    // the persistent renumber map should renumber the external vertices back
+    rmm::device_uvector<vertex_t> d_renumbered_start(d_start.size(), handle.get_stream());
+    raft::copy(d_renumbered_start.data(), d_start.data(), d_start.size(), handle.get_stream());
+    renumber_map.renumber_ext_vertices(
+      handle, d_renumbered_start.data(), d_renumbered_start.size(), true);
+    std::vector<vertex_t> h_int_start(d_int_start.size());
+    std::vector<vertex_t> h_renumbered_start(d_renumbered_start.size());
+    raft::update_host(
+      h_int_start.data(), d_int_start.data(), d_int_start.size(), handle.get_stream());
+    raft::update_host(h_renumbered_start.data(),
+                      d_renumbered_start.data(),
+                      d_renumbered_start.size(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+    ASSERT_TRUE(h_int_start == h_renumbered_start)
+      << "Renumbering unrenumbered vertices does not restore the internal vertices.";
+
+    std::vector<edge_t> h_sg_offsets(sg_graph_view.get_number_of_vertices() + 1);
+    std::vector<vertex_t> h_sg_indices(sg_graph_view.get_number_of_edges());
+    raft::update_host(h_sg_offsets.data(),
+                      sg_graph_view.offsets(),
+                      sg_graph_view.get_number_of_vertices() + 1,
+                      handle.get_stream());
+    raft::update_host(h_sg_indices.data(),
+                      sg_graph_view.indices(),
+                      sg_graph_view.get_number_of_edges(),
+                      handle.get_stream());
+
+    std::vector<vertex_t> h_coalesced_v(d_coalesced_v.size());
+    std::vector<edge_t> h_sizes(d_sizes.size());
+    raft::update_host(
+      h_coalesced_v.data(), d_coalesced_v.data(), d_coalesced_v.size(), handle.get_stream());
+    raft::update_host(h_sizes.data(), d_sizes.data(), d_sizes.size(), handle.get_stream());
+    raft::update_host(h_start.data(), d_start.data(), d_start.size(), handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    ASSERT_EQ(h_sizes.size(), static_cast<size_t>(num_paths)) << "Invalid number of paths.";
+    ASSERT_EQ(static_cast<size_t>(std::accumulate(h_sizes.begin(), h_sizes.end(), edge_t{0})),
+              h_coalesced_v.size())
+      << "Path sizes do not match with the coalesced vertex set size.";
+    ASSERT_EQ(d_coalesced_w.size(), h_coalesced_v.size() - h_sizes.size())
+      << "Invalid coalesced weight set size.";
+
+    size_t offset{0};
+    for (edge_t i = 0; i < num_paths; ++i) {
+      ASSERT_TRUE((h_sizes[i] >= 1) && (h_sizes[i] <= max_depth)) << "Invalid path size.";
+      ASSERT_EQ(h_coalesced_v[offset], h_start[i]) << "Invalid starting vertex.";
+      for (edge_t j = 1; j < h_sizes[i]; ++j) {
+        auto src = h_coalesced_v[offset + j - 1];
+        auto dst = h_coalesced_v[offset + j];
+        ASSERT_TRUE(std::find(h_sg_indices.begin() + h_sg_offsets[src],
+                              h_sg_indices.begin() + h_sg_offsets[src + 1],
+                              dst) != h_sg_indices.begin() + h_sg_offsets[src + 1])
+          << "no edge between consecutive path vertices.";
+      }
+      if (h_sizes[i] < max_depth) {
+        auto last = h_coalesced_v[offset + h_sizes[i] - 1];
+        ASSERT_EQ(h_sg_offsets[last + 1], h_sg_offsets[last])
+          << "a path shorter than max_depth should end at a sink.";
+      }
+      offset += h_sizes[i];
+    }
+  }
+};
+
+TEST_P(Tests_MGRandomWalks, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_MGRandomWalks,
+  ::testing::Values(RandomWalks_Usecase("test/datasets/karate.mtx", 10, 10),
+                    RandomWalks_Usecase("test/datasets/web-Google.mtx", 100, 20),
+                    RandomWalks_Usecase("test/datasets/webbase-1M.mtx", 100, 20)));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
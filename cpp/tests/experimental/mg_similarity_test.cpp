@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "similarity_utils.hpp"
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_functions.hpp>
+#include <experimental/graph_view.hpp>
+#include <partition_manager.hpp>
+
+#include <raft/comms/comms.hpp>
+#include <raft/comms/mpi_comms.hpp>
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+typedef struct Similarity_Usecase_t {
+  std::string graph_file_full_path{};
+
+  Similarity_Usecase_t(std::string const& graph_file_path)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} Similarity_Usecase;
+
+class Tests_MGSimilarity : public ::testing::TestWithParam<Similarity_Usecase> {
+ public:
+  Tests_MGSimilarity() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Compare the results of computing the similarity coefficients of each GPU's own vertex pairs on
+  // multiple GPUs to the reference values computed on the host (from the single-GPU graph)
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(Similarity_Usecase const& configuration)
+  {
+    // 1. initialize handle
+
+    raft::handle_t handle{};
+
+    raft::comms::initialize_mpi_comms(&handle, MPI_COMM_WORLD);
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+    auto const comm_rank = comm.get_rank();
+
+    auto row_comm_size = static_cast<int>(sqrt(static_cast<double>(comm_size)));
+    while (comm_size % row_comm_size != 0) { --row_comm_size; }
+    cugraph::partition_2d::subcomm_factory_t<cugraph::partition_2d::key_naming_t, vertex_t>
+      subcomm_factory(handle, row_comm_size);
+
+    // 2. create MG & SG graphs
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, true> mg_graph(handle);
+    rmm::device_uvector<vertex_t> d_mg_renumber_map_labels(0, handle.get_stream());
+    std::tie(mg_graph, d_mg_renumber_map_labels) =
+      cugraph::test::read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, true>(
+        handle, configuration.graph_file_full_path, false, true);
+    auto mg_graph_view = mg_graph.view();
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, false> sg_graph(handle);
+    std::tie(sg_graph, std::ignore) =
+      cugraph::test::read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, false>(
+        handle, configuration.graph_file_full_path, false, false);
+    auto sg_graph_view = sg_graph.view();
+
+    std::vector<edge_t> h_sg_offsets(sg_graph_view.get_number_of_vertices() + 1);
+    std::vector<vertex_t> h_sg_indices(sg_graph_view.get_number_of_edges());
+    raft::update_host(h_sg_offsets.data(),
+                      sg_graph_view.offsets(),
+                      sg_graph_view.get_number_of_vertices() + 1,
+                      handle.get_stream());
+    raft::update_host(h_sg_indices.data(),
+                      sg_graph_view.indices(),
+                      sg_graph_view.get_number_of_edges(),
+                      handle.get_stream());
+    handle.get_stream_view().synchronize();
+
+    auto neighbors = cugraph::test::neighbor_sets(h_sg_offsets, h_sg_indices);
+
+    // 3. generate this GPU's vertex pairs (in the external vertex IDs) and renumber them
+
+    std::vector<vertex_t> h_firsts{};
+    std::vector<vertex_t> h_seconds{};
+    std::tie(h_firsts, h_seconds) =
+      cugraph::test::similarity_test_pairs(neighbors,
+                                           size_t{1000},
+                                           comm_rank == 0 ? size_t{16} : size_t{0},
+                                           static_cast<uint64_t>(comm_rank));
+
+    rmm::device_uvector<vertex_t> d_mg_firsts(h_firsts.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_mg_seconds(h_seconds.size(), handle.get_stream());
+    raft::update_device(d_mg_firsts.data(), h_firsts.data(), h_firsts.size(), handle.get_stream());
+    raft::update_device(
+      d_mg_seconds.data(), h_seconds.data(), h_seconds.size(), handle.get_stream());
+    for (auto vertices : {d_mg_firsts.data(), d_mg_seconds.data()}) {
+      cugraph::experimental::renumber_ext_vertices<vertex_t, true>(
+        handle,
+        vertices,
+        h_firsts.size(),
+        d_mg_renumber_map_labels.data(),
+        mg_graph_view.get_local_vertex_first(),
+        mg_graph_view.get_local_vertex_last());
+    }
+
+    for (auto coefficient : {cugraph::test::similarity_coefficient_t::jaccard,
+                             cugraph::test::similarity_coefficient_t::overlap,
+                             cugraph::test::similarity_coefficient_t::sorensen}) {
+      auto name = cugraph::test::similarity_coefficient_name(coefficient);
+
+      // 4. run MG similarity
+
+      rmm::device_uvector<weight_t> d_mg_coefficients(h_firsts.size(), handle.get_stream());
+
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+      switch (coefficient) {
+        case cugraph::test::similarity_coefficient_t::jaccard:
+          cugraph::experimental::jaccard_coefficients(handle,
+                                                      mg_graph_view,
+                                                      d_mg_firsts.data(),
+                                                      d_mg_seconds.data(),
+                                                      h_firsts.size(),
+                                                      d_mg_coefficients.data());
+          break;
+        case cugraph::test::similarity_coefficient_t::overlap:
+          cugraph::experimental::overlap_coefficients(handle,
+                                                      mg_graph_view,
+                                                      d_mg_firsts.data(),
+                                                      d_mg_seconds.data(),
+                                                      h_firsts.size(),
+                                                      d_mg_coefficients.data());
+          break;
+        case cugraph::test::similarity_coefficient_t::sorensen:
+          cugraph::experimental::sorensen_coefficients(handle,
+                                                       mg_graph_view,
+                                                       d_mg_firsts.data(),
+                                                       d_mg_seconds.data(),
+                                                       h_firsts.size(),
+                                                       d_mg_coefficients.data());
+          break;
+      }
+
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+      // 5. compare with the reference values
+
+      std::vector<weight_t> h_mg_coefficients(h_firsts.size());
+      raft::update_host(h_mg_coefficients.data(),
+                        d_mg_coefficients.data(),
+                        d_mg_coefficients.size(),
+                        handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      for (size_t i = 0; i < h_firsts.size(); ++i) {
+        auto reference = cugraph::test::similarity_reference<vertex_t, weight_t>(
+          neighbors, coefficient, h_firsts[i], h_seconds[i]);
+        ASSERT_TRUE(cugraph::test::similarity_nearly_equal(h_mg_coefficients[i], reference))
+          << "MG " << name << " coefficient of (" << h_firsts[i] << ", " << h_seconds[i]
+          << ") in rank: " << comm_rank << " has value: " << h_mg_coefficients[i]
+          << " different from the reference value: " << reference;
+      }
+    }
+  }
+};
+
+TEST_P(Tests_MGSimilarity, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam());
+}
+
+TEST_P(Tests_MGSimilarity, CheckInt64Int64Double)
+{
+  run_current_test<int64_t, int64_t, double>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(simple_test,
+                        Tests_MGSimilarity,
+                        ::testing::Values(Similarity_Usecase("test/datasets/karate.mtx"),
+                                          Similarity_Usecase("test/datasets/netscience.mtx"),
+                                          Similarity_Usecase("test/datasets/web-Google.mtx")));
+
+CUGRAPH_MG_TEST_PROGRAM_MAIN()
@@ -38,10 +38,14 @@ typedef struct SSSP_Usecase_t {
   cugraph::test::input_graph_specifier_t input_graph_specifier{};
 
   size_t source{0};
+  bool adaptive_delta{false};
   bool check_correctness{false};
 
-  SSSP_Usecase_t(std::string const& graph_file_path, size_t source, bool check_correctness = true)
-    : source(source), check_correctness(check_correctness)
+  SSSP_Usecase_t(std::string const& graph_file_path,
+                 size_t source,
+                 bool adaptive_delta    = false,
+                 bool check_correctness = true)
+    : source(source), adaptive_delta(adaptive_delta), check_correctness(check_correctness)
   {
     std::string graph_file_full_path{};
     if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
@@ -55,8 +59,9 @@ typedef struct SSSP_Usecase_t {
 
   SSSP_Usecase_t(cugraph::test::rmat_params_t rmat_params,
                  size_t source,
+                 bool adaptive_delta    = false,
                  bool check_correctness = true)
-    : source(source), check_correctness(check_correctness)
+    : source(source), adaptive_delta(adaptive_delta), check_correctness(check_correctness)
   {
     input_graph_specifier.tag         = cugraph::test::input_graph_specifier_t::RMAT_PARAMS;
     input_graph_specifier.rmat_params = rmat_params;
@@ -156,7 +161,8 @@ class Tests_MGSSSP : public ::testing::TestWithParam<SSSP_Usecase> {
                                 d_mg_predecessors.data(),
                                 static_cast<vertex_t>(configuration.source),
                                 std::numeric_limits<weight_t>::max(),
-                                true);
+                                true,
+                                configuration.adaptive_delta);
 
     CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
 
@@ -203,7 +209,8 @@ class Tests_MGSSSP : public ::testing::TestWithParam<SSSP_Usecase> {
                                   d_sg_predecessors.data(),
                                   unrenumbered_source,
                                   std::numeric_limits<weight_t>::max(),
-                                  true);
+                                  true,
+                                  false);
 
       // 5-3. compare
 
@@ -306,9 +313,19 @@ INSTANTIATE_TEST_CASE_P(
     SSSP_Usecase("test/datasets/dblp.mtx", 0),
     SSSP_Usecase("test/datasets/wiki2003.mtx", 1000),
     SSSP_Usecase(cugraph::test::rmat_params_t{10, 16, 0.57, 0.19, 0.19, 0, false, false}, 0),
+    // adaptive delta
+    SSSP_Usecase("test/datasets/karate.mtx", 0, true),
+    SSSP_Usecase("test/datasets/dblp.mtx", 0, true),
+    SSSP_Usecase("test/datasets/wiki2003.mtx", 1000, true),
+    SSSP_Usecase(cugraph::test::rmat_params_t{10, 16, 0.57, 0.19, 0.19, 0, false, false}, 0, true),
     // disable correctness checks for large graphs
     SSSP_Usecase(cugraph::test::rmat_params_t{20, 32, 0.57, 0.19, 0.19, 0, false, false},
                  0,
+                 false,
+                 false),
+    SSSP_Usecase(cugraph::test::rmat_params_t{20, 32, 0.57, 0.19, 0.19, 0, false, false},
+                 0,
+                 true,
                  false)));
 
 CUGRAPH_MG_TEST_PROGRAM_MAIN()
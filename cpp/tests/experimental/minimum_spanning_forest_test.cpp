@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+template <typename vertex_t>
+vertex_t find_root(std::vector<vertex_t>& parents, vertex_t v)
+{
+  while (parents[v] != v) {
+    parents[v] = parents[parents[v]];
+    v          = parents[v];
+  }
+  return v;
+}
+
+// Kruskal's algorithm, returns the number of edges and the total weight of the forest
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<size_t, double> minimum_spanning_forest_reference(edge_t const* offsets,
+                                                             vertex_t const* indices,
+                                                             weight_t const* weights,
+                                                             vertex_t num_vertices)
+{
+  std::vector<std::tuple<weight_t, vertex_t, vertex_t>> edges{};
+  for (vertex_t u = 0; u < num_vertices; ++u) {
+    for (auto i = offsets[u]; i < offsets[u + 1]; ++i) {
+      if (u < indices[i]) { edges.push_back(std::make_tuple(weights[i], u, indices[i])); }
+    }
+  }
+  std::sort(edges.begin(), edges.end());
+
+  std::vector<vertex_t> parents(num_vertices);
+  std::iota(parents.begin(), parents.end(), vertex_t{0});
+  size_t num_forest_edges{0};
+  double forest_weight{0.0};
+  for (auto const& e : edges) {
+    auto u_root = find_root(parents, std::get<1>(e));
+    auto v_root = find_root(parents, std::get<2>(e));
+    if (u_root != v_root) {
+      parents[std::max(u_root, v_root)] = std::min(u_root, v_root);
+      ++num_forest_edges;
+      forest_weight += static_cast<double>(std::get<0>(e));
+    }
+  }
+
+  return std::make_tuple(num_forest_edges, forest_weight);
+}
+
+typedef struct MinimumSpanningForest_Usecase_t {
+  std::string graph_file_full_path{};
+
+  MinimumSpanningForest_Usecase_t(std::string const& graph_file_path)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} MinimumSpanningForest_Usecase;
+
+class Tests_MinimumSpanningForest
+  : public ::testing::TestWithParam<MinimumSpanningForest_Usecase> {
+ public:
+  Tests_MinimumSpanningForest() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(MinimumSpanningForest_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, false> graph(handle);
+    std::tie(graph, std::ignore) = cugraph::test::
+      read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, false>(
+        handle, configuration.graph_file_full_path, true, false);
+    auto graph_view = graph.view();
+
+    std::vector<edge_t> h_offsets(graph_view.get_number_of_vertices() + 1);
+    std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+    std::vector<weight_t> h_weights(graph_view.get_number_of_edges());
+    raft::update_host(h_offsets.data(),
+                      graph_view.offsets(),
+                      graph_view.get_number_of_vertices() + 1,
+                      handle.get_stream());
+    raft::update_host(h_indices.data(),
+                      graph_view.indices(),
+                      graph_view.get_number_of_edges(),
+                      handle.get_stream());
+    raft::update_host(h_weights.data(),
+                      graph_view.weights(),
+                      graph_view.get_number_of_edges(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    size_t reference_num_edges{};
+    double reference_weight{};
+    std::tie(reference_num_edges, reference_weight) = minimum_spanning_forest_reference(
+      h_offsets.data(), h_indices.data(), h_weights.data(), graph_view.get_number_of_vertices());
+
+    rmm::device_uvector<vertex_t> d_srcs(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_dsts(0, handle.get_stream());
+    rmm::device_uvector<weight_t> d_forest_weights(0, handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    std::tie(d_srcs, d_dsts, d_forest_weights) =
+      cugraph::experimental::minimum_spanning_forest(handle, graph_view);
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    std::vector<vertex_t> h_srcs(d_srcs.size());
+    std::vector<vertex_t> h_dsts(d_dsts.size());
+    std::vector<weight_t> h_forest_weights(d_forest_weights.size());
+    raft::update_host(h_srcs.data(), d_srcs.data(), d_srcs.size(), handle.get_stream());
+    raft::update_host(h_dsts.data(), d_dsts.data(), d_dsts.size(), handle.get_stream());
+    raft::update_host(h_forest_weights.data(),
+                      d_forest_weights.data(),
+                      d_forest_weights.size(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    ASSERT_EQ(h_srcs.size(), reference_num_edges)
+      << "The number of forest edges does not match with the reference value.";
+
+    // the returned edges should form a forest
+
+    std::vector<vertex_t> parents(graph_view.get_number_of_vertices());
+    std::iota(parents.begin(), parents.end(), vertex_t{0});
+    for (size_t i = 0; i < h_srcs.size(); ++i) {
+      ASSERT_LT(h_srcs[i], h_dsts[i]) << "Forest edges should have source < destination.";
+      auto u_root = find_root(parents, h_srcs[i]);
+      auto v_root = find_root(parents, h_dsts[i]);
+      ASSERT_NE(u_root, v_root) << "The returned edges form a cycle.";
+      parents[std::max(u_root, v_root)] = std::min(u_root, v_root);
+    }
+
+    auto forest_weight = std::accumulate(
+      h_forest_weights.begin(), h_forest_weights.end(), double{0.0}, [](auto lhs, auto rhs) {
+        return lhs + static_cast<double>(rhs);
+      });
+    ASSERT_TRUE(std::abs(forest_weight - reference_weight) <=
+                std::max(std::abs(reference_weight), 1.0) * 1e-5)
+      << "The forest weight (" << forest_weight << ") does not match with the reference value ("
+      << reference_weight << ").";
+  }
+};
+
+TEST_P(Tests_MinimumSpanningForest, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam());
+}
+
+TEST_P(Tests_MinimumSpanningForest, CheckInt64Int64Double)
+{
+  run_current_test<int64_t, int64_t, double>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_MinimumSpanningForest,
+  ::testing::Values(MinimumSpanningForest_Usecase("test/datasets/karate.mtx"),
+                    MinimumSpanningForest_Usecase("test/datasets/dolphins.mtx"),
+                    MinimumSpanningForest_Usecase("test/datasets/netscience.mtx")));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -145,6 +145,57 @@ class Tests_MsBfs : public ::testing::TestWithParam<MsBfs_Usecase> {
     cudaProfilerStop();
     hr_timer.stop();
     hr_timer.display(std::cout);
+
+    // batched (every edge is expanded once per iteration for all the seeds)
+    rmm::device_uvector<vertex_t> d_sources(n_seeds, handle.get_stream());
+    std::vector<vertex_t> h_sources(configuration.sources.begin(), configuration.sources.end());
+    raft::update_device(d_sources.data(), h_sources.data(), n_seeds, handle.get_stream());
+    auto max_radius = *std::max_element(radius.begin(), radius.end());
+
+    rmm::device_uvector<size_t> d_offsets(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_vertices(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_batched_distances(0, handle.get_stream());
+    hr_timer.start("multi_source_bfs");
+    cudaProfilerStart();
+    std::tie(d_offsets, d_vertices, d_batched_distances) = cugraph::experimental::multi_source_bfs(
+      handle, graph_view, d_sources.data(), n_seeds, max_radius);
+    cudaProfilerStop();
+    hr_timer.stop();
+    hr_timer.display(std::cout);
+
+    // vertices within radius[i] from the i'th seed should match with the one by one results
+    handle.wait_on_internal_streams();
+    std::vector<size_t> h_offsets(d_offsets.size());
+    std::vector<vertex_t> h_vertices(d_vertices.size());
+    std::vector<vertex_t> h_batched_distances(d_batched_distances.size());
+    raft::update_host(h_offsets.data(), d_offsets.data(), d_offsets.size(), handle.get_stream());
+    raft::update_host(h_vertices.data(), d_vertices.data(), d_vertices.size(), handle.get_stream());
+    raft::update_host(h_batched_distances.data(),
+                      d_batched_distances.data(),
+                      d_batched_distances.size(),
+                      handle.get_stream());
+    handle.get_stream_view().synchronize();
+    for (vertex_t i = 0; i < n_seeds; i++) {
+      std::vector<vertex_t> h_distances(graph_view.get_number_of_vertices());
+      raft::update_host(
+        h_distances.data(), d_distances[i].data(), d_distances[i].size(), handle.get_stream());
+      handle.get_stream_view().synchronize();
+
+      std::vector<std::tuple<vertex_t, vertex_t>> h_reference{};
+      for (vertex_t v = 0; v < graph_view.get_number_of_vertices(); ++v) {
+        if (h_distances[v] <= radius[i]) {
+          h_reference.push_back(std::make_tuple(v, h_distances[v]));
+        }
+      }
+      std::vector<std::tuple<vertex_t, vertex_t>> h_batched{};
+      for (auto j = h_offsets[i]; j < h_offsets[i + 1]; ++j) {
+        if (h_batched_distances[j] <= radius[i]) {
+          h_batched.push_back(std::make_tuple(h_vertices[j], h_batched_distances[j]));
+        }
+      }
+      ASSERT_TRUE(h_reference == h_batched)
+        << "multi_source_bfs results do not match with the bfs results.";
+    }
   }
 };
 
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <set>
+#include <tuple>
+#include <vector>
+
+typedef struct NeighborSample_Usecase_t {
+  std::string graph_file_full_path{};
+  std::vector<int> fan_out{};
+  size_t num_seeds{0};
+  bool weighted{false};
+
+  NeighborSample_Usecase_t(std::string const& graph_file_path,
+                           std::vector<int> const& fan_out,
+                           size_t num_seeds,
+                           bool weighted)
+    : fan_out(fan_out), num_seeds(num_seeds), weighted(weighted)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} NeighborSample_Usecase;
+
+class Tests_NeighborSample : public ::testing::TestWithParam<NeighborSample_Usecase> {
+ public:
+  Tests_NeighborSample() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(NeighborSample_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, false> graph(handle);
+    std::tie(graph, std::ignore) = cugraph::test::
+      read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, false>(
+        handle, configuration.graph_file_full_path, true, false);
+    auto graph_view = graph.view();
+
+    std::vector<edge_t> h_offsets(graph_view.get_number_of_vertices() + 1);
+    std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+    raft::update_host(h_offsets.data(),
+                      graph_view.offsets(),
+                      graph_view.get_number_of_vertices() + 1,
+                      handle.get_stream());
+    raft::update_host(h_indices.data(),
+                      graph_view.indices(),
+                      graph_view.get_number_of_edges(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    auto num_seeds = std::min(configuration.num_seeds,
+                              static_cast<size_t>(graph_view.get_number_of_vertices()));
+    std::vector<vertex_t> h_seeds(num_seeds);
+    for (size_t i = 0; i < num_seeds; ++i) {
+      h_seeds[i] = static_cast<vertex_t>((i * 7) % graph_view.get_number_of_vertices());
+    }
+    rmm::device_uvector<vertex_t> d_seeds(h_seeds.size(), handle.get_stream());
+    raft::update_device(d_seeds.data(), h_seeds.data(), h_seeds.size(), handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    auto hops = cugraph::experimental::neighbor_sample(handle,
+                                                       graph_view,
+                                                       d_seeds.data(),
+                                                       d_seeds.size(),
+                                                       configuration.fan_out,
+                                                       configuration.weighted,
+                                                       uint64_t{42});
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    ASSERT_EQ(hops.size(), configuration.fan_out.size()) << "Invalid number of hops.";
+
+    auto repeated_hops = cugraph::experimental::neighbor_sample(handle,
+                                                                graph_view,
+                                                                d_seeds.data(),
+                                                                d_seeds.size(),
+                                                                configuration.fan_out,
+                                                                configuration.weighted,
+                                                                uint64_t{42});
+
+    std::set<vertex_t> frontier(h_seeds.begin(), h_seeds.end());
+    for (size_t hop = 0; hop < hops.size(); ++hop) {
+      auto const& d_srcs = std::get<0>(hops[hop]);
+      auto const& d_dsts = std::get<1>(hops[hop]);
+      ASSERT_EQ(d_srcs.size(), d_dsts.size()) << "Invalid COO size.";
+      ASSERT_EQ(d_srcs.size(), std::get<2>(hops[hop]).size()) << "Invalid COO size.";
+
+      std::vector<vertex_t> h_srcs(d_srcs.size());
+      std::vector<vertex_t> h_dsts(d_dsts.size());
+      std::vector<vertex_t> h_repeated_dsts(std::get<1>(repeated_hops[hop]).size());
+      raft::update_host(h_srcs.data(), d_srcs.data(), d_srcs.size(), handle.get_stream());
+      raft::update_host(h_dsts.data(), d_dsts.data(), d_dsts.size(), handle.get_stream());
+      raft::update_host(h_repeated_dsts.data(),
+                        std::get<1>(repeated_hops[hop]).data(),
+                        h_repeated_dsts.size(),
+                        handle.get_stream());
+      CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+      ASSERT_TRUE(h_dsts == h_repeated_dsts) << "Samples are not reproducible for a given seed.";
+      ASSERT_TRUE(std::is_sorted(h_srcs.begin(), h_srcs.end()))
+        << "Sampled edges are not sorted by source.";
+
+      auto fan_out = configuration.fan_out[hop];
+      for (auto v : frontier) {
+        auto first    = std::lower_bound(h_srcs.begin(), h_srcs.end(), v);
+        auto last     = std::upper_bound(h_srcs.begin(), h_srcs.end(), v);
+        auto deg      = static_cast<size_t>(h_offsets[v + 1] - h_offsets[v]);
+        auto expected = fan_out < 0 ? deg : std::min(deg, static_cast<size_t>(fan_out));
+        ASSERT_EQ(static_cast<size_t>(std::distance(first, last)), expected)
+          << "Invalid number of sampled edges for a frontier vertex.";
+
+        std::vector<vertex_t> nbrs(h_indices.begin() + h_offsets[v],
+                                   h_indices.begin() + h_offsets[v + 1]);
+        std::vector<vertex_t> sampled(h_dsts.begin() + std::distance(h_srcs.begin(), first),
+                                      h_dsts.begin() + std::distance(h_srcs.begin(), last));
+        std::sort(nbrs.begin(), nbrs.end());
+        std::sort(sampled.begin(), sampled.end());
+        ASSERT_TRUE(std::includes(nbrs.begin(), nbrs.end(), sampled.begin(), sampled.end()))
+          << "Sampled edges should be distinct edges of the graph.";
+      }
+      ASSERT_TRUE(std::all_of(h_srcs.begin(),
+                              h_srcs.end(),
+                              [&frontier](auto v) { return frontier.count(v) > 0; }))
+        << "Sampled edge sources should be frontier vertices.";
+
+      frontier.insert(h_dsts.begin(), h_dsts.end());
+    }
+  }
+};
+
+TEST_P(Tests_NeighborSample, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam());
+}
+
+TEST_P(Tests_NeighborSample, CheckInt64Int64Float)
+{
+  run_current_test<int64_t, int64_t, float>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_NeighborSample,
+  ::testing::Values(
+    NeighborSample_Usecase("test/datasets/karate.mtx", std::vector<int>{3, 2}, 4, false),
+    NeighborSample_Usecase("test/datasets/karate.mtx", std::vector<int>{3, 2}, 4, true),
+    NeighborSample_Usecase("test/datasets/karate.mtx", std::vector<int>{-1}, 4, false),
+    NeighborSample_Usecase("test/datasets/dolphins.mtx", std::vector<int>{25, 10}, 8, true),
+    NeighborSample_Usecase("test/datasets/web-Google.mtx", std::vector<int>{25, 10}, 64, false),
+    NeighborSample_Usecase("test/datasets/web-Google.mtx", std::vector<int>{10, 5, 2}, 64, true)));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -136,14 +136,17 @@ typedef struct PageRank_Usecase_t {
   double personalization_ratio{0.0};
   bool test_weighted{false};
   bool check_correctness{false};
+  bool reduced_precision{false};  // bfloat16 adjacency matrix row values till close to convergence
 
   PageRank_Usecase_t(std::string const& graph_file_path,
                      double personalization_ratio,
                      bool test_weighted,
-                     bool check_correctness = true)
+                     bool check_correctness = true,
+                     bool reduced_precision = false)
     : personalization_ratio(personalization_ratio),
       test_weighted(test_weighted),
-      check_correctness(check_correctness)
+      check_correctness(check_correctness),
+      reduced_precision(reduced_precision)
   {
     std::string graph_file_full_path{};
     if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
@@ -284,7 +287,9 @@ class Tests_PageRank : public ::testing::TestWithParam<PageRank_Usecase> {
                                     epsilon,
                                     std::numeric_limits<size_t>::max(),
                                     false,
-                                    false);
+                                    false,
+                                    size_t{1},
+                                    configuration.reduced_precision);
 
     CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
 
@@ -429,10 +434,13 @@ INSTANTIATE_TEST_CASE_P(
     PageRank_Usecase("test/datasets/karate.mtx", 0.5, false),
     PageRank_Usecase("test/datasets/karate.mtx", 0.0, true),
     PageRank_Usecase("test/datasets/karate.mtx", 0.5, true),
+    PageRank_Usecase("test/datasets/karate.mtx", 0.0, false, true, true),
+    PageRank_Usecase("test/datasets/karate.mtx", 0.5, true, true, true),
     PageRank_Usecase("test/datasets/web-Google.mtx", 0.0, false),
     PageRank_Usecase("test/datasets/web-Google.mtx", 0.5, false),
     PageRank_Usecase("test/datasets/web-Google.mtx", 0.0, true),
     PageRank_Usecase("test/datasets/web-Google.mtx", 0.5, true),
+    PageRank_Usecase("test/datasets/web-Google.mtx", 0.0, false, true, true),
     PageRank_Usecase("test/datasets/ljournal-2008.mtx", 0.0, false),
     PageRank_Usecase("test/datasets/ljournal-2008.mtx", 0.5, false),
     PageRank_Usecase("test/datasets/ljournal-2008.mtx", 0.0, true),
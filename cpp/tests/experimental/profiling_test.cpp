@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+
+#include <utilities/profiling.hpp>
+
+#include <raft/handle.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+class Tests_Profiling : public ::testing::Test {
+ public:
+  Tests_Profiling() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() { cugraph::experimental::clear_profiling_report(); }
+  virtual void TearDown()
+  {
+    cugraph::experimental::set_profiling(false);
+    cugraph::experimental::clear_profiling_report();
+  }
+};
+
+TEST_F(Tests_Profiling, Disabled)
+{
+  using namespace cugraph::experimental;
+
+  raft::handle_t handle{};
+
+  set_profiling(false);
+  {
+    detail::profile_range_t range(handle, "outer");
+    detail::add_profile_counter("counter", 1);
+  }
+
+  auto report = get_profiling_report();
+  ASSERT_TRUE(report.ranges.empty());
+  ASSERT_TRUE(report.counters.empty());
+}
+
+TEST_F(Tests_Profiling, NestedRangesAndCounters)
+{
+  using namespace cugraph::experimental;
+
+  raft::handle_t handle{};
+
+  set_profiling(true);
+  {
+    detail::profile_range_t outer(handle, "outer");
+    for (int i = 0; i < 3; ++i) {
+      detail::profile_range_t inner(handle, "inner");
+      detail::add_profile_counter("counter", i + 1);
+    }
+    detail::add_profile_counter("iterations", 3);
+  }
+
+  auto report = get_profiling_report();
+
+  ASSERT_EQ(report.ranges.size(), size_t{2});
+  ASSERT_EQ(report.ranges[0].path, std::string("outer"));
+  ASSERT_EQ(report.ranges[0].num_calls, size_t{1});
+  ASSERT_EQ(report.ranges[1].path, std::string("outer/inner"));
+  ASSERT_EQ(report.ranges[1].num_calls, size_t{3});
+  ASSERT_TRUE(report.ranges[0].gpu_time_ms >= 0.0);
+
+  ASSERT_EQ(report.counters.size(), size_t{2});
+  ASSERT_EQ(report.counters[0].path, std::string("outer/inner/counter"));
+  ASSERT_EQ(report.counters[0].num_updates, size_t{3});
+  ASSERT_EQ(report.counters[0].sum, int64_t{6});
+  ASSERT_EQ(report.counters[0].max, int64_t{3});
+  ASSERT_EQ(report.counters[1].path, std::string("outer/iterations"));
+  ASSERT_EQ(report.counters[1].sum, int64_t{3});
+
+  auto json = report.to_json();
+  ASSERT_TRUE(json.find("\"path\": \"outer/inner\"") != std::string::npos);
+  ASSERT_TRUE(json.find("\"sum\": 6") != std::string::npos);
+
+  clear_profiling_report();
+  report = get_profiling_report();
+  ASSERT_TRUE(report.ranges.empty());
+  ASSERT_TRUE(report.counters.empty());
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -133,6 +133,67 @@ class Tests_RandomWalks : public ::testing::TestWithParam<RandomWalks_Usecase> {
       std::cout << "starting seed on failure: " << std::get<3>(ret_tuple) << '\n';
 
     ASSERT_TRUE(test_all_paths);
+
+    // biased (if weighted) and node2vec sampling policies:
+    //
+    std::vector<cugraph::experimental::random_walk_sampling_params_t> sampling_params{
+      {cugraph::experimental::random_walk_sampling_t::NODE2VEC, 0.5, 2.0},
+      {cugraph::experimental::random_walk_sampling_t::NODE2VEC, 4.0, 0.25}};
+    if (graph_view.is_weighted()) {
+      sampling_params.push_back({cugraph::experimental::random_walk_sampling_t::BIASED});
+    }
+
+    for (auto const& params : sampling_params) {
+      auto ret_triplet = cugraph::experimental::random_walks(
+        handle, graph_view, d_start.data(), num_paths, max_depth, false, params);
+
+      ASSERT_TRUE(cugraph::test::host_check_rw_paths(handle,
+                                                     graph_view,
+                                                     std::get<0>(ret_triplet),
+                                                     std::get<1>(ret_triplet),
+                                                     std::get<2>(ret_triplet)));
+    }
+
+    // padded output:
+    //
+    auto padded_triplet = cugraph::experimental::random_walks(
+      handle, graph_view, d_start.data(), num_paths, max_depth, true);
+
+    ASSERT_EQ(std::get<0>(padded_triplet).size(), static_cast<size_t>(num_paths * max_depth));
+    ASSERT_EQ(std::get<1>(padded_triplet).size(),
+              static_cast<size_t>(num_paths * (max_depth - 1)));
+
+    std::vector<vertex_t> h_padded_v(std::get<0>(padded_triplet).size());
+    std::vector<edge_t> h_sizes(std::get<2>(padded_triplet).size());
+    raft::update_host(h_padded_v.data(),
+                      std::get<0>(padded_triplet).data(),
+                      h_padded_v.size(),
+                      handle.get_stream());
+    raft::update_host(
+      h_sizes.data(), std::get<2>(padded_triplet).data(), h_sizes.size(), handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    for (edge_t i = 0; i < num_paths; ++i) {
+      for (edge_t j = 0; j < max_depth; ++j) {
+        auto v = h_padded_v[i * max_depth + j];
+        if (j < h_sizes[i]) {
+          ASSERT_TRUE((v >= 0) && (v < num_vertices)) << "invalid vertex in a padded path.";
+        } else {
+          ASSERT_EQ(v, cugraph::invalid_vertex_id<vertex_t>::value) << "invalid padding.";
+        }
+      }
+    }
+
+    // (compacting the padded paths gives valid coalesced paths)
+    //
+    auto& d_padded_v = std::get<0>(padded_triplet);
+    auto& d_padded_w = std::get<1>(padded_triplet);
+    cugraph::experimental::detail::random_walker_t<graph_vt> rand_walker{
+      handle, graph_view, num_paths, max_depth};
+    rand_walker.stop(d_padded_v, d_padded_w, std::get<2>(padded_triplet));
+
+    ASSERT_TRUE(cugraph::test::host_check_rw_paths(
+      handle, graph_view, d_padded_v, d_padded_w, std::get<2>(padded_triplet)));
   }
 };
 
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <experimental/graph.hpp>
+#include <experimental/graph_functions.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::vector<std::tuple<vertex_t, vertex_t, weight_t>> extract_edges(
+  std::vector<edge_t> const& offsets,
+  std::vector<vertex_t> const& indices,
+  std::vector<weight_t> const& weights,
+  std::vector<vertex_t> const& vertex_map /* map to the original vertices, identity if empty */)
+{
+  std::vector<std::tuple<vertex_t, vertex_t, weight_t>> edges(indices.size());
+  for (size_t i = 0; i < offsets.size() - 1; ++i) {
+    for (auto j = offsets[i]; j < offsets[i + 1]; ++j) {
+      auto major = static_cast<vertex_t>(i);
+      auto minor = indices[j];
+      edges[j]   = std::make_tuple(vertex_map.size() > 0 ? vertex_map[major] : major,
+                                 vertex_map.size() > 0 ? vertex_map[minor] : minor,
+                                 weights.size() > 0 ? weights[j] : weight_t{1.0});
+    }
+  }
+  std::sort(edges.begin(), edges.end());
+  return edges;
+}
+
+typedef struct ReorderGraph_Usecase_t {
+  std::string graph_file_full_path{};
+  cugraph::experimental::vertex_order_t order{cugraph::experimental::vertex_order_t::degree};
+  bool test_weighted{false};
+
+  ReorderGraph_Usecase_t(std::string const& graph_file_path,
+                         cugraph::experimental::vertex_order_t order,
+                         bool test_weighted)
+    : order(order), test_weighted(test_weighted)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} ReorderGraph_Usecase;
+
+class Tests_ReorderGraph : public ::testing::TestWithParam<ReorderGraph_Usecase> {
+ public:
+  Tests_ReorderGraph() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t, bool store_transposed>
+  void run_current_test(ReorderGraph_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, store_transposed, false> graph(
+      handle);
+    std::tie(graph, std::ignore) = cugraph::test::
+      read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, store_transposed, false>(
+        handle, configuration.graph_file_full_path, configuration.test_weighted, false);
+    auto graph_view = graph.view();
+
+    std::vector<vertex_t> h_clusters(graph_view.get_number_of_vertices());
+    std::default_random_engine generator{};
+    std::uniform_int_distribution<vertex_t> distribution{
+      0, std::max(graph_view.get_number_of_vertices() / 16, vertex_t{1}) - 1};
+    std::for_each(h_clusters.begin(), h_clusters.end(), [&distribution, &generator](auto& cluster) {
+      cluster = distribution(generator);
+    });
+    rmm::device_uvector<vertex_t> d_clusters(h_clusters.size(), handle.get_stream());
+    raft::update_device(
+      d_clusters.data(), h_clusters.data(), h_clusters.size(), handle.get_stream());
+
+    std::unique_ptr<
+      cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, store_transposed, false>>
+      reordered_graph{};
+    rmm::device_uvector<vertex_t> d_new_to_old(0, handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    std::tie(reordered_graph, d_new_to_old) = cugraph::experimental::reorder_graph(
+      handle, graph_view, configuration.order, d_clusters.data(), static_cast<vertex_t*>(nullptr));
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    auto reordered_graph_view = reordered_graph->view();
+
+    ASSERT_EQ(reordered_graph_view.get_number_of_vertices(),
+              graph_view.get_number_of_vertices());
+    ASSERT_EQ(reordered_graph_view.get_number_of_edges(), graph_view.get_number_of_edges());
+
+    auto copy_to_host = [&handle](auto const* ptr, size_t size) {
+      std::vector<std::remove_cv_t<std::remove_reference_t<decltype(*ptr)>>> ret(size);
+      raft::update_host(ret.data(), ptr, size, handle.get_stream());
+      CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+      return ret;
+    };
+
+    auto h_offsets = copy_to_host(graph_view.offsets(), graph_view.get_number_of_vertices() + 1);
+    auto h_indices = copy_to_host(graph_view.indices(), graph_view.get_number_of_edges());
+    auto h_weights = graph_view.is_weighted()
+                       ? copy_to_host(graph_view.weights(), graph_view.get_number_of_edges())
+                       : std::vector<weight_t>{};
+    auto h_reordered_offsets = copy_to_host(reordered_graph_view.offsets(),
+                                            reordered_graph_view.get_number_of_vertices() + 1);
+    auto h_reordered_indices =
+      copy_to_host(reordered_graph_view.indices(), reordered_graph_view.get_number_of_edges());
+    auto h_reordered_weights = reordered_graph_view.is_weighted()
+                                 ? copy_to_host(reordered_graph_view.weights(),
+                                                reordered_graph_view.get_number_of_edges())
+                                 : std::vector<weight_t>{};
+    auto h_new_to_old = copy_to_host(d_new_to_old.data(), d_new_to_old.size());
+
+    std::vector<vertex_t> h_sorted_new_to_old(h_new_to_old);
+    std::sort(h_sorted_new_to_old.begin(), h_sorted_new_to_old.end());
+    std::vector<vertex_t> h_identity(h_sorted_new_to_old.size());
+    std::iota(h_identity.begin(), h_identity.end(), vertex_t{0});
+    ASSERT_TRUE(h_sorted_new_to_old == h_identity) << "The returned map is not a permutation.";
+
+    ASSERT_TRUE(extract_edges(h_offsets, h_indices, h_weights, std::vector<vertex_t>{}) ==
+                extract_edges(h_reordered_offsets, h_reordered_indices, h_reordered_weights,
+                              h_new_to_old))
+      << "The reordered graph does not have the same edges as the input graph.";
+
+    if (configuration.order == cugraph::experimental::vertex_order_t::degree) {
+      std::vector<edge_t> h_reordered_degrees(h_reordered_offsets.size() - 1);
+      std::adjacent_difference(h_reordered_offsets.begin() + 1,
+                               h_reordered_offsets.end(),
+                               h_reordered_degrees.begin());
+      h_reordered_degrees[0] = h_reordered_offsets[1] - h_reordered_offsets[0];
+      ASSERT_TRUE(std::is_sorted(
+        h_reordered_degrees.begin(), h_reordered_degrees.end(), std::greater<edge_t>{}));
+    } else if (configuration.order == cugraph::experimental::vertex_order_t::cluster) {
+      ASSERT_TRUE(std::is_sorted(h_new_to_old.begin(),
+                                 h_new_to_old.end(),
+                                 [&h_clusters](auto lhs, auto rhs) {
+                                   return h_clusters[lhs] < h_clusters[rhs];
+                                 }));
+    }
+  }
+};
+
+// FIXME: add tests for type combinations
+
+TEST_P(Tests_ReorderGraph, CheckInt32Int32FloatTransposed)
+{
+  run_current_test<int32_t, int32_t, float, true>(GetParam());
+}
+
+TEST_P(Tests_ReorderGraph, CheckInt32Int32FloatUntransposed)
+{
+  run_current_test<int32_t, int32_t, float, false>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_ReorderGraph,
+  ::testing::Values(
+    ReorderGraph_Usecase(
+      "test/datasets/karate.mtx", cugraph::experimental::vertex_order_t::degree, false),
+    ReorderGraph_Usecase("test/datasets/karate.mtx",
+                         cugraph::experimental::vertex_order_t::reverse_cuthill_mckee,
+                         true),
+    ReorderGraph_Usecase(
+      "test/datasets/karate.mtx", cugraph::experimental::vertex_order_t::cluster, false),
+    ReorderGraph_Usecase(
+      "test/datasets/web-Google.mtx", cugraph::experimental::vertex_order_t::degree, true),
+    ReorderGraph_Usecase("test/datasets/web-Google.mtx",
+                         cugraph::experimental::vertex_order_t::reverse_cuthill_mckee,
+                         false),
+    ReorderGraph_Usecase(
+      "test/datasets/web-Google.mtx", cugraph::experimental::vertex_order_t::cluster, true)));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "similarity_utils.hpp"
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+typedef struct Similarity_Usecase_t {
+  std::string graph_file_full_path{};
+  bool sorted_neighbor_lists{false};
+
+  Similarity_Usecase_t(std::string const& graph_file_path, bool sorted_neighbor_lists)
+    : sorted_neighbor_lists(sorted_neighbor_lists)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} Similarity_Usecase;
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+void similarity_coefficients(
+  raft::handle_t const& handle,
+  cugraph::experimental::graph_view_t<vertex_t, edge_t, weight_t, false, false> const& graph_view,
+  cugraph::test::similarity_coefficient_t coefficient,
+  vertex_t const* first,
+  vertex_t const* second,
+  size_t num_pairs,
+  weight_t* coefficients)
+{
+  switch (coefficient) {
+    case cugraph::test::similarity_coefficient_t::jaccard:
+      cugraph::experimental::jaccard_coefficients(
+        handle, graph_view, first, second, num_pairs, coefficients);
+      break;
+    case cugraph::test::similarity_coefficient_t::overlap:
+      cugraph::experimental::overlap_coefficients(
+        handle, graph_view, first, second, num_pairs, coefficients);
+      break;
+    case cugraph::test::similarity_coefficient_t::sorensen:
+      cugraph::experimental::sorensen_coefficients(
+        handle, graph_view, first, second, num_pairs, coefficients);
+      break;
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+void similarity_coefficients(
+  raft::handle_t const& handle,
+  cugraph::experimental::graph_view_t<vertex_t, edge_t, weight_t, false, false> const& graph_view,
+  cugraph::test::similarity_coefficient_t coefficient,
+  weight_t* coefficients)
+{
+  switch (coefficient) {
+    case cugraph::test::similarity_coefficient_t::jaccard:
+      cugraph::experimental::jaccard_coefficients(handle, graph_view, coefficients);
+      break;
+    case cugraph::test::similarity_coefficient_t::overlap:
+      cugraph::experimental::overlap_coefficients(handle, graph_view, coefficients);
+      break;
+    case cugraph::test::similarity_coefficient_t::sorensen:
+      cugraph::experimental::sorensen_coefficients(handle, graph_view, coefficients);
+      break;
+  }
+}
+
+class Tests_Similarity : public ::testing::TestWithParam<Similarity_Usecase> {
+ public:
+  Tests_Similarity() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(Similarity_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    rmm::device_uvector<vertex_t> d_rows(0, handle.get_stream());
+    rmm::device_uvector<vertex_t> d_cols(0, handle.get_stream());
+    vertex_t number_of_vertices{};
+    bool is_symmetric{};
+    std::tie(d_rows, d_cols, std::ignore, number_of_vertices, is_symmetric) =
+      cugraph::test::read_edgelist_from_matrix_market_file<vertex_t, weight_t>(
+        handle, configuration.graph_file_full_path, false);
+
+    // the matrix market file order leaves the neighbor lists unsorted unless
+    // has_sorted_neighbor_lists is set (the intersection is computed on a sorted copy then)
+    cugraph::experimental::edgelist_t<vertex_t, edge_t, weight_t> edgelist{
+      d_rows.data(), d_cols.data(), nullptr, static_cast<edge_t>(d_rows.size())};
+    auto graph = cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, false>(
+      handle,
+      edgelist,
+      number_of_vertices,
+      cugraph::experimental::graph_properties_t{
+        is_symmetric, false, false, configuration.sorted_neighbor_lists},
+      false,
+      true);
+    auto graph_view = graph.view();
+
+    std::vector<edge_t> h_offsets(graph_view.get_number_of_vertices() + 1);
+    std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+    raft::update_host(h_offsets.data(),
+                      graph_view.offsets(),
+                      graph_view.get_number_of_vertices() + 1,
+                      handle.get_stream());
+    raft::update_host(h_indices.data(),
+                      graph_view.indices(),
+                      graph_view.get_number_of_edges(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    auto neighbors = cugraph::test::neighbor_sets(h_offsets, h_indices);
+
+    std::vector<vertex_t> h_firsts{};
+    std::vector<vertex_t> h_seconds{};
+    std::tie(h_firsts, h_seconds) =
+      cugraph::test::similarity_test_pairs(neighbors, size_t{1000}, size_t{16}, uint64_t{0});
+
+    rmm::device_uvector<vertex_t> d_firsts(h_firsts.size(), handle.get_stream());
+    rmm::device_uvector<vertex_t> d_seconds(h_seconds.size(), handle.get_stream());
+    raft::update_device(d_firsts.data(), h_firsts.data(), h_firsts.size(), handle.get_stream());
+    raft::update_device(d_seconds.data(), h_seconds.data(), h_seconds.size(), handle.get_stream());
+
+    for (auto coefficient : {cugraph::test::similarity_coefficient_t::jaccard,
+                             cugraph::test::similarity_coefficient_t::overlap,
+                             cugraph::test::similarity_coefficient_t::sorensen}) {
+      auto name = cugraph::test::similarity_coefficient_name(coefficient);
+
+      // 1. vertex pairs
+
+      rmm::device_uvector<weight_t> d_pair_coefficients(h_firsts.size(), handle.get_stream());
+
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+      similarity_coefficients(handle,
+                              graph_view,
+                              coefficient,
+                              d_firsts.data(),
+                              d_seconds.data(),
+                              h_firsts.size(),
+                              d_pair_coefficients.data());
+
+      CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+      std::vector<weight_t> h_pair_coefficients(h_firsts.size());
+      raft::update_host(h_pair_coefficients.data(),
+                        d_pair_coefficients.data(),
+                        d_pair_coefficients.size(),
+                        handle.get_stream());
+      CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+      for (size_t i = 0; i < h_firsts.size(); ++i) {
+        auto reference = cugraph::test::similarity_reference<vertex_t, weight_t>(
+          neighbors, coefficient, h_firsts[i], h_seconds[i]);
+        ASSERT_TRUE(cugraph::test::similarity_nearly_equal(h_pair_coefficients[i], reference))
+          << name << " coefficient of (" << h_firsts[i] << ", " << h_seconds[i]
+          << ") has value: " << h_pair_coefficients[i]
+          << " different from the reference value: " << reference;
+      }
+
+      // 2. edge endpoints (in the CSR order)
+
+      rmm::device_uvector<weight_t> d_edge_coefficients(graph_view.get_number_of_edges(),
+                                                        handle.get_stream());
+      similarity_coefficients(handle, graph_view, coefficient, d_edge_coefficients.data());
+
+      std::vector<weight_t> h_edge_coefficients(graph_view.get_number_of_edges());
+      raft::update_host(h_edge_coefficients.data(),
+                        d_edge_coefficients.data(),
+                        d_edge_coefficients.size(),
+                        handle.get_stream());
+      CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+      for (vertex_t u = 0; u < graph_view.get_number_of_vertices(); ++u) {
+        for (auto j = h_offsets[u]; j < h_offsets[u + 1]; ++j) {
+          auto reference = cugraph::test::similarity_reference<vertex_t, weight_t>(
+            neighbors, coefficient, u, h_indices[j]);
+          ASSERT_TRUE(cugraph::test::similarity_nearly_equal(h_edge_coefficients[j], reference))
+            << name << " coefficient of edge (" << u << ", " << h_indices[j]
+            << ") has value: " << h_edge_coefficients[j]
+            << " different from the reference value: " << reference;
+        }
+      }
+    }
+  }
+};
+
+TEST_P(Tests_Similarity, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam());
+}
+
+TEST_P(Tests_Similarity, CheckInt32Int64Double)
+{
+  run_current_test<int32_t, int64_t, double>(GetParam());
+}
+
+TEST_P(Tests_Similarity, CheckInt64Int64Float)
+{
+  run_current_test<int64_t, int64_t, float>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_Similarity,
+  ::testing::Values(Similarity_Usecase("test/datasets/karate.mtx", false),
+                    Similarity_Usecase("test/datasets/karate.mtx", true),
+                    Similarity_Usecase("test/datasets/dolphins.mtx", false),
+                    Similarity_Usecase("test/datasets/netscience.mtx", false),
+                    Similarity_Usecase("test/datasets/netscience.mtx", true),
+                    // hub pairs with more than 128 neighbors in total (warp-per-pair merge path)
+                    Similarity_Usecase("test/datasets/web-Google.mtx", false),
+                    Similarity_Usecase("test/datasets/web-Google.mtx", true)));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// host reference implementations for testing the (unweighted) experimental similarity
+// coefficients
+namespace cugraph {
+namespace test {
+
+enum class similarity_coefficient_t { jaccard, overlap, sorensen };
+
+inline std::string similarity_coefficient_name(similarity_coefficient_t coefficient)
+{
+  switch (coefficient) {
+    case similarity_coefficient_t::jaccard: return "Jaccard";
+    case similarity_coefficient_t::overlap: return "Overlap";
+    default: return "Sorensen";
+  }
+}
+
+// sorted and duplicate free neighbor lists (set semantics)
+template <typename vertex_t, typename edge_t>
+std::vector<std::vector<vertex_t>> neighbor_sets(std::vector<edge_t> const& offsets,
+                                                 std::vector<vertex_t> const& indices)
+{
+  std::vector<std::vector<vertex_t>> neighbors(offsets.size() - 1);
+  for (size_t i = 0; i < neighbors.size(); ++i) {
+    neighbors[i].assign(indices.begin() + offsets[i], indices.begin() + offsets[i + 1]);
+    std::sort(neighbors[i].begin(), neighbors[i].end());
+    neighbors[i].erase(std::unique(neighbors[i].begin(), neighbors[i].end()), neighbors[i].end());
+  }
+  return neighbors;
+}
+
+template <typename vertex_t, typename weight_t>
+weight_t similarity_reference(std::vector<std::vector<vertex_t>> const& neighbors,
+                              similarity_coefficient_t coefficient,
+                              vertex_t u,
+                              vertex_t v)
+{
+  std::vector<vertex_t> intersection{};
+  std::set_intersection(neighbors[u].begin(),
+                        neighbors[u].end(),
+                        neighbors[v].begin(),
+                        neighbors[v].end(),
+                        std::back_inserter(intersection));
+  auto intersection_size = static_cast<weight_t>(intersection.size());
+  auto u_size            = static_cast<weight_t>(neighbors[u].size());
+  auto v_size            = static_cast<weight_t>(neighbors[v].size());
+
+  weight_t numerator{intersection_size};
+  weight_t denominator{};
+  switch (coefficient) {
+    case similarity_coefficient_t::jaccard:
+      denominator = u_size + v_size - intersection_size;
+      break;
+    case similarity_coefficient_t::overlap: denominator = std::min(u_size, v_size); break;
+    case similarity_coefficient_t::sorensen:
+      numerator *= weight_t{2.0};
+      denominator = u_size + v_size;
+      break;
+  }
+  return denominator > weight_t{0.0} ? numerator / denominator : weight_t{0.0};
+}
+
+// A mix of vertex pairs: (two hop) pairs sharing a neighbor, random pairs (mostly with empty
+// intersections in sparse graphs), and pairs of the highest degree vertices (the intersection of
+// their neighbor lists takes the warp-per-pair merge path).
+template <typename vertex_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>> similarity_test_pairs(
+  std::vector<std::vector<vertex_t>> const& neighbors,
+  size_t num_random_pairs,
+  size_t num_hubs,
+  uint64_t seed)
+{
+  auto num_vertices = static_cast<vertex_t>(neighbors.size());
+
+  std::vector<vertex_t> firsts{};
+  std::vector<vertex_t> seconds{};
+
+  std::mt19937_64 rng(seed);
+  std::uniform_int_distribution<vertex_t> vertex_distribution(0, num_vertices - 1);
+  for (size_t i = 0; i < num_random_pairs; ++i) {
+    auto u = vertex_distribution(rng);
+    firsts.push_back(u);
+    if ((i % 2 == 0) && (neighbors[u].size() > 0)) {
+      // a two hop pair
+      auto w = neighbors[u][rng() % neighbors[u].size()];
+      seconds.push_back(neighbors[w].size() > 0 ? neighbors[w][rng() % neighbors[w].size()] : u);
+    } else {
+      seconds.push_back(vertex_distribution(rng));
+    }
+  }
+
+  std::vector<vertex_t> hubs(num_vertices);
+  std::iota(hubs.begin(), hubs.end(), vertex_t{0});
+  num_hubs = std::min(num_hubs, hubs.size());
+  std::partial_sort(
+    hubs.begin(), hubs.begin() + num_hubs, hubs.end(), [&neighbors](auto lhs, auto rhs) {
+      return neighbors[lhs].size() > neighbors[rhs].size();
+    });
+  for (size_t i = 0; i < num_hubs; ++i) {
+    for (size_t j = 0; j < num_hubs; ++j) {
+      firsts.push_back(hubs[i]);
+      seconds.push_back(hubs[j]);
+    }
+  }
+
+  return std::make_tuple(std::move(firsts), std::move(seconds));
+}
+
+template <typename weight_t>
+bool similarity_nearly_equal(weight_t lhs, weight_t rhs)
+{
+  auto threshold_ratio     = weight_t{1e-4};
+  auto threshold_magnitude = weight_t{1e-6};
+  return std::abs(lhs - rhs) <=
+         std::max(std::max(std::abs(lhs), std::abs(rhs)) * threshold_ratio, threshold_magnitude);
+}
+
+}  // namespace test
+}  // namespace cugraph
@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// computes the maximum (over the eigenpairs) residual norm ||M x - lambda x|| / ||x|| for the
+// Laplacian (balanced cut) or the modularity matrix (modularity)
+template <typename vertex_t, typename edge_t, typename weight_t>
+double spectral_residual_reference(edge_t const* offsets,
+                                   vertex_t const* indices,
+                                   weight_t const* weights,
+                                   vertex_t num_vertices,
+                                   cugraph::experimental::spectral_objective_t objective,
+                                   weight_t const* eig_vals,
+                                   weight_t const* eig_vects,
+                                   size_t n_eig_vects)
+{
+  std::vector<double> degrees(num_vertices, 0.0);
+  for (vertex_t u = 0; u < num_vertices; ++u) {
+    for (auto i = offsets[u]; i < offsets[u + 1]; ++i) { degrees[u] += weights[i]; }
+  }
+  auto total_weight = std::accumulate(degrees.begin(), degrees.end(), double{0.0});
+
+  double max_residual{0.0};
+  for (size_t j = 0; j < n_eig_vects; ++j) {
+    auto x = eig_vects + j * num_vertices;
+    double dx{0.0};
+    double norm{0.0};
+    for (vertex_t u = 0; u < num_vertices; ++u) {
+      dx += degrees[u] * x[u];
+      norm += static_cast<double>(x[u]) * static_cast<double>(x[u]);
+    }
+    double residual{0.0};
+    for (vertex_t u = 0; u < num_vertices; ++u) {
+      double ax{0.0};
+      for (auto i = offsets[u]; i < offsets[u + 1]; ++i) { ax += weights[i] * x[indices[i]]; }
+      auto mx = objective == cugraph::experimental::spectral_objective_t::modularity
+                  ? ax - degrees[u] * dx / total_weight
+                  : degrees[u] * x[u] - ax;
+      auto diff = mx - static_cast<double>(eig_vals[j]) * static_cast<double>(x[u]);
+      residual += diff * diff;
+    }
+    max_residual = std::max(max_residual, std::sqrt(residual / norm));
+  }
+
+  return max_residual;
+}
+
+typedef struct SpectralClustering_Usecase_t {
+  std::string graph_file_full_path{};
+  cugraph::experimental::spectral_objective_t objective{};
+  size_t n_eig_vects{0};
+
+  SpectralClustering_Usecase_t(std::string const& graph_file_path,
+                               cugraph::experimental::spectral_objective_t objective,
+                               size_t n_eig_vects)
+    : objective(objective), n_eig_vects(n_eig_vects)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} SpectralClustering_Usecase;
+
+class Tests_SpectralClustering : public ::testing::TestWithParam<SpectralClustering_Usecase> {
+ public:
+  Tests_SpectralClustering() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // Check the eigenpairs against the reference residuals, check that warm-starting from the
+  // returned eigenvectors converges immediately, and cluster with several numbers of clusters
+  // reusing the same embedding
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(SpectralClustering_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, false> graph(handle);
+    std::tie(graph, std::ignore) = cugraph::test::
+      read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, false>(
+        handle, configuration.graph_file_full_path, true, false);
+    auto graph_view = graph.view();
+
+    auto num_vertices = graph_view.get_number_of_vertices();
+
+    std::vector<edge_t> h_offsets(num_vertices + 1);
+    std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+    std::vector<weight_t> h_weights(graph_view.get_number_of_edges());
+    raft::update_host(
+      h_offsets.data(), graph_view.offsets(), num_vertices + 1, handle.get_stream());
+    raft::update_host(h_indices.data(),
+                      graph_view.indices(),
+                      graph_view.get_number_of_edges(),
+                      handle.get_stream());
+    raft::update_host(h_weights.data(),
+                      graph_view.weights(),
+                      graph_view.get_number_of_edges(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    auto evs_tolerance = static_cast<weight_t>(std::is_same<weight_t, float>::value ? 1e-4 : 1e-7);
+
+    rmm::device_uvector<weight_t> d_eig_vals(configuration.n_eig_vects, handle.get_stream());
+    rmm::device_uvector<weight_t> d_eig_vects(
+      static_cast<size_t>(num_vertices) * configuration.n_eig_vects, handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    cugraph::experimental::compute_spectral_embedding(handle,
+                                                      graph_view,
+                                                      configuration.objective,
+                                                      configuration.n_eig_vects,
+                                                      d_eig_vals.data(),
+                                                      d_eig_vects.data(),
+                                                      evs_tolerance,
+                                                      size_t{5000});
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    std::vector<weight_t> h_eig_vals(d_eig_vals.size());
+    std::vector<weight_t> h_eig_vects(d_eig_vects.size());
+    raft::update_host(h_eig_vals.data(), d_eig_vals.data(), d_eig_vals.size(), handle.get_stream());
+    raft::update_host(
+      h_eig_vects.data(), d_eig_vects.data(), d_eig_vects.size(), handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    auto max_degree = weight_t{0.0};
+    for (vertex_t u = 0; u < num_vertices; ++u) {
+      max_degree = std::max(max_degree,
+                            std::accumulate(h_weights.begin() + h_offsets[u],
+                                            h_weights.begin() + h_offsets[u + 1],
+                                            weight_t{0.0}));
+    }
+    // the solver tolerance is relative to the operator shift (2 * max_degree), allow some slack
+    // for the host reference computation
+    auto threshold = 10.0 * static_cast<double>(evs_tolerance) * 2.0 * max_degree;
+
+    auto residual = spectral_residual_reference(h_offsets.data(),
+                                                h_indices.data(),
+                                                h_weights.data(),
+                                                num_vertices,
+                                                configuration.objective,
+                                                h_eig_vals.data(),
+                                                h_eig_vects.data(),
+                                                configuration.n_eig_vects);
+    ASSERT_TRUE(residual <= threshold)
+      << "The eigenpair residual (" << residual << ") exceeds the threshold (" << threshold << ").";
+
+    for (size_t j = 1; j < configuration.n_eig_vects; ++j) {
+      if (configuration.objective == cugraph::experimental::spectral_objective_t::modularity) {
+        ASSERT_TRUE(h_eig_vals[j - 1] + threshold >= h_eig_vals[j])
+          << "Modularity matrix eigenvalues should be in the descending order.";
+      } else {
+        ASSERT_TRUE(h_eig_vals[j - 1] <= h_eig_vals[j] + threshold)
+          << "Laplacian eigenvalues should be in the ascending order.";
+      }
+    }
+
+    // warm start from the converged eigenvectors
+
+    cugraph::experimental::compute_spectral_embedding(handle,
+                                                      graph_view,
+                                                      configuration.objective,
+                                                      configuration.n_eig_vects,
+                                                      d_eig_vals.data(),
+                                                      d_eig_vects.data(),
+                                                      evs_tolerance,
+                                                      size_t{2},
+                                                      true);
+
+    raft::update_host(h_eig_vals.data(), d_eig_vals.data(), d_eig_vals.size(), handle.get_stream());
+    raft::update_host(
+      h_eig_vects.data(), d_eig_vects.data(), d_eig_vects.size(), handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    residual = spectral_residual_reference(h_offsets.data(),
+                                           h_indices.data(),
+                                           h_weights.data(),
+                                           num_vertices,
+                                           configuration.objective,
+                                           h_eig_vals.data(),
+                                           h_eig_vects.data(),
+                                           configuration.n_eig_vects);
+    ASSERT_TRUE(residual <= threshold)
+      << "The eigenpair residual after a warm start (" << residual
+      << ") exceeds the threshold (" << threshold << ").";
+
+    // sweep n_clusters reusing the embedding
+
+    for (vertex_t n_clusters = 2; n_clusters <= static_cast<vertex_t>(configuration.n_eig_vects);
+         ++n_clusters) {
+      rmm::device_uvector<vertex_t> d_clustering(num_vertices, handle.get_stream());
+
+      cugraph::experimental::cluster_spectral_embedding(handle,
+                                                        graph_view,
+                                                        d_eig_vects.data(),
+                                                        configuration.n_eig_vects,
+                                                        n_clusters,
+                                                        d_clustering.data());
+
+      std::vector<vertex_t> h_clustering(d_clustering.size());
+      raft::update_host(
+        h_clustering.data(), d_clustering.data(), d_clustering.size(), handle.get_stream());
+      CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+      ASSERT_TRUE(std::all_of(h_clustering.begin(), h_clustering.end(), [n_clusters](auto c) {
+        return (c >= 0) && (c < n_clusters);
+      })) << "Cluster IDs should be in [0, n_clusters).";
+      std::vector<bool> used(n_clusters, false);
+      for (auto c : h_clustering) { used[c] = true; }
+      ASSERT_TRUE(std::count(used.begin(), used.end(), true) > 1)
+        << "Every vertex is assigned to the same cluster.";
+    }
+  }
+};
+
+TEST_P(Tests_SpectralClustering, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam());
+}
+
+TEST_P(Tests_SpectralClustering, CheckInt64Int64Double)
+{
+  run_current_test<int64_t, int64_t, double>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_SpectralClustering,
+  ::testing::Values(
+    SpectralClustering_Usecase("test/datasets/karate.mtx",
+                               cugraph::experimental::spectral_objective_t::balanced_cut,
+                               4),
+    SpectralClustering_Usecase("test/datasets/karate.mtx",
+                               cugraph::experimental::spectral_objective_t::modularity,
+                               4),
+    SpectralClustering_Usecase("test/datasets/dolphins.mtx",
+                               cugraph::experimental::spectral_objective_t::balanced_cut,
+                               6),
+    SpectralClustering_Usecase("test/datasets/dolphins.mtx",
+                               cugraph::experimental::spectral_objective_t::modularity,
+                               6)));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
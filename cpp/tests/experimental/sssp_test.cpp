@@ -90,10 +90,14 @@ typedef struct SSSP_Usecase_t {
   cugraph::test::input_graph_specifier_t input_graph_specifier{};
 
   size_t source{0};
+  bool adaptive_delta{false};
   bool check_correctness{false};
 
-  SSSP_Usecase_t(std::string const& graph_file_path, size_t source, bool check_correctness = true)
-    : source(source), check_correctness(check_correctness)
+  SSSP_Usecase_t(std::string const& graph_file_path,
+                 size_t source,
+                 bool adaptive_delta    = false,
+                 bool check_correctness = true)
+    : source(source), adaptive_delta(adaptive_delta), check_correctness(check_correctness)
   {
     std::string graph_file_full_path{};
     if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
@@ -107,8 +111,9 @@ typedef struct SSSP_Usecase_t {
 
   SSSP_Usecase_t(cugraph::test::rmat_params_t rmat_params,
                  size_t source,
+                 bool adaptive_delta    = false,
                  bool check_correctness = true)
-    : source(source), check_correctness(check_correctness)
+    : source(source), adaptive_delta(adaptive_delta), check_correctness(check_correctness)
   {
     input_graph_specifier.tag         = cugraph::test::input_graph_specifier_t::RMAT_PARAMS;
     input_graph_specifier.rmat_params = rmat_params;
@@ -180,7 +185,8 @@ class Tests_SSSP : public ::testing::TestWithParam<SSSP_Usecase> {
                                 d_predecessors.data(),
                                 static_cast<vertex_t>(configuration.source),
                                 std::numeric_limits<weight_t>::max(),
-                                false);
+                                false,
+                                configuration.adaptive_delta);
 
     CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
 
@@ -322,9 +328,19 @@ INSTANTIATE_TEST_CASE_P(
     SSSP_Usecase("test/datasets/dblp.mtx", 0),
     SSSP_Usecase("test/datasets/wiki2003.mtx", 1000),
     SSSP_Usecase(cugraph::test::rmat_params_t{10, 16, 0.57, 0.19, 0.19, 0, false, false}, 0),
+    // adaptive delta
+    SSSP_Usecase("test/datasets/karate.mtx", 0, true),
+    SSSP_Usecase("test/datasets/dblp.mtx", 0, true),
+    SSSP_Usecase("test/datasets/wiki2003.mtx", 1000, true),
+    SSSP_Usecase(cugraph::test::rmat_params_t{10, 16, 0.57, 0.19, 0.19, 0, false, false}, 0, true),
     // disable correctness checks for large graphs
     SSSP_Usecase(cugraph::test::rmat_params_t{20, 16, 0.57, 0.19, 0.19, 0, false, false},
                  0,
+                 false,
+                 false),
+    SSSP_Usecase(cugraph::test::rmat_params_t{20, 16, 0.57, 0.19, 0.19, 0, false, false},
+                 0,
+                 true,
                  false)));
 
 CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stack>
+#include <tuple>
+#include <vector>
+
+// Kosaraju's algorithm (with iterative depth-first searches), label every vertex with the smallest
+// vertex ID in its component
+template <typename vertex_t, typename edge_t>
+void strongly_connected_components_reference(edge_t const* offsets,
+                                             vertex_t const* indices,
+                                             vertex_t num_vertices,
+                                             vertex_t* components)
+{
+  auto const invalid_vertex = std::numeric_limits<vertex_t>::max();
+
+  std::vector<edge_t> transposed_offsets(num_vertices + 1, edge_t{0});
+  std::vector<vertex_t> transposed_indices(offsets[num_vertices]);
+  for (edge_t i = 0; i < offsets[num_vertices]; ++i) { ++transposed_offsets[indices[i] + 1]; }
+  std::partial_sum(
+    transposed_offsets.begin(), transposed_offsets.end(), transposed_offsets.begin());
+  {
+    auto insert_offsets = transposed_offsets;
+    for (vertex_t u = 0; u < num_vertices; ++u) {
+      for (auto i = offsets[u]; i < offsets[u + 1]; ++i) {
+        transposed_indices[insert_offsets[indices[i]]++] = u;
+      }
+    }
+  }
+
+  // 1. order the vertices by their finish times
+
+  std::vector<vertex_t> finish_order{};
+  std::vector<bool> visited(num_vertices, false);
+  for (vertex_t s = 0; s < num_vertices; ++s) {
+    if (visited[s]) { continue; }
+    std::stack<std::tuple<vertex_t, edge_t>> stack{};
+    visited[s] = true;
+    stack.push(std::make_tuple(s, offsets[s]));
+    while (!stack.empty()) {
+      auto u = std::get<0>(stack.top());
+      auto i = std::get<1>(stack.top());
+      if (i < offsets[u + 1]) {
+        std::get<1>(stack.top()) = i + 1;
+        auto v                   = indices[i];
+        if (!visited[v]) {
+          visited[v] = true;
+          stack.push(std::make_tuple(v, offsets[v]));
+        }
+      } else {
+        finish_order.push_back(u);
+        stack.pop();
+      }
+    }
+  }
+
+  // 2. visit the transposed graph in the reverse finish order
+
+  std::fill(components, components + num_vertices, invalid_vertex);
+  for (auto it = finish_order.rbegin(); it != finish_order.rend(); ++it) {
+    if (components[*it] != invalid_vertex) { continue; }
+    std::vector<vertex_t> members{*it};
+    components[*it] = *it;
+    for (size_t j = 0; j < members.size(); ++j) {
+      auto u = members[j];
+      for (auto i = transposed_offsets[u]; i < transposed_offsets[u + 1]; ++i) {
+        auto v = transposed_indices[i];
+        if (components[v] == invalid_vertex) {
+          components[v] = *it;
+          members.push_back(v);
+        }
+      }
+    }
+    auto min_member = *std::min_element(members.begin(), members.end());
+    for (auto v : members) { components[v] = min_member; }
+  }
+}
+
+typedef struct StronglyConnectedComponents_Usecase_t {
+  std::string graph_file_full_path{};
+
+  StronglyConnectedComponents_Usecase_t(std::string const& graph_file_path)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} StronglyConnectedComponents_Usecase;
+
+class Tests_StronglyConnectedComponents
+  : public ::testing::TestWithParam<StronglyConnectedComponents_Usecase> {
+ public:
+  Tests_StronglyConnectedComponents() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(StronglyConnectedComponents_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, false> graph(handle);
+    std::tie(graph, std::ignore) = cugraph::test::
+      read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, false>(
+        handle, configuration.graph_file_full_path, false, false);
+    auto graph_view = graph.view();
+
+    std::vector<edge_t> h_offsets(graph_view.get_number_of_vertices() + 1);
+    std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+    raft::update_host(h_offsets.data(),
+                      graph_view.offsets(),
+                      graph_view.get_number_of_vertices() + 1,
+                      handle.get_stream());
+    raft::update_host(h_indices.data(),
+                      graph_view.indices(),
+                      graph_view.get_number_of_edges(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    std::vector<vertex_t> h_reference_components(graph_view.get_number_of_vertices());
+    strongly_connected_components_reference(h_offsets.data(),
+                                            h_indices.data(),
+                                            graph_view.get_number_of_vertices(),
+                                            h_reference_components.data());
+
+    rmm::device_uvector<vertex_t> d_components(graph_view.get_number_of_vertices(),
+                                               handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    cugraph::experimental::strongly_connected_components(handle, graph_view, d_components.data());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    std::vector<vertex_t> h_cugraph_components(graph_view.get_number_of_vertices());
+    raft::update_host(h_cugraph_components.data(),
+                      d_components.data(),
+                      d_components.size(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    ASSERT_TRUE(std::equal(
+      h_reference_components.begin(), h_reference_components.end(), h_cugraph_components.begin()))
+      << "Component labels do not match with the reference values.";
+  }
+};
+
+TEST_P(Tests_StronglyConnectedComponents, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam());
+}
+
+TEST_P(Tests_StronglyConnectedComponents, CheckInt64Int64Float)
+{
+  run_current_test<int64_t, int64_t, float>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_StronglyConnectedComponents,
+  ::testing::Values(StronglyConnectedComponents_Usecase("test/datasets/cage6.mtx"),
+                    StronglyConnectedComponents_Usecase("test/datasets/karate.mtx"),
+                    StronglyConnectedComponents_Usecase("test/datasets/netscience.mtx")));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+template <typename vertex_t, typename edge_t>
+uint64_t triangle_count_reference(edge_t const* offsets,
+                                  vertex_t const* indices,
+                                  vertex_t num_vertices,
+                                  edge_t* vertex_triangle_counts)
+{
+  std::vector<std::vector<vertex_t>> neighbors(num_vertices);
+  for (vertex_t i = 0; i < num_vertices; ++i) {
+    for (auto j = offsets[i]; j < offsets[i + 1]; ++j) {
+      if (indices[j] != i) { neighbors[i].push_back(indices[j]); }
+    }
+    std::sort(neighbors[i].begin(), neighbors[i].end());
+    neighbors[i].erase(std::unique(neighbors[i].begin(), neighbors[i].end()), neighbors[i].end());
+  }
+
+  std::fill(vertex_triangle_counts, vertex_triangle_counts + num_vertices, edge_t{0});
+  uint64_t num_triangles{0};
+  for (vertex_t u = 0; u < num_vertices; ++u) {
+    for (auto v : neighbors[u]) {
+      if (v <= u) { continue; }
+      for (auto w : neighbors[v]) {
+        if (w <= v) { continue; }
+        if (std::binary_search(neighbors[u].begin(), neighbors[u].end(), w)) {
+          ++num_triangles;
+          ++vertex_triangle_counts[u];
+          ++vertex_triangle_counts[v];
+          ++vertex_triangle_counts[w];
+        }
+      }
+    }
+  }
+
+  return num_triangles;
+}
+
+typedef struct TriangleCount_Usecase_t {
+  std::string graph_file_full_path{};
+
+  TriangleCount_Usecase_t(std::string const& graph_file_path)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} TriangleCount_Usecase;
+
+class Tests_TriangleCount : public ::testing::TestWithParam<TriangleCount_Usecase> {
+ public:
+  Tests_TriangleCount() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(TriangleCount_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, false> graph(handle);
+    std::tie(graph, std::ignore) = cugraph::test::
+      read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, false>(
+        handle, configuration.graph_file_full_path, false, false);
+    auto graph_view = graph.view();
+
+    std::vector<edge_t> h_offsets(graph_view.get_number_of_vertices() + 1);
+    std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+    raft::update_host(h_offsets.data(),
+                      graph_view.offsets(),
+                      graph_view.get_number_of_vertices() + 1,
+                      handle.get_stream());
+    raft::update_host(h_indices.data(),
+                      graph_view.indices(),
+                      graph_view.get_number_of_edges(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    std::vector<edge_t> h_reference_vertex_triangle_counts(graph_view.get_number_of_vertices());
+    auto reference_num_triangles =
+      triangle_count_reference(h_offsets.data(),
+                               h_indices.data(),
+                               graph_view.get_number_of_vertices(),
+                               h_reference_vertex_triangle_counts.data());
+
+    rmm::device_uvector<edge_t> d_vertex_triangle_counts(graph_view.get_number_of_vertices(),
+                                                         handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    auto num_triangles = cugraph::experimental::triangle_count(
+      handle, graph_view, d_vertex_triangle_counts.data());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    ASSERT_EQ(num_triangles, reference_num_triangles)
+      << "Triangle count does not match with the reference value.";
+
+    // the total count should not depend on computing per-vertex counts
+    ASSERT_EQ(cugraph::experimental::triangle_count(handle, graph_view), reference_num_triangles)
+      << "Triangle count (without per-vertex counts) does not match with the reference value.";
+
+    std::vector<edge_t> h_cugraph_vertex_triangle_counts(graph_view.get_number_of_vertices());
+    raft::update_host(h_cugraph_vertex_triangle_counts.data(),
+                      d_vertex_triangle_counts.data(),
+                      d_vertex_triangle_counts.size(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    ASSERT_TRUE(std::equal(h_reference_vertex_triangle_counts.begin(),
+                           h_reference_vertex_triangle_counts.end(),
+                           h_cugraph_vertex_triangle_counts.begin()))
+      << "Per-vertex triangle counts do not match with the reference values.";
+  }
+};
+
+TEST_P(Tests_TriangleCount, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam());
+}
+
+TEST_P(Tests_TriangleCount, CheckInt64Int64Float)
+{
+  run_current_test<int64_t, int64_t, float>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(simple_test,
+                        Tests_TriangleCount,
+                        ::testing::Values(TriangleCount_Usecase("test/datasets/karate.mtx"),
+                                          TriangleCount_Usecase("test/datasets/dolphins.mtx"),
+                                          TriangleCount_Usecase("test/datasets/netscience.mtx")));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
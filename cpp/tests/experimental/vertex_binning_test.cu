@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+#include <matrix_partition_device.cuh>
+#include <patterns/vertex_binning.cuh>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+typedef struct VertexBinning_Usecase_t {
+  cugraph::test::input_graph_specifier_t input_graph_specifier{};
+  size_t vertex_stride{1};  // bin every vertex_stride'th vertex (in the reverse order)
+  bool expect_multiple_bins{false};
+
+  VertexBinning_Usecase_t(std::string const& graph_file_path,
+                          size_t vertex_stride,
+                          bool expect_multiple_bins)
+    : vertex_stride(vertex_stride), expect_multiple_bins(expect_multiple_bins)
+  {
+    std::string graph_file_full_path{};
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+    input_graph_specifier.tag = cugraph::test::input_graph_specifier_t::MATRIX_MARKET_FILE_PATH;
+    input_graph_specifier.graph_file_full_path = graph_file_full_path;
+  };
+
+  VertexBinning_Usecase_t(cugraph::test::rmat_params_t rmat_params,
+                          size_t vertex_stride,
+                          bool expect_multiple_bins)
+    : vertex_stride(vertex_stride), expect_multiple_bins(expect_multiple_bins)
+  {
+    input_graph_specifier.tag         = cugraph::test::input_graph_specifier_t::RMAT_PARAMS;
+    input_graph_specifier.rmat_params = rmat_params;
+  }
+} VertexBinning_Usecase;
+
+class Tests_VertexBinning : public ::testing::TestWithParam<VertexBinning_Usecase> {
+ public:
+  Tests_VertexBinning() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t>
+  void run_current_test(VertexBinning_Usecase const& configuration)
+  {
+    using weight_t = float;
+
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, false> graph(handle);
+    std::tie(graph, std::ignore) =
+      configuration.input_graph_specifier.tag ==
+          cugraph::test::input_graph_specifier_t::MATRIX_MARKET_FILE_PATH
+        ? cugraph::test::
+            read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, false>(
+              handle, configuration.input_graph_specifier.graph_file_full_path, false, false)
+        : cugraph::test::generate_graph_from_rmat_params<vertex_t, edge_t, weight_t, false, false>(
+            handle,
+            configuration.input_graph_specifier.rmat_params.scale,
+            configuration.input_graph_specifier.rmat_params.edge_factor,
+            configuration.input_graph_specifier.rmat_params.a,
+            configuration.input_graph_specifier.rmat_params.b,
+            configuration.input_graph_specifier.rmat_params.c,
+            configuration.input_graph_specifier.rmat_params.seed,
+            configuration.input_graph_specifier.rmat_params.undirected,
+            configuration.input_graph_specifier.rmat_params.scramble_vertex_ids,
+            false,
+            false,
+            std::vector<size_t>{0},
+            size_t{1});
+    auto graph_view = graph.view();
+
+    std::vector<edge_t> h_offsets(graph_view.get_number_of_vertices() + 1);
+    raft::update_host(h_offsets.data(),
+                      graph_view.offsets(),
+                      graph_view.get_number_of_vertices() + 1,
+                      handle.get_stream());
+
+    // a vertex list in the reverse vertex ID order (the input order should be kept within a bin)
+    std::vector<vertex_t> h_vertices{};
+    for (vertex_t v = graph_view.get_number_of_vertices() - 1; v >= 0;
+         v -= static_cast<vertex_t>(configuration.vertex_stride)) {
+      h_vertices.push_back(v);
+    }
+    rmm::device_uvector<vertex_t> d_vertices(h_vertices.size(), handle.get_stream());
+    raft::update_device(
+      d_vertices.data(), h_vertices.data(), h_vertices.size(), handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    cugraph::experimental::matrix_partition_device_t<decltype(graph_view)> matrix_partition(
+      graph_view, 0);
+    auto bins = cugraph::experimental::bin_vertices_by_local_degree(
+      handle, matrix_partition, d_vertices.begin(), d_vertices.end());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    std::vector<vertex_t> h_binned_vertices(bins.vertices.size());
+    raft::update_host(
+      h_binned_vertices.data(), bins.vertices.data(), bins.vertices.size(), handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    ASSERT_EQ(bins.offsets[0], size_t{0});
+    ASSERT_EQ(bins.offsets[cugraph::experimental::num_vertex_degree_bins], h_vertices.size());
+    if (h_binned_vertices.size() == 0) {
+      ASSERT_EQ(bins.bin_size(0), h_vertices.size());
+      h_binned_vertices = h_vertices;
+    }
+    ASSERT_EQ(h_binned_vertices.size(), h_vertices.size());
+
+    std::vector<edge_t> degree_thresholds{
+      edge_t{0},
+      static_cast<edge_t>(cugraph::experimental::detail::low_degree_threshold),
+      static_cast<edge_t>(cugraph::experimental::detail::mid_degree_threshold),
+      std::numeric_limits<edge_t>::max()};
+    std::vector<vertex_t> h_reference_binned_vertices{};
+    for (size_t i = 0; i < cugraph::experimental::num_vertex_degree_bins; ++i) {
+      std::copy_if(h_vertices.begin(),
+                   h_vertices.end(),
+                   std::back_inserter(h_reference_binned_vertices),
+                   [&h_offsets, &degree_thresholds, i](auto v) {
+                     auto degree = h_offsets[v + 1] - h_offsets[v];
+                     return (degree >= degree_thresholds[i]) && (degree < degree_thresholds[i + 1]);
+                   });
+      ASSERT_EQ(bins.offsets[i + 1], h_reference_binned_vertices.size())
+        << "Bin " << i << " size does not match with the reference value.";
+    }
+    ASSERT_EQ(h_binned_vertices, h_reference_binned_vertices)
+      << "Binned vertices do not match with the reference values.";
+
+    if (configuration.expect_multiple_bins) {
+      ASSERT_TRUE(bins.bin_size(1) > 0 || bins.bin_size(2) > 0)
+        << "Every vertex falls in the low-degree bin, the test graph should include hubs.";
+    }
+  }
+};
+
+TEST_P(Tests_VertexBinning, CheckInt32Int32)
+{
+  run_current_test<int32_t, int32_t>(GetParam());
+}
+
+TEST_P(Tests_VertexBinning, CheckInt32Int64)
+{
+  run_current_test<int32_t, int64_t>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_VertexBinning,
+  ::testing::Values(
+    // every vertex is in the low-degree bin
+    VertexBinning_Usecase("test/datasets/karate.mtx", 1, false),
+    VertexBinning_Usecase("test/datasets/web-Google.mtx", 1, true),
+    VertexBinning_Usecase("test/datasets/web-Google.mtx", 7, false),
+    VertexBinning_Usecase(cugraph::test::rmat_params_t{16, 32, 0.57, 0.19, 0.19, 0, false, false},
+                          1,
+                          true),
+    VertexBinning_Usecase(cugraph::test::rmat_params_t{16, 32, 0.57, 0.19, 0.19, 0, false, false},
+                          13,
+                          true)));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
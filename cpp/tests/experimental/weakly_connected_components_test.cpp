@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <experimental/graph.hpp>
+#include <experimental/graph_view.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <vector>
+
+// label every vertex with the smallest vertex ID in its component
+template <typename vertex_t, typename edge_t>
+void weakly_connected_components_reference(edge_t const* offsets,
+                                           vertex_t const* indices,
+                                           vertex_t num_vertices,
+                                           vertex_t* components)
+{
+  auto const unvisited = std::numeric_limits<vertex_t>::max();
+
+  std::fill(components, components + num_vertices, unvisited);
+  for (vertex_t s = 0; s < num_vertices; ++s) {
+    if (components[s] != unvisited) { continue; }
+    std::queue<vertex_t> queue{};
+    components[s] = s;
+    queue.push(s);
+    while (!queue.empty()) {
+      auto u = queue.front();
+      queue.pop();
+      for (auto i = offsets[u]; i < offsets[u + 1]; ++i) {
+        auto v = indices[i];
+        if (components[v] == unvisited) {
+          components[v] = s;
+          queue.push(v);
+        }
+      }
+    }
+  }
+}
+
+typedef struct WeaklyConnectedComponents_Usecase_t {
+  std::string graph_file_full_path{};
+
+  WeaklyConnectedComponents_Usecase_t(std::string const& graph_file_path)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} WeaklyConnectedComponents_Usecase;
+
+class Tests_WeaklyConnectedComponents
+  : public ::testing::TestWithParam<WeaklyConnectedComponents_Usecase> {
+ public:
+  Tests_WeaklyConnectedComponents() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(WeaklyConnectedComponents_Usecase const& configuration)
+  {
+    raft::handle_t handle{};
+
+    cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, false, false> graph(handle);
+    std::tie(graph, std::ignore) = cugraph::test::
+      read_graph_from_matrix_market_file<vertex_t, edge_t, weight_t, false, false>(
+        handle, configuration.graph_file_full_path, false, false);
+    auto graph_view = graph.view();
+
+    std::vector<edge_t> h_offsets(graph_view.get_number_of_vertices() + 1);
+    std::vector<vertex_t> h_indices(graph_view.get_number_of_edges());
+    raft::update_host(h_offsets.data(),
+                      graph_view.offsets(),
+                      graph_view.get_number_of_vertices() + 1,
+                      handle.get_stream());
+    raft::update_host(h_indices.data(),
+                      graph_view.indices(),
+                      graph_view.get_number_of_edges(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    std::vector<vertex_t> h_reference_components(graph_view.get_number_of_vertices());
+    weakly_connected_components_reference(h_offsets.data(),
+                                          h_indices.data(),
+                                          graph_view.get_number_of_vertices(),
+                                          h_reference_components.data());
+
+    rmm::device_uvector<vertex_t> d_components(graph_view.get_number_of_vertices(),
+                                               handle.get_stream());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    cugraph::experimental::weakly_connected_components(handle, graph_view, d_components.data());
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    std::vector<vertex_t> h_cugraph_components(graph_view.get_number_of_vertices());
+    raft::update_host(h_cugraph_components.data(),
+                      d_components.data(),
+                      d_components.size(),
+                      handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    ASSERT_TRUE(std::equal(
+      h_reference_components.begin(), h_reference_components.end(), h_cugraph_components.begin()))
+      << "Component labels do not match with the reference values.";
+  }
+};
+
+TEST_P(Tests_WeaklyConnectedComponents, CheckInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam());
+}
+
+TEST_P(Tests_WeaklyConnectedComponents, CheckInt64Int64Float)
+{
+  run_current_test<int64_t, int64_t, float>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_WeaklyConnectedComponents,
+  ::testing::Values(WeaklyConnectedComponents_Usecase("test/datasets/karate.mtx"),
+                    WeaklyConnectedComponents_Usecase("test/datasets/dolphins.mtx"),
+                    WeaklyConnectedComponents_Usecase("test/datasets/netscience.mtx")));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
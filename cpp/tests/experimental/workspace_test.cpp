@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+
+#include <utilities/workspace.hpp>
+
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+class Tests_Workspace : public ::testing::Test {
+ public:
+  Tests_Workspace() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_F(Tests_Workspace, NoBoundArena)
+{
+  using namespace cugraph::experimental;
+
+  raft::handle_t handle{};
+
+  ASSERT_EQ(detail::get_workspace_resource(handle), rmm::mr::get_current_device_resource());
+  {
+    detail::workspace_phase_t phase(handle);  // a no-op
+  }
+  ASSERT_EQ(detail::get_workspace_resource(handle), rmm::mr::get_current_device_resource());
+}
+
+TEST_F(Tests_Workspace, BumpAllocationAndPeak)
+{
+  using namespace cugraph::experimental;
+
+  raft::handle_t handle{};
+  workspace_arena_t arena(size_t{1} << 20);
+
+  {
+    workspace_scope_t scope(handle, arena);
+    ASSERT_EQ(detail::get_workspace_resource(handle), &arena);
+
+    for (int i = 0; i < 4; ++i) {
+      detail::workspace_phase_t phase(handle);
+      rmm::device_uvector<int32_t> a(1000, handle.get_stream(), &arena);
+      rmm::device_uvector<int32_t> b(1000, handle.get_stream(), &arena);
+      ASSERT_EQ(static_cast<size_t>(reinterpret_cast<uintptr_t>(b.data()) -
+                                    reinterpret_cast<uintptr_t>(a.data())),
+                size_t{4096})  // 4000 bytes rounded up to the alignment
+        << "Allocations are not bump allocated.";
+    }
+    ASSERT_EQ(arena.get_used_bytes(), size_t{0});
+    ASSERT_EQ(arena.get_peak_bytes(), size_t{8192});
+    ASSERT_EQ(arena.get_capacity_bytes(), size_t{1} << 20);
+
+    {
+      // larger than the chunk size
+      rmm::device_uvector<int8_t> c((size_t{1} << 20) + 1, handle.get_stream(), &arena);
+      ASSERT_EQ(arena.get_capacity_bytes(), (size_t{2} << 20) + workspace_arena_t::alignment);
+    }
+    ASSERT_GT(arena.get_used_bytes(), size_t{0});  // the bump pointer stays in the second chunk
+  }
+  ASSERT_EQ(arena.get_used_bytes(), size_t{0});
+  ASSERT_EQ(detail::get_workspace_resource(handle), rmm::mr::get_current_device_resource());
+
+  arena.release();
+  ASSERT_EQ(arena.get_capacity_bytes(), size_t{0});
+}
+
+TEST_F(Tests_Workspace, NestedScopesAndLastAllocationReuse)
+{
+  using namespace cugraph::experimental;
+
+  raft::handle_t handle{};
+  workspace_arena_t outer_arena{};
+  workspace_arena_t inner_arena{};
+
+  workspace_scope_t outer_scope(handle, outer_arena);
+  rmm::device_uvector<int32_t> a(10, handle.get_stream(), detail::get_workspace_resource(handle));
+  {
+    workspace_scope_t inner_scope(handle, inner_arena);
+    ASSERT_EQ(detail::get_workspace_resource(handle), &inner_arena);
+  }
+  ASSERT_EQ(detail::get_workspace_resource(handle), &outer_arena);
+
+  auto used_bytes = outer_arena.get_used_bytes();
+  {
+    rmm::device_uvector<int32_t> b(10, handle.get_stream(), &outer_arena);
+  }
+  ASSERT_EQ(outer_arena.get_used_bytes(), used_bytes)
+    << "Deallocating the most recent allocation should reclaim its memory.";
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
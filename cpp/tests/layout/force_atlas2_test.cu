@@ -18,6 +18,7 @@
 
 #include <layout/trust_worthiness.h>
 #include <algorithms.hpp>
+#include <experimental/graph.hpp>
 #include <graph.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
@@ -220,6 +221,74 @@ class Tests_Force_Atlas2 : public ::testing::TestWithParam<Force_Atlas2_Usecase>
     printf("score: %f\n", score_bh);
     ASSERT_GT(score_bh, param.score);
   }
+
+  template <typename T>
+  void run_current_test_experimental(const Force_Atlas2_Usecase& param, bool chunked)
+  {
+    raft::handle_t handle;
+
+    cugraph::experimental::graph_t<int32_t, int32_t, T, false, false> graph(handle);
+    std::tie(graph, std::ignore) =
+      cugraph::test::read_graph_from_matrix_market_file<int32_t, int32_t, T, false, false>(
+        handle, param.matrix_file, true, false);
+    auto graph_view = graph.view();
+
+    auto m = graph_view.get_number_of_vertices();
+
+    // Build Adjacency Matrix
+    std::vector<int32_t> h_offsets(m + 1);
+    std::vector<int32_t> h_indices(graph_view.get_number_of_edges());
+    raft::update_host(
+      h_offsets.data(), graph_view.offsets(), h_offsets.size(), handle.get_stream());
+    raft::update_host(
+      h_indices.data(), graph_view.indices(), h_indices.size(), handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+    std::vector<std::vector<int>> adj_matrix(m, std::vector<int>(m));
+    for (int32_t row = 0; row < m; ++row) {
+      for (auto i = h_offsets[row]; i < h_offsets[row + 1]; ++i) {
+        adj_matrix[row][h_indices[i]] = 1;
+      }
+    }
+
+    rmm::device_uvector<float> d_pos(m * 2, handle.get_stream());
+    if (chunked) {
+      // 500 iterations in chunks, resuming from the state of the previous chunk
+      cugraph::force_atlas2_layout_t<decltype(graph_view)> layout(
+        handle, graph_view, nullptr, nullptr, false, false, false, 1.0f, 1.0f, 1.0f, 2.0f);
+      for (int i = 0; i < 5; ++i) { layout.run(100); }
+      ASSERT_EQ(layout.get_number_of_iterations(), 500);
+      raft::copy(d_pos.data(), layout.positions(), d_pos.size(), handle.get_stream());
+    } else {
+      cugraph::force_atlas2(handle,
+                            graph_view,
+                            d_pos.data(),
+                            500,
+                            static_cast<float const*>(nullptr),
+                            static_cast<float const*>(nullptr),
+                            false,
+                            false,
+                            false,
+                            1.0f,
+                            1.0f,
+                            1.0f,
+                            2.0f,
+                            false,
+                            1.0f,
+                            false);
+    }
+
+    std::vector<float> h_pos(m * 2);
+    raft::update_host(h_pos.data(), d_pos.data(), h_pos.size(), handle.get_stream());
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+
+    std::vector<std::vector<double>> C_contiguous_embedding(m, std::vector<double>(2));
+    for (int i = 0; i < m; i++) {
+      for (int j = 0; j < 2; j++) C_contiguous_embedding[i][j] = h_pos[j * m + i];
+    }
+
+    double score_bh = trustworthiness_score(adj_matrix, C_contiguous_embedding, m, 2, 5);
+    ASSERT_GT(score_bh, param.score);
+  }
 };
 
 std::vector<double> Tests_Force_Atlas2::force_atlas2_time;
@@ -228,6 +297,16 @@ TEST_P(Tests_Force_Atlas2, CheckFP32_T) { run_current_test<float>(GetParam()); }
 
 TEST_P(Tests_Force_Atlas2, CheckFP64_T) { run_current_test<double>(GetParam()); }
 
+TEST_P(Tests_Force_Atlas2, CheckFP32_T_Experimental)
+{
+  run_current_test_experimental<float>(GetParam(), false);
+}
+
+TEST_P(Tests_Force_Atlas2, CheckFP32_T_Experimental_Chunked)
+{
+  run_current_test_experimental<float>(GetParam(), true);
+}
+
 // --gtest_filter=*simple_test*
 INSTANTIATE_TEST_CASE_P(simple_test,
                         Tests_Force_Atlas2,
@@ -17,6 +17,7 @@
 
 #include <algorithms.hpp>
 #include <graph.hpp>
+#include <utilities/error.hpp>
 
 #include <raft/handle.hpp>
 
@@ -24,6 +25,11 @@
 
 #include <curand_kernel.h>
 
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
 __global__ void setup_generator(curandState *state)
 {
   int id = threadIdx.x + blockIdx.x * blockDim.x;
@@ -238,6 +244,206 @@ TEST_F(HungarianTest, PythonTestFailure)
   EXPECT_EQ(min_cost, r);
 }
 
+TEST_F(HungarianTest, BatchedDense)
+{
+  raft::handle_t handle{};
+
+  int32_t num_problems = 300;
+  int32_t size         = 50;
+
+  for (size_t padding : {size_t{0}, size_t{17}}) {
+    size_t stride = static_cast<size_t>(size) * size + padding;
+
+    std::mt19937 gen(43);
+    std::uniform_int_distribution<int32_t> dist(1, 1000);
+    std::vector<float> h_costs(num_problems * stride);
+    std::generate(h_costs.begin(), h_costs.end(), [&]() { return static_cast<float>(dist(gen)); });
+
+    rmm::device_vector<float> costs_v(h_costs);
+    rmm::device_vector<int32_t> assignments_v(num_problems * size);
+    rmm::device_vector<float> min_costs_v(num_problems);
+
+    cugraph::dense::batched_hungarian(handle,
+                                      costs_v.data().get(),
+                                      num_problems,
+                                      size,
+                                      stride,
+                                      assignments_v.data().get(),
+                                      min_costs_v.data().get());
+
+    std::vector<int32_t> h_assignments(assignments_v.size());
+    std::vector<float> h_min_costs(min_costs_v.size());
+    thrust::copy(assignments_v.begin(), assignments_v.end(), h_assignments.begin());
+    thrust::copy(min_costs_v.begin(), min_costs_v.end(), h_min_costs.begin());
+
+    rmm::device_vector<int32_t> assignment_v(size);
+    for (int32_t i = 0; i < num_problems; ++i) {
+      float r = cugraph::dense::hungarian(
+        handle, costs_v.data().get() + i * stride, size, size, assignment_v.data().get());
+      EXPECT_EQ(r, h_min_costs[i]);
+
+      std::vector<bool> assigned(size, false);
+      float cost{0};
+      for (int32_t row = 0; row < size; ++row) {
+        auto col = h_assignments[i * size + row];
+        ASSERT_TRUE((col >= 0) && (col < size));
+        EXPECT_FALSE(assigned[col]);
+        assigned[col] = true;
+        cost += h_costs[i * stride + row * size + col];
+      }
+      EXPECT_EQ(cost, h_min_costs[i]);
+    }
+  }
+}
+
+TEST_F(HungarianTest, SparseBipartite5x5)
+{
+  raft::handle_t handle{};
+
+  int32_t src_data[] = {0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4};
+  int32_t dst_data[] = {5, 6, 7, 8, 9, 5, 6, 7, 8, 9, 5, 6, 7, 8, 9, 5, 6, 7, 8, 9, 5, 6, 7, 8, 9};
+  float cost[] = {11.0, 7.0,  10.0, 17.0, 10.0, 13.0, 21.0, 7.0,  11.0, 13.0, 13.0, 13.0, 15.0,
+                  13.0, 14.0, 18.0, 10.0, 13.0, 16.0, 14.0, 12.0, 8.0,  16.0, 19.0, 10.0};
+
+  int32_t workers[] = {0, 1, 2, 3, 4};
+
+  float min_cost     = 51.0;
+  int32_t expected[] = {5, 7, 8, 6, 9};
+
+  int32_t length         = sizeof(src_data) / sizeof(src_data[0]);
+  int32_t length_workers = sizeof(workers) / sizeof(workers[0]);
+  int32_t num_vertices   = 1 + std::max(*std::max_element(src_data, src_data + length),
+                                      *std::max_element(dst_data, dst_data + length));
+
+  rmm::device_vector<int32_t> src_v(src_data, src_data + length);
+  rmm::device_vector<int32_t> dst_v(dst_data, dst_data + length);
+  rmm::device_vector<float> cost_v(cost, cost + length);
+  rmm::device_vector<int32_t> workers_v(workers, workers + length_workers);
+  rmm::device_vector<int32_t> expected_v(expected, expected + length_workers);
+  rmm::device_vector<int32_t> assignment_v(length_workers);
+
+  cugraph::GraphCOOView<int32_t, int32_t, float> g(
+    src_v.data().get(), dst_v.data().get(), cost_v.data().get(), num_vertices, length);
+
+  float r = cugraph::sparse::hungarian(
+    handle, g, length_workers, workers_v.data().get(), assignment_v.data().get());
+
+  EXPECT_EQ(min_cost, r);
+  EXPECT_EQ(expected_v, assignment_v);
+}
+
+TEST_F(HungarianTest, SparseRectangular)
+{
+  raft::handle_t handle{};
+
+  // 3 workers, 5 tasks, not every worker is connected to every task
+  int32_t src_data[] = {0, 0, 1, 1, 2, 2, 2};
+  int32_t dst_data[] = {3, 4, 4, 5, 4, 6, 7};
+  float cost[]       = {4.0, 2.0, 1.0, 5.0, 3.0, 6.0, 2.0};
+
+  int32_t workers[] = {0, 1, 2};
+
+  float min_cost     = 7.0;
+  int32_t expected[] = {3, 4, 7};
+
+  int32_t length         = sizeof(src_data) / sizeof(src_data[0]);
+  int32_t length_workers = sizeof(workers) / sizeof(workers[0]);
+  int32_t num_vertices   = 8;
+
+  rmm::device_vector<int32_t> src_v(src_data, src_data + length);
+  rmm::device_vector<int32_t> dst_v(dst_data, dst_data + length);
+  rmm::device_vector<float> cost_v(cost, cost + length);
+  rmm::device_vector<int32_t> workers_v(workers, workers + length_workers);
+  rmm::device_vector<int32_t> expected_v(expected, expected + length_workers);
+  rmm::device_vector<int32_t> assignment_v(length_workers);
+
+  cugraph::GraphCOOView<int32_t, int32_t, float> g(
+    src_v.data().get(), dst_v.data().get(), cost_v.data().get(), num_vertices, length);
+
+  float r = cugraph::sparse::hungarian(
+    handle, g, length_workers, workers_v.data().get(), assignment_v.data().get());
+
+  EXPECT_EQ(min_cost, r);
+  EXPECT_EQ(expected_v, assignment_v);
+}
+
+TEST_F(HungarianTest, SparseInfeasible)
+{
+  raft::handle_t handle{};
+
+  // both workers can only take task 2
+  int32_t src_data[] = {0, 1};
+  int32_t dst_data[] = {2, 2};
+  float cost[]       = {1.0, 1.0};
+
+  int32_t workers[] = {0, 1};
+
+  int32_t length         = sizeof(src_data) / sizeof(src_data[0]);
+  int32_t length_workers = sizeof(workers) / sizeof(workers[0]);
+  int32_t num_vertices   = 4;
+
+  rmm::device_vector<int32_t> src_v(src_data, src_data + length);
+  rmm::device_vector<int32_t> dst_v(dst_data, dst_data + length);
+  rmm::device_vector<float> cost_v(cost, cost + length);
+  rmm::device_vector<int32_t> workers_v(workers, workers + length_workers);
+  rmm::device_vector<int32_t> assignment_v(length_workers);
+
+  cugraph::GraphCOOView<int32_t, int32_t, float> g(
+    src_v.data().get(), dst_v.data().get(), cost_v.data().get(), num_vertices, length);
+
+  EXPECT_THROW(cugraph::sparse::hungarian(
+                 handle, g, length_workers, workers_v.data().get(), assignment_v.data().get()),
+               cugraph::logic_error);
+}
+
+TEST_F(HungarianTest, SparseVsDense)
+{
+  raft::handle_t handle{};
+
+  int32_t num_workers = 40;
+
+  std::mt19937 gen(43);
+  std::uniform_int_distribution<int32_t> dist(1, 100);
+
+  std::vector<int32_t> h_src{};
+  std::vector<int32_t> h_dst{};
+  std::vector<float> h_cost{};
+  for (int32_t w = 0; w < num_workers; ++w) {
+    for (int32_t t = 0; t < num_workers; ++t) {
+      h_src.push_back(w);
+      h_dst.push_back(num_workers + t);
+      h_cost.push_back(static_cast<float>(dist(gen)));
+    }
+  }
+
+  std::vector<int32_t> h_workers(num_workers);
+  std::iota(h_workers.begin(), h_workers.end(), int32_t{0});
+
+  rmm::device_vector<int32_t> src_v(h_src);
+  rmm::device_vector<int32_t> dst_v(h_dst);
+  rmm::device_vector<float> cost_v(h_cost);
+  rmm::device_vector<int32_t> workers_v(h_workers);
+  rmm::device_vector<int32_t> assignment_v(num_workers);
+
+  cugraph::GraphCOOView<int32_t, int32_t, float> g(src_v.data().get(),
+                                                   dst_v.data().get(),
+                                                   cost_v.data().get(),
+                                                   2 * num_workers,
+                                                   static_cast<int32_t>(h_src.size()));
+
+  float expected = cugraph::hungarian(
+    handle, g, num_workers, workers_v.data().get(), assignment_v.data().get());
+  float r = cugraph::sparse::hungarian(
+    handle, g, num_workers, workers_v.data().get(), assignment_v.data().get());
+
+  EXPECT_EQ(expected, r);
+
+  std::vector<int32_t> h_assignment(num_workers);
+  thrust::copy(assignment_v.begin(), assignment_v.end(), h_assignment.begin());
+  std::sort(h_assignment.begin(), h_assignment.end());
+  EXPECT_EQ(std::adjacent_find(h_assignment.begin(), h_assignment.end()), h_assignment.end());
+}
+
 // FIXME:  Need to have tests with nxm (e.g. 4x5 and 5x4) to test those conditions
 
 #if 0
@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+#include <utilities/test_utilities.hpp>
+
+#include <algorithms.hpp>
+#include <graph.hpp>
+#include <utilities/heap.cuh>
+
+#include <raft/cudart_utils.h>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+TEST(heap, bounded_top_k)
+{
+  size_t constexpr k{16};
+
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<int> distribution(0, 999);
+
+  std::vector<int> values(1000);
+  std::generate(values.begin(), values.end(), [&rng, &distribution]() {
+    return distribution(rng);
+  });
+
+  // a min-heap of the (at most) k largest values, the top is the smallest kept value
+  std::vector<int> heap(k);
+  size_t size{0};
+  auto compare = std::less<int>{};
+  for (auto value : values) {
+    if (size < k) {
+      cugraph::detail::heap::heap_push(heap.data(), size, value, compare);
+      ++size;
+    } else if (compare(heap[0], value)) {
+      cugraph::detail::heap::heap_replace_top(heap.data(), size, value, compare);
+    }
+    ASSERT_EQ(heap[0], *std::min_element(heap.begin(), heap.begin() + size))
+      << "The top of the heap is not the smallest element.";
+  }
+
+  std::vector<int> popped{};
+  for (; size > 0; --size) {
+    popped.push_back(cugraph::detail::heap::heap_pop(heap.data(), size, compare));
+  }
+
+  std::vector<int> reference(values);
+  std::sort(reference.begin(), reference.end(), std::greater<int>{});
+  reference.resize(k);
+  std::reverse(reference.begin(), reference.end());
+
+  ASSERT_EQ(popped, reference) << "The heap does not hold the k largest values.";
+}
+
+typedef struct TopKSimilarity_Usecase_t {
+  std::string graph_file_full_path{};
+  int32_t k{0};
+  size_t max_pairs_per_batch{0};
+  // the two hop paths of a hub vertex span multiple batches and a pair appears in multiple batches
+  bool expect_batch_spanning{false};
+
+  TopKSimilarity_Usecase_t(std::string const& graph_file_path,
+                           int32_t k,
+                           size_t max_pairs_per_batch,
+                           bool expect_batch_spanning)
+    : k(k), max_pairs_per_batch(max_pairs_per_batch), expect_batch_spanning(expect_batch_spanning)
+  {
+    if ((graph_file_path.length() > 0) && (graph_file_path[0] != '/')) {
+      graph_file_full_path = cugraph::test::get_rapids_dataset_root_dir() + "/" + graph_file_path;
+    } else {
+      graph_file_full_path = graph_file_path;
+    }
+  };
+} TopKSimilarity_Usecase;
+
+// check whether the two hop paths (u, w, x), in the order they are expanded (by edge (u, w) and
+// then by x), of some vertex u span multiple batches, and whether some pair (u, x) is reached in
+// multiple batches
+template <typename vertex_t, typename edge_t>
+std::tuple<bool, bool> spans_batches(std::vector<edge_t> const& offsets,
+                                     std::vector<vertex_t> const& indices,
+                                     size_t max_pairs_per_batch)
+{
+  bool vertex_spans{false};
+  bool pair_spans{false};
+  size_t wedge_idx{0};
+  for (vertex_t u = 0; u < static_cast<vertex_t>(offsets.size() - 1); ++u) {
+    auto u_first_batch = wedge_idx / max_pairs_per_batch;
+    std::map<vertex_t, std::set<size_t>> pair_batches{};
+    for (auto e = offsets[u]; e < offsets[u + 1]; ++e) {
+      auto w = indices[e];
+      for (auto f = offsets[w]; f < offsets[w + 1]; ++f) {
+        if (indices[f] != u) { pair_batches[indices[f]].insert(wedge_idx / max_pairs_per_batch); }
+        ++wedge_idx;
+      }
+    }
+    if ((wedge_idx > 0) && ((wedge_idx - 1) / max_pairs_per_batch != u_first_batch)) {
+      vertex_spans = true;
+    }
+    for (auto const& pair : pair_batches) {
+      if (pair.second.size() > 1) { pair_spans = true; }
+    }
+  }
+  return std::make_tuple(vertex_spans, pair_spans);
+}
+
+class Tests_TopKSimilarity : public ::testing::TestWithParam<TopKSimilarity_Usecase> {
+ public:
+  Tests_TopKSimilarity() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_current_test(TopKSimilarity_Usecase const& configuration, bool overlap)
+  {
+    bool directed{false};
+    auto graph = cugraph::test::generate_graph_csr_from_mm<vertex_t, edge_t, weight_t>(
+      directed, configuration.graph_file_full_path);
+    auto graph_view = graph->view();
+
+    std::vector<edge_t> h_offsets(graph_view.number_of_vertices + 1);
+    std::vector<vertex_t> h_indices(graph_view.number_of_edges);
+    raft::update_host(
+      h_offsets.data(), graph_view.offsets, graph_view.number_of_vertices + 1, nullptr);
+    raft::update_host(h_indices.data(), graph_view.indices, graph_view.number_of_edges, nullptr);
+    CUDA_TRY(cudaStreamSynchronize(nullptr));
+
+    for (vertex_t u = 0; u < graph_view.number_of_vertices; ++u) {
+      ASSERT_TRUE(
+        std::is_sorted(h_indices.begin() + h_offsets[u], h_indices.begin() + h_offsets[u + 1]))
+        << "Test precondition failure: column indices should be sorted within each row.";
+    }
+
+    if (configuration.expect_batch_spanning) {
+      bool vertex_spans{false};
+      bool pair_spans{false};
+      std::tie(vertex_spans, pair_spans) =
+        spans_batches(h_offsets, h_indices, configuration.max_pairs_per_batch);
+      ASSERT_TRUE(vertex_spans && pair_spans)
+        << "Test precondition failure: max_pairs_per_batch is too large to span batches.";
+    }
+
+    // 1. reference: get_two_hop_neighbors, jaccard_list/overlap_list, and per vertex top-K
+
+    auto two_hop      = cugraph::get_two_hop_neighbors(graph_view);
+    auto two_hop_view = two_hop->view();
+    auto num_pairs    = two_hop_view.number_of_edges;
+
+    rmm::device_vector<weight_t> d_pair_scores(num_pairs);
+    if (overlap) {
+      cugraph::overlap_list(graph_view,
+                            static_cast<weight_t const*>(nullptr),
+                            num_pairs,
+                            two_hop_view.src_indices,
+                            two_hop_view.dst_indices,
+                            d_pair_scores.data().get());
+    } else {
+      cugraph::jaccard_list(graph_view,
+                            static_cast<weight_t const*>(nullptr),
+                            num_pairs,
+                            two_hop_view.src_indices,
+                            two_hop_view.dst_indices,
+                            d_pair_scores.data().get());
+    }
+
+    std::vector<vertex_t> h_pair_firsts(num_pairs);
+    std::vector<vertex_t> h_pair_seconds(num_pairs);
+    std::vector<weight_t> h_pair_scores(num_pairs);
+    raft::update_host(h_pair_firsts.data(), two_hop_view.src_indices, num_pairs, nullptr);
+    raft::update_host(h_pair_seconds.data(), two_hop_view.dst_indices, num_pairs, nullptr);
+    raft::update_host(h_pair_scores.data(), d_pair_scores.data().get(), num_pairs, nullptr);
+    CUDA_TRY(cudaStreamSynchronize(nullptr));
+
+    std::vector<std::map<vertex_t, weight_t>> reference_scores(graph_view.number_of_vertices);
+    for (edge_t i = 0; i < num_pairs; ++i) {
+      if (h_pair_firsts[i] != h_pair_seconds[i]) {
+        reference_scores[h_pair_firsts[i]][h_pair_seconds[i]] = h_pair_scores[i];
+      }
+    }
+
+    // 2. top-K
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    auto result =
+      overlap ? cugraph::overlap_top_k(graph_view,
+                                       static_cast<weight_t const*>(nullptr),
+                                       static_cast<vertex_t>(configuration.k),
+                                       configuration.max_pairs_per_batch)
+              : cugraph::jaccard_top_k(graph_view,
+                                       static_cast<weight_t const*>(nullptr),
+                                       static_cast<vertex_t>(configuration.k),
+                                       configuration.max_pairs_per_batch);
+
+    CUDA_TRY(cudaDeviceSynchronize());  // for consistent performance measurement
+
+    auto result_view = result->view();
+    std::vector<vertex_t> h_srcs(result_view.number_of_edges);
+    std::vector<vertex_t> h_dsts(result_view.number_of_edges);
+    std::vector<weight_t> h_scores(result_view.number_of_edges);
+    raft::update_host(h_srcs.data(), result_view.src_indices, h_srcs.size(), nullptr);
+    raft::update_host(h_dsts.data(), result_view.dst_indices, h_dsts.size(), nullptr);
+    raft::update_host(h_scores.data(), result_view.edge_data, h_scores.size(), nullptr);
+    CUDA_TRY(cudaStreamSynchronize(nullptr));
+
+    // 3. compare
+
+    auto nearly_equal = [](weight_t lhs, weight_t rhs) {
+      return std::abs(lhs - rhs) <=
+             std::max(std::max(std::abs(lhs), std::abs(rhs)) * weight_t{1e-4}, weight_t{1e-6});
+    };
+
+    ASSERT_TRUE(std::is_sorted(h_srcs.begin(), h_srcs.end()))
+      << "The top-K candidates are not ordered by the first vertex.";
+
+    size_t offset{0};
+    for (vertex_t u = 0; u < graph_view.number_of_vertices; ++u) {
+      std::vector<weight_t> sorted_reference_scores{};
+      for (auto const& candidate : reference_scores[u]) {
+        sorted_reference_scores.push_back(candidate.second);
+      }
+      std::sort(
+        sorted_reference_scores.begin(), sorted_reference_scores.end(), std::greater<weight_t>{});
+      auto num_candidates =
+        std::min(sorted_reference_scores.size(), static_cast<size_t>(configuration.k));
+
+      auto first = offset;
+      while ((offset < h_srcs.size()) && (h_srcs[offset] == u)) { ++offset; }
+      ASSERT_EQ(offset - first, num_candidates)
+        << "The number of top-K candidates of vertex " << u << " does not match.";
+
+      std::set<vertex_t> dsts{};
+      for (size_t i = 0; i < num_candidates; ++i) {
+        auto x = h_dsts[first + i];
+        ASSERT_TRUE(dsts.insert(x).second)
+          << "Vertex " << x << " appears multiple times in the top-K candidates of vertex " << u
+          << ".";
+        auto it = reference_scores[u].find(x);
+        ASSERT_TRUE(it != reference_scores[u].end())
+          << "(" << u << ", " << x << ") is not a two hop pair.";
+        ASSERT_TRUE(nearly_equal(h_scores[first + i], it->second))
+          << "(" << u << ", " << x << ") has score: " << h_scores[first + i]
+          << " different from the reference value: " << it->second;
+        // ties at the k-th place can be broken differently
+        ASSERT_TRUE(nearly_equal(h_scores[first + i], sorted_reference_scores[i]))
+          << "The " << i << "-th best score of vertex " << u << ": " << h_scores[first + i]
+          << " is different from the reference value: " << sorted_reference_scores[i];
+      }
+    }
+    ASSERT_EQ(offset, h_srcs.size());
+  }
+};
+
+TEST_P(Tests_TopKSimilarity, CheckJaccardInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam(), false);
+}
+
+TEST_P(Tests_TopKSimilarity, CheckOverlapInt32Int32Float)
+{
+  run_current_test<int32_t, int32_t, float>(GetParam(), true);
+}
+
+TEST_P(Tests_TopKSimilarity, CheckJaccardInt32Int32Double)
+{
+  run_current_test<int32_t, int32_t, double>(GetParam(), false);
+}
+
+INSTANTIATE_TEST_CASE_P(
+  simple_test,
+  Tests_TopKSimilarity,
+  ::testing::Values(
+    // a single batch
+    TopKSimilarity_Usecase("test/datasets/karate.mtx", 5, size_t{1} << 26, false),
+    TopKSimilarity_Usecase("test/datasets/dolphins.mtx", 3, size_t{1} << 26, false),
+    // the two hop paths of the hub vertices (e.g. vertex 33 in karate) span multiple batches
+    TopKSimilarity_Usecase("test/datasets/karate.mtx", 5, 37, true),
+    TopKSimilarity_Usecase("test/datasets/karate.mtx", 1, 64, true),
+    TopKSimilarity_Usecase("test/datasets/dolphins.mtx", 3, 50, true),
+    TopKSimilarity_Usecase("test/datasets/netscience.mtx", 10, 1000, true)));
+
+CUGRAPH_TEST_PROGRAM_MAIN()
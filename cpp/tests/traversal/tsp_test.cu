@@ -113,7 +113,7 @@ class Tests_Tsp : public ::testing::TestWithParam<Tsp_Usecase> {
   virtual void SetUp() {}
   virtual void TearDown() {}
 
-  void run_current_test(const Tsp_Usecase& param)
+  void run_current_test(const Tsp_Usecase& param, bool neighbor_list_search = false)
   {
     const ::testing::TestInfo* const test_info =
       ::testing::UnitTest::GetInstance()->current_test_info();
@@ -123,7 +123,8 @@ class Tests_Tsp : public ::testing::TestWithParam<Tsp_Usecase> {
                           cugraph::test::getFileName(param.tsp_file) + std::string("_") +
                           ss.str().c_str();
 
-    float tol = 1E-1f;
+    // neighbor list restricted 2-opt explores a subset of the 2-opt moves
+    float tol = neighbor_list_search ? 2E-1f : 1E-1f;
     HighResClock hr_clock;
     double time_tmp;
     Route input;
@@ -161,8 +162,18 @@ class Tests_Tsp : public ::testing::TestWithParam<Tsp_Usecase> {
     cudaDeviceSynchronize();
     cudaProfilerStart();
 
-    float final_cost = cugraph::traveling_salesperson(
-      handle, vtx_ptr, d_x_pos, d_y_pos, nodes, restarts, beam_search, k, nstart, verbose, d_route);
+    float final_cost = cugraph::traveling_salesperson(handle,
+                                                      vtx_ptr,
+                                                      d_x_pos,
+                                                      d_y_pos,
+                                                      nodes,
+                                                      restarts,
+                                                      beam_search,
+                                                      k,
+                                                      nstart,
+                                                      verbose,
+                                                      d_route,
+                                                      neighbor_list_search);
     cudaProfilerStop();
     cudaDeviceSynchronize();
     hr_clock.stop(&time_tmp);
@@ -242,5 +253,7 @@ class Tests_Tsp : public ::testing::TestWithParam<Tsp_Usecase> {
 
 TEST_P(Tests_Tsp, CheckFP32_T) { run_current_test(GetParam()); }
 
+TEST_P(Tests_Tsp, CheckFP32_T_NeighborList) { run_current_test(GetParam(), true); }
+
 INSTANTIATE_TEST_CASE_P(simple_test, Tests_Tsp, ::testing::ValuesIn(euc_2d));
 CUGRAPH_TEST_PROGRAM_MAIN()
@@ -48,7 +48,10 @@ generate_graph_from_edgelist_impl(raft::handle_t const& handle,
                                   rmm::device_uvector<weight_t>&& edgelist_weights,
                                   bool is_symmetric,
                                   bool test_weighted,
-                                  bool renumber)
+                                  bool renumber,
+                                  vertex_t const* hub_vertices,
+                                  int const* hub_gpu_ids,
+                                  vertex_t num_hubs)
 {
   CUGRAPH_EXPECTS(renumber, "renumber should be true if multi_gpu is true.");
 
@@ -63,7 +66,8 @@ generate_graph_from_edgelist_impl(raft::handle_t const& handle,
   auto local_partition_id_op =
     [comm_size,
      key_func = cugraph::experimental::detail::compute_partition_id_from_edge_t<vertex_t>{
-       comm_size, row_comm_size, col_comm_size}] __device__(auto pair) {
+       comm_size, row_comm_size, col_comm_size, hub_vertices, hub_gpu_ids, num_hubs}] __device__(
+      auto pair) {
       return key_func(thrust::get<0>(pair), thrust::get<1>(pair)) /
              comm_size;  // global partition id to local partition id
     };
@@ -118,6 +122,9 @@ generate_graph_from_edgelist_impl(raft::handle_t const& handle,
         major_ptrs,
         minor_ptrs,
         counts,
+        hub_vertices,
+        hub_gpu_ids,
+        num_hubs,
         true);
   }
 
@@ -164,7 +171,10 @@ generate_graph_from_edgelist_impl(raft::handle_t const& handle,
                                   rmm::device_uvector<weight_t>&& edgelist_weights,
                                   bool is_symmetric,
                                   bool test_weighted,
-                                  bool renumber)
+                                  bool renumber,
+                                  vertex_t const* hub_vertices,
+                                  int const* hub_gpu_ids,
+                                  vertex_t num_hubs)
 {
   vertex_t number_of_vertices = static_cast<vertex_t>(vertices.size());
 
@@ -212,7 +222,10 @@ generate_graph_from_edgelist(raft::handle_t const& handle,
                              rmm::device_uvector<weight_t>&& edgelist_weights,
                              bool is_symmetric,
                              bool test_weighted,
-                             bool renumber)
+                             bool renumber,
+                             vertex_t const* hub_vertices,
+                             int const* hub_gpu_ids,
+                             vertex_t num_hubs)
 {
   return generate_graph_from_edgelist_impl<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
     handle,
@@ -222,7 +235,10 @@ generate_graph_from_edgelist(raft::handle_t const& handle,
     std::move(edgelist_weights),
     is_symmetric,
     test_weighted,
-    renumber);
+    renumber,
+    hub_vertices,
+    hub_gpu_ids,
+    num_hubs);
 }
 
 // explicit instantiations
@@ -237,7 +253,10 @@ generate_graph_from_edgelist<int32_t, int32_t, float, false, false>(
   rmm::device_uvector<float>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int32_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int32_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int32_t, float, false, true>,
                     rmm::device_uvector<int32_t>>
@@ -249,7 +268,10 @@ generate_graph_from_edgelist<int32_t, int32_t, float, false, true>(
   rmm::device_uvector<float>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int32_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int32_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int32_t, float, true, false>,
                     rmm::device_uvector<int32_t>>
@@ -261,7 +283,10 @@ generate_graph_from_edgelist<int32_t, int32_t, float, true, false>(
   rmm::device_uvector<float>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int32_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int32_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int32_t, float, true, true>,
                     rmm::device_uvector<int32_t>>
@@ -273,7 +298,10 @@ generate_graph_from_edgelist<int32_t, int32_t, float, true, true>(
   rmm::device_uvector<float>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int32_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int32_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int32_t, double, false, false>,
                     rmm::device_uvector<int32_t>>
@@ -285,7 +313,10 @@ generate_graph_from_edgelist<int32_t, int32_t, double, false, false>(
   rmm::device_uvector<double>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int32_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int32_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int32_t, double, false, true>,
                     rmm::device_uvector<int32_t>>
@@ -297,7 +328,10 @@ generate_graph_from_edgelist<int32_t, int32_t, double, false, true>(
   rmm::device_uvector<double>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int32_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int32_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int32_t, double, true, false>,
                     rmm::device_uvector<int32_t>>
@@ -309,7 +343,10 @@ generate_graph_from_edgelist<int32_t, int32_t, double, true, false>(
   rmm::device_uvector<double>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int32_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int32_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int32_t, double, true, true>,
                     rmm::device_uvector<int32_t>>
@@ -321,7 +358,10 @@ generate_graph_from_edgelist<int32_t, int32_t, double, true, true>(
   rmm::device_uvector<double>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int32_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int32_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int64_t, float, false, false>,
                     rmm::device_uvector<int32_t>>
@@ -333,7 +373,10 @@ generate_graph_from_edgelist<int32_t, int64_t, float, false, false>(
   rmm::device_uvector<float>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int32_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int32_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int64_t, float, false, true>,
                     rmm::device_uvector<int32_t>>
@@ -345,7 +388,10 @@ generate_graph_from_edgelist<int32_t, int64_t, float, false, true>(
   rmm::device_uvector<float>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int32_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int32_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int64_t, float, true, false>,
                     rmm::device_uvector<int32_t>>
@@ -357,7 +403,10 @@ generate_graph_from_edgelist<int32_t, int64_t, float, true, false>(
   rmm::device_uvector<float>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int32_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int32_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int64_t, float, true, true>,
                     rmm::device_uvector<int32_t>>
@@ -369,7 +418,10 @@ generate_graph_from_edgelist<int32_t, int64_t, float, true, true>(
   rmm::device_uvector<float>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int32_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int32_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int64_t, double, false, false>,
                     rmm::device_uvector<int32_t>>
@@ -381,7 +433,10 @@ generate_graph_from_edgelist<int32_t, int64_t, double, false, false>(
   rmm::device_uvector<double>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int32_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int32_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int64_t, double, false, true>,
                     rmm::device_uvector<int32_t>>
@@ -393,7 +448,10 @@ generate_graph_from_edgelist<int32_t, int64_t, double, false, true>(
   rmm::device_uvector<double>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int32_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int32_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int64_t, double, true, false>,
                     rmm::device_uvector<int32_t>>
@@ -405,7 +463,10 @@ generate_graph_from_edgelist<int32_t, int64_t, double, true, false>(
   rmm::device_uvector<double>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int32_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int32_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int64_t, double, true, true>,
                     rmm::device_uvector<int32_t>>
@@ -417,7 +478,10 @@ generate_graph_from_edgelist<int32_t, int64_t, double, true, true>(
   rmm::device_uvector<double>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int32_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int32_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int64_t, int64_t, float, false, false>,
                     rmm::device_uvector<int64_t>>
@@ -429,7 +493,10 @@ generate_graph_from_edgelist<int64_t, int64_t, float, false, false>(
   rmm::device_uvector<float>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int64_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int64_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int64_t, int64_t, float, false, true>,
                     rmm::device_uvector<int64_t>>
@@ -441,7 +508,10 @@ generate_graph_from_edgelist<int64_t, int64_t, float, false, true>(
   rmm::device_uvector<float>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int64_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int64_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int64_t, int64_t, float, true, false>,
                     rmm::device_uvector<int64_t>>
@@ -453,7 +523,10 @@ generate_graph_from_edgelist<int64_t, int64_t, float, true, false>(
   rmm::device_uvector<float>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int64_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int64_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int64_t, int64_t, float, true, true>,
                     rmm::device_uvector<int64_t>>
@@ -465,7 +538,10 @@ generate_graph_from_edgelist<int64_t, int64_t, float, true, true>(
   rmm::device_uvector<float>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int64_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int64_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int64_t, int64_t, double, false, false>,
                     rmm::device_uvector<int64_t>>
@@ -477,7 +553,10 @@ generate_graph_from_edgelist<int64_t, int64_t, double, false, false>(
   rmm::device_uvector<double>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int64_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int64_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int64_t, int64_t, double, false, true>,
                     rmm::device_uvector<int64_t>>
@@ -489,7 +568,10 @@ generate_graph_from_edgelist<int64_t, int64_t, double, false, true>(
   rmm::device_uvector<double>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int64_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int64_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int64_t, int64_t, double, true, false>,
                     rmm::device_uvector<int64_t>>
@@ -501,7 +583,10 @@ generate_graph_from_edgelist<int64_t, int64_t, double, true, false>(
   rmm::device_uvector<double>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int64_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int64_t num_hubs);
 
 template std::tuple<cugraph::experimental::graph_t<int64_t, int64_t, double, true, true>,
                     rmm::device_uvector<int64_t>>
@@ -513,7 +598,10 @@ generate_graph_from_edgelist<int64_t, int64_t, double, true, true>(
   rmm::device_uvector<double>&& edgelist_weights,
   bool is_symmetric,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  int64_t const* hub_vertices,
+  int const* hub_gpu_ids,
+  int64_t num_hubs);
 
 }  // namespace test
 }  // namespace cugraph
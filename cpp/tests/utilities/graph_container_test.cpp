@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utilities/base_fixture.hpp>
+
+#include <utilities/cython.hpp>
+
+#include <raft/cudart_utils.h>
+#include <raft/handle.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Tests the graph_t instances cached in a graph_container_t (held by the caller across wrapper
+// calls) are reused and rebuilt as expected.
+class Tests_GraphContainer : public ::testing::Test {
+ public:
+  Tests_GraphContainer() {}
+  static void SetupTestCase() {}
+  static void TearDownTestCase() {}
+
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  template <typename weight_t>
+  void pagerank(raft::handle_t const& handle, cugraph::cython::graph_container_t const& container)
+  {
+    rmm::device_uvector<int32_t> d_identifiers(num_vertices, handle.get_stream());
+    rmm::device_uvector<weight_t> d_pageranks(num_vertices, handle.get_stream());
+    cugraph::cython::call_pagerank(handle,
+                                   container,
+                                   d_identifiers.data(),
+                                   d_pageranks.data(),
+                                   int32_t{0},
+                                   static_cast<int32_t*>(nullptr),
+                                   static_cast<weight_t*>(nullptr),
+                                   0.85,
+                                   1e-6,
+                                   int64_t{500},
+                                   false);
+    CUDA_TRY(cudaStreamSynchronize(handle.get_stream()));
+  }
+
+  // SG, unweighted, and transposed (PageRank uses the cached_graphs[1] slot)
+  std::shared_ptr<cugraph::cython::graph_container_t> create_container(raft::handle_t& handle)
+  {
+    auto container = cugraph::cython::create_graph_container();
+    cugraph::cython::populate_graph_container(*container,
+                                              handle,
+                                              d_srcs->data(),
+                                              d_dsts->data(),
+                                              nullptr,
+                                              nullptr,
+                                              cugraph::cython::numberTypeEnum::int32Type,
+                                              cugraph::cython::numberTypeEnum::int32Type,
+                                              cugraph::cython::numberTypeEnum::floatType,
+                                              h_srcs.size(),
+                                              static_cast<size_t>(num_vertices),
+                                              h_srcs.size(),
+                                              false,
+                                              false,
+                                              true,
+                                              false);
+    return container;
+  }
+
+  void create_edgelist(raft::handle_t const& handle)
+  {
+    d_srcs = std::make_unique<rmm::device_uvector<int32_t>>(h_srcs.size(), handle.get_stream());
+    d_dsts = std::make_unique<rmm::device_uvector<int32_t>>(h_dsts.size(), handle.get_stream());
+    raft::update_device(d_srcs->data(), h_srcs.data(), h_srcs.size(), handle.get_stream());
+    raft::update_device(d_dsts->data(), h_dsts.data(), h_dsts.size(), handle.get_stream());
+  }
+
+  int32_t num_vertices{6};
+  std::vector<int32_t> h_srcs{0, 1, 1, 2, 2, 3, 4, 5};
+  std::vector<int32_t> h_dsts{1, 2, 3, 0, 4, 5, 5, 0};
+  std::unique_ptr<rmm::device_uvector<int32_t>> d_srcs{};
+  std::unique_ptr<rmm::device_uvector<int32_t>> d_dsts{};
+};
+
+TEST_F(Tests_GraphContainer, Reuse)
+{
+  raft::handle_t handle{};
+  create_edgelist(handle);
+  auto container = create_container(handle);
+
+  ASSERT_FALSE(container->cached_graphs[0].graph_ptr);
+  ASSERT_FALSE(container->cached_graphs[1].graph_ptr);
+
+  pagerank<float>(handle, *container);
+  auto graph_ptr = container->cached_graphs[1].graph_ptr;
+  ASSERT_TRUE(graph_ptr);
+  ASSERT_EQ(container->cached_graphs[1].handle_ptr, &handle);
+  ASSERT_FALSE(container->cached_graphs[0].graph_ptr)
+    << "The non-transposed slot should stay empty.";
+
+  // the second call should not rebuild the graph_t instance (the edge list is no longer needed)
+  d_srcs.reset();
+  d_dsts.reset();
+  pagerank<float>(handle, *container);
+  ASSERT_EQ(container->cached_graphs[1].graph_ptr, graph_ptr);
+}
+
+TEST_F(Tests_GraphContainer, RebuildOnTypeMismatch)
+{
+  raft::handle_t handle{};
+  create_edgelist(handle);
+  auto container = create_container(handle);
+
+  pagerank<float>(handle, *container);
+  auto float_graph_ptr = container->cached_graphs[1].graph_ptr;
+  auto float_type_id   = container->cached_graphs[1].graph_type_id;
+  ASSERT_TRUE(float_graph_ptr);
+
+  // graph_t<int32_t, int32_t, double, true, false> shares the slot with the cached
+  // graph_t<int32_t, int32_t, float, true, false> instance and replaces it
+  pagerank<double>(handle, *container);
+  ASSERT_TRUE(container->cached_graphs[1].graph_ptr);
+  ASSERT_NE(container->cached_graphs[1].graph_ptr, float_graph_ptr);
+  ASSERT_NE(container->cached_graphs[1].graph_type_id, float_type_id);
+
+  auto double_graph_ptr = container->cached_graphs[1].graph_ptr;
+  pagerank<double>(handle, *container);
+  ASSERT_EQ(container->cached_graphs[1].graph_ptr, double_graph_ptr);
+}
+
+TEST_F(Tests_GraphContainer, RebuildOnHandleMismatch)
+{
+  raft::handle_t handle{};
+  create_edgelist(handle);
+  auto container = create_container(handle);
+
+  pagerank<float>(handle, *container);
+  auto graph_ptr = container->cached_graphs[1].graph_ptr;
+  ASSERT_TRUE(graph_ptr);
+
+  raft::handle_t other_handle{};
+  pagerank<float>(other_handle, *container);
+  ASSERT_TRUE(container->cached_graphs[1].graph_ptr);
+  ASSERT_NE(container->cached_graphs[1].graph_ptr, graph_ptr);
+  ASSERT_EQ(container->cached_graphs[1].handle_ptr, &other_handle);
+}
+
+TEST_F(Tests_GraphContainer, ReleaseCachedGraphs)
+{
+  raft::handle_t handle{};
+  create_edgelist(handle);
+  auto container = create_container(handle);
+
+  pagerank<float>(handle, *container);
+  auto graph_ptr = container->cached_graphs[1].graph_ptr;
+  ASSERT_TRUE(graph_ptr);
+  ASSERT_EQ(graph_ptr.use_count(), 2);
+
+  container->release_cached_graphs();
+  ASSERT_FALSE(container->cached_graphs[0].graph_ptr);
+  ASSERT_FALSE(container->cached_graphs[1].graph_ptr);
+  ASSERT_EQ(container->cached_graphs[1].handle_ptr, nullptr);
+  // instances still referenced elsewhere stay valid
+  ASSERT_EQ(graph_ptr.use_count(), 1);
+
+  pagerank<float>(handle, *container);
+  ASSERT_TRUE(container->cached_graphs[1].graph_ptr);
+  ASSERT_NE(container->cached_graphs[1].graph_ptr, graph_ptr);
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
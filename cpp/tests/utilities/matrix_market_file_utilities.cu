@@ -17,9 +17,11 @@
 #include <utilities/test_utilities.hpp>
 
 #include <experimental/detail/graph_utils.cuh>
+#include <experimental/graph_functions.hpp>
 #include <functions.hpp>
 #include <partition_manager.hpp>
 #include <utilities/error.hpp>
+#include <utilities/shuffle_comm.cuh>
 
 #include <raft/cudart_utils.h>
 #include <rmm/thrust_rmm_allocator.h>
@@ -268,52 +270,8 @@ read_edgelist_from_matrix_market_file(raft::handle_t const& handle,
                                       std::string const& graph_file_full_path,
                                       bool test_weighted)
 {
-  MM_typecode mc{};
-  vertex_t m{};
-  size_t nnz{};
-
-  FILE* file = fopen(graph_file_full_path.c_str(), "r");
-  CUGRAPH_EXPECTS(file != nullptr, "fopen failure.");
-
-  size_t tmp_m{};
-  size_t tmp_k{};
-  auto mm_ret = cugraph::test::mm_properties<size_t>(file, 1, &mc, &tmp_m, &tmp_k, &nnz);
-  CUGRAPH_EXPECTS(mm_ret == 0, "could not read Matrix Market file properties.");
-  m = static_cast<vertex_t>(tmp_m);
-  CUGRAPH_EXPECTS(mm_is_matrix(mc) && mm_is_coordinate(mc) && !mm_is_complex(mc) && !mm_is_skew(mc),
-                  "invalid Matrix Market file properties.");
-
-  vertex_t number_of_vertices = m;
-  bool is_symmetric           = mm_is_symmetric(mc);
-
-  std::vector<vertex_t> h_rows(nnz);
-  std::vector<vertex_t> h_cols(nnz);
-  std::vector<weight_t> h_weights(nnz);
-
-  mm_ret = cugraph::test::mm_to_coo<vertex_t, weight_t>(
-    file, 1, nnz, h_rows.data(), h_cols.data(), h_weights.data(), static_cast<weight_t*>(nullptr));
-  CUGRAPH_EXPECTS(mm_ret == 0, "could not read matrix data");
-
-  auto file_ret = fclose(file);
-  CUGRAPH_EXPECTS(file_ret == 0, "fclose failure.");
-
-  rmm::device_uvector<vertex_t> d_edgelist_rows(h_rows.size(), handle.get_stream());
-  rmm::device_uvector<vertex_t> d_edgelist_cols(h_cols.size(), handle.get_stream());
-  rmm::device_uvector<weight_t> d_edgelist_weights(test_weighted ? h_weights.size() : size_t{0},
-                                                   handle.get_stream());
-
-  raft::update_device(d_edgelist_rows.data(), h_rows.data(), h_rows.size(), handle.get_stream());
-  raft::update_device(d_edgelist_cols.data(), h_cols.data(), h_cols.size(), handle.get_stream());
-  if (test_weighted) {
-    raft::update_device(
-      d_edgelist_weights.data(), h_weights.data(), h_weights.size(), handle.get_stream());
-  }
-
-  return std::make_tuple(std::move(d_edgelist_rows),
-                         std::move(d_edgelist_cols),
-                         std::move(d_edgelist_weights),
-                         number_of_vertices,
-                         is_symmetric);
+  return cugraph::experimental::read_edgelist_from_matrix_market_file<vertex_t, weight_t>(
+    handle, graph_file_full_path, test_weighted);
 }
 
 template <typename vertex_t,
@@ -326,16 +284,40 @@ std::tuple<cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, store_tran
 read_graph_from_matrix_market_file(raft::handle_t const& handle,
                                    std::string const& graph_file_full_path,
                                    bool test_weighted,
-                                   bool renumber)
+                                   bool renumber,
+                                   bool edge_balanced)
 {
+  // in multi-GPU, every GPU reads a disjoint byte range of the file
+
+  size_t byte_range_offset{0};
+  size_t byte_range_size{0};
+  if (multi_gpu) {
+    auto& comm           = handle.get_comms();
+    auto const comm_size = comm.get_size();
+    auto const comm_rank = comm.get_rank();
+
+    FILE* file = fopen(graph_file_full_path.c_str(), "r");
+    CUGRAPH_EXPECTS(file != nullptr, "fopen failure.");
+    CUGRAPH_EXPECTS(fseek(file, 0, SEEK_END) == 0, "fseek failure.");
+    auto file_size = static_cast<size_t>(ftell(file));
+    CUGRAPH_EXPECTS(fclose(file) == 0, "fclose failure.");
+
+    byte_range_size   = (file_size + (comm_size - 1)) / comm_size;
+    byte_range_offset = byte_range_size * comm_rank;
+    if (byte_range_offset >= file_size) {  // read nothing
+      byte_range_offset = file_size;
+      byte_range_size   = 1;
+    }
+  }
+
   rmm::device_uvector<vertex_t> d_edgelist_rows(0, handle.get_stream());
   rmm::device_uvector<vertex_t> d_edgelist_cols(0, handle.get_stream());
   rmm::device_uvector<weight_t> d_edgelist_weights(0, handle.get_stream());
   vertex_t number_of_vertices{};
   bool is_symmetric{};
   std::tie(d_edgelist_rows, d_edgelist_cols, d_edgelist_weights, number_of_vertices, is_symmetric) =
-    read_edgelist_from_matrix_market_file<vertex_t, weight_t>(
-      handle, graph_file_full_path, test_weighted);
+    cugraph::experimental::read_edgelist_from_matrix_market_file<vertex_t, weight_t>(
+      handle, graph_file_full_path, test_weighted, byte_range_offset, byte_range_size);
 
   rmm::device_uvector<vertex_t> d_vertices(number_of_vertices, handle.get_stream());
   thrust::sequence(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
@@ -344,6 +326,8 @@ read_graph_from_matrix_market_file(raft::handle_t const& handle,
                    vertex_t{0});
   handle.get_stream_view().synchronize();
 
+  rmm::device_uvector<vertex_t> d_hub_vertices(0, handle.get_stream());
+  rmm::device_uvector<int> d_hub_gpu_ids(0, handle.get_stream());
   if (multi_gpu) {
     auto& comm               = handle.get_comms();
     auto const comm_size     = comm.get_size();
@@ -353,8 +337,20 @@ read_graph_from_matrix_market_file(raft::handle_t const& handle,
     auto& col_comm           = handle.get_subcomm(cugraph::partition_2d::key_naming_t().col_name());
     auto const col_comm_size = col_comm.get_size();
 
-    auto vertex_key_func =
-      cugraph::experimental::detail::compute_gpu_id_from_vertex_t<vertex_t>{comm_size};
+    if (edge_balanced) {
+      std::tie(d_hub_vertices, d_hub_gpu_ids) =
+        cugraph::experimental::compute_edge_balanced_hub_gpu_ids<vertex_t, edge_t>(
+          handle,
+          d_edgelist_rows.data(),
+          d_edgelist_cols.data(),
+          static_cast<edge_t>(d_edgelist_rows.size()));
+    }
+
+    auto vertex_key_func = cugraph::experimental::detail::compute_gpu_id_from_vertex_t<vertex_t>{
+      comm_size,
+      d_hub_vertices.data(),
+      d_hub_gpu_ids.data(),
+      static_cast<vertex_t>(d_hub_vertices.size())};
     d_vertices.resize(
       thrust::distance(
         d_vertices.begin(),
@@ -368,43 +364,39 @@ read_graph_from_matrix_market_file(raft::handle_t const& handle,
     d_vertices.shrink_to_fit(handle.get_stream());
 
     auto edge_key_func = cugraph::experimental::detail::compute_gpu_id_from_edge_t<vertex_t>{
-      comm_size, row_comm_size, col_comm_size};
-    size_t number_of_local_edges{};
+      comm_size,
+      row_comm_size,
+      col_comm_size,
+      d_hub_vertices.data(),
+      d_hub_gpu_ids.data(),
+      static_cast<vertex_t>(d_hub_vertices.size())};
+    auto& d_edgelist_majors = store_transposed ? d_edgelist_cols : d_edgelist_rows;
+    auto& d_edgelist_minors = store_transposed ? d_edgelist_rows : d_edgelist_cols;
     if (test_weighted) {
-      auto edge_first       = thrust::make_zip_iterator(thrust::make_tuple(
-        d_edgelist_rows.begin(), d_edgelist_cols.begin(), d_edgelist_weights.begin()));
-      number_of_local_edges = thrust::distance(
-        edge_first,
-        thrust::remove_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-                          edge_first,
-                          edge_first + d_edgelist_rows.size(),
-                          [comm_rank, key_func = edge_key_func] __device__(auto e) {
-                            auto major = store_transposed ? thrust::get<1>(e) : thrust::get<0>(e);
-                            auto minor = store_transposed ? thrust::get<0>(e) : thrust::get<1>(e);
-                            return key_func(major, minor) != comm_rank;
-                          }));
+      auto edge_first = thrust::make_zip_iterator(thrust::make_tuple(
+        d_edgelist_majors.begin(), d_edgelist_minors.begin(), d_edgelist_weights.begin()));
+      std::forward_as_tuple(std::tie(d_edgelist_majors, d_edgelist_minors, d_edgelist_weights),
+                            std::ignore) =
+        cugraph::experimental::groupby_gpuid_and_shuffle_values(
+          comm,
+          edge_first,
+          edge_first + d_edgelist_majors.size(),
+          [key_func = edge_key_func] __device__(auto val) {
+            return key_func(thrust::get<0>(val), thrust::get<1>(val));
+          },
+          handle.get_stream());
     } else {
       auto edge_first = thrust::make_zip_iterator(
-        thrust::make_tuple(d_edgelist_rows.begin(), d_edgelist_cols.begin()));
-      number_of_local_edges = thrust::distance(
-        edge_first,
-        thrust::remove_if(rmm::exec_policy(handle.get_stream())->on(handle.get_stream()),
-                          edge_first,
-                          edge_first + d_edgelist_rows.size(),
-                          [comm_rank, key_func = edge_key_func] __device__(auto e) {
-                            auto major = store_transposed ? thrust::get<1>(e) : thrust::get<0>(e);
-                            auto minor = store_transposed ? thrust::get<0>(e) : thrust::get<1>(e);
-                            return key_func(major, minor) != comm_rank;
-                          }));
-    }
-
-    d_edgelist_rows.resize(number_of_local_edges, handle.get_stream());
-    d_edgelist_rows.shrink_to_fit(handle.get_stream());
-    d_edgelist_cols.resize(number_of_local_edges, handle.get_stream());
-    d_edgelist_cols.shrink_to_fit(handle.get_stream());
-    if (test_weighted) {
-      d_edgelist_weights.resize(number_of_local_edges, handle.get_stream());
-      d_edgelist_weights.shrink_to_fit(handle.get_stream());
+        thrust::make_tuple(d_edgelist_majors.begin(), d_edgelist_minors.begin()));
+      std::forward_as_tuple(std::tie(d_edgelist_majors, d_edgelist_minors), std::ignore) =
+        cugraph::experimental::groupby_gpuid_and_shuffle_values(
+          comm,
+          edge_first,
+          edge_first + d_edgelist_majors.size(),
+          [key_func = edge_key_func] __device__(auto val) {
+            return key_func(thrust::get<0>(val), thrust::get<1>(val));
+          },
+          handle.get_stream());
     }
   }
 
@@ -417,7 +409,10 @@ read_graph_from_matrix_market_file(raft::handle_t const& handle,
     std::move(d_edgelist_weights),
     is_symmetric,
     test_weighted,
-    renumber);
+    renumber,
+    d_hub_vertices.data(),
+    d_hub_gpu_ids.data(),
+    static_cast<vertex_t>(d_hub_vertices.size()));
 }
 
 // explicit instantiations
@@ -464,7 +459,8 @@ read_graph_from_matrix_market_file<int32_t, int32_t, float, false, false>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int32_t, float, false, true>,
                     rmm::device_uvector<int32_t>>
@@ -472,7 +468,8 @@ read_graph_from_matrix_market_file<int32_t, int32_t, float, false, true>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int32_t, float, true, false>,
                     rmm::device_uvector<int32_t>>
@@ -480,7 +477,8 @@ read_graph_from_matrix_market_file<int32_t, int32_t, float, true, false>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int32_t, float, true, true>,
                     rmm::device_uvector<int32_t>>
@@ -488,7 +486,8 @@ read_graph_from_matrix_market_file<int32_t, int32_t, float, true, true>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int32_t, double, false, false>,
                     rmm::device_uvector<int32_t>>
@@ -496,7 +495,8 @@ read_graph_from_matrix_market_file<int32_t, int32_t, double, false, false>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int32_t, double, false, true>,
                     rmm::device_uvector<int32_t>>
@@ -504,7 +504,8 @@ read_graph_from_matrix_market_file<int32_t, int32_t, double, false, true>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int32_t, double, true, false>,
                     rmm::device_uvector<int32_t>>
@@ -512,7 +513,8 @@ read_graph_from_matrix_market_file<int32_t, int32_t, double, true, false>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int32_t, double, true, true>,
                     rmm::device_uvector<int32_t>>
@@ -520,7 +522,8 @@ read_graph_from_matrix_market_file<int32_t, int32_t, double, true, true>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int64_t, float, false, false>,
                     rmm::device_uvector<int32_t>>
@@ -528,7 +531,8 @@ read_graph_from_matrix_market_file<int32_t, int64_t, float, false, false>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int64_t, float, false, true>,
                     rmm::device_uvector<int32_t>>
@@ -536,7 +540,8 @@ read_graph_from_matrix_market_file<int32_t, int64_t, float, false, true>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int64_t, float, true, false>,
                     rmm::device_uvector<int32_t>>
@@ -544,7 +549,8 @@ read_graph_from_matrix_market_file<int32_t, int64_t, float, true, false>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int64_t, float, true, true>,
                     rmm::device_uvector<int32_t>>
@@ -552,7 +558,8 @@ read_graph_from_matrix_market_file<int32_t, int64_t, float, true, true>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int64_t, double, false, false>,
                     rmm::device_uvector<int32_t>>
@@ -560,7 +567,8 @@ read_graph_from_matrix_market_file<int32_t, int64_t, double, false, false>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int64_t, double, false, true>,
                     rmm::device_uvector<int32_t>>
@@ -568,7 +576,8 @@ read_graph_from_matrix_market_file<int32_t, int64_t, double, false, true>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int64_t, double, true, false>,
                     rmm::device_uvector<int32_t>>
@@ -576,7 +585,8 @@ read_graph_from_matrix_market_file<int32_t, int64_t, double, true, false>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int32_t, int64_t, double, true, true>,
                     rmm::device_uvector<int32_t>>
@@ -584,7 +594,8 @@ read_graph_from_matrix_market_file<int32_t, int64_t, double, true, true>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int64_t, int64_t, float, false, false>,
                     rmm::device_uvector<int64_t>>
@@ -592,7 +603,8 @@ read_graph_from_matrix_market_file<int64_t, int64_t, float, false, false>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int64_t, int64_t, float, false, true>,
                     rmm::device_uvector<int64_t>>
@@ -600,7 +612,8 @@ read_graph_from_matrix_market_file<int64_t, int64_t, float, false, true>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int64_t, int64_t, float, true, false>,
                     rmm::device_uvector<int64_t>>
@@ -608,7 +621,8 @@ read_graph_from_matrix_market_file<int64_t, int64_t, float, true, false>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int64_t, int64_t, float, true, true>,
                     rmm::device_uvector<int64_t>>
@@ -616,7 +630,8 @@ read_graph_from_matrix_market_file<int64_t, int64_t, float, true, true>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int64_t, int64_t, double, false, false>,
                     rmm::device_uvector<int64_t>>
@@ -624,7 +639,8 @@ read_graph_from_matrix_market_file<int64_t, int64_t, double, false, false>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int64_t, int64_t, double, false, true>,
                     rmm::device_uvector<int64_t>>
@@ -632,7 +648,8 @@ read_graph_from_matrix_market_file<int64_t, int64_t, double, false, true>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int64_t, int64_t, double, true, false>,
                     rmm::device_uvector<int64_t>>
@@ -640,7 +657,8 @@ read_graph_from_matrix_market_file<int64_t, int64_t, double, true, false>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 template std::tuple<cugraph::experimental::graph_t<int64_t, int64_t, double, true, true>,
                     rmm::device_uvector<int64_t>>
@@ -648,7 +666,8 @@ read_graph_from_matrix_market_file<int64_t, int64_t, double, true, true>(
   raft::handle_t const& handle,
   std::string const& graph_file_full_path,
   bool test_weighted,
-  bool renumber);
+  bool renumber,
+  bool edge_balanced);
 
 }  // namespace test
 }  // namespace cugraph
@@ -106,6 +106,8 @@ static const std::string& get_rapids_dataset_root_dir()
   return rdrd;
 }
 
+// in multi-GPU, vertices and edges should be pre-shuffled with the vertex to GPU mapping with the
+// hub vertices (if any, see cugraph::experimental::compute_edge_balanced_hub_gpu_ids)
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
@@ -120,7 +122,10 @@ generate_graph_from_edgelist(raft::handle_t const& handle,
                              rmm::device_uvector<weight_t>&& edgelist_weights,
                              bool is_symmetric,
                              bool test_weighted,
-                             bool renumber);
+                             bool renumber,
+                             vertex_t const* hub_vertices = nullptr,
+                             int const* hub_gpu_ids       = nullptr,
+                             vertex_t num_hubs            = 0);
 
 // returns a tuple of (rows, columns, weights, number_of_vertices, is_symmetric)
 template <typename vertex_t, typename weight_t>
@@ -134,6 +139,8 @@ read_edgelist_from_matrix_market_file(raft::handle_t const& handle,
                                       bool test_weighted);
 
 // renumber must be true if multi_gpu is true
+// edge_balanced: in multi-GPU, assign the hub vertices to GPUs to balance the edge counts (see
+// cugraph::experimental::compute_edge_balanced_hub_gpu_ids) instead of hashing every vertex
 template <typename vertex_t,
           typename edge_t,
           typename weight_t,
@@ -144,7 +151,8 @@ std::tuple<cugraph::experimental::graph_t<vertex_t, edge_t, weight_t, store_tran
 read_graph_from_matrix_market_file(raft::handle_t const& handle,
                                    std::string const& graph_file_full_path,
                                    bool test_weighted,
-                                   bool renumber);
+                                   bool renumber,
+                                   bool edge_balanced = false);
 
 template <typename vertex_t,
           typename edge_t,
@@ -24,12 +24,9 @@ def hits(G, max_iter=100, tol=1.0e-5, nstart=None, normalized=True):
     estimates the node value based on the incoming links.  Hubs estimates
     the node value based on outgoing links.
 
-    The cuGraph implementation of HITS is a wrapper around the gunrock
-    implementation of HITS.
-
-    Note that the gunrock implementation uses a 2-norm, while networkx
-    uses a 1-norm.  The raw scores will be different, but the rank ordering
-    should be comparable with networkx.
+    Hub and authority values are normalized by their maximum values in every
+    iteration and (if normalized is True) to sum to 1.0 before returning, as
+    in networkx.
 
     Parameters
     ----------
@@ -39,16 +36,13 @@ def hits(G, max_iter=100, tol=1.0e-5, nstart=None, normalized=True):
         The adjacency list will be computed if not already present.
     max_iter : int
         The maximum number of iterations before an answer is returned.
-        The gunrock implementation does not currently support tolerance,
-        so this will in fact be the number of iterations the HITS algorithm
-        executes.
     tolerance : float
         Set the tolerance the approximation, this parameter should be a small
-        magnitude value.  This parameter is not currently supported.
+        magnitude value.
     nstart : cudf.Dataframe
         Not currently supported
     normalized : bool
-        Not currently supported, always used as True
+        If True, normalize the resulting hub and authority values
 
     Returns
     -------
@@ -25,24 +25,94 @@ import cudf
 import numpy as np
 
 
-def pagerank(input_graph, alpha=0.85, personalization=None, max_iter=100, tol=1.0e-5, nstart=None):
+cdef class PagerankGraphContainer:
     """
-    Call pagerank
+    Holds a graph_container_t (and the handle the cached graph_t instance is
+    created with) across pagerank calls on the same graph, so the graph_t
+    instance is built by the first call and reused by the following calls.
     """
-
     cdef unique_ptr[handle_t] handle_ptr
-    handle_ptr.reset(new handle_t())
-    handle_ = handle_ptr.get();
+    cdef shared_ptr[graph_container_t] graph_container_ptr
+    # the edge list the container is populated with; src, dst, and weights
+    # also keep the arrays passed to populate_graph_container() alive
+    cdef object edgelist_df
+    cdef object src
+    cdef object dst
+    cdef object weights
 
-    [src, dst] = graph_primtypes_wrapper.datatype_cast([input_graph.edgelist.edgelist_df['src'], input_graph.edgelist.edgelist_df['dst']], [np.int32])
-    weights = None
+
+cdef PagerankGraphContainer get_graph_container(input_graph):
+    """
+    Returns the container cached in input_graph, or creates (and caches) a new
+    one if there is none or the graph has a new edge list since.
+    """
+    cdef PagerankGraphContainer holder = getattr(input_graph, "pagerank_graph_container", None)
+    edgelist_df = input_graph.edgelist.edgelist_df
+    if holder is not None and holder.edgelist_df is edgelist_df:
+        return holder
+
+    holder = PagerankGraphContainer()
+    holder.handle_ptr.reset(new handle_t())
+    holder.graph_container_ptr = create_graph_container()
+    holder.edgelist_df = edgelist_df
+
+    [holder.src, holder.dst] = graph_primtypes_wrapper.datatype_cast([edgelist_df['src'], edgelist_df['dst']], [np.int32])
+    holder.weights = None
     if input_graph.edgelist.weights:
-        [weights] = graph_primtypes_wrapper.datatype_cast([input_graph.edgelist.edgelist_df['weights']], [np.float32, np.float64])
+        [holder.weights] = graph_primtypes_wrapper.datatype_cast([edgelist_df['weights']], [np.float32, np.float64])
 
     num_verts = input_graph.number_of_vertices()
     num_edges = input_graph.number_of_edges(directed_edges=True)
     # FIXME: needs to be edge_t type not int
-    cdef int num_local_edges = len(src)
+    cdef int num_local_edges = len(holder.src)
+
+    cdef uintptr_t c_src_vertices = holder.src.__cuda_array_interface__['data'][0]
+    cdef uintptr_t c_dst_vertices = holder.dst.__cuda_array_interface__['data'][0]
+    cdef uintptr_t c_edge_weights = <uintptr_t>NULL
+
+    if holder.weights is not None:
+        c_edge_weights = holder.weights.__cuda_array_interface__['data'][0]
+        weight_t = holder.weights.dtype
+        is_weighted = True
+    else:
+        weight_t = np.dtype("float32")
+        is_weighted = False
+
+    # FIXME: Offsets and indices are currently hardcoded to int, but this may
+    #        not be acceptable in the future.
+    numberTypeMap = {np.dtype("int32") : <int>numberTypeEnum.int32Type,
+                     np.dtype("int64") : <int>numberTypeEnum.int64Type,
+                     np.dtype("float32") : <int>numberTypeEnum.floatType,
+                     np.dtype("double") : <int>numberTypeEnum.doubleType}
+
+    populate_graph_container(holder.graph_container_ptr.get()[0],
+                             holder.handle_ptr.get()[0],
+                             <void*>c_src_vertices, <void*>c_dst_vertices, <void*>c_edge_weights,
+                             <void*>NULL,
+                             <numberTypeEnum>(<int>(numberTypeEnum.int32Type)),
+                             <numberTypeEnum>(<int>(numberTypeEnum.int32Type)),
+                             <numberTypeEnum>(<int>(numberTypeMap[weight_t])),
+                             num_local_edges,
+                             num_verts, num_edges,
+                             False,
+                             is_weighted,
+                             True,
+                             False)
+
+    input_graph.pagerank_graph_container = holder
+    return holder
+
+
+def pagerank(input_graph, alpha=0.85, personalization=None, max_iter=100, tol=1.0e-5, nstart=None):
+    """
+    Call pagerank
+    """
+
+    cdef PagerankGraphContainer holder = get_graph_container(input_graph)
+    handle_ = holder.handle_ptr.get();
+    graph_container_ = holder.graph_container_ptr.get();
+
+    num_verts = input_graph.number_of_vertices()
 
     df = cudf.DataFrame()
     df['vertex'] = cudf.Series(np.arange(num_verts, dtype=np.int32))
@@ -62,27 +132,8 @@ def pagerank(input_graph, alpha=0.85, personalization=None, max_iter=100, tol=1.
     cdef uintptr_t c_pers_val = <uintptr_t>NULL
     cdef int sz = 0
 
-    cdef uintptr_t c_src_vertices = src.__cuda_array_interface__['data'][0]
-    cdef uintptr_t c_dst_vertices = dst.__cuda_array_interface__['data'][0]
-    cdef uintptr_t c_edge_weights = <uintptr_t>NULL
-    
     personalization_id_series = None
 
-    if weights is not None:
-        c_edge_weights = weights.__cuda_array_interface__['data'][0]
-        weight_t = weights.dtype
-        is_weighted = True
-    else:
-        weight_t = np.dtype("float32")
-        is_weighted = False
-
-    # FIXME: Offsets and indices are currently hardcoded to int, but this may
-    #        not be acceptable in the future.
-    numberTypeMap = {np.dtype("int32") : <int>numberTypeEnum.int32Type,
-                     np.dtype("int64") : <int>numberTypeEnum.int64Type,
-                     np.dtype("float32") : <int>numberTypeEnum.floatType,
-                     np.dtype("double") : <int>numberTypeEnum.doubleType}
-
     if personalization is not None:
         sz = personalization['vertex'].shape[0]
         personalization['vertex'] = personalization['vertex'].astype(np.int32)
@@ -90,23 +141,8 @@ def pagerank(input_graph, alpha=0.85, personalization=None, max_iter=100, tol=1.
         c_pers_vtx = personalization['vertex'].__cuda_array_interface__['data'][0]
         c_pers_val = personalization['values'].__cuda_array_interface__['data'][0]
 
-    cdef graph_container_t graph_container
-    populate_graph_container(graph_container,
-                             handle_[0],
-                             <void*>c_src_vertices, <void*>c_dst_vertices, <void*>c_edge_weights,
-                             <void*>NULL,
-                             <numberTypeEnum>(<int>(numberTypeEnum.int32Type)),
-                             <numberTypeEnum>(<int>(numberTypeEnum.int32Type)),
-                             <numberTypeEnum>(<int>(numberTypeMap[weight_t])),
-                             num_local_edges,
-                             num_verts, num_edges,
-                             False,
-                             is_weighted,
-                             True,
-                             False)
-
     if (df['pagerank'].dtype == np.float32):
-        call_pagerank[int, float](handle_[0], graph_container,
+        call_pagerank[int, float](handle_[0], graph_container_[0],
                                   <int*>c_identifier,
                                   <float*> c_pagerank_val, sz,
                                   <int*> c_pers_vtx, <float*> c_pers_val,
@@ -114,7 +150,7 @@ def pagerank(input_graph, alpha=0.85, personalization=None, max_iter=100, tol=1.
                                   <int> max_iter, has_guess)
 
     else:
-        call_pagerank[int, double](handle_[0], graph_container,
+        call_pagerank[int, double](handle_[0], graph_container_[0],
                                    <int*>c_identifier,
                                    <double*> c_pagerank_val, sz,
                                    <int*> c_pers_vtx, <double*> c_pers_val,
@@ -103,6 +103,9 @@ class Graph:
         self.transposedadjlist = None
         self.edge_count = None
         self.node_count = None
+        # graph_container_t (with the graph_t instance cached in it) held
+        # across pagerank calls, see link_analysis/pagerank_wrapper.pyx
+        self.pagerank_graph_container = None
 
         # MG - Batch
         self.batch_enabled = False
@@ -208,6 +211,7 @@ class Graph:
         self.edgelist = None
         self.adjlist = None
         self.transposedadjlist = None
+        self.pagerank_graph_container = None
 
         self.batch_edgelists = None
         self.batch_adjlists = None
@@ -19,7 +19,7 @@
 
 from cugraph.raft.common.handle cimport *
 from libcpp cimport bool
-from libcpp.memory cimport unique_ptr
+from libcpp.memory cimport shared_ptr, unique_ptr
 from libcpp.utility cimport pair
 from libcpp.vector cimport vector
 from rmm._lib.device_buffer cimport device_buffer
@@ -34,7 +34,9 @@ cdef extern from "utilities/cython.hpp" namespace "cugraph::cython":
         doubleType "cugraph::cython::numberTypeEnum::doubleType"
 
     cdef cppclass graph_container_t:
-       pass
+        void release_cached_graphs()
+
+    cdef shared_ptr[graph_container_t] create_graph_container() except +
 
     cdef void populate_graph_container(
         graph_container_t &graph_container,
@@ -195,6 +195,32 @@ def test_pagerank(
     assert err < (0.01 * len(cugraph_pr))
 
 
+@pytest.mark.parametrize("graph_file", utils.DATASETS)
+def test_pagerank_graph_container_reuse(graph_file):
+    gc.collect()
+
+    cu_M = utils.read_csv_file(graph_file)
+    G = cugraph.DiGraph()
+    G.from_cudf_edgelist(cu_M, source="0", destination="1", edge_attr="2")
+
+    # the graph container (and the graph_t instance cached in it) built by the
+    # first call is reused by the following calls
+    df1 = cugraph.pagerank(G, tol=1.0e-6)
+    graph_container = G.pagerank_graph_container
+    assert graph_container is not None
+    df2 = cugraph.pagerank(G, tol=1.0e-6)
+    assert G.pagerank_graph_container is graph_container
+
+    df1 = df1.sort_values("vertex").reset_index(drop=True)
+    df2 = df2.sort_values("vertex").reset_index(drop=True)
+    assert np.allclose(
+        df1["pagerank"].to_array(), df2["pagerank"].to_array()
+    )
+
+    G.clear()
+    assert G.pagerank_graph_container is None
+
+
 @pytest.mark.parametrize("graph_file", utils.DATASETS)
 @pytest.mark.parametrize("max_iter", MAX_ITERATIONS)
 @pytest.mark.parametrize("tol", TOLERANCE)
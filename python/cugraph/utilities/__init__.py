@@ -25,3 +25,8 @@ from cugraph.utilities.utils import (import_optional,
                                      is_cp_matrix_type,
                                      is_sp_matrix_type,
                                      )
+from cugraph.utilities.profiling import (set_profiling,
+                                         is_profiling_enabled,
+                                         get_profiling_report,
+                                         clear_profiling_report,
+                                         )
@@ -0,0 +1,33 @@
+# Copyright (c) 2021, NVIDIA CORPORATION.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# cython: profile=False
+# distutils: language = c++
+# cython: embedsignature = True
+# cython: language_level = 3
+
+from libcpp cimport bool
+from libcpp.string cimport string
+
+cdef extern from "utilities/profiling.hpp" namespace "cugraph::experimental":
+
+    cdef void set_profiling(bool enable) except +
+
+    cdef bool is_profiling_enabled() except +
+
+    cdef cppclass profiling_report_t:
+        string to_json() except +
+
+    cdef profiling_report_t get_profiling_report() except +
+
+    cdef void clear_profiling_report() except +
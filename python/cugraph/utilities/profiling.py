@@ -0,0 +1,66 @@
+# Copyright (c) 2021, NVIDIA CORPORATION.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+from cugraph.utilities import profiling_wrapper
+
+
+def set_profiling(enable=True):
+    """
+    Enable or disable the GPU timers and counters of the cuGraph C++
+    algorithms and primitives. Profiling is also enabled if the
+    CUGRAPH_PROFILING environment variable is set to a non-zero value.
+
+    Parameters
+    ----------
+    enable : bool, optional (default=True)
+        Flag to enable (True) or disable (False) profiling.
+    """
+    profiling_wrapper.set_profiling(enable)
+
+
+def is_profiling_enabled():
+    """
+    Return True if profiling is enabled, False otherwise.
+    """
+    return profiling_wrapper.is_profiling_enabled()
+
+
+def get_profiling_report():
+    """
+    Return the profiling report accumulated since the last
+    clear_profiling_report() call.
+
+    Returns
+    -------
+    report : dict
+        report['ranges'] is a list of dictionaries with the 'path' (e.g.
+        'pagerank/copy_v_transform_reduce_in_nbr'), 'num_calls', and
+        'gpu_time_ms' (total GPU time over the calls) of every profiled
+        range. report['counters'] is a list of dictionaries with the 'path'
+        (e.g. 'bfs/frontier_size'), 'num_updates', 'sum', and 'max' of every
+        counter.
+
+    Examples
+    --------
+    >>> cugraph.utilities.set_profiling(True)
+    >>> pr = cugraph.pagerank(G)
+    >>> report = cugraph.utilities.get_profiling_report()
+    """
+    return profiling_wrapper.get_profiling_report()
+
+
+def clear_profiling_report():
+    """
+    Remove every accumulated range record and counter.
+    """
+    profiling_wrapper.clear_profiling_report()
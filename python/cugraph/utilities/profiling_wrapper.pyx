@@ -0,0 +1,45 @@
+# Copyright (c) 2021, NVIDIA CORPORATION.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# cython: profile=False
+# distutils: language = c++
+# cython: embedsignature = True
+# cython: language_level = 3
+
+from cugraph.utilities.profiling cimport set_profiling as c_set_profiling
+from cugraph.utilities.profiling cimport \
+    is_profiling_enabled as c_is_profiling_enabled
+from cugraph.utilities.profiling cimport profiling_report_t
+from cugraph.utilities.profiling cimport \
+    get_profiling_report as c_get_profiling_report
+from cugraph.utilities.profiling cimport \
+    clear_profiling_report as c_clear_profiling_report
+from libcpp cimport bool
+import json
+
+
+def set_profiling(enable):
+    c_set_profiling(<bool>enable)
+
+
+def is_profiling_enabled():
+    return c_is_profiling_enabled()
+
+
+def get_profiling_report():
+    cdef profiling_report_t report = c_get_profiling_report()
+    return json.loads(report.to_json().decode())
+
+
+def clear_profiling_report():
+    c_clear_profiling_report()